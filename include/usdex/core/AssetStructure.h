@@ -8,15 +8,21 @@
 //! @brief Utility functions to create atomic models based on sound asset structure principles
 
 #include "Api.h"
+#include "NameAlgo.h"
 
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/scope.h>
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace usdex::core
 {
@@ -176,6 +182,11 @@ USDEX_API const pxr::TfToken& getGeometryToken();
 //! @returns The token for the Library layer
 USDEX_API const pxr::TfToken& getLibraryToken();
 
+//! Get the token for the LOD variant set
+//!
+//! @returns The token for the LOD variant set
+USDEX_API const pxr::TfToken& getLodToken();
+
 //! Get the token for the Materials layer and scope
 //!
 //! @returns The token for the Materials layer and scope
@@ -253,6 +264,26 @@ USDEX_API pxr::UsdPrim defineReference(pxr::UsdStagePtr stage, const pxr::SdfPat
 //! @returns The newly created reference prim. Returns an invalid prim on error.
 USDEX_API pxr::UsdPrim defineReference(pxr::UsdPrim parent, const pxr::UsdPrim& source, std::optional<std::string_view> name = std::nullopt);
 
+//! Define many references to prims with a single round of change processing
+//!
+//! The result is identical to calling `defineReference` for each path. However, all layer identifiers are resolved within a single
+//! `ArResolverScopedCache`, and the resolved identifiers, relative identifiers, and default prims are computed once per layer rather than
+//! once per reference. All prims are then defined within a single `SdfChangeBlock`, and all references are added within another, so the stage
+//! only processes the changes twice regardless of the number of references.
+//!
+//! This is intended for authoring many references to the same library (e.g. instancing library parts into a layout).
+//!
+//! @param stage The stage on which to define the references
+//! @param paths The absolute prim paths at which to define the references
+//! @param sources The prim to reference at each path. This must contain one prim per path.
+//!
+//! @returns The newly created reference prim for each path, or an invalid prim on error. If the sizes do not match then no prims are defined.
+USDEX_API std::vector<pxr::UsdPrim> defineReferences(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPathVector& paths,
+    const std::vector<pxr::UsdPrim>& sources
+);
+
 //! Define a payload to a prim
 //!
 //! This creates a payload prim that targets a prim in another layer (external payload) or the same layer (internal payload)
@@ -281,6 +312,51 @@ USDEX_API pxr::UsdPrim definePayload(pxr::UsdStagePtr stage, const pxr::SdfPath&
 //! @returns The newly created payload prim. Returns an invalid prim on error.
 USDEX_API pxr::UsdPrim definePayload(pxr::UsdPrim parent, const pxr::UsdPrim& source, std::optional<std::string_view> name = std::nullopt);
 
+//! Define many payloads to prims with a single round of change processing
+//!
+//! The result is identical to calling `definePayload` for each path. However, all layer identifiers are resolved within a single
+//! `ArResolverScopedCache`, and the resolved identifiers, relative identifiers, and default prims are computed once per layer rather than
+//! once per payload. All prims are then defined within a single `SdfChangeBlock`, and all payloads are added within another, so the stage
+//! only processes the changes twice regardless of the number of payloads.
+//!
+//! This is intended for authoring many payloads to the same library (e.g. instancing library parts into a layout).
+//!
+//! @param stage The stage on which to define the payloads
+//! @param paths The absolute prim paths at which to define the payloads
+//! @param sources The prim to payload at each path. This must contain one prim per path.
+//!
+//! @returns The newly created payload prim for each path, or an invalid prim on error. If the sizes do not match then no prims are defined.
+USDEX_API std::vector<pxr::UsdPrim> definePayloads(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPathVector& paths,
+    const std::vector<pxr::UsdPrim>& sources
+);
+
+//! The outcome of `instanceRepeatedReferences`
+struct InstancingReport
+{
+    size_t candidatePrims = 0; //!< The number of prims with references or payloads which could be instanced.
+    size_t instancedPrims = 0; //!< The number of prims which were marked instanceable.
+    size_t prototypes = 0; //!< The number of distinct sources shared by the instanced prims, each of which becomes one USD prototype.
+    double instancingRatio = 0.0; //!< The average number of instanced prims per prototype, or zero if no prims were instanced.
+};
+
+//! Mark prims which reference or payload identical sources as instanceable, so they share USD native instancing prototypes
+//!
+//! The stage is traversed for prims with references or payloads authored in the edit target layer. Prims are grouped by all of their
+//! composition arcs in that layer (references, payloads, inherits, specializes, and variant selections, including asset paths, prim paths,
+//! and layer offsets), and each group of at least `minInstances` prims is marked instanceable within a single `SdfChangeBlock`.
+//!
+//! Opinions authored on the instanced prim itself (e.g. its transform) remain in effect. However, USD ignores opinions authored on the
+//! descendants of an instance, so prims with descendant opinions in any layer of the local layer stack are not considered, nor are prims
+//! which already have an authored `instanceable` value, or which are descendants of another candidate.
+//!
+//! @param stage The stage to search for repeated references and payloads
+//! @param minInstances The minimum number of prims which must share identical arcs before they are marked instanceable
+//!
+//! @returns An `InstancingReport` describing the prims which were considered and instanced.
+USDEX_API InstancingReport instanceRepeatedReferences(pxr::UsdStagePtr stage, size_t minInstances = 2);
+
 //! Create a relative layer within a `getPayloadToken()` subdirectory to hold the content of an asset
 //!
 //! This layer represents the root layer of the Payload that the Asset Interface targets.
@@ -300,6 +376,26 @@ USDEX_API pxr::UsdStageRefPtr createAssetPayload(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
 );
 
+//! Create a relative layer within a `getPayloadToken()/<lod>` subdirectory to hold the content of one level of detail (LOD) of an asset
+//!
+//! This is equivalent to `createAssetPayload`, but each LOD is held in its own subdirectory, so the Content Layers and Asset Libraries
+//! which are subsequently added to it (via `addAssetContent()` and `addAssetLibrary()`) are independent of those of every other LOD.
+//!
+//! @note This function does not create an actual Payload. The payload layers of all LODs should eventually be the targets of the
+//! Payloads within the LOD variant set of the Asset Interface (via `addAssetLodInterface()`).
+//!
+//! @param stage The stage's edit target identifier will dictate where the relative payload layer will be created
+//! @param lod The name of the LOD (e.g. "Proxy" or "Render"). This must be a valid identifier, as it names both a directory and a variant.
+//! @param format The file format extension (default: "usda")
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied during stage creation.
+//! @returns The newly created relative payload layer opened as a new stage. Returns an invalid stage on error.
+USDEX_API pxr::UsdStageRefPtr createAssetLodPayload(
+    pxr::UsdStagePtr stage,
+    const std::string& lod,
+    const std::string& format = "usda",
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+);
+
 //! Create a Library Layer from which the Content Layers can reference prims
 //!
 //! This layer will contain a library of meshes, materials, prototypes for instances, or anything else that can be referenced by
@@ -353,6 +449,145 @@ USDEX_API pxr::UsdStageRefPtr addAssetContent(
 //! @returns True if the Asset Interface was added successfully, false otherwise
 USDEX_API bool addAssetInterface(pxr::UsdStagePtr stage, const pxr::UsdStagePtr source);
 
+//! Add an Asset Interface to a layer, which payloads a source layer's contents, without composing either layer
+//!
+//! This is equivalent to `addAssetInterface`, but the Asset Interface is authored from the layer metadata and the prim specs of the source
+//! layer and its sublayers, which are opened but never composed. This avoids the cost of composing (and loading) the full payload hierarchy,
+//! which usually dominates the cost of `addAssetInterface` for large assets.
+//!
+//! As the payload is not composed, the annotations differ from `addAssetInterface` in a few ways:
+//!   - The kinds of descendants are only adjusted for prim specs in the source layer stack. Kinds introduced by composition arcs within the
+//!     payload are not considered.
+//!   - The extents hint is not computed. If the default prim of the source layer stack has an authored `extentsHint` it is copied to the
+//!     Asset Interface, otherwise no extents hint is authored.
+//!
+//! @note The layer is not saved, so that the Asset Interface can be further annotated before saving.
+//!
+//! @param layer The layer which will become the Asset Interface
+//! @param source The layer that the Asset Interface will target as a Payload
+//! @returns True if the Asset Interface was added successfully, false otherwise
+USDEX_API bool addAssetInterface(pxr::SdfLayerHandle layer, const pxr::SdfLayerHandle source);
+
+//! Add an Asset Interface to each of many layers, which payload their source layers' contents, authoring the Asset Interfaces concurrently
+//!
+//! This is equivalent to calling the layer overload of `addAssetInterface` for each pair of layers, but the Asset Interfaces are authored by
+//! independent workers. A failure to author one Asset Interface does not prevent the others from being authored.
+//!
+//! @warning Each layer must be distinct, and must not be a source layer (or a sublayer of a source layer) of another Asset Interface.
+//!
+//! @param layers The layers which will become the Asset Interfaces
+//! @param sources The layer that each Asset Interface will target as a Payload. This must be the same size as `layers`.
+//! @returns True if all of the Asset Interfaces were added successfully, false otherwise
+USDEX_API bool addAssetInterfaces(const std::vector<pxr::SdfLayerHandle>& layers, const std::vector<pxr::SdfLayerHandle>& sources);
+
+//! Add an Asset Interface to a stage, which payloads one of several levels of detail (LODs) selected by a variant set
+//!
+//! This is equivalent to `addAssetInterface`, but the default prim authors a `getLodToken()` variant set with one variant per LOD, and
+//! each variant holds the Payload to the contents of that LOD. As only the selected variant is composed, opening the asset only opens the
+//! layers of the selected LOD, so a light proxy LOD opens without touching the layers of any heavier LOD.
+//!
+//! The variant of each LOD is authored directly on its variant spec, so no LOD other than the default is ever composed by this function.
+//! The stage is (re)configured with the metadata of the default LOD, and the extents hint is computed from the default LOD.
+//!
+//! @param stage The stage's edit target will become the Asset Interface
+//! @param lodSources The name of each LOD, in order, with the stage its variant will target as a Payload (e.g. from `createAssetLodPayload`)
+//! @param defaultLod The name of the LOD which is selected by default. This must be one of the LODs.
+//! @returns True if the Asset Interface was added successfully, false otherwise
+USDEX_API bool addAssetLodInterface(
+    pxr::UsdStagePtr stage,
+    const std::vector<std::pair<std::string, pxr::UsdStagePtr>>& lodSources,
+    const std::string& defaultLod
+);
+
+//! Author the `extentsHint` of a prim and of every model prim below it, aggregating the extents of the geometry bottom-up
+//!
+//! Viewers can read the bounds of a model from its `extentsHint` without traversing (or loading) its descendants. The extents hints are equivalent
+//! to `UsdGeomModelAPI::ComputeExtentsHint` using a `UsdGeomBBoxCache` which uses extents hints, but they are computed without a bounding box
+//! cache and without loading any payloads:
+//!
+//! - The hierarchy below `root` is traversed once, including the contents of instances. The authored `extent` of each boundable prim (e.g.
+//!   the meshes, points, and curves defined by usdex) is its bound, and its descendants are not considered. Boundable prims without an
+//!   authored `extent` have their extent computed.
+//! - The transforms, purposes, and extents of all prims are read concurrently.
+//! - The extents hints are computed bottom-up, concurrently for the models at each depth, so the `extentsHint` of each nested model is the
+//!   bound it contributes to its ancestors.
+//! - Prims which are not loaded (e.g. an unloaded payload of an asset) contribute their authored `extentsHint`, if any.
+//!
+//! The `UsdGeomModelAPI` is applied and the `extentsHint` is authored on `root` (regardless of its kind) and on each model prim below it
+//! (as per `UsdPrim::IsModel`, e.g. component, group, and assembly prims), except for those within instances. All opinions are authored on
+//! the current edit target within a single `SdfChangeBlock`.
+//!
+//! Authoring the extents hints of the default prim of an asset payload (e.g. from `createAssetPayload`) allows the layer overload of
+//! `addAssetInterface` to carry the extents hint to the Asset Interface.
+//!
+//! @param root The prim whose extents hint, and whose descendant models' extents hints, will be authored
+//! @param time The time at which to compute and author the extents hints
+//! @returns True if all of the extents hints were authored, false otherwise
+USDEX_API bool authorExtentsHints(pxr::UsdPrim root, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
+
+//! Update the `extentsHint` of a prim and of the model prims below it which are affected by edits, after `authorExtentsHints`
+//!
+//! This is equivalent to `authorExtentsHints`, but only the extents hints of models which are (or are ancestors of) an edited path are
+//! recomputed. Every other model with an authored `extentsHint` contributes it as its bound, and its descendants are not traversed, so the cost
+//! of the update is proportional to the edited models rather than to the whole hierarchy. Models which do not yet have an authored
+//! `extentsHint` are always computed and authored.
+//!
+//! @param root The prim whose extents hint, and whose descendant models' extents hints, will be updated
+//! @param editedPaths The paths of the prims or properties which have been edited, added, or removed. Paths outside `root` are ignored.
+//! @param time The time at which to compute and author the extents hints
+//! @returns True if all of the affected extents hints were authored (or none were affected), false otherwise
+USDEX_API bool updateExtentsHints(
+    pxr::UsdPrim root,
+    const pxr::SdfPathVector& editedPaths,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+);
+
+//! A callable which authors the data of a single `AssetContentStream`.
+//!
+//! @param contentStage The Content Layer of the stream, opened as a stage
+//! @param libraryStage The Library Layer of the stream, opened as a stage, or an invalid stage if the stream does not have a library
+//! @param nameCache A `NameCache` which is only used by this stream
+//! @returns True if the content was authored successfully, false otherwise
+using AssetContentFn = std::function<bool(pxr::UsdStagePtr contentStage, pxr::UsdStagePtr libraryStage, NameCache& nameCache)>;
+
+//! A domain of an asset (e.g. Geometry, Materials, Physics) to be authored by `authorAssetContents`.
+struct AssetContentStream
+{
+    std::string name; //!< The name of the Content Layer and of the Library Layer (e.g., "Geometry", "Materials", "Physics")
+    AssetContentFn author; //!< Authors the data of the Content Layer and of the Library Layer
+    bool addLibrary = false; //!< Whether to create a Library Layer for the stream, as per `addAssetLibrary`
+    std::string format = "usda"; //!< The file format extension of the Content Layer
+    std::string libraryFormat = "usdc"; //!< The file format extension of the Library Layer
+    pxr::SdfLayer::FileFormatArguments fileFormatArgs; //!< Additional file format-specific arguments to be supplied during stage creation
+};
+
+//! Create, author, and assemble all of the layers of an asset, authoring the data of each domain concurrently
+//!
+//! This is equivalent to calling `createAssetPayload`, then `addAssetLibrary` and `addAssetContent` for each stream, authoring and saving each
+//! stream in turn, and finally saving the payload stage and calling `addAssetInterface`. However, the data of the streams is authored by
+//! independent workers, so the total time is close to that of the slowest stream.
+//!
+//! All of the layers are created up front on the calling thread, in the order of the streams. Each stream is then authored and saved by its own
+//! worker, using its own content stage, library stage, and `NameCache`. Note that each stream is prepended to the subLayers of the payload, as
+//! per `addAssetContent`, so later streams are stronger than earlier streams.
+//!
+//! @warning The streams are authored concurrently, so each stream must only author (and compose) its own layers. For example, a Materials
+//! Content Layer may bind materials to the geometry prims using `over` prims, but it must not reference the Geometry Library Layer.
+//!
+//! @note The asset stage itself is not saved, so that the Asset Interface can be further annotated before saving.
+//!
+//! @param stage The stage's edit target identifier will dictate where the asset layers will be created and will become the Asset Interface
+//! @param streams The domains of the asset to author
+//! @param payloadFormat The file format extension of the payload layer (default: "usda")
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied during creation of the payload stage.
+//! @returns True if all of the streams were authored and saved, and the Asset Interface was added successfully, false otherwise
+USDEX_API bool authorAssetContents(
+    pxr::UsdStagePtr stage,
+    const std::vector<AssetContentStream>& streams,
+    const std::string& payloadFormat = "usda",
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+);
+
 //! @}
 
 } // namespace usdex::core
@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/core/Authoring.h
+//! @brief Utilities to control how OpenUSD Exchange functions author opinions.
+
+#include "usdex/core/Api.h"
+#include "usdex/core/NameAlgo.h"
+
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace usdex::core
+{
+
+//! @defgroup authoring Authoring Controls
+//!
+//! Utilities to control how OpenUSD Exchange functions author opinions.
+//!
+//! By default, the `define` functions (e.g. `defineXform`, `defineScope`, `definePolyMesh`, `definePreviewMaterial`) author all opinions via
+//! the `UsdPrim` and `UsdAttribute` API. Each individual edit is processed by the `UsdStage` before the next edit can be made.
+//!
+//! Exporters which write large fresh layers from scratch can instead select the `AuthoringBackend::eSdf` backend. The prim specs are then
+//! authored directly on the `SdfLayer` of the current `UsdEditTarget`, and the attributes of each prim are authored within an `SdfChangeBlock`,
+//! so the stage processes a single round of changes per prim definition. The authored opinions and the validation of all arguments are
+//! identical regardless of the backend.
+//!
+//! The backend is selected per thread, and is most conveniently applied to a single call or to a whole authoring session using a
+//! `ScopedAuthoringBackend`.
+//!
+//! @warning The `define` functions must not be called while an `SdfChangeBlock` is open, regardless of the backend, as the stage can not
+//! recompose the newly defined prims until the change block is closed.
+//!
+//! @{
+
+//! Controls how the `define` functions author opinions on the stage.
+enum class AuthoringBackend
+{
+    eUsd = 0, //!< Author all opinions via the `UsdPrim` and `UsdAttribute` API. Each edit is processed by the stage individually.
+    eSdf, //!< Author prim specs directly on the edit target `SdfLayer` and batch the authoring of each prim within an `SdfChangeBlock`.
+};
+
+//! Get the `AuthoringBackend` used by the `define` functions on the calling thread.
+//!
+//! @returns The `AuthoringBackend` of the calling thread. Defaults to `AuthoringBackend::eUsd`.
+USDEX_API AuthoringBackend getAuthoringBackend();
+
+//! Set the `AuthoringBackend` used by the `define` functions on the calling thread.
+//!
+//! Prefer a `ScopedAuthoringBackend` to ensure the previous backend is restored.
+//!
+//! @param value The `AuthoringBackend` for subsequent calls on the calling thread.
+USDEX_API void setAuthoringBackend(AuthoringBackend value);
+
+//! Select an `AuthoringBackend` on the calling thread for the lifetime of this object.
+//!
+//! The previous backend is restored on destruction, so scopes can be nested.
+class USDEX_API ScopedAuthoringBackend
+{
+
+public:
+
+    //! Select the `AuthoringBackend` for the calling thread until this object is destroyed.
+    //!
+    //! @param value The `AuthoringBackend` to select.
+    explicit ScopedAuthoringBackend(AuthoringBackend value);
+
+    //! Restores the previous `AuthoringBackend` of the calling thread.
+    ~ScopedAuthoringBackend();
+
+    ScopedAuthoringBackend(const ScopedAuthoringBackend&) = delete;
+    ScopedAuthoringBackend& operator=(const ScopedAuthoringBackend&) = delete;
+
+private:
+
+    AuthoringBackend m_previous;
+};
+
+//! Controls how thoroughly the geometry `define` functions validate their arguments.
+//!
+//! By default, the `define` functions of meshes, points, and curves validate the contents of every array before authoring any opinion (e.g.
+//! that every face vertex index refers to a point, that every primvar index refers to a value, and that the curve vertex counts form valid
+//! curves from the points). These checks are linear in the size of the arrays, and are a significant part of the cost of authoring large geometry.
+//!
+//! Pipelines which have already validated their data upstream can skip these checks. The cheap structural checks, such as the array sizes
+//! required by the interpolation of each primvar, the locations of the prims, and the compatibility of the curve type, basis and wrap, are
+//! always performed regardless of the policy.
+//!
+//! @warning Invalid data will be authored as provided when its contents are not validated, producing invalid geometry on the stage.
+enum class ValidationPolicy
+{
+    eFull = 0, //!< Validate the contents of every array.
+    eDebug, //!< Validate the contents of every array in debug builds of the library, and trust them in release builds.
+    eTrusted, //!< Trust the contents of the arrays, and only perform the cheap structural checks.
+};
+
+//! Get the `ValidationPolicy` used by the `define` functions on the calling thread.
+//!
+//! @returns The `ValidationPolicy` of the calling thread. Defaults to `ValidationPolicy::eFull`.
+USDEX_API ValidationPolicy getValidationPolicy();
+
+//! Set the `ValidationPolicy` used by the `define` functions on the calling thread.
+//!
+//! Prefer a `ScopedValidationPolicy` to ensure the previous policy is restored.
+//!
+//! @param value The `ValidationPolicy` for subsequent calls on the calling thread.
+USDEX_API void setValidationPolicy(ValidationPolicy value);
+
+//! Select a `ValidationPolicy` on the calling thread for the lifetime of this object.
+//!
+//! The previous policy is restored on destruction, so scopes can be nested. As with the `AuthoringBackend`, this is most conveniently applied
+//! to a single call or to a whole authoring session. Functions which validate many prims concurrently apply the policy of the calling thread to
+//! all of them.
+class USDEX_API ScopedValidationPolicy
+{
+
+public:
+
+    //! Select the `ValidationPolicy` for the calling thread until this object is destroyed.
+    //!
+    //! @param value The `ValidationPolicy` to select.
+    explicit ScopedValidationPolicy(ValidationPolicy value);
+
+    //! Restores the previous `ValidationPolicy` of the calling thread.
+    ~ScopedValidationPolicy();
+
+    ScopedValidationPolicy(const ScopedValidationPolicy&) = delete;
+    ScopedValidationPolicy& operator=(const ScopedValidationPolicy&) = delete;
+
+private:
+
+    ValidationPolicy m_previous;
+};
+
+//! State shared by many authoring calls on a single stage, for the lifetime of this object.
+//!
+//! While the session is active, the edit target of the stage is set to the session edit target and the `AuthoringBackend::eSdf` backend is
+//! selected on the calling thread. The previous edit target and backend are restored when the session ends.
+//!
+//! The session also holds state which would otherwise be re-derived by every call:
+//! - A `NameCache`, for use with `getEditableChildName`, so that unique child names do not need to be recomputed from the existing children.
+//! - The stage metrics, as authored by `configureStage`, read once when the session begins.
+//! - The editability of each existing parent prim. The prim location validation of the `define` functions (and of `isEditablePrimLocation`
+//!   and `areEditablePrimLocations`) on the calling thread uses this cache, so that a prim is only looked up when its parent is an instance
+//!   or instance proxy.
+//!
+//! @warning The session does not defer change processing until it ends. Each `define` function call is still processed by the stage as a
+//! single round of changes, as the stage must recompose the newly defined prim before it is returned. For the same reason, the `define`
+//! functions must not be called while an `SdfChangeBlock` is open.
+//!
+//! @note The session must end on the thread on which it began, and sessions on the same thread must end in the reverse order that they
+//! began. The cached values are not invalidated if the stage metrics or the instancing of the parent prims are changed while the session is
+//! active.
+class USDEX_API AuthoringSession
+{
+
+public:
+
+    //! Begin a session authoring to the current edit target of the stage.
+    //!
+    //! @param stage The stage to author to.
+    explicit AuthoringSession(pxr::UsdStagePtr stage);
+
+    //! Begin a session authoring to the given edit target of the stage.
+    //!
+    //! @param stage The stage to author to.
+    //! @param editTarget The edit target to author to while the session is active.
+    AuthoringSession(pxr::UsdStagePtr stage, const pxr::UsdEditTarget& editTarget);
+
+    //! Ends the session if it is still active.
+    ~AuthoringSession();
+
+    AuthoringSession(const AuthoringSession&) = delete;
+    AuthoringSession& operator=(const AuthoringSession&) = delete;
+
+    //! End the session before this object is destroyed, restoring the previous edit target and `AuthoringBackend`.
+    //!
+    //! Ending a session which has already ended has no effect.
+    void end();
+
+    //! Get whether the session is active.
+    //!
+    //! @returns True until the session has ended.
+    bool isActive() const;
+
+    //! Get the stage of the session.
+    //!
+    //! @returns The stage of the session.
+    pxr::UsdStagePtr getStage() const;
+
+    //! Get the name cache shared by all calls made within the session.
+    //!
+    //! @returns The name cache of the session.
+    NameCache& getNameCache();
+
+    //! Get the up axis of the stage when the session began.
+    //!
+    //! @returns The up axis of the stage.
+    const pxr::TfToken& getUpAxis() const;
+
+    //! Get the linear units of the stage when the session began.
+    //!
+    //! @returns The meters per unit of the stage.
+    double getLinearUnits() const;
+
+    //! Get the mass units of the stage when the session began.
+    //!
+    //! @returns The kilograms per unit of the stage.
+    double getMassUnits() const;
+
+    //! Validate that prim opinions could be authored at this path on the stage of the session.
+    //!
+    //! This calls `isEditablePrimLocation`, which uses the cached editability of the parent of the path when called on the thread of the
+    //! active session.
+    //!
+    //! @param path The Path to consider.
+    //! @param reason The output message for failed validation.
+    //! @returns True if the location is valid, or false otherwise.
+    bool isEditablePrimLocation(const pxr::SdfPath& path, std::string* reason = nullptr);
+
+    //! Make a name valid and unique for use as the name of a child of the given prim, and validate that prim opinions could be authored there.
+    //!
+    //! The name is resolved using the name cache of the session, and the location is validated as in `isEditablePrimLocation`.
+    //!
+    //! @param parent The UsdPrim which would be the parent of the proposed location.
+    //! @param name Preferred name.
+    //! @param reason The output message for failed validation.
+    //! @returns A valid and unique name token, or an invalid token if the location is invalid.
+    pxr::TfToken getEditableChildName(const pxr::UsdPrim& parent, const std::string& name, std::string* reason = nullptr);
+
+private:
+
+    class AuthoringSessionImpl;
+    AuthoringSessionImpl* m_impl;
+};
+
+//! A callback authoring the opinions of one worker of `authorLayersConcurrently`. It must return true if the opinions were authored successfully.
+using LayerAuthoringFn = std::function<bool(AuthoringSession& session)>;
+
+//! Author several independent layers concurrently, giving each worker its own layer, stage, `NameCache`, and `AuthoringSession`.
+//!
+//! A `UsdStage` can not be edited concurrently, so large conversions are otherwise limited to a single thread. Instead, the work can be split
+//! into independent domains (e.g. geometry, materials, and physics) and each domain authored by its own worker.
+//!
+//! All of the layers are created on the calling thread before any worker begins. Each worker layer is anonymous, holds the layer metadata of
+//! the root layer of `stage` (e.g. the `defaultPrim` and stage metrics), and temporarily has the root layer of `stage` as its only subLayer.
+//! This allows each worker to read the existing prims of `stage` and to author opinions on them from its own stage, without modifying the
+//! layers of `stage`. Each worker is then invoked with an `AuthoringSession` on its own stage, targeting its own layer, and with the
+//! `ValidationPolicy` of the calling thread.
+//!
+//! Once all of the workers have finished, their stages are closed and the temporary subLayer is removed, so each layer holds only the opinions
+//! of its worker. The layers can then be combined with the opinions of `stage` using `mergeLayers`, which reports any conflicting opinions,
+//! or exported and added to the subLayers of the edit target.
+//!
+//! @warning The workers run concurrently, so each worker must only author to (and compose) its own stage, and `stage` must not be edited
+//! until this function returns. Workers which author opinions on the same specs will produce conflicts when the layers are merged.
+//!
+//! @param stage The stage whose root layer is read by the workers.
+//! @param workers The workers to invoke, one per layer.
+//! @returns The authored layers, in the order of the workers. The layer of each worker which failed is null.
+USDEX_API std::vector<pxr::SdfLayerRefPtr> authorLayersConcurrently(pxr::UsdStagePtr stage, const std::vector<LayerAuthoringFn>& workers);
+
+//! The options controlling the clip layers authored by a `ValueClipSession`.
+struct ValueClipOptions
+{
+    double framesPerClip = 100.0; //!< The number of time codes held by each clip layer, in the time of the edit target layer. Must be positive.
+    std::string format = "usdc"; //!< The file format extension of the clip layers and the manifest.
+    std::string clipSet = "default"; //!< The name of the clip set to author on the clip prim.
+};
+
+//! Author the time samples of a prim and its descendants to a sequence of value clip layers, for the lifetime of this object.
+//!
+//! Long time-sampled caches (e.g. simulations) otherwise hold every sample in a single layer, which must be read in full whenever the stage
+//! is opened. While the session is active, the time samples authored on the calling thread by `defineDeformingPolyMesh`, the time-sampled
+//! `setLocalTransform` overloads, and `defineAnimatedCamera` for any attribute of the clip prim or its descendants are written to clip layers instead
+//! of the edit target layer. Each clip layer holds `ValueClipOptions::framesPerClip` time codes, and the clips touched by each call are
+//! written concurrently. The attribute specs and any values which are not time-sampled are authored on the edit target layer as usual.
+//!
+//! When the session ends the clip layers are exported concurrently, a manifest of the clip attributes is exported, and the `clips` metadata
+//! is authored on the clip prim in the edit target layer. Stages then only read the clip layer which is active at the current time.
+//!
+//! The clip layers are exported to a directory named after the clips, alongside the edit target layer, e.g. the clips "Simulation" of
+//! "/path/to/shot.usda" are exported to "/path/to/Simulation/Simulation.0000.usdc", "/path/to/Simulation/Simulation.0001.usdc", and so on,
+//! with the manifest at "/path/to/Simulation/Simulation.manifest.usdc". The index of each clip is the floor of its first time code divided by
+//! `ValueClipOptions::framesPerClip`. The first sample of each following clip is also authored in the previous clip, so that values are
+//! interpolated across the boundary between clips.
+//!
+//! @warning Any time samples of a clip attribute on the edit target layer are stronger than the clips, so they are removed when the samples of
+//! the attribute are written to the clips.
+//!
+//! @note The session must end on the thread on which it began. The clip layers are held in memory until the session ends.
+class USDEX_API ValueClipSession
+{
+
+public:
+
+    //! Begin a session writing the time samples of the prim and its descendants to clip layers.
+    //!
+    //! The session is not active if the prim is invalid, if the edit target layer of its stage is anonymous, or if the options are invalid.
+    //!
+    //! @param prim The prim on which to author the `clips` metadata. Its samples, and the samples of its descendants, are written to the clips.
+    //! @param name The name of the clips, which is used for the directory and the file names of the clip layers. It must be a valid identifier.
+    //! @param options The options controlling the clip layers.
+    ValueClipSession(pxr::UsdPrim prim, const std::string& name, const ValueClipOptions& options = ValueClipOptions());
+
+    //! Ends the session if it is still active.
+    ~ValueClipSession();
+
+    ValueClipSession(const ValueClipSession&) = delete;
+    ValueClipSession& operator=(const ValueClipSession&) = delete;
+
+    //! End the session before this object is destroyed, exporting the clip layers and the manifest, and authoring the `clips` metadata.
+    //!
+    //! Time samples authored after the session has ended are written to the edit target layer. Ending a session which has already ended has no
+    //! effect.
+    //!
+    //! @returns True if all of the clips were exported and the metadata was authored, or if the session had already ended.
+    bool end();
+
+    //! Get whether the session is active.
+    //!
+    //! @returns True until the session has ended.
+    bool isActive() const;
+
+    //! Get the asset paths of the clip layers written so far, relative to the edit target layer, in the order of their time codes.
+    //!
+    //! @returns The asset paths of the clip layers.
+    std::vector<std::string> getClipAssetPaths() const;
+
+private:
+
+    class ValueClipSessionImpl;
+    ValueClipSessionImpl* m_impl;
+};
+
+//! @}
+
+} // namespace usdex::core
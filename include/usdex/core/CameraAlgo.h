@@ -13,9 +13,11 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/camera.h>
 
 #include <string>
+#include <vector>
 
 
 namespace usdex::core
@@ -65,6 +67,35 @@ USDEX_API pxr::UsdGeomCamera defineCamera(pxr::UsdPrim parent, const std::string
 //! @returns UsdGeomCamera schema wrapping the converted UsdPrim.
 USDEX_API pxr::UsdGeomCamera defineCamera(pxr::UsdPrim prim, const pxr::GfCamera& cameraData);
 
+//! Defines a 3d camera on the stage which is animated by a sequence of `GfCamera` values.
+//!
+//! This is intended for virtual production and other animated cameras, where the transform, focal length, or focus distance change on every
+//! frame. It is considerably faster than calling `defineCamera` and then `UsdGeomCamera::SetFromCamera` for each frame:
+//!
+//! - The location is validated once, rather than once per frame.
+//! - The attribute values of every frame are derived from the `GfCamera` values concurrently, and the parent transform is only computed
+//!   once unless an ancestor of the camera is itself animated.
+//! - All of the time samples are authored within a single `SdfChangeBlock`, so change notification is only sent once.
+//!
+//! Attributes whose value is the same on every frame (e.g. the apertures of a prime lens) are authored as a single default value rather than
+//! as time samples. All other attributes are authored with one time sample per frame. The resulting camera is otherwise identical to calling
+//! `UsdGeomCamera::SetFromCamera` at each time.
+//!
+//! An invalid UsdGeomCamera will be returned if the frames are not valid, or if the camera attributes could not be authored successfully.
+//!
+//! @param stage The stage on which to define the camera
+//! @param path The absolute prim path at which to define the camera
+//! @param times The time code of each frame. Default time codes are not valid.
+//! @param cameras The camera data of each frame, including the world space transform matrix. This must contain one value per time.
+//!
+//! @returns UsdGeomCamera schema wrapping the defined UsdPrim.
+USDEX_API pxr::UsdGeomCamera defineAnimatedCamera(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const std::vector<pxr::UsdTimeCode>& times,
+    const std::vector<pxr::GfCamera>& cameras
+);
+
 //! @}
 
 } // namespace usdex::core
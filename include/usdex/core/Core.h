@@ -39,5 +39,34 @@ USDEX_API bool withPython();
 
 /// @}
 
+//! @defgroup initialization Library initialization
+//!
+//! Utility functions to pay the one-time startup cost of the library explicitly.
+//!
+//! OpenUSD discovers plugins, loads the schema registry, and populates static token tables lazily, so the first calls to `usdex::core`
+//! functions are considerably slower than subsequent ones. Short lived processes can call `initialize` as early as possible, optionally in
+//! the background while they read their own inputs, so that this cost is not paid by the first authoring call.
+//!
+//! @{
+
+//! Initialize the OpenUSD plugins, registries, and token tables used by `usdex::core`.
+//!
+//! The independent parts of the initialization (e.g. the asset resolver, the file formats, the schema registry & prim definitions of the
+//! schemas authored by `usdex::core`, and the static token tables) run in parallel.
+//!
+//! It is not necessary to call this function, nor to wait for it to complete. Any function may be called while the initialization is in
+//! progress, and will simply wait for any registry it requires. Calling `initialize` again is cheap, and waits for the existing
+//! initialization if requested.
+//!
+//! @param wait Whether to block until the initialization is complete. If false, the initialization continues on a background thread.
+USDEX_API void initialize(bool wait = true);
+
+//! Determine whether a call to `initialize` has completed.
+//!
+//! @returns True if the initialization is complete, false if it is in progress or has not been started.
+USDEX_API bool isInitialized();
+
+//! @}
+
 
 } // namespace usdex::core
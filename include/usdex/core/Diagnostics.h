@@ -12,6 +12,15 @@
 #include <pxr/base/tf/diagnosticLite.h>
 #include <pxr/base/tf/diagnosticMgr.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace usdex::core
 {
 
@@ -28,6 +37,14 @@ namespace usdex::core
 //! - Diagnostics can be filtered by `DiagnosticsLevel`.
 //! - Diagnostics can be redirected to `stdout`, `stderr`, or muted entirely using `DiagnosticsOutputStream`.
 //! - The message formatting is friendlier to end-users.
+//! - Diagnostics can optionally be written asynchronously, so that threads emitting them never wait on console I/O.
+//! - Repeated diagnostics can be deduplicated and rate limited using `DiagnosticsLimits`.
+//! - Diagnostics can be counted by `TfDiagnosticType` and by source function, e.g. to report job metrics, without formatting them.
+//! - Diagnostics can be routed to a callback as structured `DiagnosticRecord` fields, which are only formatted if the callback requests it.
+//!
+//! All of the configuration functions are safe to call while other threads are emitting diagnostics. The `DiagnosticsLevel` can also be
+//! overridden for a single thread (e.g. within the tasks of a noisy parallel section) using a `ScopedDiagnosticsLevel`, without affecting
+//! diagnostics emitted by any other thread.
 //!
 //! @note Use of this `Delegate` is entirely optional and it is not activated by default when loading this module. To active it, client code
 //! must explicitly call `activateDiagnosticsDelegate()`. This is to allow clients to opt-in and to prevent double printing for clients
@@ -52,6 +69,54 @@ enum class DiagnosticsOutputStream
     eStderr //!< All diagnostics print to the `stderr` stream.
 };
 
+//! Limits on the number of diagnostics which are written by the `Delegate`.
+//!
+//! A systematic data problem can cause the same diagnostic to be emitted many thousands of times, in which case formatting and writing them
+//! can cost more than the work which raised them. Diagnostics which exceed these limits are counted but not written, and a summary of the
+//! suppressed counts is written by `flushDiagnostics()` and `deactivateDiagnosticsDelegate()`.
+//!
+//! Fatal diagnostics are never suppressed.
+struct DiagnosticsLimits
+{
+    //! The number of diagnostics written from each call site (a source location and diagnostic code) before further repeats from the site are
+    //! suppressed. The count restarts after each summary. Zero disables deduplication.
+    size_t repeatsPerSite = 0;
+
+    //! The sustained number of diagnostics per second which may be written across all call sites. Zero disables rate limiting.
+    double ratePerSecond = 0.0;
+
+    //! The number of diagnostics which may be written in a burst before the `ratePerSecond` applies.
+    size_t burst = 100;
+};
+
+//! The number of diagnostics of a single `TfDiagnosticType` which were reported by a single source function.
+struct DiagnosticsSourceCount
+{
+    std::string function; //!< The function which reported the diagnostics, or an empty string if the call context was hidden.
+    pxr::TfDiagnosticType code = pxr::TF_DIAGNOSTIC_INVALID_TYPE; //!< The type of the diagnostics.
+    uint64_t count = 0; //!< The number of diagnostics reported.
+    std::vector<std::string> messages; //!< The commentary of the first diagnostics reported, up to the capture limit.
+};
+
+//! The fields of a single diagnostic, as passed to a `DiagnosticsCallbackFn`.
+//!
+//! The string views refer to the diagnostic itself, so they are only valid for the duration of the callback and must be copied to be retained.
+struct DiagnosticRecord
+{
+    //! The type of the diagnostic. Errors which were reported with an application specific error code are `TF_DIAGNOSTIC_NONFATAL_ERROR_TYPE`.
+    pxr::TfDiagnosticType code = pxr::TF_DIAGNOSTIC_INVALID_TYPE;
+    pxr::TfEnum diagnosticCode; //!< The code which was reported, which may be an application specific error code.
+    std::string_view function; //!< The function which reported the diagnostic, or an empty view if the call context was hidden.
+    std::string_view file; //!< The source file which reported the diagnostic, or an empty view if the call context was hidden.
+    size_t line = 0; //!< The source line which reported the diagnostic, or zero if the call context was hidden.
+    std::string_view commentary; //!< The message of the diagnostic.
+};
+
+//! A callback which receives each diagnostic written by the `Delegate`.
+//!
+//! It is invoked on the thread which emitted the diagnostic, so it must be thread-safe, and it must not emit diagnostics itself.
+using DiagnosticsCallbackFn = std::function<void(const DiagnosticRecord& record)>;
+
 //! Test whether the `Delegate` is currently active.
 //!
 //! When active, the `Delegate` replaces the default `TfDiagnosticMgr` printing with a more customized result.
@@ -90,6 +155,46 @@ USDEX_API void setDiagnosticsLevel(DiagnosticsLevel value);
 //! @returns The current `DiagnosticsLevel` for the `Delegate`.
 USDEX_API DiagnosticsLevel getDiagnosticsLevel();
 
+//! Get the `DiagnosticsLevel` override of the calling thread.
+//!
+//! @returns The `DiagnosticsLevel` which applies to diagnostics emitted by the calling thread, or `std::nullopt` if the thread uses the
+//!     level set by `setDiagnosticsLevel()`.
+USDEX_API std::optional<DiagnosticsLevel> getThreadDiagnosticsLevel();
+
+//! Override the `DiagnosticsLevel` for diagnostics emitted by the calling thread.
+//!
+//! The override takes precedence over the level set by `setDiagnosticsLevel()`, but does not affect any other thread. Note that the tasks of
+//! a parallel loop run on worker threads, so the override must be applied within each task.
+//!
+//! Prefer a `ScopedDiagnosticsLevel` to ensure the previous override is restored.
+//!
+//! @param value The `DiagnosticsLevel` for the calling thread, or `std::nullopt` to remove the override.
+USDEX_API void setThreadDiagnosticsLevel(std::optional<DiagnosticsLevel> value);
+
+//! Override the `DiagnosticsLevel` on the calling thread for the lifetime of this object.
+//!
+//! The previous override is restored on destruction, so scopes can be nested.
+class USDEX_API ScopedDiagnosticsLevel
+{
+
+public:
+
+    //! Override the `DiagnosticsLevel` for the calling thread until this object is destroyed.
+    //!
+    //! @param value The `DiagnosticsLevel` to apply.
+    explicit ScopedDiagnosticsLevel(DiagnosticsLevel value);
+
+    //! Restores the previous `DiagnosticsLevel` override of the calling thread.
+    ~ScopedDiagnosticsLevel();
+
+    ScopedDiagnosticsLevel(const ScopedDiagnosticsLevel&) = delete;
+    ScopedDiagnosticsLevel& operator=(const ScopedDiagnosticsLevel&) = delete;
+
+private:
+
+    std::optional<DiagnosticsLevel> m_previous;
+};
+
 //! Get the `DiagnosticsLevel` for a given `TfDiagnosticType`.
 //!
 //! @param code The `TfDiagnosticType` to get the `DiagnosticsLevel` for.
@@ -112,6 +217,114 @@ USDEX_API void setDiagnosticsOutputStream(DiagnosticsOutputStream value);
 //! @returns The current `DiagnosticsOutputStream` for the `Delegate`.
 USDEX_API DiagnosticsOutputStream getDiagnosticsOutputStream();
 
+//! Enable or disable asynchronous output of diagnostics by the `Delegate`.
+//!
+//! By default the `Delegate` writes each diagnostic to the `DiagnosticsOutputStream` on the thread which emitted it. When many threads emit
+//! diagnostics concurrently (e.g. during parallel authoring), they all serialize on the lock of the output stream.
+//!
+//! When asynchronous output is enabled, each diagnostic is formatted on the emitting thread and appended to a lock-free queue, which is drained
+//! by a dedicated writer thread. Threads emitting diagnostics never wait on console I/O. The messages are written in the order in which they
+//! were queued. The queue is flushed when the `Delegate` is deactivated, when asynchronous output is disabled, before a fatal error terminates
+//! the process, and at exit.
+//!
+//! This can be called at any time, but will only take affect after calling `activateDiagnosticsDelegate()`.
+//! See @ref diagnostics for more details.
+//!
+//! @param value Whether diagnostics should be written asynchronously.
+USDEX_API void setDiagnosticsOutputAsync(bool value);
+
+//! Get whether the `Delegate` writes diagnostics asynchronously.
+//!
+//! See `setDiagnosticsOutputAsync()` for more details.
+//!
+//! @returns Whether diagnostics are written asynchronously.
+USDEX_API bool isDiagnosticsOutputAsync();
+
+//! Set the `DiagnosticsLimits` for the `Delegate` to suppress repeated diagnostics.
+//!
+//! This can be called at any time, but will only take affect after calling `activateDiagnosticsDelegate()`.
+//! See @ref diagnostics for more details.
+//!
+//! @param value The limits on the diagnostics that should be emitted.
+USDEX_API void setDiagnosticsLimits(const DiagnosticsLimits& value);
+
+//! Get the current `DiagnosticsLimits` for the `Delegate`.
+//!
+//! @returns The current `DiagnosticsLimits` for the `Delegate`.
+USDEX_API DiagnosticsLimits getDiagnosticsLimits();
+
+//! Set a callback to receive each diagnostic written by the `Delegate` as a structured `DiagnosticRecord`.
+//!
+//! The callback receives the diagnostics which pass the `DiagnosticsLevel` and the `DiagnosticsLimits`, including fatal diagnostics, before
+//! the process is terminated. It is independent of the `DiagnosticsOutputStream`, so an output stream of `DiagnosticsOutputStream::eNone` can
+//! be used to route diagnostics exclusively to the callback, in which case the `Delegate` does not format any messages.
+//!
+//! The callback can be replaced at any time, including while other threads are emitting diagnostics, but a call to the previous callback may
+//! still be in progress when this function returns.
+//!
+//! This can be called at any time, but will only take affect after calling `activateDiagnosticsDelegate()`.
+//!
+//! @param callback The callback which receives each diagnostic, or an empty function to remove the current callback.
+USDEX_API void setDiagnosticsCallback(const DiagnosticsCallbackFn& callback);
+
+//! Format a `DiagnosticRecord` as it would be written to the `DiagnosticsOutputStream` by the `Delegate`.
+//!
+//! @param record The diagnostic to format.
+//! @returns The formatted message, without a trailing newline.
+USDEX_API std::string formatDiagnosticRecord(const DiagnosticRecord& record);
+
+//! Enable or disable counting of the diagnostics received by the `Delegate`.
+//!
+//! Diagnostics are counted regardless of the `DiagnosticsLevel`, `DiagnosticsOutputStream`, and `DiagnosticsLimits`, so an output stream of
+//! `DiagnosticsOutputStream::eNone` can be used to count diagnostics without writing them. Counting does not format any messages. Each
+//! diagnostic costs an atomic increment of its `TfDiagnosticType` count and of its source function count, and the commentary is only copied
+//! for the first occurrences from each source function, up to the capture limit.
+//!
+//! Fatal diagnostics are not counted, as they terminate the process. Errors which are captured and cleared by a `TfErrorMark` are never
+//! received by the `Delegate`, so they are not counted either.
+//!
+//! Counting is disabled by default. This can be called at any time, but will only take affect after calling `activateDiagnosticsDelegate()`.
+//! Disabling counting does not reset the counts accumulated so far.
+//!
+//! @param value Whether diagnostics should be counted.
+USDEX_API void setDiagnosticsCountingEnabled(bool value);
+
+//! Get whether the `Delegate` counts diagnostics.
+//!
+//! @returns Whether diagnostics are counted.
+USDEX_API bool isDiagnosticsCountingEnabled();
+
+//! Set the maximum number of messages captured for each `DiagnosticsSourceCount`.
+//!
+//! @param value The number of messages to capture from each source function and `TfDiagnosticType`. Zero disables message capture.
+USDEX_API void setDiagnosticsCaptureLimit(size_t value);
+
+//! Get the maximum number of messages captured for each `DiagnosticsSourceCount`.
+//!
+//! @returns The number of messages captured from each source function and `TfDiagnosticType`. Defaults to one.
+USDEX_API size_t getDiagnosticsCaptureLimit();
+
+//! Get the number of diagnostics of each `TfDiagnosticType` counted since the last call to `resetDiagnosticsCounts()`.
+//!
+//! Errors which were reported with an application specific error code are counted as `TF_DIAGNOSTIC_NONFATAL_ERROR_TYPE`.
+//!
+//! @returns A map of each `TfDiagnosticType` which has been counted to the number of diagnostics.
+USDEX_API std::map<pxr::TfDiagnosticType, uint64_t> getDiagnosticsCounts();
+
+//! Get the number of diagnostics reported by each source function since the last call to `resetDiagnosticsCounts()`.
+//!
+//! @returns The counts of each source function and `TfDiagnosticType`, sorted by function and then by type.
+USDEX_API std::vector<DiagnosticsSourceCount> getDiagnosticsSourceCounts();
+
+//! Reset all diagnostics counts to zero and discard the captured messages.
+USDEX_API void resetDiagnosticsCounts();
+
+//! Write a summary of any diagnostics suppressed by the `DiagnosticsLimits`, and block until all diagnostics which have been queued for
+//! asynchronous output have been written.
+//!
+//! This is useful prior to writing directly to `stdout` or `stderr`, so that the output is not interleaved with pending diagnostics.
+USDEX_API void flushDiagnostics();
+
 //! }@
 
 } // namespace usdex::core
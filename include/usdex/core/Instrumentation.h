@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/core/Instrumentation.h
+//! @brief Utilities to measure the cost of OpenUSD Exchange authoring calls.
+
+#include "usdex/core/Api.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace usdex::core
+{
+
+//! @defgroup instrumentation Authoring Instrumentation
+//!
+//! Optional counters which accumulate the cost of each OpenUSD Exchange entry point (e.g. `definePolyMesh`, `setLocalTransform`,
+//! `getValidChildNames`, `saveStage`), so that exporters can identify where their authoring time is spent.
+//!
+//! Instrumentation is disabled by default. While it is disabled each instrumented call costs a single relaxed atomic load. Building
+//! `usdex_core` with `USDEX_DISABLE_INSTRUMENTATION` defined removes the instrumentation entirely, in which case it can not be enabled
+//! and no metrics are ever accumulated.
+//!
+//! Only the outermost instrumented call on each thread is measured, so an entry point which calls other entry points (e.g. `setLocalTransforms`
+//! calling `setLocalTransform` for each prim) is reported once, including the cost of the nested calls.
+//!
+//! Asynchronous entry points (e.g. `saveStageAsync`) only measure the work done on the calling thread.
+//!
+//! @{
+
+//! The accumulated cost of all instrumented calls to a single entry point.
+struct AuthoringMetrics
+{
+    uint64_t calls = 0; //!< The number of calls to the entry point.
+    double seconds = 0.0; //!< The accumulated wall time of all calls, in seconds.
+    uint64_t elements = 0; //!< The number of elements processed by all calls (e.g. points, prims, names, or time samples).
+    uint64_t bytes = 0; //!< The number of bytes of array data authored by all calls.
+};
+
+//! Enable or disable the accumulation of `AuthoringMetrics` for subsequent calls on all threads.
+//!
+//! Disabling instrumentation does not reset the metrics accumulated so far.
+//!
+//! @param value Whether to accumulate metrics.
+USDEX_API void setInstrumentationEnabled(bool value);
+
+//! Get whether `AuthoringMetrics` are being accumulated.
+//!
+//! @returns True if instrumentation is enabled. Always false if `usdex_core` was built with `USDEX_DISABLE_INSTRUMENTATION` defined.
+USDEX_API bool isInstrumentationEnabled();
+
+//! Get the metrics accumulated for each entry point since the last call to `resetAuthoringMetrics`.
+//!
+//! Entry points which have not been called while instrumentation was enabled are omitted. All overloads of a function share one entry.
+//!
+//! @returns A map of entry point names to their accumulated `AuthoringMetrics`.
+USDEX_API std::map<std::string, AuthoringMetrics> getAuthoringMetrics();
+
+//! Reset the accumulated metrics of all entry points to zero.
+//!
+//! Calls which are in progress while the metrics are reset may be partially accumulated.
+USDEX_API void resetAuthoringMetrics();
+
+//! @}
+
+} // namespace usdex::core
@@ -9,10 +9,15 @@
 
 #include "Api.h"
 
+#include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
 
+#include <functional>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace usdex::core
 {
@@ -114,6 +119,76 @@ USDEX_API bool exportLayer(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
 );
 
+//! The progress of an `exportLayer` call which reports progress.
+struct ExportLayerProgress
+{
+    size_t primSpecsWritten = 0; //!< The number of prim specs written so far. Prim specs nested in variants are written with their owner.
+    size_t totalPrimSpecs = 0; //!< The number of prim specs to be written.
+    size_t bytesWritten = 0; //!< The size of the exported file. This is zero until the file has been written.
+};
+
+//! A callback reporting the progress of an `exportLayer` call. Returning false cancels the export.
+using ExportLayerProgressFn = std::function<bool(const ExportLayerProgress& progress)>;
+
+//! Export the given `SdfLayer` to an identifier with an optional comment, reporting progress and allowing cancellation.
+//!
+//! Unlike the overload above, the source layer is never modified. The specs are copied one prim at a time into an in-memory output layer,
+//! the authoring metadata and comment are authored on the output layer, and the output layer is then written to the identifier.
+//!
+//! The callback is invoked on the calling thread after each prim spec is copied, and once more after the file has been written. If it returns
+//! false before the file is written then the export is cancelled, nothing is written to the identifier, and false is returned.
+//!
+//! @note The output layer holds a copy of the content of the source layer until the export completes.
+//!
+//! @param layer The layer to be exported.
+//! @param identifier The identifier to be used for the new layer.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+//! @param progressFn The callback to report progress to. It may return false to cancel the export.
+//! @param comment The comment will be authored in the exported layer as the `SdfLayer` comment.
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied during layer export.
+//! @returns A bool indicating if the export was successful. This is false if the export was cancelled.
+USDEX_API bool exportLayer(
+    pxr::SdfLayerHandle layer,
+    const std::string& identifier,
+    const std::string& authoringMetadata,
+    const ExportLayerProgressFn& progressFn,
+    std::optional<std::string_view> comment = std::nullopt,
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+);
+
+//! An opinion which could not be merged by `mergeLayers`, as the target layer already held a different opinion.
+struct LayerMergeConflict
+{
+    pxr::SdfPath path; //!< The path of the spec holding the conflicting opinion.
+    pxr::TfToken field; //!< The field of the conflicting opinion.
+    std::string sourceIdentifier; //!< The identifier of the source layer whose opinion was discarded.
+};
+
+//! Merge the opinions of several `SdfLayers` into a target `SdfLayer`.
+//!
+//! This is intended to combine layers which were authored independently (e.g. concurrently by `authorLayersConcurrently`) into a single layer,
+//! as an alternative to exporting each layer and adding it to the subLayers of the target.
+//!
+//! The sources are merged in order. Specs which do not exist in the target are copied in full, including all of their descendant specs. The
+//! fields of specs which already exist in the target are merged individually: a field which is not yet authored in the target is copied, while
+//! a field whose value differs from the target value is a conflict. The target value is always retained, so earlier sources are stronger than
+//! later sources, matching the order of subLayers. An `over` specifier never conflicts with the specifier of the target.
+//!
+//! A warning is emitted for each source with conflicting opinions, and the individual conflicts can be gathered in `conflicts`.
+//!
+//! @note The layer metadata of the sources is not merged. The source layers are not modified.
+//!
+//! @param target The layer to merge the opinions into.
+//! @param sources The layers to merge, strongest first.
+//! @param conflicts The output conflicts, in the order they were found. Existing items are retained.
+//! @returns True if all sources were merged without conflicts, or false otherwise.
+USDEX_API bool mergeLayers(
+    pxr::SdfLayerHandle target,
+    const std::vector<pxr::SdfLayerHandle>& sources,
+    std::vector<LayerMergeConflict>* conflicts = nullptr
+);
+
 //! @}
 
 } // namespace usdex::core
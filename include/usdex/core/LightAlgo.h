@@ -13,13 +13,17 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdLux/distantLight.h>
 #include <pxr/usd/usdLux/domeLight.h>
+#include <pxr/usd/usdLux/lightAPI.h>
 #include <pxr/usd/usdLux/rectLight.h>
+#include <pxr/usd/usdLux/sphereLight.h>
 #include <pxr/usd/usdLux/tokens.h>
 
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace usdex::core
 {
@@ -43,6 +47,11 @@ namespace usdex::core
 //!
 //! [UsdLux Light CHANGELOG note for 21.02](https://github.com/PixarAnimationStudios/USD/blob/release/CHANGELOG.md#2102---2021-01-18)
 //!
+//! # Defining Many Lights #
+//!
+//! Large lighting rigs (e.g. architectural or stadium scenes) can contain tens of thousands of lights. Use `defineLights()` to define all of
+//! them in a single call, rather than calling the individual light definition functions for each light.
+//!
 //! @{
 
 //! Determines if a UsdPrim has a `UsdLuxLightAPI` schema applied
@@ -194,6 +203,57 @@ USDEX_API pxr::UsdLuxRectLight defineRectLight(
     std::optional<std::string_view> texturePath = std::nullopt
 );
 
+//! Describes a single light to be defined by `defineLights`.
+//!
+//! The members correspond to the arguments of the `define*Light` functions and are subject to the same validation. Members which do not apply
+//! to the `type` of light are ignored.
+class LightDescription
+{
+public:
+
+    //! The types of light which can be defined
+    // clang-format off
+    enum class Type
+    {
+        Dome,    //!< A `UsdLuxDomeLight`, as defined by `defineDomeLight`
+        Rect,    //!< A `UsdLuxRectLight`, as defined by `defineRectLight`
+        Sphere,  //!< A `UsdLuxSphereLight`, which emits light outward from a sphere
+        Distant, //!< A `UsdLuxDistantLight`, which emits light from a distant source along the -Z axis
+    };
+    // clang-format on
+
+    Type type = Type::Rect; //!< The type of light to define
+    pxr::SdfPath path; //!< The absolute prim path at which to define the light
+    float intensity = 1.0f; //!< The intensity value of the light
+    float width = 1.0f; //!< The width of a rect light, in the local X axis
+    float height = 1.0f; //!< The height of a rect light, in the local Y axis
+    float radius = 0.5f; //!< The radius of a sphere light
+    float angle = 0.53f; //!< The angular diameter of a distant light, in degrees
+    std::optional<std::string> texturePath; //!< The path to the texture file to use on a dome or rect light
+    pxr::TfToken textureFormat = pxr::UsdLuxTokens->automatic; //!< How the texture should be mapped on a dome light
+};
+
+//! Defines many lights on the stage in a single call.
+//!
+//! This produces the same scene description as calling the corresponding `define*Light` function for each element of `lights`, but the per-light
+//! overhead is amortized across the batch:
+//!
+//! - The arguments of all lights are validated concurrently, prior to authoring any opinions.
+//! - The light schemas are only resolved once, rather than once per light.
+//! - All of the prims are defined within a single `SdfChangeBlock`, so the stage only recomposes once.
+//! - All of the attributes are authored within a single `SdfChangeBlock`, so change notification is only sent once.
+//!
+//! Sphere and distant lights are authored with the same light API attributes as the other lights (i.e. intensity and exposure), along with their
+//! radius or angle. The extent of each rect and sphere light is authored, as for `defineRectLight`.
+//!
+//! Success or failure is reported per light. Any invalid light is not defined, a runtime error is emitted describing the reason, and an invalid
+//! `UsdLuxLightAPI` is returned at the corresponding index. All other lights are still defined.
+//!
+//! @param stage The stage on which to define the lights
+//! @param lights The descriptions of the lights to define
+//! @returns A `UsdLuxLightAPI` for each element of `lights`, in the same order. Any light which could not be defined will be invalid.
+USDEX_API std::vector<pxr::UsdLuxLightAPI> defineLights(pxr::UsdStagePtr stage, const std::vector<LightDescription>& lights);
+
 //! @}
 
 } // namespace usdex::core
@@ -7,10 +7,15 @@
 #include "usdex/core/Api.h"
 
 #include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/sdf/assetPath.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdShade/material.h>
 #include <pxr/usd/usdShade/shader.h>
 
+#include <string>
+#include <vector>
+
 //! @file usdex/core/MaterialAlgo.h
 //! @brief Material and Shader Utilities applicable to all render contexts
 
@@ -94,12 +99,97 @@ USDEX_API pxr::UsdShadeMaterial createMaterial(pxr::UsdPrim parent, const std::s
 //! @returns Whether the material was successfully bound to the target prim.
 USDEX_API bool bindMaterial(pxr::UsdPrim prim, const pxr::UsdShadeMaterial& material);
 
+//! Authors a direct binding to the corresponding material on each of many prims (or `UsdGeomSubsets`).
+//!
+//! This produces the same bindings as calling `bindMaterial` for each prim, but the `UsdShadeMaterialBindingAPI` and the binding relationships
+//! of all prims are authored directly on the edit target layer within a single `SdfChangeBlock`, so the stage only processes one change.
+//!
+//! Optionally, identical bindings can be hoisted onto a common ancestor. When every child of a prim is bound to the same material, and none of
+//! those children already has an authored binding of its own, the binding is authored once on the parent rather than on each child. This is
+//! repeated up the hierarchy, so fewer binding opinions need to be resolved when the stage is loaded. `UsdGeomSubsets` are never hoisted, and
+//! bindings are never hoisted onto a root prim, an instance proxy, or a `UsdGeomGprim` which was not itself bound to the same material.
+//!
+//! Any invalid prim or material is skipped with a warning, and all other prims are still bound. If a prim appears more than once, the last
+//! material is bound.
+//!
+//! @note The bindings have the same "all purpose" and "fallback strength" as `bindMaterial`.
+//!
+//! @param prims The prims that the materials will affect. All of the prims must belong to the same stage.
+//! @param materials The material to bind to each prim. This must be the same size as `prims`.
+//! @param hoistBindings Whether identical bindings of sibling prims should be hoisted onto their parent.
+//! @returns Whether every prim was bound, either directly or through a hoisted binding.
+USDEX_API bool bindMaterials(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::UsdShadeMaterial>& materials,
+    bool hoistBindings = false
+);
+
 //! Get the effective surface Shader of a Material for the universal render context.
 //!
+//! @note The connections are traversed on every call. Use a `SurfaceShaderCache` when querying many Materials, or the same Material repeatedly.
+//!
 //! @param material The Material to consider
 //! @returns The connected Shader. Returns an invalid shader object on error.
 USDEX_API pxr::UsdShadeShader computeEffectivePreviewSurfaceShader(const pxr::UsdShadeMaterial& material);
 
+//! A thread-safe cache of the effective surface Shaders of the Materials of a stage for a single render context.
+//!
+//! The effective surface Shader of each Material is resolved exactly as `UsdShadeMaterial::ComputeSurfaceSource` would, so a cache for the
+//! universal render context matches `computeEffectivePreviewSurfaceShader`, and a cache for the "mdl" render context matches
+//! `usdex::rtx::computeEffectiveMdlSurfaceShader`. The connections are only traversed the first time a Material is queried.
+//!
+//! The cache listens for changes to the stage and discards the cached Shader of a Material when its surface outputs, or the outputs of any
+//! NodeGraph or surface Shader within it, are changed, or when the Material or its surface Shader are resynced. Authoring other Shaders within the
+//! Material (e.g. adding textures) does not affect the cache.
+class USDEX_API SurfaceShaderCache
+{
+
+public:
+
+    //! Construct a cache for the Materials of a stage.
+    //!
+    //! @param stage The stage whose Materials will be queried. Materials of other stages produce an invalid shader object.
+    //! @param renderContext The render context of the surface outputs to resolve. The universal render context is used as a fallback.
+    explicit SurfaceShaderCache(pxr::UsdStagePtr stage, const pxr::TfToken& renderContext = pxr::UsdShadeTokens->universalRenderContext);
+
+    ~SurfaceShaderCache();
+
+    SurfaceShaderCache(const SurfaceShaderCache&) = delete;
+    SurfaceShaderCache& operator=(const SurfaceShaderCache&) = delete;
+
+    //! Get the render context of the surface outputs being resolved.
+    //!
+    //! @returns The render context supplied on construction.
+    const pxr::TfToken& getRenderContext() const;
+
+    //! Get the effective surface Shader of a Material.
+    //!
+    //! This is safe to call from many threads at once.
+    //!
+    //! @param material The Material to consider
+    //! @returns The connected Shader. Returns an invalid shader object if the Material is invalid, belongs to another stage, or has no surface.
+    pxr::UsdShadeShader getSurfaceShader(const pxr::UsdShadeMaterial& material) const;
+
+    //! Get the effective surface Shaders of many Materials. The Materials are evaluated concurrently.
+    //!
+    //! @param materials The Materials to consider
+    //! @returns The connected Shader of each Material, matching the order of the input Materials.
+    std::vector<pxr::UsdShadeShader> getSurfaceShaders(const std::vector<pxr::UsdShadeMaterial>& materials) const;
+
+    //! Discard all cached Shaders.
+    void clear();
+
+    //! Return the number of Materials for which Shaders are currently cached.
+    //!
+    //! @returns The number of cached Shaders.
+    size_t size() const;
+
+private:
+
+    class SurfaceShaderCacheImpl;
+    SurfaceShaderCacheImpl* m_impl;
+};
+
 //! Defines a PBR `UsdShadeMaterial` driven by a `UsdPreviewSurface` shader network for the universal render context.
 //!
 //! The input parameters reflect a subset of the [UsdPreviewSurface specification](https://openusd.org/release/spec_usdpreviewsurface.html) commonly
@@ -262,6 +352,82 @@ USDEX_API bool addMetallicTextureToPreviewMaterial(pxr::UsdShadeMaterial& materi
 //! @returns Whether or not the texture was added to the material
 USDEX_API bool addOpacityTextureToPreviewMaterial(pxr::UsdShadeMaterial& material, const pxr::SdfAssetPath& texturePath);
 
+//! The parameters and textures of a preview material, as authored by `definePreviewMaterial()` and its associated `add*Texture` functions.
+//!
+//! An empty texture path means that the corresponding texture is not added to the material.
+struct PreviewMaterialDescription
+{
+    pxr::GfVec3f color = pxr::GfVec3f(0.18f); //!< The diffuse color of the Material
+    float opacity = 1.0f; //!< The Opacity Amount, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible
+    float roughness = 0.5f; //!< The Roughness Amount, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy
+    float metallic = 0.0f; //!< The Metallic Amount, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic
+    pxr::SdfAssetPath diffuseTexture; //!< The texture added by `addDiffuseTextureToPreviewMaterial()`
+    pxr::SdfAssetPath normalTexture; //!< The texture added by `addNormalTextureToPreviewMaterial()`
+    pxr::SdfAssetPath ormTexture; //!< The texture added by `addOrmTextureToPreviewMaterial()`
+    pxr::SdfAssetPath roughnessTexture; //!< The texture added by `addRoughnessTextureToPreviewMaterial()`
+    pxr::SdfAssetPath metallicTexture; //!< The texture added by `addMetallicTextureToPreviewMaterial()`
+    pxr::SdfAssetPath opacityTexture; //!< The texture added by `addOpacityTextureToPreviewMaterial()`
+};
+
+//! Deduplicates equivalent preview materials, so each unique material is defined once and shared by every source material that matches it.
+//!
+//! Each material is hashed from its `PreviewMaterialDescription`. The first time a description is seen, a preview material is defined below
+//! the parent prim using `definePreviewMaterial()` and the `add*Texture` functions. Every later request for an equivalent description returns
+//! that same material, regardless of the requested name, rather than authoring another shader network.
+//!
+//! Source files often contain hundreds of materials which differ only by name. Sharing one material between them reduces the size of the
+//! exported layers, and the number of shaders which need to be compiled by the renderer.
+//!
+//! Materials which differ in their values often still share textures (e.g. a texture atlas used by every material of a product catalog). Each
+//! texture asset path is only resolved once by the registry. Optionally, the texture readers can also be shared, in which case each unique file
+//! and color space is authored once as a `UsdUVTexture` shader below an abstract "TextureReaders" class prim, and the texture reader of each
+//! material internally references it. Only the fallback and texture coordinates remain specific to each material, and the shader network of
+//! each material remains encapsulated within the material.
+//!
+//! @note The registry is not thread safe. Materials are only considered equivalent if all of their values are exactly equal. Only materials
+//! defined by the registry are considered, so any material which is edited after it has been defined will still be shared.
+class USDEX_API PreviewMaterialRegistry
+{
+
+public:
+
+    //! Create a registry which defines each unique material below the given parent prim.
+    //!
+    //! @param parent Prim below which to define the Materials (e.g. the "Materials" scope of an asset)
+    //! @param shareTextureReaders Whether the texture readers of all materials should reference a single shared reader for each texture
+    explicit PreviewMaterialRegistry(pxr::UsdPrim parent, bool shareTextureReaders = false);
+
+    ~PreviewMaterialRegistry();
+
+    PreviewMaterialRegistry(const PreviewMaterialRegistry&) = delete;
+    PreviewMaterialRegistry& operator=(const PreviewMaterialRegistry&) = delete;
+
+    //! Get the material for a description, defining it below the parent prim if no equivalent material has been defined yet.
+    //!
+    //! The name is only used when the material is first defined. It is made valid and unique among the materials of the registry, so it does
+    //! not need to be a valid identifier. Any material which fails to author all of its textures is removed and is not registered.
+    //!
+    //! @param name Name of the Material, if it is defined
+    //! @param material The parameters and textures of the Material
+    //! @returns The material for the description. Returns an invalid object on error.
+    pxr::UsdShadeMaterial definePreviewMaterial(const std::string& name, const PreviewMaterialDescription& material);
+
+    //! Get the number of unique materials which have been defined by the registry.
+    //!
+    //! @returns The number of unique materials.
+    size_t getUniqueMaterialCount() const;
+
+    //! Get the number of materials which have been requested from the registry, including those which were shared.
+    //!
+    //! @returns The number of successful calls to `definePreviewMaterial`.
+    size_t getUseCount() const;
+
+private:
+
+    class PreviewMaterialRegistryImpl;
+    PreviewMaterialRegistryImpl* m_impl;
+};
+
 //! Adds `UsdShadeInputs` to the material prim to create an "interface" to the underlying Preview Shader network.
 //!
 //! All non-default-value `UsdShadeInputs` on the effective surface shader for the universal render context will be "promoted" to the
@@ -343,6 +509,30 @@ USDEX_API pxr::GfVec3f sRgbToLinear(const pxr::GfVec3f& color);
 //! @returns The color in sRGB color space
 USDEX_API pxr::GfVec3f linearToSrgb(const pxr::GfVec3f& color);
 
+//! Translate an array of sRGB color values to linear color space
+//!
+//! This is intended for bulk color data, such as `displayColor` primvar values (e.g. the values of a `Vec3fPrimvarData` prior to calling
+//! `definePolyMesh` or `definePointCloud`), and is considerably faster than translating each color individually.
+//!
+//! Channel values within [0, 1] are approximated by interpolating a lookup table, which differs from the result of the scalar `sRgbToLinear` by
+//! less than 1e-7. Channel values outside of [0, 1] are translated exactly. Large arrays are translated in parallel.
+//!
+//! @param colors sRGB representations of the colors to be translated to linear color space
+//! @returns The translated colors in linear color space, in the same order as the input colors
+USDEX_API pxr::VtVec3fArray sRgbToLinear(const pxr::VtVec3fArray& colors);
+
+//! Translate an array of linear color values to sRGB color space
+//!
+//! This is intended for bulk color data, such as `displayColor` primvar values, and is considerably faster than translating each color
+//! individually.
+//!
+//! Channel values within [0, 1] are approximated by interpolating a lookup table, which differs from the result of the scalar `linearToSrgb` by
+//! less than 1e-6. Channel values outside of [0, 1] are translated exactly. Large arrays are translated in parallel.
+//!
+//! @param colors linear representations of the colors to be translated to sRGB color space
+//! @returns The translated colors in sRGB color space, in the same order as the input colors
+USDEX_API pxr::VtVec3fArray linearToSrgb(const pxr::VtVec3fArray& colors);
+
 //! @}
 
 } // namespace usdex::core
@@ -16,9 +16,13 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/subset.h>
+#include <pxr/usd/usdShade/material.h>
 
 #include <optional>
+#include <vector>
 
 namespace usdex::core
 {
@@ -57,6 +61,10 @@ namespace usdex::core
 //! - Display Color
 //! - Display Opacity
 //!
+//! Meshes imported from other formats commonly arrive with fully expanded faceVarying normals and uvs. If a `compactionEpsilon` is provided,
+//! these are welded into indexed primvars, or demoted to vertex interpolation, before they are authored. See `compactFaceVaryingPrimvar` for
+//! details. Other primvars are always authored as provided.
+//!
 //! Normals are authored as `primvars:normals` so that indexing is possible and to ensure that the value takes precedence in cases where both
 //! `normals` and `primvars:normals` are authored.
 //! See [UsdGeomPointBased](https://openusd.org/release/api/class_usd_geom_point_based.html#ac9a057e1f221d9a20b99887f35f84480) for details.
@@ -75,6 +83,8 @@ namespace usdex::core
 //! @param uvs Values to be authored for the uv primvar
 //! @param displayColor Values to be authored for the display color primvar
 //! @param displayOpacity Values to be authored for the display opacity primvar
+//! @param compactionEpsilon If provided, faceVarying normals and uvs are compacted using `compactFaceVaryingPrimvar` with this tolerance
+//!     prior to authoring.
 //! @returns UsdGeomMesh schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdGeomMesh definePolyMesh(
     pxr::UsdStagePtr stage,
@@ -85,7 +95,41 @@ USDEX_API pxr::UsdGeomMesh definePolyMesh(
     std::optional<const Vec3fPrimvarData> normals = std::nullopt,
     std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
     std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
-    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt,
+    std::optional<float> compactionEpsilon = std::nullopt
+);
+
+//! Defines a basic polygon mesh on the stage, taking ownership of the topology and points arrays.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! The arrays are moved into the function, so once it returns the authored attributes are the sole owners of the buffers. This avoids any risk
+//! of a later copy-on-write detach in the calling code, which is important when authoring very large meshes. The primvars can be transferred in
+//! the same manner by passing each `PrimvarData` as an rvalue (e.g. using `std::move`).
+//!
+//! @param stage The stage on which to define the mesh
+//! @param path The absolute prim path at which to define the mesh
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+//! @param points Vertex positions for the mesh described in local space
+//! @param normals Values to be authored for the normals primvar
+//! @param uvs Values to be authored for the uv primvar
+//! @param displayColor Values to be authored for the display color primvar
+//! @param displayOpacity Values to be authored for the display opacity primvar
+//! @param compactionEpsilon If provided, faceVarying normals and uvs are compacted using `compactFaceVaryingPrimvar` with this tolerance
+//!     prior to authoring.
+//! @returns UsdGeomMesh schema wrapping the defined UsdPrim
+USDEX_API pxr::UsdGeomMesh definePolyMesh(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    pxr::VtIntArray&& faceVertexCounts,
+    pxr::VtIntArray&& faceVertexIndices,
+    pxr::VtVec3fArray&& points,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt,
+    std::optional<float> compactionEpsilon = std::nullopt
 );
 
 //! Defines a basic polygon mesh on the stage.
@@ -101,6 +145,8 @@ USDEX_API pxr::UsdGeomMesh definePolyMesh(
 //! @param uvs Values to be authored for the uv primvar
 //! @param displayColor Values to be authored for the display color primvar
 //! @param displayOpacity Values to be authored for the display opacity primvar
+//! @param compactionEpsilon If provided, faceVarying normals and uvs are compacted using `compactFaceVaryingPrimvar` with this tolerance
+//!     prior to authoring.
 //!
 //! @returns UsdGeomMesh schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdGeomMesh definePolyMesh(
@@ -112,7 +158,8 @@ USDEX_API pxr::UsdGeomMesh definePolyMesh(
     std::optional<const Vec3fPrimvarData> normals = std::nullopt,
     std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
     std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
-    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt,
+    std::optional<float> compactionEpsilon = std::nullopt
 );
 
 //! Defines a basic polygon mesh from an existing prim.
@@ -127,6 +174,8 @@ USDEX_API pxr::UsdGeomMesh definePolyMesh(
 //! @param uvs Values to be authored for the uv primvar
 //! @param displayColor Values to be authored for the display color primvar
 //! @param displayOpacity Values to be authored for the display opacity primvar
+//! @param compactionEpsilon If provided, faceVarying normals and uvs are compacted using `compactFaceVaryingPrimvar` with this tolerance
+//!     prior to authoring.
 //!
 //! @returns UsdGeomMesh schema wrapping the converted UsdPrim
 USDEX_API pxr::UsdGeomMesh definePolyMesh(
@@ -137,9 +186,292 @@ USDEX_API pxr::UsdGeomMesh definePolyMesh(
     std::optional<const Vec3fPrimvarData> normals = std::nullopt,
     std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
     std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt,
+    std::optional<float> compactionEpsilon = std::nullopt
+);
+
+//! Compacts a faceVarying primvar into the smallest equivalent description for the given mesh topology.
+//!
+//! Meshes imported from other formats commonly arrive with fully expanded faceVarying normals and uvs, where most face vertices which share a
+//! point also share a value. These can be described far more compactly, which reduces file size and the memory required by downstream renderers.
+//!
+//! - If every face vertex of each point has the same value, the primvar is demoted to vertex interpolation.
+//! - Values which are equal within the tolerance are welded together, and the primvar is indexed if that reduces the storage required.
+//!
+//! Values are welded when all of their components fall within the same `epsilon` sized cell, and the first value found in each cell is retained.
+//! Demotion to vertex interpolation compares each face vertex to the first face vertex of its point, component by component, within `epsilon`.
+//! An `epsilon` of zero only welds values which are exactly equal. Large primvars are processed in parallel, but the result is deterministic.
+//!
+//! Updates will not be made in the following conditions:
+//!  - If the interpolation is not faceVarying.
+//!  - If the element size is greater than one.
+//!  - If the primvar is invalid or does not match the topology.
+//!  - If the compacted primvar would not be smaller than the existing one.
+//!
+//! @param primvar The primvar data to compact in place
+//! @param faceVertexIndices Indices of the points used for each face vertex of the mesh
+//! @param numPoints The number of points in the mesh
+//! @param epsilon The tolerance within which values are considered equal
+//! @returns True if the primvar was modified.
+USDEX_API bool compactFaceVaryingPrimvar(Vec3fPrimvarData& primvar, const pxr::VtIntArray& faceVertexIndices, size_t numPoints, float epsilon = 0.0f);
+
+//! Compacts a faceVarying primvar into the smallest equivalent description for the given mesh topology.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! @param primvar The primvar data to compact in place
+//! @param faceVertexIndices Indices of the points used for each face vertex of the mesh
+//! @param numPoints The number of points in the mesh
+//! @param epsilon The tolerance within which values are considered equal
+//! @returns True if the primvar was modified.
+USDEX_API bool compactFaceVaryingPrimvar(Vec2fPrimvarData& primvar, const pxr::VtIntArray& faceVertexIndices, size_t numPoints, float epsilon = 0.0f);
+
+//! Describes a single polygon mesh to be defined by `definePolyMeshes`.
+//!
+//! The members correspond to the arguments of `definePolyMesh` and are subject to the same validation.
+class PolyMeshDescription
+{
+public:
+
+    pxr::SdfPath path; //!< The absolute prim path at which to define the mesh
+    pxr::VtIntArray faceVertexCounts; //!< The number of vertices in each face of the mesh
+    pxr::VtIntArray faceVertexIndices; //!< Indices of the positions from the `points` to use for each face vertex
+    pxr::VtVec3fArray points; //!< Vertex positions for the mesh described in local space
+    std::optional<Vec3fPrimvarData> normals; //!< Values to be authored for the normals primvar
+    std::optional<Vec2fPrimvarData> uvs; //!< Values to be authored for the uv primvar
+    std::optional<Vec3fPrimvarData> displayColor; //!< Values to be authored for the display color primvar
+    std::optional<FloatPrimvarData> displayOpacity; //!< Values to be authored for the display opacity primvar
+};
+
+//! Defines many basic polygon meshes on the stage in a single call.
+//!
+//! This produces the same scene description as calling `definePolyMesh` for each element of `meshes`, but it is considerably faster when defining
+//! thousands of meshes, as the per-mesh overhead is amortized across the batch:
+//!
+//! - The location, topology, and primvars of all meshes are validated concurrently, prior to authoring any opinions, according to the
+//!   `ValidationPolicy` of the calling thread.
+//! - All of the prims are defined within a single `SdfChangeBlock`, so the stage only recomposes once.
+//! - All of the attributes are authored within a single `SdfChangeBlock`, so change notification is only sent once.
+//!
+//! Success or failure is reported per mesh. Any invalid mesh is not defined, a runtime error is emitted describing the reason, and an invalid
+//! `UsdGeomMesh` is returned at the corresponding index. All other meshes are still defined.
+//!
+//! @note The caller is responsible for ensuring the paths are unique. If several meshes share a path, the last one in `meshes` will be authored.
+//!
+//! @param stage The stage on which to define the meshes
+//! @param meshes The descriptions of the meshes to define
+//! @returns A `UsdGeomMesh` for each element of `meshes`, in the same order. Any mesh which could not be defined will be invalid.
+USDEX_API std::vector<pxr::UsdGeomMesh> definePolyMeshes(pxr::UsdStagePtr stage, const std::vector<PolyMeshDescription>& meshes);
+
+//! Deduplicates identical meshes into an asset library, so each unique mesh is defined once and referenced from every place it is used.
+//!
+//! Each mesh is content-hashed from its topology, points, and primvars. The first time a mesh is seen, it is defined within the library
+//! stage as a `UsdGeomMesh` named "Mesh", beneath a `UsdGeomXform` which is a child of the default prim of the library stage (e.g. the
+//! asset library stage returned by `addAssetLibrary`). Every use of the mesh, including the first, is a prim which references that
+//! `UsdGeomXform`, and which is optionally marked instanceable so that all uses share a single USD prototype.
+//!
+//! CAD assemblies often contain thousands of duplicated parts (e.g. fasteners), and deduplicating them considerably reduces both the size
+//! of the exported layers and the time and memory required to load them.
+//!
+//! The prims which use a library mesh are `UsdGeomXform` prims, so their local transform can be set in the usual way (e.g. using
+//! `setLocalTransform`). Their points must be described in the local space of the mesh, so that identical parts share the same points.
+//!
+//! @note The library is not thread safe. Meshes are only considered identical if all of their values are exactly equal.
+class USDEX_API MeshLibrary
+{
+
+public:
+
+    //! Create a library which defines each unique mesh on the given stage.
+    //!
+    //! @param libraryStage The stage on which to define each unique mesh. It must have a default prim.
+    //! @param instanceable Whether each prim which uses a library mesh should be marked instanceable.
+    explicit MeshLibrary(pxr::UsdStagePtr libraryStage, bool instanceable = true);
+
+    ~MeshLibrary();
+
+    MeshLibrary(const MeshLibrary&) = delete;
+    MeshLibrary& operator=(const MeshLibrary&) = delete;
+
+    //! Define a prim which uses a library mesh, defining the mesh in the library if no identical mesh has been defined yet.
+    //!
+    //! The mesh is validated exactly as by `definePolyMesh` when it is first defined in the library. The `path` of the mesh is the location
+    //! of the prim which references the library mesh, and the name of the path is used to name the library mesh when it is first defined.
+    //!
+    //! @param stage The stage on which to define the prim which uses the library mesh. This may be the library stage itself.
+    //! @param mesh The description of the mesh.
+    //! @returns The prim which references the library mesh. Returns an invalid prim on error.
+    pxr::UsdPrim definePolyMesh(pxr::UsdStagePtr stage, const PolyMeshDescription& mesh);
+
+    //! Get the number of unique meshes which have been defined in the library.
+    //!
+    //! @returns The number of unique meshes.
+    size_t getUniqueMeshCount() const;
+
+    //! Get the number of prims which have been defined using a library mesh.
+    //!
+    //! @returns The number of prims which reference a library mesh.
+    size_t getUseCount() const;
+
+private:
+
+    class MeshLibraryImpl;
+    MeshLibraryImpl* m_impl;
+};
+
+//! Defines a deforming `UsdGeomMesh` prim on the stage, with a single topology and time sampled points and normals.
+//!
+//! This is intended for caches of simulated or animated geometry, where the topology is constant but the points change on every frame.
+//! It is considerably faster than calling `definePolyMesh` and then authoring each time sample individually:
+//!
+//! - The location, topology, and static primvars are validated once, rather than once per frame.
+//! - The points and normals of each frame are validated, and the extent of each frame is computed, concurrently.
+//! - All of the time samples are authored within a single `SdfChangeBlock`, so change notification is only sent once.
+//!
+//! Attribute values will be validated and in the case of invalid data the Mesh will not be defined. An invalid `UsdGeomMesh` object will be
+//! returned in this case.
+//!
+//! The topology, UVs, display color, and display opacity are authored as default values. The points, normals and extent are only authored as
+//! time samples. The interpolation, indexing, and element size of the normals must be the same on every frame, as these are not time varying.
+//!
+//! @param stage The stage on which to define the mesh
+//! @param path The absolute prim path at which to define the mesh
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+//! @param times The time code of each frame. Default time codes are not valid.
+//! @param points Vertex/CV positions for the mesh described in local space, one array per frame. Every array must be the same size.
+//! @param normals Values for the normals primvar, one per frame, or an empty vector to skip normals.
+//! @param uvs Values to be authored for the uv primvar
+//! @param displayColor Value to be authored for the display color primvar
+//! @param displayOpacity Value to be authored for the display opacity primvar
+//! @returns `UsdGeomMesh` schema wrapping the defined `UsdPrim`. Returns an invalid schema on error.
+USDEX_API pxr::UsdGeomMesh defineDeformingPolyMesh(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const pxr::VtIntArray& faceVertexCounts,
+    const pxr::VtIntArray& faceVertexIndices,
+    const std::vector<pxr::UsdTimeCode>& times,
+    const std::vector<pxr::VtVec3fArray>& points,
+    const std::vector<Vec3fPrimvarData>& normals = {},
+    std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
     std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
 );
 
+//! Updates an existing `UsdGeomMesh` prim, only authoring the attributes whose values have changed.
+//!
+//! This is intended for live or iterative workflows, where a mesh is re-exported many times but only a subset of its data changes between
+//! exports (e.g. a deformation that modifies the points but not the topology). Each value is compared to the current value of the attribute
+//! at the default time, and opinions are only authored on the current edit target for attributes which differ. Unchanged attributes do not
+//! author any scene description and do not trigger change notification.
+//!
+//! The extent is only recomputed when the points have changed, or when there is no extent authored.
+//!
+//! Attribute values will be validated as in `definePolyMesh`, and in the case of invalid data no attributes will be authored.
+//!
+//! @param mesh The mesh to update
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+//! @param points Vertex/CV positions for the mesh described in local space
+//! @param normals Values to be authored for the normals primvar. If not provided the existing normals are left unchanged.
+//! @param uvs Values to be authored for the uv primvar. If not provided the existing uvs are left unchanged.
+//! @param displayColor Value to be authored for the display color primvar. If not provided the existing value is left unchanged.
+//! @param displayOpacity Value to be authored for the display opacity primvar. If not provided the existing value is left unchanged.
+//! @returns Whether the mesh was successfully updated. Returns false if the mesh is invalid or the data fails validation.
+USDEX_API bool updatePolyMesh(
+    pxr::UsdGeomMesh mesh,
+    const pxr::VtIntArray& faceVertexCounts,
+    const pxr::VtIntArray& faceVertexIndices,
+    const pxr::VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+);
+
+//! Computes a simplified level of detail (LOD) of a polygon mesh, by collapsing the edges whose removal least changes the shape of its surface.
+//!
+//! The mesh is triangulated, and edges are collapsed, in order of the least change to the surface, until the number of triangles is reduced to
+//! `ratio` of the triangulated mesh. Each collapse removes a point from the mesh, so the simplified points are a subset of the original points.
+//!
+//! The normals, uvs, display color, and display opacity are preserved, retaining their interpolation, indexing, and element size:
+//!
+//! - Vertex values of the remaining points are unchanged.
+//! - Uniform values follow the face from which each triangle originated.
+//! - FaceVarying values of the remaining face vertices are unchanged.
+//! - Points on a seam (where uniform or faceVarying values differ between the faces of a point) are never removed, so seams are preserved.
+//!
+//! Open boundaries of the mesh retain their shape, and collapses which would flip a triangle or produce non-manifold topology are never made,
+//! so the simplified mesh may retain more triangles than requested. Faceted meshes with unwelded faceVarying primvars have seams at every
+//! point, so consider `compactFaceVaryingPrimvar` prior to simplifying them. The result is deterministic.
+//!
+//! The mesh is validated exactly as by `definePolyMesh`, except that its location is not considered. The contents of its arrays are always
+//! validated, regardless of the `ValidationPolicy`, as the simplification requires valid topology.
+//!
+//! @param mesh The description of the mesh to simplify
+//! @param ratio The fraction of the triangles of the mesh to retain. This must be greater than 0 and at most 1.
+//! @returns The description of the simplified mesh, with the same path as `mesh`. Returns `std::nullopt` on error.
+USDEX_API std::optional<PolyMeshDescription> simplifyPolyMesh(const PolyMeshDescription& mesh, float ratio);
+
+//! Controls how `definePolyMeshLods` authors the levels of detail (LODs) of each mesh.
+enum class MeshLodStyle
+{
+    eVariantSet = 0, //!< Author a `getLodToken()` variant set on each mesh, with a "LOD0" variant for the mesh and a "LOD<N>" variant per ratio.
+    ePurpose, //!< Author each mesh with "render" purpose, and a "<name>_proxy" sibling mesh with "proxy" purpose, targeted by its `proxyPrim`.
+};
+
+//! Defines polygon meshes on the stage, along with simplified levels of detail (LODs) of each mesh, so that viewers can interactively load
+//! large scenes (e.g. CAD assemblies) using the lighter LODs.
+//!
+//! The LODs of all of the meshes are computed concurrently using `simplifyPolyMesh`, with one LOD per element of `ratios`, prior to authoring
+//! any opinions. How the LODs are authored is controlled by `style`:
+//!
+//! - `MeshLodStyle::eVariantSet` defines each mesh with a `getLodToken()` variant set. The "LOD0" variant holds the mesh itself, and the
+//!   "LOD1", "LOD2", etc variants hold the LOD of each ratio, in order. "LOD0" is selected. This matches the variant set authored by
+//!   `addAssetLodInterface`, which selects between payloads of an entire asset, whereas these variants select between individual meshes.
+//! - `MeshLodStyle::ePurpose` defines each mesh with "render" purpose, and defines its LOD as a sibling mesh named "<name>_proxy" with
+//!   "proxy" purpose. The `proxyPrim` relationship of each mesh targets its proxy. A single ratio must be provided, as there is only one proxy
+//!   purpose.
+//!
+//! Success or failure is reported per mesh, as by `definePolyMeshes`. Any mesh which is invalid (or whose proxy location is invalid) is not
+//! defined, a runtime error is emitted describing the reason, and an invalid `UsdGeomMesh` is returned at the corresponding index.
+//!
+//! @param stage The stage on which to define the meshes
+//! @param meshes The descriptions of the meshes to define
+//! @param ratios The fraction of the triangles of each mesh to retain in each LOD, in order. Each ratio must be greater than 0 and at most 1.
+//! @param style How to author the LODs of each mesh
+//! @returns The `UsdGeomMesh` of each element of `meshes`, in the same order. Any mesh which could not be defined will be invalid.
+USDEX_API std::vector<pxr::UsdGeomMesh> definePolyMeshLods(
+    pxr::UsdStagePtr stage,
+    const std::vector<PolyMeshDescription>& meshes,
+    const std::vector<float>& ratios,
+    MeshLodStyle style = MeshLodStyle::eVariantSet
+);
+
+//! Defines a `UsdGeomSubset` per material below an existing mesh, partitioning its faces by a material id per face, and binds the materials.
+//!
+//! Meshes imported from other formats commonly assign materials per face. The faces are partitioned in a single concurrent pass, and each
+//! material which is assigned to at least one face has a subset defined containing the indices of its faces, in ascending order. The subsets
+//! are named after their materials, made unique using `getValidChildNames`, and are members of the "materialBind" family. The family type is
+//! "partition" if every face is assigned a material, and is otherwise "nonOverlapping".
+//!
+//! All of the subsets are defined with a single round of change processing, and the materials are bound to them using `bindMaterials`.
+//!
+//! Faces with a negative material id are not assigned to any subset. If any material id is not a valid index into `materials`, if the number
+//! of material ids does not match the number of faces of the mesh, or if any assigned material is invalid, no subsets are defined and a
+//! runtime error is emitted describing the reason.
+//!
+//! @param mesh The mesh whose faces are assigned materials
+//! @param faceMaterialIds The index into `materials` of the material assigned to each face, or a negative value for faces without a material
+//! @param materials The materials which may be assigned to the faces
+//! @returns The subset of each material, in the same order as `materials`, or an empty vector on error. A material which is not assigned to
+//! any face has no subset, and an invalid `UsdGeomSubset` is returned at its index.
+USDEX_API std::vector<pxr::UsdGeomSubset> defineMaterialSubsets(
+    pxr::UsdGeomMesh mesh,
+    const pxr::VtIntArray& faceMaterialIds,
+    const std::vector<pxr::UsdShadeMaterial>& materials
+);
+
 //! @}
 
 } // namespace usdex::core
@@ -10,9 +10,11 @@
 #include "Api.h"
 
 #include <pxr/base/tf/token.h>
+#include <pxr/base/vt/dictionary.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primRange.h>
 
 #include <string>
 #include <vector>
@@ -165,8 +167,14 @@ USDEX_API pxr::TfTokenVector getValidChildNames(const pxr::UsdPrim& prim, const
 //!
 //! The pseudo root cannot have properties, therefore it is not useable as a parent for property related functions.
 //!
+//! It is safe to call methods from multiple threads, so a single cache can be shared by the workers of a multi-threaded converter. Requests for
+//! different parents do not block one another. Requests for the same parent are serialized, so each request (including a bulk request) is
+//! resolved against a consistent set of reserved names, and the names returned for a parent only depend on the order of the requests for it.
+//!
+//! @note When populating a cache entry from a `UsdPrim` or `SdfPrimSpec`, the existing names are read from the stage or layer. The caller is
+//! responsible for ensuring that the stage or layer is not modified concurrently while this occurs.
+//!
 //! @warning This class does not automatically invalidate cached values based on changes to the prims from which values were cached.
-//! Additionally, a separate instance of this class should be used per-thread, calling methods from multiple threads is not safe.
 class USDEX_API NameCache
 {
 
@@ -346,6 +354,56 @@ public:
     //! @param parent The parent prim spec
     void clear(const pxr::SdfPrimSpecHandle parent);
 
+    //! Export the reserved names and suffix indices of all cache entries.
+    //!
+    //! The snapshot can be imported into another `NameCache` (e.g. in a later session) which will then produce the same names as this cache
+    //! would have, without needing to re-read the existing names from a stage or layer. The snapshot only holds USD value types, so it can be
+    //! stored in any `VtDictionary` valued metadata, such as the custom layer data of the layer being authored.
+    //!
+    //! @returns A dictionary describing the contents of the cache.
+    pxr::VtDictionary exportSnapshot() const;
+
+    //! Import the reserved names and suffix indices from a snapshot produced by `exportSnapshot`.
+    //!
+    //! The snapshot is merged with the existing contents of the cache. Names reserved in either are reserved after the import, and suffix numbering
+    //! continues from the larger index for each name. Cache entries created by the import will not be populated with the existing names of a
+    //! `UsdPrim` or `SdfPrimSpec` parent when they are later used.
+    //!
+    //! If the snapshot is malformed the cache is left unchanged and a runtime error is issued.
+    //!
+    //! @param snapshot A dictionary produced by `exportSnapshot`.
+    //! @returns True if the snapshot was imported, otherwise false.
+    bool importSnapshot(const pxr::VtDictionary& snapshot);
+
+    //! Limit the number of parents for which prim names and property names are cached.
+    //!
+    //! Once the limit is reached, the entries of the least recently used parents are evicted. The limit is applied approximately, as it is divided
+    //! evenly between independently locked partitions of the cache. A limit of zero (the default) allows the cache to grow without bound.
+    //!
+    //! The entry of a parent is never evicted while a request for it is in progress or waiting, so requests for the same parent remain serialized
+    //! regardless of the limit. A partition may temporarily exceed its limit while its entries are in use.
+    //!
+    //! @warning Evicting an entry discards all of its reserved names. If names are later requested for the same parent, a `UsdPrim` or
+    //! `SdfPrimSpec` parent will reserve its existing children again, so only names which were returned but never authored can be repeated. An
+    //! `SdfPath` parent has no existing children, so any of its names can be repeated. Only set a limit if names for a parent are authored
+    //! before many other parents are named, as is typical when converting a hierarchy depth first.
+    //!
+    //! @param maxEntries The maximum number of parents to cache for each of prim and property names, or zero for no limit.
+    void setMaxEntries(size_t maxEntries);
+
+    //! Return the maximum number of parents for which prim names and property names are cached.
+    //!
+    //! @returns The limit set by `setMaxEntries`, or zero if there is no limit.
+    size_t getMaxEntries() const;
+
+    //! Return the approximate number of bytes allocated by the cache.
+    //!
+    //! The names themselves are tokens, so their strings are held by the token registry (and shared by any other tokens with the same value)
+    //! and are not included.
+    //!
+    //! @returns The approximate memory usage in bytes.
+    size_t memoryUsage() const;
+
 private:
 
     class NameCacheImpl;
@@ -415,6 +473,25 @@ USDEX_API pxr::TfToken getValidPropertyName(const std::string& name);
 //! @returns A vector of valid and unique names.
 USDEX_API pxr::TfTokenVector getValidPropertyNames(const std::vector<std::string>& names, const pxr::TfTokenVector& reservedNames = {});
 
+//! Take a vector of names and return a matching vector of their decoded values.
+//!
+//! Names that were produced by the Bootstring algorithm (i.e. those with the "tn__" prefix) are decoded to their original UTF-8 value. All other
+//! names, including any that can not be decoded, are returned unchanged.
+//!
+//! Large vectors of names are decoded in parallel.
+//!
+//! @param names A vector of prim or property names.
+//! @returns A vector of decoded names, matching the order of the input names.
+USDEX_API std::vector<std::string> getDecodedNames(const pxr::TfTokenVector& names);
+
+//! Return the decoded names of all prims in a range.
+//!
+//! This is equivalent to calling `getDecodedNames` with the names of each prim visited by the range.
+//!
+//! @param range The range of prims to decode the names of.
+//! @returns A vector of decoded names, matching the traversal order of the range.
+USDEX_API std::vector<std::string> getDecodedNames(const pxr::UsdPrimRange& range);
+
 //! Return this prim's display name (metadata)
 //!
 //! @param prim The prim to get the display name from
@@ -453,6 +530,36 @@ USDEX_API bool blockDisplayName(pxr::UsdPrim prim);
 //! @returns The effective display name
 USDEX_API std::string computeEffectiveDisplayName(const pxr::UsdPrim& prim);
 
+//! Return the display names (metadata) of many prims
+//!
+//! Large vectors of prims are read in parallel.
+//!
+//! @param prims The prims to get the display names from
+//! @returns Authored values, matching the order of the prims. An empty string is returned for any prim which has no display name or is invalid.
+USDEX_API std::vector<std::string> getDisplayNames(const std::vector<pxr::UsdPrim>& prims);
+
+//! Set the display names (metadata) of many prims
+//!
+//! All of the display names are authored with a single round of change processing.
+//!
+//! By default the display names are authored using the same mechanism as `setDisplayName`. Alternatively, the display names can be authored
+//! directly on the prim specs of the edit target of each prim's stage. This avoids any per-prim overhead of the `UsdStage` authoring API, but
+//! does not validate that the edit target is able to author opinions for each prim (e.g. that the prim is not an instance proxy).
+//!
+//! @param prims The prims to set the display names for
+//! @param names The values to set, one per prim
+//! @param authorPrimSpecs Author directly on the prim specs of the edit target rather than via the `UsdStage`
+//! @returns True if all of the display names were set, otherwise false. Nothing is authored if the number of prims and names differ.
+USDEX_API bool setDisplayNames(const std::vector<pxr::UsdPrim>& prims, const std::vector<std::string>& names, bool authorPrimSpecs = false);
+
+//! Calculate the effective display names of many prims
+//!
+//! This is equivalent to calling `computeEffectiveDisplayName` for each prim. Large vectors of prims are read in parallel.
+//!
+//! @param prims The prims to compute the display names for
+//! @returns The effective display names, matching the order of the prims. An empty string is returned for any invalid prim.
+USDEX_API std::vector<std::string> computeEffectiveDisplayNames(const std::vector<pxr::UsdPrim>& prims);
+
 //! @}
 
 } // namespace usdex::core
@@ -8,6 +8,7 @@
 //! @brief Utility functions to create physics joints.
 
 #include "Api.h"
+#include "XformAlgo.h"
 
 #include <pxr/base/gf/quatf.h>
 #include <pxr/base/gf/vec3f.h>
@@ -22,6 +23,7 @@
 
 #include <math.h>
 #include <optional>
+#include <vector>
 
 namespace usdex::core
 {
@@ -76,6 +78,8 @@ public:
 //! @param body0 The first body of the joint
 //! @param body1 The second body of the joint
 //! @param frame The position and rotation of the joint in the specified coordinate system.
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsFixedJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsFixedJoint definePhysicsFixedJoint(
@@ -83,7 +87,8 @@ USDEX_API pxr::UsdPhysicsFixedJoint definePhysicsFixedJoint(
     const pxr::SdfPath& path,
     const pxr::UsdPrim& body0,
     const pxr::UsdPrim& body1,
-    const JointFrame& frame
+    const JointFrame& frame,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a fixed joint connecting two rigid bodies.
@@ -95,6 +100,8 @@ USDEX_API pxr::UsdPhysicsFixedJoint definePhysicsFixedJoint(
 //! @param body0 The first body of the joint
 //! @param body1 The second body of the joint
 //! @param frame The position and rotation of the joint in the specified coordinate system.
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsFixedJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsFixedJoint definePhysicsFixedJoint(
@@ -102,7 +109,8 @@ USDEX_API pxr::UsdPhysicsFixedJoint definePhysicsFixedJoint(
     const std::string& name,
     const pxr::UsdPrim& body0,
     const pxr::UsdPrim& body1,
-    const JointFrame& frame
+    const JointFrame& frame,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a fixed joint connecting two rigid bodies.
@@ -113,13 +121,16 @@ USDEX_API pxr::UsdPhysicsFixedJoint definePhysicsFixedJoint(
 //! @param body0 The first body of the joint
 //! @param body1 The second body of the joint
 //! @param frame The position and rotation of the joint in the specified coordinate system.
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsFixedJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsFixedJoint definePhysicsFixedJoint(
     pxr::UsdPrim prim,
     const pxr::UsdPrim& body0,
     const pxr::UsdPrim& body1,
-    const JointFrame& frame
+    const JointFrame& frame,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a revolute joint, which acts as a hinge around a single axis, connecting two rigid bodies.
@@ -142,6 +153,8 @@ USDEX_API pxr::UsdPhysicsFixedJoint definePhysicsFixedJoint(
 //! @param axis The axis of rotation
 //! @param lowerLimit The lower limit of the joint (degrees).
 //! @param upperLimit The upper limit of the joint (degrees).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsRevoluteJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
@@ -152,7 +165,8 @@ USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> lowerLimit = std::nullopt,
-    std::optional<float> upperLimit = std::nullopt
+    std::optional<float> upperLimit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a revolute joint, which acts as a hinge around a single axis, connecting two rigid bodies.
@@ -167,6 +181,8 @@ USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
 //! @param axis The axis of rotation
 //! @param lowerLimit The lower limit of the joint (degrees).
 //! @param upperLimit The upper limit of the joint (degrees).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsRevoluteJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
@@ -177,7 +193,8 @@ USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> lowerLimit = std::nullopt,
-    std::optional<float> upperLimit = std::nullopt
+    std::optional<float> upperLimit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a revolute joint, which acts as a hinge around a single axis, connecting two rigid bodies.
@@ -191,6 +208,8 @@ USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
 //! @param axis The axis of rotation
 //! @param lowerLimit The lower limit of the joint (degrees).
 //! @param upperLimit The upper limit of the joint (degrees).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsRevoluteJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
@@ -200,7 +219,8 @@ USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> lowerLimit = std::nullopt,
-    std::optional<float> upperLimit = std::nullopt
+    std::optional<float> upperLimit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a prismatic joint, which acts as a slider along a single axis, connecting two rigid bodies.
@@ -226,6 +246,8 @@ USDEX_API pxr::UsdPhysicsRevoluteJoint definePhysicsRevoluteJoint(
 //! @param axis The axis of the joint.
 //! @param lowerLimit The lower limit of the joint (distance).
 //! @param upperLimit The upper limit of the joint (distance).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsPrismaticJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
@@ -236,7 +258,8 @@ USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> lowerLimit = std::nullopt,
-    std::optional<float> upperLimit = std::nullopt
+    std::optional<float> upperLimit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a prismatic joint, which acts as a slider along a single axis, connecting two rigid bodies.
@@ -251,6 +274,8 @@ USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
 //! @param axis The axis of the joint.
 //! @param lowerLimit The lower limit of the joint (distance).
 //! @param upperLimit The upper limit of the joint (distance).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsPrismaticJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
@@ -261,7 +286,8 @@ USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> lowerLimit = std::nullopt,
-    std::optional<float> upperLimit = std::nullopt
+    std::optional<float> upperLimit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a prismatic joint, which acts as a slider along a single axis, connecting two rigid bodies.
@@ -275,6 +301,8 @@ USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
 //! @param axis The axis of the joint.
 //! @param lowerLimit The lower limit of the joint (distance).
 //! @param upperLimit The upper limit of the joint (distance).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsPrismaticJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
@@ -284,7 +312,8 @@ USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> lowerLimit = std::nullopt,
-    std::optional<float> upperLimit = std::nullopt
+    std::optional<float> upperLimit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a spherical joint, which acts as a ball and socket joint, connecting two rigid bodies.
@@ -310,6 +339,8 @@ USDEX_API pxr::UsdPhysicsPrismaticJoint definePhysicsPrismaticJoint(
 //! @param axis The axis of the joint.
 //! @param coneAngle0Limit The lower limit of the cone angle (degrees).
 //! @param coneAngle1Limit The upper limit of the cone angle (degrees).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsSphericalJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
@@ -320,7 +351,8 @@ USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> coneAngle0Limit = std::nullopt,
-    std::optional<float> coneAngle1Limit = std::nullopt
+    std::optional<float> coneAngle1Limit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a spherical joint, which acts as a ball and socket joint, connecting two rigid bodies.
@@ -335,6 +367,8 @@ USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
 //! @param axis The axis of the joint.
 //! @param coneAngle0Limit The lower limit of the cone angle (degrees).
 //! @param coneAngle1Limit The upper limit of the cone angle (degrees).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsSphericalJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
@@ -345,7 +379,8 @@ USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> coneAngle0Limit = std::nullopt,
-    std::optional<float> coneAngle1Limit = std::nullopt
+    std::optional<float> coneAngle1Limit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Creates a spherical joint, which acts as a ball and socket joint, connecting two rigid bodies.
@@ -359,6 +394,8 @@ USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
 //! @param axis The axis of the joint.
 //! @param coneAngle0Limit The lower limit of the cone angle (degrees).
 //! @param coneAngle1Limit The upper limit of the cone angle (degrees).
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when defining many joints. It must be a cache
+//! of the stage on which the joint is defined. If it is not specified, the world transforms are computed for this joint alone.
 //!
 //! @returns UsdPhysicsSphericalJoint schema wrapping the defined UsdPrim
 USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
@@ -368,7 +405,8 @@ USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
     const JointFrame& frame,
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
     std::optional<float> coneAngle0Limit = std::nullopt,
-    std::optional<float> coneAngle1Limit = std::nullopt
+    std::optional<float> coneAngle1Limit = std::nullopt,
+    const WorldTransformCache* xformCache = nullptr
 );
 
 //! Aligns an existing joint with the specified position, rotation, and axis.
@@ -386,7 +424,88 @@ USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
 //! @param joint The joint to align
 //! @param frame The position and rotation of the joint in the specified coordinate system.
 //! @param axis The axis of the joint.
-USDEX_API void alignPhysicsJoint(pxr::UsdPhysicsJoint joint, const JointFrame& frame, const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f));
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared when aligning many joints. It must be a cache
+//! of the stage of the joint. If it is not specified, the world transforms are computed for this joint alone.
+USDEX_API void alignPhysicsJoint(
+    pxr::UsdPhysicsJoint joint,
+    const JointFrame& frame,
+    const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f),
+    const WorldTransformCache* xformCache = nullptr
+);
+
+//! Aligns many existing joints with the specified positions, rotations, and axes.
+//!
+//! This produces the same opinions as calling `alignPhysicsJoint` for each joint, but the world transforms of all bodies are read from a single
+//! `WorldTransformCache` and the local frames are computed concurrently. All of the frames are then authored within a single `SdfChangeBlock`.
+//! This avoids recomputing the transforms of the ancestors shared by the bodies of an articulation for every joint.
+//!
+//! Any joint which can not be aligned is skipped with a runtime error, and all other joints are still aligned.
+//!
+//! @param joints The joints to align. All of the joints must belong to the same stage.
+//! @param frames The position and rotation of each joint in the specified coordinate system. This must be the same size as `joints`.
+//! @param axes The axis of each joint. This must be the same size as `joints`.
+//! @param xformCache An optional cache of the world transforms of the bodies, which can be shared with other calls. It must be a cache of the
+//! stage of the joints. If it is not specified, a cache is created for this call alone.
+//! @returns Whether every joint was aligned.
+USDEX_API bool alignPhysicsJoints(
+    const std::vector<pxr::UsdPhysicsJoint>& joints,
+    const std::vector<JointFrame>& frames,
+    const std::vector<pxr::GfVec3f>& axes,
+    const WorldTransformCache* xformCache = nullptr
+);
+
+//! Describes a single physics joint to be defined by `definePhysicsJoints`.
+//!
+//! The members correspond to the arguments of the `definePhysics*Joint` functions and are subject to the same validation. Members which do not
+//! apply to the `type` of joint are ignored.
+class PhysicsJointDescription
+{
+public:
+
+    //! The types of joint which can be defined
+    // clang-format off
+    enum class Type
+    {
+        Fixed,     //!< A `UsdPhysicsFixedJoint`, as defined by `definePhysicsFixedJoint`
+        Revolute,  //!< A `UsdPhysicsRevoluteJoint`, as defined by `definePhysicsRevoluteJoint`
+        Prismatic, //!< A `UsdPhysicsPrismaticJoint`, as defined by `definePhysicsPrismaticJoint`
+        Spherical, //!< A `UsdPhysicsSphericalJoint`, as defined by `definePhysicsSphericalJoint`
+    };
+    // clang-format on
+
+    Type type = Type::Fixed; //!< The type of joint to define
+    pxr::SdfPath path; //!< The absolute prim path at which to define the joint
+    pxr::UsdPrim body0; //!< The first body of the joint
+    pxr::UsdPrim body1; //!< The second body of the joint
+    JointFrame frame = { JointFrame::Space::Body0, pxr::GfVec3d(0.0), pxr::GfQuatd::GetIdentity() }; //!< The position and rotation of the joint
+    pxr::GfVec3f axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f); //!< The axis of a revolute, prismatic, or spherical joint
+    std::optional<float> lowerLimit; //!< The lower limit of a revolute (degrees) or prismatic (distance) joint
+    std::optional<float> upperLimit; //!< The upper limit of a revolute (degrees) or prismatic (distance) joint
+    std::optional<float> coneAngle0Limit; //!< The cone limit of a spherical joint from the primary joint axis (degrees)
+    std::optional<float> coneAngle1Limit; //!< The cone limit of a spherical joint from the secondary joint axis (degrees)
+};
+
+//! Defines many physics joints on the stage in a single call.
+//!
+//! This produces the same scene description as calling the corresponding `definePhysics*Joint` function for each element of `joints`, but it is
+//! considerably faster when defining the thousands of joints of a large articulation (e.g. a robot or cable), as the per-joint overhead is
+//! amortized across the batch:
+//!
+//! - The arguments of all joints are validated concurrently, prior to authoring any opinions.
+//! - The local frames of all joints are computed concurrently, from a single `WorldTransformCache`, so the world transforms of shared ancestors
+//!   of the bodies are only computed once.
+//! - All of the prims are defined within a single `SdfChangeBlock`, so the stage only recomposes once.
+//! - All of the attributes and relationships are authored within a single `SdfChangeBlock`, so change notification is only sent once.
+//!
+//! Success or failure is reported per joint. Any invalid joint is not defined, a runtime error is emitted describing the reason, and an invalid
+//! `UsdPhysicsJoint` is returned at the corresponding index. All other joints are still defined.
+//!
+//! @note The world transforms of the bodies are read before any joint is defined, so a joint must not be defined at, or above, the path of a body.
+//!
+//! @param stage The stage on which to define the joints
+//! @param joints The descriptions of the joints to define
+//! @returns A `UsdPhysicsJoint` for each element of `joints`, in the same order. Any joint which could not be defined will be invalid.
+USDEX_API std::vector<pxr::UsdPhysicsJoint> definePhysicsJoints(pxr::UsdStagePtr stage, const std::vector<PhysicsJointDescription>& joints);
 
 //! @}
 
@@ -16,6 +16,8 @@
 #include <pxr/usd/usdShade/material.h>
 
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace usdex::core
 {
@@ -32,6 +34,8 @@ namespace usdex::core
 //! The functions below can be used to create a new physics material, to apply physics properties to a visual material, and to bind a physics material
 //! to a rigid body or collider.
 //!
+//! Scenes with many colliders should share a small number of materials via a `PhysicsMaterialRegistry`, and bind them with `bindPhysicsMaterials`.
+//!
 //! @note When mixing visual and physical materials, be sure use both `usdex::core::bindMaterial` and `usdex::core::bindPhysicsMaterial` on the target
 //! geometry, to ensure the material is used in both rendering and simulation contexts.
 //!
@@ -142,6 +146,92 @@ USDEX_API bool addPhysicsToMaterial(
 //! @returns Whether the material was successfully bound to the target prim.
 USDEX_API bool bindPhysicsMaterial(pxr::UsdPrim prim, const pxr::UsdShadeMaterial& material);
 
+//! Binds the corresponding physics material to each of many rigid bodies or collision geometry.
+//!
+//! This produces the same bindings as calling `bindPhysicsMaterial` for each prim, but the `UsdShadeMaterialBindingAPI` and the "physics"
+//! purpose binding relationships of all prims are authored directly on the edit target layer within a single `SdfChangeBlock`, so the stage
+//! only processes one change regardless of the number of colliders.
+//!
+//! Any invalid prim or material is skipped with a runtime error, and all other prims are still bound. If a prim appears more than once, the
+//! last material is bound.
+//!
+//! @note The bindings have the same "physics" purpose and "fallback strength" as `bindPhysicsMaterial`.
+//!
+//! @param prims The prims that the materials will affect. All of the prims must belong to the same stage.
+//! @param materials The material to bind to each prim. This must be the same size as `prims`.
+//! @returns Whether every prim was bound.
+USDEX_API bool bindPhysicsMaterials(const std::vector<pxr::UsdPrim>& prims, const std::vector<pxr::UsdShadeMaterial>& materials);
+
+//! Deduplicates equivalent physics materials, so each unique combination of physical properties is defined once and shared by every collider
+//! which uses it.
+//!
+//! The properties of each requested material are quantized using the tolerance of the registry. The first time a quantized combination is seen
+//! a physics material is defined below the parent prim using `definePhysicsMaterial()`, with the properties of that first request. Every later
+//! request which quantizes to the same combination returns that same material, regardless of the requested name.
+//!
+//! Source files often assign slightly different friction, restitution, or density values to every collider, even though the simulation only
+//! distinguishes a handful of materials. Sharing one material between them reduces the size of the exported layers and the number of materials
+//! which need to be processed by the simulation engine.
+//!
+//! @note The registry is not thread safe. Properties which are not specified are only considered equivalent to other unspecified properties.
+//! Values which are close to the boundary between two quantization steps may be assigned to different materials.
+class USDEX_API PhysicsMaterialRegistry
+{
+
+public:
+
+    //! Create a registry which defines each unique physics material below the given parent prim.
+    //!
+    //! @param parent Prim below which to define the Materials (e.g. the "PhysicsMaterials" scope of an asset)
+    //! @param tolerance The quantization step of all physical properties. A tolerance of zero only shares materials whose properties are
+    //! exactly equal. Negative or non-finite tolerances are treated as zero.
+    explicit PhysicsMaterialRegistry(pxr::UsdPrim parent, float tolerance = 1e-4f);
+
+    ~PhysicsMaterialRegistry();
+
+    PhysicsMaterialRegistry(const PhysicsMaterialRegistry&) = delete;
+    PhysicsMaterialRegistry& operator=(const PhysicsMaterialRegistry&) = delete;
+
+    //! Get the physics material for a combination of properties, defining it below the parent prim if no equivalent material has been defined yet.
+    //!
+    //! The name is only used when the material is first defined. It is made valid and unique among the materials of the registry, so it does
+    //! not need to be a valid identifier.
+    //!
+    //! @param name Name of the Material, if it is defined
+    //! @param dynamicFriction The dynamic friction of the material
+    //! @param staticFriction The static friction of the material
+    //! @param restitution The restitution of the material
+    //! @param density The density of the material
+    //! @returns The material for the properties. Returns an invalid object on error.
+    pxr::UsdShadeMaterial definePhysicsMaterial(
+        const std::string& name,
+        const float dynamicFriction,
+        const std::optional<float> staticFriction = std::nullopt,
+        const std::optional<float> restitution = std::nullopt,
+        const std::optional<float> density = std::nullopt
+    );
+
+    //! Get the quantization step of all physical properties.
+    //!
+    //! @returns The tolerance of the registry.
+    float getTolerance() const;
+
+    //! Get the number of unique materials which have been defined by the registry.
+    //!
+    //! @returns The number of unique materials.
+    size_t getUniqueMaterialCount() const;
+
+    //! Get the number of materials which have been requested from the registry, including those which were shared.
+    //!
+    //! @returns The number of successful calls to `definePhysicsMaterial`.
+    size_t getUseCount() const;
+
+private:
+
+    class PhysicsMaterialRegistryImpl;
+    PhysicsMaterialRegistryImpl* m_impl;
+};
+
 //! @}
 
 } // namespace usdex::core
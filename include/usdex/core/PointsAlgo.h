@@ -5,32 +5,39 @@
 #pragma once
 
 //! @file usdex/core/PointsAlgo.h
-//! @brief Utility functions to create `UsdGeomPoint` Prims.
+//! @brief Utility functions to create `UsdGeomPoint` and `UsdGeomPointInstancer` Prims.
 
 #include "Api.h"
 #include "PrimvarData.h"
 
 #include <pxr/base/gf/vec2f.h>
 #include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
 #include <pxr/usd/usdGeom/points.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xform.h>
 
 #include <optional>
+#include <vector>
 
 namespace usdex::core
 {
 
 //! @defgroup points Point Cloud / Particle Prims
 //!
-//! Utility functions to create `UsdGeomPoint` prims.
+//! Utility functions to create `UsdGeomPoint` and `UsdGeomPointInstancer` prims.
 //!
 //! [UsdGeomPoints](https://openusd.org/release/api/class_usd_geom_points.html#details) prims are simple point clouds or particle fields.
 //! Points generally receive a single shading sample each, which should take normals into account, if present.
 //!
+//! [UsdGeomPointInstancer](https://openusd.org/release/api/class_usd_geom_point_instancer.html#details) prims place many copies of a small
+//! number of prototype prims (e.g. vegetation, fasteners, or particle driven props) using one array element per instance.
+//!
 //! @{
 
 //! Defines a `UsdGeomPoints` prim on the stage.
@@ -78,6 +85,34 @@ USDEX_API pxr::UsdGeomPoints definePointCloud(
     std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
 );
 
+//! Defines a `UsdGeomPoints` prim on the stage, taking ownership of the points array.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! The points are moved into the function, so once it returns the authored attribute is the sole owner of the buffer. This avoids any risk
+//! of a later copy-on-write detach in the calling code, which is important when authoring very large point clouds. The ids and primvars can be
+//! transferred in the same manner by passing them as rvalues (e.g. using `std::move`).
+//!
+//! @param stage The stage on which to define the points.
+//! @param path The absolute prim path at which to define the points.
+//! @param points Vertex positions for the points described in local space.
+//! @param ids Values for the id specification for the points.
+//! @param widths Values for the width specification for the points.
+//! @param normals Values for the normals primvar for the points. Only Vertex normals are considered valid.
+//! @param displayColor Values to be authored for the display color primvar.
+//! @param displayOpacity Values to be authored for the display opacity primvar.
+//! @returns `UsdGeomPoints` schema wrapping the defined `UsdPrim`
+USDEX_API pxr::UsdGeomPoints definePointCloud(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    pxr::VtVec3fArray&& points,
+    std::optional<const pxr::VtInt64Array> ids = std::nullopt,
+    std::optional<const FloatPrimvarData> widths = std::nullopt,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+);
+
 //! Defines a `UsdGeomPoints` prim on the stage.
 //!
 //! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
@@ -122,6 +157,210 @@ USDEX_API pxr::UsdGeomPoints definePointCloud(
     std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
 );
 
+//! The `TiledPointCloudWriter` class authors a very large point cloud as a regular grid of `UsdGeomPoints` tiles.
+//!
+//! A single `UsdGeomPoints` prim with hundreds of millions of points is impractical for most renderers and viewers, as it cannot be culled or
+//! loaded incrementally. The writer instead defines a `UsdGeomXform` at the requested path and partitions the points spatially into child
+//! `UsdGeomPoints` prims, each with its own extent, so that consumers can cull and load by tile.
+//!
+//! Points can be supplied in any number of chunks (e.g. while streaming from a scan file). Each point is assigned to the tile containing it
+//! and the ids and primvars are partitioned consistently with the points. Tiles are authored as soon as they reach `maxPointsPerTile`,
+//! so that memory is bounded while authoring. If a tile receives more points after it has been authored, the following points are authored
+//! into an additional `UsdGeomPoints` prim for the same tile. Any remaining points are authored when `finish()` is called.
+//!
+//! Tiles are named `Tile_<x>_<y>_<z>` based on their integer grid coordinate, with negative coordinates prefixed by `n` (e.g. `Tile_n1_0_2`).
+//! Additional prims for a tile append a numeric suffix (e.g. `Tile_0_0_0_1`).
+//!
+//! Each chunk is validated in the same manner as `definePointCloud` and invalid chunks are rejected entirely. The presence of ids and of each
+//! primvar must be consistent across all chunks. Vertex primvars are authored as non-indexed vertex primvars on each tile. Constant primvars
+//! remain constant on a tile, unless chunks with differing constant values contributed to it.
+//!
+//! @warning A separate instance of this class should be used per-thread, calling methods from multiple threads is not safe.
+class USDEX_API TiledPointCloudWriter
+{
+
+public:
+
+    //! Construct a writer and define the `UsdGeomXform` which will parent the tiles.
+    //!
+    //! If the location is invalid or the tile size is not positive, the writer will be invalid and no points can be added.
+    //!
+    //! @param stage The stage on which to define the point cloud.
+    //! @param path The absolute prim path at which to define the parent xform.
+    //! @param tileSize The size of each cubic tile in the local space of the points.
+    //! @param maxPointsPerTile The number of points that will be buffered for a tile before it is authored.
+    TiledPointCloudWriter(pxr::UsdStagePtr stage, const pxr::SdfPath& path, float tileSize, size_t maxPointsPerTile = 1000000);
+
+    //! Destroy the writer, authoring any remaining points as if `finish()` had been called.
+    ~TiledPointCloudWriter();
+
+    TiledPointCloudWriter(const TiledPointCloudWriter&) = delete;
+    TiledPointCloudWriter& operator=(const TiledPointCloudWriter&) = delete;
+
+    //! Whether the writer is able to accept points.
+    //!
+    //! @returns False if the parent xform could not be defined or `finish()` has been called.
+    bool isValid() const;
+
+    //! Get the `UsdGeomXform` which parents the tiles.
+    //!
+    //! @returns The parent xform, which is invalid if it could not be defined.
+    pxr::UsdGeomXform getXform() const;
+
+    //! Add a chunk of points to the point cloud.
+    //!
+    //! @param points Vertex positions for the points described in the local space of the parent xform.
+    //! @param ids Values for the id specification for the points.
+    //! @param widths Values for the width specification for the points.
+    //! @param normals Values for the normals primvar for the points. Only Vertex normals are considered valid.
+    //! @param displayColor Values to be authored for the display color primvar.
+    //! @param displayOpacity Values to be authored for the display opacity primvar.
+    //! @returns True if the chunk was valid and its points were added.
+    bool addPoints(
+        const pxr::VtVec3fArray& points,
+        std::optional<const pxr::VtInt64Array> ids = std::nullopt,
+        std::optional<const FloatPrimvarData> widths = std::nullopt,
+        std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+        std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+        std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+    );
+
+    //! Author all remaining points and stop accepting new ones.
+    //!
+    //! @returns The `UsdGeomPoints` tiles authored by this writer, in the order in which they were authored.
+    std::vector<pxr::UsdGeomPoints> finish();
+
+private:
+
+    class TiledPointCloudWriterImpl;
+    TiledPointCloudWriterImpl* m_impl;
+};
+
+//! Defines a point cloud as a regular grid of `UsdGeomPoints` tiles below a `UsdGeomXform`.
+//!
+//! This is a convenience for using a `TiledPointCloudWriter` with a single chunk of points. See `TiledPointCloudWriter` for details.
+//!
+//! @param stage The stage on which to define the point cloud.
+//! @param path The absolute prim path at which to define the parent xform.
+//! @param tileSize The size of each cubic tile in the local space of the points.
+//! @param points Vertex positions for the points described in local space.
+//! @param ids Values for the id specification for the points.
+//! @param widths Values for the width specification for the points.
+//! @param normals Values for the normals primvar for the points. Only Vertex normals are considered valid.
+//! @param displayColor Values to be authored for the display color primvar.
+//! @param displayOpacity Values to be authored for the display opacity primvar.
+//! @param maxPointsPerTile The maximum number of points authored on a single `UsdGeomPoints` tile.
+//! @returns `UsdGeomXform` schema wrapping the defined `UsdPrim`. Returns an invalid schema on error.
+USDEX_API pxr::UsdGeomXform defineTiledPointCloud(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    float tileSize,
+    const pxr::VtVec3fArray& points,
+    std::optional<const pxr::VtInt64Array> ids = std::nullopt,
+    std::optional<const FloatPrimvarData> widths = std::nullopt,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt,
+    size_t maxPointsPerTile = 1000000
+);
+
+//! Defines a `UsdGeomPointInstancer` prim on the stage.
+//!
+//! Attribute values will be validated and in the case of invalid data the PointInstancer will not be defined. An invalid
+//! `UsdGeomPointInstancer` object will be returned in this case.
+//!
+//! Values will be authored for all attributes required to completely describe the PointInstancer, even if weaker matching opinions already
+//! exist. Any of the optional attributes which are not provided are blocked.
+//!
+//! - Prototypes
+//! - Proto Indices
+//! - Positions
+//! - Orientations
+//! - Scales
+//! - Ids
+//! - Invisible Ids
+//! - Extent
+//!
+//! The "extent" of the PointInstancer will be computed and authored based on the bounds of the prototypes and the transform of each instance.
+//! The instances are bound in parallel, so this is considerably faster than `UsdGeomPointInstancer::ComputeExtentAtTime` for large instancers.
+//!
+//! The prototypes must already be defined on the stage, as their bounds are required to compute the extent. It is recommended that the
+//! prototypes are defined beneath the PointInstancer, so that they are not imaged in their own right.
+//!
+//! @param stage The stage on which to define the point instancer.
+//! @param path The absolute prim path at which to define the point instancer.
+//! @param prototypes The prototype prims which will be instanced. The order of these prims determines the meaning of the `protoIndices`.
+//! @param protoIndices The index of the prototype for each instance.
+//! @param positions The position of each instance, described in the local space of the point instancer.
+//! @param orientations The orientation of each instance.
+//! @param scales The scale of each instance.
+//! @param ids Values for the id specification for the instances. These should be unique.
+//! @param invisibleIds The ids (or the indices, if no ids are provided) of instances which should not be imaged.
+//! @returns `UsdGeomPointInstancer` schema wrapping the defined `UsdPrim`
+USDEX_API pxr::UsdGeomPointInstancer definePointInstancer(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const std::vector<pxr::UsdPrim>& prototypes,
+    const pxr::VtIntArray& protoIndices,
+    const pxr::VtVec3fArray& positions,
+    std::optional<const pxr::VtQuathArray> orientations = std::nullopt,
+    std::optional<const pxr::VtVec3fArray> scales = std::nullopt,
+    std::optional<const pxr::VtInt64Array> ids = std::nullopt,
+    std::optional<const pxr::VtInt64Array> invisibleIds = std::nullopt
+);
+
+//! Defines a `UsdGeomPointInstancer` prim on the stage.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! @param parent Prim below which to define the point instancer.
+//! @param name Name of the point instancer.
+//! @param prototypes The prototype prims which will be instanced. The order of these prims determines the meaning of the `protoIndices`.
+//! @param protoIndices The index of the prototype for each instance.
+//! @param positions The position of each instance, described in the local space of the point instancer.
+//! @param orientations The orientation of each instance.
+//! @param scales The scale of each instance.
+//! @param ids Values for the id specification for the instances. These should be unique.
+//! @param invisibleIds The ids (or the indices, if no ids are provided) of instances which should not be imaged.
+//! @returns `UsdGeomPointInstancer` schema wrapping the defined `UsdPrim`
+USDEX_API pxr::UsdGeomPointInstancer definePointInstancer(
+    pxr::UsdPrim parent,
+    const std::string& name,
+    const std::vector<pxr::UsdPrim>& prototypes,
+    const pxr::VtIntArray& protoIndices,
+    const pxr::VtVec3fArray& positions,
+    std::optional<const pxr::VtQuathArray> orientations = std::nullopt,
+    std::optional<const pxr::VtVec3fArray> scales = std::nullopt,
+    std::optional<const pxr::VtInt64Array> ids = std::nullopt,
+    std::optional<const pxr::VtInt64Array> invisibleIds = std::nullopt
+);
+
+//! Convert prims which reference the same assets into a single `UsdGeomPointInstancer`.
+//!
+//! Exporters often author repeated geometry as one referencing prim per copy (e.g. one prim per tree or bolt). Such scenes compose and image
+//! far more slowly than a `UsdGeomPointInstancer` with one array element per copy.
+//!
+//! The prims are grouped by the references authored on their strongest prim spec which has references. A prototype is defined for each
+//! group in a `Prototypes` scope beneath the point instancer, named after the first prim of the group and carrying the same references.
+//! The world space transform of each prim is preserved by its instance, in the same order as the prims. Transforms which include shear can not
+//! be represented by an instance, in which case a warning is emitted and the shear is discarded.
+//!
+//! The prims are deactivated, rather than removed, so that the conversion can be reverted by removing the point instancer and reactivating them.
+//! Any opinions authored on the prims other than their references and transform are not carried over to the instances.
+//!
+//! @note The references are copied verbatim, so any relative asset paths must be valid relative to the layer of the current edit target.
+//!
+//! @param stage The stage on which to define the point instancer.
+//! @param path The absolute prim path at which to define the point instancer.
+//! @param prims The referencing prims to convert. Each must have at least one reference authored.
+//! @returns `UsdGeomPointInstancer` schema wrapping the defined `UsdPrim`. Returns an invalid schema on error, in which case no prims are
+//!     deactivated.
+USDEX_API pxr::UsdGeomPointInstancer convertToPointInstancer(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const std::vector<pxr::UsdPrim>& prims
+);
+
 //! @}
 
 } // namespace usdex::core
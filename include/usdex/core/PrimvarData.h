@@ -70,11 +70,44 @@ public:
     //! @returns The read-only `PrimvarData`.
     PrimvarData(const pxr::TfToken& interpolation, const pxr::VtArray<T>& values, const pxr::VtArray<int>& indices, int elementSize = -1);
 
+    //! Construct non-indexed `PrimvarData`, taking ownership of the values array.
+    //!
+    //! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+    //!
+    //! The values are moved into the `PrimvarData`, so the caller no longer shares the buffer. When the `PrimvarData` is subsequently moved into
+    //! one of the "define" functions, ownership is transferred all the way to the authored attribute.
+    //!
+    //! @param interpolation The primvar interpolation. Must match `UsdGeomPrimvar::IsValidInterpolation()` to be considered valid.
+    //! @param values The values array to take ownership of.
+    //! @param elementSize Optional element size. This should be fairly uncommon.
+    //!     See [GetElementSize](https://openusd.org/release/api/class_usd_geom_primvar.html#a711c3088ebca00ca75308485151c8590) for details.
+    //!
+    //! @returns The read-only `PrimvarData`.
+    PrimvarData(const pxr::TfToken& interpolation, pxr::VtArray<T>&& values, int elementSize = -1);
+
+    //! Construct indexed `PrimvarData`, taking ownership of the values and indices arrays.
+    //!
+    //! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+    //!
+    //! The values and indices are moved into the `PrimvarData`, so the caller no longer shares the buffers. When the `PrimvarData` is subsequently
+    //! moved into one of the "define" functions, ownership is transferred all the way to the authored attributes.
+    //!
+    //! @param interpolation The primvar interpolation. Must match `UsdGeomPrimvar::IsValidInterpolation()` to be considered valid.
+    //! @param values The values array to take ownership of.
+    //! @param indices The indices array to take ownership of.
+    //! @param elementSize Optional element size. This should be fairly uncommon.
+    //!     See [GetElementSize](https://openusd.org/release/api/class_usd_geom_primvar.html#a711c3088ebca00ca75308485151c8590) for details.
+    //!
+    //! @returns The read-only `PrimvarData`.
+    PrimvarData(const pxr::TfToken& interpolation, pxr::VtArray<T>&& values, pxr::VtArray<int>&& indices, int elementSize = -1);
+
     //! Construct a `PrimvarData` from a `UsdGeomPrimvar` that has already been authored.
     //!
     //! The primvar may be indexed, non-indexed, with or without elements, or it may not even be validly authored scene description.
     //! Use `isValid()` to confirm that valid data has been gathered.
     //!
+    //! Half precision values are converted to single precision when they are read into single precision `PrimvarData`.
+    //!
     //! @param primvar The previously authored `UsdGeomPrimvar`.
     //! @param time The time at which the attribute values are read.
     //!
@@ -88,6 +121,10 @@ public:
     //! To copy data from one `UsdGeomPrimvar` to another, use `PrimvarData::get(UsdGeomPrimvar&)` to gather the data,
     //! then use `setPrimvar(UsdGeomPrimvar&)` to author it.
     //!
+    //! As with the precision of `UsdGeomXformOps`, the values are authored at the precision of the primvar type. If single precision values
+    //! (`float`, `GfVec2f`, or `GfVec3f`) are set on a half precision primvar (e.g. `half[]`, `texCoord2h[]`, or `normal3h[]`), they are
+    //! converted in parallel, and the error of the conversion is reported to the `ScopedPrimvarPrecision` of the calling thread.
+    //!
     //! @param primvar The previously authored `UsdGeomPrimvar`.
     //! @param time The time at which the attribute values are written.
     //!
@@ -176,6 +213,9 @@ public:
     //!  - If there are no duplicate values.
     //!  - If the existing indices are invalid
     //!
+    //! Values are compared by value (floating point types by bit pattern, treating negative zero as zero) and the unique values are ordered
+    //! by their first occurrence. Large primvars are deduplicated in parallel, but the result is identical to a serial traversal.
+    //!
     //! @returns True if the values and/or indices were modified.
     bool index();
 
@@ -220,6 +260,104 @@ using Vec2fPrimvarData = PrimvarData<pxr::GfVec2f>;
 //! An alias for `PrimvarData` that holds `VtVec3fArray` values (e.g normals, colors, or other vectors).
 using Vec3fPrimvarData = PrimvarData<pxr::GfVec3f>;
 
+
+//! Controls the precision of the floating point primvars authored by the `define` functions.
+//!
+//! Half precision (16 bit) values halve the storage of normals, texture coordinates, and widths, at the cost of roughly 3 significant decimal
+//! digits of precision and a maximum magnitude of 65504. This is often sufficient for unit normals and for texture coordinates within a few
+//! tiles of the origin.
+enum class PrimvarPrecision
+{
+    eFloat = 0, //!< Author single precision values (e.g. `normal3f[]`, `texCoord2f[]`, `float[]`).
+    eHalf, //!< Author half precision values (e.g. `normal3h[]`, `texCoord2h[]`, `half[]`) for primvars which do not have a fixed schema type.
+};
+
+//! Get the `PrimvarPrecision` used by the `define` functions on the calling thread.
+//!
+//! @returns The `PrimvarPrecision` of the calling thread. Defaults to `PrimvarPrecision::eFloat`.
+USDEX_API PrimvarPrecision getPrimvarPrecision();
+
+//! Set the `PrimvarPrecision` used by the `define` functions on the calling thread.
+//!
+//! When `PrimvarPrecision::eHalf` is selected, `definePolyMesh` authors half precision normals and uvs, and `definePointCloud` authors half
+//! precision widths and normals. Display color and display opacity are always authored at single precision, as their types are fixed by the
+//! `UsdGeomGprim` schema.
+//!
+//! Prefer a `ScopedPrimvarPrecision` to ensure the previous precision is restored, and to measure the error introduced by the conversion.
+//!
+//! @param value The `PrimvarPrecision` for subsequent calls on the calling thread.
+USDEX_API void setPrimvarPrecision(PrimvarPrecision value);
+
+//! Select a `PrimvarPrecision` on the calling thread for the lifetime of this object, and measure the error introduced by converting values.
+//!
+//! The previous precision is restored on destruction, so scopes can be nested. The error measured by a scope includes the error of any nested
+//! scopes.
+//!
+//! Example:
+//!
+//!     usdex::core::ScopedPrimvarPrecision precision(usdex::core::PrimvarPrecision::eHalf);
+//!     usdex::core::definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs);
+//!     TF_STATUS("Maximum error %g", precision.getMaxError());
+class USDEX_API ScopedPrimvarPrecision
+{
+
+public:
+
+    //! Select the `PrimvarPrecision` for the calling thread until this object is destroyed.
+    //!
+    //! @param value The `PrimvarPrecision` to select.
+    explicit ScopedPrimvarPrecision(PrimvarPrecision value);
+
+    //! Restores the previous `PrimvarPrecision` of the calling thread.
+    ~ScopedPrimvarPrecision();
+
+    ScopedPrimvarPrecision(const ScopedPrimvarPrecision&) = delete;
+    ScopedPrimvarPrecision& operator=(const ScopedPrimvarPrecision&) = delete;
+
+    //! Get the largest absolute difference between any component of a value and its converted value, over all of the values converted by
+    //! `PrimvarData::setPrimvar` on the calling thread since this object was constructed.
+    //!
+    //! NaN values are preserved by the conversion and do not contribute to the error. Values beyond the range of the lower precision type
+    //! become infinite, and report an infinite error.
+    //!
+    //! @returns The maximum error, or zero if no values have been converted.
+    double getMaxError() const;
+
+private:
+
+    PrimvarPrecision m_previous;
+    double m_previousError;
+};
+
+namespace detail
+{
+
+//! Record the error of a precision conversion made by `PrimvarData::setPrimvar`, for the `ScopedPrimvarPrecision` of the calling thread.
+USDEX_API void recordPrimvarPrecisionError(double error);
+
+//! Compute the unique values and the indices into them for an array of flattened values.
+//!
+//! Unique values are ordered by their first occurrence in the flattened values. The results are identical regardless of whether the work was
+//! partitioned across threads.
+//!
+//! This is explicitly instantiated for each of the value types of `PrimvarData`.
+template <typename T>
+USDEX_API void computeIndexing(const pxr::VtArray<T>& flattenedValues, pxr::VtArray<T>& indexedValues, pxr::VtIntArray& indices);
+
+//! Convert single precision values to half precision in parallel, returning the largest absolute difference between any converted component.
+//!
+//! This is explicitly instantiated for each of the value types of `PrimvarData` which have a half precision equivalent.
+template <typename T, typename H>
+USDEX_API double convertToHalf(const pxr::VtArray<T>& values, pxr::VtArray<H>& result);
+
+//! Convert half precision values to single precision in parallel. This conversion is exact.
+//!
+//! This is explicitly instantiated for each of the value types of `PrimvarData` which have a half precision equivalent.
+template <typename H, typename T>
+USDEX_API void convertFromHalf(const pxr::VtArray<H>& values, pxr::VtArray<T>& result);
+
+} // namespace detail
+
 //! @}
 
 } // namespace usdex::core
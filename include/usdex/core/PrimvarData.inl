@@ -4,12 +4,103 @@
 
 #pragma once
 
+#include <pxr/base/gf/half.h>
+#include <pxr/base/gf/vec2h.h>
+#include <pxr/base/gf/vec3h.h>
 #include <pxr/base/tf/diagnostic.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/type.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
 #include <map>
+#include <type_traits>
+#include <utility>
+
+namespace usdex::core::detail
+{
+
+//! The half precision type used when `PrimvarData` values are authored to, or read from, a half precision primvar.
+//!
+//! Types without a half precision equivalent are always authored at their own precision.
+template <typename T>
+struct PrimvarPrecisionTraits
+{
+    using HalfType = void;
+};
+
+template <>
+struct PrimvarPrecisionTraits<float>
+{
+    using HalfType = pxr::GfHalf;
+};
+
+template <>
+struct PrimvarPrecisionTraits<pxr::GfVec2f>
+{
+    using HalfType = pxr::GfVec2h;
+};
+
+template <>
+struct PrimvarPrecisionTraits<pxr::GfVec3f>
+{
+    using HalfType = pxr::GfVec3h;
+};
+
+//! Whether the primvar holds the half precision equivalent of `T`.
+template <typename T>
+bool isHalfPrecisionPrimvar(const pxr::UsdGeomPrimvar& primvar)
+{
+    using HalfType = typename PrimvarPrecisionTraits<T>::HalfType;
+    if constexpr (std::is_void_v<HalfType>)
+    {
+        return false;
+    }
+    else
+    {
+        return primvar.GetTypeName().GetType() == pxr::TfType::Find<pxr::VtArray<HalfType>>();
+    }
+}
+
+//! Read the values of a half precision primvar, converting them to the precision of `T`.
+template <typename T>
+bool getHalfPrecisionValues(const pxr::UsdGeomPrimvar& primvar, pxr::VtArray<T>& values, pxr::UsdTimeCode time)
+{
+    using HalfType = typename PrimvarPrecisionTraits<T>::HalfType;
+    if constexpr (std::is_void_v<HalfType>)
+    {
+        return false;
+    }
+    else
+    {
+        pxr::VtArray<HalfType> halfValues;
+        if (!primvar.Get(&halfValues, time))
+        {
+            return false;
+        }
+        convertFromHalf(halfValues, values);
+        return true;
+    }
+}
+
+//! Author values of the precision of `T` on a half precision primvar, reporting the error of the conversion to the calling thread.
+template <typename T>
+bool setHalfPrecisionValues(pxr::UsdGeomPrimvar& primvar, const pxr::VtArray<T>& values, pxr::UsdTimeCode time)
+{
+    using HalfType = typename PrimvarPrecisionTraits<T>::HalfType;
+    if constexpr (std::is_void_v<HalfType>)
+    {
+        return false;
+    }
+    else
+    {
+        pxr::VtArray<HalfType> halfValues;
+        recordPrimvarPrecisionError(convertToHalf(values, halfValues));
+        return primvar.Set(halfValues, time);
+    }
+}
+
+} // namespace usdex::core::detail
 
 namespace usdex::core
 {
@@ -26,6 +117,18 @@ PrimvarData<T>::PrimvarData(const pxr::TfToken& interpolation, const pxr::VtArra
 {
 }
 
+template <typename T>
+PrimvarData<T>::PrimvarData(const pxr::TfToken& interpolation, pxr::VtArray<T>&& values, int elementSize)
+    : m_interpolation(interpolation), m_elementSize(elementSize), m_values(std::move(values))
+{
+}
+
+template <typename T>
+PrimvarData<T>::PrimvarData(const pxr::TfToken& interpolation, pxr::VtArray<T>&& values, pxr::VtArray<int>&& indices, int elementSize)
+    : m_interpolation(interpolation), m_elementSize(elementSize), m_values(std::move(values)), m_indices(std::move(indices))
+{
+}
+
 template <typename T>
 PrimvarData<T> PrimvarData<T>::getPrimvarData(const pxr::UsdGeomPrimvar& primvar, pxr::UsdTimeCode time)
 {
@@ -37,7 +140,14 @@ PrimvarData<T> PrimvarData<T>::getPrimvarData(const pxr::UsdGeomPrimvar& primvar
     int elementSize = primvar.HasAuthoredElementSize() ? primvar.GetElementSize() : -1;
 
     pxr::VtArray<T> values;
-    if (!primvar.Get<pxr::VtArray<T>>(&values, time))
+    if (detail::isHalfPrecisionPrimvar<T>(primvar))
+    {
+        if (!detail::getHalfPrecisionValues(primvar, values, time))
+        {
+            return PrimvarData<T>(pxr::UsdGeomTokens->constant, {}, -1);
+        }
+    }
+    else if (!primvar.Get<pxr::VtArray<T>>(&values, time))
     {
         return PrimvarData<T>(pxr::UsdGeomTokens->constant, {}, -1);
     }
@@ -46,11 +156,11 @@ PrimvarData<T> PrimvarData<T>::getPrimvarData(const pxr::UsdGeomPrimvar& primvar
     {
         pxr::VtIntArray indices;
         primvar.GetIndices(&indices, time);
-        return PrimvarData<T>(primvar.GetInterpolation(), values, indices, elementSize);
+        return PrimvarData<T>(primvar.GetInterpolation(), std::move(values), std::move(indices), elementSize);
     }
     else
     {
-        return PrimvarData<T>(primvar.GetInterpolation(), values, elementSize);
+        return PrimvarData<T>(primvar.GetInterpolation(), std::move(values), elementSize);
     }
 }
 
@@ -67,7 +177,15 @@ bool PrimvarData<T>::setPrimvar(pxr::UsdGeomPrimvar& primvar, pxr::UsdTimeCode t
         return false;
     }
 
-    if (!primvar.Set(m_values, time))
+    // Author the values at the precision of the primvar, as setValueWithPrecision does for xformOps
+    if (detail::isHalfPrecisionPrimvar<T>(primvar))
+    {
+        if (!detail::setHalfPrecisionValues(primvar, m_values, time))
+        {
+            return false;
+        }
+    }
+    else if (!primvar.Set(m_values, time))
     {
         return false;
     }
@@ -211,16 +329,20 @@ bool PrimvarData<T>::index()
         return false;
     }
 
+    // Only const access is used on the member arrays to avoid detaching them from any other owners (e.g. the caller)
+    const pxr::VtArray<T>& values = m_values;
+    const pxr::VtArray<int>& currentIndices = m_indices;
+
     // Compute the flattened values so that indexing can be performed on indexed or non-indexed data
-    pxr::VtArray<T> flattenedValues;
+    pxr::VtArray<T> flattened;
     if (this->hasIndices())
     {
-        flattenedValues.reserve(m_indices.size());
-        for (const auto& index : m_indices)
+        flattened.reserve(currentIndices.size());
+        for (const auto& index : currentIndices)
         {
-            if (size_t(index) < m_values.size())
+            if (size_t(index) < values.size())
             {
-                flattenedValues.push_back(m_values[index]);
+                flattened.push_back(values[index]);
             }
             else
             {
@@ -237,27 +359,14 @@ bool PrimvarData<T>::index()
     }
     else
     {
-        flattenedValues = m_values;
+        flattened = values;
     }
+    const pxr::VtArray<T>& flattenedValues = flattened;
 
     // Compute the indices and indexed values
     pxr::VtArray<T> indexedValues;
     pxr::VtIntArray indices;
-    indices.reserve(flattenedValues.size());
-
-    std::unordered_map<size_t, int> indexMap;
-    for (const auto& value : flattenedValues)
-    {
-        auto insertIt = indexMap.insert(std::make_pair(pxr::VtHashValue(value), static_cast<int>(indexedValues.size())));
-
-        // If the insert succeeded it is a new value and should be added to the values array
-        if (insertIt.second)
-        {
-            indexedValues.push_back(value);
-        }
-
-        indices.push_back(insertIt.first->second);
-    }
+    detail::computeIndexing(flattenedValues, indexedValues, indices);
 
     // Do not update the values and indices if their sizes have not changed.
     // Otherwise we are simply shuffling the data rather than actually changing the indexing.
@@ -274,8 +383,8 @@ bool PrimvarData<T>::index()
     }
 
     // Update the values and indices
-    m_values = indexedValues;
-    m_indices = indices;
+    m_values = std::move(indexedValues);
+    m_indices = std::move(indices);
 
     return true;
 }
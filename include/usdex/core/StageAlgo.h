@@ -12,8 +12,10 @@
 #include <pxr/base/tf/token.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <future>
 #include <optional>
 #include <string_view>
+#include <vector>
 
 namespace usdex::core
 {
@@ -76,6 +78,52 @@ USDEX_API pxr::UsdStageRefPtr createStage(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
 );
 
+//! Create and configure an in-memory `UsdStage` which will later be exported to the identifier using `exportInMemoryStage`.
+//!
+//! This validates the arguments exactly as `createStage` does and authors the same metadata, but the root layer of the stage is an anonymous
+//! layer, so nothing is written to the identifier until `exportInMemoryStage` is called. Authoring to an anonymous layer avoids any
+//! intermediate writes to (potentially remote) storage during a long conversion.
+//!
+//! The identifier and file format arguments are recorded on the anonymous root layer, as its tag and file format arguments respectively.
+//!
+//! @param identifier The identifier to which the root layer of this stage will be exported.
+//! @param defaultPrimName Name of the default root prim.
+//! @param upAxis The up axis for all the geometry contained in the stage.
+//! @param linearUnits The meters per unit for all linear measurements in the stage.
+//! @param massUnits The kilograms per unit for all mass measurements in the stage.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied when the stage is exported.
+//! @returns The newly created stage or a null pointer.
+USDEX_API pxr::UsdStageRefPtr createInMemoryStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const pxr::TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+);
+
+//! Create and configure an in-memory `UsdStage` which will later be exported to the identifier using `exportInMemoryStage`.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! @param identifier The identifier to which the root layer of this stage will be exported.
+//! @param defaultPrimName Name of the default root prim.
+//! @param upAxis The up axis for all the geometry contained in the stage.
+//! @param linearUnits The meters per unit for all linear measurements in the stage.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied when the stage is exported.
+//! @returns The newly created stage or a null pointer.
+USDEX_API pxr::UsdStageRefPtr createInMemoryStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const pxr::TfToken& upAxis,
+    const double linearUnits,
+    const std::string& authoringMetadata,
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+);
+
 //! Configure a stage so that the defining metadata is explicitly authored.
 //!
 //! The default prim will be used as the target of a Reference or Payload to this layer when no explicit prim path is specified.
@@ -134,6 +182,9 @@ USDEX_API bool configureStage(
 //!
 //! The comment will be authored in all layers as the SdfLayer comment.
 //!
+//! The layers are independent of one another, so they are saved concurrently using a bounded number of worker threads. The layers saved
+//! are the same as `UsdStage::Save`, which excludes anonymous layers and the layers of the session layer stack.
+//!
 //! @param stage The stage to be saved.
 //! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
 //!    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
@@ -144,6 +195,67 @@ USDEX_API void saveStage(
     std::optional<std::string_view> comment = std::nullopt
 );
 
+//! Save the given `UsdStage` with metadata applied to all dirty layers, reporting whether every layer was saved.
+//!
+//! The layers are annotated and saved exactly as in `saveStage`.
+//!
+//! @param stage The stage to be saved.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
+//! @param comment The comment will be authored in all dirty layers as the `Sdf.Layer` comment.
+//! @returns False if any layer failed to save. A warning is issued for each layer that failed.
+USDEX_API bool saveDirtyLayers(
+    pxr::UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata = std::nullopt,
+    std::optional<std::string_view> comment = std::nullopt
+);
+
+//! Export the anonymous root layer of an in-memory `UsdStage` to the identifier it was created for.
+//!
+//! The identifier and file format arguments are those given to `createInMemoryStage` (or more generally, the tag and file format arguments
+//! of the anonymous root layer). The root layer is written exactly once, with the authoring metadata and comment applied as in `saveStage`.
+//!
+//! Asset paths which were authored as absolute filesystem paths within the directory of the identifier are made relative to the identifier
+//! before it is written, so that the exported layer can be relocated along with its dependencies. This modifies the in-memory root layer.
+//!
+//! @note Only the root layer is exported. Any other anonymous layers that the stage depends on must be exported separately.
+//!
+//! @param stage The in-memory stage to be exported.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists on the root layer, it will not be overwritten & this data will be ignored.
+//! @param comment The comment will be authored on the root layer as the `Sdf.Layer` comment.
+//! @returns A bool indicating if the export was successful.
+USDEX_API bool exportInMemoryStage(
+    pxr::UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata = std::nullopt,
+    std::optional<std::string_view> comment = std::nullopt
+);
+
+//! Save the given `UsdStage` with metadata applied to all dirty layers, serializing the layers on a background thread.
+//!
+//! The authoring metadata and comment are applied to the dirty layers exactly as in `saveStage`. The content of each dirty layer is then
+//! copied into an in-memory snapshot on the calling thread, and the snapshots are written to disk on worker threads. The stage may be
+//! edited as soon as this function returns, and those edits do not affect the layers being written.
+//!
+//! Unlike `saveStage`, the layers on the stage remain dirty once the snapshots are written, as they may have been edited in the meantime.
+//! A subsequent save will write them again.
+//!
+//! The returned future does not need to be kept alive for the save to complete. If the concurrency of the OpenUSD Work library has been
+//! limited to a single thread then the layers are written before this function returns.
+//!
+//! @note Only one save of a given stage should be in flight at a time. Wait on the returned future before saving the stage again.
+//!
+//! @param stage The stage to be saved.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
+//! @param comment The comment will be authored in all dirty layers as the `Sdf.Layer` comment.
+//! @returns A future which becomes ready once all of the layers have been written. Its value is false if any layer failed to write.
+USDEX_API std::shared_future<bool> saveStageAsync(
+    pxr::UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata = std::nullopt,
+    std::optional<std::string_view> comment = std::nullopt
+);
+
 //! @}
 
 //! @defgroup stage_hierarchy UsdStage Hierarchy
@@ -189,6 +301,43 @@ USDEX_API bool isEditablePrimLocation(const pxr::UsdPrim& prim, const std::strin
 //! @returns True if the location is valid, or false otherwise.
 USDEX_API bool isEditablePrimLocation(const pxr::UsdPrim& prim, std::string* reason);
 
+//! Validate that prim opinions could be authored at each of many paths on the stage
+//!
+//! Each path is validated exactly as by `isEditablePrimLocation`. However, the parent of each path is only inspected once, so validating many
+//! siblings does not look up the same parent prim repeatedly. An existing prim at a path is only looked up when its parent is an instance
+//! or an instance proxy, as otherwise it can not be an instance proxy.
+//!
+//! If `reasons` is non-null, it will be resized to match `paths`, and an error message will be set for each invalid location.
+//! The reason for a valid location is an empty string.
+//!
+//! @param stage The Stage to consider.
+//! @param paths The Paths to consider.
+//! @param reasons The output messages for failed validation.
+//! @returns A bool per path indicating if the location is valid.
+USDEX_API std::vector<bool> areEditablePrimLocations(
+    const pxr::UsdStagePtr stage,
+    const pxr::SdfPathVector& paths,
+    std::vector<std::string>* reasons = nullptr
+);
+
+//! Validate that prim opinions could be authored for many child prims with the given names
+//!
+//! Each name is validated exactly as by `isEditablePrimLocation`. However, the parent prim is only validated once, and existing children are
+//! only looked up when the parent is an instance, as otherwise they can not be instance proxies.
+//!
+//! If `reasons` is non-null, it will be resized to match `names`, and an error message will be set for each invalid location.
+//! The reason for a valid location is an empty string.
+//!
+//! @param prim The UsdPrim which would be the parent of the proposed locations.
+//! @param names The names which would be used for the UsdPrims at the proposed locations.
+//! @param reasons The output messages for failed validation.
+//! @returns A bool per name indicating if the location is valid.
+USDEX_API std::vector<bool> areEditablePrimLocations(
+    const pxr::UsdPrim& prim,
+    const std::vector<std::string>& names,
+    std::vector<std::string>* reasons = nullptr
+);
+
 //! @}
 
 } // namespace usdex::core
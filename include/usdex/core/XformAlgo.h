@@ -11,14 +11,19 @@
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/transform.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/editTarget.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/xform.h>
+#include <pxr/usd/usdGeom/xformOp.h>
 
 #include <optional>
 #include <string>
+#include <vector>
 
 
 namespace usdex::core
@@ -178,6 +183,243 @@ USDEX_API bool setLocalTransform(
     pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
 );
 
+//! Opt-in reduction of redundant time samples for the `setLocalTransform` functions that author many times at once.
+//!
+//! A sample is not authored if the stage reproduces its value within the tolerance by interpolating between the samples that are authored,
+//! using the interpolation type of the stage. This drops samples which are constant, or which change linearly, across a range of times. The
+//! samples at the first and last times are always authored. Each xformOp is reduced independently.
+//!
+//! The tolerance is the largest difference allowed between the components of a sample and its interpolated value, in the units of each
+//! component (e.g. distance for translations and matrix elements, degrees for rotations).
+//!
+//! @note The times must be in increasing order for any samples to be reduced.
+struct KeyframeReduction
+{
+    //! Construct a reduction with the given tolerance.
+    //!
+    //! @param tolerance The largest difference allowed between a sample and its interpolated value.
+    explicit KeyframeReduction(double tolerance = 1e-6) : tolerance(tolerance)
+    {
+    }
+
+    //! The largest difference allowed between a sample and its interpolated value.
+    double tolerance;
+
+    //! The number of samples that were not authored. This accumulates over every call that uses this reduction.
+    size_t removedSamples = 0;
+};
+
+//! Set the local transform of a prim at many times from 4x4 matrices.
+//!
+//! The result is identical to calling `setLocalTransform` once per time. However, the existing `UsdGeomXformOps` are only inspected once and
+//! all of the time samples are then authored directly within a single `SdfChangeBlock`.
+//!
+//! @param prim The prim to set local transform on.
+//! @param times The times at which to write the values. These must not be `UsdTimeCode::Default()`.
+//! @param matrices The matrix value to set at each time. This must contain one value per time.
+//! @param reduction Optionally drop redundant samples. See `KeyframeReduction` for details.
+//! @returns True if the transform was set successfully. If the sizes of the arrays do not match then no opinions are authored.
+USDEX_API bool setLocalTransform(
+    pxr::UsdPrim prim,
+    const std::vector<pxr::UsdTimeCode>& times,
+    const std::vector<pxr::GfMatrix4d>& matrices,
+    KeyframeReduction* reduction = nullptr
+);
+
+//! Set the local transform of a prim at many times.
+//!
+//! The `UsdGeomXformOps` are chosen once for all of the values. If any value requires the `UsdGeomXformCommonAPI` to retain its pivot position
+//! then all values are authored using it, otherwise a single transform xformOp is used. All of the time samples are authored directly within a
+//! single `SdfChangeBlock`.
+//!
+//! @param prim The prim to set local transform on.
+//! @param times The times at which to write the values. These must not be `UsdTimeCode::Default()`.
+//! @param transforms The transform value to set at each time. This must contain one value per time.
+//! @param reduction Optionally drop redundant samples. See `KeyframeReduction` for details.
+//! @returns True if the transform was set successfully. If the sizes of the arrays do not match then no opinions are authored.
+USDEX_API bool setLocalTransform(
+    pxr::UsdPrim prim,
+    const std::vector<pxr::UsdTimeCode>& times,
+    const std::vector<pxr::GfTransform>& transforms,
+    KeyframeReduction* reduction = nullptr
+);
+
+//! Set the local transform of a prim at many times from common transform components.
+//!
+//! The `UsdGeomXformOps` are chosen once for all of the values. If no value has a pivot and the prim already has a single transform xformOp
+//! then all values are authored as matrices, otherwise all values are authored using the `UsdGeomXformCommonAPI`. All of the time samples are
+//! authored directly within a single `SdfChangeBlock`.
+//!
+//! @param prim The prim to set local transform on.
+//! @param times The times at which to write the values. These must not be `UsdTimeCode::Default()`.
+//! @param translations The translation value to set at each time. This must contain one value per time.
+//! @param pivots The pivot position value to set at each time. This must contain one value per time.
+//! @param rotations The rotation value to set at each time in degrees. This must contain one value per time.
+//! @param rotationOrder The rotation order of all of the rotation values.
+//! @param scales The scale value to set at each time. This must contain one value per time.
+//! @param reduction Optionally drop redundant samples. See `KeyframeReduction` for details.
+//! @returns True if the transform was set successfully. If the sizes of the arrays do not match then no opinions are authored.
+USDEX_API bool setLocalTransform(
+    pxr::UsdPrim prim,
+    const std::vector<pxr::UsdTimeCode>& times,
+    const std::vector<pxr::GfVec3d>& translations,
+    const std::vector<pxr::GfVec3d>& pivots,
+    const std::vector<pxr::GfVec3f>& rotations,
+    const RotationOrder rotationOrder,
+    const std::vector<pxr::GfVec3f>& scales,
+    KeyframeReduction* reduction = nullptr
+);
+
+//! Set the local transform of a prim at many times from common transform components using quaternions for orientation.
+//!
+//! The result is identical to calling `setLocalTransform` once per time. However, the translate, orient and scale `UsdGeomXformOps` are only
+//! resolved once and all of the time samples are then authored directly within a single `SdfChangeBlock`.
+//!
+//! @param prim The prim to set local transform on.
+//! @param times The times at which to write the values. These must not be `UsdTimeCode::Default()`.
+//! @param translations The translation value to set at each time. This must contain one value per time.
+//! @param orientations The orientation value to set at each time as a quaternion. This must contain one value per time.
+//! @param scales The scale value to set at each time. This must contain one value per time.
+//! @param reduction Optionally drop redundant samples. See `KeyframeReduction` for details.
+//! @returns True if the transform was set successfully. If the sizes of the arrays do not match then no opinions are authored.
+USDEX_API bool setLocalTransform(
+    pxr::UsdPrim prim,
+    const std::vector<pxr::UsdTimeCode>& times,
+    const std::vector<pxr::GfVec3d>& translations,
+    const std::vector<pxr::GfQuatf>& orientations,
+    const std::vector<pxr::GfVec3f>& scales,
+    KeyframeReduction* reduction = nullptr
+);
+
+//! Set the local transforms of many prims with a single round of change processing.
+//!
+//! The result is identical to calling `setLocalTransform` for each prim. However, the existing `UsdGeomXformOps` of all prims are inspected
+//! and the values to author are computed concurrently, before any opinions are authored. All opinions are then authored within a single
+//! `SdfChangeBlock`, so the stage only processes the changes once.
+//!
+//! @param prims The prims to set local transforms on.
+//! @param transforms The transform value to set on each prim. This must contain one value per prim.
+//! @param time Time at which to write the values.
+//! @returns True if all of the local transforms were set. If the sizes of the arrays do not match then no opinions are authored.
+USDEX_API bool setLocalTransforms(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::GfTransform>& transforms,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+);
+
+//! Set the local transforms of many prims from 4x4 matrices with a single round of change processing.
+//!
+//! The result is identical to calling `setLocalTransform` for each prim. However, the existing `UsdGeomXformOps` of all prims are inspected
+//! concurrently, before any opinions are authored. All opinions are then authored within a single `SdfChangeBlock`, so the stage only
+//! processes the changes once.
+//!
+//! @param prims The prims to set local transforms on.
+//! @param matrices The matrix value to set on each prim. This must contain one value per prim.
+//! @param time Time at which to write the values.
+//! @returns True if all of the local transforms were set. If the sizes of the arrays do not match then no opinions are authored.
+USDEX_API bool setLocalTransforms(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::GfMatrix4d>& matrices,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+);
+
+//! Set the local transforms of many prims from common transform components with a single round of change processing.
+//!
+//! The result is identical to calling `setLocalTransform` for each prim. However, the existing `UsdGeomXformOps` of all prims are inspected
+//! and the values to author are computed concurrently, before any opinions are authored. All opinions are then authored within a single
+//! `SdfChangeBlock`, so the stage only processes the changes once.
+//!
+//! @param prims The prims to set local transforms on.
+//! @param translations The translation value to set on each prim. This must contain one value per prim.
+//! @param pivots The pivot position value to set on each prim. This must contain one value per prim.
+//! @param rotations The rotation value to set on each prim in degrees. This must contain one value per prim.
+//! @param rotationOrder The rotation order of all of the rotation values.
+//! @param scales The scale value to set on each prim. This must contain one value per prim.
+//! @param time Time at which to write the values.
+//! @returns True if all of the local transforms were set. If the sizes of the arrays do not match then no opinions are authored.
+USDEX_API bool setLocalTransforms(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::GfVec3d>& translations,
+    const std::vector<pxr::GfVec3d>& pivots,
+    const std::vector<pxr::GfVec3f>& rotations,
+    const RotationOrder rotationOrder,
+    const std::vector<pxr::GfVec3f>& scales,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+);
+
+//! Sets the local transform of a prim at many times, resolving the `UsdGeomXformOps` of the prim only once.
+//!
+//! The first value that is set resolves (and if necessary authors) the xformOps of the prim, exactly as the equivalent `setLocalTransform`
+//! function would. Subsequent values of the same format are written directly to the resolved xformOps. This skips the inspection of the
+//! existing xformOps and the authoring of the `xformOpOrder`, neither of which change between times, making it ideal for authoring animation
+//! one frame at a time.
+//!
+//! The xformOps are resolved again if the format of the value changes or if the edit target of the stage changes.
+//!
+//! @warning The xformOps are not re-inspected once they have been resolved. If the xformOps of the prim are modified by other means, call
+//! `reset()` before setting further values.
+class USDEX_API LocalTransformWriter
+{
+
+public:
+
+    //! Construct a writer for the given prim. No opinions are authored until a value is set.
+    //!
+    //! @param prim The prim to set local transforms on.
+    explicit LocalTransformWriter(pxr::UsdPrim prim);
+
+    //! Get the prim on which local transforms are set.
+    //!
+    //! @returns The prim supplied on construction.
+    const pxr::UsdPrim& getPrim() const;
+
+    //! Set the local transform of the prim from a 4x4 matrix.
+    //!
+    //! The result is identical to `setLocalTransform(prim, matrix, time)`.
+    //!
+    //! @param matrix The matrix value to set.
+    //! @param time Time at which to write the value.
+    //! @returns A bool indicating if the local transform was set.
+    bool set(const pxr::GfMatrix4d& matrix, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
+
+    //! Set the local transform of the prim from common transform components using a quaternion for orientation.
+    //!
+    //! The result is identical to `setLocalTransform(prim, translation, orientation, scale, time)`.
+    //!
+    //! @param translation The translation value to set.
+    //! @param orientation The orientation value to set as a quaternion.
+    //! @param scale The scale value to set.
+    //! @param time Time at which to write the values.
+    //! @returns A bool indicating if the local transform was set.
+    bool set(
+        const pxr::GfVec3d& translation,
+        const pxr::GfQuatf& orientation,
+        const pxr::GfVec3f& scale = pxr::GfVec3f(1.0f, 1.0f, 1.0f),
+        pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+    );
+
+    //! Discard the resolved xformOps, so that they are inspected again when the next value is set.
+    void reset();
+
+private:
+
+    // The format of the resolved xformOps
+    enum class Layout
+    {
+        eUnresolved,
+        eMatrix, // A single transform xformOp
+        eOrientation, // Translate, orient and scale xformOps
+    };
+
+    // Whether the xformOps have been resolved in the given format for the current edit target
+    bool isResolved(Layout layout) const;
+
+    pxr::UsdPrim m_prim;
+    pxr::UsdEditTarget m_editTarget;
+    Layout m_layout;
+    pxr::UsdGeomXformOp m_xformOps[3];
+};
+
 //! Get the local transform of a prim at a given time.
 //!
 //! @param prim The prim to get local transform from.
@@ -244,6 +486,112 @@ USDEX_API void getLocalTransformComponents(
     pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
 );
 
+//! Get the local transforms of many prims at a given time in the form of 4x4 matrices.
+//!
+//! The result is identical to calling `getLocalTransformMatrix` for each prim, but the prims are evaluated concurrently.
+//!
+//! @param prims The prims to get local transforms from.
+//! @param time Time at which to query the values.
+//! @returns The local transform matrix of each prim, matching the order of the input prims. Prims that are not xformable produce an identity
+//!     matrix.
+USDEX_API pxr::VtMatrix4dArray getLocalTransformMatrices(
+    const std::vector<pxr::UsdPrim>& prims,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+);
+
+//! Get the local transforms of all prims in a range at a given time in the form of 4x4 matrices.
+//!
+//! The range is traversed serially, then the prims are evaluated concurrently, as with `getLocalTransformMatrices(prims, time)`.
+//!
+//! @param range The range of prims to get local transforms from.
+//! @param time Time at which to query the values.
+//! @returns The local transform matrix of each prim, matching the traversal order of the range. Prims that are not xformable produce an
+//!     identity matrix.
+USDEX_API pxr::VtMatrix4dArray getLocalTransformMatrices(const pxr::UsdPrimRange& range, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
+
+//! Get the local transforms of many prims at a given time in the form of common transform components.
+//!
+//! The result is identical to calling `getLocalTransformComponents` for each prim, but the prims are evaluated concurrently. All results are
+//! resized to contain one value per prim, matching the order of the input prims.
+//!
+//! @param prims The prims to get local transforms from.
+//! @param translations Translation results.
+//! @param pivots Pivot position results.
+//! @param rotations Rotation results in degrees.
+//! @param rotationOrders Rotation order of each rotation result.
+//! @param scales Scale results.
+//! @param time Time at which to query the values.
+USDEX_API void getLocalTransformComponents(
+    const std::vector<pxr::UsdPrim>& prims,
+    pxr::VtVec3dArray& translations,
+    pxr::VtVec3dArray& pivots,
+    pxr::VtVec3fArray& rotations,
+    std::vector<RotationOrder>& rotationOrders,
+    pxr::VtVec3fArray& scales,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+);
+
+//! Get the local transforms of all prims in a range at a given time in the form of common transform components.
+//!
+//! The range is traversed serially, then the prims are evaluated concurrently, as with `getLocalTransformComponents(prims, ...)`. All results
+//! are resized to contain one value per prim, matching the traversal order of the range.
+//!
+//! @param range The range of prims to get local transforms from.
+//! @param translations Translation results.
+//! @param pivots Pivot position results.
+//! @param rotations Rotation results in degrees.
+//! @param rotationOrders Rotation order of each rotation result.
+//! @param scales Scale results.
+//! @param time Time at which to query the values.
+USDEX_API void getLocalTransformComponents(
+    const pxr::UsdPrimRange& range,
+    pxr::VtVec3dArray& translations,
+    pxr::VtVec3dArray& pivots,
+    pxr::VtVec3fArray& rotations,
+    std::vector<RotationOrder>& rotationOrders,
+    pxr::VtVec3fArray& scales,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+);
+
+//! Decompose many 4x4 matrices into common transform components.
+//!
+//! Each result is identical to the components that `getLocalTransformComponents` produces for a prim with a single transform xformOp, except
+//! that the rotation values are given in the requested rotation order. The matrices are decomposed concurrently. All results are resized to
+//! contain one value per matrix.
+//!
+//! @param matrices The matrices to decompose.
+//! @param rotationOrder The rotation order of the rotation results.
+//! @param translations Translation results.
+//! @param pivots Pivot position results. These are always zero.
+//! @param rotations Rotation results in degrees.
+//! @param scales Scale results.
+USDEX_API void computeTransformComponents(
+    const pxr::VtMatrix4dArray& matrices,
+    const RotationOrder rotationOrder,
+    pxr::VtVec3dArray& translations,
+    pxr::VtVec3dArray& pivots,
+    pxr::VtVec3fArray& rotations,
+    pxr::VtVec3fArray& scales
+);
+
+//! Decompose many 4x4 matrices into common transform components with quaternion orientation.
+//!
+//! Each result is identical to the components that `getLocalTransformComponentsQuat` produces for a prim with a single transform xformOp.
+//! The matrices are decomposed concurrently. All results are resized to contain one value per matrix.
+//!
+//! @param matrices The matrices to decompose.
+//! @param translations Translation results.
+//! @param pivots Pivot position results. These are always zero.
+//! @param orientations Orientation results as quaternions.
+//! @param scales Scale results.
+USDEX_API void computeTransformComponentsQuat(
+    const pxr::VtMatrix4dArray& matrices,
+    pxr::VtVec3dArray& translations,
+    pxr::VtVec3dArray& pivots,
+    pxr::VtQuatfArray& orientations,
+    pxr::VtVec3fArray& scales
+);
+
 //! Get the local transform of a prim at a given time in the form of common transform components with quaternion orientation.
 //!
 //! @param prim The prim to get local transform from.
@@ -278,6 +626,72 @@ USDEX_API void getLocalTransformComponentsQuat(
     pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
 );
 
+//! A thread-safe cache of world-space transforms for the prims of a stage at a given time.
+//!
+//! The world transform of each prim is computed from its local transform and the world transform of its parent, exactly as
+//! `UsdGeomXformable::ComputeLocalToWorldTransform` would, but the world transforms of all ancestors are cached and shared. Unlike a
+//! `UsdGeomXformCache`, a single instance can be queried from many threads at once, so shared ancestors are only computed once.
+//!
+//! The cache listens for changes to the stage and incrementally discards the cached transforms of any changed prims and their descendants.
+//! All other cached transforms remain valid.
+//!
+//! @note Prims that are not xformable have an identity local transform, so their world transform is that of their parent.
+class USDEX_API WorldTransformCache
+{
+
+public:
+
+    //! Construct a cache for the prims of a stage.
+    //!
+    //! @param stage The stage whose prims will be queried. Prims of other stages produce an identity transform.
+    //! @param time Time at which to compute the transforms.
+    explicit WorldTransformCache(pxr::UsdStagePtr stage, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
+
+    ~WorldTransformCache();
+
+    WorldTransformCache(const WorldTransformCache&) = delete;
+    WorldTransformCache& operator=(const WorldTransformCache&) = delete;
+
+    //! Get the time at which transforms are computed.
+    //!
+    //! @returns The time supplied on construction or to `setTime`.
+    pxr::UsdTimeCode getTime() const;
+
+    //! Set the time at which transforms are computed. If the time differs from the current time all cached transforms are discarded.
+    //!
+    //! @warning This must not be called while other threads are querying the cache.
+    //!
+    //! @param time Time at which to compute the transforms.
+    void setTime(pxr::UsdTimeCode time);
+
+    //! Get the world transform of a prim.
+    //!
+    //! This is safe to call from many threads at once.
+    //!
+    //! @param prim The prim to get the world transform of.
+    //! @returns The local to world transform of the prim, or an identity matrix if the prim is invalid or belongs to another stage.
+    pxr::GfMatrix4d getWorldTransform(const pxr::UsdPrim& prim) const;
+
+    //! Get the world transforms of many prims. The prims are evaluated concurrently.
+    //!
+    //! @param prims The prims to get the world transforms of.
+    //! @returns The local to world transform of each prim, matching the order of the input prims.
+    pxr::VtMatrix4dArray getWorldTransforms(const std::vector<pxr::UsdPrim>& prims) const;
+
+    //! Discard all cached transforms.
+    void clear();
+
+    //! Return the number of prims for which transforms are currently cached.
+    //!
+    //! @returns The number of cached transforms.
+    size_t size() const;
+
+private:
+
+    class WorldTransformCacheImpl;
+    WorldTransformCacheImpl* m_impl;
+};
+
 //! @}
 
 //! @defgroup xform Xform Prims
@@ -19,21 +19,33 @@
 #endif
 
 #include <pxr/base/gf/camera.h>
+#include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/transform.h>
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/diagnosticBase.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/dictionary.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/usd/sdf/assetPath.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/sdf/valueTypeName.h>
 #include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/editTarget.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usdGeom/basisCurves.h>
 #include <pxr/usd/usdGeom/camera.h>
 #include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
 #include <pxr/usd/usdGeom/points.h>
 #include <pxr/usd/usdGeom/primvar.h>
 #include <pxr/usd/usdGeom/scope.h>
+#include <pxr/usd/usdGeom/subset.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/xformable.h>
 #include <pxr/usd/usdLux/distantLight.h>
@@ -49,6 +61,11 @@
 #include <pxr/usd/usdShade/material.h>
 #include <pxr/usd/usdShade/shader.h>
 
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 namespace pybind11::detail
 {
@@ -68,6 +85,448 @@ namespace pybind11::detail
 //!
 //! @{
 
+//! Get the C++ object held by an OpenUSD bound Python object, without constructing any intermediate `boost::python` objects.
+//!
+//! This performs the same lvalue lookup as `boost::python::extract<T&>`, but directly from the `PyObject`, so the fixed cost of each argument
+//! conversion is a single registry lookup.
+//!
+//! @returns A pointer to the held object, or nullptr if the Python object does not hold a `T`.
+template <typename T>
+T* pyboost11_get_lvalue(handle src)
+{
+    namespace converter = USDEX_BOOST_PYTHON_NAMESPACE::converter;
+    return static_cast<T*>(converter::get_lvalue_from_python(src.ptr(), converter::registered<T>::converters));
+}
+
+//! A caster for OpenUSD bound types which are cheap to copy (e.g. `SdfPath` or any `VtArray`).
+//!
+//! Python objects which hold the exact C++ type are unwrapped directly, so a `VtArray` shares its buffer with the Python object rather than
+//! being copied. Any other object falls back to the OpenUSD conversions (e.g. a `str` for an `SdfPath` or a list of values for a `VtArray`).
+template <typename type>
+struct pyboost11_lvalue_type_caster : public pyboost11_type_caster<type>
+{
+    bool load(handle src, bool convert)
+    {
+        if (!src)
+        {
+            return false;
+        }
+
+        if (type* held = pyboost11_get_lvalue<type>(src))
+        {
+            this->value = *held;
+            return true;
+        }
+
+        return pyboost11_type_caster<type>::load(src, convert);
+    }
+};
+
+#define USDEX_LVALUE_TYPE_CASTER(type, py_name) \
+    template <> \
+    struct type_caster<type> : public pyboost11_lvalue_type_caster<type> \
+    { \
+        /** Label for the python object to be used in traceback logs and typing hints */ \
+        static constexpr auto name = py_name; \
+    }
+
+//! A caster for `TfToken`, which constructs tokens directly from Python strings.
+//!
+//! Strings are by far the most common argument, so they are converted without the OpenUSD conversion registry.
+//! Bound `TfToken` objects are unwrapped directly, and any other object falls back to the OpenUSD conversions.
+struct tftoken_type_caster : public pyboost11_lvalue_type_caster<pxr::TfToken>
+{
+    bool load(handle src, bool convert)
+    {
+        if (src && PyUnicode_Check(src.ptr()))
+        {
+            Py_ssize_t size = 0;
+            const char* data = PyUnicode_AsUTF8AndSize(src.ptr(), &size);
+            if (data == nullptr)
+            {
+                PyErr_Clear();
+                return false;
+            }
+            this->value = pxr::TfToken(std::string(data, static_cast<size_t>(size)));
+            return true;
+        }
+
+        return pyboost11_lvalue_type_caster<pxr::TfToken>::load(src, convert);
+    }
+};
+
+//! A caster for `TfTokenVector`, which constructs the tokens directly from a Python list or tuple of strings.
+//!
+//! Any other object (e.g. a `Vt.TokenArray` or a generator) falls back to the OpenUSD conversions.
+struct tftokenvector_type_caster : public pyboost11_type_caster<pxr::TfTokenVector>
+{
+    bool load(handle src, bool convert)
+    {
+        if (src && (PyList_Check(src.ptr()) || PyTuple_Check(src.ptr())))
+        {
+            PyObject* sequence = src.ptr();
+            const Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+            PyObject** items = PySequence_Fast_ITEMS(sequence);
+            pxr::TfTokenVector result;
+            result.reserve(static_cast<size_t>(size));
+            bool strings = true;
+            for (Py_ssize_t i = 0; i < size; ++i)
+            {
+                Py_ssize_t length = 0;
+                const char* data = PyUnicode_Check(items[i]) ? PyUnicode_AsUTF8AndSize(items[i], &length) : nullptr;
+                if (data == nullptr)
+                {
+                    PyErr_Clear();
+                    strings = false;
+                    break;
+                }
+                result.emplace_back(std::string(data, static_cast<size_t>(length)));
+            }
+            if (strings)
+            {
+                this->value = std::move(result);
+                return true;
+            }
+        }
+
+        return pyboost11_type_caster<pxr::TfTokenVector>::load(src, convert);
+    }
+};
+
+//! Describes how the elements of a numeric `VtArray` are laid out in a Python buffer.
+//!
+//! Each element is made up of `numComponents` scalars of type `Scalar`. Matrix elements are `numRows` rows of `numComponents / numRows`
+//! scalars, while all other elements have a single row.
+template <typename T>
+struct vtarray_buffer_traits;
+
+template <>
+struct vtarray_buffer_traits<float>
+{
+    using Scalar = float;
+    static constexpr size_t numComponents = 1;
+    static constexpr size_t numRows = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<int>
+{
+    using Scalar = int;
+    static constexpr size_t numComponents = 1;
+    static constexpr size_t numRows = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<int64_t>
+{
+    using Scalar = int64_t;
+    static constexpr size_t numComponents = 1;
+    static constexpr size_t numRows = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<pxr::GfVec2f>
+{
+    using Scalar = float;
+    static constexpr size_t numComponents = 2;
+    static constexpr size_t numRows = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<pxr::GfVec3f>
+{
+    using Scalar = float;
+    static constexpr size_t numComponents = 3;
+    static constexpr size_t numRows = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<pxr::GfVec3d>
+{
+    using Scalar = double;
+    static constexpr size_t numComponents = 3;
+    static constexpr size_t numRows = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<pxr::GfMatrix4d>
+{
+    using Scalar = double;
+    static constexpr size_t numComponents = 16;
+    static constexpr size_t numRows = 4;
+};
+
+//! Keeps a Python buffer alive for as long as a `VtArray` references its memory.
+//!
+//! The buffer is released, with the GIL held, when the last `VtArray` sharing the data is destroyed or detaches.
+class vtarray_buffer_source : public pxr::Vt_ArrayForeignDataSource
+{
+public:
+
+    explicit vtarray_buffer_source(const Py_buffer& view) : pxr::Vt_ArrayForeignDataSource(&vtarray_buffer_source::release), m_view(view)
+    {
+    }
+
+private:
+
+    static void release(pxr::Vt_ArrayForeignDataSource* source)
+    {
+        vtarray_buffer_source* self = static_cast<vtarray_buffer_source*>(source);
+        // The array may outlive the interpreter (e.g. when held by a layer), in which case the buffer can no longer be released
+        if (Py_IsInitialized())
+        {
+            PyGILState_STATE state = PyGILState_Ensure();
+            PyBuffer_Release(&self->m_view);
+            PyGILState_Release(state);
+        }
+        delete self;
+    }
+
+    Py_buffer m_view;
+};
+
+//! The kind of scalar described by a Python buffer format string.
+enum class vtarray_buffer_kind
+{
+    invalid,
+    floating,
+    signedInteger,
+    unsignedInteger
+};
+
+//! Determine the kind of scalar described by a native byte order, single scalar, buffer format string.
+inline vtarray_buffer_kind vtarray_buffer_format_kind(const char* format)
+{
+    if (format == nullptr)
+    {
+        // A null format implies unsigned bytes
+        return vtarray_buffer_kind::unsignedInteger;
+    }
+
+    // Only native byte order is supported
+    if (format[0] == '@' || format[0] == '=' || (format[0] == '<' && PY_LITTLE_ENDIAN) || (format[0] == '>' && !PY_LITTLE_ENDIAN))
+    {
+        ++format;
+    }
+    if (format[0] == '\0' || format[1] != '\0')
+    {
+        return vtarray_buffer_kind::invalid;
+    }
+
+    switch (format[0])
+    {
+        case 'f':
+        case 'd': return vtarray_buffer_kind::floating;
+        case 'b':
+        case 'h':
+        case 'i':
+        case 'l':
+        case 'q':
+        case 'n': return vtarray_buffer_kind::signedInteger;
+        case 'B':
+        case 'H':
+        case 'I':
+        case 'L':
+        case 'Q':
+        case 'N': return vtarray_buffer_kind::unsignedInteger;
+        default: return vtarray_buffer_kind::invalid;
+    }
+}
+
+//! Read a single scalar of the given kind and size from a buffer, converting it to the requested type.
+template <typename Scalar>
+Scalar vtarray_buffer_read(const char* ptr, vtarray_buffer_kind kind, Py_ssize_t itemsize)
+{
+    switch (kind)
+    {
+        case vtarray_buffer_kind::floating:
+        {
+            if (itemsize == sizeof(float))
+            {
+                float value;
+                std::memcpy(&value, ptr, sizeof(float));
+                return static_cast<Scalar>(value);
+            }
+            double value;
+            std::memcpy(&value, ptr, sizeof(double));
+            return static_cast<Scalar>(value);
+        }
+        case vtarray_buffer_kind::signedInteger:
+        {
+            int64_t value = 0;
+            switch (itemsize)
+            {
+                case 1: value = *reinterpret_cast<const int8_t*>(ptr); break;
+                case 2: value = *reinterpret_cast<const int16_t*>(ptr); break;
+                case 4: value = *reinterpret_cast<const int32_t*>(ptr); break;
+                default: value = *reinterpret_cast<const int64_t*>(ptr); break;
+            }
+            return static_cast<Scalar>(value);
+        }
+        default:
+        {
+            uint64_t value = 0;
+            switch (itemsize)
+            {
+                case 1: value = *reinterpret_cast<const uint8_t*>(ptr); break;
+                case 2: value = *reinterpret_cast<const uint16_t*>(ptr); break;
+                case 4: value = *reinterpret_cast<const uint32_t*>(ptr); break;
+                default: value = *reinterpret_cast<const uint64_t*>(ptr); break;
+            }
+            return static_cast<Scalar>(value);
+        }
+    }
+}
+
+//! Load a numeric `VtArray` from any Python object supporting the buffer protocol (e.g. a NumPy array or a `memoryview`).
+//!
+//! Scalar arrays require a one dimensional buffer, vector arrays require a two dimensional buffer with one row per element (e.g. a NumPy
+//! array with shape `(N, 3)` for a `VtVec3fArray`), and matrix arrays require a three dimensional buffer (e.g. shape `(N, 4, 4)` for a
+//! `VtMatrix4dArray`).
+//!
+//! - Read-only, C-contiguous buffers which exactly match the scalar type are wrapped without copying. The buffer is kept alive until the last
+//!   `VtArray` referencing it is destroyed, and any attempt to modify the array in C++ will detach it into a private copy.
+//! - Writable buffers which exactly match the scalar type are copied in bulk, so that later modifications of the Python object cannot
+//!   affect the authored data.
+//! - Other buffers are converted element by element, but only if implicit conversion is allowed by `convert`. This supports
+//!   strided views, and any floating point or integer scalar type (e.g. `float64` points).
+//!
+//! @returns False if the object does not support the buffer protocol or the buffer does not describe the array type.
+template <typename T>
+bool vtarray_load_from_buffer(handle src, bool convert, pxr::VtArray<T>& result)
+{
+    using Traits = vtarray_buffer_traits<T>;
+    using Scalar = typename Traits::Scalar;
+    constexpr size_t numComponents = Traits::numComponents;
+    constexpr size_t numRows = Traits::numRows;
+    constexpr size_t numColumns = numComponents / numRows;
+    constexpr int expectedDims = (numComponents == 1) ? 1 : ((numRows == 1) ? 2 : 3);
+
+    if (!PyObject_CheckBuffer(src.ptr()))
+    {
+        return false;
+    }
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(src.ptr(), &view, PyBUF_RECORDS_RO) != 0)
+    {
+        PyErr_Clear();
+        return false;
+    }
+
+    // Validate the shape and scalar type of the buffer
+    const vtarray_buffer_kind kind = vtarray_buffer_format_kind(view.format);
+    const size_t numElements = (view.ndim > 0) ? static_cast<size_t>(view.shape[0]) : 0;
+    bool validShape = (view.ndim == expectedDims);
+    if (validShape && expectedDims == 2)
+    {
+        validShape = static_cast<size_t>(view.shape[1]) == numComponents;
+    }
+    else if (validShape && expectedDims == 3)
+    {
+        validShape = static_cast<size_t>(view.shape[1]) == numRows && static_cast<size_t>(view.shape[2]) == numColumns;
+    }
+    const bool validKind = (kind == vtarray_buffer_kind::floating) ? (view.itemsize == 4 || view.itemsize == 8)
+                                                                   : (kind != vtarray_buffer_kind::invalid && view.itemsize <= 8);
+    if (!validShape || !validKind)
+    {
+        PyBuffer_Release(&view);
+        return false;
+    }
+
+    constexpr vtarray_buffer_kind scalarKind = std::is_floating_point_v<Scalar> ? vtarray_buffer_kind::floating
+                                                                                : vtarray_buffer_kind::signedInteger;
+    const bool exactType = (kind == scalarKind) && (view.itemsize == sizeof(Scalar));
+    const bool contiguous = PyBuffer_IsContiguous(&view, 'C') != 0;
+    const bool aligned = (reinterpret_cast<uintptr_t>(view.buf) % alignof(T)) == 0;
+
+    // Wrap read-only buffers without copying
+    if (exactType && contiguous && aligned && view.readonly && numElements > 0)
+    {
+        vtarray_buffer_source* source = new vtarray_buffer_source(view);
+        result = pxr::VtArray<T>(source, static_cast<T*>(view.buf), numElements);
+        return true;
+    }
+
+    // Copy writable buffers in bulk
+    if (exactType && contiguous)
+    {
+        result = pxr::VtArray<T>(numElements);
+        if (numElements > 0)
+        {
+            std::memcpy(static_cast<void*>(result.data()), view.buf, numElements * sizeof(T));
+        }
+        PyBuffer_Release(&view);
+        return true;
+    }
+
+    // Convert any other layout element by element
+    if (!convert)
+    {
+        PyBuffer_Release(&view);
+        return false;
+    }
+
+    result = pxr::VtArray<T>(numElements);
+    Scalar* data = reinterpret_cast<Scalar*>(result.data());
+    const char* buf = static_cast<const char*>(view.buf);
+    const Py_ssize_t elementStride = view.strides[0];
+    const Py_ssize_t rowStride = (expectedDims == 3) ? view.strides[1] : 0;
+    const Py_ssize_t columnStride = (expectedDims == 1) ? 0 : view.strides[expectedDims - 1];
+    for (size_t i = 0; i < numElements; ++i)
+    {
+        for (size_t c = 0; c < numComponents; ++c)
+        {
+            const Py_ssize_t row = static_cast<Py_ssize_t>(c / numColumns);
+            const Py_ssize_t column = static_cast<Py_ssize_t>(c % numColumns);
+            const char* ptr = buf + static_cast<Py_ssize_t>(i) * elementStride + row * rowStride + column * columnStride;
+            data[i * numComponents + c] = vtarray_buffer_read<Scalar>(ptr, kind, view.itemsize);
+        }
+    }
+    PyBuffer_Release(&view);
+    return true;
+}
+
+//! A caster for numeric `VtArray` types, which accepts OpenUSD bound arrays, objects supporting the Python buffer protocol, and any other
+//! object which OpenUSD can convert (e.g. a list of values).
+//!
+//! OpenUSD bound arrays are shared with the Python object without copying. See `vtarray_load_from_buffer` for details of buffer conversion.
+template <typename T>
+struct vtarray_type_caster : public pyboost11_type_caster<pxr::VtArray<T>>
+{
+    bool load(handle src, bool convert)
+    {
+        if (!src)
+        {
+            return false;
+        }
+
+        // OpenUSD bound arrays share their buffer with the loaded value. These are checked first, as they also support the buffer protocol.
+        if (pxr::VtArray<T>* array = pyboost11_get_lvalue<pxr::VtArray<T>>(src))
+        {
+            this->value = *array;
+            return true;
+        }
+
+        // Buffers are loaded directly, rather than being converted as a generic python sequence
+        if (vtarray_load_from_buffer<T>(src, convert, this->value))
+        {
+            return true;
+        }
+
+        // Fall back to the OpenUSD conversions (e.g. from a list of values)
+        return pyboost11_type_caster<pxr::VtArray<T>>::load(src, convert);
+    }
+};
+
+#define USDEX_VTARRAY_TYPE_CASTER(elementType, py_name) \
+    template <> \
+    struct type_caster<pxr::VtArray<elementType>> : public vtarray_type_caster<elementType> \
+    { \
+        /** Label for the python object to be used in traceback logs and typing hints */ \
+        static constexpr auto name = py_name; \
+    }
+
 //! pybind11 interoperability for `GfCamera`
 PYBOOST11_TYPE_CASTER(pxr::GfCamera, _("pxr.Gf.Camera"));
 //! pybind11 interoperability for `GfQuatd`
@@ -91,7 +550,7 @@ PYBOOST11_TYPE_CASTER(pxr::SdfAssetPath, _("pxr.Sdf.AssetPath"));
 //! pybind11 interoperability for `SdfLayerHandle`
 PYBOOST11_TYPE_CASTER(pxr::SdfLayerHandle, _("pxr.Sdf.Layer"));
 //! pybind11 interoperability for `SdfPath`
-PYBOOST11_TYPE_CASTER(pxr::SdfPath, _("pxr.Sdf.Path"));
+USDEX_LVALUE_TYPE_CASTER(pxr::SdfPath, _("pxr.Sdf.Path"));
 //! pybind11 interoperability for `SdfValueTypeNames`
 PYBOOST11_TYPE_CASTER(pxr::SdfValueTypeName, _("pxr.Sdf.ValueTypeName"));
 //! pybind11 interoperability for `SdfPrimSpecHandle`
@@ -99,11 +558,21 @@ PYBOOST11_TYPE_CASTER(pxr::SdfPrimSpecHandle, _("pxr.Sdf.PrimSpec"));
 //! pybind11 interoperability for `TfToken`
 //!
 //! Note we want to inform python clients that regular python strings are the expected value type, not `TfToken`
-PYBOOST11_TYPE_CASTER(pxr::TfToken, _("str"));
+template <>
+struct type_caster<pxr::TfToken> : public tftoken_type_caster
+{
+    /** Label for the python object to be used in traceback logs and typing hints */
+    static constexpr auto name = _("str");
+};
 //! pybind11 interoperability for `TfTokenVector`
 //!
 //! Note we want to inform python clients that regular python a list of strings are the expected value type
-PYBOOST11_TYPE_CASTER(pxr::TfTokenVector, _("list(str)"));
+template <>
+struct type_caster<pxr::TfTokenVector> : public tftokenvector_type_caster
+{
+    /** Label for the python object to be used in traceback logs and typing hints */
+    static constexpr auto name = _("list(str)");
+};
 //! pybind11 interoperability for `UsdAttribute`
 PYBOOST11_TYPE_CASTER(pxr::UsdAttribute, _("pxr.Usd.Attribute"));
 //! pybind11 interoperability for `UsdGeomBasisCurves`
@@ -112,12 +581,16 @@ PYBOOST11_TYPE_CASTER(pxr::UsdGeomBasisCurves, _("pxr.UsdGeom.BasisCurves"));
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomCamera, _("pxr.UsdGeom.Camera"));
 //! pybind11 interoperability for `UsdGeomMesh`
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomMesh, _("pxr.UsdGeom.Mesh"));
+//! pybind11 interoperability for `UsdGeomPointInstancer`
+PYBOOST11_TYPE_CASTER(pxr::UsdGeomPointInstancer, _("pxr.UsdGeom.PointInstancer"));
 //! pybind11 interoperability for `UsdGeomPoints`
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomPoints, _("pxr.UsdGeom.Points"));
 //! pybind11 interoperability for `UsdGeomPrimvar`
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomPrimvar, _("pxr.UsdGeom.Primvar"));
 //! pybind11 interoperability for `UsdGeomScope`
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomScope, _("pxr.UsdGeom.Scope"));
+//! pybind11 interoperability for `UsdGeomSubset`
+PYBOOST11_TYPE_CASTER(pxr::UsdGeomSubset, _("pxr.UsdGeom.Subset"));
 //! pybind11 interoperability for `UsdGeomXform`
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomXform, _("pxr.UsdGeom.Xform"));
 //! pybind11 interoperability for `UsdGeomXformable`
@@ -139,26 +612,40 @@ PYBOOST11_TYPE_CASTER(pxr::UsdLuxRectLight, _("pxr.UsdLux.RectLight"));
 PYBOOST11_TYPE_CASTER(pxr::UsdLuxSphereLight, _("pxr.UsdLux.SphereLight"));
 //! pybind11 interoperability for `UsdLuxShapingAPI`
 PYBOOST11_TYPE_CASTER(pxr::UsdLuxShapingAPI, _("pxr.UsdLux.ShapingAPI"));
+//! pybind11 interoperability for `UsdEditTarget`
+PYBOOST11_TYPE_CASTER(pxr::UsdEditTarget, _("pxr.Usd.EditTarget"));
 //! pybind11 interoperability for `UsdPrim`
 PYBOOST11_TYPE_CASTER(pxr::UsdPrim, _("pxr.Usd.Prim"));
+//! pybind11 interoperability for `UsdPrimRange`
+PYBOOST11_TYPE_CASTER(pxr::UsdPrimRange, _("pxr.Usd.PrimRange"));
 //! pybind11 interoperability for `UsdStagePtr`
 PYBOOST11_TYPE_CASTER(pxr::UsdStagePtr, _("pxr.Usd.Stage"));
 //! pybind11 interoperability for `UsdTimeCode`
 PYBOOST11_TYPE_CASTER(pxr::UsdTimeCode, _("pxr.Usd.TimeCode"));
-//! pybind11 interoperability for `VtFloatArray`
-PYBOOST11_TYPE_CASTER(pxr::VtFloatArray, _("pxr.Vt.FloatArray"));
-//! pybind11 interoperability for `VtIntArray`
-PYBOOST11_TYPE_CASTER(pxr::VtIntArray, _("pxr.Vt.IntArray"));
-//! pybind11 interoperability for `VtInt64Array`
-PYBOOST11_TYPE_CASTER(pxr::VtInt64Array, _("pxr.Vt.Int64Array"));
+//! pybind11 interoperability for `VtFloatArray`, which also accepts objects supporting the Python buffer protocol
+USDEX_VTARRAY_TYPE_CASTER(float, _("pxr.Vt.FloatArray"));
+//! pybind11 interoperability for `VtIntArray`, which also accepts objects supporting the Python buffer protocol
+USDEX_VTARRAY_TYPE_CASTER(int, _("pxr.Vt.IntArray"));
+//! pybind11 interoperability for `VtInt64Array`, which also accepts objects supporting the Python buffer protocol
+USDEX_VTARRAY_TYPE_CASTER(int64_t, _("pxr.Vt.Int64Array"));
+//! pybind11 interoperability for `VtDictionary`
+PYBOOST11_TYPE_CASTER(pxr::VtDictionary, _("dict"));
+//! pybind11 interoperability for `VtMatrix4dArray`, which also accepts objects supporting the Python buffer protocol
+USDEX_VTARRAY_TYPE_CASTER(pxr::GfMatrix4d, _("pxr.Vt.Matrix4dArray"));
+//! pybind11 interoperability for `VtQuatfArray`
+USDEX_LVALUE_TYPE_CASTER(pxr::VtQuatfArray, _("pxr.Vt.QuatfArray"));
+//! pybind11 interoperability for `VtQuathArray`
+USDEX_LVALUE_TYPE_CASTER(pxr::VtQuathArray, _("pxr.Vt.QuathArray"));
 //! pybind11 interoperability for `VtStringArray`
-PYBOOST11_TYPE_CASTER(pxr::VtStringArray, _("pxr.Vt.StringArray"));
+USDEX_LVALUE_TYPE_CASTER(pxr::VtStringArray, _("pxr.Vt.StringArray"));
 //! pybind11 interoperability for `VtTokenArray`
-PYBOOST11_TYPE_CASTER(pxr::VtTokenArray, _("pxr.Vt.TokenArray"));
-//! pybind11 interoperability for `VtVec3fArray`
-PYBOOST11_TYPE_CASTER(pxr::VtVec3fArray, _("pxr.Vt.Vec3fArray"));
-//! pybind11 interoperability for `VtVec2fArray`
-PYBOOST11_TYPE_CASTER(pxr::VtVec2fArray, _("pxr.Vt.Vec2fArray"));
+USDEX_LVALUE_TYPE_CASTER(pxr::VtTokenArray, _("pxr.Vt.TokenArray"));
+//! pybind11 interoperability for `VtVec3dArray`, which also accepts objects supporting the Python buffer protocol
+USDEX_VTARRAY_TYPE_CASTER(pxr::GfVec3d, _("pxr.Vt.Vec3dArray"));
+//! pybind11 interoperability for `VtVec3fArray`, which also accepts objects supporting the Python buffer protocol
+USDEX_VTARRAY_TYPE_CASTER(pxr::GfVec3f, _("pxr.Vt.Vec3fArray"));
+//! pybind11 interoperability for `VtVec2fArray`, which also accepts objects supporting the Python buffer protocol
+USDEX_VTARRAY_TYPE_CASTER(pxr::GfVec2f, _("pxr.Vt.Vec2fArray"));
 //! pybind11 interoperability for `UsdShadeInput`
 PYBOOST11_TYPE_CASTER(pxr::UsdShadeInput, _("pxr.UsdShade.Input"));
 //! pybind11 interoperability for `UsdShadeMaterial`
@@ -14,6 +14,7 @@
 #include <pxr/usd/usdShade/shader.h>
 
 #include <optional>
+#include <vector>
 
 //! @file usdex/rtx/MaterialAlgo.h
 //! @brief Material and Shader Prims for use with the RTX Renderer
@@ -95,6 +96,9 @@ USDEX_RTX_API pxr::UsdShadeInput createMdlShaderInput(
 
 //! Get the effective surface Shader of a Material for the MDL render context.
 //!
+//! @note The connections are traversed on every call. Use a `usdex::core::SurfaceShaderCache` for the "mdl" render context when querying many
+//! Materials, or the same Material repeatedly.
+//!
 //! @param material The Material to consider
 //! @returns The connected Shader. Returns an invalid object on error.
 USDEX_RTX_API pxr::UsdShadeShader computeEffectiveMdlSurfaceShader(const pxr::UsdShadeMaterial& material);
@@ -169,6 +173,79 @@ USDEX_RTX_API pxr::UsdShadeMaterial definePbrMaterial(
     const float metallic = 0.0f
 );
 
+//! Defines an abstract PBR `UsdShadeMaterial` prototype, from which many PBR materials can be specialized using `specializePbrMaterial()`.
+//!
+//! The prototype is a `class` prim holding the complete network of `definePbrMaterial()`, including the MDL source asset and every shader
+//! input, authored with the default values of the Material interface. It is intended to be defined once per stage (e.g. in the "Materials"
+//! scope of an asset), so that each material specializing it only needs to author the interface inputs which differ from the prototype.
+//!
+//! @note The prototype should be defined within the default prim of the stage, so that it remains available when the stage is referenced.
+//!
+//! @param stage The stage on which to define the prototype
+//! @param path The absolute prim path at which to define the prototype
+//! @returns The newly defined `UsdShadeMaterial` prototype. Returns an Invalid prim on error
+USDEX_RTX_API pxr::UsdShadeMaterial definePbrMaterialPrototype(pxr::UsdStagePtr stage, const pxr::SdfPath& path);
+
+//! Defines an abstract PBR `UsdShadeMaterial` prototype, from which many PBR materials can be specialized using `specializePbrMaterial()`.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! @param parent Prim below which to define the prototype
+//! @param name Name of the prototype
+//! @returns The newly defined `UsdShadeMaterial` prototype. Returns an Invalid prim on error
+USDEX_RTX_API pxr::UsdShadeMaterial definePbrMaterialPrototype(pxr::UsdPrim parent, const std::string& name);
+
+//! Defines a PBR `UsdShadeMaterial` which specializes a prototype defined by `definePbrMaterialPrototype()`.
+//!
+//! The resulting Material is equivalent to one defined by `definePbrMaterial()`, but its shader networks are composed from the prototype.
+//! Only the "Interface" `UsdShadeInputs` whose values differ from the prototype are authored on the Material, along with the MDL shader inputs
+//! required to enable opacity. The `add*TextureToPbrMaterial` functions can be used on the resulting Material.
+//!
+//! @note Any interface input which is replaced by a texture remains on the Material, as the input is authored on the prototype, but it is
+//! disconnected from both render contexts.
+//!
+//! @param prototype The prototype to specialize. It must be on the same stage as the Material.
+//! @param stage The stage on which to define the Material
+//! @param path The absolute prim path at which to define the Material
+//! @param color The diffuse color of the Material
+//! @param opacity The Opacity Amount to set, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible.
+//! Enable Opacity will be set to true and Fractional Opacity will be enabled in the RT renderer.
+//! @param roughness The Roughness Amount to set, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy
+//! @param metallic The Metallic Amount to set, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic
+//! @returns The newly defined `UsdShadeMaterial`. Returns an Invalid prim on error
+USDEX_RTX_API pxr::UsdShadeMaterial specializePbrMaterial(
+    const pxr::UsdShadeMaterial& prototype,
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const pxr::GfVec3f& color,
+    const float opacity = 1.0f,
+    const float roughness = 0.5f,
+    const float metallic = 0.0f
+);
+
+//! Defines a PBR `UsdShadeMaterial` which specializes a prototype defined by `definePbrMaterialPrototype()`.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! @param prototype The prototype to specialize. It must be on the same stage as the Material.
+//! @param parent Prim below which to define the Material
+//! @param name Name of the Material
+//! @param color The diffuse color of the Material
+//! @param opacity The Opacity Amount to set, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible.
+//! Enable Opacity will be set to true and Fractional Opacity will be enabled in the RT renderer.
+//! @param roughness The Roughness Amount to set, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy
+//! @param metallic The Metallic Amount to set, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic
+//! @returns The newly defined `UsdShadeMaterial`. Returns an Invalid prim on error
+USDEX_RTX_API pxr::UsdShadeMaterial specializePbrMaterial(
+    const pxr::UsdShadeMaterial& prototype,
+    pxr::UsdPrim parent,
+    const std::string& name,
+    const pxr::GfVec3f& color,
+    const float opacity = 1.0f,
+    const float roughness = 0.5f,
+    const float metallic = 0.0f
+);
+
 //! Adds a diffuse texture to the PBR material
 //!
 //! It is expected that the material was created by `usdex::rtx::definePbrMaterial()`.
@@ -243,6 +320,30 @@ USDEX_RTX_API bool addMetallicTextureToPbrMaterial(pxr::UsdShadeMaterial& materi
 //! @returns Whether or not the texture was added to the material
 USDEX_RTX_API bool addOpacityTextureToPbrMaterial(pxr::UsdShadeMaterial& material, const pxr::SdfAssetPath& texturePath);
 
+//! Adds an OmniPBR MDL shader to each preview material, reproducing the values and textures of its USD Preview Surface shader.
+//!
+//! This is intended for materials defined by `usdex::core::definePreviewMaterial()` and its associated `add*Texture` functions, so that the
+//! materials drive an RTX render context as well as the universal render context. The USD Preview Surface network of each material is left
+//! unchanged, and no Material interface is added, so the MDL shader inputs are set directly.
+//!
+//! The textures and fallback values are mapped as by the `add*TextureToPbrMaterial` functions. All of the materials are read concurrently, and
+//! then all of the MDL shaders are authored directly to the edit target layer with a single round of change processing.
+//!
+//! @note Materials which do not have a USD Preview Surface shader, or which already have an MDL surface shader, are not modified.
+//!
+//! @param materials The preview materials to add MDL shaders to
+//! @returns Whether an MDL shader was added to every material
+USDEX_RTX_API bool addPbrShadersToPreviewMaterials(const std::vector<pxr::UsdShadeMaterial>& materials);
+
+//! Adds an OmniPBR MDL shader to every preview material on the stage, reproducing the values and textures of its USD Preview Surface shader.
+//!
+//! This behaves as the overload above for all of the `UsdShadeMaterial` prims on the stage. Materials which do not have a USD Preview Surface
+//! shader, or which already have an MDL surface shader, are skipped without reporting a diagnostic.
+//!
+//! @param stage The stage containing the preview materials
+//! @returns Whether an MDL shader was added to every preview material which did not already have one
+USDEX_RTX_API bool addPbrShadersToPreviewMaterials(pxr::UsdStagePtr stage);
+
 //! Defines a Glass `UsdShadeMaterial` interface that drives both an RTX render context and the universal render context.
 //!
 //! The resulting Material prim will have "Interface" `UsdShadeInputs` which drive both render contexts. See @ref rtx_materials for details.
@@ -0,0 +1,320 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/test/MemoryTracker.h
+//! @brief A tracking allocator and a scoped class to measure the peak heap usage of authoring calls in test suites.
+
+#include <pxr/base/arch/defines.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if defined(ARCH_OS_WINDOWS)
+#include <malloc.h>
+#elif defined(ARCH_OS_DARWIN)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace usdex::test
+{
+
+//! @addtogroup doctest
+//! @{
+
+namespace detail
+{
+
+//! The process wide allocation counters updated by the tracking allocator.
+struct AllocationCounters
+{
+    std::atomic<int64_t> currentBytes{ 0 };
+    std::atomic<int64_t> peakBytes{ 0 };
+    std::atomic<uint64_t> allocations{ 0 };
+    std::atomic<bool> installed{ false };
+};
+
+inline AllocationCounters& getAllocationCounters()
+{
+    // Constant initialized, so it is safe to use from the first allocation of the process
+    static AllocationCounters s_counters;
+    return s_counters;
+}
+
+inline void recordAllocation(size_t bytes)
+{
+    AllocationCounters& counters = getAllocationCounters();
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    const int64_t current = counters.currentBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) + static_cast<int64_t>(bytes);
+    int64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (current > peak && !counters.peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+    {
+    }
+}
+
+inline void recordDeallocation(size_t bytes)
+{
+    getAllocationCounters().currentBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+}
+
+// The allocation sizes are queried from the system allocator rather than stored in a header, so that memory which was allocated before the
+// tracking allocator was in use (or by another module on Windows) can still be released safely.
+inline size_t allocatedSize(void* ptr)
+{
+#if defined(ARCH_OS_WINDOWS)
+    return _msize(ptr);
+#elif defined(ARCH_OS_DARWIN)
+    return malloc_size(ptr);
+#else
+    return malloc_usable_size(ptr);
+#endif
+}
+
+inline void* trackedAllocate(size_t size) noexcept
+{
+    void* ptr = std::malloc(size ? size : 1);
+    if (ptr)
+    {
+        recordAllocation(allocatedSize(ptr));
+    }
+    return ptr;
+}
+
+inline void trackedDeallocate(void* ptr) noexcept
+{
+    if (ptr)
+    {
+        recordDeallocation(allocatedSize(ptr));
+        std::free(ptr);
+    }
+}
+
+inline void* trackedAlignedAllocate(size_t size, std::align_val_t alignment) noexcept
+{
+    const size_t align = static_cast<size_t>(alignment);
+    size = size ? size : 1;
+#if defined(ARCH_OS_WINDOWS)
+    void* ptr = _aligned_malloc(size, align);
+    if (ptr)
+    {
+        recordAllocation(_aligned_msize(ptr, align, 0));
+    }
+#else
+    // aligned_alloc requires the size to be a multiple of the alignment
+    void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align);
+    if (ptr)
+    {
+        recordAllocation(allocatedSize(ptr));
+    }
+#endif
+    return ptr;
+}
+
+inline void trackedAlignedDeallocate(void* ptr, std::align_val_t alignment) noexcept
+{
+    if (!ptr)
+    {
+        return;
+    }
+#if defined(ARCH_OS_WINDOWS)
+    recordDeallocation(_aligned_msize(ptr, static_cast<size_t>(alignment), 0));
+    _aligned_free(ptr);
+#else
+    (void)alignment;
+    recordDeallocation(allocatedSize(ptr));
+    std::free(ptr);
+#endif
+}
+
+} // namespace detail
+
+//! A scoped class to measure the heap usage of the calls made during its lifetime.
+//!
+//! The measurements require the tracking allocator, which replaces the global `operator new` and `operator delete` of the executable. Use
+//! `USDEX_TEST_DEFINE_TRACKING_ALLOCATOR()` at global scope in exactly one source file of the test executable to install it.
+//!
+//! The tracking allocator observes every C++ heap allocation of the process, including `VtArray` buffers, so the peak includes any transient
+//! copies of the vertex data made while authoring (e.g. `PrimvarData` copies or `VtArray` detaches). Allocations made directly with `malloc`
+//! are not observed. On Windows only the allocations made by the test executable itself are observed, including those made by inline functions
+//! and templates of other libraries.
+//!
+//! The counters are process wide, so allocations made by worker threads on behalf of the measured calls are included. This also means that
+//! calls made concurrently from other threads will be included, so measured calls should be made serially.
+//!
+//! Trackers may be nested within each other on the same thread.
+//!
+//! Example:
+//!
+//!     #include <usdex/test/MemoryTracker.h>
+//!
+//!     USDEX_TEST_DEFINE_TRACKING_ALLOCATOR();
+//!
+//!     TEST_CASE("My Test Case")
+//!     {
+//!         usdex::test::ScopedMemoryTracker tracker;
+//!         usdex::core::definePointCloud(stage, path, points);
+//!         CHECK(tracker.getPeakBytes() < points.size() * sizeof(GfVec3f));
+//!     }
+class ScopedMemoryTracker
+{
+
+public:
+
+    //! Begin measuring from the current heap usage of the process.
+    ScopedMemoryTracker()
+    {
+        detail::AllocationCounters& counters = detail::getAllocationCounters();
+        m_baselineBytes = counters.currentBytes.load(std::memory_order_relaxed);
+        m_baselineAllocations = counters.allocations.load(std::memory_order_relaxed);
+        m_previousPeakBytes = counters.peakBytes.exchange(m_baselineBytes, std::memory_order_relaxed);
+    }
+
+    //! Restore the peak measured by any enclosing tracker.
+    ~ScopedMemoryTracker()
+    {
+        detail::AllocationCounters& counters = detail::getAllocationCounters();
+        int64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+        while (m_previousPeakBytes > peak && !counters.peakBytes.compare_exchange_weak(peak, m_previousPeakBytes, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    ScopedMemoryTracker(const ScopedMemoryTracker&) = delete;
+    ScopedMemoryTracker& operator=(const ScopedMemoryTracker&) = delete;
+
+    //! Return the highest number of bytes allocated at any point since construction, relative to the heap usage at construction.
+    int64_t getPeakBytes() const
+    {
+        return detail::getAllocationCounters().peakBytes.load(std::memory_order_relaxed) - m_baselineBytes;
+    }
+
+    //! Return the number of bytes allocated since construction which have not yet been released.
+    int64_t getRetainedBytes() const
+    {
+        return detail::getAllocationCounters().currentBytes.load(std::memory_order_relaxed) - m_baselineBytes;
+    }
+
+    //! Return the number of allocations made since construction.
+    uint64_t getAllocations() const
+    {
+        return detail::getAllocationCounters().allocations.load(std::memory_order_relaxed) - m_baselineAllocations;
+    }
+
+    //! Return true if `USDEX_TEST_DEFINE_TRACKING_ALLOCATOR()` has installed the tracking allocator, and false if no measurements are possible.
+    static bool isTrackingAllocatorInstalled()
+    {
+        return detail::getAllocationCounters().installed.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    int64_t m_baselineBytes;
+    int64_t m_previousPeakBytes;
+    uint64_t m_baselineAllocations;
+};
+
+//! @}
+
+} // namespace usdex::test
+
+//! Replace the global `operator new` and `operator delete` of the executable with the tracking allocator used by `ScopedMemoryTracker`.
+//!
+//! This must be used at global scope in exactly one source file of the executable.
+#define USDEX_TEST_DEFINE_TRACKING_ALLOCATOR() \
+    void* operator new(std::size_t size) \
+    { \
+        if (void* ptr = usdex::test::detail::trackedAllocate(size)) \
+        { \
+            return ptr; \
+        } \
+        throw std::bad_alloc(); \
+    } \
+    void* operator new[](std::size_t size) \
+    { \
+        return operator new(size); \
+    } \
+    void* operator new(std::size_t size, const std::nothrow_t&) noexcept \
+    { \
+        return usdex::test::detail::trackedAllocate(size); \
+    } \
+    void* operator new[](std::size_t size, const std::nothrow_t&) noexcept \
+    { \
+        return usdex::test::detail::trackedAllocate(size); \
+    } \
+    void* operator new(std::size_t size, std::align_val_t alignment) \
+    { \
+        if (void* ptr = usdex::test::detail::trackedAlignedAllocate(size, alignment)) \
+        { \
+            return ptr; \
+        } \
+        throw std::bad_alloc(); \
+    } \
+    void* operator new[](std::size_t size, std::align_val_t alignment) \
+    { \
+        return operator new(size, alignment); \
+    } \
+    void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept \
+    { \
+        return usdex::test::detail::trackedAlignedAllocate(size, alignment); \
+    } \
+    void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept \
+    { \
+        return usdex::test::detail::trackedAlignedAllocate(size, alignment); \
+    } \
+    void operator delete(void* ptr) noexcept \
+    { \
+        usdex::test::detail::trackedDeallocate(ptr); \
+    } \
+    void operator delete[](void* ptr) noexcept \
+    { \
+        usdex::test::detail::trackedDeallocate(ptr); \
+    } \
+    void operator delete(void* ptr, std::size_t) noexcept \
+    { \
+        usdex::test::detail::trackedDeallocate(ptr); \
+    } \
+    void operator delete[](void* ptr, std::size_t) noexcept \
+    { \
+        usdex::test::detail::trackedDeallocate(ptr); \
+    } \
+    void operator delete(void* ptr, const std::nothrow_t&) noexcept \
+    { \
+        usdex::test::detail::trackedDeallocate(ptr); \
+    } \
+    void operator delete[](void* ptr, const std::nothrow_t&) noexcept \
+    { \
+        usdex::test::detail::trackedDeallocate(ptr); \
+    } \
+    void operator delete(void* ptr, std::align_val_t alignment) noexcept \
+    { \
+        usdex::test::detail::trackedAlignedDeallocate(ptr, alignment); \
+    } \
+    void operator delete[](void* ptr, std::align_val_t alignment) noexcept \
+    { \
+        usdex::test::detail::trackedAlignedDeallocate(ptr, alignment); \
+    } \
+    void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept \
+    { \
+        usdex::test::detail::trackedAlignedDeallocate(ptr, alignment); \
+    } \
+    void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept \
+    { \
+        usdex::test::detail::trackedAlignedDeallocate(ptr, alignment); \
+    } \
+    void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept \
+    { \
+        usdex::test::detail::trackedAlignedDeallocate(ptr, alignment); \
+    } \
+    void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept \
+    { \
+        usdex::test::detail::trackedAlignedDeallocate(ptr, alignment); \
+    } \
+    static const bool s_usdexTrackingAllocatorInstalled = \
+        (usdex::test::detail::getAllocationCounters().installed.store(true, std::memory_order_relaxed), true)
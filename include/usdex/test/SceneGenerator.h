@@ -0,0 +1,263 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/test/SceneGenerator.h
+//! @brief A deterministic generator of large synthetic scenes for benchmarks and stress tests.
+
+#include <usdex/core/AssetStructure.h>
+#include <usdex/core/CurvesAlgo.h>
+#include <usdex/core/MaterialAlgo.h>
+#include <usdex/core/MeshAlgo.h>
+#include <usdex/core/NameAlgo.h>
+#include <usdex/core/PointsAlgo.h>
+#include <usdex/core/XformAlgo.h>
+
+#include <pxr/base/gf/transform.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace usdex::test
+{
+
+//! @addtogroup doctest
+//! @{
+
+//! The options controlling the content of a scene produced by `generateScene`.
+struct SceneGeneratorOptions
+{
+    uint64_t seed = 0; //!< The seed of the random values. The same seed and options always produce the same scene.
+    size_t hierarchyDepth = 2; //!< The number of levels of `UsdGeomXform` prims between the root and the geometry.
+    size_t hierarchyWidth = 4; //!< The number of child `UsdGeomXform` prims of each non-leaf `UsdGeomXform`.
+    size_t meshCount = 16; //!< The number of `UsdGeomMesh` prims.
+    size_t verticesPerMesh = 1024; //!< The approximate number of vertices of each mesh, which are arranged in a square grid of quads.
+    size_t groomCount = 0; //!< The number of `UsdGeomBasisCurves` prims.
+    size_t curvesPerGroom = 1000; //!< The number of curves in each groom.
+    size_t verticesPerCurve = 8; //!< The number of vertices in each curve. At least 2 vertices are authored.
+    size_t pointCloudCount = 0; //!< The number of `UsdGeomPoints` prims.
+    size_t pointsPerCloud = 10000; //!< The number of points in each point cloud.
+    size_t materialCount = 4; //!< The number of preview materials, which are bound to the geometry in turn.
+    double nameCollisionRate = 0.0; //!< The probability (0-1) that the preferred name of a geometry prim collides with its siblings.
+};
+
+namespace detail
+{
+
+//! A small and fast random number generator (SplitMix64), which produces identical sequences on every platform and in Python.
+class SceneRandom
+{
+
+public:
+
+    explicit SceneRandom(uint64_t seed) : m_state(seed)
+    {
+    }
+
+    uint64_t next()
+    {
+        m_state += 0x9E3779B97F4A7C15ull;
+        uint64_t z = m_state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    //! A uniformly distributed value in [0, 1)
+    double uniform()
+    {
+        return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+private:
+
+    uint64_t m_state;
+};
+
+} // namespace detail
+
+//! Generate a synthetic scene below `parent` using the `usdex::core` define functions, so that production scale inputs can be authored for
+//! benchmarks and stress tests.
+//!
+//! The scene consists of a "Materials" scope containing the preview materials, and a "Geometry" hierarchy of `UsdGeomXform` prims with the
+//! meshes, grooms, and point clouds distributed evenly across the leaves of the hierarchy. The preferred names of colliding geometry prims are
+//! made unique using `usdex::core::getValidChildNames`.
+//!
+//! The same seed and options always produce the same scene, on all platforms, and `usdex.test.generateScene` in Python produces an identical
+//! scene to this function.
+//!
+//! @param parent The prim below which to generate the scene.
+//! @param options The options controlling the content of the scene.
+//! @returns The geometry prims in the order they were defined (meshes, then grooms, then point clouds).
+inline std::vector<pxr::UsdPrim> generateScene(pxr::UsdPrim parent, const SceneGeneratorOptions& options = SceneGeneratorOptions())
+{
+    detail::SceneRandom random(options.seed);
+    std::vector<pxr::UsdPrim> result;
+
+    // Materials
+    std::vector<pxr::UsdShadeMaterial> materials;
+    if (options.materialCount)
+    {
+        pxr::UsdPrim scope = usdex::core::defineScope(parent, "Materials").GetPrim();
+        for (size_t i = 0; i < options.materialCount; ++i)
+        {
+            const float r = static_cast<float>(random.uniform());
+            const float g = static_cast<float>(random.uniform());
+            const float b = static_cast<float>(random.uniform());
+            materials.push_back(usdex::core::definePreviewMaterial(scope, pxr::TfStringPrintf("Material_%zu", i), pxr::GfVec3f(r, g, b)));
+        }
+    }
+
+    // Hierarchy, defined breadth first
+    std::vector<pxr::UsdPrim> leaves = { usdex::core::defineXform(parent, "Geometry").GetPrim() };
+    for (size_t depth = 0; depth < options.hierarchyDepth; ++depth)
+    {
+        std::vector<pxr::UsdPrim> children;
+        for (const pxr::UsdPrim& prim : leaves)
+        {
+            for (size_t i = 0; i < options.hierarchyWidth; ++i)
+            {
+                const double x = random.uniform() * 100.0;
+                const double y = random.uniform() * 100.0;
+                pxr::GfTransform transform;
+                transform.SetTranslation(pxr::GfVec3d(x, y, 0.0));
+                children.push_back(usdex::core::defineXform(prim, pxr::TfStringPrintf("Group_%zu", i), transform).GetPrim());
+            }
+        }
+        if (children.empty())
+        {
+            break;
+        }
+        leaves = std::move(children);
+    }
+
+    // Preferred names, with collisions resolved against the other geometry of the same leaf
+    struct Item
+    {
+        size_t kind;
+        size_t leaf;
+        size_t nameIndex;
+    };
+    static constexpr const char* s_baseNames[] = { "Mesh", "Groom", "Points" };
+    const size_t counts[] = { options.meshCount, options.groomCount, options.pointCloudCount };
+    std::vector<Item> items;
+    std::vector<std::vector<std::string>> preferredNames(leaves.size());
+    for (size_t kind = 0; kind < 3; ++kind)
+    {
+        for (size_t i = 0; i < counts[kind]; ++i)
+        {
+            const size_t leaf = items.size() % leaves.size();
+            const bool collides = random.uniform() < options.nameCollisionRate;
+            std::vector<std::string>& names = preferredNames[leaf];
+            items.push_back(Item{ kind, leaf, names.size() });
+            names.push_back(collides ? std::string(s_baseNames[kind]) : pxr::TfStringPrintf("%s_%zu", s_baseNames[kind], i));
+        }
+    }
+    std::vector<pxr::TfTokenVector> validNames(leaves.size());
+    for (size_t leaf = 0; leaf < leaves.size(); ++leaf)
+    {
+        validNames[leaf] = usdex::core::getValidChildNames(leaves[leaf], preferredNames[leaf]);
+    }
+
+    // Geometry
+    const size_t meshWidth = std::max<size_t>(static_cast<size_t>(std::sqrt(static_cast<double>(options.verticesPerMesh))), 2) - 1;
+    const size_t verticesPerCurve = std::max<size_t>(options.verticesPerCurve, 2);
+    for (size_t itemIndex = 0; itemIndex < items.size(); ++itemIndex)
+    {
+        const Item& item = items[itemIndex];
+        const pxr::UsdPrim& leaf = leaves[item.leaf];
+        const std::string name = validNames[item.leaf][item.nameIndex].GetString();
+
+        pxr::UsdPrim prim;
+        if (item.kind == 0)
+        {
+            const double offsetX = random.uniform() * 10.0;
+            const double offsetY = random.uniform() * 10.0;
+            pxr::VtVec3fArray points;
+            points.reserve((meshWidth + 1) * (meshWidth + 1));
+            for (size_t y = 0; y <= meshWidth; ++y)
+            {
+                for (size_t x = 0; x <= meshWidth; ++x)
+                {
+                    const double z = random.uniform() * 0.1;
+                    points.push_back(pxr::GfVec3f(
+                        static_cast<float>(offsetX + static_cast<double>(x) / static_cast<double>(meshWidth)),
+                        static_cast<float>(offsetY + static_cast<double>(y) / static_cast<double>(meshWidth)),
+                        static_cast<float>(z)
+                    ));
+                }
+            }
+            pxr::VtIntArray faceVertexCounts(meshWidth * meshWidth, 4);
+            pxr::VtIntArray faceVertexIndices;
+            faceVertexIndices.reserve(meshWidth * meshWidth * 4);
+            for (size_t y = 0; y < meshWidth; ++y)
+            {
+                for (size_t x = 0; x < meshWidth; ++x)
+                {
+                    const int corner = static_cast<int>(y * (meshWidth + 1) + x);
+                    const int stride = static_cast<int>(meshWidth + 1);
+                    faceVertexIndices.push_back(corner);
+                    faceVertexIndices.push_back(corner + 1);
+                    faceVertexIndices.push_back(corner + stride + 1);
+                    faceVertexIndices.push_back(corner + stride);
+                }
+            }
+            prim = usdex::core::definePolyMesh(leaf, name, faceVertexCounts, faceVertexIndices, points).GetPrim();
+        }
+        else if (item.kind == 1)
+        {
+            pxr::VtIntArray curveVertexCounts(options.curvesPerGroom, static_cast<int>(verticesPerCurve));
+            pxr::VtVec3fArray points;
+            points.reserve(options.curvesPerGroom * verticesPerCurve);
+            for (size_t curve = 0; curve < options.curvesPerGroom; ++curve)
+            {
+                const double rootX = random.uniform();
+                const double rootY = random.uniform();
+                const double leanX = (random.uniform() - 0.5) * 0.2;
+                const double leanY = (random.uniform() - 0.5) * 0.2;
+                for (size_t v = 0; v < verticesPerCurve; ++v)
+                {
+                    const double t = static_cast<double>(v) / static_cast<double>(verticesPerCurve - 1);
+                    points.push_back(
+                        pxr::GfVec3f(static_cast<float>(rootX + leanX * t), static_cast<float>(rootY + leanY * t), static_cast<float>(t))
+                    );
+                }
+            }
+            const usdex::core::FloatPrimvarData widths(pxr::UsdGeomTokens->constant, pxr::VtFloatArray(1, 0.01f));
+            prim = usdex::core::defineLinearBasisCurves(leaf, name, curveVertexCounts, points, pxr::UsdGeomTokens->nonperiodic, widths).GetPrim();
+        }
+        else
+        {
+            pxr::VtVec3fArray points;
+            points.reserve(options.pointsPerCloud);
+            for (size_t i = 0; i < options.pointsPerCloud; ++i)
+            {
+                const double x = random.uniform();
+                const double y = random.uniform();
+                const double z = random.uniform();
+                points.push_back(pxr::GfVec3f(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)));
+            }
+            prim = usdex::core::definePointCloud(leaf, name, points).GetPrim();
+        }
+
+        if (prim && !materials.empty())
+        {
+            usdex::core::bindMaterial(prim, materials[itemIndex % materials.size()]);
+        }
+        result.push_back(prim);
+    }
+
+    return result;
+}
+
+//! @}
+
+} // namespace usdex::test
@@ -8,23 +8,53 @@
 #include "usdex/core/NameAlgo.h"
 #include "usdex/core/StageAlgo.h"
 
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/ar/resolverScopedCache.h>
 #include <pxr/usd/kind/registry.h>
+#include <pxr/usd/pcp/layerStack.h>
+#include <pxr/usd/pcp/node.h>
+#include <pxr/usd/pcp/primIndex.h>
+#include <pxr/usd/sdf/attributeSpec.h>
 #include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/layerUtils.h>
+#include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/sdf/spec.h>
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/payloads.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/boundable.h>
 #include <pxr/usd/usdGeom/imageable.h>
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/usdGeom/modelAPI.h>
 #include <pxr/usd/usdGeom/scope.h>
 #include <pxr/usd/usdGeom/tokens.h>
-
+#include <pxr/usd/usdGeom/xformCache.h>
+#include <pxr/usd/usdGeom/xformable.h>
+#include <pxr/usd/usdPhysics/metrics.h>
+#include <pxr/usd/usdPhysics/tokens.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <filesystem>
+#include <iterator>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 using namespace pxr;
 
@@ -41,6 +71,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     (Contents)
     (Geometry)
     (Library)
+    (LOD)
     (Materials)
     (Physics)
     (Textures)
@@ -57,6 +88,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     (Contents)
     (Geometry)
     (Library)
+    (LOD)
     (Materials)
     (Physics)
     (Textures)
@@ -126,36 +158,57 @@ std::string getRelativeIdentifier(const std::string& sourceIdentifier, const std
     return result;
 }
 
-//! Common implementation for defineReference and definePayload (stage, path) versions
+//! Memoized layer resolution shared by many references/payloads
+//!
+//! Authoring many references/payloads between the same layers repeats identical identifier resolutions, relative identifier computations,
+//! and default prim queries. These are all memoized per layer (or per pair of layers), keyed by layer identifier.
+struct ReferencePayloadCache
+{
+    std::unordered_map<std::string, ArResolvedPath> resolvedPaths;
+    std::unordered_map<std::string, SdfPath> defaultPrimPaths;
+    std::map<std::pair<std::string, std::string>, std::string> relativeIdentifiers;
+};
+
+//! The arc which targets a source prim from a referencing stage
+struct ReferencePayloadTarget
+{
+    std::string relativeIdentifier;
+    bool isInternal = false;
+    bool sourceIsDefaultPrim = false;
+};
+
+//! Resolve the identifier of a layer, memoizing the result in the cache
+const ArResolvedPath& resolveLayerIdentifier(const SdfLayerHandle& layer, ReferencePayloadCache& cache)
+{
+    auto [it, inserted] = cache.resolvedPaths.try_emplace(layer->GetIdentifier());
+    if (inserted)
+    {
+        it->second = ArGetResolver().Resolve(it->first);
+    }
+    return it->second;
+}
+
+//! Compute the arc which targets the source prim from the stage's edit target
 //!
 //! @param stage The stage on which to define the reference/payload
 //! @param path The absolute prim path at which to define the reference/payload
 //! @param source The source prim to reference/payload
-//! @param outRelativeIdentifier The relative identifier of the source prim
-//! @param isInternal Whether the reference/payload is internal or external
-//! @returns The newly created prim. Returns an invalid prim on error.
-UsdPrim createReferencePayloadPrim(
+//! @param cache The memoized layer resolution to use and update
+//! @param outTarget The arc which targets the source prim
+//! @returns False if no reference/payload can target the source prim from the stage.
+bool getReferencePayloadTarget(
     UsdStagePtr stage,
     const SdfPath& path,
-    UsdPrim source,
-    std::string& outRelativeIdentifier,
-    bool& outIsInternal,
-    bool& outSourceIsDefaultPrim
+    const UsdPrim& source,
+    ReferencePayloadCache& cache,
+    ReferencePayloadTarget& outTarget
 )
 {
-    // Early out if the proposed prim location is invalid
-    std::string reason;
-    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
-    {
-        TF_RUNTIME_ERROR("Unable to define reference/payload due to an invalid location: %s", reason.c_str());
-        return UsdPrim();
-    }
-
     // Early out if the source prim is invalid
     if (!source)
     {
         TF_RUNTIME_ERROR("Unable to define reference/payload due to an invalid source prim");
-        return UsdPrim();
+        return false;
     }
 
     // Get the source and stage layers so as not to accidentally use the stage's root layer
@@ -166,52 +219,84 @@ UsdPrim createReferencePayloadPrim(
     if (stageLayer->IsAnonymous())
     {
         TF_RUNTIME_ERROR("Unable to define reference/payload due to an anonymous referencing stage");
-        return UsdPrim();
+        return false;
     }
 
     if (sourceLayer->IsAnonymous())
     {
         TF_RUNTIME_ERROR("Unable to define reference/payload due to an anonymous source stage");
-        return UsdPrim();
+        return false;
     }
 
     // Ensure that the layer identifiers are resolved to absolute paths
-    ArResolver& resolver = ArGetResolver();
-    ArResolvedPath sourceResolvedPath = resolver.Resolve(sourceLayer->GetIdentifier());
+    const ArResolvedPath& sourceResolvedPath = ::resolveLayerIdentifier(sourceLayer, cache);
     if (!sourceResolvedPath)
     {
         TF_RUNTIME_ERROR("Unable to define reference/payload due to an invalid source layer identifier: %s", sourceLayer->GetIdentifier().c_str());
-        return UsdPrim();
+        return false;
     }
 
-    ArResolvedPath stageResolvedPath = resolver.Resolve(stageLayer->GetIdentifier());
+    const ArResolvedPath& stageResolvedPath = ::resolveLayerIdentifier(stageLayer, cache);
     if (!stageResolvedPath)
     {
         TF_RUNTIME_ERROR("Unable to define reference/payload due to an invalid stage layer identifier: %s", stageLayer->GetIdentifier().c_str());
-        return UsdPrim();
+        return false;
     }
 
     // If the source prim and reference are in the same stage, we can use an internal reference/payload
     if (stageResolvedPath.GetPathString() == sourceResolvedPath.GetPathString())
     {
-        outIsInternal = true;
-        outRelativeIdentifier = "";
+        outTarget.isInternal = true;
+        outTarget.relativeIdentifier = "";
         if (path == source.GetPath())
         {
             TF_RUNTIME_ERROR("Unable to define reference/payload pointing to itself: \"%s\"", path.GetAsString().c_str());
-            return UsdPrim();
+            return false;
         }
     }
     else
     {
-        outIsInternal = false;
+        outTarget.isInternal = false;
         // Compute the relative identifier between the stage's edit target and the source stage
-        outRelativeIdentifier = ::getRelativeIdentifier(sourceResolvedPath.GetPathString(), stageResolvedPath.GetPathString());
+        auto [it, inserted] = cache.relativeIdentifiers.try_emplace({ sourceResolvedPath.GetPathString(), stageResolvedPath.GetPathString() });
+        if (inserted)
+        {
+            it->second = ::getRelativeIdentifier(it->first.first, it->first.second);
+        }
+        outTarget.relativeIdentifier = it->second;
     }
 
-    if (source.GetPath() == source.GetStage()->GetDefaultPrim().GetPath())
+    auto [it, inserted] = cache.defaultPrimPaths.try_emplace(sourceLayer->GetIdentifier());
+    if (inserted)
     {
-        outSourceIsDefaultPrim = true;
+        it->second = source.GetStage()->GetDefaultPrim().GetPath();
+    }
+    outTarget.sourceIsDefaultPrim = (source.GetPath() == it->second);
+
+    return true;
+}
+
+//! Common implementation for defineReference and definePayload (stage, path) versions
+//!
+//! @param stage The stage on which to define the reference/payload
+//! @param path The absolute prim path at which to define the reference/payload
+//! @param source The source prim to reference/payload
+//! @param outTarget The arc which targets the source prim
+//! @returns The newly created prim. Returns an invalid prim on error.
+UsdPrim createReferencePayloadPrim(UsdStagePtr stage, const SdfPath& path, UsdPrim source, ReferencePayloadTarget& outTarget)
+{
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define reference/payload due to an invalid location: %s", reason.c_str());
+        return UsdPrim();
+    }
+
+    ReferencePayloadCache cache;
+    if (!::getReferencePayloadTarget(stage, path, source, cache, outTarget))
+    {
+        return UsdPrim();
     }
 
     // Check if the prim is already defined
@@ -240,6 +325,148 @@ UsdPrim createReferencePayloadPrim(
     return newPrim;
 }
 
+//! Add a reference to the source prim using the given arc
+void addReference(UsdPrim prim, const UsdPrim& source, const ReferencePayloadTarget& target)
+{
+    if (target.isInternal)
+    {
+        prim.GetReferences().AddInternalReference(source.GetPath());
+    }
+    else if (target.sourceIsDefaultPrim)
+    {
+        prim.GetReferences().AddReference(target.relativeIdentifier);
+    }
+    else
+    {
+        prim.GetReferences().AddReference(target.relativeIdentifier, source.GetPath());
+    }
+}
+
+//! Add a payload to the source prim using the given arc
+void addPayload(UsdPrim prim, const UsdPrim& source, const ReferencePayloadTarget& target)
+{
+    if (target.isInternal)
+    {
+        prim.GetPayloads().AddInternalPayload(source.GetPath());
+    }
+    else if (target.sourceIsDefaultPrim)
+    {
+        prim.GetPayloads().AddPayload(target.relativeIdentifier);
+    }
+    else
+    {
+        prim.GetPayloads().AddPayload(target.relativeIdentifier, source.GetPath());
+    }
+}
+
+//! Common implementation for defineReferences and definePayloads
+//!
+//! All identifiers are resolved within a single `ArResolverScopedCache` and memoized per layer. All prims are then defined within one
+//! `SdfChangeBlock`, and all arcs are added within another, so the stage only processes the changes twice regardless of the number of prims.
+//!
+//! @param stage The stage on which to define the references/payloads
+//! @param paths The absolute prim paths at which to define the references/payloads
+//! @param sources The source prim of each reference/payload
+//! @param addArc The function which adds the reference/payload to each prim
+//! @returns The newly created prim for each path. Any prim which could not be defined is invalid.
+template <typename AddArcFn>
+std::vector<UsdPrim> createReferencePayloadPrims(
+    UsdStagePtr stage,
+    const SdfPathVector& paths,
+    const std::vector<UsdPrim>& sources,
+    AddArcFn&& addArc
+)
+{
+    std::vector<UsdPrim> result(paths.size());
+
+    // Early out if the sources are not consistent with the paths
+    if (sources.size() != paths.size())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define references/payloads due to mismatched sources: Expected %zu sources but found %zu",
+            paths.size(),
+            sources.size()
+        );
+        return result;
+    }
+
+    // Early out if the stage is invalid, as no location could be valid
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to define references/payloads due to an invalid location: Invalid UsdStage.");
+        return result;
+    }
+
+    std::vector<std::string> reasons;
+    std::vector<bool> valid = usdex::core::areEditablePrimLocations(stage, paths, &reasons);
+
+    std::vector<ReferencePayloadTarget> targets(paths.size());
+    {
+        TRACE_SCOPE("Resolve reference/payload targets");
+        ArResolverScopedCache resolverCache;
+        ReferencePayloadCache cache;
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            if (!valid[i])
+            {
+                TF_RUNTIME_ERROR("Unable to define reference/payload due to an invalid location: %s", reasons[i].c_str());
+                continue;
+            }
+            valid[i] = ::getReferencePayloadTarget(stage, paths[i], sources[i], cache, targets[i]);
+        }
+    }
+
+    // Define all of the prims with a single round of change processing.
+    // The prim specs are authored directly in the edit target layer as the stage can not recompose while the change block is open.
+    {
+        TRACE_SCOPE("Define reference/payload prim specs");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            if (!valid[i])
+            {
+                continue;
+            }
+
+            SdfPrimSpecHandle primSpec = usdex::core::detail::definePrimSpec(stage, paths[i], sources[i].GetTypeName());
+            if (!primSpec)
+            {
+                TF_RUNTIME_ERROR("Unable to define reference/payload at \"%s\"", paths[i].GetAsString().c_str());
+                valid[i] = false;
+                continue;
+            }
+
+            // Set the specifier from the source
+            primSpec->SetSpecifier(sources[i].GetSpecifier());
+        }
+    }
+
+    // Add all of the references/payloads with a single round of change processing
+    {
+        TRACE_SCOPE("Author references/payloads");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            if (!valid[i])
+            {
+                continue;
+            }
+
+            UsdPrim prim = stage->GetPrimAtPath(paths[i]);
+            if (!prim)
+            {
+                TF_RUNTIME_ERROR("Unable to define reference/payload at \"%s\"", paths[i].GetAsString().c_str());
+                continue;
+            }
+
+            addArc(prim, sources[i], targets[i]);
+            result[i] = prim;
+        }
+    }
+
+    return result;
+}
+
 bool getReferencePayloadPrimPath(UsdPrim parent, UsdPrim source, std::optional<std::string_view> name, SdfPath& outPrimPath)
 {
     if (!source)
@@ -261,45 +488,878 @@ bool getReferencePayloadPrimPath(UsdPrim parent, UsdPrim source, std::optional<s
     return true;
 }
 
+//! The prim specs of each layer which could contribute a kind opinion to the composed namespace at or beneath their path
+//!
+//! Each layer is scanned once at the spec level, without composition. A spec contributes if it authors a kind, or if it authors any
+//! composition arc or variant set, as those can introduce kind opinions from other layers. Subtrees of composed prims which have no
+//! contributing specs in any layer of their prim index can not have authored kinds, so they do not need to be visited.
+class KindSites
+{
+
+public:
+
+    //! Whether the prim or any of its descendants could have an authored kind
+    bool mayHaveKind(const UsdPrim& prim)
+    {
+        const PcpNodeRange range = prim.GetPrimIndex().GetNodeRange();
+        for (auto node = range.first; node != range.second; ++node)
+        {
+            if (node->IsInert())
+            {
+                continue;
+            }
+
+            const SdfPath path = node->GetPath().StripAllVariantSelections();
+            for (const SdfLayerRefPtr& layer : node->GetLayerStack()->GetLayers())
+            {
+                const LayerSites& sites = getLayerSites(layer);
+
+                // A contributing spec at or beneath the path
+                const auto prefixed = SdfPathFindPrefixedRange(sites.paths.begin(), sites.paths.end(), path);
+                if (prefixed.first != prefixed.second)
+                {
+                    return true;
+                }
+
+                // A variant set at or above the path, whose variants have not been scanned
+                for (SdfPath ancestor = path; !ancestor.IsAbsoluteRootPath() && !ancestor.IsEmpty(); ancestor = ancestor.GetParentPath())
+                {
+                    if (sites.variantPaths.count(ancestor))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+
+    struct LayerSites
+    {
+        SdfPathVector paths; // sorted, so that descendants of a path are contiguous
+        SdfPathSet variantPaths;
+    };
+
+    const LayerSites& getLayerSites(const SdfLayerHandle& layer)
+    {
+        auto [it, inserted] = m_layerSites.try_emplace(layer);
+        if (inserted)
+        {
+            TRACE_SCOPE("Scan layer for kind opinions");
+            for (const SdfPrimSpecHandle& child : layer->GetRootPrims())
+            {
+                collectSites(child, it->second);
+            }
+            std::sort(it->second.paths.begin(), it->second.paths.end());
+        }
+        return it->second;
+    }
+
+    static void collectSites(const SdfPrimSpecHandle& spec, LayerSites& sites)
+    {
+        if (spec->HasKind() || spec->HasReferences() || spec->HasPayloads() || spec->HasInheritPaths() || spec->HasSpecializes())
+        {
+            sites.paths.push_back(spec->GetPath());
+        }
+        if (spec->HasField(SdfChildrenKeys->VariantSetChildren))
+        {
+            sites.variantPaths.insert(spec->GetPath());
+        }
+        for (const SdfPrimSpecHandle& child : spec->GetNameChildren())
+        {
+            collectSites(child, sites);
+        }
+    }
+
+    std::unordered_map<SdfLayerHandle, LayerSites, TfHash> m_layerSites;
+};
+
 //! Set the kind of a prim and all its descendants to component
 //!
 //! If any descendant is a component, it is set to subcomponent
 //! If any descendant has an authored kind that is not component, it is set to an empty token
+//!
+//! Only descendants which could have an authored kind are visited (see `KindSites`), and all kinds are authored with a single round of
+//! change processing.
 void createAssetComponent(UsdPrim prim)
 {
+    TRACE_FUNCTION();
+
     UsdModelAPI(prim).SetKind(KindTokens->component);
-    for (UsdPrim descendant : UsdPrimRange(prim))
+
+    std::vector<UsdPrim> subcomponents;
+    std::vector<UsdPrim> cleared;
     {
-        if (descendant == prim)
+        TRACE_SCOPE("Find authored kinds");
+        KindSites sites;
+        UsdPrimRange range(prim);
+        for (auto it = range.begin(); it != range.end(); ++it)
         {
+            const UsdPrim& descendant = *it;
+            if (descendant == prim)
+            {
+                continue;
+            }
+
+            if (!sites.mayHaveKind(descendant))
+            {
+                it.PruneChildren();
+                continue;
+            }
+
+            UsdModelAPI model = UsdModelAPI(descendant);
+            TfToken currentKind;
+            bool hasAuthoredKind = model.GetKind(&currentKind);
+            if (currentKind == KindTokens->component)
+            {
+                subcomponents.push_back(descendant);
+            }
+            else if (hasAuthoredKind)
+            {
+                cleared.push_back(descendant);
+            }
+        }
+    }
+
+    SdfChangeBlock changeBlock;
+    for (const UsdPrim& descendant : subcomponents)
+    {
+        bool success = UsdModelAPI(descendant).SetKind(KindTokens->subcomponent);
+        if (!success)
+        {
+            TF_WARN("Unable to set the kind of \"%s\" to subcomponent", descendant.GetPath().GetAsString().c_str());
+        }
+    }
+    for (const UsdPrim& descendant : cleared)
+    {
+        bool success = UsdModelAPI(descendant).SetKind(_tokens->Empty);
+        if (!success)
+        {
+            TF_WARN("Unable to clear the kind of \"%s\"", descendant.GetPath().GetAsString().c_str());
+        }
+    }
+}
+
+//! Compute a key which is identical for prims that would share an instancing prototype
+//!
+//! This is a serialization of all composition arcs authored on the prim spec, including the asset paths, prim paths, and layer offsets.
+std::string getInstancingKey(const SdfPrimSpecHandle& spec)
+{
+    static const TfTokenVector s_arcFields = {
+        SdfFieldKeys->References,
+        SdfFieldKeys->Payload,
+        SdfFieldKeys->InheritPaths,
+        SdfFieldKeys->Specializes,
+    };
+
+    std::string key;
+    for (const TfToken& field : s_arcFields)
+    {
+        key += TfStringify(spec->GetField(field));
+        key += '\n';
+    }
+    const VtValue selections = spec->GetField(SdfFieldKeys->VariantSelection);
+    if (selections.IsHolding<SdfVariantSelectionMap>())
+    {
+        for (const auto& [variantSet, variant] : selections.UncheckedGet<SdfVariantSelectionMap>())
+        {
+            key += variantSet + "=" + variant + '\n';
+        }
+    }
+    return key;
+}
+
+//! Whether any layer of the local layer stack has opinions on the descendants of a prim, which would be ignored if it were instanced
+bool hasDescendantOpinions(const UsdPrim& prim)
+{
+    for (const SdfLayerHandle& layer : prim.GetStage()->GetLayerStack())
+    {
+        SdfPrimSpecHandle spec = layer->GetPrimAtPath(prim.GetPath());
+        if (spec && (!spec->GetNameChildren().empty() || !spec->GetVariantSets().empty()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! Common implementation for createAssetPayload and createAssetLodPayload
+//!
+//! @param stage The asset stage
+//! @param relativeIdentifier The identifier of the payload layer, relative to the root layer of the asset stage
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied during stage creation
+//! @returns The newly created payload stage. Returns a null pointer on error.
+UsdStageRefPtr createAssetPayloadStage(UsdStagePtr stage, const std::string& relativeIdentifier, const SdfLayer::FileFormatArguments& fileFormatArgs)
+{
+    if (!stage)
+    {
+        TF_WARN("Unable to create asset payload stage due to an invalid asset stage");
+        return nullptr;
+    }
+
+    if (stage->GetRootLayer()->IsAnonymous())
+    {
+        TF_WARN("Unable to create asset payload stage due to an anonymous asset stage");
+        return nullptr;
+    }
+
+    ArResolver& resolver = ArGetResolver();
+    std::string identifier = resolver.CreateIdentifier(relativeIdentifier, resolver.Resolve(stage->GetRootLayer()->GetIdentifier()));
+
+    UsdStageRefPtr payloadStage = usdex::core::createStage(
+        identifier,
+        stage->GetDefaultPrim().GetName(),
+        UsdGeomGetStageUpAxis(stage),
+        UsdGeomGetStageMetersPerUnit(stage),
+        usdex::core::getLayerAuthoringMetadata(stage->GetRootLayer()),
+        fileFormatArgs
+    );
+    if (!payloadStage)
+    {
+        TF_WARN("Unable to create asset payload stage");
+        return nullptr;
+    }
+
+    // Copy the asset stage's default prim to the asset payload stage
+    bool success = SdfCopySpec(
+        stage->GetRootLayer(),
+        stage->GetDefaultPrim().GetPath(),
+        payloadStage->GetRootLayer(),
+        payloadStage->GetDefaultPrim().GetPath()
+    );
+    if (!success)
+    {
+        TF_WARN("Unable to copy the asset stage's default prim to the asset payload stage");
+        return nullptr;
+    }
+
+    return payloadStage;
+}
+
+//! Configure the asset stage to match the source stage, and copy the default prim of the source stage to the asset stage
+bool copyAssetInterface(UsdStagePtr stage, const UsdStagePtr source)
+{
+    usdex::core::configureStage(
+        stage,
+        source->GetDefaultPrim().GetName(),
+        UsdGeomGetStageUpAxis(source),
+        UsdGeomGetStageMetersPerUnit(source),
+        usdex::core::getLayerAuthoringMetadata(source->GetRootLayer())
+    );
+    bool success = SdfCopySpec(source->GetRootLayer(), source->GetDefaultPrim().GetPath(), stage->GetRootLayer(), stage->GetDefaultPrim().GetPath());
+    if (!success)
+    {
+        TF_WARN("Unable to copy the source stage's default prim to the stage");
+        return false;
+    }
+    return true;
+}
+
+//! Annotate the default prim of the asset stage as a component, once its payload has been defined
+bool annotateAssetInterface(UsdPrim root)
+{
+    UsdModelAPI model = UsdModelAPI(root);
+    model.SetAssetName(usdex::core::computeEffectiveDisplayName(root));
+    ::createAssetComponent(root);
+
+    UsdGeomModelAPI geomModel = UsdGeomModelAPI::Apply(root);
+    if (!geomModel)
+    {
+        TF_WARN("Unable to apply the UsdGeomModelAPI to the default prim");
+        return false;
+    }
+
+    UsdGeomBBoxCache bboxCache(UsdTimeCode::Default(), UsdGeomImageable(root).GetOrderedPurposeTokens());
+    bool success = geomModel.SetExtentsHint(geomModel.ComputeExtentsHint(bboxCache));
+    if (!success)
+    {
+        TF_WARN("Unable to set the extents hint for the default prim");
+        return false;
+    }
+
+    return true;
+}
+
+//! Collect a layer and all of its sublayers, strongest first, opening each sublayer without composing the layer stack
+void collectLayerStack(const SdfLayerRefPtr& layer, SdfLayerRefPtrVector& layers)
+{
+    if (std::find(layers.begin(), layers.end(), layer) != layers.end())
+    {
+        return;
+    }
+
+    layers.push_back(layer);
+    for (const std::string& subLayerPath : layer->GetSubLayerPaths())
+    {
+        SdfLayerRefPtr subLayer = SdfLayer::FindOrOpen(SdfComputeAssetPathRelativeToLayer(layer, subLayerPath));
+        if (!subLayer)
+        {
+            TF_WARN("Unable to open sublayer \"%s\" of \"%s\"", subLayerPath.c_str(), layer->GetIdentifier().c_str());
             continue;
         }
+        ::collectLayerStack(subLayer, layers);
+    }
+}
+
+//! Get the strongest opinion of a field in a layer stack, or an empty value if no layer has an opinion
+VtValue getStrongestField(const SdfLayerRefPtrVector& layers, const SdfPath& path, const TfToken& field)
+{
+    for (const SdfLayerRefPtr& layer : layers)
+    {
+        VtValue value = layer->GetField(path, field);
+        if (!value.IsEmpty())
+        {
+            return value;
+        }
+    }
+    return VtValue();
+}
+
+//! Collect the kind which `createAssetComponent` would author on each descendant of a prim spec which has an authored kind
+//!
+//! Specs are visited strongest layer first, so only the strongest kind of each path is considered.
+void collectDescendantKinds(const SdfPrimSpecHandle& spec, std::unordered_map<SdfPath, TfToken, SdfPath::Hash>& kinds)
+{
+    for (const SdfPrimSpecHandle& child : spec->GetNameChildren())
+    {
+        if (child->HasKind())
+        {
+            kinds.try_emplace(child->GetPath(), child->GetKind() == KindTokens->component ? KindTokens->subcomponent : _tokens->Empty);
+        }
+        ::collectDescendantKinds(child, kinds);
+    }
+}
+
+//! Author the Asset Interface from the specs of the source layer stack, as per `addAssetInterface`, without composing either layer
+bool addAssetInterfaceSpecs(SdfLayerHandle layer, const SdfLayerHandle source)
+{
+    TRACE_FUNCTION();
+
+    if (!layer)
+    {
+        TF_WARN("Unable to add asset interface due to an invalid layer");
+        return false;
+    }
+
+    if (!source)
+    {
+        TF_WARN("Unable to add asset interface due to an invalid source layer");
+        return false;
+    }
+
+    if (layer->IsAnonymous())
+    {
+        TF_WARN("Unable to add asset interface due to an anonymous layer");
+        return false;
+    }
+
+    if (source->IsAnonymous())
+    {
+        TF_WARN("Unable to add asset interface due to an anonymous source layer");
+        return false;
+    }
+
+    const TfToken defaultPrimName = source->GetDefaultPrim();
+    if (!SdfPath::IsValidIdentifier(defaultPrimName.GetString()))
+    {
+        TF_WARN("Unable to add asset interface due to a source layer without a valid default prim: \"%s\"", source->GetIdentifier().c_str());
+        return false;
+    }
+
+    ::ReferencePayloadCache cache;
+    const ArResolvedPath& layerPath = ::resolveLayerIdentifier(layer, cache);
+    const ArResolvedPath& sourcePath = ::resolveLayerIdentifier(source, cache);
+    if (!layerPath || !sourcePath)
+    {
+        TF_WARN("Unable to add asset interface due to an unresolved layer identifier");
+        return false;
+    }
+
+    if (layerPath.GetPathString() == sourcePath.GetPathString())
+    {
+        TF_WARN("Unable to add asset interface due to a source layer which is the layer itself: \"%s\"", layer->GetIdentifier().c_str());
+        return false;
+    }
+
+    SdfLayerRefPtrVector sourceLayers;
+    ::collectLayerStack(source, sourceLayers);
+    const SdfPath rootPath = SdfPath::AbsoluteRootPath().AppendChild(defaultPrimName);
+
+    SdfChangeBlock changeBlock;
+
+    // Configure the layer to match the source layer, as per `configureStage`, falling back to the same values as the stage metrics
+    layer->SetDefaultPrim(defaultPrimName);
+    const SdfPath& pseudoRootPath = SdfPath::AbsoluteRootPath();
+    const VtValue upAxis = source->GetField(pseudoRootPath, UsdGeomTokens->upAxis);
+    layer->SetField(pseudoRootPath, UsdGeomTokens->upAxis, upAxis.IsHolding<TfToken>() ? upAxis : VtValue(UsdGeomGetFallbackUpAxis()));
+    const VtValue linearUnits = source->GetField(pseudoRootPath, UsdGeomTokens->metersPerUnit);
+    layer->SetField(
+        pseudoRootPath,
+        UsdGeomTokens->metersPerUnit,
+        linearUnits.IsHolding<double>() ? linearUnits : VtValue(UsdGeomLinearUnits::centimeters)
+    );
+    const VtValue massUnits = source->GetField(pseudoRootPath, UsdPhysicsTokens->kilogramsPerUnit);
+    layer->SetField(
+        pseudoRootPath,
+        UsdPhysicsTokens->kilogramsPerUnit,
+        massUnits.IsHolding<double>() ? massUnits : VtValue(UsdPhysicsMassUnits::kilograms)
+    );
+    usdex::core::setLayerAuthoringMetadata(layer, usdex::core::getLayerAuthoringMetadata(source));
+
+    // Copy the source layer's default prim to the layer
+    if (source->GetPrimAtPath(rootPath))
+    {
+        if (!SdfCopySpec(source, rootPath, layer, rootPath))
+        {
+            TF_WARN("Unable to copy the source layer's default prim to the layer");
+            return false;
+        }
+    }
+    SdfPrimSpecHandle spec = SdfCreatePrimInLayer(layer, rootPath);
+    if (!spec)
+    {
+        TF_WARN("Unable to define the default prim in the layer");
+        return false;
+    }
+    spec->SetSpecifier(SdfSpecifierDef);
+
+    // Make the payload in the layer pointing to the source layer
+    SdfPayload payload(::getRelativeIdentifier(sourcePath.GetPathString(), layerPath.GetPathString()));
+    if (!spec->GetPayloadList().ContainsItemEdit(payload))
+    {
+        spec->GetPayloadList().GetPrependedItems().push_back(payload);
+    }
+
+    // Annotate the default prim as a component, as per `annotateAssetInterface`
+    const VtValue displayName = ::getStrongestField(sourceLayers, rootPath, SdfFieldKeys->DisplayName);
+    const bool hasDisplayName = displayName.IsHolding<std::string>() && !displayName.UncheckedGet<std::string>().empty();
+    layer->SetFieldDictValueByKey(
+        rootPath,
+        SdfFieldKeys->AssetInfo,
+        UsdModelAPIAssetInfoKeys->name,
+        hasDisplayName ? displayName : VtValue(defaultPrimName.GetString())
+    );
+
+    spec->SetKind(KindTokens->component);
+    std::unordered_map<SdfPath, TfToken, SdfPath::Hash> kinds;
+    for (const SdfLayerRefPtr& sourceLayer : sourceLayers)
+    {
+        if (SdfPrimSpecHandle sourceSpec = sourceLayer->GetPrimAtPath(rootPath))
+        {
+            ::collectDescendantKinds(sourceSpec, kinds);
+        }
+    }
+    for (const auto& [path, kind] : kinds)
+    {
+        SdfPrimSpecHandle descendant = SdfCreatePrimInLayer(layer, path);
+        if (!descendant)
+        {
+            TF_WARN("Unable to set the kind of \"%s\"", path.GetAsString().c_str());
+            continue;
+        }
+        descendant->SetKind(kind);
+    }
+
+    static const TfToken s_geomModelAPI = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomModelAPI>();
+    usdex::core::detail::addAppliedSchema(spec, s_geomModelAPI);
+
+    // The extents hint can not be computed without composition, so only an authored extents hint is carried to the Asset Interface
+    const SdfPath extentsHintPath = rootPath.AppendProperty(UsdGeomTokens->extentsHint);
+    const VtValue extentsHint = ::getStrongestField(sourceLayers, extentsHintPath, SdfFieldKeys->Default);
+    if (extentsHint.IsHolding<VtVec3fArray>())
+    {
+        SdfAttributeSpecHandle attr = layer->GetAttributeAtPath(extentsHintPath);
+        if (!attr)
+        {
+            attr = SdfAttributeSpec::New(spec, UsdGeomTokens->extentsHint, SdfValueTypeNames->Float3Array);
+        }
+        if (!attr || !attr->SetDefaultValue(extentsHint))
+        {
+            TF_WARN("Unable to set the extents hint for the default prim");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//! The number of purposes an extents hint holds a bound for, in the order of `UsdGeomImageable::GetOrderedPurposeTokens()`
+static constexpr size_t s_numPurposes = 4;
+
+//! The bound of a prim for each purpose, in the local space of the prim
+using PurposeBounds = std::array<GfRange3d, s_numPurposes>;
+
+//! How a prim contributes to the extents hints of its ancestors
+enum class ExtentsHintRole : uint8_t
+{
+    eNone, //!< The prim has no bound of its own, so only its transform is considered
+    eExtent, //!< The prim is boundable, and its extent is its bound
+    eHint, //!< The prim is a model whose authored extents hint is its bound, and its descendants are not considered
+    eTarget, //!< The prim is a model whose extents hint is computed from its descendants, and is then its bound
+};
+
+//! A flattened, pre-order hierarchy of the prims contributing to the extents hints below a root prim
+struct ExtentsHintHierarchy
+{
+    std::vector<UsdPrim> prims;
+    std::vector<size_t> parents; //!< The index of the parent of each prim. The parent of the root is itself.
+    std::vector<size_t> ends; //!< One past the index of the last descendant of each prim
+    std::vector<ExtentsHintRole> roles;
+    std::vector<GfMatrix4d> transforms; //!< The transform of each prim relative to the root
+    std::vector<PurposeBounds> bounds;
+};
+
+//! Get the index of a purpose in an extents hint, defaulting to the default purpose
+size_t getPurposeIndex(const TfToken& purpose)
+{
+    const TfTokenVector& purposes = UsdGeomImageable::GetOrderedPurposeTokens();
+    const auto it = std::find(purposes.begin(), purposes.end(), purpose);
+    return it == purposes.end() ? 0 : static_cast<size_t>(std::distance(purposes.begin(), it));
+}
+
+//! Read the bounds of each purpose from an extents hint. Missing purposes are empty.
+PurposeBounds readExtentsHint(const VtVec3fArray& extentsHint)
+{
+    PurposeBounds result;
+    for (size_t i = 0; i < s_numPurposes && i * 2 + 1 < extentsHint.size(); ++i)
+    {
+        result[i] = GfRange3d(GfVec3d(extentsHint[i * 2]), GfVec3d(extentsHint[i * 2 + 1]));
+    }
+    return result;
+}
 
-        UsdModelAPI model = UsdModelAPI(descendant);
-        TfToken currentKind;
-        bool hasAuthoredKind = model.GetKind(&currentKind);
-        if (currentKind == KindTokens->component)
+//! Write the bounds of each purpose as an extents hint, omitting any trailing empty purposes as per `UsdGeomModelAPI::ComputeExtentsHint`
+VtVec3fArray writeExtentsHint(const PurposeBounds& bounds)
+{
+    size_t numBounds = 1;
+    for (size_t i = 0; i < s_numPurposes; ++i)
+    {
+        if (!bounds[i].IsEmpty())
         {
-            bool success = model.SetKind(KindTokens->subcomponent);
-            if (!success)
+            numBounds = i + 1;
+        }
+    }
+
+    VtVec3fArray result(numBounds * 2);
+    for (size_t i = 0; i < numBounds; ++i)
+    {
+        result[i * 2] = GfVec3f(bounds[i].GetMin());
+        result[i * 2 + 1] = GfVec3f(bounds[i].GetMax());
+    }
+    return result;
+}
+
+//! Determine whether any of the sorted edited paths is the path of the prim or one of its descendants (or their properties)
+bool isEdited(const UsdPrim& prim, const SdfPathVector& editedPaths)
+{
+    const SdfPath& path = prim.GetPath();
+    const auto it = std::lower_bound(editedPaths.begin(), editedPaths.end(), path);
+    return it != editedPaths.end() && it->HasPrefix(path);
+}
+
+//! Flatten the hierarchy below a root prim, determining the role of each prim in the computation of the extents hints.
+//!
+//! When editedPaths are provided, the extents hint of a model prim is only recomputed if it has been edited, or if it does not have an
+//! authored extents hint. Otherwise, its authored extents hint is used as its bound, and its descendants are not traversed.
+ExtentsHintHierarchy flattenExtentsHintHierarchy(const UsdPrim& root, const SdfPathVector* editedPaths, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    ExtentsHintHierarchy result;
+    std::vector<size_t> ancestors;
+    std::vector<VtVec3fArray> extentsHints;
+    // Unloaded prims are traversed so that their authored extents hints can be used
+    UsdPrimRange range(root, UsdTraverseInstanceProxies(UsdPrimIsActive && UsdPrimIsDefined && !UsdPrimIsAbstract));
+    for (auto it = range.begin(); it != range.end(); ++it)
+    {
+        const UsdPrim& prim = *it;
+        const size_t index = result.prims.size();
+        while (!ancestors.empty() && result.prims[ancestors.back()].GetPath() != prim.GetPath().GetParentPath())
+        {
+            ancestors.pop_back();
+        }
+
+        // Models nested within instances can not be authored, so their descendants contribute to the bounds of the nearest editable model
+        ExtentsHintRole role = ExtentsHintRole::eNone;
+        VtVec3fArray extentsHint;
+        const bool isModel = prim == root || (prim.IsModel() && !prim.IsInstanceProxy());
+        if (isModel || !prim.IsLoaded())
+        {
+            UsdGeomModelAPI(prim).GetExtentsHintAttr().Get(&extentsHint, time);
+        }
+        if (!prim.IsLoaded() && prim != root)
+        {
+            role = extentsHint.empty() ? ExtentsHintRole::eNone : ExtentsHintRole::eHint;
+        }
+        else if (isModel && prim != root && !extentsHint.empty() && editedPaths && !::isEdited(prim, *editedPaths))
+        {
+            role = ExtentsHintRole::eHint;
+        }
+        else if (isModel)
+        {
+            role = ExtentsHintRole::eTarget;
+        }
+        else if (prim.IsA<UsdGeomBoundable>())
+        {
+            role = ExtentsHintRole::eExtent;
+        }
+        if (role == ExtentsHintRole::eHint || role == ExtentsHintRole::eExtent)
+        {
+            it.PruneChildren();
+        }
+
+        result.prims.push_back(prim);
+        result.parents.push_back(ancestors.empty() ? index : ancestors.back());
+        result.roles.push_back(role);
+        extentsHints.push_back(std::move(extentsHint));
+        ancestors.push_back(index);
+    }
+
+    // The descendants of each prim are contiguous, so the end of each prim is the end of its last descendant
+    const size_t numPrims = result.prims.size();
+    result.ends.resize(numPrims);
+    for (size_t i = 0; i < numPrims; ++i)
+    {
+        result.ends[i] = i + 1;
+    }
+    for (size_t i = numPrims; i-- > 1;)
+    {
+        result.ends[result.parents[i]] = std::max(result.ends[result.parents[i]], result.ends[i]);
+    }
+
+    // Read the local transform, purpose, and bound of every prim concurrently
+    std::vector<GfMatrix4d> localTransforms(numPrims, GfMatrix4d(1.0));
+    std::vector<char> resetsXformStack(numPrims, 0);
+    std::vector<TfToken> purposes(numPrims);
+    result.bounds.resize(numPrims);
+    WorkParallelForN(
+        numPrims,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
             {
-                TF_WARN("Unable to set the kind of \"%s\" to subcomponent", descendant.GetPath().GetAsString().c_str());
+                const UsdPrim& prim = result.prims[i];
+                UsdGeomImageable imageable(prim);
+                if (!imageable)
+                {
+                    continue;
+                }
+                if (i != 0)
+                {
+                    UsdGeomXformable xformable(prim);
+                    bool resets = false;
+                    if (xformable && xformable.GetLocalTransformation(&localTransforms[i], &resets, time))
+                    {
+                        resetsXformStack[i] = resets;
+                    }
+                    UsdAttribute purposeAttr = imageable.GetPurposeAttr();
+                    if (purposeAttr.HasAuthoredValue())
+                    {
+                        purposeAttr.Get(&purposes[i], time);
+                    }
+                }
+                else
+                {
+                    purposes[i] = imageable.ComputePurpose();
+                }
+
+                if (result.roles[i] == ExtentsHintRole::eHint)
+                {
+                    result.bounds[i] = ::readExtentsHint(extentsHints[i]);
+                }
+                else if (result.roles[i] == ExtentsHintRole::eExtent || (result.roles[i] == ExtentsHintRole::eTarget && prim.IsA<UsdGeomBoundable>()))
+                {
+                    // The extents are usually authored (e.g. by the usdex define functions) but can otherwise be computed
+                    UsdGeomBoundable boundable(prim);
+                    VtVec3fArray extent;
+                    if ((boundable.GetExtentAttr().Get(&extent, time) || UsdGeomBoundable::ComputeExtentFromPlugins(boundable, time, &extent)) &&
+                        extent.size() == 2)
+                    {
+                        result.bounds[i][0] = GfRange3d(GfVec3d(extent[0]), GfVec3d(extent[1]));
+                    }
+                }
             }
         }
-        else if (hasAuthoredKind)
+    );
+
+    // Resolve the inherited purposes and the transforms relative to the root, which depend on the ancestors of each prim
+    const GfMatrix4d rootToWorld = UsdGeomXformCache(time).GetLocalToWorldTransform(root);
+    const GfMatrix4d worldToRoot = rootToWorld.GetInverse();
+    result.transforms.resize(numPrims);
+    for (size_t i = 0; i < numPrims; ++i)
+    {
+        const size_t parent = result.parents[i];
+        if (i != 0)
         {
-            bool success = model.SetKind(_tokens->Empty);
-            if (!success)
+            if (purposes[i].IsEmpty())
             {
-                TF_WARN("Unable to clear the kind of \"%s\"", descendant.GetPath().GetAsString().c_str());
+                purposes[i] = purposes[parent];
             }
+            result.transforms[i] = resetsXformStack[i] ? localTransforms[i] * worldToRoot : localTransforms[i] * result.transforms[parent];
+        }
+        else
+        {
+            result.transforms[i] = GfMatrix4d(1.0);
+        }
+
+        // The extent of a boundable prim is held by the purpose of the prim
+        const size_t purposeIndex = ::getPurposeIndex(purposes[i]);
+        if (purposeIndex != 0 && result.roles[i] != ExtentsHintRole::eHint && !result.bounds[i][0].IsEmpty())
+        {
+            std::swap(result.bounds[i][0], result.bounds[i][purposeIndex]);
+        }
+    }
+
+    return result;
+}
+
+//! Compute the extents hint of each target prim bottom-up, so that the bound of each nested model is computed before the bound of its ancestors
+std::vector<size_t> computeExtentsHints(ExtentsHintHierarchy& hierarchy)
+{
+    TRACE_FUNCTION();
+
+    // Group the target prims by the number of target ancestors, so each group only depends on the bounds of deeper groups
+    const size_t numPrims = hierarchy.prims.size();
+    std::vector<size_t> depths(numPrims, 0);
+    std::vector<std::vector<size_t>> levels;
+    std::vector<size_t> targets;
+    for (size_t i = 0; i < numPrims; ++i)
+    {
+        const size_t parent = hierarchy.parents[i];
+        if (i != 0)
+        {
+            depths[i] = depths[parent] + (hierarchy.roles[parent] == ExtentsHintRole::eTarget ? 1 : 0);
+        }
+        if (hierarchy.roles[i] == ExtentsHintRole::eTarget)
+        {
+            if (levels.size() <= depths[i])
+            {
+                levels.resize(depths[i] + 1);
+            }
+            levels[depths[i]].push_back(i);
+            targets.push_back(i);
+        }
+    }
+
+    for (size_t level = levels.size(); level-- > 0;)
+    {
+        const std::vector<size_t>& indices = levels[level];
+        WorkParallelForN(
+            indices.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t t = begin; t < end; ++t)
+                {
+                    const size_t target = indices[t];
+                    const GfMatrix4d rootToTarget = hierarchy.transforms[target].GetInverse();
+                    PurposeBounds bounds = hierarchy.bounds[target];
+
+                    // Every prim with a bound contributes it in the space of the target, and its descendants are skipped as they are
+                    // already included in its bound
+                    size_t i = target + 1;
+                    while (i < hierarchy.ends[target])
+                    {
+                        if (hierarchy.roles[i] == ExtentsHintRole::eNone)
+                        {
+                            ++i;
+                            continue;
+                        }
+                        const GfMatrix4d toTarget = hierarchy.transforms[i] * rootToTarget;
+                        for (size_t p = 0; p < s_numPurposes; ++p)
+                        {
+                            if (!hierarchy.bounds[i][p].IsEmpty())
+                            {
+                                bounds[p].UnionWith(GfBBox3d(hierarchy.bounds[i][p], toTarget).ComputeAlignedRange());
+                            }
+                        }
+                        i = hierarchy.ends[i];
+                    }
+                    hierarchy.bounds[target] = bounds;
+                }
+            },
+            /* grainSize */ 1
+        );
+    }
+
+    return targets;
+}
+
+//! Author the computed extents hints of the target prims on the edit target of their stage
+bool authorExtentsHints(const ExtentsHintHierarchy& hierarchy, const std::vector<size_t>& targets, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    const UsdStagePtr stage = hierarchy.prims.front().GetStage();
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle layer = editTarget.GetLayer();
+    static const TfToken s_geomModelAPI = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomModelAPI>();
+
+    bool success = true;
+    SdfChangeBlock changeBlock;
+    for (size_t target : targets)
+    {
+        const UsdPrim& prim = hierarchy.prims[target];
+        SdfPrimSpecHandle spec = SdfCreatePrimInLayer(layer, editTarget.MapToSpecPath(prim.GetPath()));
+        if (!spec || !usdex::core::detail::addAppliedSchema(spec, s_geomModelAPI))
+        {
+            TF_WARN("Unable to set the extents hint of \"%s\"", prim.GetPath().GetAsString().c_str());
+            success = false;
+            continue;
+        }
+
+        SdfAttributeSpecHandle attr = layer->GetAttributeAtPath(spec->GetPath().AppendProperty(UsdGeomTokens->extentsHint));
+        if (!attr)
+        {
+            attr = SdfAttributeSpec::New(spec, UsdGeomTokens->extentsHint, SdfValueTypeNames->Float3Array);
+        }
+
+        const VtValue extentsHint(::writeExtentsHint(hierarchy.bounds[target]));
+        if (attr && !time.IsDefault())
+        {
+            layer->SetTimeSample(attr->GetPath(), time.GetValue(), extentsHint);
+        }
+        else if (!attr || !attr->SetDefaultValue(extentsHint))
+        {
+            TF_WARN("Unable to set the extents hint of \"%s\"", prim.GetPath().GetAsString().c_str());
+            success = false;
         }
     }
+
+    return success;
+}
+
+//! Compute and author the extents hints of a root prim and the model prims below it
+bool authorExtentsHintsImpl(const UsdPrim& root, const SdfPathVector* editedPaths, UsdTimeCode time)
+{
+    if (!root)
+    {
+        TF_RUNTIME_ERROR("Unable to author extents hints due to an invalid root prim");
+        return false;
+    }
+    if (!root.IsLoaded())
+    {
+        TF_RUNTIME_ERROR("Unable to author extents hints of <%s> as it is not loaded", root.GetPath().GetAsString().c_str());
+        return false;
+    }
+
+    ExtentsHintHierarchy hierarchy = ::flattenExtentsHintHierarchy(root, editedPaths, time);
+    if (hierarchy.prims.empty())
+    {
+        TF_RUNTIME_ERROR("Unable to author extents hints of <%s> as it is not an active and defined prim", root.GetPath().GetAsString().c_str());
+        return false;
+    }
+
+    const std::vector<size_t> targets = ::computeExtentsHints(hierarchy);
+    return ::authorExtentsHints(hierarchy, targets, time);
 }
 } // namespace
 
 UsdGeomScope usdex::core::defineScope(UsdStagePtr stage, const SdfPath& path)
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -309,23 +1369,20 @@ UsdGeomScope usdex::core::defineScope(UsdStagePtr stage, const SdfPath& path)
     }
 
     // Define the Scope and check that this was successful
-    UsdGeomScope scope = UsdGeomScope::Define(stage, path);
+    UsdGeomScope scope = usdex::core::detail::definePrim<UsdGeomScope>(stage, path);
     if (!scope)
     {
         TF_RUNTIME_ERROR("Unable to define UsdGeomScope at \"%s\"", path.GetAsString().c_str());
         return UsdGeomScope();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = scope.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
-
     return scope;
 }
 
 UsdGeomScope usdex::core::defineScope(UsdPrim parent, const std::string& name)
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -342,6 +1399,8 @@ UsdGeomScope usdex::core::defineScope(UsdPrim parent, const std::string& name)
 
 UsdGeomScope usdex::core::defineScope(UsdPrim prim)
 {
+    TRACE_FUNCTION();
+
     if (!prim)
     {
         TF_RUNTIME_ERROR("Unable to define UsdGeomScope due to an invalid prim");
@@ -368,7 +1427,12 @@ const TfToken& usdex::core::getGeometryToken()
 
 const TfToken& usdex::core::getLibraryToken()
 {
-    return _tokens->Library;
+    return _tokens->Library;
+}
+
+const TfToken& usdex::core::getLodToken()
+{
+    return _tokens->LOD;
 }
 
 const TfToken& usdex::core::getMaterialsToken()
@@ -397,55 +1461,40 @@ UsdStageRefPtr usdex::core::createAssetPayload(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs
 )
 {
-    if (!stage)
-    {
-        TF_WARN("Unable to create asset payload stage due to an invalid asset stage");
-        return nullptr;
-    }
-
-    if (stage->GetRootLayer()->IsAnonymous())
-    {
-        TF_WARN("Unable to create asset payload stage due to an anonymous asset stage");
-        return nullptr;
-    }
+    TRACE_FUNCTION();
 
-    ArResolver& resolver = ArGetResolver();
     std::string relativeIdentifier = TfStringPrintf(
         "./%s/%s.%s",
         usdex::core::getPayloadToken().GetText(),
         usdex::core::getContentsToken().GetText(),
         format.c_str()
     );
-    std::string identifier = resolver.CreateIdentifier(relativeIdentifier, resolver.Resolve(stage->GetRootLayer()->GetIdentifier()));
+    return ::createAssetPayloadStage(stage, relativeIdentifier, fileFormatArgs);
+}
 
-    UsdStageRefPtr payloadStage = usdex::core::createStage(
-        identifier,
-        stage->GetDefaultPrim().GetName(),
-        UsdGeomGetStageUpAxis(stage),
-        UsdGeomGetStageMetersPerUnit(stage),
-        usdex::core::getLayerAuthoringMetadata(stage->GetRootLayer()),
-        fileFormatArgs
-    );
-    if (!payloadStage)
-    {
-        TF_WARN("Unable to create asset payload stage");
-        return nullptr;
-    }
+UsdStageRefPtr usdex::core::createAssetLodPayload(
+    pxr::UsdStagePtr stage,
+    const std::string& lod,
+    const std::string& format,
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    TRACE_FUNCTION();
 
-    // Copy the asset stage's default prim to the asset payload stage
-    bool success = SdfCopySpec(
-        stage->GetRootLayer(),
-        stage->GetDefaultPrim().GetPath(),
-        payloadStage->GetRootLayer(),
-        payloadStage->GetDefaultPrim().GetPath()
-    );
-    if (!success)
+    if (!SdfPath::IsValidIdentifier(lod))
     {
-        TF_WARN("Unable to copy the asset stage's default prim to the asset payload stage");
+        TF_WARN("Unable to create asset LOD payload stage due to an invalid LOD name \"%s\"", lod.c_str());
         return nullptr;
     }
 
-    return payloadStage;
+    std::string relativeIdentifier = TfStringPrintf(
+        "./%s/%s/%s.%s",
+        usdex::core::getPayloadToken().GetText(),
+        lod.c_str(),
+        usdex::core::getContentsToken().GetText(),
+        format.c_str()
+    );
+    return ::createAssetPayloadStage(stage, relativeIdentifier, fileFormatArgs);
 }
 
 UsdStageRefPtr usdex::core::addAssetLibrary(
@@ -455,6 +1504,8 @@ UsdStageRefPtr usdex::core::addAssetLibrary(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs
 )
 {
+    TRACE_FUNCTION();
+
     if (!stage)
     {
         TF_WARN("Unable to add asset library due to an invalid payload stage");
@@ -507,6 +1558,8 @@ UsdStageRefPtr usdex::core::addAssetContent(
     bool createScope
 )
 {
+    TRACE_FUNCTION();
+
     if (!stage)
     {
         TF_WARN("Unable to add asset content due to an invalid payload stage");
@@ -579,6 +1632,8 @@ UsdStageRefPtr usdex::core::addAssetContent(
 
 bool usdex::core::addAssetInterface(UsdStagePtr stage, const UsdStagePtr source)
 {
+    TRACE_FUNCTION();
+
     if (!stage)
     {
         TF_WARN("Unable to add asset interface due to an invalid stage");
@@ -603,17 +1658,8 @@ bool usdex::core::addAssetInterface(UsdStagePtr stage, const UsdStagePtr source)
         return false;
     }
 
-    usdex::core::configureStage(
-        stage,
-        source->GetDefaultPrim().GetName(),
-        UsdGeomGetStageUpAxis(source),
-        UsdGeomGetStageMetersPerUnit(source),
-        usdex::core::getLayerAuthoringMetadata(source->GetRootLayer())
-    );
-    bool success = SdfCopySpec(source->GetRootLayer(), source->GetDefaultPrim().GetPath(), stage->GetRootLayer(), stage->GetDefaultPrim().GetPath());
-    if (!success)
+    if (!::copyAssetInterface(stage, source))
     {
-        TF_WARN("Unable to copy the source stage's default prim to the stage");
         return false;
     }
 
@@ -627,60 +1673,307 @@ bool usdex::core::addAssetInterface(UsdStagePtr stage, const UsdStagePtr source)
         return false;
     }
 
-    // annotate the asset interface
-    UsdModelAPI model = UsdModelAPI(root);
-    model.SetAssetName(usdex::core::computeEffectiveDisplayName(root));
-    ::createAssetComponent(root);
+    return ::annotateAssetInterface(root);
+}
 
-    UsdGeomModelAPI geomModel = UsdGeomModelAPI::Apply(root);
-    if (!geomModel)
+bool usdex::core::addAssetInterface(SdfLayerHandle layer, const SdfLayerHandle source)
+{
+    return ::addAssetInterfaceSpecs(layer, source);
+}
+
+bool usdex::core::addAssetInterfaces(const std::vector<SdfLayerHandle>& layers, const std::vector<SdfLayerHandle>& sources)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "addAssetInterfaces");
+
+    if (layers.size() != sources.size())
     {
-        TF_WARN("Unable to apply the UsdGeomModelAPI to the default prim");
+        TF_WARN("Unable to add asset interfaces due to mismatched sources: %zu layers and %zu sources", layers.size(), sources.size());
         return false;
     }
+    instrumentation.addElements(layers.size());
 
-    UsdGeomBBoxCache bboxCache(UsdTimeCode::Default(), UsdGeomImageable(root).GetOrderedPurposeTokens());
-    success = geomModel.SetExtentsHint(geomModel.ComputeExtentsHint(bboxCache));
-    if (!success)
+    // Each Asset Interface only edits its own layer, and only reads the layer stack of its source, so the interfaces can be authored concurrently
+    std::vector<char> added(layers.size(), 0);
+    WorkParallelForN(
+        layers.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                added[i] = ::addAssetInterfaceSpecs(layers[i], sources[i]);
+            }
+        }
+    );
+
+    return std::find(added.begin(), added.end(), 0) == added.end();
+}
+
+bool usdex::core::addAssetLodInterface(
+    UsdStagePtr stage,
+    const std::vector<std::pair<std::string, UsdStagePtr>>& lodSources,
+    const std::string& defaultLod
+)
+{
+    TRACE_FUNCTION();
+
+    if (!stage)
     {
-        TF_WARN("Unable to set the extents hint for the default prim");
+        TF_WARN("Unable to add asset LOD interface due to an invalid stage");
         return false;
     }
 
-    return true;
+    if (stage->GetRootLayer()->IsAnonymous())
+    {
+        TF_WARN("Unable to add asset LOD interface due to an anonymous stage");
+        return false;
+    }
+
+    UsdStagePtr defaultSource;
+    for (const auto& [lod, source] : lodSources)
+    {
+        if (!SdfPath::IsValidIdentifier(lod))
+        {
+            TF_WARN("Unable to add asset LOD interface due to an invalid LOD name \"%s\"", lod.c_str());
+            return false;
+        }
+
+        if (!source)
+        {
+            TF_WARN("Unable to add asset LOD interface due to an invalid source stage for LOD \"%s\"", lod.c_str());
+            return false;
+        }
+
+        if (source->GetRootLayer()->IsAnonymous())
+        {
+            TF_WARN("Unable to add asset LOD interface due to an anonymous source stage for LOD \"%s\"", lod.c_str());
+            return false;
+        }
+
+        if (lod == defaultLod)
+        {
+            defaultSource = source;
+        }
+    }
+
+    if (!defaultSource)
+    {
+        TF_WARN("Unable to add asset LOD interface due to a default LOD \"%s\" which is not one of the LODs", defaultLod.c_str());
+        return false;
+    }
+
+    if (!::copyAssetInterface(stage, defaultSource))
+    {
+        return false;
+    }
+
+    UsdPrim root = stage->GetDefaultPrim();
+    UsdVariantSet variantSet = root.GetVariantSets().AddVariantSet(usdex::core::getLodToken());
+    if (!variantSet)
+    {
+        TF_WARN("Unable to add the LOD variant set to the default prim");
+        return false;
+    }
+
+    // Author the payload for each LOD directly within its variant spec, rather than selecting each variant in turn,
+    // so that no LOD other than the default is ever composed (and its layers opened) by the asset stage.
+    const SdfLayerHandle& layer = stage->GetRootLayer();
+    ::ReferencePayloadCache cache;
+    for (const auto& [lod, source] : lodSources)
+    {
+        ::ReferencePayloadTarget target;
+        if (!::getReferencePayloadTarget(stage, root.GetPath(), source->GetDefaultPrim(), cache, target))
+        {
+            TF_WARN("Unable to define payload for LOD \"%s\" in the stage", lod.c_str());
+            return false;
+        }
+
+        SdfPrimSpecHandle variantSpec = SdfCreatePrimInLayer(layer, root.GetPath().AppendVariantSelection(usdex::core::getLodToken(), lod));
+        if (!variantSpec)
+        {
+            TF_WARN("Unable to define payload for LOD \"%s\" in the stage", lod.c_str());
+            return false;
+        }
+        const SdfPath sourcePath = source->GetDefaultPrim().GetPath();
+        SdfPayload payload = target.isInternal ? SdfPayload(std::string(), sourcePath) : SdfPayload(target.relativeIdentifier);
+        variantSpec->GetPayloadList().GetPrependedItems().push_back(payload);
+    }
+
+    if (!variantSet.SetVariantSelection(defaultLod))
+    {
+        TF_WARN("Unable to select the default LOD \"%s\"", defaultLod.c_str());
+        return false;
+    }
+
+    return ::annotateAssetInterface(root);
 }
 
-UsdPrim usdex::core::defineReference(UsdStagePtr stage, const SdfPath& path, const UsdPrim& source)
+bool usdex::core::authorExtentsHints(UsdPrim root, UsdTimeCode time)
 {
-    // Create the common prim structure and get the relative identifier
-    std::string relativeIdentifier;
-    bool isInternal = false;
-    bool sourceIsDefaultPrim = false;
-    UsdPrim newPrim = ::createReferencePayloadPrim(stage, path, source, relativeIdentifier, isInternal, sourceIsDefaultPrim);
-    if (!newPrim)
+    TRACE_FUNCTION();
+
+    return ::authorExtentsHintsImpl(root, nullptr, time);
+}
+
+bool usdex::core::updateExtentsHints(UsdPrim root, const SdfPathVector& editedPaths, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    // Only the edits within the root can affect its extents hints
+    SdfPathVector sortedPaths;
+    if (root)
     {
-        return UsdPrim();
+        std::copy_if(
+            editedPaths.begin(),
+            editedPaths.end(),
+            std::back_inserter(sortedPaths),
+            [&root](const SdfPath& path)
+            {
+                return path.HasPrefix(root.GetPath());
+            }
+        );
+        if (sortedPaths.empty())
+        {
+            return true;
+        }
+        std::sort(sortedPaths.begin(), sortedPaths.end());
     }
 
-    // Add the reference with relative path
-    if (isInternal)
+    return ::authorExtentsHintsImpl(root, &sortedPaths, time);
+}
+
+bool usdex::core::authorAssetContents(
+    UsdStagePtr stage,
+    const std::vector<AssetContentStream>& streams,
+    const std::string& payloadFormat,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    TRACE_FUNCTION();
+
+    // Create all of the layers up front, so that the workers never modify a layer which is shared with another stream
+    UsdStageRefPtr payloadStage = usdex::core::createAssetPayload(stage, payloadFormat, fileFormatArgs);
+    if (!payloadStage)
+    {
+        TF_WARN("Unable to author asset contents due to an invalid asset payload stage");
+        return false;
+    }
+
+    std::vector<UsdStageRefPtr> contentStages(streams.size());
+    std::vector<UsdStageRefPtr> libraryStages(streams.size());
+    for (size_t i = 0; i < streams.size(); ++i)
+    {
+        const AssetContentStream& stream = streams[i];
+        if (!stream.author)
+        {
+            TF_WARN("Unable to author asset content \"%s\" due to an invalid author function", stream.name.c_str());
+            return false;
+        }
+
+        if (stream.addLibrary)
+        {
+            libraryStages[i] = usdex::core::addAssetLibrary(payloadStage, stream.name, stream.libraryFormat, stream.fileFormatArgs);
+            if (!libraryStages[i])
+            {
+                TF_WARN("Unable to author asset content \"%s\" due to an invalid asset library stage", stream.name.c_str());
+                return false;
+            }
+        }
+
+        contentStages[i] = usdex::core::addAssetContent(payloadStage, stream.name, stream.format, stream.fileFormatArgs);
+        if (!contentStages[i])
+        {
+            TF_WARN("Unable to author asset content \"%s\" due to an invalid asset content stage", stream.name.c_str());
+            return false;
+        }
+    }
+
+    // The payload stage composes every content layer, so it would recompose concurrently as the workers edit their layers.
+    // Only the payload layer is retained while the streams are authored, and the stage is reopened once all of the workers have finished.
+    SdfLayerRefPtr payloadLayer = payloadStage->GetRootLayer();
+    payloadStage = nullptr;
+
+    // Author and save each stream on its own worker. Diagnostics are emitted by the workers, but the results are reported in order afterwards.
+    std::vector<char> authored(streams.size(), 0);
+    std::vector<char> saved(streams.size(), 0);
+    WorkParallelForN(
+        streams.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                TRACE_SCOPE("Author asset content");
+                NameCache nameCache;
+                authored[i] = streams[i].author(contentStages[i], libraryStages[i], nameCache);
+                if (!authored[i])
+                {
+                    continue;
+                }
+
+                bool success = true;
+                if (libraryStages[i])
+                {
+                    success &= usdex::core::saveDirtyLayers(libraryStages[i]);
+                }
+                success &= usdex::core::saveDirtyLayers(contentStages[i]);
+                saved[i] = success;
+            }
+        },
+        1
+    );
+
+    bool success = true;
+    for (size_t i = 0; i < streams.size(); ++i)
+    {
+        if (!authored[i])
+        {
+            TF_WARN("Unable to author asset content \"%s\"", streams[i].name.c_str());
+            success = false;
+        }
+        else if (!saved[i])
+        {
+            TF_WARN("Unable to save asset content \"%s\"", streams[i].name.c_str());
+            success = false;
+        }
+    }
+    if (!success)
     {
-        newPrim.GetReferences().AddInternalReference(source.GetPath());
+        return false;
     }
-    else if (sourceIsDefaultPrim)
+
+    // The payload layer now sublayers every saved content layer, so it can be saved and targeted by the Asset Interface
+    payloadStage = UsdStage::Open(payloadLayer);
+    if (!usdex::core::saveDirtyLayers(payloadStage))
     {
-        newPrim.GetReferences().AddReference(relativeIdentifier);
+        TF_WARN("Unable to save the asset payload stage");
+        return false;
     }
-    else
+
+    return usdex::core::addAssetInterface(stage, payloadStage);
+}
+
+UsdPrim usdex::core::defineReference(UsdStagePtr stage, const SdfPath& path, const UsdPrim& source)
+{
+    TRACE_FUNCTION();
+
+    // Create the common prim structure and get the relative identifier
+    ::ReferencePayloadTarget target;
+    UsdPrim newPrim = ::createReferencePayloadPrim(stage, path, source, target);
+    if (!newPrim)
     {
-        newPrim.GetReferences().AddReference(relativeIdentifier, source.GetPath());
+        return UsdPrim();
     }
 
+    // Add the reference with relative path
+    ::addReference(newPrim, source, target);
+
     return newPrim;
 }
 
 UsdPrim usdex::core::defineReference(UsdPrim parent, const UsdPrim& source, std::optional<std::string_view> name)
 {
+    TRACE_FUNCTION();
+
     SdfPath path;
     if (!::getReferencePayloadPrimPath(parent, source, name, path))
     {
@@ -689,37 +1982,37 @@ UsdPrim usdex::core::defineReference(UsdPrim parent, const UsdPrim& source, std:
     return usdex::core::defineReference(parent.GetStage(), path, source);
 }
 
+std::vector<UsdPrim> usdex::core::defineReferences(UsdStagePtr stage, const SdfPathVector& paths, const std::vector<UsdPrim>& sources)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "defineReferences");
+    instrumentation.addElements(paths.size());
+
+    return ::createReferencePayloadPrims(stage, paths, sources, ::addReference);
+}
+
 UsdPrim usdex::core::definePayload(UsdStagePtr stage, const SdfPath& path, const UsdPrim& source)
 {
+    TRACE_FUNCTION();
+
     // Create the common prim structure and get the relative identifier
-    std::string relativeIdentifier;
-    bool isInternal = false;
-    bool sourceIsDefaultPrim = false;
-    UsdPrim newPrim = ::createReferencePayloadPrim(stage, path, source, relativeIdentifier, isInternal, sourceIsDefaultPrim);
+    ::ReferencePayloadTarget target;
+    UsdPrim newPrim = ::createReferencePayloadPrim(stage, path, source, target);
     if (!newPrim)
     {
         return UsdPrim();
     }
 
     // Add the payload with relative path
-    if (isInternal)
-    {
-        newPrim.GetPayloads().AddInternalPayload(source.GetPath());
-    }
-    else if (sourceIsDefaultPrim)
-    {
-        newPrim.GetPayloads().AddPayload(relativeIdentifier);
-    }
-    else
-    {
-        newPrim.GetPayloads().AddPayload(relativeIdentifier, source.GetPath());
-    }
+    ::addPayload(newPrim, source, target);
 
     return newPrim;
 }
 
 UsdPrim usdex::core::definePayload(UsdPrim parent, const UsdPrim& source, std::optional<std::string_view> name)
 {
+    TRACE_FUNCTION();
+
     SdfPath path;
     if (!::getReferencePayloadPrimPath(parent, source, name, path))
     {
@@ -727,3 +2020,78 @@ UsdPrim usdex::core::definePayload(UsdPrim parent, const UsdPrim& source, std::o
     }
     return usdex::core::definePayload(parent.GetStage(), path, source);
 }
+
+std::vector<UsdPrim> usdex::core::definePayloads(UsdStagePtr stage, const SdfPathVector& paths, const std::vector<UsdPrim>& sources)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "definePayloads");
+    instrumentation.addElements(paths.size());
+
+    return ::createReferencePayloadPrims(stage, paths, sources, ::addPayload);
+}
+
+InstancingReport usdex::core::instanceRepeatedReferences(UsdStagePtr stage, size_t minInstances)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "instanceRepeatedReferences");
+
+    InstancingReport report;
+    if (!stage)
+    {
+        TF_WARN("Unable to instance repeated references due to an invalid stage");
+        return report;
+    }
+
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+
+    // Group the candidate prims by their composition arcs. Traversal does not descend into existing instances or into candidates, as any
+    // references within them are not authored in the edit target layer.
+    std::unordered_map<std::string, std::vector<UsdPrim>> groups;
+    UsdPrimRange range = stage->Traverse();
+    for (auto it = range.begin(); it != range.end(); ++it)
+    {
+        const UsdPrim& prim = *it;
+        SdfPrimSpecHandle spec = layer->GetPrimAtPath(editTarget.MapToSpecPath(prim.GetPath()));
+        if (!spec || (!spec->HasReferences() && !spec->HasPayloads()))
+        {
+            continue;
+        }
+
+        // Respect an explicit instanceable opinion and never discard a descendant opinion
+        if (prim.HasAuthoredInstanceable() || ::hasDescendantOpinions(prim))
+        {
+            continue;
+        }
+
+        groups[::getInstancingKey(spec)].push_back(prim);
+        report.candidatePrims++;
+        it.PruneChildren();
+    }
+    instrumentation.addElements(report.candidatePrims);
+
+    {
+        SdfChangeBlock changeBlock;
+        for (const auto& [key, prims] : groups)
+        {
+            if (prims.size() < minInstances)
+            {
+                continue;
+            }
+
+            for (const UsdPrim& prim : prims)
+            {
+                prim.SetInstanceable(true);
+            }
+            report.instancedPrims += prims.size();
+            report.prototypes++;
+        }
+    }
+
+    if (report.prototypes > 0)
+    {
+        report.instancingRatio = static_cast<double>(report.instancedPrims) / static_cast<double>(report.prototypes);
+    }
+
+    return report;
+}
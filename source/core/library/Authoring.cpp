@@ -0,0 +1,675 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "usdex/core/Authoring.h"
+
+#include "usdex/core/LayerAlgo.h"
+#include "usdex/core/StageAlgo.h"
+
+#include "SdfUtils.h"
+
+#include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/fileFormat.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/clipsAPI.h>
+#include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usdGeom/metrics.h>
+#include <pxr/usd/usdPhysics/metrics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <optional>
+#include <unordered_map>
+
+using namespace usdex::core;
+using namespace pxr;
+
+namespace
+{
+
+thread_local AuthoringBackend g_authoringBackend = AuthoringBackend::eUsd;
+thread_local ValidationPolicy g_validationPolicy = ValidationPolicy::eFull;
+
+class ValueClipWriter;
+thread_local ValueClipWriter* g_valueClipWriter = nullptr;
+
+class AuthoringSessionState;
+thread_local AuthoringSessionState* g_authoringSession = nullptr;
+
+// The state of an AuthoringSession which is shared with the validation of the authoring calls made on the thread of the session
+class AuthoringSessionState
+{
+
+public:
+
+    explicit AuthoringSessionState(const UsdStagePtr& stage) : m_stage(stage), m_previous(g_authoringSession)
+    {
+        g_authoringSession = this;
+    }
+
+    void end()
+    {
+        if (m_active)
+        {
+            g_authoringSession = m_previous;
+            m_active = false;
+        }
+    }
+
+    std::optional<bool> isParentInstanced(const UsdStagePtr& stage, const SdfPath& parentPath)
+    {
+        if (stage != m_stage)
+        {
+            return m_previous ? m_previous->isParentInstanced(stage, parentPath) : std::nullopt;
+        }
+
+        auto it = m_parentIsInstanced.find(parentPath);
+        if (it != m_parentIsInstanced.end())
+        {
+            return it->second;
+        }
+
+        // A missing parent is not cached, as it may be defined later in the session
+        const UsdPrim parent = stage->GetPrimAtPath(parentPath);
+        if (!parent)
+        {
+            return false;
+        }
+        return m_parentIsInstanced.emplace(parentPath, parent.IsInstance() || parent.IsInstanceProxy()).first->second;
+    }
+
+    UsdStagePtr getStage() const
+    {
+        return m_stage;
+    }
+
+private:
+
+    UsdStagePtr m_stage;
+    AuthoringSessionState* m_previous;
+    bool m_active = true;
+
+    // Whether the prim at each parent path is an instance or instance proxy, in which case any existing child is an instance proxy
+    std::unordered_map<SdfPath, bool, SdfPath::Hash> m_parentIsInstanced;
+};
+
+// The state of a ValueClipSession, to which the time samples authored on the thread of the session are written
+class ValueClipWriter
+{
+
+public:
+
+    ValueClipWriter(const UsdPrim& prim, const std::string& name, const ValueClipOptions& options) : m_prim(prim), m_name(name), m_options(options)
+    {
+        if (!prim)
+        {
+            TF_RUNTIME_ERROR("Unable to author value clips due to an invalid prim");
+            return;
+        }
+
+        m_editTarget = prim.GetStage()->GetEditTarget();
+        const SdfLayerHandle& layer = m_editTarget.GetLayer();
+        const std::string primPath = prim.GetPath().GetAsString();
+        if (!layer || layer->IsAnonymous())
+        {
+            TF_RUNTIME_ERROR("Unable to author value clips for \"%s\" due to an anonymous edit target layer", primPath.c_str());
+            return;
+        }
+        if (!TfIsValidIdentifier(name))
+        {
+            TF_RUNTIME_ERROR("Unable to author value clips for \"%s\" due to an invalid name \"%s\"", primPath.c_str(), name.c_str());
+            return;
+        }
+        if (!(options.framesPerClip > 0.0))
+        {
+            TF_RUNTIME_ERROR("Unable to author value clips for \"%s\" with %f frames per clip", primPath.c_str(), options.framesPerClip);
+            return;
+        }
+        m_fileFormat = SdfFileFormat::FindByExtension(options.format);
+        if (!m_fileFormat)
+        {
+            TF_RUNTIME_ERROR("Unable to author value clips for \"%s\" due to an unsupported format \"%s\"", primPath.c_str(), options.format.c_str());
+            return;
+        }
+        if (!TfIsValidIdentifier(options.clipSet))
+        {
+            TF_RUNTIME_ERROR("Unable to author value clips for \"%s\" due to an invalid clip set \"%s\"", primPath.c_str(), options.clipSet.c_str());
+            return;
+        }
+
+        m_directory = TfStringCatPaths(TfGetPathName(layer->GetRealPath()), name);
+        m_stageToLayer = m_editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+        m_previous = g_valueClipWriter;
+        g_valueClipWriter = this;
+        m_active = true;
+    }
+
+    bool isActive() const
+    {
+        return m_active;
+    }
+
+    std::vector<std::string> getAssetPaths() const
+    {
+        std::vector<std::string> result;
+        result.reserve(m_clips.size());
+        for (const auto& [index, clip] : m_clips)
+        {
+            result.push_back(getAssetPath(index));
+        }
+        return result;
+    }
+
+    std::optional<bool> write(const UsdAttribute& attribute, const std::vector<UsdTimeCode>& times, const std::function<VtValue(size_t)>& valueAt)
+    {
+        // Attributes outside of the clip prim are written by any enclosing session. Only the samples which would otherwise be authored on the
+        // layer holding the clips metadata can be moved to the clips.
+        const UsdStagePtr stage = attribute.GetStage();
+        if (stage != m_prim.GetStage() || !attribute.GetPrimPath().HasPrefix(m_prim.GetPath()) || stage->GetEditTarget() != m_editTarget)
+        {
+            return m_previous ? m_previous->write(attribute, times, valueAt) : std::nullopt;
+        }
+
+        const SdfLayerHandle& layer = m_editTarget.GetLayer();
+        const SdfPath specPath = m_editTarget.MapToSpecPath(attribute.GetPath());
+        const SdfAttributeSpecHandle spec = layer->GetAttributeAtPath(specPath);
+        if (!spec)
+        {
+            return false;
+        }
+
+        // Time samples on the edit target layer are stronger than the clips, so they would hide the clips entirely
+        layer->EraseField(specPath, SdfFieldKeys->TimeSamples);
+
+        std::vector<double> layerTimes(times.size());
+        std::map<int64_t, std::vector<size_t>> clipSamples;
+        for (size_t i = 0; i < times.size(); ++i)
+        {
+            layerTimes[i] = m_stageToLayer * times[i].GetValue();
+            clipSamples[static_cast<int64_t>(std::floor(layerTimes[i] / m_options.framesPerClip))].push_back(i);
+            m_firstTime = std::min(m_firstTime, layerTimes[i]);
+            m_lastTime = std::max(m_lastTime, layerTimes[i]);
+        }
+
+        // The clip layers are created up front, as each worker only authors to its own clip.
+        // Each clip also holds the first sample of the following clip, so that values are interpolated across the boundary.
+        std::vector<std::pair<SdfLayerHandle, std::vector<size_t>>> clips;
+        clips.reserve(clipSamples.size());
+        for (auto it = clipSamples.begin(); it != clipSamples.end(); ++it)
+        {
+            std::vector<size_t> indices = it->second;
+            const auto next = std::next(it);
+            if (next != clipSamples.end() && next->first == it->first + 1)
+            {
+                const auto earliest = [&layerTimes](size_t a, size_t b)
+                {
+                    return layerTimes[a] < layerTimes[b];
+                };
+                indices.push_back(*std::min_element(next->second.begin(), next->second.end(), earliest));
+            }
+            clips.emplace_back(getClipLayer(it->first), std::move(indices));
+        }
+
+        const SdfPath& path = attribute.GetPath();
+        const SdfValueTypeName typeName = spec->GetTypeName();
+        const SdfVariability variability = spec->GetVariability();
+        const bool custom = spec->IsCustom();
+        std::vector<char> authored(clips.size(), 0);
+        WorkParallelForN(
+            clips.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    TRACE_SCOPE("Author clip");
+                    const SdfLayerHandle& clip = clips[i].first;
+                    SdfChangeBlock changeBlock;
+                    if (!clip->GetAttributeAtPath(path))
+                    {
+                        const SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(clip, path.GetPrimPath());
+                        if (!primSpec || !SdfAttributeSpec::New(primSpec, path.GetName(), typeName, variability, custom))
+                        {
+                            continue;
+                        }
+                    }
+                    for (size_t index : clips[i].second)
+                    {
+                        clip->SetTimeSample(path, layerTimes[index], valueAt(index));
+                    }
+                    authored[i] = 1;
+                }
+            },
+            /* grainSize */ 1
+        );
+        return std::all_of(authored.begin(), authored.end(), [](char value) { return value != 0; });
+    }
+
+    bool end()
+    {
+        if (!m_active)
+        {
+            return true;
+        }
+        m_active = false;
+        g_valueClipWriter = m_previous;
+
+        if (m_clips.empty())
+        {
+            return true;
+        }
+
+        TRACE_FUNCTION();
+
+        // Export each clip on its own worker
+        const std::string authoringMetadata = getLayerAuthoringMetadata(m_editTarget.GetLayer());
+        std::vector<int64_t> indices;
+        SdfLayerHandleVector layers;
+        for (const auto& [index, clip] : m_clips)
+        {
+            indices.push_back(index);
+            layers.push_back(clip);
+        }
+        std::vector<char> exported(layers.size(), 0);
+        WorkParallelForN(
+            layers.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    exported[i] = usdex::core::exportLayer(layers[i], getIdentifier(indices[i]), authoringMetadata);
+                }
+            },
+            /* grainSize */ 1
+        );
+
+        const std::string primPath = m_prim.GetPath().GetAsString();
+        if (!std::all_of(exported.begin(), exported.end(), [](char value) { return value != 0; }))
+        {
+            TF_WARN("Unable to author value clips for \"%s\" as the clip layers could not be exported", primPath.c_str());
+            return false;
+        }
+
+        // The manifest declares every attribute of the clips, so the stage does not need to open each clip to discover them
+        const SdfLayerRefPtr manifest = UsdClipsAPI::GenerateClipManifestFromLayers(layers, m_prim.GetPath());
+        if (!manifest || !usdex::core::exportLayer(manifest, getIdentifier("manifest"), authoringMetadata))
+        {
+            TF_WARN("Unable to author value clips for \"%s\" as the manifest could not be exported", primPath.c_str());
+            return false;
+        }
+
+        // Each clip is active from the start of its frames, and the times of the clips are those of the layer
+        VtArray<SdfAssetPath> assetPaths;
+        VtVec2dArray active;
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            assetPaths.push_back(SdfAssetPath(getAssetPath(indices[i])));
+            active.push_back(GfVec2d(static_cast<double>(indices[i]) * m_options.framesPerClip, static_cast<double>(i)));
+        }
+        VtVec2dArray clipTimes = { GfVec2d(m_firstTime, m_firstTime) };
+        if (m_lastTime != m_firstTime)
+        {
+            clipTimes.push_back(GfVec2d(m_lastTime, m_lastTime));
+        }
+
+        UsdEditContext editContext(m_prim.GetStage(), m_editTarget);
+        UsdClipsAPI clipsAPI(m_prim);
+        const std::string& clipSet = m_options.clipSet;
+        if (!clipsAPI.SetClipPrimPath(m_prim.GetPath().GetString(), clipSet) || !clipsAPI.SetClipAssetPaths(assetPaths, clipSet) ||
+            !clipsAPI.SetClipActive(active, clipSet) || !clipsAPI.SetClipTimes(clipTimes, clipSet) ||
+            !clipsAPI.SetClipManifestAssetPath(SdfAssetPath(getAssetPath("manifest")), clipSet) ||
+            !clipsAPI.SetInterpolateMissingClipValues(true, clipSet))
+        {
+            TF_WARN("Unable to author the value clips metadata of \"%s\"", primPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+private:
+
+    std::string getFileName(const std::string& suffix) const
+    {
+        return TfStringPrintf("%s.%s.%s", m_name.c_str(), suffix.c_str(), m_options.format.c_str());
+    }
+
+    std::string getFileName(int64_t index) const
+    {
+        return getFileName(TfStringPrintf("%04lld", static_cast<long long>(index)));
+    }
+
+    template <typename Suffix>
+    std::string getIdentifier(const Suffix& suffix) const
+    {
+        return TfStringCatPaths(m_directory, getFileName(suffix));
+    }
+
+    template <typename Suffix>
+    std::string getAssetPath(const Suffix& suffix) const
+    {
+        return TfStringPrintf("./%s/%s", m_name.c_str(), getFileName(suffix).c_str());
+    }
+
+    const SdfLayerRefPtr& getClipLayer(int64_t index)
+    {
+        SdfLayerRefPtr& clip = m_clips[index];
+        if (!clip)
+        {
+            clip = SdfLayer::CreateAnonymous(getFileName(index), m_fileFormat);
+        }
+        return clip;
+    }
+
+    UsdPrim m_prim;
+    std::string m_name;
+    ValueClipOptions m_options;
+    UsdEditTarget m_editTarget;
+    SdfFileFormatConstPtr m_fileFormat;
+    std::string m_directory;
+    SdfLayerOffset m_stageToLayer;
+    std::map<int64_t, SdfLayerRefPtr> m_clips;
+    double m_firstTime = std::numeric_limits<double>::max();
+    double m_lastTime = std::numeric_limits<double>::lowest();
+    ValueClipWriter* m_previous = nullptr;
+    bool m_active = false;
+};
+
+} // namespace
+
+AuthoringBackend usdex::core::getAuthoringBackend()
+{
+    return g_authoringBackend;
+}
+
+void usdex::core::setAuthoringBackend(AuthoringBackend value)
+{
+    g_authoringBackend = value;
+}
+
+usdex::core::ScopedAuthoringBackend::ScopedAuthoringBackend(AuthoringBackend value) : m_previous(g_authoringBackend)
+{
+    g_authoringBackend = value;
+}
+
+usdex::core::ScopedAuthoringBackend::~ScopedAuthoringBackend()
+{
+    g_authoringBackend = m_previous;
+}
+
+ValidationPolicy usdex::core::getValidationPolicy()
+{
+    return g_validationPolicy;
+}
+
+void usdex::core::setValidationPolicy(ValidationPolicy value)
+{
+    g_validationPolicy = value;
+}
+
+usdex::core::ScopedValidationPolicy::ScopedValidationPolicy(ValidationPolicy value) : m_previous(g_validationPolicy)
+{
+    g_validationPolicy = value;
+}
+
+usdex::core::ScopedValidationPolicy::~ScopedValidationPolicy()
+{
+    g_validationPolicy = m_previous;
+}
+
+class usdex::core::AuthoringSession::AuthoringSessionImpl : public AuthoringSessionState
+{
+
+public:
+
+    AuthoringSessionImpl(UsdStagePtr stage, const UsdEditTarget& editTarget)
+        : AuthoringSessionState(stage),
+          upAxis(UsdGeomGetStageUpAxis(stage)),
+          linearUnits(UsdGeomGetStageMetersPerUnit(stage)),
+          massUnits(UsdPhysicsGetStageKilogramsPerUnit(stage))
+    {
+        editContext.emplace(stage, editTarget);
+        backend.emplace(AuthoringBackend::eSdf);
+    }
+
+    void end()
+    {
+        // Restore the state in the reverse order it was applied
+        backend.reset();
+        editContext.reset();
+        AuthoringSessionState::end();
+    }
+
+    TfToken upAxis;
+    double linearUnits;
+    double massUnits;
+    NameCache nameCache;
+
+    std::optional<UsdEditContext> editContext;
+    std::optional<ScopedAuthoringBackend> backend;
+};
+
+usdex::core::AuthoringSession::AuthoringSession(UsdStagePtr stage) : AuthoringSession(stage, stage->GetEditTarget())
+{
+}
+
+usdex::core::AuthoringSession::AuthoringSession(UsdStagePtr stage, const UsdEditTarget& editTarget)
+{
+    m_impl = new AuthoringSessionImpl(stage, editTarget);
+}
+
+usdex::core::AuthoringSession::~AuthoringSession()
+{
+    m_impl->end();
+    delete m_impl;
+}
+
+void usdex::core::AuthoringSession::end()
+{
+    m_impl->end();
+}
+
+bool usdex::core::AuthoringSession::isActive() const
+{
+    return m_impl->backend.has_value();
+}
+
+UsdStagePtr usdex::core::AuthoringSession::getStage() const
+{
+    return m_impl->getStage();
+}
+
+NameCache& usdex::core::AuthoringSession::getNameCache()
+{
+    return m_impl->nameCache;
+}
+
+const TfToken& usdex::core::AuthoringSession::getUpAxis() const
+{
+    return m_impl->upAxis;
+}
+
+double usdex::core::AuthoringSession::getLinearUnits() const
+{
+    return m_impl->linearUnits;
+}
+
+double usdex::core::AuthoringSession::getMassUnits() const
+{
+    return m_impl->massUnits;
+}
+
+bool usdex::core::AuthoringSession::isEditablePrimLocation(const SdfPath& path, std::string* reason)
+{
+    TRACE_FUNCTION();
+
+    // While the session is active, the editability of the parent is cached by the validation of the calling thread
+    return usdex::core::isEditablePrimLocation(m_impl->getStage(), path, reason);
+}
+
+TfToken usdex::core::AuthoringSession::getEditableChildName(const UsdPrim& parent, const std::string& name, std::string* reason)
+{
+    TRACE_FUNCTION();
+
+    if (!usdex::core::isEditablePrimLocation(parent, reason))
+    {
+        return TfToken();
+    }
+
+    const TfToken childName = m_impl->nameCache.getPrimName(parent, name);
+    if (childName.IsEmpty())
+    {
+        if (reason != nullptr)
+        {
+            *reason = TfStringPrintf("\"%s\" is not a valid prim name", name.c_str());
+        }
+        return TfToken();
+    }
+
+    // The name is unique amongst the existing children, so there is no existing child prim that could be an instance proxy
+    return childName;
+}
+
+std::vector<SdfLayerRefPtr> usdex::core::authorLayersConcurrently(UsdStagePtr stage, const std::vector<LayerAuthoringFn>& workers)
+{
+    TRACE_FUNCTION();
+
+    std::vector<SdfLayerRefPtr> layers(workers.size());
+    if (!stage)
+    {
+        TF_WARN("Unable to author layers concurrently due to an invalid stage");
+        return layers;
+    }
+
+    // Create all of the layers and stages up front, so that the workers never modify a layer which is shared with another worker
+    const SdfLayerHandle rootLayer = stage->GetRootLayer();
+    const SdfPath& rootPath = SdfPath::AbsoluteRootPath();
+    const SdfSchemaBase& schema = rootLayer->GetSchema();
+    std::vector<UsdStageRefPtr> stages(workers.size());
+    for (size_t i = 0; i < workers.size(); ++i)
+    {
+        if (!workers[i])
+        {
+            continue;
+        }
+
+        layers[i] = SdfLayer::CreateAnonymous(TfStringPrintf("worker_%zu", i));
+        for (const TfToken& field : rootLayer->ListFields(rootPath))
+        {
+            if (!schema.HoldsChildren(field) && field != SdfFieldKeys->SubLayers && field != SdfFieldKeys->SubLayerOffsets)
+            {
+                layers[i]->SetField(rootPath, field, rootLayer->GetField(rootPath, field));
+            }
+        }
+        layers[i]->SetSubLayerPaths({ rootLayer->GetIdentifier() });
+        stages[i] = UsdStage::Open(layers[i]);
+    }
+
+    // Author each layer on its own worker. Diagnostics are emitted by the workers, but the results are reported in order afterwards.
+    // The workers validate their arguments with the ValidationPolicy of the calling thread.
+    const ValidationPolicy policy = g_validationPolicy;
+    std::vector<char> authored(workers.size(), 0);
+    WorkParallelForN(
+        workers.size(),
+        [&](size_t begin, size_t end)
+        {
+            ScopedValidationPolicy scopedPolicy(policy);
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (!stages[i])
+                {
+                    continue;
+                }
+
+                TRACE_SCOPE("Author layer");
+                AuthoringSession session(stages[i], UsdEditTarget(layers[i]));
+                authored[i] = workers[i](session);
+                session.end();
+            }
+        },
+        1
+    );
+
+    for (size_t i = 0; i < workers.size(); ++i)
+    {
+        stages[i] = nullptr;
+        if (layers[i])
+        {
+            layers[i]->SetSubLayerPaths({});
+        }
+
+        if (!authored[i])
+        {
+            TF_WARN("Unable to author layer %zu concurrently", i);
+            layers[i] = nullptr;
+        }
+    }
+
+    return layers;
+}
+
+class usdex::core::ValueClipSession::ValueClipSessionImpl : public ValueClipWriter
+{
+
+public:
+
+    using ValueClipWriter::ValueClipWriter;
+};
+
+usdex::core::ValueClipSession::ValueClipSession(UsdPrim prim, const std::string& name, const ValueClipOptions& options)
+{
+    m_impl = new ValueClipSessionImpl(prim, name, options);
+}
+
+usdex::core::ValueClipSession::~ValueClipSession()
+{
+    m_impl->end();
+    delete m_impl;
+}
+
+bool usdex::core::ValueClipSession::end()
+{
+    return m_impl->end();
+}
+
+bool usdex::core::ValueClipSession::isActive() const
+{
+    return m_impl->isActive();
+}
+
+std::vector<std::string> usdex::core::ValueClipSession::getClipAssetPaths() const
+{
+    return m_impl->getAssetPaths();
+}
+
+std::optional<bool> usdex::core::detail::setValueClipTimeSamples(
+    const UsdAttribute& attribute,
+    const std::vector<UsdTimeCode>& times,
+    const std::function<VtValue(size_t)>& valueAt
+)
+{
+    ValueClipWriter* writer = g_valueClipWriter;
+    if (!writer)
+    {
+        return std::nullopt;
+    }
+
+    TRACE_FUNCTION();
+    return writer->write(attribute, times, valueAt);
+}
+
+std::optional<bool> usdex::core::detail::isSessionParentInstanced(const UsdStagePtr& stage, const SdfPath& parentPath)
+{
+    AuthoringSessionState* session = g_authoringSession;
+    if (!session)
+    {
+        return std::nullopt;
+    }
+
+    return session->isParentInstanced(stage, parentPath);
+}
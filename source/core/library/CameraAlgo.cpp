@@ -6,15 +6,65 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdGeom/xformable.h>
 
+#include <algorithm>
+
 
 using namespace pxr;
 
+namespace
+{
+
+// Author a value which is the same at every time as a default value, otherwise author one time sample per time
+template <class ValueType>
+bool setCameraSamples(const UsdAttribute& attr, const std::vector<UsdTimeCode>& times, const std::vector<ValueType>& values)
+{
+    const ValueType& first = values.front();
+    if (std::all_of(values.begin() + 1, values.end(), [&first](const ValueType& value) { return value == first; }))
+    {
+        return attr.Set(first);
+    }
+
+    return usdex::core::detail::setTimeSamples(
+        attr,
+        times,
+        [&values](size_t i) -> const ValueType&
+        {
+            return values[i];
+        }
+    );
+}
+
+// Whether the transform of any ancestor of the prim might vary over time
+bool hasAnimatedAncestor(const UsdPrim& prim)
+{
+    for (UsdPrim ancestor = prim.GetParent(); ancestor && !ancestor.IsPseudoRoot(); ancestor = ancestor.GetParent())
+    {
+        UsdGeomXformable xformable(ancestor);
+        if (xformable && xformable.TransformMightBeTimeVarying())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
 UsdGeomCamera usdex::core::defineCamera(UsdStagePtr stage, const SdfPath& path, const GfCamera& cameraData)
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -40,17 +90,15 @@ UsdGeomCamera usdex::core::defineCamera(UsdStagePtr stage, const SdfPath& path,
         }
     }
 
-    UsdGeomCamera camera = UsdGeomCamera::Define(stage, path);
+    UsdGeomCamera camera = usdex::core::detail::definePrim<UsdGeomCamera>(stage, path);
     if (!camera)
     {
         TF_RUNTIME_ERROR("Unable to define UsdGeomCamera at \"%s\"", path.GetAsString().c_str());
         return camera;
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = camera.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     camera.SetFromCamera(cameraData, UsdTimeCode::Default());
 
@@ -59,6 +107,8 @@ UsdGeomCamera usdex::core::defineCamera(UsdStagePtr stage, const SdfPath& path,
 
 UsdGeomCamera usdex::core::defineCamera(UsdPrim parent, const std::string& name, const GfCamera& cameraData)
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -75,6 +125,8 @@ UsdGeomCamera usdex::core::defineCamera(UsdPrim parent, const std::string& name,
 
 UsdGeomCamera usdex::core::defineCamera(UsdPrim prim, const GfCamera& cameraData)
 {
+    TRACE_FUNCTION();
+
     // Early out if the prim is invalid
     if (!prim)
     {
@@ -98,3 +150,176 @@ UsdGeomCamera usdex::core::defineCamera(UsdPrim prim, const GfCamera& cameraData
     const SdfPath& path = prim.GetPath();
     return usdex::core::defineCamera(stage, path, cameraData);
 }
+
+UsdGeomCamera usdex::core::defineAnimatedCamera(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const std::vector<UsdTimeCode>& times,
+    const std::vector<GfCamera>& cameras
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "defineAnimatedCamera");
+    instrumentation.addElements(times.size());
+
+    // Early out if the frames are not consistent
+    if (times.empty())
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomCamera at \"%s\" due to invalid frames: No frames were provided", path.GetAsString().c_str());
+        return UsdGeomCamera();
+    }
+    if (cameras.size() != times.size())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdGeomCamera at \"%s\" due to invalid frames: Expected %zu cameras but found %zu",
+            path.GetAsString().c_str(),
+            times.size(),
+            cameras.size()
+        );
+        return UsdGeomCamera();
+    }
+
+    for (const UsdTimeCode& time : times)
+    {
+        if (time.IsDefault())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define UsdGeomCamera at \"%s\" due to invalid frames: The default time code is not valid",
+                path.GetAsString().c_str()
+            );
+            return UsdGeomCamera();
+        }
+    }
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomCamera due to an invalid location: %s", reason.c_str());
+        return UsdGeomCamera();
+    }
+
+    // Early out if we know that we cannot successfully set the transform, as described in defineCamera
+    if (auto xformable = UsdGeomXformable::Get(stage, path))
+    {
+        if (!xformable.MakeMatrixXform())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define UsdGeomCamera at \"%s\" due to non-editable attributes: %s",
+                path.GetAsString().c_str(),
+                "Xform op opinions in the composed layer stack are stronger than that of the current edit target"
+            );
+            return UsdGeomCamera();
+        }
+    }
+
+    UsdGeomCamera camera = usdex::core::detail::definePrim<UsdGeomCamera>(stage, path);
+    if (!camera)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomCamera at \"%s\"", path.GetAsString().c_str());
+        return camera;
+    }
+
+    // The GfCamera transforms are in world space, so they must be made relative to the parent. The parent transform is only computed at every
+    // time if it might vary, otherwise the first one is shared by all frames.
+    const size_t numFrames = times.size();
+    std::vector<GfMatrix4d> parentInverses;
+    {
+        UsdGeomXformCache xformCache(times[0]);
+        const size_t numParents = ::hasAnimatedAncestor(camera.GetPrim()) ? numFrames : 1;
+        parentInverses.resize(numParents);
+        for (size_t i = 0; i < numParents; ++i)
+        {
+            xformCache.SetTime(times[i]);
+            parentInverses[i] = xformCache.GetParentToWorldTransform(camera.GetPrim()).GetInverse();
+        }
+    }
+
+    // Derive the attribute values of every frame concurrently, each exactly as UsdGeomCamera::SetFromCamera would
+    std::vector<GfMatrix4d> transforms(numFrames);
+    std::vector<TfToken> projections(numFrames);
+    std::vector<float> horizontalApertures(numFrames);
+    std::vector<float> verticalApertures(numFrames);
+    std::vector<float> horizontalApertureOffsets(numFrames);
+    std::vector<float> verticalApertureOffsets(numFrames);
+    std::vector<float> focalLengths(numFrames);
+    std::vector<GfVec2f> clippingRanges(numFrames);
+    std::vector<VtVec4fArray> clippingPlanes(numFrames);
+    std::vector<float> fStops(numFrames);
+    std::vector<float> focusDistances(numFrames);
+    WorkParallelForN(
+        numFrames,
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Derive camera samples");
+            for (size_t i = begin; i < end; ++i)
+            {
+                const GfCamera& cameraData = cameras[i];
+                transforms[i] = cameraData.GetTransform() * parentInverses[parentInverses.size() == 1 ? 0 : i];
+                projections[i] = cameraData.GetProjection() == GfCamera::Orthographic ? UsdGeomTokens->orthographic : UsdGeomTokens->perspective;
+                horizontalApertures[i] = cameraData.GetHorizontalAperture();
+                verticalApertures[i] = cameraData.GetVerticalAperture();
+                horizontalApertureOffsets[i] = cameraData.GetHorizontalApertureOffset();
+                verticalApertureOffsets[i] = cameraData.GetVerticalApertureOffset();
+                focalLengths[i] = cameraData.GetFocalLength();
+                const GfRange1f& clippingRange = cameraData.GetClippingRange();
+                clippingRanges[i] = GfVec2f(clippingRange.GetMin(), clippingRange.GetMax());
+                const std::vector<GfVec4f>& planes = cameraData.GetClippingPlanes();
+                clippingPlanes[i] = VtVec4fArray(planes.begin(), planes.end());
+                fStops[i] = cameraData.GetFStop();
+                focusDistances[i] = cameraData.GetFocusDistance();
+            }
+        }
+    );
+
+    // Create the attributes so that their samples can be authored directly to the layer
+    UsdGeomXformOp transformOp;
+    UsdAttribute projectionAttr, horizontalApertureAttr, verticalApertureAttr, horizontalApertureOffsetAttr, verticalApertureOffsetAttr;
+    UsdAttribute focalLengthAttr, clippingRangeAttr, clippingPlanesAttr, fStopAttr, focusDistanceAttr;
+    {
+        // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+        usdex::core::detail::AuthoringChangeBlock authoringBlock;
+        transformOp = camera.MakeMatrixXform();
+        projectionAttr = camera.CreateProjectionAttr();
+        horizontalApertureAttr = camera.CreateHorizontalApertureAttr();
+        verticalApertureAttr = camera.CreateVerticalApertureAttr();
+        horizontalApertureOffsetAttr = camera.CreateHorizontalApertureOffsetAttr();
+        verticalApertureOffsetAttr = camera.CreateVerticalApertureOffsetAttr();
+        focalLengthAttr = camera.CreateFocalLengthAttr();
+        clippingRangeAttr = camera.CreateClippingRangeAttr();
+        clippingPlanesAttr = camera.CreateClippingPlanesAttr();
+        fStopAttr = camera.CreateFStopAttr();
+        focusDistanceAttr = camera.CreateFocusDistanceAttr();
+    }
+    if (!transformOp)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomCamera at \"%s\" due to an invalid transform", path.GetAsString().c_str());
+        return UsdGeomCamera();
+    }
+
+    // Author all of the values with a single round of change processing
+    bool success = true;
+    {
+        TRACE_SCOPE("Author camera samples");
+        SdfChangeBlock changeBlock;
+        success &= ::setCameraSamples(transformOp.GetAttr(), times, transforms);
+        success &= ::setCameraSamples(projectionAttr, times, projections);
+        success &= ::setCameraSamples(horizontalApertureAttr, times, horizontalApertures);
+        success &= ::setCameraSamples(verticalApertureAttr, times, verticalApertures);
+        success &= ::setCameraSamples(horizontalApertureOffsetAttr, times, horizontalApertureOffsets);
+        success &= ::setCameraSamples(verticalApertureOffsetAttr, times, verticalApertureOffsets);
+        success &= ::setCameraSamples(focalLengthAttr, times, focalLengths);
+        success &= ::setCameraSamples(clippingRangeAttr, times, clippingRanges);
+        success &= ::setCameraSamples(clippingPlanesAttr, times, clippingPlanes);
+        success &= ::setCameraSamples(fStopAttr, times, fStops);
+        success &= ::setCameraSamples(focusDistanceAttr, times, focusDistances);
+    }
+
+    if (!success)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomCamera at \"%s\" due to non-editable attributes", path.GetAsString().c_str());
+        return UsdGeomCamera();
+    }
+
+    return camera;
+}
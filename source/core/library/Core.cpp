@@ -4,9 +4,133 @@
 
 #include "usdex/core/Core.h"
 
+#include "usdex/core/AssetStructure.h"
 #include "usdex/core/Feature.h"
 #include "usdex/core/Version.h"
 
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/fileFormat.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/tokens.h>
+#include <pxr/usd/usdGeom/basisCurves.h>
+#include <pxr/usd/usdGeom/camera.h>
+#include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/modelAPI.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/points.h>
+#include <pxr/usd/usdGeom/scope.h>
+#include <pxr/usd/usdGeom/subset.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xform.h>
+#include <pxr/usd/usdLux/domeLight.h>
+#include <pxr/usd/usdLux/rectLight.h>
+#include <pxr/usd/usdLux/tokens.h>
+#include <pxr/usd/usdPhysics/fixedJoint.h>
+#include <pxr/usd/usdPhysics/materialAPI.h>
+#include <pxr/usd/usdPhysics/prismaticJoint.h>
+#include <pxr/usd/usdPhysics/revoluteJoint.h>
+#include <pxr/usd/usdPhysics/sphericalJoint.h>
+#include <pxr/usd/usdPhysics/tokens.h>
+#include <pxr/usd/usdShade/material.h>
+#include <pxr/usd/usdShade/materialBindingAPI.h>
+#include <pxr/usd/usdShade/shader.h>
+#include <pxr/usd/usdShade/tokens.h>
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <vector>
+
+using namespace pxr;
+
+namespace
+{
+
+std::atomic<bool> g_initialized(false);
+
+template <typename Schema>
+void findConcretePrimDefinition()
+{
+    UsdSchemaRegistry::GetInstance().FindConcretePrimDefinition(UsdSchemaRegistry::GetSchemaTypeName<Schema>());
+}
+
+template <typename Schema>
+void findAppliedAPIPrimDefinition()
+{
+    UsdSchemaRegistry::GetInstance().FindAppliedAPIPrimDefinition(UsdSchemaRegistry::GetSchemaTypeName<Schema>());
+}
+
+void initializeRegistries()
+{
+    TRACE_FUNCTION();
+
+    // Each task is independent. Tasks which share a registry (e.g. the prim definitions) wait for the first of them to populate it, so the
+    // registries themselves are loaded concurrently with each other.
+    const std::vector<std::function<void()>> tasks = {
+        []() { ArGetResolver(); },
+        []()
+        {
+            SdfFileFormat::FindByExtension("usda");
+            SdfFileFormat::FindByExtension("usdc");
+            SdfFileFormat::FindByExtension("usd");
+        },
+        []() { KindRegistry::HasKind(KindTokens->component); },
+        []()
+        {
+            // The static token tables of OpenUSD and usdex
+            SdfFieldKeys.Get();
+            UsdTokens.Get();
+            UsdGeomTokens.Get();
+            UsdLuxTokens.Get();
+            UsdPhysicsTokens.Get();
+            UsdShadeTokens.Get();
+            usdex::core::getAssetToken();
+        },
+        &findConcretePrimDefinition<UsdGeomXform>,
+        &findConcretePrimDefinition<UsdGeomScope>,
+        &findConcretePrimDefinition<UsdGeomMesh>,
+        &findConcretePrimDefinition<UsdGeomSubset>,
+        &findConcretePrimDefinition<UsdGeomPoints>,
+        &findConcretePrimDefinition<UsdGeomPointInstancer>,
+        &findConcretePrimDefinition<UsdGeomBasisCurves>,
+        &findConcretePrimDefinition<UsdGeomCamera>,
+        &findConcretePrimDefinition<UsdLuxDomeLight>,
+        &findConcretePrimDefinition<UsdLuxRectLight>,
+        &findConcretePrimDefinition<UsdShadeMaterial>,
+        &findConcretePrimDefinition<UsdShadeShader>,
+        &findConcretePrimDefinition<UsdPhysicsFixedJoint>,
+        &findConcretePrimDefinition<UsdPhysicsRevoluteJoint>,
+        &findConcretePrimDefinition<UsdPhysicsPrismaticJoint>,
+        &findConcretePrimDefinition<UsdPhysicsSphericalJoint>,
+        &findAppliedAPIPrimDefinition<UsdGeomModelAPI>,
+        &findAppliedAPIPrimDefinition<UsdShadeMaterialBindingAPI>,
+        &findAppliedAPIPrimDefinition<UsdPhysicsMaterialAPI>,
+        // An empty stage initializes the composition & layer machinery shared by every stage
+        []() { UsdStage::CreateInMemory(); },
+    };
+
+    WorkParallelForN(
+        tasks.size(),
+        [&tasks](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                tasks[i]();
+            }
+        },
+        /* grainSize */ 1
+    );
+
+    g_initialized = true;
+}
+
+} // namespace
+
 const char* usdex::core::version()
 {
     return USDEX_VERSION_STRING;
@@ -25,3 +149,18 @@ bool usdex::core::withPython()
     return false;
 #endif
 }
+
+void usdex::core::initialize(bool wait)
+{
+    // The initialization is started exactly once, on its own thread, so that it can outlive the caller when not waiting for it
+    static const std::shared_future<void> s_initialization = std::async(std::launch::async, &::initializeRegistries).share();
+    if (wait)
+    {
+        s_initialization.wait();
+    }
+}
+
+bool usdex::core::isInitialized()
+{
+    return g_initialized;
+}
@@ -6,10 +6,18 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "GeomUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/reduce.h>
 #include <pxr/usd/usdGeom/basisCurves.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <numeric>
 
 using namespace usdex::core;
@@ -18,6 +26,212 @@ using namespace pxr;
 namespace
 {
 
+// Curves are validated in chunks of this many curves, arrays smaller than this are validated serially
+static constexpr size_t s_curveGrainSize = 65536;
+
+// The result of validating the vertex counts of a range of curves
+struct CurveCountsResult
+{
+    int64_t numVertices = 0;
+    size_t firstInvalid = std::numeric_limits<size_t>::max();
+};
+
+CurveCountsResult unionCurveCounts(const CurveCountsResult& lhs, const CurveCountsResult& rhs)
+{
+    CurveCountsResult result;
+    result.numVertices = lhs.numVertices + rhs.numVertices;
+    result.firstInvalid = std::min(lhs.firstInvalid, rhs.firstInvalid);
+    return result;
+}
+
+// Validate the vertex counts of the curves in [begin, end), accumulating the total number of vertices.
+// Each curve requires at least MinCount vertices and, if Step is greater than one, a vertex count which leaves Remainder when divided by Step.
+// Validation stops at the first invalid curve, as the total number of vertices is not required in that case.
+template <int MinCount, int Step, int Remainder>
+CurveCountsResult validateCurveCountsRange(const int* curveVertexCounts, size_t begin, size_t end)
+{
+    CurveCountsResult result;
+    for (size_t i = begin; i < end; ++i)
+    {
+        const int vertCount = curveVertexCounts[i];
+        if (vertCount < MinCount || (Step > 1 && vertCount % Step != Remainder))
+        {
+            result.firstInvalid = i;
+            return result;
+        }
+        result.numVertices += vertCount;
+    }
+    return result;
+}
+
+using CurveCountsValidator = CurveCountsResult (*)(const int*, size_t, size_t);
+
+// Select the vertex count validator for a curve specification.
+// The tokens must already be known to be compatible, and the rules must match those described by validateCurveVertexCount.
+CurveCountsValidator curveCountsValidator(const TfToken& type, const TfToken& basis, const TfToken& wrap)
+{
+    if (type == UsdGeomTokens->linear)
+    {
+        if (wrap == UsdGeomTokens->periodic)
+        {
+            return &::validateCurveCountsRange<3, 1, 0>;
+        }
+        return &::validateCurveCountsRange<2, 1, 0>;
+    }
+    else if (type == UsdGeomTokens->cubic)
+    {
+        if (basis == UsdGeomTokens->bezier)
+        {
+            if (wrap == UsdGeomTokens->nonperiodic)
+            {
+                // equivalent to (vertCount - 4) % 3 == 0
+                return &::validateCurveCountsRange<4, 3, 1>;
+            }
+            else if (wrap == UsdGeomTokens->periodic)
+            {
+                return &::validateCurveCountsRange<4, 3, 0>;
+            }
+            return &::validateCurveCountsRange<4, 1, 0>;
+        }
+        else if (wrap == UsdGeomTokens->nonperiodic)
+        {
+            return &::validateCurveCountsRange<4, 1, 0>;
+        }
+        else if (wrap == UsdGeomTokens->periodic)
+        {
+            return &::validateCurveCountsRange<3, 1, 0>;
+        }
+        return &::validateCurveCountsRange<2, 1, 0>;
+    }
+
+    // Other curve types place no requirements on the vertex counts
+    return &::validateCurveCountsRange<std::numeric_limits<int>::min(), 1, 0>;
+}
+
+// Validate the vertex counts of all curves, in parallel for large numbers of curves
+CurveCountsResult validateCurveCounts(const VtIntArray& curveVertexCounts, CurveCountsValidator validator)
+{
+    const int* data = curveVertexCounts.cdata();
+    const size_t numCurves = curveVertexCounts.size();
+    if (numCurves <= s_curveGrainSize)
+    {
+        return validator(data, 0, numCurves);
+    }
+
+    return WorkParallelReduceN(
+        CurveCountsResult(),
+        numCurves,
+        [data, validator](size_t begin, size_t end, const CurveCountsResult& identity)
+        {
+            return ::unionCurveCounts(identity, validator(data, begin, end));
+        },
+        [](const CurveCountsResult& lhs, const CurveCountsResult& rhs)
+        {
+            return ::unionCurveCounts(lhs, rhs);
+        },
+        s_curveGrainSize
+    );
+}
+
+// Validate the vertex count of a single curve, describing the reason if it is invalid.
+// This is only used to report the first invalid curve found by the specialized validators.
+bool validateCurveVertexCount(int vertCount, size_t i, const TfToken& type, const TfToken& basis, const TfToken& wrap, std::string* reason)
+{
+    if (type == UsdGeomTokens->linear)
+    {
+        if (wrap == UsdGeomTokens->nonperiodic && vertCount < 2)
+        {
+            *reason = TfStringPrintf(
+                "A minimum of 2 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
+                wrap.GetText(),
+                type.GetText(),
+                vertCount,
+                i
+            );
+            return false;
+        }
+        else if (wrap == UsdGeomTokens->periodic && vertCount < 3)
+        {
+            *reason = TfStringPrintf(
+                "A minimum of 3 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
+                wrap.GetText(),
+                type.GetText(),
+                vertCount,
+                i
+            );
+            return false;
+        }
+    }
+    else if (type == UsdGeomTokens->cubic)
+    {
+        if ((wrap == UsdGeomTokens->nonperiodic || basis == UsdGeomTokens->bezier) && vertCount < 4)
+        {
+            *reason = TfStringPrintf(
+                "A minimum of 4 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
+                wrap.GetText(),
+                basis.GetText(),
+                vertCount,
+                i
+            );
+            return false;
+        }
+        else if (wrap == UsdGeomTokens->pinned && (vertCount < 2))
+        {
+            *reason = TfStringPrintf(
+                "A minimum of 2 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
+                wrap.GetText(),
+                basis.GetText(),
+                vertCount,
+                i
+            );
+            return false;
+        }
+        else if (basis == UsdGeomTokens->bezier)
+        {
+            // these cases can only fail for bezier as vStep == 1 for the others
+            static const int s_vStep = 3;
+            if (wrap == UsdGeomTokens->nonperiodic && ((vertCount - 4) % s_vStep != 0))
+            {
+                static constexpr const char* s_nonperiodicBezierVertCountFormula = "(vertCount - 4) % 3 == 0";
+                *reason = TfStringPrintf(
+                    "The number of vertices must match the formula %s to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
+                    s_nonperiodicBezierVertCountFormula,
+                    wrap.GetText(),
+                    basis.GetText(),
+                    vertCount,
+                    i
+                );
+                return false;
+            }
+            else if (wrap == UsdGeomTokens->periodic && (vertCount % s_vStep != 0))
+            {
+                *reason = TfStringPrintf(
+                    "The number of vertices must be divisible by %d to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
+                    s_vStep,
+                    wrap.GetText(),
+                    basis.GetText(),
+                    vertCount,
+                    i
+                );
+                return false;
+            }
+        }
+        else if (wrap == UsdGeomTokens->periodic && vertCount < 3)
+        {
+            *reason = TfStringPrintf(
+                "A minimum of 3 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
+                wrap.GetText(),
+                basis.GetText(),
+                vertCount,
+                i
+            );
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // Validate the topology attributes for a basis curves prim.
 bool validateTopology(
     const pxr::VtIntArray& curveVertexCounts,
@@ -28,6 +242,8 @@ bool validateTopology(
     std::string* reason
 )
 {
+    TRACE_FUNCTION();
+
     // validate tokens compatiblity
     if (type == UsdGeomTokens->linear)
     {
@@ -70,109 +286,28 @@ bool validateTopology(
         }
     }
 
-    // validate actual topology now that we know the curve specification is valid
-    size_t numVertices = 0;
-    for (size_t i = 0, numCurves = curveVertexCounts.size(); i < numCurves; ++i)
+    // The vertex counts are trusted, unless the ValidationPolicy of the calling thread requires the contents of the arrays to be validated
+    if (!usdex::core::detail::shouldValidateContents())
     {
-        const int vertCount = curveVertexCounts[i];
-        if (type == UsdGeomTokens->linear)
-        {
-            if (wrap == UsdGeomTokens->nonperiodic && vertCount < 2)
-            {
-                *reason = TfStringPrintf(
-                    "A minimum of 2 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
-                    wrap.GetText(),
-                    type.GetText(),
-                    vertCount,
-                    i
-                );
-                return false;
-            }
-            else if (wrap == UsdGeomTokens->periodic && vertCount < 3)
-            {
-                *reason = TfStringPrintf(
-                    "A minimum of 3 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
-                    wrap.GetText(),
-                    type.GetText(),
-                    vertCount,
-                    i
-                );
-                return false;
-            }
-        }
-        else if (type == UsdGeomTokens->cubic)
-        {
-            if ((wrap == UsdGeomTokens->nonperiodic || basis == UsdGeomTokens->bezier) && vertCount < 4)
-            {
-                *reason = TfStringPrintf(
-                    "A minimum of 4 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
-                    wrap.GetText(),
-                    basis.GetText(),
-                    vertCount,
-                    i
-                );
-                return false;
-            }
-            else if (wrap == UsdGeomTokens->pinned && (vertCount < 2))
-            {
-                *reason = TfStringPrintf(
-                    "A minimum of 2 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
-                    wrap.GetText(),
-                    basis.GetText(),
-                    vertCount,
-                    i
-                );
-                return false;
-            }
-            else if (basis == UsdGeomTokens->bezier)
-            {
-                // these cases can only fail for bezier as vStep == 1 for the others
-                static const int s_vStep = 3;
-                if (wrap == UsdGeomTokens->nonperiodic && ((vertCount - 4) % s_vStep != 0))
-                {
-                    static constexpr const char* s_nonperiodicBezierVertCountFormula = "(vertCount - 4) % 3 == 0";
-                    *reason = TfStringPrintf(
-                        "The number of vertices must match the formula %s to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
-                        s_nonperiodicBezierVertCountFormula,
-                        wrap.GetText(),
-                        basis.GetText(),
-                        vertCount,
-                        i
-                    );
-                    return false;
-                }
-                else if (wrap == UsdGeomTokens->periodic && (vertCount % s_vStep != 0))
-                {
-                    *reason = TfStringPrintf(
-                        "The number of vertices must be divisible by %d to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
-                        s_vStep,
-                        wrap.GetText(),
-                        basis.GetText(),
-                        vertCount,
-                        i
-                    );
-                    return false;
-                }
-            }
-            else if (wrap == UsdGeomTokens->periodic && vertCount < 3)
-            {
-                *reason = TfStringPrintf(
-                    "A minimum of 3 vertices are required to form a valid %s %s curve, but %d vertices were provided for curve %zu.",
-                    wrap.GetText(),
-                    basis.GetText(),
-                    vertCount,
-                    i
-                );
-                return false;
-            }
-        }
+        return true;
+    }
 
-        numVertices += vertCount;
+    // Validate the vertex count of every curve, and the total number of vertices, using a validator specialized for the curve specification.
+    // The validators only determine whether the counts are valid. The detailed reason is only determined for the first invalid curve, if any.
+    const CurveCountsResult result = ::validateCurveCounts(curveVertexCounts, ::curveCountsValidator(type, basis, wrap));
+    if (result.firstInvalid < curveVertexCounts.size())
+    {
+        ::validateCurveVertexCount(curveVertexCounts[result.firstInvalid], result.firstInvalid, type, basis, wrap, reason);
+        return false;
     }
 
-    if (numVertices != numPoints)
+    if (result.numVertices != static_cast<int64_t>(numPoints))
     {
-        *reason = TfStringPrintf("The number of points (%zu) does not match the total curveVertexCounts (%zu).", numPoints, numVertices);
+        *reason = TfStringPrintf(
+            "The number of points (%zu) does not match the total curveVertexCounts (%zu).",
+            numPoints,
+            static_cast<size_t>(result.numVertices)
+        );
         return false;
     }
 
@@ -313,6 +448,7 @@ bool validatePrimvarInterpolation(
 // Validate a primvar intended for a curves prim.
 // Accepts a vector of interpolations and returns the first one where the primvar size matches the topology.
 // Validates that a valid interpolation was found and that indices (if provided) fit inside the value range.
+// The indices are only validated if the ValidationPolicy of the calling thread requires the contents of the arrays to be validated.
 // If the primvar is invalid and reason is non-null, an error message describing the validation error will be set.
 // Returns the interpolations if the primvar is valid, or an empty token otherwise.
 template <typename T>
@@ -327,6 +463,8 @@ bool validatePrimvar(
     std::string* reason
 )
 {
+    TRACE_FUNCTION();
+
     if (!::validatePrimvarInterpolation<T>(primvar, interpolations, curveVertexCounts, points, type, basis, wrap))
     {
         if (reason != nullptr)
@@ -341,7 +479,7 @@ bool validatePrimvar(
         return false;
     }
 
-    if (!primvar.isValid())
+    if (usdex::core::detail::shouldValidateContents() && !primvar.isValid())
     {
         if (reason != nullptr)
         {
@@ -361,12 +499,14 @@ UsdGeomBasisCurves defineBasisCurves(
     const TfToken& type,
     const TfToken& basis,
     const TfToken& wrap,
-    std::optional<const FloatPrimvarData> widths,
-    std::optional<const Vec3fPrimvarData> normals,
-    std::optional<const Vec3fPrimvarData> displayColor,
-    std::optional<const FloatPrimvarData> displayOpacity
+    const std::optional<const FloatPrimvarData>& widths,
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     std::string reason;
 
     // Early out if the points are empty
@@ -442,13 +582,16 @@ UsdGeomBasisCurves defineBasisCurves(
         }
     }
 
-    UsdGeomBasisCurves curves = UsdGeomBasisCurves::Define(stage, path);
+    UsdGeomBasisCurves curves = usdex::core::detail::definePrim<UsdGeomBasisCurves>(stage, path);
     if (!curves)
     {
         TF_RUNTIME_ERROR("Unable to define UsdGeomBasisCurves at \"%s\"", path.GetAsString().c_str());
         return UsdGeomBasisCurves();
     }
 
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
+
     // Author opinions on BasisCurves topology attributes
     curves.CreateTypeAttr().Set(type);
     curves.CreateCurveVertexCountsAttr().Set(curveVertexCounts);
@@ -459,11 +602,6 @@ UsdGeomBasisCurves defineBasisCurves(
     }
     curves.CreateWrapAttr().Set(wrap);
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = curves.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
-
     // Optionally author widths
     if (widths.has_value())
     {
@@ -516,13 +654,14 @@ UsdGeomBasisCurves defineBasisCurves(
     }
 
     // Compute an extent for the schema so there is a guarantee that the extent will be correct and authored in all cases.
-    VtArray<GfVec3f> extent;
-    if (!UsdGeomBoundable::ComputeExtentFromPlugins(curves, UsdTimeCode::Default(), &extent))
+    // Curves are padded by half of the maximum width, regardless of the interpolation of the widths (matching UsdGeomCurves::ComputeExtent).
+    float maxWidth = 0.0f;
+    if (widths.has_value() && !widths.value().values().empty())
     {
-        // fallback to basic extents
-        UsdGeomPointBased::ComputeExtent(points, &extent);
+        const VtFloatArray& widthValues = widths.value().values();
+        maxWidth = *std::max_element(widthValues.cbegin(), widthValues.cend());
     }
-    curves.CreateExtentAttr().Set(extent);
+    curves.CreateExtentAttr().Set(detail::computeExtent(points, maxWidth / 2.0f));
 
     return curves;
 }
@@ -541,6 +680,8 @@ UsdGeomBasisCurves usdex::core::defineLinearBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -564,6 +705,8 @@ UsdGeomBasisCurves usdex::core::defineLinearBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -589,6 +732,8 @@ UsdGeomBasisCurves usdex::core::defineLinearBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the prim is not valid
     if (!prim)
     {
@@ -626,6 +771,8 @@ UsdGeomBasisCurves usdex::core::defineCubicBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -662,6 +809,8 @@ UsdGeomBasisCurves usdex::core::defineCubicBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -700,6 +849,8 @@ UsdGeomBasisCurves usdex::core::defineCubicBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the prim is not valid
     if (!prim)
     {
@@ -9,11 +9,655 @@
 #include <pxr/base/arch/debugger.h>
 #include <pxr/base/tf/stackTrace.h>
 
+#include <pxr/base/tf/hash.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
 using namespace pxr;
 
 namespace
 {
 
+// Writes messages to their output streams on a dedicated thread, so that the threads emitting diagnostics never wait on console I/O.
+//
+// Messages are passed to the writer through an intrusive multi-producer single-consumer queue (as described by Dmitry Vyukov), which producers
+// append to with a single atomic exchange. The mutex is only used to put the writer to sleep and to wake it, and is never held while writing.
+//
+// Producers reserve a message by counting it before they link it, and check that the writer is running both before and after the reservation.
+// A producer which observes the writer running after its reservation is counted before the writer is stopped, so the final pass of the writer
+// waits for its message. Otherwise the reservation is withdrawn and the message is written directly, so producers never wait on a stopping writer.
+class AsyncWriter
+{
+public:
+
+    AsyncWriter() : m_head(&m_stub), m_tail(&m_stub), m_pushed(0), m_popped(0), m_written(0), m_sleeping(false), m_stopping(false)
+    {
+    }
+
+    ~AsyncWriter()
+    {
+        stop();
+    }
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    bool isRunning() const
+    {
+        return m_running.load(std::memory_order_seq_cst);
+    }
+
+    void start()
+    {
+        std::lock_guard<std::mutex> control(m_controlMutex);
+        if (m_thread.joinable())
+        {
+            return;
+        }
+
+        m_stopping = false;
+        m_thread = std::thread(&AsyncWriter::run, this);
+        m_running.store(true, std::memory_order_seq_cst);
+    }
+
+    // Write all queued messages and join the writer thread
+    // The writer makes the final pass itself, so producers are never excluded while the queued messages are written.
+    void stop()
+    {
+        std::lock_guard<std::mutex> control(m_controlMutex);
+        if (!m_thread.joinable())
+        {
+            return;
+        }
+
+        m_running.store(false, std::memory_order_seq_cst);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_one();
+        m_thread.join();
+    }
+
+    // Write a message, asynchronously if the writer is running
+    void write(FILE* stream, std::string message)
+    {
+        if (isRunning())
+        {
+            m_pushed.fetch_add(1, std::memory_order_seq_cst);
+            if (isRunning())
+            {
+                push(stream, std::move(message));
+                return;
+            }
+
+            // The writer is stopping, so the reservation is withdrawn rather than waiting for it
+            m_pushed.fetch_sub(1, std::memory_order_seq_cst);
+        }
+        fprintf(stream, "%s", message.c_str());
+    }
+
+    // Write a message on the calling thread, once every message pushed prior to this call has been written
+    void writeSync(FILE* stream, const std::string& message)
+    {
+        flush();
+        fprintf(stream, "%s", message.c_str());
+        fflush(stream);
+    }
+
+    // Block until every message pushed prior to this call has been written
+    void flush()
+    {
+        if (!isRunning())
+        {
+            return;
+        }
+
+        const uint64_t target = m_pushed.load(std::memory_order_seq_cst);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_flushed.wait(
+            lock,
+            [this, target]()
+            {
+                return m_written >= target || m_stopping;
+            }
+        );
+    }
+
+private:
+
+    struct Node
+    {
+        FILE* stream = nullptr;
+        std::string message;
+        std::atomic<Node*> next = nullptr;
+    };
+
+    // Link a message which has already been reserved by `write`
+    void push(FILE* stream, std::string message)
+    {
+        link(new Node{ stream, std::move(message) });
+        if (m_sleeping.load(std::memory_order_seq_cst))
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wake.notify_one();
+        }
+    }
+
+    void link(Node* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    // Pop the oldest message, which may return nullptr if a producer has exchanged the head but not yet linked its node
+    Node* pop()
+    {
+        Node* tail = m_tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (tail == &m_stub)
+        {
+            if (next == nullptr)
+            {
+                return nullptr;
+            }
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        if (tail != m_head.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        // The tail is the last node, so the stub is re-linked to allow the tail to be popped without emptying the queue
+        link(&m_stub);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    // Write all reachable messages, returning the number written
+    // This must only be called by the writer thread.
+    uint64_t drain()
+    {
+        uint64_t count = 0;
+        while (Node* node = pop())
+        {
+            fputs(node->message.c_str(), node->stream);
+            delete node;
+            ++count;
+        }
+        if (count > 0)
+        {
+            fflush(stdout);
+            fflush(stderr);
+        }
+        m_popped += count;
+        return count;
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            // Write every message which has been reserved so far, yielding while a producer is part way through linking its node
+            while (m_popped != m_pushed.load(std::memory_order_seq_cst))
+            {
+                if (drain() == 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_written = m_popped;
+            m_flushed.notify_all();
+            if (m_stopping)
+            {
+                lock.unlock();
+
+                // Every producer which observed the writer running has reserved its message by now, so the final pass waits for each of them
+                while (m_popped != m_pushed.load(std::memory_order_seq_cst))
+                {
+                    if (drain() == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                return;
+            }
+
+            m_sleeping.store(true, std::memory_order_seq_cst);
+            m_wake.wait(
+                lock,
+                [this]()
+                {
+                    return m_stopping || m_popped != m_pushed.load(std::memory_order_seq_cst);
+                }
+            );
+            m_sleeping.store(false, std::memory_order_seq_cst);
+        }
+    }
+
+    Node m_stub;
+    std::atomic<Node*> m_head;
+    Node* m_tail;
+    std::atomic<uint64_t> m_pushed;
+    uint64_t m_popped;
+    std::atomic<bool> m_running = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_flushed;
+    uint64_t m_written;
+    std::atomic<bool> m_sleeping;
+    bool m_stopping;
+
+    std::mutex m_controlMutex;
+    std::thread m_thread;
+};
+
+// Limits the diagnostics which are written, by deduplicating repeats from each call site and by rate limiting with a token bucket.
+//
+// Call sites are keyed by source file, line, and diagnostic code. They are sharded by hash, so that threads reporting from different call sites
+// rarely contend on the same mutex, and the counts are only formatted into messages when a summary is requested.
+class DiagnosticsThrottle
+{
+public:
+
+    DiagnosticsThrottle() : m_enabled(false), m_repeatsPerSite(0), m_rateLimited(false), m_tokens(0.0), m_rateSuppressed(0)
+    {
+    }
+
+    void setLimits(const usdex::core::DiagnosticsLimits& value)
+    {
+        std::lock_guard<std::mutex> lock(m_bucketMutex);
+        m_limits = value;
+        m_tokens = static_cast<double>(value.burst);
+        m_lastRefill = std::chrono::steady_clock::now();
+        m_repeatsPerSite.store(value.repeatsPerSite, std::memory_order_relaxed);
+        m_rateLimited.store(value.ratePerSecond > 0.0, std::memory_order_release);
+        m_enabled.store(value.repeatsPerSite > 0 || value.ratePerSecond > 0.0, std::memory_order_release);
+    }
+
+    usdex::core::DiagnosticsLimits getLimits()
+    {
+        std::lock_guard<std::mutex> lock(m_bucketMutex);
+        return m_limits;
+    }
+
+    // Determine whether a diagnostic should be written, counting it as suppressed otherwise
+    bool admit(const TfDiagnosticBase& diagnostic)
+    {
+        if (!m_enabled.load(std::memory_order_acquire))
+        {
+            return true;
+        }
+
+        const size_t repeatsPerSite = m_repeatsPerSite.load(std::memory_order_relaxed);
+        if (repeatsPerSite > 0)
+        {
+            SiteKey key{ diagnostic.GetSourceFileName(), diagnostic.GetSourceLineNumber(), diagnostic.GetDiagnosticCode().GetValueAsInt() };
+            const size_t hash = SiteKeyHash()(key);
+            Shard& shard = m_shards[hash % m_shards.size()];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            Site& site = shard.sites[std::move(key)];
+            if (site.emitted >= repeatsPerSite)
+            {
+                // Only the first suppressed diagnostic is retained, so that repeats cost a single increment
+                if (site.suppressed++ == 0)
+                {
+                    site.codeName = TfDiagnosticMgr::GetCodeName(diagnostic.GetDiagnosticCode());
+                    const bool hidden = diagnostic.GetContext().IsHidden() || diagnostic.GetSourceFileName().empty();
+                    site.function = hidden ? std::string() : diagnostic.GetSourceFunction();
+                    site.commentary = diagnostic.GetCommentary();
+                }
+                return false;
+            }
+            ++site.emitted;
+        }
+
+        if (m_rateLimited.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(m_bucketMutex);
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            const double elapsed = std::chrono::duration<double>(now - m_lastRefill).count();
+            m_tokens = std::min(static_cast<double>(std::max<size_t>(m_limits.burst, 1)), m_tokens + elapsed * m_limits.ratePerSecond);
+            m_lastRefill = now;
+            if (m_tokens < 1.0)
+            {
+                ++m_rateSuppressed;
+                return false;
+            }
+            m_tokens -= 1.0;
+        }
+        return true;
+    }
+
+    // Format a message for each call site and for the rate limit which suppressed diagnostics, then reset all counts
+    std::vector<std::string> summarize()
+    {
+        struct Summary
+        {
+            SiteKey key;
+            std::string message;
+        };
+        std::vector<Summary> summaries;
+        for (Shard& shard : m_shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const auto& [key, site] : shard.sites)
+            {
+                if (site.suppressed == 0)
+                {
+                    continue;
+                }
+
+                std::string context = site.function.empty() ? std::string() : TfStringPrintf(" [%s]", site.function.c_str());
+                std::string message = TfStringPrintf(
+                    "[%s]%s Suppressed %zu repeated diagnostics. The first suppressed was: %s\n",
+                    site.codeName.c_str(),
+                    context.c_str(),
+                    site.suppressed,
+                    site.commentary.c_str()
+                );
+                summaries.push_back({ key, std::move(message) });
+            }
+            shard.sites.clear();
+        }
+
+        // Sort by call site so that the summary is deterministic
+        std::sort(
+            summaries.begin(),
+            summaries.end(),
+            [](const Summary& lhs, const Summary& rhs)
+            {
+                return std::tie(lhs.key.file, lhs.key.line, lhs.key.code) < std::tie(rhs.key.file, rhs.key.line, rhs.key.code);
+            }
+        );
+
+        std::vector<std::string> result;
+        result.reserve(summaries.size() + 1);
+        for (Summary& summary : summaries)
+        {
+            result.push_back(std::move(summary.message));
+        }
+
+        std::lock_guard<std::mutex> lock(m_bucketMutex);
+        if (m_rateSuppressed > 0)
+        {
+            result.push_back(TfStringPrintf("[Suppressed] %zu diagnostics exceeded the rate limit\n", m_rateSuppressed));
+            m_rateSuppressed = 0;
+        }
+        return result;
+    }
+
+private:
+
+    struct SiteKey
+    {
+        std::string file;
+        size_t line = 0;
+        int code = 0;
+
+        bool operator==(const SiteKey& other) const
+        {
+            return line == other.line && code == other.code && file == other.file;
+        }
+    };
+
+    struct SiteKeyHash
+    {
+        size_t operator()(const SiteKey& key) const
+        {
+            return TfHash::Combine(key.file, key.line, key.code);
+        }
+    };
+
+    struct Site
+    {
+        size_t emitted = 0;
+        size_t suppressed = 0;
+        std::string codeName;
+        std::string function;
+        std::string commentary;
+    };
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<SiteKey, Site, SiteKeyHash> sites;
+    };
+
+    std::atomic<bool> m_enabled;
+    std::atomic<size_t> m_repeatsPerSite;
+    std::array<Shard, 16> m_shards;
+
+    std::atomic<bool> m_rateLimited;
+    std::mutex m_bucketMutex;
+    usdex::core::DiagnosticsLimits m_limits;
+    double m_tokens;
+    std::chrono::steady_clock::time_point m_lastRefill;
+    size_t m_rateSuppressed;
+};
+
+// Application specific error codes are not a TfDiagnosticType, so they resolve to the type of diagnostic which reported them
+TfDiagnosticType resolveDiagnosticType(const TfEnum& code, TfDiagnosticType fallback)
+{
+    if (code.IsA<TfDiagnosticType>() && code.GetValueAsInt() >= 0 && code.GetValueAsInt() <= TF_APPLICATION_EXIT_TYPE)
+    {
+        return static_cast<TfDiagnosticType>(code.GetValueAsInt());
+    }
+    return fallback;
+}
+
+// Counts diagnostics by TfDiagnosticType and by source function, without formatting them.
+//
+// The type counts are a fixed array of atomics. The source function counts are sharded by hash and each shard is guarded by a shared mutex,
+// so that threads reporting from known functions only take a shared lock and increment an atomic. The exclusive lock is only required to
+// insert a new function or to reset the counts.
+class DiagnosticsCounter
+{
+public:
+
+    DiagnosticsCounter() : m_enabled(false), m_captureLimit(1)
+    {
+        for (std::atomic<uint64_t>& count : m_codes)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void setEnabled(bool value)
+    {
+        m_enabled.store(value, std::memory_order_release);
+    }
+
+    bool isEnabled()
+    {
+        return m_enabled.load(std::memory_order_acquire);
+    }
+
+    void setCaptureLimit(size_t value)
+    {
+        m_captureLimit.store(value, std::memory_order_relaxed);
+    }
+
+    size_t getCaptureLimit()
+    {
+        return m_captureLimit.load(std::memory_order_relaxed);
+    }
+
+    void count(const TfDiagnosticBase& diagnostic, TfDiagnosticType fallback)
+    {
+        if (!m_enabled.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        const int code = static_cast<int>(resolveDiagnosticType(diagnostic.GetDiagnosticCode(), fallback));
+        m_codes[code].fetch_add(1, std::memory_order_relaxed);
+
+        const bool hidden = diagnostic.GetContext().IsHidden() || diagnostic.GetSourceFileName().empty();
+        SourceKey key{ hidden ? std::string() : diagnostic.GetSourceFunction(), code };
+        const size_t hash = SourceKeyHash()(key);
+        Shard& shard = m_shards[hash % m_shards.size()];
+
+        std::shared_lock<std::shared_mutex> readLock(shard.mutex);
+        auto it = shard.sources.find(key);
+        if (it == shard.sources.end())
+        {
+            readLock.unlock();
+            {
+                std::unique_lock<std::shared_mutex> writeLock(shard.mutex);
+                shard.sources.try_emplace(key);
+            }
+            readLock.lock();
+            it = shard.sources.find(key);
+            if (it == shard.sources.end())
+            {
+                // The counts were reset while the lock was released
+                return;
+            }
+        }
+
+        Source& source = it->second;
+        if (source.count.fetch_add(1, std::memory_order_relaxed) < m_captureLimit.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(source.mutex);
+            source.messages.push_back(diagnostic.GetCommentary());
+        }
+    }
+
+    std::map<TfDiagnosticType, uint64_t> getCounts()
+    {
+        std::map<TfDiagnosticType, uint64_t> result;
+        for (size_t code = 0; code < m_codes.size(); ++code)
+        {
+            const uint64_t count = m_codes[code].load(std::memory_order_relaxed);
+            if (count > 0)
+            {
+                result.emplace(static_cast<TfDiagnosticType>(code), count);
+            }
+        }
+        return result;
+    }
+
+    std::vector<usdex::core::DiagnosticsSourceCount> getSourceCounts()
+    {
+        std::vector<usdex::core::DiagnosticsSourceCount> result;
+        for (Shard& shard : m_shards)
+        {
+            std::shared_lock<std::shared_mutex> readLock(shard.mutex);
+            for (auto& [key, source] : shard.sources)
+            {
+                usdex::core::DiagnosticsSourceCount item;
+                item.function = key.function;
+                item.code = static_cast<TfDiagnosticType>(key.code);
+                item.count = source.count.load(std::memory_order_relaxed);
+                {
+                    std::lock_guard<std::mutex> lock(source.mutex);
+                    item.messages = source.messages;
+                }
+                result.push_back(std::move(item));
+            }
+        }
+
+        // Sort by source so that the result is deterministic
+        std::sort(
+            result.begin(),
+            result.end(),
+            [](const usdex::core::DiagnosticsSourceCount& lhs, const usdex::core::DiagnosticsSourceCount& rhs)
+            {
+                return std::tie(lhs.function, lhs.code) < std::tie(rhs.function, rhs.code);
+            }
+        );
+        return result;
+    }
+
+    void reset()
+    {
+        for (Shard& shard : m_shards)
+        {
+            std::unique_lock<std::shared_mutex> writeLock(shard.mutex);
+            shard.sources.clear();
+        }
+        for (std::atomic<uint64_t>& count : m_codes)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+
+    struct SourceKey
+    {
+        std::string function;
+        int code = 0;
+
+        bool operator==(const SourceKey& other) const
+        {
+            return code == other.code && function == other.function;
+        }
+    };
+
+    struct SourceKeyHash
+    {
+        size_t operator()(const SourceKey& key) const
+        {
+            return TfHash::Combine(key.function, key.code);
+        }
+    };
+
+    struct Source
+    {
+        std::atomic<uint64_t> count = 0;
+        std::mutex mutex;
+        std::vector<std::string> messages;
+    };
+
+    struct Shard
+    {
+        std::shared_mutex mutex;
+        std::unordered_map<SourceKey, Source, SourceKeyHash> sources;
+    };
+
+    std::atomic<bool> m_enabled;
+    std::atomic<size_t> m_captureLimit;
+    std::array<std::atomic<uint64_t>, TF_APPLICATION_EXIT_TYPE + 1> m_codes;
+    std::array<Shard, 16> m_shards;
+};
+
+// The DiagnosticsLevel override of each thread, if any
+thread_local std::optional<usdex::core::DiagnosticsLevel> g_threadLevel;
+
 class DiagnosticsDelegate final : TfDiagnosticMgr::Delegate
 {
 public:
@@ -33,62 +677,151 @@ public:
 
     bool isActive()
     {
-        return m_active;
+        return m_active.load(std::memory_order_acquire);
     }
 
     void activate()
     {
-        if (!m_active)
+        std::lock_guard<std::mutex> lock(m_activationMutex);
+        if (!m_active.load(std::memory_order_relaxed))
         {
             TfDiagnosticMgr::GetInstance().AddDelegate(this);
-            m_active = true;
+            m_active.store(true, std::memory_order_release);
         }
     }
 
     void deactivate()
     {
-        if (m_active)
         {
-            TfDiagnosticMgr::GetInstance().RemoveDelegate(this);
-            m_active = false;
+            std::lock_guard<std::mutex> lock(m_activationMutex);
+            if (m_active.load(std::memory_order_relaxed))
+            {
+                TfDiagnosticMgr::GetInstance().RemoveDelegate(this);
+                m_active.store(false, std::memory_order_release);
+            }
         }
+        flush();
     }
 
     void setLevel(usdex::core::DiagnosticsLevel value)
     {
-        m_level = value;
+        m_level.store(value, std::memory_order_relaxed);
     }
 
     usdex::core::DiagnosticsLevel getLevel()
     {
-        return m_level;
+        return m_level.load(std::memory_order_relaxed);
     }
 
     void setOutputStream(usdex::core::DiagnosticsOutputStream value)
     {
-        m_outputStream = value;
+        m_outputStream.store(value, std::memory_order_relaxed);
     }
 
     usdex::core::DiagnosticsOutputStream getOutputStream()
     {
-        return m_outputStream;
+        return m_outputStream.load(std::memory_order_relaxed);
+    }
+
+    void setAsync(bool value)
+    {
+        if (value)
+        {
+            // The writer must be stopped at exit, while the output streams are still open, so that no queued messages are lost
+            static std::once_flag s_registerExit;
+            std::call_once(
+                s_registerExit,
+                []()
+                {
+                    std::atexit(
+                        []()
+                        {
+                            DiagnosticsDelegate::acquire()->m_writer.stop();
+                        }
+                    );
+                }
+            );
+            m_writer.start();
+        }
+        else
+        {
+            m_writer.stop();
+        }
+    }
+
+    bool isAsync()
+    {
+        return m_writer.isRunning();
+    }
+
+    void setLimits(const usdex::core::DiagnosticsLimits& value)
+    {
+        m_throttle.setLimits(value);
+    }
+
+    usdex::core::DiagnosticsLimits getLimits()
+    {
+        return m_throttle.getLimits();
+    }
+
+    DiagnosticsCounter& getCounter()
+    {
+        return m_counter;
+    }
+
+    void setCallback(const usdex::core::DiagnosticsCallbackFn& callback)
+    {
+        std::shared_ptr<const usdex::core::DiagnosticsCallbackFn> value;
+        if (callback)
+        {
+            value = std::make_shared<const usdex::core::DiagnosticsCallbackFn>(callback);
+        }
+        m_hasCallback.store(value != nullptr, std::memory_order_release);
+        std::atomic_store(&m_callback, std::move(value));
+    }
+
+    // Write a summary of any suppressed diagnostics and wait for all queued diagnostics to be written
+    void flush()
+    {
+        for (const std::string& message : m_throttle.summarize())
+        {
+            write(message);
+        }
+        m_writer.flush();
     }
 
     void IssueError(const TfError& err) override
     {
-        if (m_level < usdex::core::DiagnosticsLevel::eError)
+        m_counter.count(err, TF_DIAGNOSTIC_NONFATAL_ERROR_TYPE);
+
+        if (getEffectiveLevel() < usdex::core::DiagnosticsLevel::eError)
         {
             return;
         }
 
-        printDiagnostic(err);
+        printDiagnostic(err, TF_DIAGNOSTIC_NONFATAL_ERROR_TYPE);
     }
 
     void IssueFatalError(const TfCallContext& context, const std::string& msg) override
     {
         // This is invoked when TF_FATAL_CODING_ERROR or TF_FATAL_ERROR are emitted.
         // We simply print the message to the configured output stream. Afterwards
-        // TfDiagnosticMgr will log the crash and terminate the process.
+        // TfDiagnosticMgr will log the crash and terminate the process, so any
+        // queued diagnostics are written first and this message is written synchronously.
+        if (m_hasCallback.load(std::memory_order_acquire))
+        {
+            usdex::core::DiagnosticRecord record;
+            record.code = TF_DIAGNOSTIC_FATAL_ERROR_TYPE;
+            record.diagnosticCode = TfEnum(TF_DIAGNOSTIC_FATAL_ERROR_TYPE);
+            if (!context.IsHidden())
+            {
+                record.function = context.GetPrettyFunction();
+                record.file = context.GetFile();
+                record.line = context.GetLine();
+            }
+            record.commentary = msg;
+            invokeCallback(record);
+        }
         if (context.IsHidden())
         {
             print(TfStringPrintf("[Fatal] %s\n", msg.c_str()));
@@ -101,76 +834,130 @@ public:
 
     void IssueStatus(const TfStatus& status) override
     {
-        if (m_level < usdex::core::DiagnosticsLevel::eStatus)
+        m_counter.count(status, TF_DIAGNOSTIC_STATUS_TYPE);
+
+        if (getEffectiveLevel() < usdex::core::DiagnosticsLevel::eStatus)
         {
             return;
         }
 
-        printDiagnostic(status);
+        printDiagnostic(status, TF_DIAGNOSTIC_STATUS_TYPE);
     }
 
     void IssueWarning(const TfWarning& warning) override
     {
-        if (m_level < usdex::core::DiagnosticsLevel::eWarning)
+        m_counter.count(warning, TF_DIAGNOSTIC_WARNING_TYPE);
+
+        if (getEffectiveLevel() < usdex::core::DiagnosticsLevel::eWarning)
         {
             return;
         }
 
-        printDiagnostic(warning);
+        printDiagnostic(warning, TF_DIAGNOSTIC_WARNING_TYPE);
     }
 
 private:
 
-    std::string formatDiagnostic(const TfDiagnosticBase& diagnostic)
+    static usdex::core::DiagnosticRecord makeRecord(const TfDiagnosticBase& diagnostic, TfDiagnosticType fallback)
     {
+        usdex::core::DiagnosticRecord record;
+        record.code = resolveDiagnosticType(diagnostic.GetDiagnosticCode(), fallback);
+        record.diagnosticCode = diagnostic.GetDiagnosticCode();
+
         // It is possible for diagnostics to be emitted without any information in the call context,
         // in which case we should avoid adding that extra context in our diagnostic.
         // In particular this occurs for TfStatus emitted from python with verbose=False,
         // though it is possible there are other circumstances as well.
-        if (diagnostic.GetContext().IsHidden() || diagnostic.GetSourceFileName().empty())
+        const TfCallContext& context = diagnostic.GetContext();
+        if (!context.IsHidden() && !diagnostic.GetSourceFileName().empty())
         {
-            return TfStringPrintf(
-                "[%s] %s\n",
-                TfDiagnosticMgr::GetCodeName(diagnostic.GetDiagnosticCode()).c_str(),
-                diagnostic.GetCommentary().c_str()
-            );
+            record.function = context.GetFunction();
+            record.file = context.GetFile();
+            record.line = context.GetLine();
         }
-        else
+        record.commentary = diagnostic.GetCommentary();
+        return record;
+    }
+
+    void invokeCallback(const usdex::core::DiagnosticRecord& record)
+    {
+        // The callback is held by this thread for the duration of the call, so that it may be replaced concurrently
+        const std::shared_ptr<const usdex::core::DiagnosticsCallbackFn> callback = std::atomic_load(&m_callback);
+        if (callback)
         {
-            return TfStringPrintf(
-                "[%s] [%s] %s\n",
-                TfDiagnosticMgr::GetCodeName(diagnostic.GetDiagnosticCode()).c_str(),
-                diagnostic.GetSourceFunction().c_str(),
-                diagnostic.GetCommentary().c_str()
-            );
+            (*callback)(record);
         }
     }
 
-    void printDiagnostic(const TfDiagnosticBase& diagnostic)
+    // The level which applies to diagnostics emitted by the calling thread
+    usdex::core::DiagnosticsLevel getEffectiveLevel()
+    {
+        return g_threadLevel.has_value() ? g_threadLevel.value() : m_level.load(std::memory_order_relaxed);
+    }
+
+    void printDiagnostic(const TfDiagnosticBase& diagnostic, TfDiagnosticType fallback)
     {
-        if (m_outputStream == usdex::core::DiagnosticsOutputStream::eNone || diagnostic.GetQuiet())
+        const bool hasStream = getOutputStream() != usdex::core::DiagnosticsOutputStream::eNone;
+        const bool hasCallback = m_hasCallback.load(std::memory_order_acquire);
+        if ((!hasStream && !hasCallback) || diagnostic.GetQuiet())
+        {
+            return;
+        }
+
+        // Suppressed diagnostics are counted before any formatting occurs
+        if (!m_throttle.admit(diagnostic))
         {
             return;
         }
 
-        FILE* ostream = (m_outputStream == usdex::core::DiagnosticsOutputStream::eStderr) ? stderr : stdout;
-        fprintf(ostream, "%s", formatDiagnostic(diagnostic).c_str());
+        // The record only refers to the diagnostic, so the callback receives it without any formatting
+        const usdex::core::DiagnosticRecord record = makeRecord(diagnostic, fallback);
+        if (hasCallback)
+        {
+            invokeCallback(record);
+        }
+
+        if (hasStream)
+        {
+            write(usdex::core::formatDiagnosticRecord(record) + "\n");
+        }
     }
 
+    // Write a message to the configured output stream, asynchronously if the writer is running
+    void write(std::string message)
+    {
+        const usdex::core::DiagnosticsOutputStream outputStream = getOutputStream();
+        if (outputStream == usdex::core::DiagnosticsOutputStream::eNone)
+        {
+            return;
+        }
+
+        FILE* ostream = (outputStream == usdex::core::DiagnosticsOutputStream::eStderr) ? stderr : stdout;
+        m_writer.write(ostream, std::move(message));
+    }
+
+    // Write a message to the configured output stream synchronously, after any queued messages
     void print(const std::string& message)
     {
-        if (m_outputStream == usdex::core::DiagnosticsOutputStream::eNone)
+        const usdex::core::DiagnosticsOutputStream outputStream = getOutputStream();
+        if (outputStream == usdex::core::DiagnosticsOutputStream::eNone)
         {
             return;
         }
 
-        FILE* ostream = (m_outputStream == usdex::core::DiagnosticsOutputStream::eStderr) ? stderr : stdout;
-        fprintf(ostream, "%s", message.c_str());
+        FILE* ostream = (outputStream == usdex::core::DiagnosticsOutputStream::eStderr) ? stderr : stdout;
+        m_writer.writeSync(ostream, message);
     }
 
-    bool m_active;
-    usdex::core::DiagnosticsLevel m_level;
-    usdex::core::DiagnosticsOutputStream m_outputStream;
+    std::mutex m_activationMutex;
+    std::atomic<bool> m_active;
+    std::atomic<usdex::core::DiagnosticsLevel> m_level;
+    std::atomic<usdex::core::DiagnosticsOutputStream> m_outputStream;
+    AsyncWriter m_writer;
+    DiagnosticsThrottle m_throttle;
+    DiagnosticsCounter m_counter;
+    std::atomic<bool> m_hasCallback = false;
+    std::shared_ptr<const usdex::core::DiagnosticsCallbackFn> m_callback;
 };
 
 } // namespace
@@ -200,6 +987,26 @@ usdex::core::DiagnosticsLevel usdex::core::getDiagnosticsLevel()
     return ::DiagnosticsDelegate::acquire()->getLevel();
 }
 
+std::optional<usdex::core::DiagnosticsLevel> usdex::core::getThreadDiagnosticsLevel()
+{
+    return ::g_threadLevel;
+}
+
+void usdex::core::setThreadDiagnosticsLevel(std::optional<usdex::core::DiagnosticsLevel> value)
+{
+    ::g_threadLevel = value;
+}
+
+usdex::core::ScopedDiagnosticsLevel::ScopedDiagnosticsLevel(usdex::core::DiagnosticsLevel value) : m_previous(::g_threadLevel)
+{
+    ::g_threadLevel = value;
+}
+
+usdex::core::ScopedDiagnosticsLevel::~ScopedDiagnosticsLevel()
+{
+    ::g_threadLevel = m_previous;
+}
+
 usdex::core::DiagnosticsLevel usdex::core::getDiagnosticLevel(TfDiagnosticType code)
 {
     switch (code)
@@ -231,3 +1038,82 @@ usdex::core::DiagnosticsOutputStream usdex::core::getDiagnosticsOutputStream()
 {
     return ::DiagnosticsDelegate::acquire()->getOutputStream();
 }
+
+void usdex::core::setDiagnosticsOutputAsync(bool value)
+{
+    ::DiagnosticsDelegate::acquire()->setAsync(value);
+}
+
+bool usdex::core::isDiagnosticsOutputAsync()
+{
+    return ::DiagnosticsDelegate::acquire()->isAsync();
+}
+
+void usdex::core::setDiagnosticsLimits(const usdex::core::DiagnosticsLimits& value)
+{
+    ::DiagnosticsDelegate::acquire()->setLimits(value);
+}
+
+usdex::core::DiagnosticsLimits usdex::core::getDiagnosticsLimits()
+{
+    return ::DiagnosticsDelegate::acquire()->getLimits();
+}
+
+void usdex::core::setDiagnosticsCallback(const usdex::core::DiagnosticsCallbackFn& callback)
+{
+    ::DiagnosticsDelegate::acquire()->setCallback(callback);
+}
+
+std::string usdex::core::formatDiagnosticRecord(const usdex::core::DiagnosticRecord& record)
+{
+    const bool fatal = record.code == TF_DIAGNOSTIC_FATAL_ERROR_TYPE || record.code == TF_DIAGNOSTIC_FATAL_CODING_ERROR_TYPE;
+    const std::string codeName = fatal ? std::string("Fatal") : TfDiagnosticMgr::GetCodeName(record.diagnosticCode);
+    const std::string commentary(record.commentary);
+    if (record.function.empty())
+    {
+        return TfStringPrintf("[%s] %s", codeName.c_str(), commentary.c_str());
+    }
+
+    const std::string function(record.function);
+    return TfStringPrintf("[%s] [%s] %s", codeName.c_str(), function.c_str(), commentary.c_str());
+}
+
+void usdex::core::setDiagnosticsCountingEnabled(bool value)
+{
+    ::DiagnosticsDelegate::acquire()->getCounter().setEnabled(value);
+}
+
+bool usdex::core::isDiagnosticsCountingEnabled()
+{
+    return ::DiagnosticsDelegate::acquire()->getCounter().isEnabled();
+}
+
+void usdex::core::setDiagnosticsCaptureLimit(size_t value)
+{
+    ::DiagnosticsDelegate::acquire()->getCounter().setCaptureLimit(value);
+}
+
+size_t usdex::core::getDiagnosticsCaptureLimit()
+{
+    return ::DiagnosticsDelegate::acquire()->getCounter().getCaptureLimit();
+}
+
+std::map<TfDiagnosticType, uint64_t> usdex::core::getDiagnosticsCounts()
+{
+    return ::DiagnosticsDelegate::acquire()->getCounter().getCounts();
+}
+
+std::vector<usdex::core::DiagnosticsSourceCount> usdex::core::getDiagnosticsSourceCounts()
+{
+    return ::DiagnosticsDelegate::acquire()->getCounter().getSourceCounts();
+}
+
+void usdex::core::resetDiagnosticsCounts()
+{
+    ::DiagnosticsDelegate::acquire()->getCounter().reset();
+}
+
+void usdex::core::flushDiagnostics()
+{
+    ::DiagnosticsDelegate::acquire()->flush();
+}
@@ -0,0 +1,749 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "GeomUtils.h"
+
+#include "usdex/core/Authoring.h"
+
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/reduce.h>
+#include <pxr/usd/usdGeom/pointBased.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <queue>
+
+using namespace pxr;
+
+namespace
+{
+
+// Arrays are reduced in chunks of this many points, arrays smaller than this are reduced serially
+static constexpr size_t s_grainSize = 65536;
+
+// Component-wise bounds, stored as plain floats so that the reduction loops are simple enough for the compiler to vectorize
+struct Bounds
+{
+    float min[3] = { std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
+    float max[3] = { -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+};
+
+Bounds unionBounds(const Bounds& lhs, const Bounds& rhs)
+{
+    Bounds result;
+    for (size_t c = 0; c < 3; ++c)
+    {
+        result.min[c] = (lhs.min[c] < rhs.min[c]) ? lhs.min[c] : rhs.min[c];
+        result.max[c] = (lhs.max[c] > rhs.max[c]) ? lhs.max[c] : rhs.max[c];
+    }
+    return result;
+}
+
+// Reduce the bounds of the points in [begin, end)
+Bounds pointBounds(const float* points, size_t begin, size_t end)
+{
+    float minX = points[begin * 3];
+    float minY = points[begin * 3 + 1];
+    float minZ = points[begin * 3 + 2];
+    float maxX = minX;
+    float maxY = minY;
+    float maxZ = minZ;
+    for (size_t i = begin + 1; i < end; ++i)
+    {
+        const float x = points[i * 3];
+        const float y = points[i * 3 + 1];
+        const float z = points[i * 3 + 2];
+        minX = (minX < x) ? minX : x;
+        minY = (minY < y) ? minY : y;
+        minZ = (minZ < z) ? minZ : z;
+        maxX = (maxX > x) ? maxX : x;
+        maxY = (maxY > y) ? maxY : y;
+        maxZ = (maxZ > z) ? maxZ : z;
+    }
+
+    Bounds result;
+    result.min[0] = minX;
+    result.min[1] = minY;
+    result.min[2] = minZ;
+    result.max[0] = maxX;
+    result.max[1] = maxY;
+    result.max[2] = maxZ;
+    return result;
+}
+
+// Reduce the bounds of the points in [begin, end), each expanded by half of its width
+Bounds widePointBounds(const float* points, const float* widths, size_t begin, size_t end)
+{
+    Bounds result;
+    float* min = result.min;
+    float* max = result.max;
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float halfWidth = widths[i] / 2;
+        for (size_t c = 0; c < 3; ++c)
+        {
+            // the width may be negative, so both sides must be considered for each bound
+            const float lo = points[i * 3 + c] - halfWidth;
+            const float hi = points[i * 3 + c] + halfWidth;
+            const float a = (lo < hi) ? lo : hi;
+            const float b = (lo < hi) ? hi : lo;
+            min[c] = (min[c] < a) ? min[c] : a;
+            max[c] = (max[c] > b) ? max[c] : b;
+        }
+    }
+    return result;
+}
+
+template <typename Fn>
+Bounds reduceBounds(size_t numPoints, Fn&& chunkBounds)
+{
+    if (numPoints <= s_grainSize)
+    {
+        return chunkBounds(0, numPoints);
+    }
+
+    return WorkParallelReduceN(
+        Bounds(),
+        numPoints,
+        [&chunkBounds](size_t begin, size_t end, const Bounds& identity)
+        {
+            return ::unionBounds(identity, chunkBounds(begin, end));
+        },
+        [](const Bounds& lhs, const Bounds& rhs)
+        {
+            return ::unionBounds(lhs, rhs);
+        },
+        s_grainSize
+    );
+}
+
+// The weight of the planes which preserve the boundaries of a mesh during simplification, relative to the area weighted planes of its faces
+static constexpr double s_boundaryWeight = 10.0;
+
+// The minimum cosine of the angle between the normals of a triangle before and after an edge collapse, which prevents triangles from flipping
+static constexpr double s_minNormalAlignment = 0.2;
+
+// The minimum quality of a triangle produced by an edge collapse, unless the triangle was already of a lower quality
+static constexpr double s_minTriangleQuality = 0.1;
+
+// The quality of a triangle, given its unnormalized normal, which is 1 for an equilateral triangle and approaches 0 as the triangle degenerates
+double triangleQuality(const GfVec3d& normal, const GfVec3d& p0, const GfVec3d& p1, const GfVec3d& p2)
+{
+    const double sumSq = (p1 - p0).GetLengthSq() + (p2 - p1).GetLengthSq() + (p0 - p2).GetLengthSq();
+    return (sumSq > 0.0) ? 2.0 * std::sqrt(3.0) * std::sqrt(normal.GetLengthSq()) / sumSq : 0.0;
+}
+
+// A symmetric 4x4 matrix measuring the sum of the squared distances from a point to a set of weighted planes, stored as its upper triangle
+struct Quadric
+{
+    double m[10] = {};
+
+    void addPlane(const GfVec3d& normal, double distance, double weight)
+    {
+        m[0] += weight * normal[0] * normal[0];
+        m[1] += weight * normal[0] * normal[1];
+        m[2] += weight * normal[0] * normal[2];
+        m[3] += weight * normal[0] * distance;
+        m[4] += weight * normal[1] * normal[1];
+        m[5] += weight * normal[1] * normal[2];
+        m[6] += weight * normal[1] * distance;
+        m[7] += weight * normal[2] * normal[2];
+        m[8] += weight * normal[2] * distance;
+        m[9] += weight * distance * distance;
+    }
+
+    void add(const Quadric& other)
+    {
+        for (size_t i = 0; i < 10; ++i)
+        {
+            m[i] += other.m[i];
+        }
+    }
+
+    double evaluate(const GfVec3d& p) const
+    {
+        const double x = p[0];
+        const double y = p[1];
+        const double z = p[2];
+        return m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z + 2.0 * m[3] * x + m[4] * y * y + 2.0 * m[5] * y * z + 2.0 * m[6] * y +
+               m[7] * z * z + 2.0 * m[8] * z + m[9];
+    }
+};
+
+// A candidate half-edge collapse, which is stale if either point has changed since it was evaluated.
+// The collapses are kept small, as the queue holds every edge of the mesh.
+struct Collapse
+{
+    float cost;
+    int remove;
+    int keep;
+    uint32_t stamp; // The sum of the stamps of both points, which only ever increase
+
+    // Orders the priority queue by the lowest cost first, breaking ties by point index so that the result is deterministic
+    bool operator<(const Collapse& other) const
+    {
+        if (cost != other.cost)
+        {
+            return cost > other.cost;
+        }
+        if (remove != other.remove)
+        {
+            return remove > other.remove;
+        }
+        return keep > other.keep;
+    }
+};
+
+// Edge collapse simplification of a triangulated mesh
+class Simplifier
+{
+public:
+
+    Simplifier(
+        const VtIntArray& faceVertexCounts,
+        const VtIntArray& faceVertexIndices,
+        const VtVec3fArray& points,
+        const std::vector<char>& lockedPoints
+    )
+        : m_points(points),
+          m_quadrics(points.size()),
+          m_pointTriangles(points.size()),
+          m_removed(points.size(), 0),
+          m_boundary(points.size(), 0),
+          m_stamps(points.size(), 0)
+    {
+        m_locked = lockedPoints.empty() ? std::vector<char>(points.size(), 0) : lockedPoints;
+
+        // Triangulate the faces as fans, retaining the original face and face vertex of each triangle corner.
+        // Degenerate triangles have no surface to preserve, so they are discarded.
+        int corner = 0;
+        for (size_t face = 0; face < faceVertexCounts.size(); ++face)
+        {
+            const int count = faceVertexCounts[face];
+            for (int k = 1; k + 1 < count; ++k)
+            {
+                const std::array<int, 3> corners = { corner, corner + k, corner + k + 1 };
+                const std::array<int, 3> triangle = { faceVertexIndices[corners[0]], faceVertexIndices[corners[1]], faceVertexIndices[corners[2]] };
+                if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])
+                {
+                    continue;
+                }
+                m_triPoints.push_back(triangle);
+                m_triCorners.push_back(corners);
+                m_triFaces.push_back(static_cast<int>(face));
+            }
+            corner += count;
+        }
+        m_alive.assign(m_triPoints.size(), 1);
+        m_aliveCount = m_triPoints.size();
+
+        // Accumulate the area weighted plane of each triangle into the quadric of each of its points
+        for (size_t t = 0; t < m_triPoints.size(); ++t)
+        {
+            const std::array<int, 3>& triangle = m_triPoints[t];
+            GfVec3d normal = triangleNormal(t);
+            const double length = normal.Normalize();
+            if (length > 0.0)
+            {
+                const double distance = -GfDot(normal, position(triangle[0]));
+                for (int point : triangle)
+                {
+                    m_quadrics[point].addPlane(normal, distance, 0.5 * length);
+                }
+            }
+            for (int point : triangle)
+            {
+                m_pointTriangles[point].push_back(static_cast<int>(t));
+            }
+        }
+
+        // Find the unique edges. Boundary edges are used by a single triangle, and are preserved by planes perpendicular to that triangle.
+        // Non-manifold edges are used by more than two triangles, and their points are never removed.
+        std::vector<std::pair<uint64_t, int>> edges;
+        edges.reserve(m_triPoints.size() * 3);
+        for (size_t t = 0; t < m_triPoints.size(); ++t)
+        {
+            for (size_t e = 0; e < 3; ++e)
+            {
+                const uint64_t a = static_cast<uint64_t>(m_triPoints[t][e]);
+                const uint64_t b = static_cast<uint64_t>(m_triPoints[t][(e + 1) % 3]);
+                edges.emplace_back((std::min(a, b) << 32) | std::max(a, b), static_cast<int>(t));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+
+        for (size_t begin = 0; begin < edges.size();)
+        {
+            size_t end = begin + 1;
+            while (end < edges.size() && edges[end].first == edges[begin].first)
+            {
+                ++end;
+            }
+
+            const int a = static_cast<int>(edges[begin].first >> 32);
+            const int b = static_cast<int>(edges[begin].first & 0xFFFFFFFFull);
+            if (end - begin == 1)
+            {
+                GfVec3d faceNormal = triangleNormal(static_cast<size_t>(edges[begin].second));
+                faceNormal.Normalize();
+                const GfVec3d edge = position(b) - position(a);
+                GfVec3d normal = GfCross(edge, faceNormal);
+                if (normal.Normalize() > 0.0)
+                {
+                    const double distance = -GfDot(normal, position(a));
+                    const double weight = s_boundaryWeight * edge.GetLengthSq();
+                    m_quadrics[a].addPlane(normal, distance, weight);
+                    m_quadrics[b].addPlane(normal, distance, weight);
+                }
+                m_boundary[a] = 1;
+                m_boundary[b] = 1;
+            }
+            else if (end - begin > 2)
+            {
+                m_locked[a] = 1;
+                m_locked[b] = 1;
+            }
+            m_edges.emplace_back(a, b);
+            begin = end;
+        }
+    }
+
+    void simplify(size_t targetTriangles)
+    {
+        for (const auto& [a, b] : m_edges)
+        {
+            pushCollapse(a, b);
+        }
+
+        std::vector<int> neighbors;
+        while (m_aliveCount > targetTriangles && !m_queue.empty())
+        {
+            const Collapse collapse = m_queue.top();
+            m_queue.pop();
+            if (m_removed[collapse.remove] || m_removed[collapse.keep] || m_stamps[collapse.remove] + m_stamps[collapse.keep] != collapse.stamp)
+            {
+                continue;
+            }
+            if (!isValidCollapse(collapse.remove, collapse.keep))
+            {
+                continue;
+            }
+
+            applyCollapse(collapse.remove, collapse.keep);
+
+            // Every edge of the kept point has a new cost, as its quadric has changed
+            getNeighbors(collapse.keep, neighbors);
+            for (int neighbor : neighbors)
+            {
+                pushCollapse(collapse.keep, neighbor);
+            }
+        }
+    }
+
+    usdex::core::detail::SimplifiedTopology getResult() const
+    {
+        usdex::core::detail::SimplifiedTopology result;
+
+        // The simplified points retain the order of the original points
+        std::vector<int> pointMap(m_points.size(), -1);
+        for (size_t t = 0; t < m_triPoints.size(); ++t)
+        {
+            if (m_alive[t])
+            {
+                for (int point : m_triPoints[t])
+                {
+                    pointMap[point] = 0;
+                }
+            }
+        }
+        for (size_t point = 0; point < pointMap.size(); ++point)
+        {
+            if (pointMap[point] == 0)
+            {
+                pointMap[point] = static_cast<int>(result.points.size());
+                result.points.push_back(static_cast<int>(point));
+            }
+        }
+
+        result.faces.reserve(m_aliveCount);
+        result.faceVertices.reserve(m_aliveCount * 3);
+        result.faceVertexIndices.reserve(m_aliveCount * 3);
+        for (size_t t = 0; t < m_triPoints.size(); ++t)
+        {
+            if (!m_alive[t])
+            {
+                continue;
+            }
+            result.faces.push_back(m_triFaces[t]);
+            for (size_t c = 0; c < 3; ++c)
+            {
+                result.faceVertexIndices.push_back(pointMap[m_triPoints[t][c]]);
+                result.faceVertices.push_back(m_triCorners[t][c]);
+            }
+        }
+        return result;
+    }
+
+private:
+
+    GfVec3d position(int point) const
+    {
+        return GfVec3d(m_points[point]);
+    }
+
+    GfVec3d triangleNormal(size_t t) const
+    {
+        const std::array<int, 3>& triangle = m_triPoints[t];
+        const GfVec3d p0 = position(triangle[0]);
+        return GfCross(position(triangle[1]) - p0, position(triangle[2]) - p0);
+    }
+
+    bool contains(size_t t, int point) const
+    {
+        const std::array<int, 3>& triangle = m_triPoints[t];
+        return triangle[0] == point || triangle[1] == point || triangle[2] == point;
+    }
+
+    // The number of alive triangles which use the edge between two points
+    size_t edgeTriangleCount(int a, int b) const
+    {
+        size_t count = 0;
+        for (int t : m_pointTriangles[a])
+        {
+            if (m_alive[t] && contains(static_cast<size_t>(t), b))
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // The sorted points which share an alive triangle with the given point
+    void getNeighbors(int point, std::vector<int>& neighbors) const
+    {
+        neighbors.clear();
+        for (int t : m_pointTriangles[point])
+        {
+            if (m_alive[t])
+            {
+                for (int other : m_triPoints[t])
+                {
+                    if (other != point)
+                    {
+                        neighbors.push_back(other);
+                    }
+                }
+            }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+
+    // Queue the cheapest permissible direction of collapsing the edge between two points
+    void pushCollapse(int a, int b)
+    {
+        std::optional<Collapse> best;
+        for (const auto& [remove, keep] : { std::make_pair(a, b), std::make_pair(b, a) })
+        {
+            // Locked points are never removed, and boundary points are only removed along the boundary
+            if (m_locked[remove] || (m_boundary[remove] && !m_boundary[keep]))
+            {
+                continue;
+            }
+
+            Quadric quadric = m_quadrics[remove];
+            quadric.add(m_quadrics[keep]);
+            const float cost = static_cast<float>(std::max(quadric.evaluate(position(keep)), 0.0));
+            if (!best.has_value() || cost < best->cost)
+            {
+                best = Collapse{ cost, remove, keep, m_stamps[remove] + m_stamps[keep] };
+            }
+        }
+        if (best.has_value())
+        {
+            m_queue.push(best.value());
+        }
+    }
+
+    bool isValidCollapse(int remove, int keep) const
+    {
+        // The points opposite the edge in the triangles which will be collapsed
+        std::vector<int> opposite;
+        for (int t : m_pointTriangles[remove])
+        {
+            if (m_alive[t] && contains(t, keep))
+            {
+                for (int point : m_triPoints[t])
+                {
+                    if (point != remove && point != keep)
+                    {
+                        opposite.push_back(point);
+                    }
+                }
+            }
+        }
+        if (opposite.empty())
+        {
+            return false;
+        }
+
+        // Boundary points can only move along a boundary edge
+        if (m_boundary[remove] && opposite.size() != 1)
+        {
+            return false;
+        }
+
+        // A collapsed triangle must not be the only triangle on either of its other edges, as the surface would be reduced to nothing there
+        for (int point : opposite)
+        {
+            if (edgeTriangleCount(remove, point) == 1 && edgeTriangleCount(keep, point) == 1)
+            {
+                return false;
+            }
+        }
+
+        // The collapse must not join the surface anywhere other than the collapsed triangles (the link condition)
+        std::vector<int> removeNeighbors;
+        std::vector<int> keepNeighbors;
+        getNeighbors(remove, removeNeighbors);
+        getNeighbors(keep, keepNeighbors);
+        std::sort(opposite.begin(), opposite.end());
+        std::vector<int> shared;
+        std::set_intersection(removeNeighbors.begin(), removeNeighbors.end(), keepNeighbors.begin(), keepNeighbors.end(), std::back_inserter(shared));
+        if (!std::includes(opposite.begin(), opposite.end(), shared.begin(), shared.end()))
+        {
+            return false;
+        }
+
+        // The remaining triangles must not flip or become degenerate
+        const GfVec3d target = position(keep);
+        for (int t : m_pointTriangles[remove])
+        {
+            if (!m_alive[t] || contains(t, keep))
+            {
+                continue;
+            }
+            const std::array<int, 3>& triangle = m_triPoints[t];
+            std::array<GfVec3d, 3> moved = { position(triangle[0]), position(triangle[1]), position(triangle[2]) };
+            for (size_t c = 0; c < 3; ++c)
+            {
+                if (triangle[c] == remove)
+                {
+                    moved[c] = target;
+                }
+            }
+            GfVec3d before = triangleNormal(static_cast<size_t>(t));
+            GfVec3d after = GfCross(moved[1] - moved[0], moved[2] - moved[0]);
+            const double beforeQuality = ::triangleQuality(before, position(triangle[0]), position(triangle[1]), position(triangle[2]));
+            const double afterQuality = ::triangleQuality(after, moved[0], moved[1], moved[2]);
+            before.Normalize();
+            if (after.Normalize() == 0.0 || GfDot(before, after) < s_minNormalAlignment)
+            {
+                return false;
+            }
+            if (afterQuality < s_minTriangleQuality && afterQuality < beforeQuality)
+            {
+                return false;
+            }
+
+            // The moved triangle must not duplicate an existing triangle of the kept point (e.g. when collapsing a tetrahedron)
+            std::array<int, 2> others = { -1, -1 };
+            for (int point : triangle)
+            {
+                if (point != remove)
+                {
+                    others[(others[0] < 0) ? 0 : 1] = point;
+                }
+            }
+            for (int other : m_pointTriangles[keep])
+            {
+                if (m_alive[other] && contains(static_cast<size_t>(other), others[0]) && contains(static_cast<size_t>(other), others[1]))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void applyCollapse(int remove, int keep)
+    {
+        // The collapsed triangles, with the point opposite the edge and the face vertex of the kept point
+        std::vector<std::pair<int, int>> collapsed;
+        for (int t : m_pointTriangles[remove])
+        {
+            if (m_alive[t] && contains(t, keep))
+            {
+                const std::array<int, 3>& triangle = m_triPoints[t];
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    if (triangle[c] != remove && triangle[c] != keep)
+                    {
+                        const size_t keepIndex = (triangle[(c + 1) % 3] == keep) ? (c + 1) % 3 : (c + 2) % 3;
+                        collapsed.emplace_back(triangle[c], m_triCorners[t][keepIndex]);
+                    }
+                }
+                m_alive[t] = 0;
+                --m_aliveCount;
+            }
+        }
+
+        // Move the face vertices of the removed point onto the kept point. Each takes the face vertex of the kept point from the adjacent
+        // collapsed triangle, so that faceVarying values are continuous with the neighboring faces.
+        for (int t : m_pointTriangles[remove])
+        {
+            if (!m_alive[t])
+            {
+                continue;
+            }
+            std::array<int, 3>& triangle = m_triPoints[t];
+            int keepCorner = collapsed.front().second;
+            for (const auto& [point, corner] : collapsed)
+            {
+                if (contains(static_cast<size_t>(t), point))
+                {
+                    keepCorner = corner;
+                    break;
+                }
+            }
+            for (size_t c = 0; c < 3; ++c)
+            {
+                if (triangle[c] == remove)
+                {
+                    triangle[c] = keep;
+                    m_triCorners[t][c] = keepCorner;
+                }
+            }
+            m_pointTriangles[keep].push_back(t);
+        }
+
+        m_quadrics[keep].add(m_quadrics[remove]);
+        m_boundary[keep] = m_boundary[keep] || m_boundary[remove];
+        m_removed[remove] = 1;
+        m_pointTriangles[remove].clear();
+        ++m_stamps[keep];
+
+        std::vector<int>& keepTriangles = m_pointTriangles[keep];
+        keepTriangles.erase(
+            std::remove_if(
+                keepTriangles.begin(),
+                keepTriangles.end(),
+                [this](int t)
+                {
+                    return !m_alive[t];
+                }
+            ),
+            keepTriangles.end()
+        );
+    }
+
+    const VtVec3fArray& m_points;
+    std::vector<Quadric> m_quadrics;
+    std::vector<std::vector<int>> m_pointTriangles;
+    std::vector<char> m_removed;
+    std::vector<char> m_boundary;
+    std::vector<char> m_locked;
+    std::vector<uint32_t> m_stamps;
+    std::vector<std::array<int, 3>> m_triPoints;
+    std::vector<std::array<int, 3>> m_triCorners;
+    std::vector<int> m_triFaces;
+    std::vector<char> m_alive;
+    size_t m_aliveCount = 0;
+    std::vector<std::pair<int, int>> m_edges;
+    std::priority_queue<Collapse> m_queue;
+};
+
+} // namespace
+
+VtVec3fArray usdex::core::detail::computeExtent(const VtVec3fArray& points, float padding)
+{
+    TRACE_FUNCTION();
+
+    VtVec3fArray extent;
+    if (points.empty())
+    {
+        UsdGeomPointBased::ComputeExtent(points, &extent);
+        return extent;
+    }
+
+    const float* data = points.cdata()->data();
+    const Bounds bounds = ::reduceBounds(
+        points.size(),
+        [data](size_t begin, size_t end)
+        {
+            return ::pointBounds(data, begin, end);
+        }
+    );
+
+    extent.resize(2);
+    extent[0] = GfVec3f(bounds.min[0] - padding, bounds.min[1] - padding, bounds.min[2] - padding);
+    extent[1] = GfVec3f(bounds.max[0] + padding, bounds.max[1] + padding, bounds.max[2] + padding);
+    return extent;
+}
+
+VtVec3fArray usdex::core::detail::computeExtent(const VtVec3fArray& points, const VtFloatArray& widths)
+{
+    TRACE_FUNCTION();
+
+    VtVec3fArray extent;
+    if (points.empty())
+    {
+        UsdGeomPointBased::ComputeExtent(points, &extent);
+        return extent;
+    }
+
+    const float* pointsData = points.cdata()->data();
+    const float* widthsData = widths.cdata();
+    const Bounds bounds = ::reduceBounds(
+        points.size(),
+        [pointsData, widthsData](size_t begin, size_t end)
+        {
+            return ::widePointBounds(pointsData, widthsData, begin, end);
+        }
+    );
+
+    extent.resize(2);
+    extent[0] = GfVec3f(bounds.min[0], bounds.min[1], bounds.min[2]);
+    extent[1] = GfVec3f(bounds.max[0], bounds.max[1], bounds.max[2]);
+    return extent;
+}
+
+bool usdex::core::detail::shouldValidateContents()
+{
+    switch (usdex::core::getValidationPolicy())
+    {
+        case usdex::core::ValidationPolicy::eTrusted:
+            return false;
+        case usdex::core::ValidationPolicy::eDebug:
+#ifdef NDEBUG
+            return false;
+#else
+            return true;
+#endif
+        default:
+            return true;
+    }
+}
+
+usdex::core::detail::SimplifiedTopology usdex::core::detail::simplifyTopology(
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    const std::vector<char>& lockedPoints,
+    size_t targetTriangles
+)
+{
+    TRACE_FUNCTION();
+
+    ::Simplifier simplifier(faceVertexCounts, faceVertexIndices, points, lockedPoints);
+    simplifier.simplify(targetTriangles);
+    return simplifier.getResult();
+}
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+
+#include <vector>
+
+namespace usdex::core::detail
+{
+
+//! Compute the extent of an array of points, optionally padded uniformly in all directions.
+//!
+//! The result is identical to `UsdGeomPointBased::ComputeExtent` (when `padding` is zero) or `UsdGeomCurves::ComputeExtent` (when `padding` is
+//! half of the maximum width), but avoids the per-point range unions and the schema plugin lookup. Large arrays are reduced in parallel chunks.
+//!
+//! @param points The points to bound
+//! @param padding The distance by which to expand the bounds in all directions
+//! @returns The extent as a min and max pair. If there are no points the extent will be an empty range.
+pxr::VtVec3fArray computeExtent(const pxr::VtVec3fArray& points, float padding = 0.0f);
+
+//! Compute the extent of an array of points, each of which is expanded in all directions by half of its matching width.
+//!
+//! The result is identical to `UsdGeomPoints::ComputeExtent`. Large arrays are reduced in parallel chunks.
+//!
+//! @note The widths must contain one value per point. The caller is responsible for ensuring this prior to calling this function.
+//!
+//! @param points The points to bound
+//! @param widths The width of each point
+//! @returns The extent as a min and max pair. If there are no points the extent will be an empty range.
+pxr::VtVec3fArray computeExtent(const pxr::VtVec3fArray& points, const pxr::VtFloatArray& widths);
+
+//! Determine whether the geometry `define` functions should validate the contents of their arrays, according to the `ValidationPolicy` of the
+//! calling thread.
+//!
+//! @note The policy is thread local, so functions which validate concurrently must apply the policy of the calling thread to each task (e.g.
+//! using a `ScopedValidationPolicy`).
+//!
+//! @returns True if the contents should be validated, false if they are trusted.
+bool shouldValidateContents();
+
+//! A simplified triangle mesh, described in terms of the elements of the polygon mesh it was simplified from, so that any primvar of the
+//! original mesh can be remapped onto it.
+struct SimplifiedTopology
+{
+    std::vector<int> points; //!< The index of the original point of each simplified point
+    std::vector<int> faces; //!< The index of the original face of each simplified triangle
+    std::vector<int> faceVertices; //!< The index of the original face vertex of each simplified face vertex
+    pxr::VtIntArray faceVertexIndices; //!< Indices of the simplified points used for each face vertex of the simplified triangles
+};
+
+//! Simplify a polygon mesh by collapsing its edges, in order of the least change to its surface, until the target number of triangles remain.
+//!
+//! The polygons are triangulated as fans, and each edge collapse removes one point, moving its face vertices onto the remaining point of the
+//! edge (a half-edge collapse), so the simplified points are a subset of the original points. The change to the surface is measured using
+//! quadric error metrics, with additional planes along the boundary edges so that open boundaries retain their shape.
+//!
+//! Collapses which would produce non-manifold topology, flip a triangle, or remove a point on a boundary other than along the boundary are
+//! never made. The simplified mesh may therefore retain more triangles than the target. The result is deterministic.
+//!
+//! @note The topology must be valid for the points. The caller is responsible for ensuring this prior to calling this function.
+//!
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the points used for each face vertex of the mesh
+//! @param points The points of the mesh
+//! @param lockedPoints Points which must not be removed (e.g. where primvar values differ across faces). This may be empty.
+//! @param targetTriangles The number of triangles at which to stop simplifying
+//! @returns The simplified mesh
+SimplifiedTopology simplifyTopology(
+    const pxr::VtIntArray& faceVertexCounts,
+    const pxr::VtIntArray& faceVertexIndices,
+    const pxr::VtVec3fArray& points,
+    const std::vector<char>& lockedPoints,
+    size_t targetTriangles
+);
+
+} // namespace usdex::core::detail
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "usdex/core/Instrumentation.h"
+
+#include "InstrumentationUtils.h"
+
+#include <memory>
+#include <mutex>
+
+using namespace usdex::core;
+
+#if !defined(USDEX_DISABLE_INSTRUMENTATION)
+
+namespace
+{
+
+// The counters of every entry point that has been called, keyed by name. Counters are never removed, so references to them remain valid.
+struct InstrumentationRegistry
+{
+    std::mutex mutex;
+    std::map<std::string, std::unique_ptr<detail::InstrumentationCounters>> counters;
+};
+
+InstrumentationRegistry& getRegistry()
+{
+    static InstrumentationRegistry s_registry;
+    return s_registry;
+}
+
+} // namespace
+
+std::atomic<bool> usdex::core::detail::g_instrumentationEnabled{ false };
+
+thread_local bool usdex::core::detail::ScopedInstrumentation::s_active = false;
+
+detail::InstrumentationCounters& usdex::core::detail::getInstrumentationCounters(const char* name)
+{
+    InstrumentationRegistry& registry = ::getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::unique_ptr<InstrumentationCounters>& counters = registry.counters[name];
+    if (!counters)
+    {
+        counters = std::make_unique<InstrumentationCounters>();
+    }
+    return *counters;
+}
+
+void usdex::core::setInstrumentationEnabled(bool value)
+{
+    detail::g_instrumentationEnabled.store(value, std::memory_order_relaxed);
+}
+
+bool usdex::core::isInstrumentationEnabled()
+{
+    return detail::g_instrumentationEnabled.load(std::memory_order_relaxed);
+}
+
+std::map<std::string, AuthoringMetrics> usdex::core::getAuthoringMetrics()
+{
+    std::map<std::string, AuthoringMetrics> result;
+
+    InstrumentationRegistry& registry = ::getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& [name, counters] : registry.counters)
+    {
+        const uint64_t calls = counters->calls.load(std::memory_order_relaxed);
+        if (calls == 0)
+        {
+            continue;
+        }
+
+        AuthoringMetrics& metrics = result[name];
+        metrics.calls = calls;
+        metrics.seconds = static_cast<double>(counters->nanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+        metrics.elements = counters->elements.load(std::memory_order_relaxed);
+        metrics.bytes = counters->bytes.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void usdex::core::resetAuthoringMetrics()
+{
+    InstrumentationRegistry& registry = ::getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& [name, counters] : registry.counters)
+    {
+        counters->calls.store(0, std::memory_order_relaxed);
+        counters->nanoseconds.store(0, std::memory_order_relaxed);
+        counters->elements.store(0, std::memory_order_relaxed);
+        counters->bytes.store(0, std::memory_order_relaxed);
+    }
+}
+
+#else
+
+void usdex::core::setInstrumentationEnabled(bool)
+{
+}
+
+bool usdex::core::isInstrumentationEnabled()
+{
+    return false;
+}
+
+std::map<std::string, AuthoringMetrics> usdex::core::getAuthoringMetrics()
+{
+    return {};
+}
+
+void usdex::core::resetAuthoringMetrics()
+{
+}
+
+#endif
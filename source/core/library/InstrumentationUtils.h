@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace usdex::core::detail
+{
+
+#if !defined(USDEX_DISABLE_INSTRUMENTATION)
+
+//! The counters accumulated for a single entry point. Each counter is updated independently with relaxed ordering.
+struct InstrumentationCounters
+{
+    std::atomic<uint64_t> calls{ 0 };
+    std::atomic<uint64_t> nanoseconds{ 0 };
+    std::atomic<uint64_t> elements{ 0 };
+    std::atomic<uint64_t> bytes{ 0 };
+};
+
+//! Whether instrumentation is enabled. Only ever read with relaxed ordering.
+extern std::atomic<bool> g_instrumentationEnabled;
+
+//! Get the counters for the named entry point, registering them on first use.
+//!
+//! The counters live for the lifetime of the library, so the result is intended to be cached in a function local static.
+//!
+//! @param name The name of the entry point. All overloads of a function should share the same name.
+//! @returns The counters of the entry point.
+InstrumentationCounters& getInstrumentationCounters(const char* name);
+
+//! Measure a single call to an entry point for the lifetime of this object.
+//!
+//! When instrumentation is disabled, or when another instrumented call is already in progress on the calling thread, nothing is measured and
+//! the element and byte counts are discarded.
+class ScopedInstrumentation
+{
+
+public:
+
+    explicit ScopedInstrumentation(InstrumentationCounters& counters)
+    {
+        if (g_instrumentationEnabled.load(std::memory_order_relaxed) && !s_active)
+        {
+            s_active = true;
+            m_counters = &counters;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedInstrumentation()
+    {
+        if (m_counters != nullptr)
+        {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+            m_counters->calls.fetch_add(1, std::memory_order_relaxed);
+            m_counters->nanoseconds.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+            m_counters->elements.fetch_add(m_elements, std::memory_order_relaxed);
+            m_counters->bytes.fetch_add(m_bytes, std::memory_order_relaxed);
+            s_active = false;
+        }
+    }
+
+    ScopedInstrumentation(const ScopedInstrumentation&) = delete;
+    ScopedInstrumentation& operator=(const ScopedInstrumentation&) = delete;
+
+    //! Whether this call is being measured. Use this to avoid computing element or byte counts which would be discarded.
+    bool isActive() const
+    {
+        return m_counters != nullptr;
+    }
+
+    void addElements(size_t count)
+    {
+        m_elements += count;
+    }
+
+    void addBytes(size_t count)
+    {
+        m_bytes += count;
+    }
+
+    //! Add the size of the data of an array (e.g. a `VtArray` or `std::vector`) to the byte count.
+    template <typename Array>
+    void addArray(const Array& array)
+    {
+        m_bytes += array.size() * sizeof(typename Array::value_type);
+    }
+
+    //! Add the size of the values and indices of an optional `PrimvarData` to the byte count.
+    template <typename Primvar>
+    void addPrimvar(const std::optional<Primvar>& primvar)
+    {
+        if (primvar.has_value())
+        {
+            addArray(primvar->values());
+            addArray(primvar->indices());
+        }
+    }
+
+private:
+
+    static thread_local bool s_active;
+
+    InstrumentationCounters* m_counters = nullptr;
+    std::chrono::steady_clock::time_point m_start;
+    uint64_t m_elements = 0;
+    uint64_t m_bytes = 0;
+};
+
+//! Measure the enclosing scope as a call to the named entry point, via a `ScopedInstrumentation` named `var`.
+#define USDEX_INSTRUMENT_SCOPE(var, name)                                                                                                            \
+    static usdex::core::detail::InstrumentationCounters& var##Counters = usdex::core::detail::getInstrumentationCounters(name);                      \
+    usdex::core::detail::ScopedInstrumentation var(var##Counters)
+
+#else
+
+// With instrumentation compiled out, every scope is empty and every call is inlined away
+class ScopedInstrumentation
+{
+
+public:
+
+    bool isActive() const
+    {
+        return false;
+    }
+
+    void addElements(size_t)
+    {
+    }
+
+    void addBytes(size_t)
+    {
+    }
+
+    template <typename Array>
+    void addArray(const Array&)
+    {
+    }
+
+    template <typename Primvar>
+    void addPrimvar(const std::optional<Primvar>&)
+    {
+    }
+};
+
+#define USDEX_INSTRUMENT_SCOPE(var, name) usdex::core::detail::ScopedInstrumentation var
+
+#endif
+
+} // namespace usdex::core::detail
@@ -4,8 +4,22 @@
 
 #include "usdex/core/LayerAlgo.h"
 
+#include "InstrumentationUtils.h"
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/ar/asset.h>
+#include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 using namespace pxr;
 
 namespace
@@ -13,6 +27,89 @@ namespace
 
 static constexpr const char* g_authoringKey = "creator";
 
+// Gather the paths of all prim specs in the layer, ordered such that every parent precedes its children
+SdfPathVector getPrimSpecPaths(const SdfLayerHandle& layer)
+{
+    SdfPathVector result;
+    SdfPathVector stack = { SdfPath::AbsoluteRootPath() };
+    while (!stack.empty())
+    {
+        const SdfPath path = stack.back();
+        stack.pop_back();
+        if (path != SdfPath::AbsoluteRootPath())
+        {
+            result.push_back(path);
+        }
+
+        // Push the children in reverse so that they are visited in their authored order
+        const TfTokenVector children = layer->GetFieldAs<TfTokenVector>(path, SdfChildrenKeys->PrimChildren);
+        for (auto it = children.rbegin(); it != children.rend(); ++it)
+        {
+            stack.push_back(path.AppendChild(*it));
+        }
+    }
+    return result;
+}
+
+// Copy a single prim spec, including its properties and variants, but excluding its child prims
+bool copyPrimSpec(const SdfLayerHandle& srcLayer, const SdfLayerHandle& dstLayer, const SdfPath& path)
+{
+    return SdfCopySpec(
+        srcLayer,
+        path,
+        dstLayer,
+        path,
+        [&path](auto&&... args)
+        {
+            return SdfShouldCopyValue(path, path, std::forward<decltype(args)>(args)...);
+        },
+        [&path](const TfToken& childrenField, const SdfLayerHandle& layer, const SdfPath& srcPath, auto&&... args)
+        {
+            // Child prims are copied individually so that progress can be reported and the copy cancelled between prims
+            if (childrenField == SdfChildrenKeys->PrimChildren && srcPath == path)
+            {
+                return false;
+            }
+            return SdfShouldCopyChildren(path, path, childrenField, layer, srcPath, std::forward<decltype(args)>(args)...);
+        }
+    );
+}
+
+// Gather the paths of all specs in the layer, ordered such that every parent precedes its children
+SdfPathVector getSpecPaths(const SdfLayerHandle& layer)
+{
+    SdfPathVector result;
+    layer->Traverse(
+        SdfPath::AbsoluteRootPath(),
+        [&result](const SdfPath& path)
+        {
+            result.push_back(path);
+        }
+    );
+    std::stable_sort(
+        result.begin(),
+        result.end(),
+        [](const SdfPath& a, const SdfPath& b)
+        {
+            return a.GetPathElementCount() < b.GetPathElementCount();
+        }
+    );
+    return result;
+}
+
+// Whether the path or any of its ancestors is one of the given paths
+bool hasAncestorIn(const SdfPath& path, const std::unordered_set<SdfPath, SdfPath::Hash>& paths)
+{
+    for (SdfPath current = path; !current.IsEmpty(); current = current.GetParentPath())
+    {
+        if (paths.count(current))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 } // namespace
 
 bool usdex::core::hasLayerAuthoringMetadata(const pxr::SdfLayerHandle layer)
@@ -41,6 +138,9 @@ std::string usdex::core::getLayerAuthoringMetadata(const pxr::SdfLayerHandle lay
 
 bool usdex::core::saveLayer(pxr::SdfLayerHandle layer, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "saveLayer");
+
     if (authoringMetadata.has_value())
     {
         setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
@@ -70,6 +170,9 @@ bool usdex::core::exportLayer(
     const SdfLayer::FileFormatArguments& fileFormatArgs
 )
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "exportLayer");
+
     // Early out on an unsupported identifier
     if (identifier.empty() || !UsdStage::IsSupportedFile(identifier))
     {
@@ -104,3 +207,189 @@ bool usdex::core::exportLayer(
 
     return success;
 }
+
+bool usdex::core::exportLayer(
+    SdfLayerHandle layer,
+    const std::string& identifier,
+    const std::string& authoringMetadata,
+    const ExportLayerProgressFn& progressFn,
+    std::optional<std::string_view> comment,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "exportLayer");
+
+    // Early out on an unsupported identifier
+    if (identifier.empty() || !UsdStage::IsSupportedFile(identifier))
+    {
+        TF_WARN("Unable to export SdfLayer to \"%s\" due to an invalid identifier", identifier.c_str());
+        return false;
+    }
+
+    if (comment.has_value())
+    {
+        TF_STATUS("Exporting \"%s\" with comment \"%s\"", identifier.c_str(), comment.value().data());
+    }
+    else
+    {
+        TF_STATUS("Exporting \"%s\"", identifier.c_str());
+    }
+
+    const SdfPathVector primPaths = ::getPrimSpecPaths(layer);
+    ExportLayerProgress progress;
+    progress.totalPrimSpecs = primPaths.size();
+
+    // The layer metadata is copied field by field, as the prims are copied individually below
+    SdfLayerRefPtr output = SdfLayer::CreateAnonymous(layer->GetDisplayName(), layer->GetFileFormat(), layer->GetFileFormatArguments());
+    const SdfPath& rootPath = SdfPath::AbsoluteRootPath();
+    for (const TfToken& field : layer->ListFields(rootPath))
+    {
+        if (field != SdfChildrenKeys->PrimChildren)
+        {
+            output->SetField(rootPath, field, layer->GetField(rootPath, field));
+        }
+    }
+
+    for (const SdfPath& path : primPaths)
+    {
+        if (!::copyPrimSpec(layer, output, path))
+        {
+            TF_WARN("Unable to export SdfLayer to \"%s\" as the prim spec at \"%s\" could not be copied", identifier.c_str(), path.GetText());
+            return false;
+        }
+
+        ++progress.primSpecsWritten;
+        if (progressFn && !progressFn(progress))
+        {
+            TF_STATUS("Cancelled export of \"%s\"", identifier.c_str());
+            return false;
+        }
+    }
+
+    // The metadata is authored on the output layer so that the source layer is left untouched
+    if (!hasLayerAuthoringMetadata(output))
+    {
+        setLayerAuthoringMetadata(output, authoringMetadata);
+    }
+    if (comment.has_value())
+    {
+        output->SetComment(comment.value().data());
+    }
+
+    if (!output->Export(identifier, "", fileFormatArgs))
+    {
+        return false;
+    }
+
+    if (progressFn)
+    {
+        ArResolver& resolver = ArGetResolver();
+        if (std::shared_ptr<ArAsset> asset = resolver.OpenAsset(resolver.Resolve(identifier)))
+        {
+            progress.bytesWritten = asset->GetSize();
+        }
+        progressFn(progress);
+    }
+
+    return true;
+}
+
+bool usdex::core::mergeLayers(SdfLayerHandle target, const std::vector<SdfLayerHandle>& sources, std::vector<LayerMergeConflict>* conflicts)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "mergeLayers");
+
+    if (!target)
+    {
+        TF_WARN("Unable to merge layers due to an invalid target layer");
+        return false;
+    }
+
+    const SdfSchemaBase& schema = target->GetSchema();
+    bool success = true;
+    for (const SdfLayerHandle& source : sources)
+    {
+        if (!source)
+        {
+            TF_WARN("Unable to merge an invalid layer into \"%s\"", target->GetIdentifier().c_str());
+            success = false;
+            continue;
+        }
+
+        // The specs are visited parent first, so the parent of each spec has already been merged into the target
+        size_t numConflicts = 0;
+        std::unordered_set<SdfPath, SdfPath::Hash> copiedPaths;
+        SdfChangeBlock changeBlock;
+        for (const SdfPath& path : ::getSpecPaths(source))
+        {
+            if (path.IsAbsoluteRootPath() || ::hasAncestorIn(path, copiedPaths))
+            {
+                continue;
+            }
+
+            // A spec which is new to the target is copied along with all of its descendants
+            if (!target->HasSpec(path))
+            {
+                if (!SdfCopySpec(source, path, target, path))
+                {
+                    TF_WARN("Unable to merge the spec at \"%s\" from \"%s\"", path.GetText(), source->GetIdentifier().c_str());
+                    success = false;
+                }
+                copiedPaths.insert(path);
+                continue;
+            }
+
+            for (const TfToken& field : source->ListFields(path))
+            {
+                // The children of each spec are merged as specs in their own right
+                if (schema.HoldsChildren(field))
+                {
+                    continue;
+                }
+
+                const VtValue value = source->GetField(path, field);
+                const VtValue existing = target->GetField(path, field);
+                if (field == SdfFieldKeys->Specifier)
+                {
+                    // An over does not contribute a specifier, but any other specifier is stronger than an over in the target
+                    if (value == VtValue(SdfSpecifierOver))
+                    {
+                        continue;
+                    }
+                    if (existing == VtValue(SdfSpecifierOver))
+                    {
+                        target->SetField(path, field, value);
+                        continue;
+                    }
+                }
+
+                if (existing.IsEmpty())
+                {
+                    target->SetField(path, field, value);
+                }
+                else if (existing != value)
+                {
+                    ++numConflicts;
+                    if (conflicts != nullptr)
+                    {
+                        conflicts->push_back(LayerMergeConflict{ path, field, source->GetIdentifier() });
+                    }
+                }
+            }
+        }
+
+        if (numConflicts)
+        {
+            TF_WARN(
+                "Unable to merge %zu opinions from \"%s\" into \"%s\" as they conflict with existing opinions",
+                numConflicts,
+                source->GetIdentifier().c_str(),
+                target->GetIdentifier().c_str()
+            );
+            success = false;
+        }
+    }
+
+    return success;
+}
@@ -6,10 +6,20 @@
 #include "usdex/core/Core.h"
 #include "usdex/core/StageAlgo.h"
 
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usd/schemaRegistry.h>
 #include <pxr/usd/usdGeom/boundable.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
+#include <algorithm>
+
 using namespace pxr;
 
 namespace
@@ -44,12 +54,15 @@ bool isValidTextureFormat(const TfToken& textureFormat)
 #error This version of OpenUSD is unsupported: PXR_VERSION
 #endif
 
-    // Get allowed tokens for type
-    auto primDef = UsdSchemaRegistry::GetInstance().FindConcretePrimDefinition(domeLightToken);
-    VtTokenArray allowedTokens = primDef->GetSchemaAttributeSpec(textureFormatToken)->GetAllowedTokens();
+    // Get allowed tokens for type. The schema can not change at runtime, so it is only resolved once.
+    static const VtTokenArray s_allowedTokens = [&]()
+    {
+        auto primDef = UsdSchemaRegistry::GetInstance().FindConcretePrimDefinition(domeLightToken);
+        return primDef->GetSchemaAttributeSpec(textureFormatToken)->GetAllowedTokens();
+    }();
 
     // Check for provided texture format
-    return std::find(allowedTokens.begin(), allowedTokens.end(), textureFormat) != allowedTokens.end();
+    return std::find(s_allowedTokens.begin(), s_allowedTokens.end(), textureFormat) != s_allowedTokens.end();
 }
 
 void eraseSubstring(std::string& str, const std::string& substr)
@@ -78,6 +91,89 @@ TfToken compatName(const TfToken& originalAttrName)
     return TfToken(attrName);
 }
 
+// The type name of each type of light
+const TfToken& getLightTypeName(usdex::core::LightDescription::Type type)
+{
+    static const TfToken s_dome = UsdSchemaRegistry::GetSchemaTypeName<UsdLuxDomeLight>();
+    static const TfToken s_rect = UsdSchemaRegistry::GetSchemaTypeName<UsdLuxRectLight>();
+    static const TfToken s_sphere = UsdSchemaRegistry::GetSchemaTypeName<UsdLuxSphereLight>();
+    static const TfToken s_distant = UsdSchemaRegistry::GetSchemaTypeName<UsdLuxDistantLight>();
+    switch (type)
+    {
+        case usdex::core::LightDescription::Type::Dome:
+            return s_dome;
+        case usdex::core::LightDescription::Type::Sphere:
+            return s_sphere;
+        case usdex::core::LightDescription::Type::Distant:
+            return s_distant;
+        default:
+            return s_rect;
+    }
+}
+
+// Validate the arguments of a light prior to defining it, as described by the `define*Light` functions.
+// The location of the light must already have been validated, e.g. by `areEditablePrimLocations`.
+bool validateLight(const usdex::core::LightDescription& light, std::string* reason)
+{
+    if (light.type == usdex::core::LightDescription::Type::Dome && light.texturePath.has_value() && !::isValidTextureFormat(light.textureFormat))
+    {
+        *reason = TfStringPrintf(
+            "Token \"[%s]\" is not a valid texture format token. See documentation of defineDomeLight for valid options.",
+            light.textureFormat.GetText()
+        );
+        return false;
+    }
+
+    return true;
+}
+
+// Author the attributes of a light which has already been defined. The extents are computed directly, rather than via the boundable plugins.
+void authorLight(const UsdPrim& prim, const usdex::core::LightDescription& light)
+{
+    UsdLuxLightAPI lightApi(prim);
+    lightApi.CreateIntensityAttr().Set(light.intensity);
+    lightApi.CreateExposureAttr().Set(0.0f);
+
+    switch (light.type)
+    {
+        case usdex::core::LightDescription::Type::Dome:
+        {
+            UsdLuxDomeLight domeLight(prim);
+            if (light.texturePath.has_value())
+            {
+                domeLight.CreateTextureFileAttr().Set(SdfAssetPath(light.texturePath.value()));
+                domeLight.CreateTextureFormatAttr().Set(light.textureFormat);
+            }
+            break;
+        }
+        case usdex::core::LightDescription::Type::Rect:
+        {
+            UsdLuxRectLight rectLight(prim);
+            rectLight.CreateWidthAttr().Set(light.width);
+            rectLight.CreateHeightAttr().Set(light.height);
+            const GfVec3f halfSize(0.5f * light.width, 0.5f * light.height, 0.0f);
+            UsdGeomBoundable(prim).CreateExtentAttr().Set(VtVec3fArray{ -halfSize, halfSize });
+            if (light.texturePath.has_value())
+            {
+                rectLight.CreateTextureFileAttr().Set(SdfAssetPath(light.texturePath.value()));
+            }
+            break;
+        }
+        case usdex::core::LightDescription::Type::Sphere:
+        {
+            UsdLuxSphereLight(prim).CreateRadiusAttr().Set(light.radius);
+            const GfVec3f radius(light.radius);
+            UsdGeomBoundable(prim).CreateExtentAttr().Set(VtVec3fArray{ -radius, radius });
+            break;
+        }
+        case usdex::core::LightDescription::Type::Distant:
+        {
+            UsdLuxDistantLight(prim).CreateAngleAttr().Set(light.angle);
+            break;
+        }
+    }
+}
+
 } // namespace
 
 bool usdex::core::isLight(const UsdPrim& prim)
@@ -115,6 +211,8 @@ UsdLuxDomeLight usdex::core::defineDomeLight(
     const TfToken& textureFormat
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -132,7 +230,7 @@ UsdLuxDomeLight usdex::core::defineDomeLight(
         return UsdLuxDomeLight();
     }
 
-    auto light = UsdLuxDomeLight::Define(stage, path);
+    UsdLuxDomeLight light = usdex::core::detail::definePrim<UsdLuxDomeLight>(stage, path);
 
     if (!light)
     {
@@ -140,10 +238,8 @@ UsdLuxDomeLight usdex::core::defineDomeLight(
         return UsdLuxDomeLight();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = light.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     if (!initLightApiAttrs(light, intensity))
     {
@@ -168,6 +264,8 @@ UsdLuxDomeLight usdex::core::defineDomeLight(
     const TfToken& textureFormat
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -184,6 +282,8 @@ UsdLuxDomeLight usdex::core::defineDomeLight(
 
 UsdLuxDomeLight usdex::core::defineDomeLight(UsdPrim prim, float intensity, std::optional<std::string_view> texturePath, const TfToken& textureFormat)
 {
+    TRACE_FUNCTION();
+
     // Early out if the prim is not valid
     if (!prim)
     {
@@ -217,6 +317,8 @@ UsdLuxRectLight usdex::core::defineRectLight(
     std::optional<std::string_view> texturePath
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -225,7 +327,7 @@ UsdLuxRectLight usdex::core::defineRectLight(
         return UsdLuxRectLight();
     }
 
-    auto light = UsdLuxRectLight::Define(stage, path);
+    UsdLuxRectLight light = usdex::core::detail::definePrim<UsdLuxRectLight>(stage, path);
 
     if (!light)
     {
@@ -233,10 +335,8 @@ UsdLuxRectLight usdex::core::defineRectLight(
         return UsdLuxRectLight();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = light.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     if (!initLightApiAttrs(light, intensity))
     {
@@ -246,7 +346,7 @@ UsdLuxRectLight usdex::core::defineRectLight(
 
     light.CreateWidthAttr().Set(width);
     light.CreateHeightAttr().Set(height);
-    if (auto boundable = UsdGeomBoundable(prim))
+    if (auto boundable = UsdGeomBoundable(light.GetPrim()))
     {
         VtVec3fArray extent;
         UsdGeomBoundable::ComputeExtentFromPlugins(boundable, UsdTimeCode::Default(), &extent);
@@ -270,6 +370,8 @@ UsdLuxRectLight usdex::core::defineRectLight(
     std::optional<std::string_view> texturePath
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -286,6 +388,8 @@ UsdLuxRectLight usdex::core::defineRectLight(
 
 UsdLuxRectLight usdex::core::defineRectLight(UsdPrim prim, float width, float height, float intensity, std::optional<std::string_view> texturePath)
 {
+    TRACE_FUNCTION();
+
     // Early out if the prim is not valid
     if (!prim)
     {
@@ -309,3 +413,97 @@ UsdLuxRectLight usdex::core::defineRectLight(UsdPrim prim, float width, float he
     const SdfPath& path = prim.GetPath();
     return usdex::core::defineRectLight(stage, path, width, height, intensity, texturePath);
 }
+
+std::vector<UsdLuxLightAPI> usdex::core::defineLights(UsdStagePtr stage, const std::vector<LightDescription>& lights)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "defineLights");
+    instrumentation.addElements(lights.size());
+
+    std::vector<UsdLuxLightAPI> result(lights.size());
+
+    // Early out if the stage is invalid, as no location could be valid
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdLux lights due to an invalid location: Invalid UsdStage.");
+        return result;
+    }
+
+    // Validate all of the locations at once, so that the parent of each location is only looked up once
+    SdfPathVector paths(lights.size());
+    std::transform(lights.begin(), lights.end(), paths.begin(), [](const LightDescription& desc) { return desc.path; });
+    std::vector<std::string> reasons;
+    const std::vector<bool> locations = usdex::core::areEditablePrimLocations(stage, paths, &reasons);
+
+    // Validate the remaining arguments of all of the lights concurrently. No opinions are authored during validation, so the stage is only read.
+    // Diagnostics are deferred and emitted from the calling thread so that they are reported in a deterministic order.
+    std::vector<char> valid(lights.size(), 0);
+    WorkParallelForN(
+        lights.size(),
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Validate lights");
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (!locations[i])
+                {
+                    const char* typeName = ::getLightTypeName(lights[i].type).GetText();
+                    reasons[i] = TfStringPrintf("Unable to define UsdLux%s due to an invalid location: %s", typeName, reasons[i].c_str());
+                    continue;
+                }
+                valid[i] = ::validateLight(lights[i], &reasons[i]);
+            }
+        }
+    );
+
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        if (!valid[i])
+        {
+            TF_RUNTIME_ERROR("%s", reasons[i].c_str());
+        }
+    }
+
+    // Define all of the prims with a single round of change processing.
+    // The prim specs are authored directly in the edit target layer as the stage can not recompose while the change block is open.
+    {
+        TRACE_SCOPE("Define light prim specs");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < lights.size(); ++i)
+        {
+            const TfToken& typeName = ::getLightTypeName(lights[i].type);
+            if (valid[i] && !usdex::core::detail::definePrimSpec(stage, lights[i].path, typeName))
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdLux%s at \"%s\"", typeName.GetText(), lights[i].path.GetAsString().c_str());
+                valid[i] = 0;
+            }
+        }
+    }
+
+    // Author the attributes of all of the lights with a single round of change processing
+    {
+        TRACE_SCOPE("Author light attributes");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < lights.size(); ++i)
+        {
+            if (!valid[i])
+            {
+                continue;
+            }
+
+            const LightDescription& desc = lights[i];
+            UsdPrim prim = stage->GetPrimAtPath(desc.path);
+            UsdLuxLightAPI lightApi(prim);
+            if (!prim || !prim.HasAPI<UsdLuxLightAPI>())
+            {
+                TF_RUNTIME_ERROR("UsdLuxLightApi is not compatible with prim at path \"[%s]\"", desc.path.GetAsString().c_str());
+                continue;
+            }
+
+            ::authorLight(prim, desc);
+            result[i] = lightApi;
+        }
+    }
+
+    return result;
+}
@@ -7,13 +7,36 @@
 #include "usdex/core/NameAlgo.h"
 #include "usdex/core/StageAlgo.h"
 
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usdGeom/gprim.h>
+#include <pxr/usd/usdGeom/scope.h>
+#include <pxr/usd/usdGeom/subset.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 #include <pxr/usd/usdShade/nodeGraph.h>
 #include <pxr/usd/usdShade/tokens.h>
 #include <pxr/usd/usdUtils/pipeline.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
 using namespace pxr;
 
 namespace
@@ -44,6 +67,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((uvTexRoughnessName, "RoughnessTexture"))
     ((uvTexMetallicName, "MetallicTexture"))
     ((uvTexOpacityName, "OpacityTexture"))
+    ((uvTexLibraryName, "TextureReaders"))
     // UsdPreviewSurface I/O
     ((color, "diffuseColor"))
     ((normal, "normal"))
@@ -108,13 +132,115 @@ UsdShadeShader acquireTexCoordReader(UsdShadeMaterial& material)
     return uvReader;
 }
 
+// Check if the file extension for the texture asset matches a set of known 8 bit texture formats
+// Note, the UsdShadInput provided is expected to be for an SdfAssetPath for the shader's texture file input
+bool isEightBitTextureFormat(const UsdShadeInput& textureAssetPathInput)
+{
+    SdfAssetPath resolvedTexturePath;
+    textureAssetPathInput.Get(&resolvedTexturePath);
+
+    static const std::vector<std::string> s_eightBitFormats = { "bmp", "tga", "jpg", "jpeg", "png", "tif" };
+    std::string ext = ArGetResolver().GetExtension(resolvedTexturePath.GetResolvedPath());
+    return std::find(s_eightBitFormats.begin(), s_eightBitFormats.end(), ext) != s_eightBitFormats.end();
+}
+
+// State shared by the texture functions while they author the materials of a `PreviewMaterialRegistry`
+class TextureReaderCache
+{
+
+public:
+
+    TextureReaderCache(UsdPrim parent, usdex::core::NameCache& nameCache, bool shareReaders)
+        : m_parent(parent), m_nameCache(nameCache), m_shareReaders(shareReaders), m_surfaceShaders(parent ? parent.GetStage() : UsdStagePtr())
+    {
+    }
+
+    // Get the effective preview surface of a material, resolving the surface connections once for all textures added to the material
+    UsdShadeShader getSurfaceShader(const UsdShadeMaterial& material) const
+    {
+        return m_surfaceShaders.getSurfaceShader(material);
+    }
+
+    // Check if a texture is a known 8 bit format, resolving each texture asset path only once
+    bool isEightBitTexture(const UsdShadeInput& textureAssetPathInput, const SdfAssetPath& texture)
+    {
+        auto it = m_eightBitTextures.find(texture.GetAssetPath());
+        if (it == m_eightBitTextures.end())
+        {
+            it = m_eightBitTextures.emplace(texture.GetAssetPath(), ::isEightBitTextureFormat(textureAssetPathInput)).first;
+        }
+        return it->second;
+    }
+
+    // Find or create the abstract texture reader shared by all materials which read the texture in the same color space.
+    // Returns an empty path if the readers are not shared, or if the shared reader could not be defined.
+    SdfPath acquirePrototype(const SdfAssetPath& texture, usdex::core::ColorSpace colorSpace)
+    {
+        if (!m_shareReaders)
+        {
+            return SdfPath();
+        }
+
+        const auto key = std::make_pair(texture.GetAssetPath(), colorSpace);
+        auto it = m_prototypes.find(key);
+        if (it != m_prototypes.end())
+        {
+            return it->second;
+        }
+
+        // The shared readers are defined below a class, so that they are not themselves traversed or rendered
+        UsdStagePtr stage = m_parent.GetStage();
+        if (!m_library)
+        {
+            const TfToken name = m_nameCache.getPrimName(m_parent, _tokens->uvTexLibraryName.GetString());
+            m_library = UsdGeomScope::Define(stage, m_parent.GetPath().AppendChild(name)).GetPrim();
+            if (!m_library || !m_library.SetSpecifier(SdfSpecifierClass))
+            {
+                TF_RUNTIME_ERROR("Cannot add shared texture readers to <%s>", m_parent.GetPath().GetAsString().c_str());
+                m_library = UsdPrim();
+                return SdfPath();
+            }
+        }
+
+        const TfToken name = m_nameCache.getPrimName(m_library, TfStringGetBeforeSuffix(TfGetBaseName(texture.GetAssetPath())));
+        UsdShadeShader prototype = UsdShadeShader::Define(stage, m_library.GetPath().AppendChild(name));
+        if (!prototype)
+        {
+            TF_RUNTIME_ERROR(
+                "Cannot add shared USD Preview Surface Texture Reader shader for @%s@ to <%s>",
+                texture.GetAssetPath().c_str(),
+                m_library.GetPath().GetAsString().c_str()
+            );
+            return SdfPath();
+        }
+        prototype.SetShaderId(_tokens->uvTexId);
+        prototype.CreateInput(_tokens->file, SdfValueTypeNames->Asset).Set(texture);
+        prototype.CreateInput(_tokens->sourceColorSpace, SdfValueTypeNames->Token).Set(getColorSpaceToken(colorSpace));
+
+        m_prototypes.emplace(key, prototype.GetPath());
+        return prototype.GetPath();
+    }
+
+private:
+
+    UsdPrim m_parent;
+    usdex::core::NameCache& m_nameCache;
+    bool m_shareReaders;
+    UsdPrim m_library;
+    std::map<std::pair<std::string, usdex::core::ColorSpace>, SdfPath> m_prototypes;
+    std::unordered_map<std::string, bool> m_eightBitTextures;
+    usdex::core::SurfaceShaderCache m_surfaceShaders;
+};
+
 // Find or create the appropriate TextureReader
+// If a cache is provided, the reader may reference a shared reader which holds the texture file and color space
 UsdShadeShader acquireTextureReader(
     UsdShadeMaterial& material,
     const TfToken& shaderName,
     const SdfAssetPath& texture,
     usdex::core::ColorSpace colorSpace,
-    const GfVec4f& fallback
+    const GfVec4f& fallback,
+    TextureReaderCache* cache
 )
 {
     // Make sure there is a primvar reader for the UV data ("st")
@@ -124,30 +250,29 @@ UsdShadeShader acquireTextureReader(
         return UsdShadeShader();
     }
 
+    const SdfPath prototype = cache ? cache->acquirePrototype(texture, colorSpace) : SdfPath();
+
     // Create the texture shader
     SdfPath shaderPath = material.GetPath().AppendChild(shaderName);
     UsdShadeShader texShader = UsdShadeShader::Define(material.GetPrim().GetStage(), shaderPath);
-    texShader.SetShaderId(_tokens->uvTexId);
+    if (prototype.IsEmpty())
+    {
+        texShader.SetShaderId(_tokens->uvTexId);
+        texShader.CreateInput(_tokens->file, SdfValueTypeNames->Asset).Set(texture);
+        texShader.CreateInput(_tokens->sourceColorSpace, SdfValueTypeNames->Token).Set(getColorSpaceToken(colorSpace));
+    }
+    else
+    {
+        texShader.GetPrim().GetReferences().AddInternalReference(prototype);
+    }
+
+    // The fallback and the texture coordinates are specific to each material
     texShader.CreateInput(_tokens->fallback, SdfValueTypeNames->Float4).Set(fallback);
-    texShader.CreateInput(_tokens->file, SdfValueTypeNames->Asset).Set(texture);
-    texShader.CreateInput(_tokens->sourceColorSpace, SdfValueTypeNames->Token).Set(getColorSpaceToken(colorSpace));
     texShader.CreateInput(_tokens->st, SdfValueTypeNames->Float2).ConnectToSource(uvReader.GetOutput(_tokens->result));
 
     return texShader;
 }
 
-// Check if the file extension for the texture asset matches a set of known 8 bit texture formats
-// Note, the UsdShadInput provided is expected to be for an SdfAssetPath for the shader's texture file input
-bool isEightBitTextureFormat(const UsdShadeInput& textureAssetPathInput)
-{
-    SdfAssetPath resolvedTexturePath;
-    textureAssetPathInput.Get(&resolvedTexturePath);
-
-    static const std::vector<std::string> s_eightBitFormats = { "bmp", "tga", "jpg", "jpeg", "png", "tif" };
-    std::string ext = ArGetResolver().GetExtension(resolvedTexturePath.GetResolvedPath());
-    return std::find(s_eightBitFormats.begin(), s_eightBitFormats.end(), ext) != s_eightBitFormats.end();
-}
-
 float toLinear(float value)
 {
     if (value <= 0.04045f)
@@ -175,10 +300,204 @@ float fromLinear(float value)
     }
 }
 
+// The number of intervals in each color space lookup table. Larger tables are more accurate, but are less likely to remain in cache.
+constexpr size_t g_colorSpaceTableSize = 4096;
+
+// Arrays smaller than this are converted on the calling thread, as the cost of scheduling parallel work would outweigh the conversion itself.
+constexpr size_t g_colorSpaceGrainSize = 16384;
+
+// Resolving a surface is a short traversal of connections, so many Materials are resolved by each task
+constexpr size_t g_surfaceShaderGrainSize = 64;
+
+using ColorSpaceTable = std::array<float, g_colorSpaceTableSize + 1>;
+
+// Sample the sRGB to linear curve uniformly over [0, 1]
+const ColorSpaceTable& getToLinearTable()
+{
+    static const ColorSpaceTable s_table = []()
+    {
+        ColorSpaceTable table;
+        for (size_t i = 0; i <= g_colorSpaceTableSize; ++i)
+        {
+            const double value = static_cast<double>(i) / g_colorSpaceTableSize;
+            table[i] = static_cast<float>(value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4));
+        }
+        return table;
+    }();
+    return s_table;
+}
+
+// Sample the linear to sRGB curve over [0, 1] uniformly in the square root of the linear value. The curve is very steep for dark values, so a
+// uniform sampling of the linear value itself would be inaccurate where the eye is most sensitive.
+const ColorSpaceTable& getFromLinearTable()
+{
+    static const ColorSpaceTable s_table = []()
+    {
+        ColorSpaceTable table;
+        for (size_t i = 0; i <= g_colorSpaceTableSize; ++i)
+        {
+            const double root = static_cast<double>(i) / g_colorSpaceTableSize;
+            const double value = root * root;
+            table[i] = static_cast<float>(value * 12.92 <= 0.04045 ? value * 12.92 : std::pow(value, 1.0 / 2.4) * 1.055 - 0.055);
+        }
+        return table;
+    }();
+    return s_table;
+}
+
+// Linearly interpolate the table at a position in [0, 1]
+float sampleColorSpaceTable(const ColorSpaceTable& table, float position)
+{
+    const float scaled = position * static_cast<float>(g_colorSpaceTableSize);
+    const size_t index = std::min(static_cast<size_t>(scaled), g_colorSpaceTableSize - 1);
+    const float weight = scaled - static_cast<float>(index);
+    return table[index] + (table[index + 1] - table[index]) * weight;
+}
+
+// The linear segments of each curve are cheap to compute exactly, as are values outside of [0, 1] (and NaN), which are not covered by the tables
+float toLinearApprox(const ColorSpaceTable& table, float value)
+{
+    if (value > 0.04045f && value <= 1.0f)
+    {
+        return sampleColorSpaceTable(table, value);
+    }
+    return toLinear(value);
+}
+
+float fromLinearApprox(const ColorSpaceTable& table, float value)
+{
+    if (value * 12.92f > 0.04045f && value <= 1.0f)
+    {
+        return sampleColorSpaceTable(table, std::sqrt(value));
+    }
+    return fromLinear(value);
+}
+
+template <typename Convert>
+VtVec3fArray convertColors(const VtVec3fArray& colors, const ColorSpaceTable& table, Convert convert)
+{
+    VtVec3fArray result(colors.size());
+    const GfVec3f* colorsData = colors.cdata();
+    GfVec3f* resultData = result.data();
+    WorkParallelForN(
+        colors.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const GfVec3f& color = colorsData[i];
+                resultData[i] = GfVec3f(convert(table, color[0]), convert(table, color[1]), convert(table, color[2]));
+            }
+        },
+        g_colorSpaceGrainSize
+    );
+    return result;
+}
+
+//! The material path bound to each prim path by `bindMaterials`
+using MaterialBindings = std::unordered_map<SdfPath, SdfPath, SdfPath::Hash>;
+
+//! Hoist identical material bindings of sibling prims onto their parent, as described by `bindMaterials`
+void hoistMaterialBindings(UsdStagePtr stage, MaterialBindings& bindings)
+{
+    TRACE_FUNCTION();
+
+    // Visit the deepest parents first, so that a binding which has been hoisted can be hoisted again onto its own parent
+    std::map<size_t, SdfPathSet, std::greater<size_t>> pending;
+    for (const auto& [path, materialPath] : bindings)
+    {
+        const SdfPath parentPath = path.GetParentPath();
+        pending[parentPath.GetPathElementCount()].insert(parentPath);
+    }
+
+    while (!pending.empty())
+    {
+        const SdfPathSet parentPaths = std::move(pending.begin()->second);
+        pending.erase(pending.begin());
+        for (const SdfPath& parentPath : parentPaths)
+        {
+            // Bindings are never hoisted onto a root prim, as that would affect everything beneath the default prim (or the stage)
+            if (parentPath.GetPathElementCount() < 2)
+            {
+                continue;
+            }
+
+            const UsdPrim parent = stage->GetPrimAtPath(parentPath);
+            if (!parent || parent.IsInstanceProxy())
+            {
+                continue;
+            }
+
+            // The parent must not already be bound to a different material, and gprims must not gain a material of their own
+            const auto parentBinding = bindings.find(parentPath);
+            if (parentBinding == bindings.end() && parent.IsA<UsdGeomGprim>())
+            {
+                continue;
+            }
+
+            // Every child must be bound to the same material, and must not have a binding of its own which would remain stronger
+            SdfPath materialPath;
+            bool hoistable = true;
+            const UsdPrim::SiblingRange children = parent.GetChildren();
+            for (const UsdPrim& child : children)
+            {
+                const auto childBinding = bindings.find(child.GetPath());
+                if (childBinding == bindings.end() || (!materialPath.IsEmpty() && childBinding->second != materialPath) ||
+                    child.IsA<UsdGeomSubset>() || UsdShadeMaterialBindingAPI(child).GetDirectBindingRel().HasAuthoredTargets())
+                {
+                    hoistable = false;
+                    break;
+                }
+                materialPath = childBinding->second;
+            }
+            if (!hoistable || materialPath.IsEmpty() || (parentBinding != bindings.end() && parentBinding->second != materialPath))
+            {
+                continue;
+            }
+
+            for (const UsdPrim& child : children)
+            {
+                bindings.erase(child.GetPath());
+            }
+            bindings[parentPath] = materialPath;
+
+            const SdfPath grandparentPath = parentPath.GetParentPath();
+            pending[grandparentPath.GetPathElementCount()].insert(grandparentPath);
+        }
+    }
+}
+
+//! Compute a hash of all of the parameters and textures of a preview material
+size_t hashPreviewMaterial(const usdex::core::PreviewMaterialDescription& material)
+{
+    return TfHash::Combine(
+        material.color,
+        material.opacity,
+        material.roughness,
+        material.metallic,
+        material.diffuseTexture,
+        material.normalTexture,
+        material.ormTexture,
+        material.roughnessTexture,
+        material.metallicTexture,
+        material.opacityTexture
+    );
+}
+
+//! Whether all of the parameters and textures of two preview materials are identical
+bool previewMaterialsEqual(const usdex::core::PreviewMaterialDescription& lhs, const usdex::core::PreviewMaterialDescription& rhs)
+{
+    return lhs.color == rhs.color && lhs.opacity == rhs.opacity && lhs.roughness == rhs.roughness && lhs.metallic == rhs.metallic &&
+           lhs.diffuseTexture == rhs.diffuseTexture && lhs.normalTexture == rhs.normalTexture && lhs.ormTexture == rhs.ormTexture &&
+           lhs.roughnessTexture == rhs.roughnessTexture && lhs.metallicTexture == rhs.metallicTexture && lhs.opacityTexture == rhs.opacityTexture;
+}
+
 } // namespace
 
 UsdShadeMaterial usdex::core::createMaterial(UsdPrim parent, const std::string& name)
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -196,6 +515,8 @@ UsdShadeMaterial usdex::core::createMaterial(UsdPrim parent, const std::string&
 
 bool usdex::core::bindMaterial(UsdPrim prim, const UsdShadeMaterial& material)
 {
+    TRACE_FUNCTION();
+
     UsdPrim matPrim = material.GetPrim();
     if (!matPrim && !prim)
     {
@@ -228,8 +549,100 @@ bool usdex::core::bindMaterial(UsdPrim prim, const UsdShadeMaterial& material)
     return materialBinding.Bind(material);
 }
 
+bool usdex::core::bindMaterials(const std::vector<UsdPrim>& prims, const std::vector<UsdShadeMaterial>& materials, bool hoistBindings)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "bindMaterials");
+
+    if (prims.size() != materials.size())
+    {
+        TF_WARN("Unable to bind materials due to mismatched materials: %zu prims and %zu materials", prims.size(), materials.size());
+        return false;
+    }
+    instrumentation.addElements(prims.size());
+
+    // Validate every binding before authoring any of them. Later bindings of the same prim replace earlier ones.
+    bool success = true;
+    UsdStagePtr stage;
+    ::MaterialBindings bindings;
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        const UsdPrim& prim = prims[i];
+        const UsdShadeMaterial& material = materials[i];
+        if (!prim)
+        {
+            TF_WARN("UsdPrim <%s> is not valid, cannot bind material to prim", prim.GetPath().GetAsString().c_str());
+            success = false;
+            continue;
+        }
+        if (!material)
+        {
+            TF_WARN("UsdShadeMaterial <%s> is not valid, cannot bind material to prim", material.GetPath().GetAsString().c_str());
+            success = false;
+            continue;
+        }
+
+        if (!stage)
+        {
+            stage = prim.GetStage();
+        }
+        else if (prim.GetStage() != stage)
+        {
+            TF_WARN("UsdPrim <%s> belongs to a different stage, cannot bind material to prim", prim.GetPath().GetAsString().c_str());
+            success = false;
+            continue;
+        }
+
+        std::string reason;
+        if (!usdex::core::isEditablePrimLocation(stage, prim.GetPath(), &reason))
+        {
+            TF_WARN("Cannot bind material due to an invalid location: %s", reason.c_str());
+            success = false;
+            continue;
+        }
+
+        bindings[prim.GetPath()] = material.GetPath();
+    }
+
+    if (bindings.empty())
+    {
+        return success;
+    }
+
+    if (hoistBindings)
+    {
+        ::hoistMaterialBindings(stage, bindings);
+    }
+
+    // Author the API schema and the relationship of every binding directly on the edit target layer, with a single round of change processing
+    static const TfToken s_bindingAPI = UsdSchemaRegistry::GetSchemaTypeName<UsdShadeMaterialBindingAPI>();
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    SdfChangeBlock changeBlock;
+    for (const auto& [path, materialPath] : bindings)
+    {
+        SdfPrimSpecHandle spec = SdfCreatePrimInLayer(layer, editTarget.MapToSpecPath(path));
+        if (!detail::addAppliedSchema(spec, s_bindingAPI))
+        {
+            TF_WARN("Unable to bind material <%s> to prim <%s>", materialPath.GetAsString().c_str(), path.GetAsString().c_str());
+            success = false;
+            continue;
+        }
+
+        if (!detail::setRelationshipTarget(spec, UsdShadeTokens->materialBinding, editTarget.MapToSpecPath(materialPath)))
+        {
+            TF_WARN("Unable to bind material <%s> to prim <%s>", materialPath.GetAsString().c_str(), path.GetAsString().c_str());
+            success = false;
+        }
+    }
+
+    return success;
+}
+
 UsdShadeShader usdex::core::computeEffectivePreviewSurfaceShader(const UsdShadeMaterial& material)
 {
+    TRACE_FUNCTION();
+
     if (!material)
     {
         return UsdShadeShader();
@@ -238,6 +651,281 @@ UsdShadeShader usdex::core::computeEffectivePreviewSurfaceShader(const UsdShadeM
     return material.ComputeSurfaceSource({ UsdShadeTokens->universalRenderContext });
 }
 
+class usdex::core::SurfaceShaderCache::SurfaceShaderCacheImpl : public TfWeakBase
+{
+
+public:
+
+    SurfaceShaderCacheImpl(UsdStagePtr stage, const TfToken& renderContext) : m_stage(std::move(stage)), m_renderContext(renderContext)
+    {
+        if (m_stage)
+        {
+            m_noticeKey = TfNotice::Register(TfCreateWeakPtr(this), &SurfaceShaderCacheImpl::onObjectsChanged, m_stage);
+        }
+    }
+
+    ~SurfaceShaderCacheImpl()
+    {
+        TfNotice::Revoke(m_noticeKey);
+    }
+
+    const TfToken& getRenderContext() const
+    {
+        return m_renderContext;
+    }
+
+    UsdShadeShader getSurfaceShader(const UsdShadeMaterial& material)
+    {
+        if (!material || material.GetPrim().GetStage() != m_stage)
+        {
+            return UsdShadeShader();
+        }
+
+        const SdfPath& path = material.GetPath();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_shaders.find(path);
+            if (it != m_shaders.end())
+            {
+                return it->second;
+            }
+        }
+
+        // Resolve the connections without holding the lock, so that many Materials can be resolved concurrently
+        UsdShadeShader result = material.ComputeSurfaceSource({ m_renderContext });
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_shaders.emplace(path, result).second && result)
+        {
+            m_materialsByShader.emplace(result.GetPath(), path);
+        }
+        return result;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shaders.clear();
+        m_materialsByShader.clear();
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_shaders.size();
+    }
+
+private:
+
+    void onObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_shaders.empty())
+        {
+            return;
+        }
+
+        for (const SdfPath& path : notice.GetResyncedPaths())
+        {
+            if (path == SdfPath::AbsoluteRootPath())
+            {
+                m_shaders.clear();
+                m_materialsByShader.clear();
+                return;
+            }
+            if (path.IsPrimPath())
+            {
+                invalidatePrim(path);
+            }
+            else if (path.IsPropertyPath())
+            {
+                invalidateProperty(path);
+            }
+        }
+        for (const SdfPath& path : notice.GetChangedInfoOnlyPaths())
+        {
+            if (path.IsPropertyPath())
+            {
+                invalidateProperty(path);
+            }
+        }
+    }
+
+    // A resynced prim invalidates any Material or surface Shader at or below it, and any Material containing it, unless it is a Shader other than
+    // the surface Shader. The resolution of a surface ends at the first Shader, so no other Shader can affect it.
+    void invalidatePrim(const SdfPath& path)
+    {
+        eraseMaterials(path);
+        eraseShaders(path);
+        eraseContainingMaterials(path.GetParentPath(), path);
+    }
+
+    // Only the outputs of a Material, its NodeGraphs, and its surface Shader participate in the resolution of the surface
+    void invalidateProperty(const SdfPath& path)
+    {
+        if (UsdShadeUtils::GetType(path.GetNameToken()) != UsdShadeAttributeType::Output)
+        {
+            return;
+        }
+
+        const SdfPath primPath = path.GetPrimPath();
+        auto [begin, end] = m_materialsByShader.equal_range(primPath);
+        SdfPathVector materials;
+        for (auto it = begin; it != end; ++it)
+        {
+            materials.push_back(it->second);
+        }
+        for (const SdfPath& material : materials)
+        {
+            eraseMaterial(material);
+        }
+        eraseContainingMaterials(primPath, primPath);
+    }
+
+    // Erase the Materials at or below the path
+    void eraseMaterials(const SdfPath& path)
+    {
+        SdfPathVector materials;
+        for (auto it = m_shaders.lower_bound(path); it != m_shaders.end() && it->first.HasPrefix(path); ++it)
+        {
+            materials.push_back(it->first);
+        }
+        for (const SdfPath& material : materials)
+        {
+            eraseMaterial(material);
+        }
+    }
+
+    // Erase the Materials whose surface Shaders are at or below the path
+    void eraseShaders(const SdfPath& path)
+    {
+        SdfPathVector materials;
+        for (auto it = m_materialsByShader.lower_bound(path); it != m_materialsByShader.end() && it->first.HasPrefix(path); ++it)
+        {
+            materials.push_back(it->second);
+        }
+        for (const SdfPath& material : materials)
+        {
+            eraseMaterial(material);
+        }
+    }
+
+    // Erase the Materials at or above the path which contain the changed prim, unless the changed prim is a Shader other than their surface Shader
+    void eraseContainingMaterials(const SdfPath& path, const SdfPath& changedPrimPath)
+    {
+        if (m_shaders.empty() || path.IsEmpty())
+        {
+            return;
+        }
+
+        // The changed prim is only inspected once a containing Material is found, as most changes are not within a cached Material
+        std::optional<bool> isShader;
+        for (SdfPath current = path; !current.IsEmpty() && current != SdfPath::AbsoluteRootPath(); current = current.GetParentPath())
+        {
+            auto it = m_shaders.find(current);
+            if (it == m_shaders.end())
+            {
+                continue;
+            }
+            if (!isShader.has_value())
+            {
+                const UsdPrim changedPrim = m_stage->GetPrimAtPath(changedPrimPath);
+                isShader = changedPrim && changedPrim.IsA<UsdShadeShader>();
+            }
+            if (!isShader.value() || it->second.GetPath() == changedPrimPath)
+            {
+                eraseMaterial(current);
+            }
+        }
+    }
+
+    void eraseMaterial(const SdfPath& material)
+    {
+        auto it = m_shaders.find(material);
+        if (it == m_shaders.end())
+        {
+            return;
+        }
+
+        if (it->second)
+        {
+            auto [begin, end] = m_materialsByShader.equal_range(it->second.GetPath());
+            for (auto shaderIt = begin; shaderIt != end; ++shaderIt)
+            {
+                if (shaderIt->second == material)
+                {
+                    m_materialsByShader.erase(shaderIt);
+                    break;
+                }
+            }
+        }
+        m_shaders.erase(it);
+    }
+
+    UsdStagePtr m_stage;
+    TfToken m_renderContext;
+    TfNotice::Key m_noticeKey;
+
+    // The Shaders are ordered by Material path, and indexed by Shader path, so that the Materials affected by a change are found without a traversal
+    mutable std::mutex m_mutex;
+    std::map<SdfPath, UsdShadeShader> m_shaders;
+    std::multimap<SdfPath, SdfPath> m_materialsByShader;
+};
+
+usdex::core::SurfaceShaderCache::SurfaceShaderCache(UsdStagePtr stage, const TfToken& renderContext)
+    : m_impl(new SurfaceShaderCacheImpl(std::move(stage), renderContext))
+{
+}
+
+usdex::core::SurfaceShaderCache::~SurfaceShaderCache()
+{
+    delete m_impl;
+}
+
+const TfToken& usdex::core::SurfaceShaderCache::getRenderContext() const
+{
+    return m_impl->getRenderContext();
+}
+
+UsdShadeShader usdex::core::SurfaceShaderCache::getSurfaceShader(const UsdShadeMaterial& material) const
+{
+    TRACE_FUNCTION();
+
+    return m_impl->getSurfaceShader(material);
+}
+
+std::vector<UsdShadeShader> usdex::core::SurfaceShaderCache::getSurfaceShaders(const std::vector<UsdShadeMaterial>& materials) const
+{
+    TRACE_FUNCTION();
+
+    std::vector<UsdShadeShader> result(materials.size());
+    const UsdShadeMaterial* materialsData = materials.data();
+    UsdShadeShader* resultData = result.data();
+    SurfaceShaderCacheImpl* impl = m_impl;
+    WorkParallelForN(
+        materials.size(),
+        [materialsData, resultData, impl](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                resultData[i] = impl->getSurfaceShader(materialsData[i]);
+            }
+        },
+        g_surfaceShaderGrainSize
+    );
+    return result;
+}
+
+void usdex::core::SurfaceShaderCache::clear()
+{
+    m_impl->clear();
+}
+
+size_t usdex::core::SurfaceShaderCache::size() const
+{
+    return m_impl->size();
+}
+
 UsdShadeMaterial usdex::core::definePreviewMaterial(
     UsdStagePtr stage,
     const SdfPath& path,
@@ -247,6 +935,8 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
     const float metallic
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -292,7 +982,7 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
     }
 
     // Define the material. We do not use usdex::core::createMaterial here to avoid double validations.
-    UsdShadeMaterial material = UsdShadeMaterial::Define(stage, path);
+    UsdShadeMaterial material = usdex::core::detail::definePrim<UsdShadeMaterial>(stage, path);
     if (!material)
     {
         TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial at \"%s\"", path.GetAsString().c_str());
@@ -311,14 +1001,13 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
         return UsdShadeMaterial();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = material.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
-
     // Define the surface shader to be used in the universal rendering context
     SdfPath shaderPath = path.AppendChild(_tokens->upsName);
-    UsdShadeShader shader = UsdShadeShader::Define(stage, shaderPath);
+    UsdShadeShader shader = usdex::core::detail::definePrim<UsdShadeShader>(stage, shaderPath);
+
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
+
     shader.SetShaderId(_tokens->upsId);
     material.CreateSurfaceOutput().ConnectToSource(shader.CreateOutput(UsdShadeTokens->surface, SdfValueTypeNames->Token));
     material.CreateDisplacementOutput().ConnectToSource(shader.CreateOutput(UsdShadeTokens->displacement, SdfValueTypeNames->Token));
@@ -341,6 +1030,8 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
     const float metallic
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -363,6 +1054,8 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
     const float metallic
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the prim is not valid
     if (!prim)
     {
@@ -397,9 +1090,14 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
     return usdex::core::definePreviewMaterial(stage, path, color, opacity, roughness, metallic);
 }
 
-bool usdex::core::addDiffuseTextureToPreviewMaterial(pxr::UsdShadeMaterial& material, const pxr::SdfAssetPath& texturePath)
+namespace
 {
-    UsdShadeShader surface = usdex::core::computeEffectivePreviewSurfaceShader(material);
+
+bool addDiffuseTexture(UsdShadeMaterial& material, const SdfAssetPath& texturePath, TextureReaderCache* cache)
+{
+    TRACE_FUNCTION();
+
+    UsdShadeShader surface = cache ? cache->getSurfaceShader(material) : usdex::core::computeEffectivePreviewSurfaceShader(material);
     if (!isShaderType(surface, _tokens->upsId))
     {
         TF_WARN("Material <%s> must first be defined using definePreviewMaterial()", material.GetPath().GetAsString().c_str());
@@ -429,7 +1127,8 @@ bool usdex::core::addDiffuseTextureToPreviewMaterial(pxr::UsdShadeMaterial& mate
     }
     GfVec4f fallback(color[0], color[1], color[2], 1.0f);
 
-    UsdShadeShader textureReader = ::acquireTextureReader(material, _tokens->uvTexDiffuseName, texturePath, ColorSpace::eAuto, fallback);
+    UsdShadeShader textureReader =
+        ::acquireTextureReader(material, _tokens->uvTexDiffuseName, texturePath, usdex::core::ColorSpace::eAuto, fallback, cache);
     if (!textureReader)
     {
         return false;
@@ -441,9 +1140,11 @@ bool usdex::core::addDiffuseTextureToPreviewMaterial(pxr::UsdShadeMaterial& mate
     return true;
 }
 
-bool usdex::core::addNormalTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addNormalTexture(UsdShadeMaterial& material, const SdfAssetPath& texturePath, TextureReaderCache* cache)
 {
-    UsdShadeShader surface = usdex::core::computeEffectivePreviewSurfaceShader(material);
+    TRACE_FUNCTION();
+
+    UsdShadeShader surface = cache ? cache->getSurfaceShader(material) : usdex::core::computeEffectivePreviewSurfaceShader(material);
     if (!isShaderType(surface, _tokens->upsId))
     {
         TF_WARN("Material <%s> must first be defined using definePreviewMaterial()", material.GetPath().GetAsString().c_str());
@@ -451,7 +1152,8 @@ bool usdex::core::addNormalTextureToPreviewMaterial(UsdShadeMaterial& material,
     }
 
     GfVec4f fallback(0.0f, 0.0f, 1.0f, 1.0f);
-    UsdShadeShader textureReader = ::acquireTextureReader(material, _tokens->uvTexNormalsName, texturePath, ColorSpace::eRaw, fallback);
+    UsdShadeShader textureReader =
+        ::acquireTextureReader(material, _tokens->uvTexNormalsName, texturePath, usdex::core::ColorSpace::eRaw, fallback, cache);
     if (!textureReader)
     {
         return false;
@@ -461,7 +1163,8 @@ bool usdex::core::addNormalTextureToPreviewMaterial(UsdShadeMaterial& material,
     UsdShadeOutput texShaderOutput = textureReader.CreateOutput(_tokens->rgb, SdfValueTypeNames->Float3);
     surface.CreateInput(_tokens->normal, SdfValueTypeNames->Normal3f).ConnectToSource(texShaderOutput);
 
-    if (isEightBitTextureFormat(textureReader.GetInput(_tokens->file)))
+    const UsdShadeInput fileInput = textureReader.GetInput(_tokens->file);
+    if (cache ? cache->isEightBitTexture(fileInput, texturePath) : ::isEightBitTextureFormat(fileInput))
     {
         // set the scale and bias to adjust normals into tangent space
         textureReader.CreateInput(_tokens->scale, SdfValueTypeNames->Float4).Set(GfVec4f(2, 2, 2, 1));
@@ -471,9 +1174,11 @@ bool usdex::core::addNormalTextureToPreviewMaterial(UsdShadeMaterial& material,
     return true;
 }
 
-bool usdex::core::addOrmTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addOrmTexture(UsdShadeMaterial& material, const SdfAssetPath& texturePath, TextureReaderCache* cache)
 {
-    UsdShadeShader surface = usdex::core::computeEffectivePreviewSurfaceShader(material);
+    TRACE_FUNCTION();
+
+    UsdShadeShader surface = cache ? cache->getSurfaceShader(material) : usdex::core::computeEffectivePreviewSurfaceShader(material);
     if (!isShaderType(surface, _tokens->upsId))
     {
         TF_WARN("Material <%s> must first be defined using definePreviewMaterial()", material.GetPath().GetAsString().c_str());
@@ -522,7 +1227,8 @@ bool usdex::core::addOrmTextureToPreviewMaterial(UsdShadeMaterial& material, con
     }
     GfVec4f fallback(1.0f, roughness, metallic, /* unused */ 1.0f);
 
-    UsdShadeShader textureReader = ::acquireTextureReader(material, _tokens->uvTexORMName, texturePath, ColorSpace::eRaw, fallback);
+    UsdShadeShader textureReader =
+        ::acquireTextureReader(material, _tokens->uvTexORMName, texturePath, usdex::core::ColorSpace::eRaw, fallback, cache);
     if (!textureReader)
     {
         return false;
@@ -537,9 +1243,11 @@ bool usdex::core::addOrmTextureToPreviewMaterial(UsdShadeMaterial& material, con
     return true;
 }
 
-bool usdex::core::addRoughnessTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addRoughnessTexture(UsdShadeMaterial& material, const SdfAssetPath& texturePath, TextureReaderCache* cache)
 {
-    UsdShadeShader surface = usdex::core::computeEffectivePreviewSurfaceShader(material);
+    TRACE_FUNCTION();
+
+    UsdShadeShader surface = cache ? cache->getSurfaceShader(material) : usdex::core::computeEffectivePreviewSurfaceShader(material);
     if (!isShaderType(surface, _tokens->upsId))
     {
         TF_WARN("Material <%s> must first be defined using definePreviewMaterial()", material.GetPath().GetAsString().c_str());
@@ -569,7 +1277,8 @@ bool usdex::core::addRoughnessTextureToPreviewMaterial(UsdShadeMaterial& materia
     }
     GfVec4f fallback(roughness, /* unused */ 0.0f, /* unused */ 0.0f, /* unused */ 1.0f);
 
-    UsdShadeShader textureReader = ::acquireTextureReader(material, _tokens->uvTexRoughnessName, texturePath, ColorSpace::eRaw, fallback);
+    UsdShadeShader textureReader =
+        ::acquireTextureReader(material, _tokens->uvTexRoughnessName, texturePath, usdex::core::ColorSpace::eRaw, fallback, cache);
     if (!textureReader)
     {
         return false;
@@ -581,9 +1290,11 @@ bool usdex::core::addRoughnessTextureToPreviewMaterial(UsdShadeMaterial& materia
     return true;
 }
 
-bool usdex::core::addMetallicTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addMetallicTexture(UsdShadeMaterial& material, const SdfAssetPath& texturePath, TextureReaderCache* cache)
 {
-    UsdShadeShader surface = usdex::core::computeEffectivePreviewSurfaceShader(material);
+    TRACE_FUNCTION();
+
+    UsdShadeShader surface = cache ? cache->getSurfaceShader(material) : usdex::core::computeEffectivePreviewSurfaceShader(material);
     if (!isShaderType(surface, _tokens->upsId))
     {
         TF_WARN("Material <%s> must first be defined using definePreviewMaterial()", material.GetPath().GetAsString().c_str());
@@ -613,7 +1324,8 @@ bool usdex::core::addMetallicTextureToPreviewMaterial(UsdShadeMaterial& material
     }
     GfVec4f fallback(metallic, /* unused */ 0.0f, /* unused */ 0.0f, /* unused */ 1.0f);
 
-    UsdShadeShader textureReader = ::acquireTextureReader(material, _tokens->uvTexMetallicName, texturePath, ColorSpace::eRaw, fallback);
+    UsdShadeShader textureReader =
+        ::acquireTextureReader(material, _tokens->uvTexMetallicName, texturePath, usdex::core::ColorSpace::eRaw, fallback, cache);
     if (!textureReader)
     {
         return false;
@@ -625,10 +1337,11 @@ bool usdex::core::addMetallicTextureToPreviewMaterial(UsdShadeMaterial& material
     return true;
 }
 
-
-bool usdex::core::addOpacityTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addOpacityTexture(UsdShadeMaterial& material, const SdfAssetPath& texturePath, TextureReaderCache* cache)
 {
-    UsdShadeShader surface = usdex::core::computeEffectivePreviewSurfaceShader(material);
+    TRACE_FUNCTION();
+
+    UsdShadeShader surface = cache ? cache->getSurfaceShader(material) : usdex::core::computeEffectivePreviewSurfaceShader(material);
     if (!isShaderType(surface, _tokens->upsId))
     {
         TF_WARN("Material <%s> must first be defined using definePreviewMaterial()", material.GetPath().GetAsString().c_str());
@@ -657,7 +1370,8 @@ bool usdex::core::addOpacityTextureToPreviewMaterial(UsdShadeMaterial& material,
 
     GfVec4f fallback(opacity, /* unused */ 0.0f, /* unused */ 0.0f, /* unused */ 1.0f);
 
-    UsdShadeShader textureReader = ::acquireTextureReader(material, _tokens->uvTexOpacityName, texturePath, ColorSpace::eRaw, fallback);
+    UsdShadeShader textureReader =
+        ::acquireTextureReader(material, _tokens->uvTexOpacityName, texturePath, usdex::core::ColorSpace::eRaw, fallback, cache);
     if (!textureReader)
     {
         return false;
@@ -674,8 +1388,149 @@ bool usdex::core::addOpacityTextureToPreviewMaterial(UsdShadeMaterial& material,
     return true;
 }
 
+} // namespace
+
+bool usdex::core::addDiffuseTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    return ::addDiffuseTexture(material, texturePath, nullptr);
+}
+
+bool usdex::core::addNormalTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    return ::addNormalTexture(material, texturePath, nullptr);
+}
+
+bool usdex::core::addOrmTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    return ::addOrmTexture(material, texturePath, nullptr);
+}
+
+bool usdex::core::addRoughnessTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    return ::addRoughnessTexture(material, texturePath, nullptr);
+}
+
+bool usdex::core::addMetallicTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    return ::addMetallicTexture(material, texturePath, nullptr);
+}
+
+bool usdex::core::addOpacityTextureToPreviewMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    return ::addOpacityTexture(material, texturePath, nullptr);
+}
+
+class usdex::core::PreviewMaterialRegistry::PreviewMaterialRegistryImpl
+{
+
+public:
+
+    PreviewMaterialRegistryImpl(UsdPrim parent, bool shareTextureReaders)
+        : parent(parent), textureReaderCache(parent, nameCache, shareTextureReaders)
+    {
+    }
+
+    //! A unique material description and the material which was defined for it
+    struct Entry
+    {
+        PreviewMaterialDescription description;
+        UsdShadeMaterial material;
+    };
+
+    UsdPrim parent;
+    NameCache nameCache;
+    TextureReaderCache textureReaderCache;
+
+    // The unique materials keyed by hash. Materials with colliding hashes are disambiguated by comparing their descriptions.
+    std::unordered_multimap<size_t, Entry> entries;
+    size_t useCount = 0;
+};
+
+usdex::core::PreviewMaterialRegistry::PreviewMaterialRegistry(UsdPrim parent, bool shareTextureReaders)
+{
+    m_impl = new PreviewMaterialRegistryImpl(parent, shareTextureReaders);
+}
+
+usdex::core::PreviewMaterialRegistry::~PreviewMaterialRegistry()
+{
+    delete m_impl;
+}
+
+UsdShadeMaterial usdex::core::PreviewMaterialRegistry::definePreviewMaterial(const std::string& name, const PreviewMaterialDescription& material)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "PreviewMaterialRegistry::definePreviewMaterial");
+
+    const size_t hash = ::hashPreviewMaterial(material);
+    const auto [begin, end] = m_impl->entries.equal_range(hash);
+    for (auto it = begin; it != end; ++it)
+    {
+        if (::previewMaterialsEqual(it->second.description, material))
+        {
+            m_impl->useCount++;
+            return it->second.material;
+        }
+    }
+
+    if (!m_impl->parent)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid parent prim");
+        return UsdShadeMaterial();
+    }
+
+    // Define the first instance of each unique material
+    const TfToken primName = m_impl->nameCache.getPrimName(m_impl->parent, name);
+    UsdShadeMaterial result = usdex::core::definePreviewMaterial(
+        m_impl->parent,
+        primName.GetString(),
+        material.color,
+        material.opacity,
+        material.roughness,
+        material.metallic
+    );
+    if (!result)
+    {
+        return UsdShadeMaterial();
+    }
+
+    using AddTextureFn = bool (*)(UsdShadeMaterial&, const SdfAssetPath&, TextureReaderCache*);
+    const std::pair<const SdfAssetPath&, AddTextureFn> textures[] = {
+        { material.diffuseTexture, &::addDiffuseTexture },
+        { material.normalTexture, &::addNormalTexture },
+        { material.ormTexture, &::addOrmTexture },
+        { material.roughnessTexture, &::addRoughnessTexture },
+        { material.metallicTexture, &::addMetallicTexture },
+        { material.opacityTexture, &::addOpacityTexture },
+    };
+    for (const auto& [texturePath, addTexture] : textures)
+    {
+        if (!texturePath.GetAssetPath().empty() && !addTexture(result, texturePath, &m_impl->textureReaderCache))
+        {
+            m_impl->parent.GetStage()->RemovePrim(result.GetPath());
+            return UsdShadeMaterial();
+        }
+    }
+
+    m_impl->entries.emplace(hash, PreviewMaterialRegistryImpl::Entry{ material, result });
+    m_impl->useCount++;
+
+    return result;
+}
+
+size_t usdex::core::PreviewMaterialRegistry::getUniqueMaterialCount() const
+{
+    return m_impl->entries.size();
+}
+
+size_t usdex::core::PreviewMaterialRegistry::getUseCount() const
+{
+    return m_impl->useCount;
+}
+
 bool usdex::core::addPreviewMaterialInterface(pxr::UsdShadeMaterial& material)
 {
+    TRACE_FUNCTION();
+
     if (!material)
     {
         TF_RUNTIME_ERROR("UsdShadeMaterial <%s> is not valid.", material.GetPath().GetAsString().c_str());
@@ -787,6 +1642,8 @@ bool usdex::core::addPreviewMaterialInterface(pxr::UsdShadeMaterial& material)
 
 bool usdex::core::removeMaterialInterface(UsdShadeMaterial& material, bool bakeValues)
 {
+    TRACE_FUNCTION();
+
     if (!material)
     {
         TF_RUNTIME_ERROR("UsdShadeMaterial <%s> is not valid.", material.GetPath().GetAsString().c_str());
@@ -880,3 +1737,17 @@ GfVec3f usdex::core::linearToSrgb(const GfVec3f& color)
 {
     return GfVec3f(fromLinear(color[0]), fromLinear(color[1]), fromLinear(color[2]));
 }
+
+VtVec3fArray usdex::core::sRgbToLinear(const VtVec3fArray& colors)
+{
+    TRACE_FUNCTION();
+
+    return ::convertColors(colors, ::getToLinearTable(), ::toLinearApprox);
+}
+
+VtVec3fArray usdex::core::linearToSrgb(const VtVec3fArray& colors)
+{
+    TRACE_FUNCTION();
+
+    return ::convertColors(colors, ::getFromLinearTable(), ::fromLinearApprox);
+}
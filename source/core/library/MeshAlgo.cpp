@@ -4,13 +4,35 @@
 
 #include "usdex/core/MeshAlgo.h"
 
+#include "usdex/core/AssetStructure.h"
+#include "usdex/core/Authoring.h"
+#include "usdex/core/MaterialAlgo.h"
+#include "usdex/core/NameAlgo.h"
 #include "usdex/core/StageAlgo.h"
+#include "usdex/core/XformAlgo.h"
 
+#include "GeomUtils.h"
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/vt/traits.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdShade/tokens.h>
 #include <pxr/usd/usdUtils/pipeline.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <unordered_map>
 
 using namespace usdex::core;
 using namespace pxr;
@@ -65,6 +87,7 @@ bool validatePrimvarInterpolation(
 // Validate a primvar intended for a mesh.
 // Accepts a vector of allowed interpolations and returns false if the PrimvarData is not within these allowed values.
 // Validates that a valid interpolation was found and that indices (if provided) fit inside the value range.
+// The indices are only validated if the ValidationPolicy of the calling thread requires the contents of the arrays to be validated.
 // If the primvar is invalid and reason is non-null, an error message describing the validation error will be set.
 template <typename T>
 bool validatePrimvar(
@@ -90,7 +113,7 @@ bool validatePrimvar(
         return false;
     }
 
-    if (!primvar.isValid())
+    if (usdex::core::detail::shouldValidateContents() && !primvar.isValid())
     {
         if (reason != nullptr)
         {
@@ -102,40 +125,33 @@ bool validatePrimvar(
     return true;
 }
 
-} // namespace
-
-UsdGeomMesh usdex::core::definePolyMesh(
-    UsdStagePtr stage,
-    const SdfPath& path,
+// Validate all of the data required to define a mesh, regardless of its location.
+// If the data is invalid, detail will be set to a description of the invalid data (e.g. "invalid normals: <reason>").
+bool validateMeshData(
     const VtIntArray& faceVertexCounts,
     const VtIntArray& faceVertexIndices,
     const VtVec3fArray& points,
-    std::optional<const Vec3fPrimvarData> normals,
-    std::optional<const Vec2fPrimvarData> uvs,
-    std::optional<const Vec3fPrimvarData> displayColor,
-    std::optional<const FloatPrimvarData> displayOpacity
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec2fPrimvarData>& uvs,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity,
+    std::string* detail
 )
 {
-    // Early out if the proposed prim location is invalid
-    std::string reason;
-    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
-    {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid location: %s", reason.c_str());
-        return UsdGeomMesh();
-    }
-
     // Early out if the points are empty
     if (points.empty())
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid points: Empty array", path.GetAsString().c_str());
-        return UsdGeomMesh();
+        *detail = "invalid points: Empty array";
+        return false;
     }
 
-    // Early out if the topology is not valid
-    if (!UsdGeomMesh::ValidateTopology(faceVertexIndices, faceVertexCounts, points.size(), &reason))
+    // Early out if the topology is not valid. This scans every face, so trusted topology is not validated.
+    std::string reason;
+    if (usdex::core::detail::shouldValidateContents() &&
+        !UsdGeomMesh::ValidateTopology(faceVertexIndices, faceVertexCounts, points.size(), &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid topology: %s", path.GetAsString().c_str(), reason.c_str());
-        return UsdGeomMesh();
+        *detail = TfStringPrintf("invalid topology: %s", reason.c_str());
+        return false;
     }
 
     // Early out if normals were specified but not valid
@@ -144,8 +160,8 @@ UsdGeomMesh usdex::core::definePolyMesh(
         static const TfTokenVector validInterpolations = { UsdGeomTokens->uniform, UsdGeomTokens->vertex, UsdGeomTokens->faceVarying };
         if (!validatePrimvar(normals.value(), validInterpolations, faceVertexCounts, faceVertexIndices, points, &reason))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid normals: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomMesh();
+            *detail = TfStringPrintf("invalid normals: %s", reason.c_str());
+            return false;
         }
     }
 
@@ -155,8 +171,8 @@ UsdGeomMesh usdex::core::definePolyMesh(
         static const TfTokenVector validInterpolations = { UsdGeomTokens->vertex, UsdGeomTokens->faceVarying };
         if (!validatePrimvar(uvs.value(), validInterpolations, faceVertexCounts, faceVertexIndices, points, &reason))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid uvs: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomMesh();
+            *detail = TfStringPrintf("invalid uvs: %s", reason.c_str());
+            return false;
         }
     }
 
@@ -172,8 +188,8 @@ UsdGeomMesh usdex::core::definePolyMesh(
     {
         if (!::validatePrimvar(displayColor.value(), s_allValidInterpolations, faceVertexCounts, faceVertexIndices, points, &reason))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid display color: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomMesh();
+            *detail = TfStringPrintf("invalid display color: %s", reason.c_str());
+            return false;
         }
     }
 
@@ -182,23 +198,302 @@ UsdGeomMesh usdex::core::definePolyMesh(
     {
         if (!::validatePrimvar(displayOpacity.value(), s_allValidInterpolations, faceVertexCounts, faceVertexIndices, points, &reason))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid display opacity: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomMesh();
+            *detail = TfStringPrintf("invalid display opacity: %s", reason.c_str());
+            return false;
         }
     }
 
-    // Define the Mesh and check that this was successful
-    UsdGeomMesh mesh = UsdGeomMesh::Define(stage, path);
-    if (!mesh)
+    return true;
+}
+
+// Validate the location and all of the data required to define a mesh.
+// If the data is invalid and reason is non-null, a complete error message describing the validation error will be set.
+// This function does not author any opinions, so it is safe to call concurrently for different meshes on the same stage.
+bool validateMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec2fPrimvarData>& uvs,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity,
+    std::string* reason
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the proposed prim location is invalid
+    std::string detail;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &detail))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
-        return UsdGeomMesh();
+        *reason = TfStringPrintf("Unable to define UsdGeomMesh due to an invalid location: %s", detail.c_str());
+        return false;
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = mesh.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    if (!::validateMeshData(faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity, &detail))
+    {
+        *reason = TfStringPrintf("Unable to define UsdGeomMesh at \"%s\" due to %s", path.GetAsString().c_str(), detail.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// Validate the locations of many meshes at once, so that the parent of each location is only looked up once.
+// A complete error message is set for each invalid location, and the data of the valid meshes can then be validated concurrently.
+std::vector<bool> validateMeshLocations(UsdStagePtr stage, const SdfPathVector& paths, std::vector<std::string>* reasons)
+{
+    const std::vector<bool> result = usdex::core::areEditablePrimLocations(stage, paths, reasons);
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        if (!result[i])
+        {
+            (*reasons)[i] = TfStringPrintf("Unable to define UsdGeomMesh due to an invalid location: %s", (*reasons)[i].c_str());
+        }
+    }
+    return result;
+}
+
+// Validate the data of a mesh whose location has already been validated by validateMeshLocations.
+// This function does not author any opinions, so it is safe to call concurrently for different meshes on the same stage.
+bool validateMeshDescription(const usdex::core::PolyMeshDescription& desc, std::string* reason)
+{
+    std::string detail;
+    if (!::validateMeshData(
+            desc.faceVertexCounts,
+            desc.faceVertexIndices,
+            desc.points,
+            desc.normals,
+            desc.uvs,
+            desc.displayColor,
+            desc.displayOpacity,
+            &detail
+        ))
+    {
+        *reason = TfStringPrintf("Unable to define UsdGeomMesh at \"%s\" due to %s", desc.path.GetAsString().c_str(), detail.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Check whether two values are equal within a tolerance, component by component
+template <typename T>
+bool isClose(const T& lhs, const T& rhs, float epsilon)
+{
+    for (size_t c = 0; c < T::dimension; ++c)
+    {
+        // Written as a negation so that NaN components are never considered close
+        if (!(std::abs(lhs[c] - rhs[c]) <= epsilon))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The number of bytes required to store a primvar with the given number of values and indices
+template <typename T>
+size_t primvarStorageSize(size_t numValues, size_t numIndices)
+{
+    return numValues * sizeof(T) + numIndices * sizeof(int);
+}
+
+// Weld values which fall within the same epsilon sized cell, producing indexed values that reference the first value found in each cell.
+// An epsilon of zero only welds values which are exactly equal.
+template <typename T>
+void weldValues(const VtArray<T>& values, float epsilon, VtArray<T>& weldedValues, VtIntArray& indices)
+{
+    if (epsilon <= 0.0f)
+    {
+        detail::computeIndexing(values, weldedValues, indices);
+        return;
+    }
+
+    // Quantize the values into cells, so that the exact indexing of the cells can be used to weld the values
+    VtArray<T> cells(values.size());
+    const T* valuesData = values.cdata();
+    T* cellsData = cells.data();
+    WorkParallelForN(
+        values.size(),
+        [valuesData, cellsData, epsilon](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                for (size_t c = 0; c < T::dimension; ++c)
+                {
+                    cellsData[i][c] = std::floor(valuesData[i][c] / epsilon);
+                }
+            }
+        }
+    );
+
+    VtArray<T> uniqueCells;
+    detail::computeIndexing(cells, uniqueCells, indices);
+
+    // The indices are assigned in order of first occurrence, so the first value of each cell is found by a single traversal
+    weldedValues.resize(uniqueCells.size());
+    const int* indicesData = indices.cdata();
+    size_t numWelded = 0;
+    for (size_t i = 0; i < values.size() && numWelded < weldedValues.size(); ++i)
+    {
+        if (static_cast<size_t>(indicesData[i]) == numWelded)
+        {
+            weldedValues[numWelded++] = valuesData[i];
+        }
+    }
+}
+
+// Compact a faceVarying primvar into the smallest equivalent description.
+// The primvar is demoted to vertex interpolation if every face vertex of each point has the same value, and it is indexed if that reduces the
+// storage required. Returns false if the primvar is not faceVarying, is not valid for the topology, or cannot be made any smaller.
+template <typename T>
+bool compactFaceVaryingPrimvarImpl(PrimvarData<T>& primvar, const VtIntArray& faceVertexIndices, size_t numPoints, float epsilon)
+{
+    if (primvar.interpolation() != UsdGeomTokens->faceVarying || primvar.elementSize() > 1 || !primvar.isValid())
+    {
+        return false;
+    }
+
+    const size_t numFaceVertices = faceVertexIndices.size();
+    if (primvar.effectiveSize() != numFaceVertices)
+    {
+        return false;
+    }
+
+    // Gather the value of every face vertex, validating that every face vertex references a point
+    const VtArray<T>& values = primvar.values();
+    const VtIntArray& indices = primvar.indices();
+    const T* valuesData = values.cdata();
+    const int* indicesData = primvar.hasIndices() ? indices.cdata() : nullptr;
+    const int* faceVertexIndicesData = faceVertexIndices.cdata();
+    VtArray<T> faceVertexValues(numFaceVertices);
+    T* faceVertexValuesData = faceVertexValues.data();
+    std::atomic<bool> validTopology(true);
+    WorkParallelForN(
+        numFaceVertices,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                faceVertexValuesData[i] = valuesData[indicesData ? indicesData[i] : i];
+                const int point = faceVertexIndicesData[i];
+                if (point < 0 || static_cast<size_t>(point) >= numPoints)
+                {
+                    validTopology = false;
+                }
+            }
+        }
+    );
+    if (!validTopology)
+    {
+        return false;
+    }
+
+    // Find the first face vertex of each point
+    std::vector<int> firstFaceVertex(numPoints, -1);
+    for (size_t i = 0; i < numFaceVertices; ++i)
+    {
+        int& first = firstFaceVertex[faceVertexIndicesData[i]];
+        if (first < 0)
+        {
+            first = static_cast<int>(i);
+        }
+    }
+
+    // The values can be demoted to vertex interpolation if every face vertex is consistent with the first face vertex of its point
+    std::atomic<bool> perPoint(true);
+    WorkParallelForN(
+        numFaceVertices,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end && perPoint; ++i)
+            {
+                const int first = firstFaceVertex[faceVertexIndicesData[i]];
+                if (!::isClose(faceVertexValuesData[i], faceVertexValuesData[first], epsilon))
+                {
+                    perPoint = false;
+                }
+            }
+        }
+    );
+
+    TfToken interpolation = UsdGeomTokens->faceVarying;
+    VtArray<T> candidateValues;
+    if (perPoint)
+    {
+        // Points which are not referenced by any face are given a zero value, as it will never be used
+        interpolation = UsdGeomTokens->vertex;
+        candidateValues.resize(numPoints);
+        T* candidateValuesData = candidateValues.data();
+        WorkParallelForN(
+            numPoints,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t p = begin; p < end; ++p)
+                {
+                    const int first = firstFaceVertex[p];
+                    candidateValuesData[p] = (first < 0) ? VtZero<T>() : faceVertexValuesData[first];
+                }
+            }
+        );
+    }
+    else
+    {
+        candidateValues = std::move(faceVertexValues);
+    }
+
+    // Weld the candidate values and only retain the indices if they reduce the storage
+    VtArray<T> weldedValues;
+    VtIntArray weldedIndices;
+    ::weldValues(candidateValues, epsilon, weldedValues, weldedIndices);
+    const size_t indexedSize = ::primvarStorageSize<T>(weldedValues.size(), weldedIndices.size());
+    const size_t unindexedSize = ::primvarStorageSize<T>(candidateValues.size(), 0);
+    const size_t currentSize = ::primvarStorageSize<T>(values.size(), primvar.hasIndices() ? indices.size() : 0);
+    const bool useIndices = indexedSize < unindexedSize;
+    if (std::min(indexedSize, unindexedSize) >= currentSize)
+    {
+        return false;
+    }
+
+    if (useIndices)
+    {
+        primvar = PrimvarData<T>(interpolation, std::move(weldedValues), std::move(weldedIndices));
+    }
+    else
+    {
+        primvar = PrimvarData<T>(interpolation, std::move(candidateValues));
+    }
+    return true;
+}
+
+// Compact the primvar data if it is faceVarying, otherwise return it unchanged
+template <typename T>
+std::optional<const PrimvarData<T>> compactedPrimvar(
+    const std::optional<const PrimvarData<T>>& primvar,
+    const VtIntArray& faceVertexIndices,
+    size_t numPoints,
+    float epsilon
+)
+{
+    if (!primvar.has_value() || primvar.value().interpolation() != UsdGeomTokens->faceVarying)
+    {
+        return primvar;
+    }
+
+    PrimvarData<T> compacted = primvar.value();
+    if (!::compactFaceVaryingPrimvarImpl(compacted, faceVertexIndices, numPoints, epsilon))
+    {
+        return primvar;
+    }
+    return compacted;
+}
+
+// Author the topology of a previously defined mesh without any validation.
+void authorMeshTopology(UsdGeomMesh& mesh, const VtIntArray& faceVertexCounts, const VtIntArray& faceVertexIndices)
+{
+    TRACE_FUNCTION();
 
     // Author opinions on Mesh attributes
     mesh.CreateOrientationAttr().Set(UsdGeomTokens->rightHanded);
@@ -207,19 +502,30 @@ UsdGeomMesh usdex::core::definePolyMesh(
     // Create and set required topology attributes
     mesh.CreateFaceVertexCountsAttr().Set(faceVertexCounts);
     mesh.CreateFaceVertexIndicesAttr().Set(faceVertexIndices);
-    mesh.CreatePointsAttr().Set(points);
+}
 
-    // Compute an extent from the points so there is a guarantee that the extent will be correct and authored in all cases.
-    VtArray<GfVec3f> extent;
-    UsdGeomPointBased::ComputeExtent(points, &extent);
-    mesh.CreateExtentAttr().Set(extent);
+// Author the optional primvars of a previously defined mesh without any validation.
+void authorMeshPrimvars(
+    UsdGeomMesh& mesh,
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec2fPrimvarData>& uvs,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity
+)
+{
+    TRACE_FUNCTION();
+
+    const SdfPath& path = mesh.GetPath();
+
+    // The display color and opacity types are fixed by the UsdGeomGprim schema, so only the normals and uvs follow the primvar precision
+    const bool halfPrecision = (usdex::core::getPrimvarPrecision() == PrimvarPrecision::eHalf);
 
     // Optionally author normals
     if (normals.has_value())
     {
         // Define the normals primvar
         const TfToken& name = UsdGeomTokens->normals;
-        const SdfValueTypeName& typeName = SdfValueTypeNames->Normal3fArray;
+        const SdfValueTypeName& typeName = halfPrecision ? SdfValueTypeNames->Normal3hArray : SdfValueTypeNames->Normal3fArray;
         UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(name, typeName);
         if (!normals.value().setPrimvar(primvar))
         {
@@ -231,7 +537,7 @@ UsdGeomMesh usdex::core::definePolyMesh(
     if (uvs.has_value())
     {
         const TfToken& name = UsdUtilsGetPrimaryUVSetName();
-        const SdfValueTypeName& typeName = SdfValueTypeNames->TexCoord2fArray;
+        const SdfValueTypeName& typeName = halfPrecision ? SdfValueTypeNames->TexCoord2hArray : SdfValueTypeNames->TexCoord2fArray;
         UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(name, typeName);
         if (!uvs.value().setPrimvar(primvar))
         {
@@ -258,57 +564,608 @@ UsdGeomMesh usdex::core::definePolyMesh(
             TF_WARN("Failed to set display opacity primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
         }
     }
+}
 
-    return mesh;
+// Author all of the mesh attributes and primvars on a previously defined mesh without any validation.
+// All of the data must have been validated using validateMesh() prior to calling this function.
+void authorMesh(
+    UsdGeomMesh& mesh,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec2fPrimvarData>& uvs,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity
+)
+{
+    ::authorMeshTopology(mesh, faceVertexCounts, faceVertexIndices);
+    mesh.CreatePointsAttr().Set(points);
+
+    // Compute an extent from the points so there is a guarantee that the extent will be correct and authored in all cases.
+    mesh.CreateExtentAttr().Set(detail::computeExtent(points));
+
+    ::authorMeshPrimvars(mesh, normals, uvs, displayColor, displayOpacity);
 }
 
-UsdGeomMesh usdex::core::definePolyMesh(
-    UsdPrim parent,
-    const std::string& name,
+// Validate, define, and author a mesh at the given location
+UsdGeomMesh definePolyMeshImpl(
+    UsdStagePtr stage,
+    const SdfPath& path,
     const VtIntArray& faceVertexCounts,
     const VtIntArray& faceVertexIndices,
     const VtVec3fArray& points,
-    std::optional<const Vec3fPrimvarData> normals,
-    std::optional<const Vec2fPrimvarData> uvs,
-    std::optional<const Vec3fPrimvarData> displayColor,
-    std::optional<const FloatPrimvarData> displayOpacity
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec2fPrimvarData>& uvs,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity,
+    std::optional<float> compactionEpsilon
 )
 {
-    // Early out if the proposed prim location is invalid
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "definePolyMesh");
+    if (instrumentation.isActive())
+    {
+        instrumentation.addElements(points.size());
+        instrumentation.addArray(faceVertexCounts);
+        instrumentation.addArray(faceVertexIndices);
+        instrumentation.addArray(points);
+        instrumentation.addPrimvar(normals);
+        instrumentation.addPrimvar(uvs);
+        instrumentation.addPrimvar(displayColor);
+        instrumentation.addPrimvar(displayOpacity);
+    }
+
+    // Early out if the location or any of the mesh data is invalid
     std::string reason;
-    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    if (!::validateMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid location: %s", reason.c_str());
+        TF_RUNTIME_ERROR("%s", reason.c_str());
         return UsdGeomMesh();
     }
 
-    // Call overloaded function
-    UsdStageWeakPtr stage = parent.GetStage();
-    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
-    return usdex::core::definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity);
+    // Optionally compact faceVarying normals and uvs prior to defining the mesh, so nothing is authored if the compaction were to fail
+    std::optional<const Vec3fPrimvarData> compactedNormals = normals;
+    std::optional<const Vec2fPrimvarData> compactedUvs = uvs;
+    if (compactionEpsilon.has_value())
+    {
+        compactedNormals = ::compactedPrimvar(normals, faceVertexIndices, points.size(), compactionEpsilon.value());
+        compactedUvs = ::compactedPrimvar(uvs, faceVertexIndices, points.size(), compactionEpsilon.value());
+    }
+
+    // Define the Mesh and check that this was successful
+    UsdGeomMesh mesh = usdex::core::detail::definePrim<UsdGeomMesh>(stage, path);
+    if (!mesh)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+        return UsdGeomMesh();
+    }
+
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
+
+    ::authorMesh(mesh, faceVertexCounts, faceVertexIndices, points, compactedNormals, compactedUvs, displayColor, displayOpacity);
+
+    return mesh;
 }
 
-UsdGeomMesh usdex::core::definePolyMesh(
-    UsdPrim prim,
+// Check whether the current value of an attribute is equal to the given value.
+// VtArray equality first checks whether the arrays are identical, so unchanged arrays which share a buffer are compared in constant time.
+template <typename T>
+bool isCurrentValue(const UsdAttribute& attr, const T& value)
+{
+    T current;
+    return attr && attr.Get(&current) && current == value;
+}
+
+// Check whether a primvar already describes the given data.
+// Element sizes of zero, one, or unauthored are all considered equivalent as they describe the same thing.
+template <typename T>
+bool primvarMatches(const UsdGeomPrimvar& primvar, const PrimvarData<T>& data)
+{
+    if (!primvar || !primvar.HasAuthoredValue())
+    {
+        return false;
+    }
+
+    const PrimvarData<T> current = PrimvarData<T>::getPrimvarData(primvar);
+    if (current.interpolation() != data.interpolation() || current.hasIndices() != data.hasIndices())
+    {
+        return false;
+    }
+
+    if (std::max(current.elementSize(), 1) != std::max(data.elementSize(), 1))
+    {
+        return false;
+    }
+
+    if (!(current.values() == data.values()))
+    {
+        return false;
+    }
+
+    return !data.hasIndices() || current.indices() == data.indices();
+}
+
+// Filter out any primvar data that already matches the authored primvar
+template <typename T>
+std::optional<const PrimvarData<T>> changedPrimvar(const UsdGeomPrimvar& primvar, const std::optional<const PrimvarData<T>>& data)
+{
+    if (!data.has_value() || ::primvarMatches(primvar, data.value()))
+    {
+        return std::nullopt;
+    }
+    return data;
+}
+
+//! Hash an optional primvar, including its interpolation, indices, and element size
+template <typename T>
+size_t hashPrimvar(const std::optional<PrimvarData<T>>& primvar)
+{
+    if (!primvar.has_value())
+    {
+        return 0;
+    }
+    return TfHash::Combine(primvar->interpolation(), primvar->values(), primvar->indices(), primvar->elementSize());
+}
+
+//! Hash all of the content of a mesh, excluding its path
+size_t hashMesh(const PolyMeshDescription& mesh)
+{
+    TRACE_FUNCTION();
+
+    return TfHash::Combine(
+        mesh.faceVertexCounts,
+        mesh.faceVertexIndices,
+        mesh.points,
+        ::hashPrimvar(mesh.normals),
+        ::hashPrimvar(mesh.uvs),
+        ::hashPrimvar(mesh.displayColor),
+        ::hashPrimvar(mesh.displayOpacity)
+    );
+}
+
+//! Whether all of the content of two meshes is identical, excluding their paths
+bool meshesEqual(const PolyMeshDescription& lhs, const PolyMeshDescription& rhs)
+{
+    return lhs.faceVertexCounts == rhs.faceVertexCounts && lhs.faceVertexIndices == rhs.faceVertexIndices && lhs.points == rhs.points &&
+           lhs.normals == rhs.normals && lhs.uvs == rhs.uvs && lhs.displayColor == rhs.displayColor && lhs.displayOpacity == rhs.displayOpacity;
+}
+
+// Whether a ratio of triangles to retain is valid. NaN is not valid.
+bool isValidLodRatio(float ratio)
+{
+    return ratio > 0.0f && ratio <= 1.0f;
+}
+
+// Lock the points at which the values of a uniform or faceVarying primvar differ between the faces or face vertices of the point,
+// so that simplification preserves the seams of the primvar
+template <typename T>
+void lockPrimvarSeams(
+    const std::optional<PrimvarData<T>>& primvar,
     const VtIntArray& faceVertexCounts,
     const VtIntArray& faceVertexIndices,
-    const VtVec3fArray& points,
-    std::optional<const Vec3fPrimvarData> normals,
-    std::optional<const Vec2fPrimvarData> uvs,
-    std::optional<const Vec3fPrimvarData> displayColor,
-    std::optional<const FloatPrimvarData> displayOpacity
+    std::vector<char>& lockedPoints
 )
 {
-    // Early out if the prim is invalid
-    if (!prim)
+    if (!primvar.has_value())
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid prim");
-        return UsdGeomMesh();
+        return;
     }
 
-    // Warn if original prim is not Scope or Xform
-    TfToken originalType = prim.GetTypeName();
-    if (originalType != UsdGeomTokens->Scope && originalType != UsdGeomTokens->Xform && !originalType.IsEmpty())
+    const PrimvarData<T>& data = primvar.value();
+    const bool faceVarying = data.interpolation() == UsdGeomTokens->faceVarying;
+    if (!faceVarying && data.interpolation() != UsdGeomTokens->uniform)
+    {
+        return;
+    }
+
+    const VtArray<T>& values = data.values();
+    const VtIntArray& indices = data.indices();
+    const size_t elementSize = static_cast<size_t>(std::max(data.elementSize(), 1));
+    auto elementsEqual = [&](size_t lhs, size_t rhs)
+    {
+        for (size_t i = 0; i < elementSize; ++i)
+        {
+            const size_t l = lhs * elementSize + i;
+            const size_t r = rhs * elementSize + i;
+            if (data.hasIndices() ? !(values[indices[l]] == values[indices[r]]) : !(values[l] == values[r]))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Compare the element of every face vertex to the element of the first face vertex of its point
+    std::vector<int> firstElements(lockedPoints.size(), -1);
+    size_t faceVertex = 0;
+    for (size_t face = 0; face < faceVertexCounts.size(); ++face)
+    {
+        for (int i = 0; i < faceVertexCounts[face]; ++i, ++faceVertex)
+        {
+            const int point = faceVertexIndices[faceVertex];
+            const size_t element = faceVarying ? faceVertex : face;
+            if (firstElements[point] < 0)
+            {
+                firstElements[point] = static_cast<int>(element);
+            }
+            else if (!lockedPoints[point] && !elementsEqual(static_cast<size_t>(firstElements[point]), element))
+            {
+                lockedPoints[point] = 1;
+            }
+        }
+    }
+}
+
+// Remap a primvar onto a simplified mesh, retaining its interpolation, indexing, and element size
+template <typename T>
+std::optional<PrimvarData<T>> remapPrimvar(const std::optional<PrimvarData<T>>& primvar, const usdex::core::detail::SimplifiedTopology& topology)
+{
+    if (!primvar.has_value())
+    {
+        return std::nullopt;
+    }
+
+    // The original element of each simplified element
+    const PrimvarData<T>& data = primvar.value();
+    const TfToken& interpolation = data.interpolation();
+    const std::vector<int>* elements = nullptr;
+    if (interpolation == UsdGeomTokens->faceVarying)
+    {
+        elements = &topology.faceVertices;
+    }
+    else if (interpolation == UsdGeomTokens->uniform)
+    {
+        elements = &topology.faces;
+    }
+    else if (interpolation == UsdGeomTokens->vertex || interpolation == UsdGeomTokens->varying)
+    {
+        elements = &topology.points;
+    }
+    else
+    {
+        return primvar;
+    }
+
+    const size_t elementSize = static_cast<size_t>(std::max(data.elementSize(), 1));
+    if (data.hasIndices())
+    {
+        const VtIntArray& indices = data.indices();
+        VtIntArray remappedIndices;
+        remappedIndices.reserve(elements->size() * elementSize);
+        for (int element : *elements)
+        {
+            for (size_t i = 0; i < elementSize; ++i)
+            {
+                remappedIndices.push_back(indices[static_cast<size_t>(element) * elementSize + i]);
+            }
+        }
+        return PrimvarData<T>(interpolation, data.values(), remappedIndices, data.elementSize());
+    }
+
+    const VtArray<T>& values = data.values();
+    VtArray<T> remappedValues;
+    remappedValues.reserve(elements->size() * elementSize);
+    for (int element : *elements)
+    {
+        for (size_t i = 0; i < elementSize; ++i)
+        {
+            remappedValues.push_back(values[static_cast<size_t>(element) * elementSize + i]);
+        }
+    }
+    return PrimvarData<T>(interpolation, std::move(remappedValues), data.elementSize());
+}
+
+// Validate a mesh and a ratio for simplification.
+// The contents of the arrays are always validated, regardless of the ValidationPolicy, as the simplification requires valid topology.
+// If the data is invalid, reason will be set to a complete error message describing the validation error.
+bool validateSimplification(const PolyMeshDescription& mesh, float ratio, std::string* reason)
+{
+    usdex::core::ScopedValidationPolicy policy(usdex::core::ValidationPolicy::eFull);
+
+    if (!::isValidLodRatio(ratio))
+    {
+        *reason = TfStringPrintf(
+            "Unable to simplify the mesh at \"%s\" due to an invalid ratio: %g. The ratio must be greater than 0 and at most 1.",
+            mesh.path.GetAsString().c_str(),
+            ratio
+        );
+        return false;
+    }
+
+    std::string detail;
+    if (!::validateMeshData(
+            mesh.faceVertexCounts,
+            mesh.faceVertexIndices,
+            mesh.points,
+            mesh.normals,
+            mesh.uvs,
+            mesh.displayColor,
+            mesh.displayOpacity,
+            &detail
+        ))
+    {
+        *reason = TfStringPrintf("Unable to simplify the mesh at \"%s\" due to %s", mesh.path.GetAsString().c_str(), detail.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// Simplify a mesh which has been validated using validateSimplification().
+// Returns false, and sets reason to a complete error message, if the simplified mesh has no faces remaining.
+bool simplifyValidMesh(const PolyMeshDescription& mesh, float ratio, PolyMeshDescription& result, std::string* reason)
+{
+    TRACE_FUNCTION();
+
+    // The seams of every primvar are preserved
+    std::vector<char> lockedPoints(mesh.points.size(), 0);
+    ::lockPrimvarSeams(mesh.normals, mesh.faceVertexCounts, mesh.faceVertexIndices, lockedPoints);
+    ::lockPrimvarSeams(mesh.uvs, mesh.faceVertexCounts, mesh.faceVertexIndices, lockedPoints);
+    ::lockPrimvarSeams(mesh.displayColor, mesh.faceVertexCounts, mesh.faceVertexIndices, lockedPoints);
+    ::lockPrimvarSeams(mesh.displayOpacity, mesh.faceVertexCounts, mesh.faceVertexIndices, lockedPoints);
+
+    size_t numTriangles = 0;
+    for (int count : mesh.faceVertexCounts)
+    {
+        numTriangles += static_cast<size_t>(std::max(count - 2, 0));
+    }
+    const size_t targetTriangles = std::max<size_t>(static_cast<size_t>(std::ceil(static_cast<double>(ratio) * numTriangles)), 1);
+
+    usdex::core::detail::SimplifiedTopology topology =
+        usdex::core::detail::simplifyTopology(mesh.faceVertexCounts, mesh.faceVertexIndices, mesh.points, lockedPoints, targetTriangles);
+    if (topology.faces.empty())
+    {
+        *reason = TfStringPrintf("Unable to simplify the mesh at \"%s\" as it has no faces with a non-zero area", mesh.path.GetAsString().c_str());
+        return false;
+    }
+
+    result.path = mesh.path;
+    result.faceVertexCounts = VtIntArray(topology.faces.size(), 3);
+    result.faceVertexIndices = std::move(topology.faceVertexIndices);
+    result.points.reserve(topology.points.size());
+    for (int point : topology.points)
+    {
+        result.points.push_back(mesh.points[point]);
+    }
+    result.normals = ::remapPrimvar(mesh.normals, topology);
+    result.uvs = ::remapPrimvar(mesh.uvs, topology);
+    result.displayColor = ::remapPrimvar(mesh.displayColor, topology);
+    result.displayOpacity = ::remapPrimvar(mesh.displayOpacity, topology);
+    return true;
+}
+
+// The path of the proxy sibling of a mesh authored with MeshLodStyle::ePurpose
+SdfPath getProxyPath(const SdfPath& path)
+{
+    return path.GetParentPath().AppendChild(TfToken(path.GetName() + "_proxy"));
+}
+
+// The minimum number of faces partitioned by each task of partitionFaces
+static constexpr size_t s_partitionGrainSize = 65536;
+
+// Partition the faces of a mesh by their material id using a concurrent counting sort.
+//
+// Each chunk of faces counts the faces of each material, then the counts are accumulated into the offset of each chunk within the faces of each
+// material. Each chunk then scatters its faces independently, and the face indices of each material remain in ascending order.
+// Faces with a negative material id are not partitioned. Returns false if any material id is not less than `numMaterials`.
+bool partitionFaces(const VtIntArray& faceMaterialIds, size_t numMaterials, std::vector<VtIntArray>& partitions)
+{
+    // The counts of every chunk are retained, so the number of chunks is limited to keep their memory proportional to the number of faces
+    const size_t numFaces = faceMaterialIds.size();
+    const size_t maxChunks = numFaces / std::max<size_t>(numMaterials, 1);
+    const size_t numChunks = std::max<size_t>(std::min((numFaces + s_partitionGrainSize - 1) / s_partitionGrainSize, maxChunks), 1);
+    const size_t chunkSize = (numFaces + numChunks - 1) / numChunks;
+    const int* ids = faceMaterialIds.cdata();
+
+    std::vector<size_t> offsets(numChunks * numMaterials, 0);
+    std::atomic<bool> valid(true);
+    WorkParallelForN(
+        numChunks,
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Count faces");
+            for (size_t chunk = begin; chunk < end; ++chunk)
+            {
+                size_t* counts = offsets.data() + chunk * numMaterials;
+                const size_t last = std::min(numFaces, (chunk + 1) * chunkSize);
+                for (size_t face = chunk * chunkSize; face < last; ++face)
+                {
+                    const int id = ids[face];
+                    if (id < 0)
+                    {
+                        continue;
+                    }
+                    if (static_cast<size_t>(id) >= numMaterials)
+                    {
+                        valid = false;
+                        continue;
+                    }
+                    ++counts[id];
+                }
+            }
+        },
+        /* grainSize */ 1
+    );
+
+    if (!valid)
+    {
+        return false;
+    }
+
+    // The arrays are allocated up front, so that the chunks only write to their own range of each array
+    partitions.assign(numMaterials, VtIntArray());
+    std::vector<int*> data(numMaterials, nullptr);
+    for (size_t material = 0; material < numMaterials; ++material)
+    {
+        size_t total = 0;
+        for (size_t chunk = 0; chunk < numChunks; ++chunk)
+        {
+            size_t& offset = offsets[chunk * numMaterials + material];
+            const size_t count = offset;
+            offset = total;
+            total += count;
+        }
+        if (total)
+        {
+            partitions[material].resize(total);
+            data[material] = partitions[material].data();
+        }
+    }
+
+    WorkParallelForN(
+        numChunks,
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Partition faces");
+            for (size_t chunk = begin; chunk < end; ++chunk)
+            {
+                size_t* cursors = offsets.data() + chunk * numMaterials;
+                const size_t last = std::min(numFaces, (chunk + 1) * chunkSize);
+                for (size_t face = chunk * chunkSize; face < last; ++face)
+                {
+                    const int id = ids[face];
+                    if (id >= 0)
+                    {
+                        data[id][cursors[id]++] = static_cast<int>(face);
+                    }
+                }
+            }
+        },
+        /* grainSize */ 1
+    );
+
+    return true;
+}
+
+} // namespace
+
+UsdGeomMesh usdex::core::definePolyMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity,
+    std::optional<float> compactionEpsilon
+)
+{
+    TRACE_FUNCTION();
+
+    return ::definePolyMeshImpl(
+        stage,
+        path,
+        faceVertexCounts,
+        faceVertexIndices,
+        points,
+        normals,
+        uvs,
+        displayColor,
+        displayOpacity,
+        compactionEpsilon
+    );
+}
+
+UsdGeomMesh usdex::core::definePolyMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    VtIntArray&& faceVertexCounts,
+    VtIntArray&& faceVertexIndices,
+    VtVec3fArray&& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity,
+    std::optional<float> compactionEpsilon
+)
+{
+    TRACE_FUNCTION();
+
+    // Take ownership of the arrays so that the authored attributes are the sole owners of the buffers once this function returns
+    const VtIntArray ownedFaceVertexCounts(std::move(faceVertexCounts));
+    const VtIntArray ownedFaceVertexIndices(std::move(faceVertexIndices));
+    const VtVec3fArray ownedPoints(std::move(points));
+    return ::definePolyMeshImpl(
+        stage,
+        path,
+        ownedFaceVertexCounts,
+        ownedFaceVertexIndices,
+        ownedPoints,
+        normals,
+        uvs,
+        displayColor,
+        displayOpacity,
+        compactionEpsilon
+    );
+}
+
+UsdGeomMesh usdex::core::definePolyMesh(
+    UsdPrim parent,
+    const std::string& name,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity,
+    std::optional<float> compactionEpsilon
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid location: %s", reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    // Call the internal implementation to avoid copying the primvar data
+    UsdStageWeakPtr stage = parent.GetStage();
+    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
+    return ::definePolyMeshImpl(
+        stage,
+        path,
+        faceVertexCounts,
+        faceVertexIndices,
+        points,
+        normals,
+        uvs,
+        displayColor,
+        displayOpacity,
+        compactionEpsilon
+    );
+}
+
+UsdGeomMesh usdex::core::definePolyMesh(
+    UsdPrim prim,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity,
+    std::optional<float> compactionEpsilon
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the prim is invalid
+    if (!prim)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid prim");
+        return UsdGeomMesh();
+    }
+
+    // Warn if original prim is not Scope or Xform
+    TfToken originalType = prim.GetTypeName();
+    if (originalType != UsdGeomTokens->Scope && originalType != UsdGeomTokens->Xform && !originalType.IsEmpty())
     {
         TF_WARN(
             "Redefining prim at \"%s\" from type \"%s\" to \"Mesh\". Expected original type to be \"\" or \"Scope\" or \"Xform\".",
@@ -317,8 +1174,906 @@ UsdGeomMesh usdex::core::definePolyMesh(
         );
     }
 
-    // Call the stage/path version
+    // Call the internal implementation to avoid copying the primvar data
     UsdStageWeakPtr stage = prim.GetStage();
     const SdfPath& path = prim.GetPath();
-    return usdex::core::definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity);
+    return ::definePolyMeshImpl(
+        stage,
+        path,
+        faceVertexCounts,
+        faceVertexIndices,
+        points,
+        normals,
+        uvs,
+        displayColor,
+        displayOpacity,
+        compactionEpsilon
+    );
+}
+
+std::vector<UsdGeomMesh> usdex::core::definePolyMeshes(UsdStagePtr stage, const std::vector<PolyMeshDescription>& meshes)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "definePolyMeshes");
+    if (instrumentation.isActive())
+    {
+        for (const PolyMeshDescription& desc : meshes)
+        {
+            instrumentation.addElements(desc.points.size());
+            instrumentation.addArray(desc.faceVertexCounts);
+            instrumentation.addArray(desc.faceVertexIndices);
+            instrumentation.addArray(desc.points);
+            instrumentation.addPrimvar(desc.normals);
+            instrumentation.addPrimvar(desc.uvs);
+            instrumentation.addPrimvar(desc.displayColor);
+            instrumentation.addPrimvar(desc.displayOpacity);
+        }
+    }
+
+    std::vector<UsdGeomMesh> result(meshes.size());
+
+    // Early out if the stage is invalid, as no location could be valid
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMeshes due to an invalid location: Invalid UsdStage.");
+        return result;
+    }
+
+    // Validate all of the locations at once, so that the parent of each location is only looked up once
+    SdfPathVector paths(meshes.size());
+    std::transform(meshes.begin(), meshes.end(), paths.begin(), [](const PolyMeshDescription& desc) { return desc.path; });
+    std::vector<std::string> reasons;
+    const std::vector<bool> locations = ::validateMeshLocations(stage, paths, &reasons);
+
+    // Validate the data of all of the meshes concurrently, with the ValidationPolicy of the calling thread. No opinions are authored during
+    // validation, so the stage is only read. Diagnostics are deferred and emitted from the calling thread so that they are reported in a
+    // deterministic order.
+    const ValidationPolicy policy = usdex::core::getValidationPolicy();
+    std::vector<char> valid(meshes.size(), 0);
+    WorkParallelForN(
+        meshes.size(),
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Validate meshes");
+            usdex::core::ScopedValidationPolicy scopedPolicy(policy);
+            for (size_t i = begin; i < end; ++i)
+            {
+                valid[i] = locations[i] && ::validateMeshDescription(meshes[i], &reasons[i]);
+            }
+        }
+    );
+
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        if (!valid[i])
+        {
+            TF_RUNTIME_ERROR("%s", reasons[i].c_str());
+        }
+    }
+
+    // Define all of the prims with a single round of change processing.
+    // The prim specs are authored directly in the edit target layer as the stage can not recompose while the change block is open.
+    static const TfToken s_meshTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomMesh>();
+    {
+        TRACE_SCOPE("Define mesh prim specs");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < meshes.size(); ++i)
+        {
+            if (valid[i] && !usdex::core::detail::definePrimSpec(stage, meshes[i].path, s_meshTypeName))
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", meshes[i].path.GetAsString().c_str());
+                valid[i] = 0;
+            }
+        }
+    }
+
+    // Author the attributes of all of the meshes with a single round of change processing
+    {
+        TRACE_SCOPE("Author mesh attributes");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < meshes.size(); ++i)
+        {
+            if (!valid[i])
+            {
+                continue;
+            }
+
+            const PolyMeshDescription& desc = meshes[i];
+            UsdGeomMesh mesh(stage->GetPrimAtPath(desc.path));
+            if (!mesh)
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", desc.path.GetAsString().c_str());
+                continue;
+            }
+
+            ::authorMesh(
+                mesh,
+                desc.faceVertexCounts,
+                desc.faceVertexIndices,
+                desc.points,
+                desc.normals,
+                desc.uvs,
+                desc.displayColor,
+                desc.displayOpacity
+            );
+            result[i] = mesh;
+        }
+    }
+
+    return result;
+}
+
+UsdGeomMesh usdex::core::defineDeformingPolyMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const std::vector<UsdTimeCode>& times,
+    const std::vector<VtVec3fArray>& points,
+    const std::vector<Vec3fPrimvarData>& normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the frames are not consistent
+    if (times.empty() || points.size() != times.size() || (!normals.empty() && normals.size() != times.size()))
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdGeomMesh at \"%s\" due to invalid frames: Expected %zu points and 0 or %zu normals arrays but found %zu and %zu",
+            path.GetAsString().c_str(),
+            times.size(),
+            times.size(),
+            points.size(),
+            normals.size()
+        );
+        return UsdGeomMesh();
+    }
+
+    for (const UsdTimeCode& time : times)
+    {
+        if (time.IsDefault())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define UsdGeomMesh at \"%s\" due to invalid frames: The default time code is not valid",
+                path.GetAsString().c_str()
+            );
+            return UsdGeomMesh();
+        }
+    }
+
+    // Validate the location, the topology and the static primvars once, against the first frame
+    std::string reason;
+    const std::optional<const Vec3fPrimvarData> firstNormals = normals.empty() ? std::nullopt : std::make_optional(normals[0]);
+    if (!::validateMesh(stage, path, faceVertexCounts, faceVertexIndices, points[0], firstNormals, uvs, displayColor, displayOpacity, &reason))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    // Validate the remaining frames against the shared topology, with the ValidationPolicy of the calling thread, and compute the extent of
+    // every frame concurrently
+    const ValidationPolicy policy = usdex::core::getValidationPolicy();
+    const size_t numFrames = times.size();
+    std::vector<std::string> reasons(numFrames);
+    std::vector<VtVec3fArray> extents(numFrames);
+    WorkParallelForN(
+        numFrames,
+        [&](size_t begin, size_t end)
+        {
+            static const TfTokenVector s_validInterpolations = { UsdGeomTokens->uniform, UsdGeomTokens->vertex, UsdGeomTokens->faceVarying };
+            usdex::core::ScopedValidationPolicy scopedPolicy(policy);
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (points[i].size() != points[0].size())
+                {
+                    reasons[i] = TfStringPrintf("Expected %zu points but found %zu", points[0].size(), points[i].size());
+                    continue;
+                }
+
+                if (!normals.empty())
+                {
+                    const Vec3fPrimvarData& frameNormals = normals[i];
+                    std::string primvarReason;
+                    if (!::validatePrimvar(frameNormals, s_validInterpolations, faceVertexCounts, faceVertexIndices, points[i], &primvarReason))
+                    {
+                        reasons[i] = TfStringPrintf("Invalid normals: %s", primvarReason.c_str());
+                        continue;
+                    }
+
+                    // The interpolation, indexing and element size are not time varying, so they must match on every frame
+                    if (frameNormals.interpolation() != normals[0].interpolation() || frameNormals.hasIndices() != normals[0].hasIndices() ||
+                        frameNormals.elementSize() != normals[0].elementSize())
+                    {
+                        reasons[i] = "The normals interpolation, indexing and element size must match the first frame";
+                        continue;
+                    }
+                }
+
+                extents[i] = detail::computeExtent(points[i]);
+            }
+        }
+    );
+
+    for (size_t i = 0; i < numFrames; ++i)
+    {
+        if (!reasons[i].empty())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define UsdGeomMesh at \"%s\" due to an invalid frame at time %f: %s",
+                path.GetAsString().c_str(),
+                times[i].GetValue(),
+                reasons[i].c_str()
+            );
+            return UsdGeomMesh();
+        }
+    }
+
+    // Define the Mesh and check that this was successful
+    UsdGeomMesh mesh = usdex::core::detail::definePrim<UsdGeomMesh>(stage, path);
+    if (!mesh)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+        return UsdGeomMesh();
+    }
+
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
+
+    // Author the shared topology and static primvars
+    ::authorMeshTopology(mesh, faceVertexCounts, faceVertexIndices);
+    ::authorMeshPrimvars(mesh, std::nullopt, uvs, displayColor, displayOpacity);
+
+    // Create the time varying attributes so that their samples can be authored directly to the layer
+    UsdAttribute pointsAttr = mesh.CreatePointsAttr();
+    UsdAttribute extentAttr = mesh.CreateExtentAttr();
+    UsdAttribute normalsAttr;
+    UsdAttribute normalsIndicesAttr;
+    if (!normals.empty())
+    {
+        UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(UsdGeomTokens->normals, SdfValueTypeNames->Normal3fArray);
+        primvar.SetInterpolation(normals[0].interpolation());
+        if (normals[0].elementSize() > 0)
+        {
+            primvar.SetElementSize(normals[0].elementSize());
+        }
+        else if (primvar.HasAuthoredElementSize())
+        {
+            primvar.SetElementSize(1);
+        }
+
+        normalsAttr = primvar.GetAttr();
+        if (normals[0].hasIndices())
+        {
+            normalsIndicesAttr = primvar.CreateIndicesAttr();
+        }
+        else
+        {
+            primvar.BlockIndices();
+        }
+    }
+
+    // Author all of the time samples with a single round of change processing
+    bool success = true;
+    {
+        SdfChangeBlock changeBlock;
+        success &= detail::setTimeSamples(
+            pointsAttr,
+            times,
+            [&points](size_t i) -> const VtVec3fArray&
+            {
+                return points[i];
+            }
+        );
+        success &= detail::setTimeSamples(
+            extentAttr,
+            times,
+            [&extents](size_t i) -> const VtVec3fArray&
+            {
+                return extents[i];
+            }
+        );
+        if (normalsAttr)
+        {
+            success &= detail::setTimeSamples(
+                normalsAttr,
+                times,
+                [&normals](size_t i) -> const VtVec3fArray&
+                {
+                    return normals[i].values();
+                }
+            );
+        }
+        if (normalsIndicesAttr)
+        {
+            success &= detail::setTimeSamples(
+                normalsIndicesAttr,
+                times,
+                [&normals](size_t i) -> const VtIntArray&
+                {
+                    return normals[i].indices();
+                }
+            );
+        }
+    }
+
+    if (!success)
+    {
+        TF_WARN("Failed to set time samples for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+    }
+
+    return mesh;
+}
+
+bool usdex::core::updatePolyMesh(
+    UsdGeomMesh mesh,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the mesh is not valid
+    if (!mesh)
+    {
+        TF_RUNTIME_ERROR("Unable to update UsdGeomMesh due to an invalid mesh");
+        return false;
+    }
+
+    // Early out if the location or any of the mesh data is invalid
+    UsdPrim prim = mesh.GetPrim();
+    std::string reason;
+    const SdfPath& path = prim.GetPath();
+    if (!::validateMesh(prim.GetStage(), path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity, &reason))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return false;
+    }
+
+    // Determine which of the primvars differ before authoring anything, so that the comparisons read a consistent state
+    UsdGeomPrimvarsAPI primvarsApi(prim);
+    const std::optional<const Vec3fPrimvarData> changedNormals = ::changedPrimvar(primvarsApi.GetPrimvar(UsdGeomTokens->normals), normals);
+    const std::optional<const Vec2fPrimvarData> changedUvs = ::changedPrimvar(primvarsApi.GetPrimvar(UsdUtilsGetPrimaryUVSetName()), uvs);
+    const std::optional<const Vec3fPrimvarData> changedDisplayColor = ::changedPrimvar(mesh.GetDisplayColorPrimvar(), displayColor);
+    const std::optional<const FloatPrimvarData> changedDisplayOpacity = ::changedPrimvar(mesh.GetDisplayOpacityPrimvar(), displayOpacity);
+
+    // Author only the attributes which have changed, with a single round of change processing
+    {
+        SdfChangeBlock changeBlock;
+
+        // Attributes are only created when a value needs to be authored, so that unchanged attributes do not gain a spec in the edit target
+        if (!::isCurrentValue(mesh.GetOrientationAttr(), UsdGeomTokens->rightHanded))
+        {
+            mesh.CreateOrientationAttr().Set(UsdGeomTokens->rightHanded);
+        }
+        if (!::isCurrentValue(mesh.GetSubdivisionSchemeAttr(), UsdGeomTokens->none))
+        {
+            mesh.CreateSubdivisionSchemeAttr().Set(UsdGeomTokens->none);
+        }
+        if (!::isCurrentValue(mesh.GetFaceVertexCountsAttr(), faceVertexCounts))
+        {
+            mesh.CreateFaceVertexCountsAttr().Set(faceVertexCounts);
+        }
+        if (!::isCurrentValue(mesh.GetFaceVertexIndicesAttr(), faceVertexIndices))
+        {
+            mesh.CreateFaceVertexIndicesAttr().Set(faceVertexIndices);
+        }
+
+        // The extent only needs to be recomputed if the points have changed, or if it was never authored
+        const bool pointsChanged = !::isCurrentValue(mesh.GetPointsAttr(), points);
+        if (pointsChanged)
+        {
+            mesh.CreatePointsAttr().Set(points);
+        }
+        if (pointsChanged || !mesh.GetExtentAttr().HasAuthoredValue())
+        {
+            const VtVec3fArray extent = detail::computeExtent(points);
+            if (!::isCurrentValue(mesh.GetExtentAttr(), extent))
+            {
+                mesh.CreateExtentAttr().Set(extent);
+            }
+        }
+
+        ::authorMeshPrimvars(mesh, changedNormals, changedUvs, changedDisplayColor, changedDisplayOpacity);
+    }
+
+    return true;
+}
+
+bool usdex::core::compactFaceVaryingPrimvar(Vec3fPrimvarData& primvar, const VtIntArray& faceVertexIndices, size_t numPoints, float epsilon)
+{
+    TRACE_FUNCTION();
+
+    return ::compactFaceVaryingPrimvarImpl(primvar, faceVertexIndices, numPoints, epsilon);
+}
+
+bool usdex::core::compactFaceVaryingPrimvar(Vec2fPrimvarData& primvar, const VtIntArray& faceVertexIndices, size_t numPoints, float epsilon)
+{
+    TRACE_FUNCTION();
+
+    return ::compactFaceVaryingPrimvarImpl(primvar, faceVertexIndices, numPoints, epsilon);
+}
+
+class usdex::core::MeshLibrary::MeshLibraryImpl
+{
+
+public:
+
+    MeshLibraryImpl(UsdStagePtr libraryStage, bool instanceable) : libraryStage(libraryStage), instanceable(instanceable)
+    {
+    }
+
+    //! A unique mesh and the library prim which holds it
+    struct Entry
+    {
+        PolyMeshDescription mesh;
+        UsdPrim prim;
+    };
+
+    UsdStagePtr libraryStage;
+    bool instanceable;
+    NameCache nameCache;
+
+    // The unique meshes keyed by content hash. Meshes with colliding hashes are disambiguated by comparing their content.
+    std::unordered_multimap<size_t, Entry> entries;
+    size_t useCount = 0;
+};
+
+usdex::core::MeshLibrary::MeshLibrary(UsdStagePtr libraryStage, bool instanceable)
+{
+    m_impl = new MeshLibraryImpl(libraryStage, instanceable);
+}
+
+usdex::core::MeshLibrary::~MeshLibrary()
+{
+    delete m_impl;
+}
+
+UsdPrim usdex::core::MeshLibrary::definePolyMesh(UsdStagePtr stage, const PolyMeshDescription& mesh)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "MeshLibrary::definePolyMesh");
+    instrumentation.addElements(mesh.points.size());
+
+    // Early out if the proposed prim location is invalid, so that no library mesh is defined for it
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, mesh.path, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define library mesh reference due to an invalid location: %s", reason.c_str());
+        return UsdPrim();
+    }
+
+    UsdPrim libraryRoot = m_impl->libraryStage ? m_impl->libraryStage->GetDefaultPrim() : UsdPrim();
+    if (!libraryRoot)
+    {
+        TF_RUNTIME_ERROR("Unable to define library mesh due to an invalid library stage: The stage must have a default prim");
+        return UsdPrim();
+    }
+
+    const size_t hash = ::hashMesh(mesh);
+    UsdPrim source;
+    const auto [begin, end] = m_impl->entries.equal_range(hash);
+    for (auto it = begin; it != end; ++it)
+    {
+        if (::meshesEqual(it->second.mesh, mesh))
+        {
+            source = it->second.prim;
+            break;
+        }
+    }
+
+    // Define the first instance of each unique mesh in the library
+    if (!source)
+    {
+        const TfToken name = m_impl->nameCache.getPrimName(libraryRoot, mesh.path.GetName());
+        UsdGeomXform xform = usdex::core::defineXform(libraryRoot, name.GetString());
+        if (!xform)
+        {
+            return UsdPrim();
+        }
+
+        UsdGeomMesh libraryMesh = usdex::core::definePolyMesh(
+            xform.GetPrim(),
+            "Mesh",
+            mesh.faceVertexCounts,
+            mesh.faceVertexIndices,
+            mesh.points,
+            mesh.normals,
+            mesh.uvs,
+            mesh.displayColor,
+            mesh.displayOpacity
+        );
+        if (!libraryMesh)
+        {
+            m_impl->libraryStage->RemovePrim(xform.GetPath());
+            return UsdPrim();
+        }
+
+        source = xform.GetPrim();
+        m_impl->entries.emplace(hash, MeshLibraryImpl::Entry{ mesh, source });
+    }
+
+    UsdPrim prim = usdex::core::defineReference(stage, mesh.path, source);
+    if (!prim)
+    {
+        return UsdPrim();
+    }
+
+    if (m_impl->instanceable)
+    {
+        prim.SetInstanceable(true);
+    }
+    m_impl->useCount++;
+
+    return prim;
+}
+
+size_t usdex::core::MeshLibrary::getUniqueMeshCount() const
+{
+    return m_impl->entries.size();
+}
+
+size_t usdex::core::MeshLibrary::getUseCount() const
+{
+    return m_impl->useCount;
+}
+
+std::optional<PolyMeshDescription> usdex::core::simplifyPolyMesh(const PolyMeshDescription& mesh, float ratio)
+{
+    TRACE_FUNCTION();
+
+    std::string reason;
+    PolyMeshDescription result;
+    if (!::validateSimplification(mesh, ratio, &reason) || !::simplifyValidMesh(mesh, ratio, result, &reason))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return std::nullopt;
+    }
+    return result;
+}
+
+std::vector<UsdGeomMesh> usdex::core::definePolyMeshLods(
+    UsdStagePtr stage,
+    const std::vector<PolyMeshDescription>& meshes,
+    const std::vector<float>& ratios,
+    MeshLodStyle style
+)
+{
+    TRACE_FUNCTION();
+
+    std::vector<UsdGeomMesh> result(meshes.size());
+
+    // Early out if the stage is invalid, as no location could be valid
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh LODs due to an invalid location: Invalid UsdStage.");
+        return result;
+    }
+
+    // Early out if the LODs can not be described
+    if (ratios.empty())
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh LODs as no ratios were provided");
+        return result;
+    }
+    if (style == MeshLodStyle::ePurpose && ratios.size() != 1)
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdGeomMesh LODs by purpose as only one proxy can be authored, but %zu ratios were provided",
+            ratios.size()
+        );
+        return result;
+    }
+    for (float ratio : ratios)
+    {
+        if (!::isValidLodRatio(ratio))
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define UsdGeomMesh LODs due to an invalid ratio: %g. Each ratio must be greater than 0 and at most 1.",
+                ratio
+            );
+            return result;
+        }
+    }
+
+    // Validate all of the locations at once, so that the parent of each location is only looked up once
+    SdfPathVector paths(meshes.size());
+    std::transform(meshes.begin(), meshes.end(), paths.begin(), [](const PolyMeshDescription& desc) { return desc.path; });
+    std::vector<std::string> reasons;
+    const std::vector<bool> locations = ::validateMeshLocations(stage, paths, &reasons);
+    std::vector<bool> proxyLocations(meshes.size(), true);
+    std::vector<std::string> proxyReasons(meshes.size());
+    if (style == MeshLodStyle::ePurpose)
+    {
+        std::transform(paths.begin(), paths.end(), paths.begin(), &::getProxyPath);
+        proxyLocations = usdex::core::areEditablePrimLocations(stage, paths, &proxyReasons);
+    }
+
+    // Validate the data of all of the meshes concurrently. No opinions are authored during validation, so the stage is only read.
+    // The contents of the arrays are always validated, regardless of the ValidationPolicy, as the simplification requires valid topology.
+    std::vector<char> valid(meshes.size(), 0);
+    WorkParallelForN(
+        meshes.size(),
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Validate meshes");
+            usdex::core::ScopedValidationPolicy policy(ValidationPolicy::eFull);
+            for (size_t i = begin; i < end; ++i)
+            {
+                valid[i] = locations[i] && ::validateMeshDescription(meshes[i], &reasons[i]);
+                if (valid[i] && !proxyLocations[i])
+                {
+                    reasons[i] = TfStringPrintf("Unable to define UsdGeomMesh proxy due to an invalid location: %s", proxyReasons[i].c_str());
+                    valid[i] = 0;
+                }
+            }
+        }
+    );
+
+    // Simplify every LOD of every valid mesh concurrently. Each LOD is a substantial amount of work, so each is its own task.
+    const size_t numLods = ratios.size();
+    std::vector<PolyMeshDescription> lods(meshes.size() * numLods);
+    std::vector<char> simplified(lods.size(), 0);
+    std::vector<std::string> lodReasons(lods.size());
+    WorkParallelForN(
+        lods.size(),
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Simplify meshes");
+            for (size_t i = begin; i < end; ++i)
+            {
+                const size_t mesh = i / numLods;
+                if (valid[mesh])
+                {
+                    simplified[i] = ::simplifyValidMesh(meshes[mesh], ratios[i % numLods], lods[i], &lodReasons[i]);
+                }
+            }
+        },
+        1
+    );
+
+    // Diagnostics are emitted from the calling thread so that they are reported in a deterministic order
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        if (!valid[i])
+        {
+            TF_RUNTIME_ERROR("%s", reasons[i].c_str());
+            continue;
+        }
+        for (size_t lod = 0; lod < numLods; ++lod)
+        {
+            if (!simplified[i * numLods + lod])
+            {
+                TF_RUNTIME_ERROR("%s", lodReasons[i * numLods + lod].c_str());
+                valid[i] = 0;
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        if (!valid[i])
+        {
+            continue;
+        }
+
+        const PolyMeshDescription& desc = meshes[i];
+        UsdGeomMesh mesh = usdex::core::detail::definePrim<UsdGeomMesh>(stage, desc.path);
+        if (!mesh)
+        {
+            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", desc.path.GetAsString().c_str());
+            continue;
+        }
+
+        if (style == MeshLodStyle::ePurpose)
+        {
+            const SdfPath proxyPath = ::getProxyPath(desc.path);
+            UsdGeomMesh proxy = usdex::core::detail::definePrim<UsdGeomMesh>(stage, proxyPath);
+            if (!proxy)
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", proxyPath.GetAsString().c_str());
+                continue;
+            }
+
+            usdex::core::detail::AuthoringChangeBlock authoringBlock;
+            ::authorMesh(
+                mesh,
+                desc.faceVertexCounts,
+                desc.faceVertexIndices,
+                desc.points,
+                desc.normals,
+                desc.uvs,
+                desc.displayColor,
+                desc.displayOpacity
+            );
+            const PolyMeshDescription& lod = lods[i];
+            ::authorMesh(proxy, lod.faceVertexCounts, lod.faceVertexIndices, lod.points, lod.normals, lod.uvs, lod.displayColor, lod.displayOpacity);
+            mesh.CreatePurposeAttr().Set(UsdGeomTokens->render);
+            proxy.CreatePurposeAttr().Set(UsdGeomTokens->proxy);
+            mesh.SetProxyPrim(proxy.GetPrim());
+            result[i] = mesh;
+            continue;
+        }
+
+        // Each LOD is authored within its own variant. The variant must be selected in order to author within it.
+        UsdVariantSet variantSet = mesh.GetPrim().GetVariantSets().AddVariantSet(usdex::core::getLodToken());
+        if (!variantSet)
+        {
+            TF_RUNTIME_ERROR("Unable to define the LOD variant set of the UsdGeomMesh at \"%s\"", desc.path.GetAsString().c_str());
+            continue;
+        }
+        for (size_t lod = 0; lod <= numLods; ++lod)
+        {
+            const std::string variant = TfStringPrintf("LOD%zu", lod);
+            variantSet.AddVariant(variant);
+            variantSet.SetVariantSelection(variant);
+
+            UsdEditContext context(variantSet.GetVariantEditContext());
+            usdex::core::detail::AuthoringChangeBlock authoringBlock;
+            const PolyMeshDescription& data = (lod == 0) ? desc : lods[i * numLods + lod - 1];
+            ::authorMesh(
+                mesh,
+                data.faceVertexCounts,
+                data.faceVertexIndices,
+                data.points,
+                data.normals,
+                data.uvs,
+                data.displayColor,
+                data.displayOpacity
+            );
+        }
+        variantSet.SetVariantSelection("LOD0");
+        result[i] = mesh;
+    }
+
+    return result;
+}
+
+std::vector<UsdGeomSubset> usdex::core::defineMaterialSubsets(
+    UsdGeomMesh mesh,
+    const VtIntArray& faceMaterialIds,
+    const std::vector<UsdShadeMaterial>& materials
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "defineMaterialSubsets");
+    instrumentation.addElements(faceMaterialIds.size());
+    instrumentation.addArray(faceMaterialIds);
+
+    if (!mesh)
+    {
+        TF_RUNTIME_ERROR("Unable to define material subsets due to an invalid UsdGeomMesh <%s>", mesh.GetPath().GetAsString().c_str());
+        return {};
+    }
+
+    const std::string meshPath = mesh.GetPath().GetAsString();
+    VtIntArray faceVertexCounts;
+    mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+    if (faceVertexCounts.size() != faceMaterialIds.size())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define material subsets of UsdGeomMesh <%s> due to mismatched material ids: %zu faces and %zu material ids",
+            meshPath.c_str(),
+            faceVertexCounts.size(),
+            faceMaterialIds.size()
+        );
+        return {};
+    }
+
+    std::vector<VtIntArray> partitions;
+    if (!::partitionFaces(faceMaterialIds, materials.size(), partitions))
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define material subsets of UsdGeomMesh <%s> due to invalid material ids: ids must be less than the number of materials (%zu)",
+            meshPath.c_str(),
+            materials.size()
+        );
+        return {};
+    }
+
+    // Only the materials which are assigned to a face have a subset
+    std::vector<size_t> assigned;
+    std::vector<std::string> names;
+    size_t numAssignedFaces = 0;
+    for (size_t i = 0; i < materials.size(); ++i)
+    {
+        if (partitions[i].empty())
+        {
+            continue;
+        }
+        if (!materials[i])
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define material subsets of UsdGeomMesh <%s> due to an invalid UsdShadeMaterial <%s> at index %zu",
+                meshPath.c_str(),
+                materials[i].GetPath().GetAsString().c_str(),
+                i
+            );
+            return {};
+        }
+        assigned.push_back(i);
+        names.push_back(materials[i].GetPrim().GetName().GetString());
+        numAssignedFaces += partitions[i].size();
+    }
+
+    std::vector<UsdGeomSubset> result(materials.size());
+    if (assigned.empty())
+    {
+        return result;
+    }
+
+    UsdPrim prim = mesh.GetPrim();
+    const TfTokenVector validNames = usdex::core::getValidChildNames(prim, names);
+    std::vector<std::string> reasons;
+    const std::vector<bool> editable = usdex::core::areEditablePrimLocations(prim, TfToStringVector(validNames), &reasons);
+    for (size_t i = 0; i < editable.size(); ++i)
+    {
+        if (!editable[i])
+        {
+            TF_RUNTIME_ERROR("Unable to define UsdGeomSubset due to an invalid location: %s", reasons[i].c_str());
+            return {};
+        }
+    }
+
+    // Define all of the prims with a single round of change processing.
+    // The prim specs are authored directly in the edit target layer as the stage can not recompose while the change block is open.
+    static const TfToken s_subsetTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomSubset>();
+    UsdStagePtr stage = prim.GetStage();
+    SdfPathVector paths;
+    paths.reserve(validNames.size());
+    {
+        TRACE_SCOPE("Define subset prim specs");
+        SdfChangeBlock changeBlock;
+        for (const TfToken& name : validNames)
+        {
+            paths.push_back(prim.GetPath().AppendChild(name));
+            if (!usdex::core::detail::definePrimSpec(stage, paths.back(), s_subsetTypeName))
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomSubset at \"%s\"", paths.back().GetAsString().c_str());
+                return {};
+            }
+        }
+    }
+
+    // Author the attributes of all of the subsets, and the family type of the mesh, with a single round of change processing
+    std::vector<UsdPrim> subsetPrims;
+    std::vector<UsdShadeMaterial> subsetMaterials;
+    {
+        TRACE_SCOPE("Author subset attributes");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < assigned.size(); ++i)
+        {
+            UsdGeomSubset subset(stage->GetPrimAtPath(paths[i]));
+            if (!subset)
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomSubset at \"%s\"", paths[i].GetAsString().c_str());
+                return {};
+            }
+            subset.CreateElementTypeAttr().Set(UsdGeomTokens->face);
+            subset.CreateFamilyNameAttr().Set(UsdShadeTokens->materialBind);
+            subset.CreateIndicesAttr().Set(partitions[assigned[i]]);
+            result[assigned[i]] = subset;
+            subsetPrims.push_back(subset.GetPrim());
+            subsetMaterials.push_back(materials[assigned[i]]);
+        }
+
+        const TfToken& familyType = (numAssignedFaces == faceMaterialIds.size()) ? UsdGeomTokens->partition : UsdGeomTokens->nonOverlapping;
+        UsdGeomSubset::SetFamilyType(mesh, UsdShadeTokens->materialBind, familyType);
+    }
+
+    if (!usdex::core::bindMaterials(subsetPrims, subsetMaterials))
+    {
+        TF_RUNTIME_ERROR("Unable to bind the materials of the UsdGeomSubsets of UsdGeomMesh <%s>", meshPath.c_str());
+        return {};
+    }
+
+    return result;
 }
@@ -4,14 +4,33 @@
 
 #include "usdex/core/NameAlgo.h"
 
+#include "InstrumentationUtils.h"
 #include "TfUtils.h"
+#include "Transcoding.h"
 
+#include <pxr/base/tf/stl.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/vt/dictionary.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/childrenView.h>
 #include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/sdf/spec.h>
-
-#include <functional>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 using namespace pxr;
 
@@ -21,19 +40,199 @@ namespace
 #if defined(ARCH_OS_WINDOWS) && PXR_VERSION < 2405
 #pragma warning(push)
 #pragma warning(disable : 4003) // not enough arguments for function-like macro invocation
-TF_DEFINE_PRIVATE_TOKENS(_tokens, (error));
+TF_DEFINE_PRIVATE_TOKENS(_tokens, (error)(version)(primNames)(propertyNames)(usedNames)(suffixNames)(suffixIndices));
 #pragma warning(pop)
 #else
-TF_DEFINE_PRIVATE_TOKENS(_tokens, (error));
+TF_DEFINE_PRIVATE_TOKENS(_tokens, (error)(version)(primNames)(propertyNames)(usedNames)(suffixNames)(suffixIndices));
 #endif
 
+// The version of the NameCache snapshot format written by exportSnapshot
+static constexpr int64_t s_snapshotVersion = 1;
+
+// Vectors of names are decoded in chunks of this many names, vectors smaller than this are decoded serially
+static constexpr size_t s_decodeGrainSize = 4096;
+
+// Vectors of prims have their display names read in chunks of this many prims, vectors smaller than this are read serially
+static constexpr size_t s_displayNameGrainSize = 1024;
+
+// Names produced by the Bootstring algorithm all start with this prefix
+static constexpr std::string_view s_transcodedPrefix = "tn__";
+
+// A compact table of names and associated values, which can be queried by string without constructing a token for the query.
+//
+// Names are held as tokens, so their strings are shared with the token registry (and with any other cache entries holding the same names) rather
+// than copied. Items are stored contiguously and searched linearly while the table is small, which suits the many parents which only have a few
+// children. Larger tables add an open addressing index of the items. Items are never removed individually.
+template <typename Value>
+class NameTable
+{
+public:
+
+    size_t size() const
+    {
+        return m_items.size();
+    }
+
+    // Reserve space for at least `count` items, growing geometrically so that repeated small reservations do not reallocate each time
+    void reserve(size_t count)
+    {
+        if (count > m_items.capacity())
+        {
+            m_items.reserve(std::max(count, m_items.capacity() * 2));
+        }
+        if (count > s_maxLinearSize)
+        {
+            rehash(count);
+        }
+    }
+
+    bool contains(std::string_view name) const
+    {
+        return findIndex(name, hash(name)) != s_npos;
+    }
+
+    // Insert a name with a default value, unless it is already present. Returns the value for the name.
+    Value& insert(const TfToken& name)
+    {
+        const size_t nameHash = hash(name.GetString());
+        const size_t index = findIndex(name.GetString(), nameHash);
+        return (index != s_npos) ? m_items[index].value : append(name, nameHash);
+    }
+
+    // As above, but only constructs a token if the name is not already present
+    Value& insert(const std::string& name)
+    {
+        const size_t nameHash = hash(name);
+        const size_t index = findIndex(name, nameHash);
+        return (index != s_npos) ? m_items[index].value : append(TfToken(name), nameHash);
+    }
+
+    // Call `fn(name, value)` for each item in insertion order
+    template <typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        for (const Item& item : m_items)
+        {
+            fn(item.name, item.value);
+        }
+    }
+
+    // The number of bytes allocated by the table, excluding the strings of the names which are held by the token registry
+    size_t memoryUsage() const
+    {
+        return m_items.capacity() * sizeof(Item) + m_index.capacity() * sizeof(uint32_t);
+    }
+
+private:
+
+    static constexpr size_t s_npos = std::numeric_limits<size_t>::max();
+    static constexpr size_t s_maxLinearSize = 16;
+
+    struct Item
+    {
+        size_t hash;
+        TfToken name;
+        Value value;
+    };
+
+    static size_t hash(std::string_view name)
+    {
+        return std::hash<std::string_view>()(name);
+    }
+
+    size_t findIndex(std::string_view name, size_t nameHash) const
+    {
+        if (m_index.empty())
+        {
+            for (size_t i = 0; i < m_items.size(); ++i)
+            {
+                if (m_items[i].hash == nameHash && m_items[i].name.GetString() == name)
+                {
+                    return i;
+                }
+            }
+            return s_npos;
+        }
+
+        const size_t mask = m_index.size() - 1;
+        for (size_t slot = nameHash & mask; m_index[slot] != 0; slot = (slot + 1) & mask)
+        {
+            const Item& item = m_items[m_index[slot] - 1];
+            if (item.hash == nameHash && item.name.GetString() == name)
+            {
+                return m_index[slot] - 1;
+            }
+        }
+        return s_npos;
+    }
+
+    Value& append(const TfToken& name, size_t nameHash)
+    {
+        m_items.push_back(Item{ nameHash, name, Value() });
+        if (m_items.size() * 2 > m_index.size() && m_items.size() > s_maxLinearSize)
+        {
+            rehash(m_items.size());
+        }
+        else if (!m_index.empty())
+        {
+            place(m_items.size() - 1);
+        }
+        return m_items.back().value;
+    }
+
+    // Rebuild the index with enough slots to keep it at most half full with `count` items
+    void rehash(size_t count)
+    {
+        size_t numSlots = s_maxLinearSize * 2;
+        while (numSlots < count * 2)
+        {
+            numSlots *= 2;
+        }
+        if (numSlots <= m_index.size())
+        {
+            return;
+        }
+
+        m_index.assign(numSlots, 0);
+        for (size_t i = 0; i < m_items.size(); ++i)
+        {
+            place(i);
+        }
+    }
+
+    // Add an item to the index. Slots hold the item index plus one, so that zero represents an empty slot.
+    void place(size_t index)
+    {
+        const size_t mask = m_index.size() - 1;
+        size_t slot = m_items[index].hash & mask;
+        while (m_index[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        m_index[slot] = static_cast<uint32_t>(index + 1);
+    }
+
+    std::vector<Item> m_items;
+    std::vector<uint32_t> m_index;
+};
+
+// NameTable does not need a value when used as a set
+struct NoValue
+{
+};
+
 struct ValidNameCache
 {
     //! Names that can not be allocated
-    TfTokenVector usedNames;
+    NameTable<NoValue> usedNames;
 
-    // The start index to be used for making a given name unique
-    std::unordered_map<std::string, size_t> startIndices;
+    // The start index to be used for making a given name unique, keyed by the original name
+    NameTable<size_t> startIndices;
+
+    size_t memoryUsage() const
+    {
+        return sizeof(ValidNameCache) + usedNames.memoryUsage() + startIndices.memoryUsage();
+    }
 };
 
 void reserveNames(ValidNameCache& cache, const TfTokenVector& names)
@@ -41,7 +240,7 @@ void reserveNames(ValidNameCache& cache, const TfTokenVector& names)
     cache.usedNames.reserve(cache.usedNames.size() + names.size());
     for (const TfToken& name : names)
     {
-        cache.usedNames.push_back(name);
+        cache.usedNames.insert(name);
     }
 }
 
@@ -85,12 +284,77 @@ void reserveChildPropertyNames(ValidNameCache& cache, const SdfPrimSpecHandle pa
     reserveNames(cache, names);
 }
 
-TfTokenVector getValidNames(
-    const std::vector<std::string>& names,
-    std::function<const std::string(const std::string&)> getValidNameFunc,
-    ValidNameCache& cache
-)
+// Make each namespace of a property name a valid identifier
+std::string makeValidPropertyName(const std::string& name)
+{
+    // Split the name based on the ":" delimiter
+    std::vector<std::string> tokens = TfStringSplit(name, ":");
+
+    // Add an empty token if the original name produced no tokens.
+    // This is most likely to occur if the incoming name was empty.
+    if (tokens.empty())
+    {
+        tokens.push_back("");
+    }
+
+    // Make each token a valid identifier using bootstring encoding
+    std::vector<std::string> validTokens;
+    validTokens.reserve(tokens.size());
+    for (const std::string& token : tokens)
+    {
+        validTokens.push_back(usdex::core::detail::makeValidIdentifier(token));
+    }
+
+    // Join the namespaces again using the ":" delimiter
+    return TfStringJoin(validTokens, ":");
+}
+
+// Validators used by getValidNames. Each writes the valid form of a name into a buffer which is reused between calls.
+struct PrimNameValidator
+{
+    void operator()(const std::string& name, std::string& validName) const
+    {
+        if (usdex::core::detail::isValidIdentifier(name))
+        {
+            validName.assign(name);
+        }
+        else
+        {
+            validName = usdex::core::detail::makeValidIdentifier(name);
+        }
+    }
+};
+
+struct PropertyNameValidator
+{
+    void operator()(const std::string& name, std::string& validName) const
+    {
+        if (usdex::core::detail::isValidNamespacedIdentifier(name))
+        {
+            validName.assign(name);
+        }
+        else
+        {
+            validName = ::makeValidPropertyName(name);
+        }
+    }
+};
+
+// Write "<name>_<index>" into a buffer which is reused between calls
+void buildSuffixedName(const std::string& name, size_t index, std::string& suffixedName)
 {
+    char digits[24];
+    const std::to_chars_result end = std::to_chars(std::begin(digits), std::end(digits), index);
+    suffixedName.assign(name);
+    suffixedName.push_back('_');
+    suffixedName.append(digits, end.ptr);
+}
+
+template <typename Validator>
+TfTokenVector getValidNames(const std::vector<std::string>& names, const Validator& validator, ValidNameCache& cache)
+{
+    TRACE_FUNCTION();
+
     // Early exist if no names given.
     if (names.empty())
     {
@@ -100,62 +364,461 @@ TfTokenVector getValidNames(
     // Construct an appropriately sized vector to hold resulting names
     TfTokenVector result;
     result.reserve(names.size());
+    cache.usedNames.reserve(cache.usedNames.size() + names.size());
 
-    // When requesting large amounts of child paths for the same base name cache the index so that names are not considered multiple times
-    std::unordered_map<std::string, size_t> startIndices;
+    // Count the occurrences of each of the supplied names that are yet to be allocated, so that suffixed names can avoid them in constant time
+    std::unordered_map<std::string, size_t> pendingNames;
+    pendingNames.reserve(names.size());
+    for (const std::string& name : names)
+    {
+        ++pendingNames[name];
+    }
 
+    // Buffers reused for every candidate name, so that no allocation is required unless a candidate outgrows them
+    std::string validName;
+    std::string name;
+    std::string suffixedName;
     for (size_t nameIndex = 0; nameIndex < names.size(); ++nameIndex)
     {
         // Keep the original name
         const std::string& originalName = names[nameIndex];
 
+        // The current name is no longer pending, so only the names after it are considered when avoiding supplied names
+        auto pendingIt = pendingNames.find(originalName);
+        if (--pendingIt->second == 0)
+        {
+            pendingNames.erase(pendingIt);
+        }
+
         // Make the name valid before checking uniqueness
-        const std::string validName = getValidNameFunc(originalName);
+        validator(originalName, validName);
 
         // Check if the valid name is already used. Increment a numeric suffix on the original name until an available one is found
-        std::string name = validName;
+        // Candidates are only tokenized once they are known to be unique
+        name.assign(validName);
+        size_t* index = nullptr;
         while (true)
         {
-            const TfToken& nameToken = TfToken(name);
-            if (std::find(cache.usedNames.begin(), cache.usedNames.end(), nameToken) == cache.usedNames.end())
+            if (!cache.usedNames.contains(name))
             {
                 // Avoid allocating suffixed names that exist in the list of supplied names
                 // This increases the number of cases where the requested name is returned unchanged
-                if (name == validName || std::find(names.begin() + nameIndex + 1, names.end(), name) == names.end())
+                if (name == validName || pendingNames.find(name) == pendingNames.end())
                 {
-                    result.push_back(nameToken);
-                    cache.usedNames.push_back(nameToken);
+                    TfToken nameToken(name);
+                    cache.usedNames.insert(nameToken);
+                    result.push_back(std::move(nameToken));
                     break;
                 }
             }
 
             // Get the latest index for this name and build a new name.
-            size_t& index = cache.startIndices[originalName];
+            if (!index)
+            {
+                index = &cache.startIndices.insert(originalName);
+            }
 
-            index++;
-            name = getValidNameFunc(TfStringPrintf("%s_%zu", originalName.c_str(), index));
+            ++(*index);
+            ::buildSuffixedName(originalName, *index, suffixedName);
+            validator(suffixedName, name);
         }
     }
 
     return result;
 }
 
+// A ValidNameCache along with the mutex which guards it
+struct ConcurrentNameCacheEntry
+{
+    std::mutex mutex;
+    ValidNameCache cache;
+};
+
+// A collection of ValidNameCache entries keyed by parent path, which is safe to access from multiple threads.
+//
+// The entries are distributed across shards by the hash of the parent path, and each shard is guarded by its own mutex which is only held while
+// finding, inserting, or erasing an entry. Each entry is then guarded by its own mutex while names are generated, so requests for different
+// parents proceed concurrently, while requests for the same parent are serialized and generate names in a deterministic order.
+class ConcurrentNameCaches
+{
+public:
+
+    // Exclusive access to the entry for a parent.
+    // The entry is kept alive by the lock, even if it is erased from the collection concurrently.
+    class LockedEntry
+    {
+    public:
+
+        LockedEntry(std::shared_ptr<ConcurrentNameCacheEntry> entry, bool inserted)
+            : m_entry(std::move(entry)), m_lock(m_entry->mutex), m_inserted(inserted)
+        {
+        }
+
+        ValidNameCache& cache()
+        {
+            return m_entry->cache;
+        }
+
+        // Whether the entry was created when this lock was acquired
+        bool inserted() const
+        {
+            return m_inserted;
+        }
+
+    private:
+
+        std::shared_ptr<ConcurrentNameCacheEntry> m_entry;
+        std::unique_lock<std::mutex> m_lock;
+        bool m_inserted;
+    };
+
+    // Acquire exclusive access to the entry for a parent, creating an empty entry if there is none
+    LockedEntry lock(const SdfPath& parent)
+    {
+        Shard& shard = getShard(parent);
+        std::shared_ptr<ConcurrentNameCacheEntry> entry;
+        bool inserted = false;
+        {
+            std::lock_guard<std::mutex> shardLock(shard.mutex);
+            auto it = shard.entries.find(parent);
+            if (it == shard.entries.end())
+            {
+                shard.recent.push_front(parent);
+                it = shard.entries.emplace(parent, Slot{ std::make_shared<ConcurrentNameCacheEntry>(), shard.recent.begin() }).first;
+                inserted = true;
+            }
+            else
+            {
+                // Mark the entry as the most recently used
+                shard.recent.splice(shard.recent.begin(), shard.recent, it->second.recent);
+            }
+
+            // The entry is referenced before evicting, so that it is pinned and can not be evicted itself
+            entry = it->second.entry;
+            if (inserted)
+            {
+                evict(shard, m_maxEntriesPerShard.load());
+            }
+        }
+
+        // The entry lock is acquired after releasing the shard lock, so that a slow request does not block other parents in the same shard
+        return LockedEntry(std::move(entry), inserted);
+    }
+
+    void erase(const SdfPath& parent)
+    {
+        Shard& shard = getShard(parent);
+        std::lock_guard<std::mutex> shardLock(shard.mutex);
+        auto it = shard.entries.find(parent);
+        if (it != shard.entries.end())
+        {
+            shard.recent.erase(it->second.recent);
+            shard.entries.erase(it);
+        }
+    }
+
+    // Limit the number of entries, evicting the least recently used entries beyond the limit. Zero removes the limit.
+    // The limit is divided evenly between the shards, so it is applied approximately.
+    void setMaxEntries(size_t maxEntries)
+    {
+        m_maxEntries = maxEntries;
+        m_maxEntriesPerShard = (maxEntries == 0) ? 0 : std::max<size_t>(1, (maxEntries + s_numShards - 1) / s_numShards);
+        for (Shard& shard : m_shards)
+        {
+            std::lock_guard<std::mutex> shardLock(shard.mutex);
+            evict(shard, m_maxEntriesPerShard.load());
+        }
+    }
+
+    size_t getMaxEntries() const
+    {
+        return m_maxEntries.load();
+    }
+
+    // Call `fn(parent, cache)` for each entry, holding the lock of each entry while it is visited
+    template <typename Fn>
+    void forEach(Fn&& fn)
+    {
+        std::vector<std::pair<SdfPath, std::shared_ptr<ConcurrentNameCacheEntry>>> entries;
+        for (Shard& shard : m_shards)
+        {
+            std::lock_guard<std::mutex> shardLock(shard.mutex);
+            for (const auto& it : shard.entries)
+            {
+                entries.emplace_back(it.first, it.second.entry);
+            }
+        }
+
+        for (const auto& it : entries)
+        {
+            std::lock_guard<std::mutex> entryLock(it.second->mutex);
+            fn(it.first, it.second->cache);
+        }
+    }
+
+    // The approximate number of bytes allocated by the entries, excluding the strings of the names which are held by the token registry
+    size_t memoryUsage()
+    {
+        // Each entry also holds a node in the shard map and the recently used list
+        static constexpr size_t s_entryOverhead = sizeof(ConcurrentNameCacheEntry) - sizeof(ValidNameCache) + sizeof(SdfPath) * 2 +
+                                                  sizeof(Slot) + sizeof(void*) * 4;
+
+        size_t result = sizeof(ConcurrentNameCaches);
+        for (Shard& shard : m_shards)
+        {
+            std::lock_guard<std::mutex> shardLock(shard.mutex);
+            result += shard.entries.bucket_count() * sizeof(void*);
+        }
+        forEach(
+            [&result](const SdfPath&, const ValidNameCache& cache)
+            {
+                result += s_entryOverhead + cache.memoryUsage();
+            }
+        );
+        return result;
+    }
+
+private:
+
+    static constexpr size_t s_numShards = 64;
+
+    struct Slot
+    {
+        std::shared_ptr<ConcurrentNameCacheEntry> entry;
+        std::list<SdfPath>::iterator recent;
+    };
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<SdfPath, Slot, SdfPath::Hash> entries;
+
+        // Parent paths ordered from most to least recently used
+        std::list<SdfPath> recent;
+    };
+
+    Shard& getShard(const SdfPath& parent)
+    {
+        return m_shards[SdfPath::Hash()(parent) % s_numShards];
+    }
+
+    // Evict the least recently used entries of a shard until it holds at most `maxEntries`. The shard must be locked by the caller.
+    // Entries which are referenced by a `LockedEntry` (or by a request waiting to lock them) are pinned and are never evicted, as a second entry
+    // for the same parent would generate names concurrently with the first. The shard may exceed the limit while its entries are pinned.
+    static void evict(Shard& shard, size_t maxEntries)
+    {
+        if (maxEntries == 0)
+        {
+            return;
+        }
+        auto it = shard.recent.end();
+        while (shard.entries.size() > maxEntries && it != shard.recent.begin())
+        {
+            --it;
+            auto entryIt = shard.entries.find(*it);
+            // References are only added while the shard is locked, so an unreferenced entry can not be pinned concurrently
+            if (entryIt->second.entry.use_count() > 1)
+            {
+                continue;
+            }
+            shard.entries.erase(entryIt);
+            it = shard.recent.erase(it);
+        }
+    }
+
+    std::array<Shard, s_numShards> m_shards;
+    std::atomic<size_t> m_maxEntries{ 0 };
+    std::atomic<size_t> m_maxEntriesPerShard{ 0 };
+};
+
+// Write the reserved names and suffix indices of a cache entry into a dictionary.
+// The values are sorted so that identical caches produce identical snapshots.
+VtDictionary exportCacheEntry(const ValidNameCache& cache)
+{
+    TfTokenVector usedNames;
+    usedNames.reserve(cache.usedNames.size());
+    cache.usedNames.forEach(
+        [&usedNames](const TfToken& name, const NoValue&)
+        {
+            usedNames.push_back(name);
+        }
+    );
+    std::sort(
+        usedNames.begin(),
+        usedNames.end(),
+        [](const TfToken& lhs, const TfToken& rhs)
+        {
+            return lhs.GetString() < rhs.GetString();
+        }
+    );
+
+    std::vector<std::pair<std::string, size_t>> suffixes;
+    suffixes.reserve(cache.startIndices.size());
+    cache.startIndices.forEach(
+        [&suffixes](const TfToken& name, size_t index)
+        {
+            suffixes.emplace_back(name.GetString(), index);
+        }
+    );
+    std::sort(suffixes.begin(), suffixes.end());
+    VtStringArray suffixNames(suffixes.size());
+    VtInt64Array suffixIndices(suffixes.size());
+    for (size_t i = 0; i < suffixes.size(); ++i)
+    {
+        suffixNames[i] = suffixes[i].first;
+        suffixIndices[i] = static_cast<int64_t>(suffixes[i].second);
+    }
+
+    VtDictionary result;
+    result[_tokens->usedNames.GetString()] = VtValue(VtTokenArray(usedNames.begin(), usedNames.end()));
+    result[_tokens->suffixNames.GetString()] = VtValue(suffixNames);
+    result[_tokens->suffixIndices.GetString()] = VtValue(suffixIndices);
+    return result;
+}
+
+// The contents of a single cache entry read from a snapshot
+struct SnapshotEntry
+{
+    SdfPath parent;
+    VtTokenArray usedNames;
+    VtStringArray suffixNames;
+    VtInt64Array suffixIndices;
+};
+
+// Read the entries of one kind of cache from a snapshot, returning false if the snapshot is malformed
+bool readSnapshotEntries(
+    const VtDictionary& snapshot,
+    const TfToken& key,
+    bool allowPseudoRoot,
+    std::vector<SnapshotEntry>& entries,
+    std::string* reason
+)
+{
+    const VtValue* value = TfMapLookupPtr(snapshot, key.GetString());
+    if (!value)
+    {
+        return true;
+    }
+    if (!value->IsHolding<VtDictionary>())
+    {
+        *reason = TfStringPrintf("\"%s\" must hold a dictionary", key.GetText());
+        return false;
+    }
+
+    for (const auto& it : value->UncheckedGet<VtDictionary>())
+    {
+        SnapshotEntry entry;
+        entry.parent = SdfPath(it.first);
+        if (!entry.parent.IsAbsoluteRootOrPrimPath() || !entry.parent.IsAbsolutePath() || entry.parent.ContainsPrimVariantSelection() ||
+            (!allowPseudoRoot && entry.parent.IsAbsoluteRootPath()))
+        {
+            *reason = TfStringPrintf("\"%s\" contains \"%s\" which is not usable as a name cache key", key.GetText(), it.first.c_str());
+            return false;
+        }
+        if (!it.second.IsHolding<VtDictionary>())
+        {
+            *reason = TfStringPrintf("The \"%s\" entry for \"%s\" must hold a dictionary", key.GetText(), it.first.c_str());
+            return false;
+        }
+
+        const VtDictionary& contents = it.second.UncheckedGet<VtDictionary>();
+        const VtValue* usedNames = TfMapLookupPtr(contents, _tokens->usedNames.GetString());
+        const VtValue* suffixNames = TfMapLookupPtr(contents, _tokens->suffixNames.GetString());
+        const VtValue* suffixIndices = TfMapLookupPtr(contents, _tokens->suffixIndices.GetString());
+        if (!usedNames || !usedNames->IsHolding<VtTokenArray>() || !suffixNames || !suffixNames->IsHolding<VtStringArray>() || !suffixIndices ||
+            !suffixIndices->IsHolding<VtInt64Array>())
+        {
+            *reason = TfStringPrintf(
+                "The \"%s\" entry for \"%s\" must hold \"%s\", \"%s\" and \"%s\" arrays",
+                key.GetText(),
+                it.first.c_str(),
+                _tokens->usedNames.GetText(),
+                _tokens->suffixNames.GetText(),
+                _tokens->suffixIndices.GetText()
+            );
+            return false;
+        }
+
+        entry.usedNames = usedNames->UncheckedGet<VtTokenArray>();
+        entry.suffixNames = suffixNames->UncheckedGet<VtStringArray>();
+        entry.suffixIndices = suffixIndices->UncheckedGet<VtInt64Array>();
+        if (entry.suffixNames.size() != entry.suffixIndices.size())
+        {
+            *reason = TfStringPrintf(
+                "The \"%s\" entry for \"%s\" has %zu suffix names but %zu suffix indices",
+                key.GetText(),
+                it.first.c_str(),
+                entry.suffixNames.size(),
+                entry.suffixIndices.size()
+            );
+            return false;
+        }
+        for (const int64_t index : entry.suffixIndices)
+        {
+            if (index < 0)
+            {
+                *reason = TfStringPrintf("The \"%s\" entry for \"%s\" has negative suffix indices", key.GetText(), it.first.c_str());
+                return false;
+            }
+        }
+
+        entries.push_back(std::move(entry));
+    }
+    return true;
+}
+
+// Merge the snapshot entries into the caches. Names remain reserved and the larger of each suffix index is kept.
+void importSnapshotEntries(const std::vector<SnapshotEntry>& entries, ConcurrentNameCaches& caches)
+{
+    for (const SnapshotEntry& entry : entries)
+    {
+        auto locked = caches.lock(entry.parent);
+        ValidNameCache& cache = locked.cache();
+        cache.usedNames.reserve(cache.usedNames.size() + entry.usedNames.size());
+        for (const TfToken& name : entry.usedNames)
+        {
+            cache.usedNames.insert(name);
+        }
+        for (size_t i = 0; i < entry.suffixNames.size(); ++i)
+        {
+            size_t& index = cache.startIndices.insert(entry.suffixNames[i]);
+            index = std::max(index, static_cast<size_t>(entry.suffixIndices[i]));
+        }
+    }
+}
+
 } // namespace
 
 TfToken usdex::core::getValidPrimName(const std::string& name)
 {
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "getValidPrimName");
+    instrumentation.addElements(1);
+
+    // Avoid building a new string when the name is already valid
+    if (usdex::core::detail::isValidIdentifier(name))
+    {
+        return TfToken(name);
+    }
     return TfToken(usdex::core::detail::makeValidIdentifier(name));
 }
 
 TfTokenVector usdex::core::getValidPrimNames(const std::vector<std::string>& names, const TfTokenVector& reservedNames)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "getValidPrimNames");
+    instrumentation.addElements(names.size());
+
     ValidNameCache cache;
     reserveNames(cache, reservedNames);
-    return getValidNames(names, usdex::core::getValidPrimName, cache);
+    return getValidNames(names, PrimNameValidator(), cache);
 }
 
 TfToken usdex::core::getValidChildName(const pxr::UsdPrim& prim, const std::string& name)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "getValidChildName");
+    instrumentation.addElements(1);
+
     NameCache cache;
     cache.updatePrimNames(prim);
     TfToken result = cache.getPrimName(prim, name);
@@ -172,9 +835,13 @@ TfToken usdex::core::getValidChildName(const pxr::UsdPrim& prim, const std::stri
 
 TfTokenVector usdex::core::getValidChildNames(const UsdPrim& prim, const std::vector<std::string>& names)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "getValidChildNames");
+    instrumentation.addElements(names.size());
+
     ValidNameCache cache;
     reserveChildNames(cache, prim);
-    return getValidNames(names, usdex::core::getValidPrimName, cache);
+    return getValidNames(names, PrimNameValidator(), cache);
 }
 
 
@@ -252,8 +919,8 @@ public:
             return;
         }
 
-        auto insertIt = m_primNameCache.insert(std::make_pair(getCacheKey(parent), ::ValidNameCache()));
-        reserveChildNames(insertIt.first->second, parent);
+        auto entry = m_primNameCache.lock(getCacheKey(parent));
+        reserveChildNames(entry.cache(), parent);
     }
 
     template <class T>
@@ -266,8 +933,8 @@ public:
             return;
         }
 
-        auto insertIt = m_propertyNameCache.insert(std::make_pair(getCacheKey(parent), ::ValidNameCache()));
-        reserveChildPropertyNames(insertIt.first->second, parent);
+        auto entry = m_propertyNameCache.lock(getCacheKey(parent));
+        reserveChildPropertyNames(entry.cache(), parent);
     }
 
     template <class T>
@@ -280,11 +947,14 @@ public:
             return;
         }
 
-        auto insertPrimIt = m_primNameCache.insert(std::make_pair(getCacheKey(parent), ::ValidNameCache()));
-        reserveChildNames(insertPrimIt.first->second, parent);
-
-        auto insertPropertyIt = m_propertyNameCache.insert(std::make_pair(getCacheKey(parent), ::ValidNameCache()));
-        reserveChildPropertyNames(insertPropertyIt.first->second, parent);
+        {
+            auto primEntry = m_primNameCache.lock(getCacheKey(parent));
+            reserveChildNames(primEntry.cache(), parent);
+        }
+        {
+            auto propertyEntry = m_propertyNameCache.lock(getCacheKey(parent));
+            reserveChildPropertyNames(propertyEntry.cache(), parent);
+        }
     }
 
     template <class T>
@@ -327,6 +997,71 @@ public:
         m_propertyNameCache.erase(getCacheKey(parent));
     }
 
+    VtDictionary exportSnapshot()
+    {
+        VtDictionary primNames;
+        m_primNameCache.forEach(
+            [&primNames](const SdfPath& parent, const ValidNameCache& cache)
+            {
+                primNames[parent.GetAsString()] = VtValue(::exportCacheEntry(cache));
+            }
+        );
+
+        VtDictionary propertyNames;
+        m_propertyNameCache.forEach(
+            [&propertyNames](const SdfPath& parent, const ValidNameCache& cache)
+            {
+                propertyNames[parent.GetAsString()] = VtValue(::exportCacheEntry(cache));
+            }
+        );
+
+        VtDictionary result;
+        result[_tokens->version.GetString()] = VtValue(s_snapshotVersion);
+        result[_tokens->primNames.GetString()] = VtValue(primNames);
+        result[_tokens->propertyNames.GetString()] = VtValue(propertyNames);
+        return result;
+    }
+
+    void setMaxEntries(size_t maxEntries)
+    {
+        m_primNameCache.setMaxEntries(maxEntries);
+        m_propertyNameCache.setMaxEntries(maxEntries);
+    }
+
+    size_t getMaxEntries() const
+    {
+        return m_primNameCache.getMaxEntries();
+    }
+
+    size_t memoryUsage()
+    {
+        return sizeof(NameCacheImpl) - sizeof(ConcurrentNameCaches) * 2 + m_primNameCache.memoryUsage() + m_propertyNameCache.memoryUsage();
+    }
+
+    bool importSnapshot(const VtDictionary& snapshot)
+    {
+        // Read the whole snapshot before modifying the cache, so that a malformed snapshot has no effect
+        std::string reason;
+        std::vector<SnapshotEntry> primEntries;
+        std::vector<SnapshotEntry> propertyEntries;
+        const VtValue* version = TfMapLookupPtr(snapshot, _tokens->version.GetString());
+        // Integer values may have changed type when passing through Python or a layer, so any value which can be cast is accepted
+        if (!version || !version->CanCast<int64_t>() || VtValue::Cast<int64_t>(*version).UncheckedGet<int64_t>() != s_snapshotVersion)
+        {
+            reason = TfStringPrintf("\"%s\" must be %lld", _tokens->version.GetText(), static_cast<long long>(s_snapshotVersion));
+        }
+        else if (::readSnapshotEntries(snapshot, _tokens->primNames, true, primEntries, &reason) &&
+                 ::readSnapshotEntries(snapshot, _tokens->propertyNames, false, propertyEntries, &reason))
+        {
+            ::importSnapshotEntries(primEntries, m_primNameCache);
+            ::importSnapshotEntries(propertyEntries, m_propertyNameCache);
+            return true;
+        }
+
+        TF_RUNTIME_ERROR("Unable to import name cache snapshot: %s", reason.c_str());
+        return false;
+    }
+
 private:
 
     bool isValidParent(const SdfPath& parent, bool allowPseudoRoot, std::string* reason)
@@ -469,27 +1204,27 @@ private:
     template <class T>
     TfTokenVector uncheckedGetPrimNames(const T& parent, const std::vector<std::string>& names)
     {
-        auto insertIt = m_primNameCache.insert(std::make_pair(getCacheKey(parent), ::ValidNameCache()));
-        if (insertIt.second)
+        auto entry = m_primNameCache.lock(getCacheKey(parent));
+        if (entry.inserted())
         {
-            reserveChildNames(insertIt.first->second, parent);
+            reserveChildNames(entry.cache(), parent);
         }
-        return getValidNames(names, usdex::core::getValidPrimName, insertIt.first->second);
+        return getValidNames(names, PrimNameValidator(), entry.cache());
     }
 
     template <class T>
     TfTokenVector uncheckedGetPropertyNames(const T& parent, const std::vector<std::string>& names)
     {
-        auto insertIt = m_propertyNameCache.insert(std::make_pair(getCacheKey(parent), ::ValidNameCache()));
-        if (insertIt.second)
+        auto entry = m_propertyNameCache.lock(getCacheKey(parent));
+        if (entry.inserted())
         {
-            reserveChildPropertyNames(insertIt.first->second, parent);
+            reserveChildPropertyNames(entry.cache(), parent);
         }
-        return getValidNames(names, usdex::core::getValidPropertyName, insertIt.first->second);
+        return getValidNames(names, PropertyNameValidator(), entry.cache());
     }
 
-    std::map<SdfPath, ::ValidNameCache> m_primNameCache;
-    std::map<SdfPath, ::ValidNameCache> m_propertyNameCache;
+    ::ConcurrentNameCaches m_primNameCache;
+    ::ConcurrentNameCaches m_propertyNameCache;
 };
 
 usdex::core::NameCache::NameCache() : m_impl(new NameCacheImpl)
@@ -518,16 +1253,22 @@ TfToken usdex::core::NameCache::getPrimName(const SdfPrimSpecHandle parent, cons
 
 TfTokenVector usdex::core::NameCache::getPrimNames(const SdfPath& parent, const std::vector<std::string>& names)
 {
+    TRACE_FUNCTION();
+
     return m_impl->getPrimNames(parent, names);
 }
 
 TfTokenVector usdex::core::NameCache::getPrimNames(const UsdPrim& parent, const std::vector<std::string>& names)
 {
+    TRACE_FUNCTION();
+
     return m_impl->getPrimNames(parent, names);
 }
 
 TfTokenVector usdex::core::NameCache::getPrimNames(const SdfPrimSpecHandle parent, const std::vector<std::string>& names)
 {
+    TRACE_FUNCTION();
+
     return m_impl->getPrimNames(parent, names);
 }
 
@@ -548,46 +1289,64 @@ TfToken usdex::core::NameCache::getPropertyName(const SdfPrimSpecHandle parent,
 
 TfTokenVector usdex::core::NameCache::getPropertyNames(const SdfPath& parent, const std::vector<std::string>& names)
 {
+    TRACE_FUNCTION();
+
     return m_impl->getPropertyNames(parent, names);
 }
 
 TfTokenVector usdex::core::NameCache::getPropertyNames(const UsdPrim& parent, const std::vector<std::string>& names)
 {
+    TRACE_FUNCTION();
+
     return m_impl->getPropertyNames(parent, names);
 }
 
 TfTokenVector usdex::core::NameCache::getPropertyNames(const SdfPrimSpecHandle parent, const std::vector<std::string>& names)
 {
+    TRACE_FUNCTION();
+
     return m_impl->getPropertyNames(parent, names);
 }
 
 void usdex::core::NameCache::updatePrimNames(const UsdPrim& parent)
 {
+    TRACE_FUNCTION();
+
     return m_impl->updatePrimNames(parent);
 }
 
 void usdex::core::NameCache::updatePrimNames(const SdfPrimSpecHandle parent)
 {
+    TRACE_FUNCTION();
+
     return m_impl->updatePrimNames(parent);
 }
 
 void usdex::core::NameCache::updatePropertyNames(const UsdPrim& parent)
 {
+    TRACE_FUNCTION();
+
     return m_impl->updatePropertyNames(parent);
 }
 
 void usdex::core::NameCache::updatePropertyNames(const SdfPrimSpecHandle parent)
 {
+    TRACE_FUNCTION();
+
     return m_impl->updatePropertyNames(parent);
 }
 
 void usdex::core::NameCache::update(const UsdPrim& parent)
 {
+    TRACE_FUNCTION();
+
     return m_impl->update(parent);
 }
 
 void usdex::core::NameCache::update(const SdfPrimSpecHandle parent)
 {
+    TRACE_FUNCTION();
+
     return m_impl->update(parent);
 }
 
@@ -636,6 +1395,35 @@ void usdex::core::NameCache::clear(const SdfPrimSpecHandle parent)
     return m_impl->clear(parent);
 }
 
+VtDictionary usdex::core::NameCache::exportSnapshot() const
+{
+    TRACE_FUNCTION();
+
+    return m_impl->exportSnapshot();
+}
+
+bool usdex::core::NameCache::importSnapshot(const VtDictionary& snapshot)
+{
+    TRACE_FUNCTION();
+
+    return m_impl->importSnapshot(snapshot);
+}
+
+void usdex::core::NameCache::setMaxEntries(size_t maxEntries)
+{
+    m_impl->setMaxEntries(maxEntries);
+}
+
+size_t usdex::core::NameCache::getMaxEntries() const
+{
+    return m_impl->getMaxEntries();
+}
+
+size_t usdex::core::NameCache::memoryUsage() const
+{
+    return m_impl->memoryUsage();
+}
+
 class usdex::core::ValidChildNameCache::CacheImpl
 {
 public:
@@ -658,7 +1446,7 @@ public:
             reserveChildNames(insertIt.first->second, prim);
         }
 
-        return getValidNames(names, usdex::core::getValidPrimName, insertIt.first->second);
+        return getValidNames(names, PrimNameValidator(), insertIt.first->second);
     }
 
     TfToken getValidChildName(const UsdPrim& prim, const std::string& name)
@@ -695,16 +1483,22 @@ usdex::core::ValidChildNameCache::~ValidChildNameCache()
 
 TfTokenVector usdex::core::ValidChildNameCache::getValidChildNames(const UsdPrim& prim, const std::vector<std::string>& names)
 {
+    TRACE_FUNCTION();
+
     return m_impl->getValidChildNames(prim, names);
 }
 
 TfToken usdex::core::ValidChildNameCache::getValidChildName(const UsdPrim& prim, const std::string& name)
 {
+    TRACE_FUNCTION();
+
     return m_impl->getValidChildName(prim, name);
 }
 
 void usdex::core::ValidChildNameCache::update(const UsdPrim& prim)
 {
+    TRACE_FUNCTION();
+
     m_impl->update(prim);
 }
 
@@ -715,33 +1509,69 @@ void usdex::core::ValidChildNameCache::clear(const UsdPrim& prim)
 
 TfToken usdex::core::getValidPropertyName(const std::string& name)
 {
-    // Split the name based on the ":" delimiter
-    std::vector<std::string> tokens = TfStringSplit(name, ":");
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "getValidPropertyName");
+    instrumentation.addElements(1);
 
-    // Add an empty token if the original name produced no tokens.
-    // This is most likely to occur if the incoming name was empty.
-    if (tokens.empty())
+    // Avoid splitting and joining the namespaces when the name is already valid
+    if (usdex::core::detail::isValidNamespacedIdentifier(name))
     {
-        tokens.push_back("");
+        return TfToken(name);
     }
-
-    // Make each token a valid identifier using bootstring encoding
-    std::vector<std::string> validTokens;
-    validTokens.reserve(tokens.size());
-    for (const std::string& token : tokens)
-    {
-        validTokens.push_back(usdex::core::detail::makeValidIdentifier(token));
-    }
-
-    // Join the namespaces again using the ":" delimiter
-    return TfToken(TfStringJoin(validTokens, ":"));
+    return TfToken(::makeValidPropertyName(name));
 }
 
 TfTokenVector usdex::core::getValidPropertyNames(const std::vector<std::string>& names, const TfTokenVector& reservedNames)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "getValidPropertyNames");
+    instrumentation.addElements(names.size());
+
     ValidNameCache cache;
     reserveNames(cache, reservedNames);
-    return getValidNames(names, usdex::core::getValidPropertyName, cache);
+    return getValidNames(names, PropertyNameValidator(), cache);
+}
+
+std::vector<std::string> usdex::core::getDecodedNames(const TfTokenVector& names)
+{
+    TRACE_FUNCTION();
+
+    std::vector<std::string> result(names.size());
+    const TfToken* namesData = names.data();
+    std::string* resultData = result.data();
+    WorkParallelForN(
+        names.size(),
+        [namesData, resultData](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const std::string& name = namesData[i].GetString();
+                // Only names with the prefix can have been transcoded, so all others are copied without decoding
+                if (name.compare(0, s_transcodedPrefix.size(), s_transcodedPrefix) == 0)
+                {
+                    resultData[i] = usdex::core::detail::decodeIdentifier(name);
+                }
+                else
+                {
+                    resultData[i] = name;
+                }
+            }
+        },
+        s_decodeGrainSize
+    );
+    return result;
+}
+
+std::vector<std::string> usdex::core::getDecodedNames(const UsdPrimRange& range)
+{
+    TRACE_FUNCTION();
+
+    // Traversal is inherently serial, so gather the names before decoding them in parallel
+    TfTokenVector names;
+    for (const UsdPrim& prim : range)
+    {
+        names.push_back(prim.GetName());
+    }
+    return usdex::core::getDecodedNames(names);
 }
 
 std::string usdex::core::getDisplayName(const UsdPrim& prim)
@@ -813,3 +1643,87 @@ std::string usdex::core::computeEffectiveDisplayName(const UsdPrim& prim)
     // Otherwise return the prim name
     return prim.GetName().GetString();
 }
+
+std::vector<std::string> usdex::core::getDisplayNames(const std::vector<UsdPrim>& prims)
+{
+    TRACE_FUNCTION();
+
+    std::vector<std::string> result(prims.size());
+    WorkParallelForN(
+        prims.size(),
+        [&prims, &result](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (prims[i])
+                {
+                    result[i] = usdex::core::getDisplayName(prims[i]);
+                }
+            }
+        },
+        s_displayNameGrainSize
+    );
+    return result;
+}
+
+bool usdex::core::setDisplayNames(const std::vector<UsdPrim>& prims, const std::vector<std::string>& names, bool authorPrimSpecs)
+{
+    TRACE_FUNCTION();
+
+    if (prims.size() != names.size())
+    {
+        TF_RUNTIME_ERROR("Unable to set display names: %zu prims were provided with %zu names", prims.size(), names.size());
+        return false;
+    }
+
+    bool success = true;
+    SdfChangeBlock changeBlock;
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        const UsdPrim& prim = prims[i];
+        if (!prim)
+        {
+            TF_RUNTIME_ERROR("Unable to set display name \"%s\" on an invalid prim", names[i].c_str());
+            success = false;
+            continue;
+        }
+
+        if (authorPrimSpecs)
+        {
+            const UsdEditTarget& editTarget = prim.GetStage()->GetEditTarget();
+            const SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(editTarget.GetLayer(), editTarget.MapToSpecPath(prim.GetPath()));
+            if (!primSpec || !primSpec->SetField(SdfFieldKeys->DisplayName, names[i]))
+            {
+                TF_RUNTIME_ERROR("Unable to set display name \"%s\" on <%s>", names[i].c_str(), prim.GetPath().GetAsString().c_str());
+                success = false;
+            }
+        }
+        else if (!usdex::core::setDisplayName(prim, names[i]))
+        {
+            success = false;
+        }
+    }
+    return success;
+}
+
+std::vector<std::string> usdex::core::computeEffectiveDisplayNames(const std::vector<UsdPrim>& prims)
+{
+    TRACE_FUNCTION();
+
+    std::vector<std::string> result(prims.size());
+    WorkParallelForN(
+        prims.size(),
+        [&prims, &result](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (prims[i])
+                {
+                    result[i] = usdex::core::computeEffectiveDisplayName(prims[i]);
+                }
+            }
+        },
+        s_displayNameGrainSize
+    );
+    return result;
+}
@@ -5,10 +5,18 @@
 #include "usdex/core/PhysicsJointAlgo.h"
 
 #include "usdex/core/StageAlgo.h"
+#include "usdex/core/XformAlgo.h"
+
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
 
 #include <pxr/base/gf/homogeneous.h>
 #include <pxr/base/gf/rotation.h>
 #include <pxr/base/gf/vec4f.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usd/schemaRegistry.h>
 #include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdPhysics/prismaticJoint.h>
 #include <pxr/usd/usdPhysics/revoluteJoint.h>
@@ -18,6 +26,7 @@
 #include <algorithm>
 #include <limits>
 #include <optional>
+#include <utility>
 
 using namespace pxr;
 
@@ -172,100 +181,132 @@ std::pair<GfVec3d, GfQuatd> computeLocalTransform(
     return { localPos, localRot };
 }
 
-// Specify basic parameters of Physics Joint.
-void setPhysicsJoint(
-    UsdPhysicsJoint& joint,
-    const UsdPrim& body0,
-    const UsdPrim& body1,
+// The local frames of a Physics Joint relative to each of its bodies, along with the aligned axis.
+struct JointLocalFrames
+{
+    TfToken axis;
+    GfVec3f localPos0;
+    GfQuatf localRot0;
+    GfVec3f localPos1;
+    GfQuatf localRot1;
+};
+
+// Compute the local frames of a Physics Joint from the world transforms of its bodies.
+JointLocalFrames computeJointLocalFrames(
+    const GfMatrix4d& body0Transform,
+    const GfMatrix4d& body1Transform,
     const usdex::core::JointFrame& frame,
-    std::optional<GfVec3f> axis = std::nullopt
+    std::optional<GfVec3f> axis
 )
 {
+    JointLocalFrames result;
     GfQuatd _orientation = frame.orientation;
 
-    // Set the axis.
+    // Get the axis alignment and orientation for the given axis.
+    // The third argument specifies the rotation value as the input value.
+    // The return value will be stored in the second argument as either 'X', 'Y', or 'Z'. The converted rotation value will be stored in the third
+    // argument.
     if (axis.has_value())
     {
-        GfVec3f _axis = axis.value();
+        getAxisAlignment(axis.value(), result.axis, _orientation);
+    }
 
-        // Get the axis alignment and orientation for the given axis.
-        // The third argument specifies the rotation value as the input value.
-        // The return value will be stored in the second argument as either 'X', 'Y', or 'Z'. The converted rotation value will be stored in the third
-        // argument.
-        TfToken axisToken;
-        getAxisAlignment(_axis, axisToken, _orientation);
+    // Compute the local position and rotation of body0.
+    auto [localPos0, localRot0] = computeLocalTransform(
+        body0Transform,
+        body1Transform,
+        usdex::core::JointFrame::Space::Body0,
+        frame.space,
+        frame.position,
+        _orientation
+    );
+    result.localPos0 = GfVec3f(localPos0);
+    result.localRot0 = GfQuatf(localRot0);
+
+    // Compute the local position and rotation of body1.
+    auto [localPos1, localRot1] = computeLocalTransform(
+        body1Transform,
+        body0Transform,
+        usdex::core::JointFrame::Space::Body1,
+        frame.space,
+        frame.position,
+        _orientation
+    );
+    result.localPos1 = GfVec3f(localPos1);
+    result.localRot1 = GfQuatf(localRot1);
+
+    return result;
+}
 
+// Author the axis and local frames of a Physics Joint. Only the frames of the specified bodies are authored.
+void authorJointLocalFrames(UsdPhysicsJoint& joint, bool hasBody0, bool hasBody1, const JointLocalFrames& frames)
+{
+    // Set the axis.
+    if (!frames.axis.IsEmpty())
+    {
         UsdPhysicsRevoluteJoint revoluteJoint = UsdPhysicsRevoluteJoint(joint);
         if (revoluteJoint)
         {
-            revoluteJoint.GetAxisAttr().Set(axisToken);
+            revoluteJoint.GetAxisAttr().Set(frames.axis);
         }
         UsdPhysicsPrismaticJoint prismaticJoint = UsdPhysicsPrismaticJoint(joint);
         if (prismaticJoint)
         {
-            prismaticJoint.GetAxisAttr().Set(axisToken);
+            prismaticJoint.GetAxisAttr().Set(frames.axis);
         }
         UsdPhysicsSphericalJoint sphericalJoint = UsdPhysicsSphericalJoint(joint);
         if (sphericalJoint)
         {
-            sphericalJoint.GetAxisAttr().Set(axisToken);
+            sphericalJoint.GetAxisAttr().Set(frames.axis);
         }
     }
 
-    // Get the local to world coordinate transformation matrix for body0 and body1.
-    auto xformCache = UsdGeomXformCache();
-    const GfMatrix4d body0Transform = body0 ? xformCache.GetLocalToWorldTransform(body0) : GfMatrix4d(1.0);
-    const GfMatrix4d body1Transform = body1 ? xformCache.GetLocalToWorldTransform(body1) : GfMatrix4d(1.0);
-
-    if (body0)
+    if (hasBody0)
     {
-        // Compute the local position and rotation of body0.
-        auto [localPos, localRot] = computeLocalTransform(
-            body0Transform,
-            body1Transform,
-            usdex::core::JointFrame::Space::Body0,
-            frame.space,
-            frame.position,
-            _orientation
-        );
-        joint.GetLocalPos0Attr().Set(GfVec3f(localPos));
-        joint.GetLocalRot0Attr().Set(GfQuatf(localRot));
+        joint.GetLocalPos0Attr().Set(frames.localPos0);
+        joint.GetLocalRot0Attr().Set(frames.localRot0);
     }
 
-    if (body1)
+    if (hasBody1)
     {
-        // Compute the local position and rotation of body1.
-        auto [localPos, localRot] = computeLocalTransform(
-            body1Transform,
-            body0Transform,
-            usdex::core::JointFrame::Space::Body1,
-            frame.space,
-            frame.position,
-            _orientation
-        );
-        joint.GetLocalPos1Attr().Set(GfVec3f(localPos));
-        joint.GetLocalRot1Attr().Set(GfQuatf(localRot));
+        joint.GetLocalPos1Attr().Set(frames.localPos1);
+        joint.GetLocalRot1Attr().Set(frames.localRot1);
     }
 }
 
-// Validate the arguments when creating each physics joint.
-bool validatePhysicsJointArguments(
-    UsdStagePtr stage,
-    const SdfPath& path,
+// Specify basic parameters of Physics Joint.
+void setPhysicsJoint(
+    UsdPhysicsJoint& joint,
     const UsdPrim& body0,
     const UsdPrim& body1,
     const usdex::core::JointFrame& frame,
-    std::string* reason
+    std::optional<GfVec3f> axis,
+    const usdex::core::WorldTransformCache* worldTransformCache
 )
 {
-    // Early out if the proposed prim location is invalid
-    std::string _reason;
-    if (!usdex::core::isEditablePrimLocation(stage, path, &_reason))
+    // Get the local to world coordinate transformation matrix for body0 and body1.
+    // A shared cache avoids recomputing the transforms of the ancestors which are common to many joints.
+    GfMatrix4d body0Transform(1.0);
+    GfMatrix4d body1Transform(1.0);
+    if (worldTransformCache)
     {
-        *reason = TfStringPrintf("An invalid location: %s", _reason.c_str());
-        return false;
+        body0Transform = body0 ? worldTransformCache->getWorldTransform(body0) : GfMatrix4d(1.0);
+        body1Transform = body1 ? worldTransformCache->getWorldTransform(body1) : GfMatrix4d(1.0);
     }
+    else
+    {
+        auto xformCache = UsdGeomXformCache();
+        body0Transform = body0 ? xformCache.GetLocalToWorldTransform(body0) : GfMatrix4d(1.0);
+        body1Transform = body1 ? xformCache.GetLocalToWorldTransform(body1) : GfMatrix4d(1.0);
+    }
+
+    const JointLocalFrames frames = computeJointLocalFrames(body0Transform, body1Transform, frame, axis);
+    authorJointLocalFrames(joint, bool(body0), bool(body1), frames);
+}
 
+// Validate the bodies and frame when creating each physics joint, once the location of the joint has been validated.
+bool validatePhysicsJointBodies(const UsdPrim& body0, const UsdPrim& body1, const usdex::core::JointFrame& frame, std::string* reason)
+{
     if (!body0 && !body1)
     {
         *reason = TfStringPrintf("Body0 or Body1 are not specified. One of these must exist.");
@@ -294,6 +335,127 @@ bool validatePhysicsJointArguments(
     return true;
 }
 
+// Validate the arguments when creating each physics joint.
+bool validatePhysicsJointArguments(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const UsdPrim& body0,
+    const UsdPrim& body1,
+    const usdex::core::JointFrame& frame,
+    std::string* reason
+)
+{
+    // Early out if the proposed prim location is invalid
+    std::string _reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &_reason))
+    {
+        *reason = TfStringPrintf("An invalid location: %s", _reason.c_str());
+        return false;
+    }
+
+    return validatePhysicsJointBodies(body0, body1, frame, reason);
+}
+
+// Get the bodies targeted by an existing joint, validating that they are suitable for the frame.
+bool getJointBodies(const UsdPhysicsJoint& joint, const usdex::core::JointFrame& frame, UsdPrim& body0, UsdPrim& body1, std::string* reason)
+{
+    // Get body0 and body1 assigned from the joint.
+    SdfPathVector body0Targets, body1Targets;
+    joint.GetBody0Rel().GetTargets(&body0Targets);
+    joint.GetBody1Rel().GetTargets(&body1Targets);
+
+    // If no body is assigned, do nothing.
+    if (body0Targets.empty() && body1Targets.empty())
+    {
+        *reason = "Unable to align PhysicsJoint on invalid joint";
+        return false;
+    }
+
+    body0 = body0Targets.empty() ? UsdPrim() : joint.GetPrim().GetStage()->GetPrimAtPath(body0Targets[0]);
+    body1 = body1Targets.empty() ? UsdPrim() : joint.GetPrim().GetStage()->GetPrimAtPath(body1Targets[0]);
+
+    if (!body0 && frame.space == usdex::core::JointFrame::Space::Body0)
+    {
+        *reason = TfStringPrintf("Body0 is not specified for PhysicsJoint at \"%s\"", joint.GetPrim().GetPath().GetAsString().c_str());
+        return false;
+    }
+    if (!body1 && frame.space == usdex::core::JointFrame::Space::Body1)
+    {
+        *reason = TfStringPrintf("Body1 is not specified for PhysicsJoint at \"%s\"", joint.GetPrim().GetPath().GetAsString().c_str());
+        return false;
+    }
+    return true;
+}
+
+// The type name and schema of each type of joint
+const TfToken& getJointTypeName(usdex::core::PhysicsJointDescription::Type type)
+{
+    static const TfToken s_fixed = UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsFixedJoint>();
+    static const TfToken s_revolute = UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsRevoluteJoint>();
+    static const TfToken s_prismatic = UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsPrismaticJoint>();
+    static const TfToken s_spherical = UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsSphericalJoint>();
+    switch (type)
+    {
+        case usdex::core::PhysicsJointDescription::Type::Revolute:
+            return s_revolute;
+        case usdex::core::PhysicsJointDescription::Type::Prismatic:
+            return s_prismatic;
+        case usdex::core::PhysicsJointDescription::Type::Spherical:
+            return s_spherical;
+        default:
+            return s_fixed;
+    }
+}
+
+// Author the limits of a revolute, prismatic, or spherical joint
+void authorJointLimits(const UsdPrim& prim, const usdex::core::PhysicsJointDescription& desc)
+{
+    switch (desc.type)
+    {
+        case usdex::core::PhysicsJointDescription::Type::Revolute:
+        {
+            UsdPhysicsRevoluteJoint joint(prim);
+            if (desc.lowerLimit.has_value())
+            {
+                joint.GetLowerLimitAttr().Set(desc.lowerLimit.value());
+            }
+            if (desc.upperLimit.has_value())
+            {
+                joint.GetUpperLimitAttr().Set(desc.upperLimit.value());
+            }
+            break;
+        }
+        case usdex::core::PhysicsJointDescription::Type::Prismatic:
+        {
+            UsdPhysicsPrismaticJoint joint(prim);
+            if (desc.lowerLimit.has_value())
+            {
+                joint.GetLowerLimitAttr().Set(desc.lowerLimit.value());
+            }
+            if (desc.upperLimit.has_value())
+            {
+                joint.GetUpperLimitAttr().Set(desc.upperLimit.value());
+            }
+            break;
+        }
+        case usdex::core::PhysicsJointDescription::Type::Spherical:
+        {
+            UsdPhysicsSphericalJoint joint(prim);
+            if (desc.coneAngle0Limit.has_value())
+            {
+                joint.GetConeAngle0LimitAttr().Set(desc.coneAngle0Limit.value());
+            }
+            if (desc.coneAngle1Limit.has_value())
+            {
+                joint.GetConeAngle1LimitAttr().Set(desc.coneAngle1Limit.value());
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
 } // namespace
 
 UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
@@ -301,9 +463,12 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
     const SdfPath& path,
     const UsdPrim& body0,
     const UsdPrim& body1,
-    const usdex::core::JointFrame& frame
+    const usdex::core::JointFrame& frame,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     // Check the arguments when creating each joint.
     std::string reason;
     if (!validatePhysicsJointArguments(stage, path, body0, body1, frame, &reason))
@@ -312,17 +477,15 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
         return UsdPhysicsFixedJoint();
     }
 
-    auto joint = UsdPhysicsFixedJoint::Define(stage, path);
+    UsdPhysicsFixedJoint joint = usdex::core::detail::definePrim<UsdPhysicsFixedJoint>(stage, path);
     if (!joint)
     {
         TF_RUNTIME_ERROR("Unable to define PhysicsFixedJoint at \"%s\"", path.GetAsString().c_str());
         return UsdPhysicsFixedJoint();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = joint.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     // Specifies the bodies to be connected to the joint.
     if (body0)
@@ -351,7 +514,7 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
     }
 
     // Set the physics joint.
-    setPhysicsJoint(joint, body0, body1, frame);
+    setPhysicsJoint(joint, body0, body1, frame, std::nullopt, xformCache);
 
     return joint;
 }
@@ -361,9 +524,12 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
     const std::string& name,
     const UsdPrim& body0,
     const UsdPrim& body1,
-    const usdex::core::JointFrame& frame
+    const usdex::core::JointFrame& frame,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -374,16 +540,19 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
 
     auto stage = parent.GetStage();
     const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
-    return definePhysicsFixedJoint(stage, path, body0, body1, frame);
+    return definePhysicsFixedJoint(stage, path, body0, body1, frame, xformCache);
 }
 
 UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
     UsdPrim prim,
     const UsdPrim& body0,
     const UsdPrim& body1,
-    const usdex::core::JointFrame& frame
+    const usdex::core::JointFrame& frame,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     if (!prim)
     {
         TF_RUNTIME_ERROR("Unable to define PhysicsFixedJoint on invalid prim");
@@ -400,7 +569,7 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
 
     auto stage = prim.GetStage();
     const SdfPath path = prim.GetPath();
-    return definePhysicsFixedJoint(stage, path, body0, body1, frame);
+    return definePhysicsFixedJoint(stage, path, body0, body1, frame, xformCache);
 }
 
 UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
@@ -411,9 +580,12 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> lowerLimit,
-    std::optional<float> upperLimit
+    std::optional<float> upperLimit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     // Check the arguments when creating each joint.
     std::string reason;
     if (!validatePhysicsJointArguments(stage, path, body0, body1, frame, &reason))
@@ -422,17 +594,15 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
         return UsdPhysicsRevoluteJoint();
     }
 
-    auto joint = UsdPhysicsRevoluteJoint::Define(stage, path);
+    UsdPhysicsRevoluteJoint joint = usdex::core::detail::definePrim<UsdPhysicsRevoluteJoint>(stage, path);
     if (!joint)
     {
         TF_RUNTIME_ERROR("Unable to define PhysicsRevoluteJoint at \"%s\"", path.GetAsString().c_str());
         return UsdPhysicsRevoluteJoint();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = joint.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     // Specifies the bodies to be connected to the joint.
     if (body0)
@@ -461,7 +631,7 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
     }
 
     // Set the physics joint.
-    setPhysicsJoint(joint, body0, body1, frame, axis);
+    setPhysicsJoint(joint, body0, body1, frame, axis, xformCache);
 
     if (lowerLimit.has_value())
     {
@@ -483,9 +653,12 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> lowerLimit,
-    std::optional<float> upperLimit
+    std::optional<float> upperLimit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -496,7 +669,7 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
 
     auto stage = parent.GetStage();
     const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
-    return definePhysicsRevoluteJoint(stage, path, body0, body1, frame, axis, lowerLimit, upperLimit);
+    return definePhysicsRevoluteJoint(stage, path, body0, body1, frame, axis, lowerLimit, upperLimit, xformCache);
 }
 
 UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
@@ -506,9 +679,12 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> lowerLimit,
-    std::optional<float> upperLimit
+    std::optional<float> upperLimit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     if (!prim)
     {
         TF_RUNTIME_ERROR("Unable to define PhysicsRevoluteJoint on invalid prim");
@@ -525,7 +701,7 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
 
     auto stage = prim.GetStage();
     const SdfPath path = prim.GetPath();
-    return definePhysicsRevoluteJoint(stage, path, body0, body1, frame, axis, lowerLimit, upperLimit);
+    return definePhysicsRevoluteJoint(stage, path, body0, body1, frame, axis, lowerLimit, upperLimit, xformCache);
 }
 
 UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
@@ -536,9 +712,12 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> lowerLimit,
-    std::optional<float> upperLimit
+    std::optional<float> upperLimit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     // Check the arguments when creating each joint.
     std::string reason;
     if (!validatePhysicsJointArguments(stage, path, body0, body1, frame, &reason))
@@ -547,17 +726,15 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
         return UsdPhysicsPrismaticJoint();
     }
 
-    auto joint = UsdPhysicsPrismaticJoint::Define(stage, path);
+    UsdPhysicsPrismaticJoint joint = usdex::core::detail::definePrim<UsdPhysicsPrismaticJoint>(stage, path);
     if (!joint)
     {
         TF_RUNTIME_ERROR("Unable to define PhysicsPrismaticJoint at \"%s\"", path.GetAsString().c_str());
         return UsdPhysicsPrismaticJoint();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = joint.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     // Specifies the bodies to be connected to the joint.
     if (body0)
@@ -586,7 +763,7 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
     }
 
     // Set the physics joint.
-    setPhysicsJoint(joint, body0, body1, frame, axis);
+    setPhysicsJoint(joint, body0, body1, frame, axis, xformCache);
 
     if (lowerLimit.has_value())
     {
@@ -608,9 +785,12 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> lowerLimit,
-    std::optional<float> upperLimit
+    std::optional<float> upperLimit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -621,7 +801,7 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
 
     auto stage = parent.GetStage();
     const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
-    return definePhysicsPrismaticJoint(stage, path, body0, body1, frame, axis, lowerLimit, upperLimit);
+    return definePhysicsPrismaticJoint(stage, path, body0, body1, frame, axis, lowerLimit, upperLimit, xformCache);
 }
 
 UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
@@ -631,9 +811,12 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> lowerLimit,
-    std::optional<float> upperLimit
+    std::optional<float> upperLimit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     if (!prim)
     {
         TF_RUNTIME_ERROR("Unable to define PhysicsPrismaticJoint on invalid prim");
@@ -650,7 +833,7 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
 
     auto stage = prim.GetStage();
     const SdfPath path = prim.GetPath();
-    return definePhysicsPrismaticJoint(stage, path, body0, body1, frame, axis, lowerLimit, upperLimit);
+    return definePhysicsPrismaticJoint(stage, path, body0, body1, frame, axis, lowerLimit, upperLimit, xformCache);
 }
 
 UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
@@ -661,9 +844,12 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> coneAngle0Limit,
-    std::optional<float> coneAngle1Limit
+    std::optional<float> coneAngle1Limit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     // Check the arguments when creating each joint.
     std::string reason;
     if (!validatePhysicsJointArguments(stage, path, body0, body1, frame, &reason))
@@ -672,17 +858,15 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
         return UsdPhysicsSphericalJoint();
     }
 
-    auto joint = UsdPhysicsSphericalJoint::Define(stage, path);
+    UsdPhysicsSphericalJoint joint = usdex::core::detail::definePrim<UsdPhysicsSphericalJoint>(stage, path);
     if (!joint)
     {
         TF_RUNTIME_ERROR("Unable to define PhysicsSphericalJoint at \"%s\"", path.GetAsString().c_str());
         return UsdPhysicsSphericalJoint();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = joint.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     // Specifies the bodies to be connected to the joint.
     if (body0)
@@ -711,7 +895,7 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
     }
 
     // Set the physics joint.
-    setPhysicsJoint(joint, body0, body1, frame, axis);
+    setPhysicsJoint(joint, body0, body1, frame, axis, xformCache);
 
     if (coneAngle0Limit.has_value())
     {
@@ -733,9 +917,12 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> coneAngle0Limit,
-    std::optional<float> coneAngle1Limit
+    std::optional<float> coneAngle1Limit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -746,7 +933,7 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
 
     auto stage = parent.GetStage();
     const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
-    return definePhysicsSphericalJoint(stage, path, body0, body1, frame, axis, coneAngle0Limit, coneAngle1Limit);
+    return definePhysicsSphericalJoint(stage, path, body0, body1, frame, axis, coneAngle0Limit, coneAngle1Limit, xformCache);
 }
 
 UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
@@ -756,9 +943,12 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis,
     std::optional<float> coneAngle0Limit,
-    std::optional<float> coneAngle1Limit
+    std::optional<float> coneAngle1Limit,
+    const WorldTransformCache* xformCache
 )
 {
+    TRACE_FUNCTION();
+
     if (!prim)
     {
         TF_RUNTIME_ERROR("Unable to define PhysicsSphericalJoint on invalid prim");
@@ -775,37 +965,252 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
 
     auto stage = prim.GetStage();
     const SdfPath path = prim.GetPath();
-    return definePhysicsSphericalJoint(stage, path, body0, body1, frame, axis, coneAngle0Limit, coneAngle1Limit);
+    return definePhysicsSphericalJoint(stage, path, body0, body1, frame, axis, coneAngle0Limit, coneAngle1Limit, xformCache);
 }
 
-void usdex::core::alignPhysicsJoint(UsdPhysicsJoint joint, const usdex::core::JointFrame& frame, const GfVec3f& axis)
+void usdex::core::alignPhysicsJoint(
+    UsdPhysicsJoint joint,
+    const usdex::core::JointFrame& frame,
+    const GfVec3f& axis,
+    const WorldTransformCache* xformCache
+)
 {
-    // Get body0 and body1 assigned from the joint.
-    SdfPathVector body0Targets, body1Targets;
-    joint.GetBody0Rel().GetTargets(&body0Targets);
-    joint.GetBody1Rel().GetTargets(&body1Targets);
+    TRACE_FUNCTION();
 
-    // If no body is assigned, do nothing.
-    if (body0Targets.empty() && body1Targets.empty())
+    UsdPrim body0, body1;
+    std::string reason;
+    if (!::getJointBodies(joint, frame, body0, body1, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to align PhysicsJoint on invalid joint");
+        TF_RUNTIME_ERROR("%s", reason.c_str());
         return;
     }
 
-    const UsdPrim body0 = body0Targets.empty() ? UsdPrim() : joint.GetPrim().GetStage()->GetPrimAtPath(body0Targets[0]);
-    const UsdPrim body1 = body1Targets.empty() ? UsdPrim() : joint.GetPrim().GetStage()->GetPrimAtPath(body1Targets[0]);
+    // Set the physics joint.
+    setPhysicsJoint(joint, body0, body1, frame, axis, xformCache);
+}
 
-    if (!body0 && frame.space == usdex::core::JointFrame::Space::Body0)
+bool usdex::core::alignPhysicsJoints(
+    const std::vector<UsdPhysicsJoint>& joints,
+    const std::vector<JointFrame>& frames,
+    const std::vector<GfVec3f>& axes,
+    const WorldTransformCache* xformCache
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "alignPhysicsJoints");
+    instrumentation.addElements(joints.size());
+
+    if (frames.size() != joints.size() || axes.size() != joints.size())
     {
-        TF_RUNTIME_ERROR("Body0 is not specified for PhysicsJoint at \"%s\"", joint.GetPrim().GetPath().GetAsString().c_str());
-        return;
+        TF_RUNTIME_ERROR(
+            "Unable to align PhysicsJoints: Expected %zu frames and axes but found %zu and %zu",
+            joints.size(),
+            frames.size(),
+            axes.size()
+        );
+        return false;
     }
-    if (!body1 && frame.space == usdex::core::JointFrame::Space::Body1)
+
+    // Joints which are not on the same stage as the first valid joint can not share its transform cache
+    UsdStagePtr stage;
+    for (const UsdPhysicsJoint& joint : joints)
     {
-        TF_RUNTIME_ERROR("Body1 is not specified for PhysicsJoint at \"%s\"", joint.GetPrim().GetPath().GetAsString().c_str());
-        return;
+        if (joint)
+        {
+            stage = joint.GetPrim().GetStage();
+            break;
+        }
     }
 
-    // Set the physics joint.
-    setPhysicsJoint(joint, body0, body1, frame, axis);
+    // Resolve the bodies of all joints and compute their local frames concurrently, using a single world transform cache.
+    // Diagnostics are deferred and emitted from the calling thread so that they are reported in a deterministic order.
+    std::optional<WorldTransformCache> localCache;
+    if (!xformCache && stage)
+    {
+        localCache.emplace(stage);
+        xformCache = &localCache.value();
+    }
+    std::vector<std::string> reasons(joints.size());
+    std::vector<char> valid(joints.size(), 0);
+    std::vector<::JointLocalFrames> localFrames(joints.size());
+    std::vector<std::pair<bool, bool>> hasBodies(joints.size());
+    WorkParallelForN(
+        joints.size(),
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Compute joint frames");
+            for (size_t i = begin; i < end; ++i)
+            {
+                const UsdPhysicsJoint& joint = joints[i];
+                if (!joint || joint.GetPrim().GetStage() != stage)
+                {
+                    reasons[i] = TfStringPrintf(
+                        "Unable to align PhysicsJoint at \"%s\": It is not valid or belongs to a different stage",
+                        joint.GetPath().GetAsString().c_str()
+                    );
+                    continue;
+                }
+
+                UsdPrim body0, body1;
+                valid[i] = ::getJointBodies(joint, frames[i], body0, body1, &reasons[i]);
+                if (!valid[i])
+                {
+                    continue;
+                }
+
+                const GfMatrix4d body0Transform = body0 ? xformCache->getWorldTransform(body0) : GfMatrix4d(1.0);
+                const GfMatrix4d body1Transform = body1 ? xformCache->getWorldTransform(body1) : GfMatrix4d(1.0);
+                localFrames[i] = ::computeJointLocalFrames(body0Transform, body1Transform, frames[i], axes[i]);
+                hasBodies[i] = { bool(body0), bool(body1) };
+            }
+        }
+    );
+
+    bool success = true;
+    for (size_t i = 0; i < joints.size(); ++i)
+    {
+        if (!valid[i])
+        {
+            TF_RUNTIME_ERROR("%s", reasons[i].c_str());
+            success = false;
+        }
+    }
+
+    // Author the frames of all of the joints with a single round of change processing
+    {
+        TRACE_SCOPE("Author joint frames");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < joints.size(); ++i)
+        {
+            if (valid[i])
+            {
+                UsdPhysicsJoint joint = joints[i];
+                ::authorJointLocalFrames(joint, hasBodies[i].first, hasBodies[i].second, localFrames[i]);
+            }
+        }
+    }
+
+    return success;
+}
+
+std::vector<UsdPhysicsJoint> usdex::core::definePhysicsJoints(UsdStagePtr stage, const std::vector<PhysicsJointDescription>& joints)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "definePhysicsJoints");
+    instrumentation.addElements(joints.size());
+
+    std::vector<UsdPhysicsJoint> result(joints.size());
+
+    // Early out if the stage is invalid, as no location could be valid
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to define PhysicsJoints due to an invalid location: Invalid UsdStage.");
+        return result;
+    }
+
+    // Validate all of the joints and compute their local frames concurrently. No opinions are authored, so the stage is only read.
+    // The world transforms of the bodies are shared by all joints, as neighboring joints of an articulation share bodies and ancestors.
+    // Diagnostics are deferred and emitted from the calling thread so that they are reported in a deterministic order.
+    // The locations are validated at once beforehand, so that the parent of each location is only looked up once.
+    SdfPathVector paths(joints.size());
+    std::transform(joints.begin(), joints.end(), paths.begin(), [](const PhysicsJointDescription& desc) { return desc.path; });
+    std::vector<std::string> reasons;
+    const std::vector<bool> locations = usdex::core::areEditablePrimLocations(stage, paths, &reasons);
+
+    usdex::core::WorldTransformCache xformCache(stage);
+    std::vector<char> valid(joints.size(), 0);
+    std::vector<::JointLocalFrames> frames(joints.size());
+    WorkParallelForN(
+        joints.size(),
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Compute joint frames");
+            for (size_t i = begin; i < end; ++i)
+            {
+                const PhysicsJointDescription& desc = joints[i];
+                if (!locations[i])
+                {
+                    reasons[i] = TfStringPrintf("An invalid location: %s", reasons[i].c_str());
+                    continue;
+                }
+                valid[i] = ::validatePhysicsJointBodies(desc.body0, desc.body1, desc.frame, &reasons[i]);
+                if (!valid[i])
+                {
+                    continue;
+                }
+
+                const GfMatrix4d body0Transform = desc.body0 ? xformCache.getWorldTransform(desc.body0) : GfMatrix4d(1.0);
+                const GfMatrix4d body1Transform = desc.body1 ? xformCache.getWorldTransform(desc.body1) : GfMatrix4d(1.0);
+                std::optional<GfVec3f> axis;
+                if (desc.type != PhysicsJointDescription::Type::Fixed)
+                {
+                    axis = desc.axis;
+                }
+                frames[i] = ::computeJointLocalFrames(body0Transform, body1Transform, desc.frame, axis);
+            }
+        }
+    );
+
+    for (size_t i = 0; i < joints.size(); ++i)
+    {
+        if (!valid[i])
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define %s at \"%s\": %s",
+                ::getJointTypeName(joints[i].type).GetText(),
+                joints[i].path.GetAsString().c_str(),
+                reasons[i].c_str()
+            );
+        }
+    }
+
+    // Define all of the prims with a single round of change processing.
+    // The prim specs are authored directly in the edit target layer as the stage can not recompose while the change block is open.
+    {
+        TRACE_SCOPE("Define joint prim specs");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < joints.size(); ++i)
+        {
+            if (valid[i] && !usdex::core::detail::definePrimSpec(stage, joints[i].path, ::getJointTypeName(joints[i].type)))
+            {
+                TF_RUNTIME_ERROR("Unable to define %s at \"%s\"", ::getJointTypeName(joints[i].type).GetText(), joints[i].path.GetAsString().c_str());
+                valid[i] = 0;
+            }
+        }
+    }
+
+    // Author the bodies, frames, and limits of all of the joints with a single round of change processing
+    {
+        TRACE_SCOPE("Author joint properties");
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < joints.size(); ++i)
+        {
+            if (!valid[i])
+            {
+                continue;
+            }
+
+            const PhysicsJointDescription& desc = joints[i];
+            UsdPhysicsJoint joint(stage->GetPrimAtPath(desc.path));
+            if (!joint)
+            {
+                TF_RUNTIME_ERROR("Unable to define %s at \"%s\"", ::getJointTypeName(desc.type).GetText(), desc.path.GetAsString().c_str());
+                continue;
+            }
+
+            if (desc.body0)
+            {
+                joint.GetBody0Rel().SetTargets(SdfPathVector({ desc.body0.GetPath() }));
+            }
+            if (desc.body1)
+            {
+                joint.GetBody1Rel().SetTargets(SdfPathVector({ desc.body1.GetPath() }));
+            }
+            ::authorJointLocalFrames(joint, bool(desc.body0), bool(desc.body1), frames[i]);
+            ::authorJointLimits(joint.GetPrim(), desc);
+            result[i] = joint;
+        }
+    }
+
+    return result;
 }
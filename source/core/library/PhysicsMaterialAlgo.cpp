@@ -4,16 +4,58 @@
 
 #include "usdex/core/PhysicsMaterialAlgo.h"
 
+#include "usdex/core/NameAlgo.h"
 #include "usdex/core/StageAlgo.h"
 
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usd/schemaRegistry.h>
 #include <pxr/usd/usdPhysics/materialAPI.h>
 #include <pxr/usd/usdPhysics/tokens.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
+#include <pxr/usd/usdShade/tokens.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <optional>
+#include <unordered_map>
 
 using namespace pxr;
 
+namespace
+{
+
+//! The quantized dynamic friction, static friction, restitution, and density of a physics material
+using PhysicsMaterialKey = std::array<std::optional<double>, 4>;
+
+//! Quantize a physical property to the nearest multiple of the tolerance
+std::optional<double> quantizePhysicsProperty(std::optional<float> value, float tolerance)
+{
+    if (!value.has_value())
+    {
+        return std::nullopt;
+    }
+    return tolerance > 0.0f ? std::round(double(value.value()) / double(tolerance)) : double(value.value());
+}
+
+//! Compute a hash of the quantized properties of a physics material
+size_t hashPhysicsMaterial(const PhysicsMaterialKey& key)
+{
+    size_t hash = 0;
+    for (const std::optional<double>& value : key)
+    {
+        hash = TfHash::Combine(hash, value.has_value(), value.value_or(0.0));
+    }
+    return hash;
+}
+
+} // namespace
+
 UsdShadeMaterial usdex::core::definePhysicsMaterial(
     UsdStagePtr stage,
     const SdfPath& path,
@@ -23,6 +65,8 @@ UsdShadeMaterial usdex::core::definePhysicsMaterial(
     const std::optional<float> density
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -31,18 +75,13 @@ UsdShadeMaterial usdex::core::definePhysicsMaterial(
         return UsdShadeMaterial();
     }
 
-    auto material = UsdShadeMaterial::Define(stage, path);
+    UsdShadeMaterial material = usdex::core::detail::definePrim<UsdShadeMaterial>(stage, path);
     if (!material)
     {
         TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial at \"%s\"", path.GetAsString().c_str());
         return UsdShadeMaterial();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = material.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
-
     if (!usdex::core::addPhysicsToMaterial(material, dynamicFriction, staticFriction, restitution, density))
     {
         TF_RUNTIME_ERROR("Unable to add physics material parameters to material at \"%s\"", path.GetAsString().c_str());
@@ -61,6 +100,8 @@ UsdShadeMaterial usdex::core::definePhysicsMaterial(
     const std::optional<float> density
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -82,6 +123,8 @@ UsdShadeMaterial usdex::core::definePhysicsMaterial(
     const std::optional<float> density
 )
 {
+    TRACE_FUNCTION();
+
     if (!prim)
     {
         TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial on invalid prim");
@@ -101,6 +144,8 @@ bool usdex::core::addPhysicsToMaterial(
     std::optional<float> density
 )
 {
+    TRACE_FUNCTION();
+
     auto prim = material.GetPrim();
     if (!prim)
     {
@@ -138,6 +183,8 @@ bool usdex::core::addPhysicsToMaterial(
 
 bool usdex::core::bindPhysicsMaterial(UsdPrim prim, const UsdShadeMaterial& material)
 {
+    TRACE_FUNCTION();
+
     if (!prim || !material)
     {
         TF_RUNTIME_ERROR("Unable to bind physics material to invalid prim or material");
@@ -161,3 +208,172 @@ bool usdex::core::bindPhysicsMaterial(UsdPrim prim, const UsdShadeMaterial& mate
 
     return true;
 }
+
+bool usdex::core::bindPhysicsMaterials(const std::vector<UsdPrim>& prims, const std::vector<UsdShadeMaterial>& materials)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "bindPhysicsMaterials");
+
+    if (prims.size() != materials.size())
+    {
+        TF_RUNTIME_ERROR("Unable to bind physics materials due to mismatched materials: %zu prims and %zu materials", prims.size(), materials.size());
+        return false;
+    }
+    instrumentation.addElements(prims.size());
+
+    // Validate every binding before authoring any of them. Later bindings of the same prim replace earlier ones.
+    bool success = true;
+    UsdStagePtr stage;
+    std::unordered_map<SdfPath, SdfPath, SdfPath::Hash> bindings;
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        const UsdPrim& prim = prims[i];
+        const UsdShadeMaterial& material = materials[i];
+        if (!prim || !material)
+        {
+            TF_RUNTIME_ERROR("Unable to bind physics material to invalid prim or material");
+            success = false;
+            continue;
+        }
+
+        if (!stage)
+        {
+            stage = prim.GetStage();
+        }
+        else if (prim.GetStage() != stage)
+        {
+            TF_RUNTIME_ERROR("Unable to bind physics material to prim: %s belongs to a different stage", prim.GetPath().GetAsString().c_str());
+            success = false;
+            continue;
+        }
+
+        std::string reason;
+        if (!usdex::core::isEditablePrimLocation(prim, &reason))
+        {
+            TF_RUNTIME_ERROR("Unable to bind material to invalid prim: %s", reason.c_str());
+            success = false;
+            continue;
+        }
+
+        bindings[prim.GetPath()] = material.GetPath();
+    }
+
+    if (bindings.empty())
+    {
+        return success;
+    }
+
+    // Author the API schema and the physics purpose relationship of every binding directly on the edit target layer, with a single round of
+    // change processing
+    static const TfToken s_bindingAPI = UsdSchemaRegistry::GetSchemaTypeName<UsdShadeMaterialBindingAPI>();
+    static const TfToken s_physicsBinding(SdfPath::JoinIdentifier(UsdShadeTokens->materialBinding, TfToken("physics")));
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    SdfChangeBlock changeBlock;
+    for (const auto& [path, materialPath] : bindings)
+    {
+        SdfPrimSpecHandle spec = SdfCreatePrimInLayer(layer, editTarget.MapToSpecPath(path));
+        if (!detail::addAppliedSchema(spec, s_bindingAPI) ||
+            !detail::setRelationshipTarget(spec, s_physicsBinding, editTarget.MapToSpecPath(materialPath)))
+        {
+            TF_RUNTIME_ERROR("Unable to bind physics material to prim: %s", path.GetAsString().c_str());
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+class usdex::core::PhysicsMaterialRegistry::PhysicsMaterialRegistryImpl
+{
+
+public:
+
+    PhysicsMaterialRegistryImpl(UsdPrim parent, float tolerance)
+        : parent(parent), tolerance(std::isfinite(tolerance) ? std::max(tolerance, 0.0f) : 0.0f)
+    {
+    }
+
+    UsdPrim parent;
+    float tolerance;
+    NameCache nameCache;
+
+    // The unique materials keyed by hash. Materials with colliding hashes are disambiguated by comparing their quantized properties.
+    std::unordered_multimap<size_t, std::pair<::PhysicsMaterialKey, UsdShadeMaterial>> entries;
+    size_t useCount = 0;
+};
+
+usdex::core::PhysicsMaterialRegistry::PhysicsMaterialRegistry(UsdPrim parent, float tolerance)
+{
+    m_impl = new PhysicsMaterialRegistryImpl(parent, tolerance);
+}
+
+usdex::core::PhysicsMaterialRegistry::~PhysicsMaterialRegistry()
+{
+    delete m_impl;
+}
+
+UsdShadeMaterial usdex::core::PhysicsMaterialRegistry::definePhysicsMaterial(
+    const std::string& name,
+    const float dynamicFriction,
+    const std::optional<float> staticFriction,
+    const std::optional<float> restitution,
+    const std::optional<float> density
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "PhysicsMaterialRegistry::definePhysicsMaterial");
+
+    const float tolerance = m_impl->tolerance;
+    const ::PhysicsMaterialKey key = {
+        ::quantizePhysicsProperty(dynamicFriction, tolerance),
+        ::quantizePhysicsProperty(staticFriction, tolerance),
+        ::quantizePhysicsProperty(restitution, tolerance),
+        ::quantizePhysicsProperty(density, tolerance),
+    };
+    const size_t hash = ::hashPhysicsMaterial(key);
+    const auto [begin, end] = m_impl->entries.equal_range(hash);
+    for (auto it = begin; it != end; ++it)
+    {
+        if (it->second.first == key)
+        {
+            m_impl->useCount++;
+            return it->second.second;
+        }
+    }
+
+    if (!m_impl->parent)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid parent prim");
+        return UsdShadeMaterial();
+    }
+
+    // Define the first instance of each unique material
+    const TfToken primName = m_impl->nameCache.getPrimName(m_impl->parent, name);
+    UsdShadeMaterial result =
+        usdex::core::definePhysicsMaterial(m_impl->parent, primName.GetString(), dynamicFriction, staticFriction, restitution, density);
+    if (!result)
+    {
+        return UsdShadeMaterial();
+    }
+
+    m_impl->entries.emplace(hash, std::make_pair(key, result));
+    m_impl->useCount++;
+
+    return result;
+}
+
+float usdex::core::PhysicsMaterialRegistry::getTolerance() const
+{
+    return m_impl->tolerance;
+}
+
+size_t usdex::core::PhysicsMaterialRegistry::getUniqueMaterialCount() const
+{
+    return m_impl->entries.size();
+}
+
+size_t usdex::core::PhysicsMaterialRegistry::getUseCount() const
+{
+    return m_impl->useCount;
+}
@@ -4,13 +4,39 @@
 
 #include "usdex/core/PointsAlgo.h"
 
+#include "usdex/core/NameAlgo.h"
 #include "usdex/core/StageAlgo.h"
+#include "usdex/core/XformAlgo.h"
 
+#include "GeomUtils.h"
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/matrix3d.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/quatd.h>
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/reduce.h>
+#include <pxr/usd/sdf/reference.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
 #include <pxr/usd/usdGeom/points.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
+#include <pxr/usd/usdGeom/scope.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
 #include <numeric>
+#include <unordered_map>
 
 using namespace usdex::core;
 using namespace pxr;
@@ -47,6 +73,7 @@ bool validatePrimvarInterpolation(const PrimvarData<T>& primvar, const TfTokenVe
 // Validate a primvar intended for a points prim.
 // Accepts a vector of allowed interpolations and returns false if the PrimvarData is not within these allowed values.
 // Validates that a valid interpolation was found and that indices (if provided) fit inside the value range.
+// The indices are only validated if the ValidationPolicy of the calling thread requires the contents of the arrays to be validated.
 // If the primvar is invalid and reason is non-null, an error message describing the validation error will be set.
 template <typename T>
 bool validatePrimvar(const PrimvarData<T>& primvar, const TfTokenVector& interpolations, const VtArray<GfVec3f>& points, std::string* reason)
@@ -65,7 +92,7 @@ bool validatePrimvar(const PrimvarData<T>& primvar, const TfTokenVector& interpo
         return false;
     }
 
-    if (!primvar.isValid())
+    if (usdex::core::detail::shouldValidateContents() && !primvar.isValid())
     {
         if (reason != nullptr)
         {
@@ -77,46 +104,54 @@ bool validatePrimvar(const PrimvarData<T>& primvar, const TfTokenVector& interpo
     return true;
 }
 
-UsdGeomPoints definePointCloudImpl(
-    UsdStagePtr stage,
+// Validate the attribute values for a points prim.
+// If the values are invalid a complete error message describing the first validation error will be set on reason.
+bool validatePointCloud(
     const SdfPath& path,
     const VtVec3fArray& points,
-    std::optional<const VtInt64Array> ids,
-    std::optional<const FloatPrimvarData> widths,
-    std::optional<const Vec3fPrimvarData> normals,
-    std::optional<const Vec3fPrimvarData> displayColor,
-    std::optional<const FloatPrimvarData> displayOpacity
+    const std::optional<const VtInt64Array>& ids,
+    const std::optional<const FloatPrimvarData>& widths,
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity,
+    std::string* reason
 )
 {
-    std::string reason;
+    TRACE_FUNCTION();
+
+    std::string primvarReason;
 
     // Early out if the points are empty
     if (points.empty())
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomPoints at \"%s\" due to invalid points: Empty array", path.GetAsString().c_str());
-        return UsdGeomPoints();
+        *reason = TfStringPrintf("Unable to define UsdGeomPoints at \"%s\" due to invalid points: Empty array", path.GetAsString().c_str());
+        return false;
     }
 
     // Early out if the ids are not valid
     if (ids.has_value() && (points.size() != ids.value().size()))
     {
-        TF_RUNTIME_ERROR(
+        *reason = TfStringPrintf(
             "Unable to define UsdGeomPoints at \"%s\" due to invalid ids: Expected %zu values but found %zu",
             path.GetAsString().c_str(),
             points.size(),
             ids.value().size()
         );
-        return UsdGeomPoints();
+        return false;
     }
 
     static TfTokenVector s_validInterpolations = { UsdGeomTokens->constant, UsdGeomTokens->vertex };
 
     if (widths.has_value())
     {
-        if (!::validatePrimvar(widths.value(), s_validInterpolations, points, &reason))
+        if (!::validatePrimvar(widths.value(), s_validInterpolations, points, &primvarReason))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomPoints at \"%s\" due to invalid widths: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomPoints();
+            *reason = TfStringPrintf(
+                "Unable to define UsdGeomPoints at \"%s\" due to invalid widths: %s",
+                path.GetAsString().c_str(),
+                primvarReason.c_str()
+            );
+            return false;
         }
     }
 
@@ -124,48 +159,90 @@ UsdGeomPoints definePointCloudImpl(
     if (normals.has_value())
     {
         static TfTokenVector s_validNormalsInterpolations = { UsdGeomTokens->vertex };
-        if (!::validatePrimvar(normals.value(), s_validNormalsInterpolations, points, &reason))
+        if (!::validatePrimvar(normals.value(), s_validNormalsInterpolations, points, &primvarReason))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomPoints at \"%s\" due to invalid normals: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomPoints();
+            *reason = TfStringPrintf(
+                "Unable to define UsdGeomPoints at \"%s\" due to invalid normals: %s",
+                path.GetAsString().c_str(),
+                primvarReason.c_str()
+            );
+            return false;
         }
     }
 
     // Early out if displayColor was specified but not valid
     if (displayColor.has_value())
     {
-        if (!::validatePrimvar(displayColor.value(), s_validInterpolations, points, &reason))
+        if (!::validatePrimvar(displayColor.value(), s_validInterpolations, points, &primvarReason))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomPoints at \"%s\" due to invalid display color: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomPoints();
+            *reason = TfStringPrintf(
+                "Unable to define UsdGeomPoints at \"%s\" due to invalid display color: %s",
+                path.GetAsString().c_str(),
+                primvarReason.c_str()
+            );
+            return false;
         }
     }
 
     // Early out if displayOpacity was specified but not valid
     if (displayOpacity.has_value())
     {
-        if (!::validatePrimvar(displayOpacity.value(), s_validInterpolations, points, &reason))
+        if (!::validatePrimvar(displayOpacity.value(), s_validInterpolations, points, &primvarReason))
         {
-            TF_RUNTIME_ERROR(
+            *reason = TfStringPrintf(
                 "Unable to define UsdGeomPoints at \"%s\" due to invalid display opacity: %s",
                 path.GetAsString().c_str(),
-                reason.c_str()
+                primvarReason.c_str()
             );
-            return UsdGeomPoints();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+UsdGeomPoints definePointCloudImpl(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtVec3fArray& points,
+    const std::optional<const VtInt64Array>& ids,
+    const std::optional<const FloatPrimvarData>& widths,
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity
+)
+{
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "definePointCloud");
+    if (instrumentation.isActive())
+    {
+        instrumentation.addElements(points.size());
+        instrumentation.addArray(points);
+        if (ids.has_value())
+        {
+            instrumentation.addArray(ids.value());
         }
+        instrumentation.addPrimvar(widths);
+        instrumentation.addPrimvar(normals);
+        instrumentation.addPrimvar(displayColor);
+        instrumentation.addPrimvar(displayOpacity);
+    }
+
+    std::string reason;
+    if (!::validatePointCloud(path, points, ids, widths, normals, displayColor, displayOpacity, &reason))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return UsdGeomPoints();
     }
 
-    UsdGeomPoints pointCloud = UsdGeomPoints::Define(stage, path);
+    UsdGeomPoints pointCloud = usdex::core::detail::definePrim<UsdGeomPoints>(stage, path);
     if (!pointCloud)
     {
         TF_RUNTIME_ERROR("Unable to define UsdGeomPoints at \"%s\"", path.GetAsString().c_str());
         return UsdGeomPoints();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = pointCloud.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     // Author opinions on Points topology attributes
     pointCloud.CreatePointsAttr().Set(points);
@@ -178,12 +255,15 @@ UsdGeomPoints definePointCloudImpl(
         pointCloud.CreateIdsAttr().Block();
     }
 
+    // The display color and opacity types are fixed by the UsdGeomGprim schema, so only the widths and normals follow the primvar precision
+    const bool halfPrecision = (usdex::core::getPrimvarPrecision() == PrimvarPrecision::eHalf);
+
     // Optionally author widths
     if (widths.has_value())
     {
         // Define the normals primvar
         const TfToken& name = UsdGeomTokens->widths;
-        const SdfValueTypeName& typeName = SdfValueTypeNames->FloatArray;
+        const SdfValueTypeName& typeName = halfPrecision ? SdfValueTypeNames->HalfArray : SdfValueTypeNames->FloatArray;
         UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(pointCloud.GetPrim()).CreatePrimvar(name, typeName);
         if (!widths.value().setPrimvar(primvar))
         {
@@ -196,7 +276,7 @@ UsdGeomPoints definePointCloudImpl(
     {
         // Define the normals primvar
         const TfToken& name = UsdGeomTokens->normals;
-        const SdfValueTypeName& typeName = SdfValueTypeNames->Normal3fArray;
+        const SdfValueTypeName& typeName = halfPrecision ? SdfValueTypeNames->Normal3hArray : SdfValueTypeNames->Normal3fArray;
         UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(pointCloud.GetPrim()).CreatePrimvar(name, typeName);
         if (!normals.value().setPrimvar(primvar))
         {
@@ -225,11 +305,20 @@ UsdGeomPoints definePointCloudImpl(
     }
 
     // Compute an extent for the schema so there is a guarantee that the extent will be correct and authored in all cases.
+    // The common cases are computed directly from the arrays, any others are deferred to the schema so the result always matches it.
     VtArray<GfVec3f> extent;
-    if (!UsdGeomBoundable::ComputeExtentFromPlugins(pointCloud, UsdTimeCode::Default(), &extent))
+    if (!widths.has_value())
+    {
+        extent = detail::computeExtent(points);
+    }
+    else if (!widths.value().hasIndices() && widths.value().values().size() == points.size())
+    {
+        extent = detail::computeExtent(points, widths.value().values());
+    }
+    else if (!UsdGeomBoundable::ComputeExtentFromPlugins(pointCloud, UsdTimeCode::Default(), &extent))
     {
         // fallback to basic extents
-        UsdGeomPointBased::ComputeExtent(points, &extent);
+        extent = detail::computeExtent(points);
     }
     pointCloud.CreateExtentAttr().Set(extent);
 
@@ -249,6 +338,8 @@ UsdGeomPoints usdex::core::definePointCloud(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -260,6 +351,32 @@ UsdGeomPoints usdex::core::definePointCloud(
     return ::definePointCloudImpl(stage, path, points, ids, widths, normals, displayColor, displayOpacity);
 }
 
+UsdGeomPoints usdex::core::definePointCloud(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    VtVec3fArray&& points,
+    std::optional<const VtInt64Array> ids,
+    std::optional<const FloatPrimvarData> widths,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomPoints due to an invalid location: %s", reason.c_str());
+        return UsdGeomPoints();
+    }
+
+    // Take ownership of the points so that the authored attribute is the sole owner of the buffer once this function returns
+    const VtVec3fArray ownedPoints(std::move(points));
+    return ::definePointCloudImpl(stage, path, ownedPoints, ids, widths, normals, displayColor, displayOpacity);
+}
+
 UsdGeomPoints usdex::core::definePointCloud(
     UsdPrim parent,
     const std::string& name,
@@ -271,6 +388,8 @@ UsdGeomPoints usdex::core::definePointCloud(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -294,6 +413,8 @@ UsdGeomPoints usdex::core::definePointCloud(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the prim is not valid
     if (!prim)
     {
@@ -317,3 +438,1073 @@ UsdGeomPoints usdex::core::definePointCloud(
     const SdfPath& path = prim.GetPath();
     return ::definePointCloudImpl(stage, path, points, std::nullopt, widths, normals, displayColor, displayOpacity);
 }
+
+namespace
+{
+
+// The integer coordinate of a tile within the grid
+struct TileCoord
+{
+    int64_t x = 0;
+    int64_t y = 0;
+    int64_t z = 0;
+
+    bool operator==(const TileCoord& other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+};
+
+struct TileCoordHash
+{
+    size_t operator()(const TileCoord& coord) const
+    {
+        return TfHash::Combine(coord.x, coord.y, coord.z);
+    }
+};
+
+// Compute the grid coordinate containing a single component of a point
+// Non-finite and extremely distant values are clamped so that they remain representable.
+int64_t tileCoordinate(float value, float tileSize)
+{
+    static constexpr double s_limit = static_cast<double>(std::numeric_limits<int32_t>::max());
+    const double coordinate = std::floor(static_cast<double>(value) / static_cast<double>(tileSize));
+    if (std::isnan(coordinate))
+    {
+        return 0;
+    }
+    return static_cast<int64_t>(std::max(-s_limit, std::min(s_limit, coordinate)));
+}
+
+std::string tileName(const TileCoord& coord, size_t page)
+{
+    auto component = [](int64_t value)
+    {
+        return (value < 0) ? TfStringPrintf("n%lld", -static_cast<long long>(value)) : TfStringPrintf("%lld", static_cast<long long>(value));
+    };
+
+    std::string name = TfStringPrintf("Tile_%s_%s_%s", component(coord.x).c_str(), component(coord.y).c_str(), component(coord.z).c_str());
+    if (page > 0)
+    {
+        name += TfStringPrintf("_%zu", page);
+    }
+    return name;
+}
+
+// Read the value of a primvar for each point, regardless of its interpolation or indexing
+// The primvar must have been validated against the points prior to use.
+template <typename T>
+class PrimvarReader
+{
+public:
+
+    explicit PrimvarReader(const std::optional<const PrimvarData<T>>& primvar)
+    {
+        if (primvar.has_value())
+        {
+            m_values = primvar.value().values();
+            if (primvar.value().hasIndices())
+            {
+                m_indices = primvar.value().indices();
+            }
+            m_constant = (primvar.value().interpolation() == UsdGeomTokens->constant);
+        }
+    }
+
+    bool isConstant() const
+    {
+        return m_constant;
+    }
+
+    const T& operator()(size_t point) const
+    {
+        const size_t element = m_constant ? 0 : point;
+        return m_indices.empty() ? m_values[element] : m_values[m_indices[element]];
+    }
+
+private:
+
+    VtArray<T> m_values;
+    VtIntArray m_indices;
+    bool m_constant = false;
+};
+
+// Accumulate the values of a primvar for the points of a single tile
+// The values remain constant for as long as every contribution is the same constant value.
+template <typename T>
+class TilePrimvarBuffer
+{
+public:
+
+    void append(const T& value, bool constant)
+    {
+        if (m_isConstant)
+        {
+            if (constant && (m_size == 0 || m_constantValue == value))
+            {
+                m_constantValue = value;
+                ++m_size;
+                return;
+            }
+
+            // expand the constant value to every point that has already been accumulated
+            m_values.assign(m_size, m_constantValue);
+            m_isConstant = false;
+        }
+        m_values.push_back(value);
+        ++m_size;
+    }
+
+    // Release the accumulated values as PrimvarData, leaving the buffer empty
+    PrimvarData<T> take()
+    {
+        PrimvarData<T> result = m_isConstant ? PrimvarData<T>(UsdGeomTokens->constant, VtArray<T>(1, m_constantValue))
+                                             : PrimvarData<T>(UsdGeomTokens->vertex, std::move(m_values));
+        m_values = VtArray<T>();
+        m_isConstant = true;
+        m_size = 0;
+        return result;
+    }
+
+private:
+
+    VtArray<T> m_values;
+    T m_constantValue = T();
+    bool m_isConstant = true;
+    size_t m_size = 0;
+};
+
+// The points which have been accumulated for a single tile, but not yet authored
+struct TileBuffer
+{
+    TileCoord coord;
+    size_t page = 0;
+    VtVec3fArray points;
+    VtInt64Array ids;
+    TilePrimvarBuffer<float> widths;
+    TilePrimvarBuffer<GfVec3f> normals;
+    TilePrimvarBuffer<GfVec3f> displayColor;
+    TilePrimvarBuffer<float> displayOpacity;
+};
+
+} // namespace
+
+class usdex::core::TiledPointCloudWriter::TiledPointCloudWriterImpl
+{
+public:
+
+    TiledPointCloudWriterImpl(UsdStagePtr stage, const SdfPath& path, float tileSize, size_t maxPointsPerTile)
+        : m_stage(stage), m_tileSize(tileSize), m_maxPointsPerTile(maxPointsPerTile)
+    {
+        if (!std::isfinite(tileSize) || tileSize <= 0.0f)
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define tiled UsdGeomPoints at \"%s\" due to an invalid tile size: %f",
+                path.GetAsString().c_str(),
+                static_cast<double>(tileSize)
+            );
+            return;
+        }
+
+        if (maxPointsPerTile == 0)
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to define tiled UsdGeomPoints at \"%s\" due to an invalid maximum of 0 points per tile",
+                path.GetAsString().c_str()
+            );
+            return;
+        }
+
+        m_xform = usdex::core::defineXform(stage, path);
+    }
+
+    ~TiledPointCloudWriterImpl()
+    {
+    }
+
+    bool isValid() const
+    {
+        return m_xform && !m_finished;
+    }
+
+    const UsdGeomXform& getXform() const
+    {
+        return m_xform;
+    }
+
+    bool addPoints(
+        const VtVec3fArray& points,
+        const std::optional<const VtInt64Array>& ids,
+        const std::optional<const FloatPrimvarData>& widths,
+        const std::optional<const Vec3fPrimvarData>& normals,
+        const std::optional<const Vec3fPrimvarData>& displayColor,
+        const std::optional<const FloatPrimvarData>& displayOpacity
+    )
+    {
+        if (!isValid())
+        {
+            TF_RUNTIME_ERROR("Unable to add points to an invalid or finished TiledPointCloudWriter");
+            return false;
+        }
+
+        const SdfPath& path = m_xform.GetPath();
+        std::string reason;
+        if (!::validatePointCloud(path, points, ids, widths, normals, displayColor, displayOpacity, &reason))
+        {
+            TF_RUNTIME_ERROR("%s", reason.c_str());
+            return false;
+        }
+
+        // The tiles must be authored consistently, so every chunk must provide the same ids and primvars
+        const bool hasIds = ids.has_value();
+        const bool hasWidths = widths.has_value();
+        const bool hasNormals = normals.has_value();
+        const bool hasDisplayColor = displayColor.has_value();
+        const bool hasDisplayOpacity = displayOpacity.has_value();
+        if (m_hasChunks &&
+            (hasIds != m_hasIds || hasWidths != m_hasWidths || hasNormals != m_hasNormals || hasDisplayColor != m_hasDisplayColor ||
+             hasDisplayOpacity != m_hasDisplayOpacity))
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to add points to the tiled UsdGeomPoints at \"%s\" as the ids and primvars provided differ from previous chunks",
+                path.GetAsString().c_str()
+            );
+            return false;
+        }
+        m_hasChunks = true;
+        m_hasIds = hasIds;
+        m_hasWidths = hasWidths;
+        m_hasNormals = hasNormals;
+        m_hasDisplayColor = hasDisplayColor;
+        m_hasDisplayOpacity = hasDisplayOpacity;
+
+        // Compute the tile containing each point
+        std::vector<TileCoord> coords(points.size());
+        const float tileSize = m_tileSize;
+        WorkParallelForN(
+            points.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const GfVec3f& point = points[i];
+                    coords[i].x = ::tileCoordinate(point[0], tileSize);
+                    coords[i].y = ::tileCoordinate(point[1], tileSize);
+                    coords[i].z = ::tileCoordinate(point[2], tileSize);
+                }
+            }
+        );
+
+        const ::PrimvarReader<float> widthsReader(widths);
+        const ::PrimvarReader<GfVec3f> normalsReader(normals);
+        const ::PrimvarReader<GfVec3f> displayColorReader(displayColor);
+        const ::PrimvarReader<float> displayOpacityReader(displayOpacity);
+
+        // Distribute the points and their associated values into the tiles
+        // Neighboring points commonly share a tile, so the previous lookup is reused whenever possible.
+        size_t tileIndex = 0;
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            if (i == 0 || !(coords[i] == coords[i - 1]))
+            {
+                auto insertIt = m_tileIndices.insert(std::make_pair(coords[i], m_tiles.size()));
+                if (insertIt.second)
+                {
+                    m_tiles.emplace_back();
+                    m_tiles.back().coord = coords[i];
+                }
+                tileIndex = insertIt.first->second;
+            }
+
+            ::TileBuffer& tile = m_tiles[tileIndex];
+            tile.points.push_back(points[i]);
+            if (hasIds)
+            {
+                tile.ids.push_back(ids.value()[i]);
+            }
+            if (hasWidths)
+            {
+                tile.widths.append(widthsReader(i), widthsReader.isConstant());
+            }
+            if (hasNormals)
+            {
+                tile.normals.append(normalsReader(i), normalsReader.isConstant());
+            }
+            if (hasDisplayColor)
+            {
+                tile.displayColor.append(displayColorReader(i), displayColorReader.isConstant());
+            }
+            if (hasDisplayOpacity)
+            {
+                tile.displayOpacity.append(displayOpacityReader(i), displayOpacityReader.isConstant());
+            }
+
+            // Author the tile as soon as it is full to bound the memory used while authoring
+            if (tile.points.size() >= m_maxPointsPerTile)
+            {
+                flush(tile);
+            }
+        }
+
+        return true;
+    }
+
+    std::vector<UsdGeomPoints> finish()
+    {
+        if (m_xform && !m_finished)
+        {
+            for (::TileBuffer& tile : m_tiles)
+            {
+                flush(tile);
+            }
+            m_tiles.clear();
+            m_tileIndices.clear();
+            m_finished = true;
+        }
+        return m_authored;
+    }
+
+private:
+
+    void flush(::TileBuffer& tile)
+    {
+        if (tile.points.empty())
+        {
+            return;
+        }
+
+        const SdfPath path = m_xform.GetPath().AppendChild(TfToken(::tileName(tile.coord, tile.page)));
+        ++tile.page;
+
+        std::optional<const VtInt64Array> ids;
+        if (m_hasIds)
+        {
+            ids.emplace(std::move(tile.ids));
+        }
+        std::optional<const FloatPrimvarData> widths;
+        if (m_hasWidths)
+        {
+            widths.emplace(tile.widths.take());
+        }
+        std::optional<const Vec3fPrimvarData> normals;
+        if (m_hasNormals)
+        {
+            normals.emplace(tile.normals.take());
+        }
+        std::optional<const Vec3fPrimvarData> displayColor;
+        if (m_hasDisplayColor)
+        {
+            displayColor.emplace(tile.displayColor.take());
+        }
+        std::optional<const FloatPrimvarData> displayOpacity;
+        if (m_hasDisplayOpacity)
+        {
+            displayOpacity.emplace(tile.displayOpacity.take());
+        }
+
+        UsdGeomPoints result =
+            usdex::core::definePointCloud(m_stage, path, std::move(tile.points), ids, widths, normals, displayColor, displayOpacity);
+        tile.points = VtVec3fArray();
+        tile.ids = VtInt64Array();
+        if (result)
+        {
+            m_authored.push_back(result);
+        }
+    }
+
+    UsdStagePtr m_stage;
+    UsdGeomXform m_xform;
+    float m_tileSize;
+    size_t m_maxPointsPerTile;
+    bool m_finished = false;
+
+    bool m_hasChunks = false;
+    bool m_hasIds = false;
+    bool m_hasWidths = false;
+    bool m_hasNormals = false;
+    bool m_hasDisplayColor = false;
+    bool m_hasDisplayOpacity = false;
+
+    std::unordered_map<::TileCoord, size_t, ::TileCoordHash> m_tileIndices;
+    std::vector<::TileBuffer> m_tiles;
+    std::vector<UsdGeomPoints> m_authored;
+};
+
+usdex::core::TiledPointCloudWriter::TiledPointCloudWriter(UsdStagePtr stage, const SdfPath& path, float tileSize, size_t maxPointsPerTile)
+    : m_impl(new TiledPointCloudWriterImpl(stage, path, tileSize, maxPointsPerTile))
+{
+}
+
+usdex::core::TiledPointCloudWriter::~TiledPointCloudWriter()
+{
+    m_impl->finish();
+    delete m_impl;
+}
+
+bool usdex::core::TiledPointCloudWriter::isValid() const
+{
+    return m_impl->isValid();
+}
+
+UsdGeomXform usdex::core::TiledPointCloudWriter::getXform() const
+{
+    return m_impl->getXform();
+}
+
+bool usdex::core::TiledPointCloudWriter::addPoints(
+    const VtVec3fArray& points,
+    std::optional<const VtInt64Array> ids,
+    std::optional<const FloatPrimvarData> widths,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    TRACE_FUNCTION();
+
+    return m_impl->addPoints(points, ids, widths, normals, displayColor, displayOpacity);
+}
+
+std::vector<UsdGeomPoints> usdex::core::TiledPointCloudWriter::finish()
+{
+    TRACE_FUNCTION();
+
+    return m_impl->finish();
+}
+
+UsdGeomXform usdex::core::defineTiledPointCloud(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    float tileSize,
+    const VtVec3fArray& points,
+    std::optional<const VtInt64Array> ids,
+    std::optional<const FloatPrimvarData> widths,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity,
+    size_t maxPointsPerTile
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the data is invalid, so that no prims are defined
+    std::string reason;
+    if (!::validatePointCloud(path, points, ids, widths, normals, displayColor, displayOpacity, &reason))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return UsdGeomXform();
+    }
+
+    TiledPointCloudWriter writer(stage, path, tileSize, maxPointsPerTile);
+    if (!writer.isValid() || !writer.addPoints(points, ids, widths, normals, displayColor, displayOpacity))
+    {
+        return UsdGeomXform();
+    }
+    writer.finish();
+
+    return writer.getXform();
+}
+
+namespace
+{
+
+// The number of instances bound by each task when computing the extent of a point instancer
+static constexpr size_t s_instanceGrainSize = 4096;
+
+// Validate the attribute values for a point instancer prim.
+// If the values are invalid a complete error message describing the first validation error will be set on reason.
+bool validatePointInstancer(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const std::vector<UsdPrim>& prototypes,
+    const VtIntArray& protoIndices,
+    const VtVec3fArray& positions,
+    const std::optional<const VtQuathArray>& orientations,
+    const std::optional<const VtVec3fArray>& scales,
+    const std::optional<const VtInt64Array>& ids,
+    std::string* reason
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if there are no prototypes to instance
+    if (prototypes.empty())
+    {
+        *reason = TfStringPrintf(
+            "Unable to define UsdGeomPointInstancer at \"%s\" due to invalid prototypes: No prototypes were provided",
+            path.GetAsString().c_str()
+        );
+        return false;
+    }
+
+    // Early out if any of the prototypes are invalid or belong to another stage
+    for (size_t i = 0; i < prototypes.size(); ++i)
+    {
+        if (!prototypes[i] || prototypes[i].GetStage() != stage)
+        {
+            *reason = TfStringPrintf(
+                "Unable to define UsdGeomPointInstancer at \"%s\" due to invalid prototypes: The prototype at index %zu is not a valid prim on "
+                "the stage",
+                path.GetAsString().c_str(),
+                i
+            );
+            return false;
+        }
+    }
+
+    // Early out if the proto indices are empty
+    if (protoIndices.empty())
+    {
+        *reason = TfStringPrintf(
+            "Unable to define UsdGeomPointInstancer at \"%s\" due to invalid proto indices: Empty array",
+            path.GetAsString().c_str()
+        );
+        return false;
+    }
+
+    // Early out if any of the proto indices do not refer to a prototype
+    const int numPrototypes = static_cast<int>(prototypes.size());
+    auto invalidIndex = std::find_if(
+        protoIndices.cbegin(),
+        protoIndices.cend(),
+        [numPrototypes](int index)
+        {
+            return index < 0 || index >= numPrototypes;
+        }
+    );
+    if (invalidIndex != protoIndices.cend())
+    {
+        *reason = TfStringPrintf(
+            "Unable to define UsdGeomPointInstancer at \"%s\" due to invalid proto indices: The value %d at index %td is out of range for %d "
+            "prototypes",
+            path.GetAsString().c_str(),
+            *invalidIndex,
+            invalidIndex - protoIndices.cbegin(),
+            numPrototypes
+        );
+        return false;
+    }
+
+    // Early out if any of the per-instance arrays do not match the number of instances
+    auto validateSize = [&path, &protoIndices, reason](const char* name, size_t size)
+    {
+        if (size == protoIndices.size())
+        {
+            return true;
+        }
+        *reason = TfStringPrintf(
+            "Unable to define UsdGeomPointInstancer at \"%s\" due to invalid %s: Expected %zu values but found %zu",
+            path.GetAsString().c_str(),
+            name,
+            protoIndices.size(),
+            size
+        );
+        return false;
+    };
+
+    if (!validateSize("positions", positions.size()))
+    {
+        return false;
+    }
+
+    if (orientations.has_value() && !validateSize("orientations", orientations.value().size()))
+    {
+        return false;
+    }
+
+    if (scales.has_value() && !validateSize("scales", scales.value().size()))
+    {
+        return false;
+    }
+
+    if (ids.has_value() && !validateSize("ids", ids.value().size()))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+// Compute the transform of a single instance relative to the point instancer, excluding the transform of its prototype.
+// This matches UsdGeomPointInstancer::ComputeInstanceTransformsAtTime, which applies the scale, then the orientation, then the position.
+GfMatrix4d instanceTransform(
+    size_t instance,
+    const VtVec3fArray& positions,
+    const std::optional<const VtQuathArray>& orientations,
+    const std::optional<const VtVec3fArray>& scales
+)
+{
+    GfMatrix4d transform(1.0);
+    if (scales.has_value())
+    {
+        transform.SetScale(GfVec3d(scales.value()[instance]));
+    }
+    if (orientations.has_value())
+    {
+        transform *= GfMatrix4d(1.0).SetRotate(GfQuatd(orientations.value()[instance]));
+    }
+    transform.SetTranslateOnly(GfVec3d(positions[instance]));
+    return transform;
+}
+
+// Compute the extent of a point instancer from the local bounds of its prototypes and the transform of each instance.
+// The instances are bound in parallel chunks. If none of the prototypes have bounds the extent of the positions is returned instead.
+VtVec3fArray computeInstancerExtent(
+    const std::vector<UsdPrim>& prototypes,
+    const VtIntArray& protoIndices,
+    const VtVec3fArray& positions,
+    const std::optional<const VtQuathArray>& orientations,
+    const std::optional<const VtVec3fArray>& scales
+)
+{
+    TRACE_FUNCTION();
+
+    // The local bound of each prototype includes its own transform, which is applied before the instance transform
+    UsdGeomBBoxCache bboxCache(UsdTimeCode::Default(), UsdGeomImageable::GetOrderedPurposeTokens(), /* useExtentsHint */ true);
+    std::vector<GfBBox3d> prototypeBounds;
+    prototypeBounds.reserve(prototypes.size());
+    for (const UsdPrim& prototype : prototypes)
+    {
+        prototypeBounds.push_back(bboxCache.ComputeLocalBound(prototype));
+    }
+
+    auto chunkBounds = [&](size_t begin, size_t end)
+    {
+        GfRange3d range;
+        for (size_t i = begin; i < end; ++i)
+        {
+            const GfBBox3d& prototypeBound = prototypeBounds[protoIndices[i]];
+            if (prototypeBound.GetRange().IsEmpty())
+            {
+                continue;
+            }
+            GfBBox3d bound = prototypeBound;
+            bound.Transform(::instanceTransform(i, positions, orientations, scales));
+            range.UnionWith(bound.ComputeAlignedRange());
+        }
+        return range;
+    };
+
+    const GfRange3d range = WorkParallelReduceN(
+        GfRange3d(),
+        protoIndices.size(),
+        [&chunkBounds](size_t begin, size_t end, const GfRange3d& identity)
+        {
+            return GfRange3d::GetUnion(identity, chunkBounds(begin, end));
+        },
+        [](const GfRange3d& lhs, const GfRange3d& rhs)
+        {
+            return GfRange3d::GetUnion(lhs, rhs);
+        },
+        s_instanceGrainSize
+    );
+
+    if (range.IsEmpty())
+    {
+        return detail::computeExtent(positions);
+    }
+
+    VtVec3fArray extent(2);
+    extent[0] = GfVec3f(range.GetMin());
+    extent[1] = GfVec3f(range.GetMax());
+    return extent;
+}
+
+UsdGeomPointInstancer definePointInstancerImpl(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const std::vector<UsdPrim>& prototypes,
+    const VtIntArray& protoIndices,
+    const VtVec3fArray& positions,
+    const std::optional<const VtQuathArray>& orientations,
+    const std::optional<const VtVec3fArray>& scales,
+    const std::optional<const VtInt64Array>& ids,
+    const std::optional<const VtInt64Array>& invisibleIds
+)
+{
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "definePointInstancer");
+    if (instrumentation.isActive())
+    {
+        instrumentation.addElements(protoIndices.size());
+        instrumentation.addArray(protoIndices);
+        instrumentation.addArray(positions);
+        if (orientations.has_value())
+        {
+            instrumentation.addArray(orientations.value());
+        }
+        if (scales.has_value())
+        {
+            instrumentation.addArray(scales.value());
+        }
+        if (ids.has_value())
+        {
+            instrumentation.addArray(ids.value());
+        }
+        if (invisibleIds.has_value())
+        {
+            instrumentation.addArray(invisibleIds.value());
+        }
+    }
+
+    std::string reason;
+    if (!::validatePointInstancer(stage, path, prototypes, protoIndices, positions, orientations, scales, ids, &reason))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    UsdGeomPointInstancer instancer = usdex::core::detail::definePrim<UsdGeomPointInstancer>(stage, path);
+    if (!instancer)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomPointInstancer at \"%s\"", path.GetAsString().c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    // Compute the extent before authoring, as the prototype bounds must be read from the composed stage
+    const VtVec3fArray extent = ::computeInstancerExtent(prototypes, protoIndices, positions, orientations, scales);
+
+    SdfPathVector targets;
+    targets.reserve(prototypes.size());
+    for (const UsdPrim& prototype : prototypes)
+    {
+        targets.push_back(prototype.GetPath());
+    }
+
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
+
+    instancer.CreatePrototypesRel().SetTargets(targets);
+    instancer.CreateProtoIndicesAttr().Set(protoIndices);
+    instancer.CreatePositionsAttr().Set(positions);
+
+    // Block any optional attributes which were not provided, so that weaker opinions can not alter the instances
+    auto setOrBlock = [](const UsdAttribute& attr, const auto& value)
+    {
+        if (value.has_value())
+        {
+            attr.Set(value.value());
+        }
+        else
+        {
+            attr.Block();
+        }
+    };
+    setOrBlock(instancer.CreateOrientationsAttr(), orientations);
+    setOrBlock(instancer.CreateScalesAttr(), scales);
+    setOrBlock(instancer.CreateIdsAttr(), ids);
+    setOrBlock(instancer.CreateInvisibleIdsAttr(), invisibleIds);
+
+    instancer.CreateExtentAttr().Set(extent);
+
+    return instancer;
+}
+
+// Get the references authored on the strongest prim spec of a prim which has any references
+SdfReferenceVector getAuthoredReferences(const UsdPrim& prim)
+{
+    for (const SdfPrimSpecHandle& spec : prim.GetPrimStack())
+    {
+        if (spec->HasReferences())
+        {
+            return spec->GetReferenceList().GetAddedOrExplicitItems();
+        }
+    }
+    return {};
+}
+
+// Decompose a transform into the scale, orientation, and position of an instance, such that `instanceTransform` reconstructs it.
+// The rows of the upper 3x3 are the rotation axes multiplied by the scale, so the scale is the length of each row.
+// Returns false if the axes are not orthogonal, in which case the transform includes shear which can not be represented.
+bool decomposeInstanceTransform(const GfMatrix4d& transform, GfVec3f* position, GfQuath* orientation, GfVec3f* scale)
+{
+    static constexpr double s_tolerance = 1e-5;
+
+    GfVec3d rows[3];
+    GfVec3d lengths;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        rows[i] = GfVec3d(transform[i][0], transform[i][1], transform[i][2]);
+        lengths[i] = rows[i].GetLength();
+    }
+
+    // A negative determinant is represented by negating all three scales
+    if (transform.ExtractRotationMatrix().GetDeterminant() < 0.0)
+    {
+        lengths = -lengths;
+    }
+
+    // Normalize each axis, completing the basis when a single axis has been scaled to zero
+    bool orthogonal = true;
+    size_t numZero = 0;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        if (std::abs(lengths[i]) > std::numeric_limits<double>::epsilon())
+        {
+            rows[i] /= lengths[i];
+        }
+        else
+        {
+            ++numZero;
+        }
+    }
+    if (numZero == 1)
+    {
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (std::abs(lengths[i]) <= std::numeric_limits<double>::epsilon())
+            {
+                rows[i] = GfCross(rows[(i + 1) % 3], rows[(i + 2) % 3]);
+            }
+        }
+    }
+    else if (numZero > 1)
+    {
+        rows[0] = GfVec3d::XAxis();
+        rows[1] = GfVec3d::YAxis();
+        rows[2] = GfVec3d::ZAxis();
+    }
+    else
+    {
+        orthogonal = std::abs(GfDot(rows[0], rows[1])) < s_tolerance && std::abs(GfDot(rows[0], rows[2])) < s_tolerance &&
+                     std::abs(GfDot(rows[1], rows[2])) < s_tolerance;
+    }
+
+    const GfMatrix3d rotation(rows[0][0], rows[0][1], rows[0][2], rows[1][0], rows[1][1], rows[1][2], rows[2][0], rows[2][1], rows[2][2]);
+    *position = GfVec3f(transform.ExtractTranslation());
+    *orientation = GfQuath(rotation.GetOrthonormalized().ExtractRotation().GetQuat());
+    *scale = GfVec3f(lengths);
+    return orthogonal;
+}
+
+} // namespace
+
+UsdGeomPointInstancer usdex::core::definePointInstancer(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const std::vector<UsdPrim>& prototypes,
+    const VtIntArray& protoIndices,
+    const VtVec3fArray& positions,
+    std::optional<const VtQuathArray> orientations,
+    std::optional<const VtVec3fArray> scales,
+    std::optional<const VtInt64Array> ids,
+    std::optional<const VtInt64Array> invisibleIds
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomPointInstancer due to an invalid location: %s", reason.c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    return ::definePointInstancerImpl(stage, path, prototypes, protoIndices, positions, orientations, scales, ids, invisibleIds);
+}
+
+UsdGeomPointInstancer usdex::core::definePointInstancer(
+    UsdPrim parent,
+    const std::string& name,
+    const std::vector<UsdPrim>& prototypes,
+    const VtIntArray& protoIndices,
+    const VtVec3fArray& positions,
+    std::optional<const VtQuathArray> orientations,
+    std::optional<const VtVec3fArray> scales,
+    std::optional<const VtInt64Array> ids,
+    std::optional<const VtInt64Array> invisibleIds
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomPointInstancer due to an invalid location: %s", reason.c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    // Call overloaded function
+    UsdStageWeakPtr stage = parent.GetStage();
+    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
+    return ::definePointInstancerImpl(stage, path, prototypes, protoIndices, positions, orientations, scales, ids, invisibleIds);
+}
+
+UsdGeomPointInstancer usdex::core::convertToPointInstancer(UsdStagePtr stage, const SdfPath& path, const std::vector<UsdPrim>& prims)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "convertToPointInstancer");
+    instrumentation.addElements(prims.size());
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to convert prims to a UsdGeomPointInstancer due to an invalid location: %s", reason.c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    if (prims.empty())
+    {
+        TF_RUNTIME_ERROR("Unable to convert prims to a UsdGeomPointInstancer at \"%s\": No prims were provided", path.GetAsString().c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    // Group the prims by their references, in the order in which each group is first encountered
+    std::map<SdfReferenceVector, int> groups;
+    std::vector<SdfReferenceVector> groupReferences;
+    std::vector<std::string> groupNames;
+    VtIntArray protoIndices(prims.size());
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        const UsdPrim& prim = prims[i];
+        if (!prim || prim.GetStage() != stage)
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to convert prims to a UsdGeomPointInstancer at \"%s\": The prim at index %zu is not a valid prim on the stage",
+                path.GetAsString().c_str(),
+                i
+            );
+            return UsdGeomPointInstancer();
+        }
+
+        // The prims will be deactivated, so the point instancer can not be one of their descendants
+        if (path.HasPrefix(prim.GetPath()))
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to convert prims to a UsdGeomPointInstancer at \"%s\": The prim \"%s\" is an ancestor of the point instancer",
+                path.GetAsString().c_str(),
+                prim.GetPath().GetAsString().c_str()
+            );
+            return UsdGeomPointInstancer();
+        }
+
+        SdfReferenceVector references = ::getAuthoredReferences(prim);
+        if (references.empty())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to convert prims to a UsdGeomPointInstancer at \"%s\": The prim \"%s\" has no references",
+                path.GetAsString().c_str(),
+                prim.GetPath().GetAsString().c_str()
+            );
+            return UsdGeomPointInstancer();
+        }
+
+        auto [it, inserted] = groups.emplace(references, static_cast<int>(groups.size()));
+        if (inserted)
+        {
+            groupReferences.push_back(std::move(references));
+            groupNames.push_back(prim.GetName().GetString());
+        }
+        protoIndices[i] = it->second;
+    }
+
+    // Compute the transform of each prim relative to the parent of the point instancer, prior to authoring any opinions
+    std::vector<GfMatrix4d> transforms(prims.size());
+    {
+        UsdGeomXformCache xformCache;
+        GfMatrix4d parentInverse(1.0);
+        if (UsdPrim parent = stage->GetPrimAtPath(path.GetParentPath()))
+        {
+            parentInverse = xformCache.GetLocalToWorldTransform(parent).GetInverse();
+        }
+        for (size_t i = 0; i < prims.size(); ++i)
+        {
+            transforms[i] = xformCache.GetLocalToWorldTransform(prims[i]) * parentInverse;
+        }
+    }
+
+    // Define a prototype for each group, carrying the same references as the prims
+    const UsdGeomScope scope = usdex::core::detail::definePrim<UsdGeomScope>(stage, path.AppendChild(TfToken("Prototypes")));
+    if (!scope)
+    {
+        TF_RUNTIME_ERROR("Unable to convert prims to a UsdGeomPointInstancer at \"%s\": Unable to define the prototypes", path.GetAsString().c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    const TfTokenVector prototypeNames = usdex::core::getValidPrimNames(groupNames);
+    std::vector<UsdPrim> prototypes;
+    prototypes.reserve(groupReferences.size());
+    for (size_t g = 0; g < groupReferences.size(); ++g)
+    {
+        UsdPrim prototype = stage->DefinePrim(scope.GetPath().AppendChild(prototypeNames[g]));
+        for (const SdfReference& reference : groupReferences[g])
+        {
+            prototype.GetReferences().AddReference(reference);
+        }
+        prototypes.push_back(prototype);
+    }
+
+    // The prototype transforms (e.g. authored on the root prim of a referenced asset) are applied before the instance transforms
+    std::vector<GfMatrix4d> prototypeInverses(prototypes.size());
+    {
+        UsdGeomXformCache xformCache;
+        for (size_t g = 0; g < prototypes.size(); ++g)
+        {
+            bool resetsXformStack = false;
+            prototypeInverses[g] = xformCache.GetLocalTransformation(prototypes[g], &resetsXformStack).GetInverse();
+        }
+    }
+
+    // Decompose the instance transforms concurrently
+    VtVec3fArray positions(prims.size());
+    VtQuathArray orientations(prims.size());
+    VtVec3fArray scales(prims.size());
+    std::vector<char> orthogonal(prims.size(), 1);
+    {
+        GfVec3f* positionsData = positions.data();
+        GfQuath* orientationsData = orientations.data();
+        GfVec3f* scalesData = scales.data();
+        const int* protoIndicesData = protoIndices.cdata();
+        WorkParallelForN(
+            prims.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const GfMatrix4d transform = prototypeInverses[protoIndicesData[i]] * transforms[i];
+                    orthogonal[i] = ::decomposeInstanceTransform(transform, &positionsData[i], &orientationsData[i], &scalesData[i]);
+                }
+            }
+        );
+    }
+
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        if (!orthogonal[i])
+        {
+            TF_WARN(
+                "The transform of \"%s\" includes shear which can not be represented by the UsdGeomPointInstancer at \"%s\". The shear has been "
+                "discarded.",
+                prims[i].GetPath().GetAsString().c_str(),
+                path.GetAsString().c_str()
+            );
+        }
+    }
+
+    UsdGeomPointInstancer instancer = ::definePointInstancerImpl(
+        stage,
+        path,
+        prototypes,
+        protoIndices,
+        positions,
+        orientations,
+        scales,
+        std::nullopt,
+        std::nullopt
+    );
+    if (!instancer)
+    {
+        return UsdGeomPointInstancer();
+    }
+
+    // Deactivate the original prims, so that they are no longer composed or imaged
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
+    for (const UsdPrim& prim : prims)
+    {
+        prim.SetActive(false);
+    }
+
+    return instancer;
+}
@@ -4,6 +4,118 @@
 
 #include "usdex/core/PrimvarData.h"
 
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/reduce.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+
+thread_local usdex::core::PrimvarPrecision g_primvarPrecision = usdex::core::PrimvarPrecision::eFloat;
+thread_local double g_primvarPrecisionError = 0.0;
+
+// Hashing and equality used to deduplicate values when indexing `PrimvarData`.
+//
+// Values are always compared for equality, the hash is only used to distribute them, so distinct values which hash equally are never merged.
+template <typename T>
+struct PrimvarValueTraits
+{
+    static size_t hash(const T& value)
+    {
+        return pxr::TfHash()(value);
+    }
+
+    static bool equal(const T& lhs, const T& rhs)
+    {
+        return lhs == rhs;
+    }
+};
+
+// Hashing and equality for values composed of `N` single precision floats, operating directly on their bit patterns.
+//
+// Negative zero is treated as positive zero, so that the results agree with the equality operator for all numeric values.
+// Unlike the equality operator, NaN values with identical bit patterns are considered equal and will be merged.
+template <typename T, size_t N>
+struct FloatBitsPrimvarValueTraits
+{
+    static_assert(sizeof(T) == N * sizeof(uint32_t), "FloatBitsPrimvarValueTraits requires a tightly packed array of floats");
+
+    static void bits(const T& value, uint32_t (&result)[N])
+    {
+        std::memcpy(result, &value, sizeof(T));
+        for (size_t i = 0; i < N; ++i)
+        {
+            if ((result[i] & 0x7fffffff) == 0)
+            {
+                result[i] = 0;
+            }
+        }
+    }
+
+    static size_t hash(const T& value)
+    {
+        uint32_t valueBits[N];
+        bits(value, valueBits);
+        size_t result = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            result = pxr::TfHash::Combine(result, valueBits[i]);
+        }
+        return result;
+    }
+
+    static bool equal(const T& lhs, const T& rhs)
+    {
+        uint32_t lhsBits[N];
+        uint32_t rhsBits[N];
+        bits(lhs, lhsBits);
+        bits(rhs, rhsBits);
+        return std::memcmp(lhsBits, rhsBits, sizeof(lhsBits)) == 0;
+    }
+};
+
+template <>
+struct PrimvarValueTraits<float> : FloatBitsPrimvarValueTraits<float, 1>
+{
+};
+
+template <>
+struct PrimvarValueTraits<pxr::GfVec2f> : FloatBitsPrimvarValueTraits<pxr::GfVec2f, 2>
+{
+};
+
+template <>
+struct PrimvarValueTraits<pxr::GfVec3f> : FloatBitsPrimvarValueTraits<pxr::GfVec3f, 3>
+{
+};
+
+// The absolute difference between a value and its converted value.
+double precisionError(float value, pxr::GfHalf converted)
+{
+    return std::abs(static_cast<double>(converted) - static_cast<double>(value));
+}
+
+// The largest absolute difference between any component of a vector and its converted vector.
+template <typename V, typename H>
+double precisionError(const V& value, const H& converted)
+{
+    double result = 0.0;
+    for (size_t i = 0; i < V::dimension; ++i)
+    {
+        result = std::max(result, precisionError(value[i], converted[i]));
+    }
+    return result;
+}
+
+} // namespace
+
 namespace usdex::core
 {
 
@@ -16,4 +128,187 @@ template class PrimvarData<pxr::TfToken>;
 template class PrimvarData<pxr::GfVec2f>;
 template class PrimvarData<pxr::GfVec3f>;
 
+PrimvarPrecision getPrimvarPrecision()
+{
+    return g_primvarPrecision;
+}
+
+void setPrimvarPrecision(PrimvarPrecision value)
+{
+    g_primvarPrecision = value;
+}
+
+ScopedPrimvarPrecision::ScopedPrimvarPrecision(PrimvarPrecision value) : m_previous(g_primvarPrecision), m_previousError(g_primvarPrecisionError)
+{
+    g_primvarPrecision = value;
+    g_primvarPrecisionError = 0.0;
+}
+
+ScopedPrimvarPrecision::~ScopedPrimvarPrecision()
+{
+    // The error of this scope also contributes to any enclosing scope
+    g_primvarPrecision = m_previous;
+    g_primvarPrecisionError = std::max(m_previousError, g_primvarPrecisionError);
+}
+
+double ScopedPrimvarPrecision::getMaxError() const
+{
+    return g_primvarPrecisionError;
+}
+
+void detail::recordPrimvarPrecisionError(double error)
+{
+    g_primvarPrecisionError = std::max(g_primvarPrecisionError, error);
+}
+
+// Large arrays are hashed in parallel and then distributed into partitions by hash. Each partition is deduplicated independently,
+// as equal values always share a partition, and the final indices are assigned serially in order of first occurrence.
+template <typename T>
+void detail::computeIndexing(const pxr::VtArray<T>& flattenedValues, pxr::VtArray<T>& indexedValues, pxr::VtIntArray& indices)
+{
+    using Traits = PrimvarValueTraits<T>;
+
+    // Arrays smaller than this are not worth distributing across threads
+    constexpr size_t s_parallelThreshold = 16384;
+    constexpr size_t s_numPartitions = 64;
+
+    const size_t numValues = flattenedValues.size();
+    const size_t numPartitions = (numValues < s_parallelThreshold) ? 1 : s_numPartitions;
+
+    // Compute the hash of every value
+    std::vector<size_t> hashes(numValues);
+    pxr::WorkParallelForN(
+        numValues,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                hashes[i] = Traits::hash(flattenedValues[i]);
+            }
+        }
+    );
+
+    // Distribute the values into partitions, retaining their relative order
+    std::vector<std::vector<size_t>> partitions(numPartitions);
+    if (numPartitions > 1)
+    {
+        for (auto& partition : partitions)
+        {
+            partition.reserve(numValues / numPartitions);
+        }
+        for (size_t i = 0; i < numValues; ++i)
+        {
+            partitions[hashes[i] % numPartitions].push_back(i);
+        }
+    }
+
+    // Find the position of the first occurrence of each value within its partition
+    // Elements are keyed by their position in the flattened values, hashed by the precomputed hash and compared by value.
+    auto hashFn = [&hashes](size_t i)
+    {
+        return hashes[i];
+    };
+    auto equalFn = [&flattenedValues](size_t lhs, size_t rhs)
+    {
+        return Traits::equal(flattenedValues[lhs], flattenedValues[rhs]);
+    };
+    std::vector<size_t> firstOccurrence(numValues);
+    pxr::WorkParallelForN(
+        numPartitions,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t p = begin; p < end; ++p)
+            {
+                const bool partitioned = (numPartitions > 1);
+                const size_t partitionSize = partitioned ? partitions[p].size() : numValues;
+                std::unordered_set<size_t, decltype(hashFn), decltype(equalFn)> seen(partitionSize, hashFn, equalFn);
+                for (size_t j = 0; j < partitionSize; ++j)
+                {
+                    const size_t i = partitioned ? partitions[p][j] : j;
+                    firstOccurrence[i] = *seen.insert(i).first;
+                }
+            }
+        },
+        /* grainSize */ 1
+    );
+
+    // Assign the indices in order of first occurrence so that the result matches a serial traversal
+    indices.resize(numValues);
+    int* indicesData = indices.data();
+    for (size_t i = 0; i < numValues; ++i)
+    {
+        const size_t first = firstOccurrence[i];
+        if (first == i)
+        {
+            indicesData[i] = static_cast<int>(indexedValues.size());
+            indexedValues.push_back(flattenedValues[i]);
+        }
+        else
+        {
+            indicesData[i] = indicesData[first];
+        }
+    }
+}
+
+// NaN values do not contribute to the error, as `std::max` retains the existing error when compared with NaN.
+template <typename T, typename H>
+double detail::convertToHalf(const pxr::VtArray<T>& values, pxr::VtArray<H>& result)
+{
+    result.resize(values.size());
+    const T* src = values.cdata();
+    H* dst = result.data();
+    return pxr::WorkParallelReduceN(
+        0.0,
+        values.size(),
+        [src, dst](size_t begin, size_t end, double error)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                dst[i] = H(src[i]);
+                error = std::max(error, precisionError(src[i], dst[i]));
+            }
+            return error;
+        },
+        [](double lhs, double rhs)
+        {
+            return std::max(lhs, rhs);
+        }
+    );
+}
+
+template <typename H, typename T>
+void detail::convertFromHalf(const pxr::VtArray<H>& values, pxr::VtArray<T>& result)
+{
+    result.resize(values.size());
+    const H* src = values.cdata();
+    T* dst = result.data();
+    pxr::WorkParallelForN(
+        values.size(),
+        [src, dst](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                dst[i] = T(src[i]);
+            }
+        }
+    );
+}
+
+// explicitly instantiate the indexing and precision conversions for each of the types we defined in the public header.
+template USDEX_API void detail::computeIndexing(const pxr::VtArray<float>&, pxr::VtArray<float>&, pxr::VtIntArray&);
+template USDEX_API void detail::computeIndexing(const pxr::VtArray<int64_t>&, pxr::VtArray<int64_t>&, pxr::VtIntArray&);
+template USDEX_API void detail::computeIndexing(const pxr::VtArray<int>&, pxr::VtArray<int>&, pxr::VtIntArray&);
+template USDEX_API void detail::computeIndexing(const pxr::VtArray<std::string>&, pxr::VtArray<std::string>&, pxr::VtIntArray&);
+template USDEX_API void detail::computeIndexing(const pxr::VtArray<pxr::TfToken>&, pxr::VtArray<pxr::TfToken>&, pxr::VtIntArray&);
+template USDEX_API void detail::computeIndexing(const pxr::VtArray<pxr::GfVec2f>&, pxr::VtArray<pxr::GfVec2f>&, pxr::VtIntArray&);
+template USDEX_API void detail::computeIndexing(const pxr::VtArray<pxr::GfVec3f>&, pxr::VtArray<pxr::GfVec3f>&, pxr::VtIntArray&);
+
+template USDEX_API double detail::convertToHalf(const pxr::VtArray<float>&, pxr::VtArray<pxr::GfHalf>&);
+template USDEX_API double detail::convertToHalf(const pxr::VtArray<pxr::GfVec2f>&, pxr::VtArray<pxr::GfVec2h>&);
+template USDEX_API double detail::convertToHalf(const pxr::VtArray<pxr::GfVec3f>&, pxr::VtArray<pxr::GfVec3h>&);
+
+template USDEX_API void detail::convertFromHalf(const pxr::VtArray<pxr::GfHalf>&, pxr::VtArray<float>&);
+template USDEX_API void detail::convertFromHalf(const pxr::VtArray<pxr::GfVec2h>&, pxr::VtArray<pxr::GfVec2f>&);
+template USDEX_API void detail::convertFromHalf(const pxr::VtArray<pxr::GfVec3h>&, pxr::VtArray<pxr::GfVec3f>&);
+
 } // namespace usdex::core
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "SdfUtils.h"
+
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/sdf/relationshipSpec.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/tokens.h>
+
+#include <algorithm>
+
+using namespace pxr;
+
+SdfPrimSpecHandle usdex::core::detail::definePrimSpec(UsdStagePtr stage, const SdfPath& path, const TfToken& typeName)
+{
+    TRACE_FUNCTION();
+
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    const SdfPath specPath = editTarget.MapToSpecPath(path);
+    if (!layer || specPath.IsEmpty())
+    {
+        return SdfPrimSpecHandle();
+    }
+
+    // SdfCreatePrimInLayer will author "over" specs for the prim and any missing ancestors
+    SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(layer, specPath);
+    if (!primSpec)
+    {
+        return SdfPrimSpecHandle();
+    }
+    primSpec->SetSpecifier(SdfSpecifierDef);
+    primSpec->SetTypeName(typeName);
+
+    // Promote any ancestors which are not already defined on the stage to "def" specs
+    // A defined prim implies that all of its ancestors are also defined, so we can stop at the first one we find.
+    for (SdfPath ancestorPath = path.GetParentPath(); !ancestorPath.IsAbsoluteRootPath(); ancestorPath = ancestorPath.GetParentPath())
+    {
+        const UsdPrim ancestor = stage->GetPrimAtPath(ancestorPath);
+        if (ancestor && ancestor.IsDefined())
+        {
+            break;
+        }
+
+        SdfPrimSpecHandle ancestorSpec = layer->GetPrimAtPath(editTarget.MapToSpecPath(ancestorPath));
+        if (ancestorSpec && ancestorSpec->GetSpecifier() == SdfSpecifierOver)
+        {
+            ancestorSpec->SetSpecifier(SdfSpecifierDef);
+        }
+    }
+
+    return primSpec;
+}
+
+bool usdex::core::detail::addAppliedSchema(const SdfPrimSpecHandle& spec, const TfToken& schemaName)
+{
+    if (!spec)
+    {
+        return false;
+    }
+
+    SdfTokenListOp listOp = spec->GetInfo(UsdTokens->apiSchemas).GetWithDefault<SdfTokenListOp>();
+    if (listOp.IsExplicit())
+    {
+        TfTokenVector items = listOp.GetExplicitItems();
+        if (std::find(items.begin(), items.end(), schemaName) != items.end())
+        {
+            return true;
+        }
+        items.push_back(schemaName);
+        listOp.SetExplicitItems(items);
+    }
+    else
+    {
+        const TfTokenVector& prepended = listOp.GetPrependedItems();
+        const TfTokenVector& appended = listOp.GetAppendedItems();
+        if (std::find(prepended.begin(), prepended.end(), schemaName) != prepended.end() ||
+            std::find(appended.begin(), appended.end(), schemaName) != appended.end())
+        {
+            return true;
+        }
+
+        TfTokenVector deleted = listOp.GetDeletedItems();
+        deleted.erase(std::remove(deleted.begin(), deleted.end(), schemaName), deleted.end());
+        listOp.SetDeletedItems(deleted);
+
+        TfTokenVector items = prepended;
+        items.push_back(schemaName);
+        listOp.SetPrependedItems(items);
+    }
+
+    spec->SetInfo(UsdTokens->apiSchemas, VtValue::Take(listOp));
+    return true;
+}
+
+bool usdex::core::detail::setRelationshipTarget(const SdfPrimSpecHandle& spec, const TfToken& name, const SdfPath& target)
+{
+    if (!spec)
+    {
+        return false;
+    }
+
+    SdfRelationshipSpecHandle rel = spec->GetLayer()->GetRelationshipAtPath(spec->GetPath().AppendProperty(name));
+    if (!rel)
+    {
+        rel = SdfRelationshipSpec::New(spec, name, /* custom */ false);
+    }
+    if (!rel)
+    {
+        return false;
+    }
+
+    SdfTargetsProxy targets = rel->GetTargetPathList();
+    targets.ClearEditsAndMakeExplicit();
+    targets.GetExplicitItems().push_back(target);
+    return true;
+}
@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/Authoring.h"
+
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace usdex::core::detail
+{
+
+//! Author a "def" prim spec with the given type name at the current edit target of the stage.
+//!
+//! This mimics `UsdStage::DefinePrim`, but it operates directly on the `SdfLayer` of the edit target and does not require the stage to recompose.
+//! It is therefore safe to call within an `SdfChangeBlock`, which allows many prims to be defined with a single round of change processing.
+//!
+//! Any ancestors which are not yet defined will have a "def" specifier authored, matching the behavior of `UsdStage::DefinePrim`.
+//!
+//! @note The location must be validated (e.g. using `isEditablePrimLocation`) prior to calling this function.
+//!
+//! @param stage The stage on which to define the prim
+//! @param path The absolute prim path at which to define the prim
+//! @param typeName The type name to author on the prim spec
+//! @returns The authored prim spec or an invalid handle if the spec could not be authored.
+pxr::SdfPrimSpecHandle definePrimSpec(pxr::UsdStagePtr stage, const pxr::SdfPath& path, const pxr::TfToken& typeName);
+
+//! Add an applied API schema to the `apiSchemas` of a prim spec, in the same way as `UsdPrim::AddAppliedSchema`.
+//!
+//! The schema is appended to the explicit items of an explicit list op, and is otherwise prepended (and removed from the deleted items) unless
+//! it is already prepended or appended. As this only edits the prim spec, it is safe to call within an `SdfChangeBlock`.
+//!
+//! @param spec The prim spec on which to apply the schema
+//! @param schemaName The name of the API schema (e.g. "MaterialBindingAPI")
+//! @returns False if the spec is invalid.
+bool addAppliedSchema(const pxr::SdfPrimSpecHandle& spec, const pxr::TfToken& schemaName);
+
+//! Set the single explicit target of a relationship on a prim spec, creating the relationship spec if it does not exist.
+//!
+//! This mimics `UsdRelationship::SetTargets` with a single target, but as it only edits the prim spec, it is safe to call within an
+//! `SdfChangeBlock`.
+//!
+//! @param spec The prim spec which owns the relationship
+//! @param name The name of the relationship (e.g. "material:binding")
+//! @param target The target path, which must already be mapped to the namespace of the layer of the spec
+//! @returns False if the spec is invalid or the relationship could not be authored.
+bool setRelationshipTarget(const pxr::SdfPrimSpecHandle& spec, const pxr::TfToken& name, const pxr::SdfPath& target);
+
+//! Define a prim of the given schema type at the current edit target of the stage, using the `AuthoringBackend` of the calling thread.
+//!
+//! With `AuthoringBackend::eUsd` this calls `Schema::Define`, with `AuthoringBackend::eSdf` the prim spec is authored with `definePrimSpec`
+//! within an `SdfChangeBlock`. In both cases the specifier and type name are explicitly authored on the prim spec.
+//!
+//! @note The location must be validated (e.g. using `isEditablePrimLocation`) prior to calling this function.
+//!
+//! @param stage The stage on which to define the prim
+//! @param path The absolute prim path at which to define the prim
+//! @returns The defined prim or an invalid schema object if the prim could not be defined.
+template <typename Schema>
+Schema definePrim(pxr::UsdStagePtr stage, const pxr::SdfPath& path)
+{
+    if (usdex::core::getAuthoringBackend() == usdex::core::AuthoringBackend::eSdf)
+    {
+        static const pxr::TfToken s_typeName = pxr::UsdSchemaRegistry::GetSchemaTypeName<Schema>();
+        {
+            pxr::SdfChangeBlock changeBlock;
+            if (!definePrimSpec(stage, path, s_typeName))
+            {
+                return Schema();
+            }
+        }
+        return Schema(stage->GetPrimAtPath(path));
+    }
+
+    Schema schema = Schema::Define(stage, path);
+    if (schema)
+    {
+        // Explicitly author the specifier and type name
+        pxr::UsdPrim prim = schema.GetPrim();
+        prim.SetSpecifier(pxr::SdfSpecifierDef);
+        prim.SetTypeName(prim.GetTypeName());
+    }
+    return schema;
+}
+
+//! Batch the authoring of properties on an existing prim within an `SdfChangeBlock` when the `AuthoringBackend` of the calling thread is
+//! `AuthoringBackend::eSdf`. With `AuthoringBackend::eUsd` this has no effect.
+//!
+//! @warning No prims may be defined while this object is alive, as the stage can not recompose them until the change block is closed.
+class AuthoringChangeBlock
+{
+
+public:
+
+    AuthoringChangeBlock()
+    {
+        if (usdex::core::getAuthoringBackend() == usdex::core::AuthoringBackend::eSdf)
+        {
+            m_changeBlock.emplace();
+        }
+    }
+
+    AuthoringChangeBlock(const AuthoringChangeBlock&) = delete;
+    AuthoringChangeBlock& operator=(const AuthoringChangeBlock&) = delete;
+
+private:
+
+    std::optional<pxr::SdfChangeBlock> m_changeBlock;
+};
+
+//! Get whether the parent of a prim location is an instance or instance proxy, as cached by the `AuthoringSession` of the calling thread.
+//!
+//! Only the children of an instance or instance proxy can be instance proxies, so the prim need not be looked up otherwise.
+//!
+//! @param stage The stage of the prim location
+//! @param parentPath The path of the parent of the prim location
+//! @returns std::nullopt if there is no active session for the stage on the calling thread. Otherwise, whether the parent is an instance or
+//!     instance proxy.
+std::optional<bool> isSessionParentInstanced(const pxr::UsdStagePtr& stage, const pxr::SdfPath& parentPath);
+
+//! Author time samples for an attribute to the clip layers of the `ValueClipSession` of the calling thread.
+//!
+//! @param attribute The attribute on which to author the time samples
+//! @param times The stage times at which to author values. These must not be `UsdTimeCode::Default()`.
+//! @param valueAt A callable returning the value for the time at a given index. It is called concurrently.
+//! @returns std::nullopt if there is no active session on the calling thread, or if the attribute is not within the clip prim of the session.
+//!     Otherwise, whether the time samples were authored to the clip layers.
+std::optional<bool> setValueClipTimeSamples(
+    const pxr::UsdAttribute& attribute,
+    const std::vector<pxr::UsdTimeCode>& times,
+    const std::function<pxr::VtValue(size_t)>& valueAt
+);
+
+//! Author time samples for an attribute directly on the `SdfLayer` of the current edit target.
+//!
+//! This mimics calling `UsdAttribute::Set` for each time, including mapping the times through any layer offsets of the edit target, but does
+//! not require the stage to process a change for each sample. It is therefore safe (and most efficient) to call within an `SdfChangeBlock`.
+//!
+//! The samples of attributes within the clip prim of an active `ValueClipSession` are instead authored to its clip layers.
+//!
+//! @note The attribute must already have a spec in the edit target layer (e.g. by calling `UsdPrim::CreateAttribute` beforehand).
+//!
+//! @param attribute The attribute on which to author the time samples
+//! @param times The stage times at which to author values. These must not be `UsdTimeCode::Default()`.
+//! @param valueAt A callable returning the value for the time at a given index. It must be safe to call concurrently.
+//! @returns False if the attribute spec could not be found on the edit target layer.
+template <typename Fn>
+bool setTimeSamples(const pxr::UsdAttribute& attribute, const std::vector<pxr::UsdTimeCode>& times, Fn&& valueAt)
+{
+    const std::optional<bool> clipped = setValueClipTimeSamples(
+        attribute,
+        times,
+        [&valueAt](size_t i)
+        {
+            return pxr::VtValue(valueAt(i));
+        }
+    );
+    if (clipped.has_value())
+    {
+        return clipped.value();
+    }
+
+    const pxr::UsdEditTarget& editTarget = attribute.GetStage()->GetEditTarget();
+    const pxr::SdfLayerHandle& layer = editTarget.GetLayer();
+    const pxr::SdfPath specPath = editTarget.MapToSpecPath(attribute.GetPath());
+    if (!layer || !layer->GetAttributeAtPath(specPath))
+    {
+        return false;
+    }
+
+    const pxr::SdfLayerOffset stageToLayer = editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+    for (size_t i = 0; i < times.size(); ++i)
+    {
+        layer->SetTimeSample(specPath, stageToLayer * times[i].GetValue(), valueAt(i));
+    }
+    return true;
+}
+
+} // namespace usdex::core::detail
@@ -6,11 +6,25 @@
 
 #include "usdex/core/LayerAlgo.h"
 
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/detachedTask.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdPhysics/metrics.h>
 #include <pxr/usd/usdUtils/authoring.h>
+#include <pxr/usd/usdUtils/dependencies.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 using namespace pxr;
 
@@ -134,35 +148,20 @@ bool uncheckedConfigureStage(
     return true;
 }
 
-} // namespace
-
-UsdStageRefPtr usdex::core::createStage(
+// Validate the arguments of the functions which create a new stage, issuing a warning describing the first invalid argument
+bool validateCreateStageArguments(
     const std::string& identifier,
     const std::string& defaultPrimName,
     const TfToken& upAxis,
     const double linearUnits,
-    const std::string& authoringMetadata,
-    const SdfLayer::FileFormatArguments& fileFormatArgs
-)
-{
-    return createStage(identifier, defaultPrimName, upAxis, linearUnits, UsdPhysicsMassUnits::kilograms, authoringMetadata, fileFormatArgs);
-}
-
-UsdStageRefPtr usdex::core::createStage(
-    const std::string& identifier,
-    const std::string& defaultPrimName,
-    const TfToken& upAxis,
-    const double linearUnits,
-    const double massUnits,
-    const std::string& authoringMetadata,
-    const SdfLayer::FileFormatArguments& fileFormatArgs
+    const double massUnits
 )
 {
     // Early out on an unsupported identifier
     if (identifier.empty() || !UsdStage::IsSupportedFile(identifier))
     {
         TF_WARN("Unable to create UsdStage at \"%s\" due to an invalid identifier", identifier.c_str());
-        return nullptr;
+        return false;
     }
 
     // Early out on an invalid default prim name
@@ -173,7 +172,7 @@ UsdStageRefPtr usdex::core::createStage(
             identifier.c_str(),
             defaultPrimName.c_str()
         );
-        return nullptr;
+        return false;
     }
 
     // Early out on invalid stage metrics
@@ -181,6 +180,228 @@ UsdStageRefPtr usdex::core::createStage(
     if (!validateStageMetrics(upAxis, linearUnits, massUnits, &reason))
     {
         TF_WARN("Unable to create UsdStage at \"%s\" due to invalid stage metrics: %s", identifier.c_str(), reason.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// Make asset paths which are absolute filesystem paths within the directory of the identifier relative to the identifier
+void relativizeAssetPaths(const SdfLayerHandle& layer, const std::string& identifier)
+{
+    // Only filesystem identifiers can be related to filesystem asset paths
+    if (identifier.find("://") != std::string::npos)
+    {
+        return;
+    }
+
+    const std::string directory = TfGetPathName(TfAbsPath(identifier));
+    if (directory.empty())
+    {
+        return;
+    }
+
+    UsdUtilsModifyAssetPaths(
+        layer,
+        [&directory](const std::string& assetPath)
+        {
+            if (assetPath.empty() || TfIsRelativePath(assetPath) || assetPath.find("://") != std::string::npos)
+            {
+                return assetPath;
+            }
+
+            const std::string normalized = TfNormPath(assetPath);
+            if (TfStringStartsWith(normalized, directory))
+            {
+                return "./" + normalized.substr(directory.size());
+            }
+            return assetPath;
+        }
+    );
+}
+
+// Apply the authoring metadata and comment to the layers that are about to be saved
+void annotateDirtyLayers(
+    const SdfLayerHandleVector& dirtyLayers,
+    const std::optional<std::string_view>& authoringMetadata,
+    const std::optional<std::string_view>& comment
+)
+{
+    if (authoringMetadata.has_value())
+    {
+        for (const auto& layer : dirtyLayers)
+        {
+            if (!layer->IsAnonymous() && !usdex::core::hasLayerAuthoringMetadata(layer))
+            {
+                usdex::core::setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
+            }
+        }
+    }
+
+    if (comment.has_value())
+    {
+        for (const auto& layer : dirtyLayers)
+        {
+            if (!layer->IsAnonymous())
+            {
+                layer->SetComment(comment.value().data());
+            }
+        }
+    }
+}
+
+// Saving is bound by I/O and encoding rather than compute, so beyond this many concurrent saves the layers only contend for bandwidth
+static constexpr size_t s_maxConcurrentLayerSaves = 8;
+
+// Gather the dirty layers that `UsdStage::Save` would write, which excludes anonymous layers and the session layer stack
+SdfLayerHandleVector getLayersToSave(UsdStagePtr stage, const SdfLayerHandleVector& dirtyLayers)
+{
+    const SdfLayerHandleVector rootLayerStack = stage->GetLayerStack(/* includeSessionLayers */ false);
+    const SdfLayerHandleVector sessionLayerStack = stage->GetLayerStack(/* includeSessionLayers */ true);
+
+    SdfLayerHandleVector result;
+    result.reserve(dirtyLayers.size());
+    for (const SdfLayerHandle& layer : dirtyLayers)
+    {
+        if (layer->IsAnonymous())
+        {
+            continue;
+        }
+
+        const bool inSessionLayerStack = std::find(sessionLayerStack.begin(), sessionLayerStack.end(), layer) != sessionLayerStack.end() &&
+                                         std::find(rootLayerStack.begin(), rootLayerStack.end(), layer) == rootLayerStack.end();
+        if (!inSessionLayerStack)
+        {
+            result.push_back(layer);
+        }
+    }
+    return result;
+}
+
+// Call "saveAt" for each index in [0, count) using a bounded number of concurrent tasks, each of which claims the next unsaved index
+// All indices are attempted even if some fail. Returns false if any call failed.
+template <typename SaveFn>
+bool saveLayersConcurrently(size_t count, SaveFn&& saveAt)
+{
+    TRACE_FUNCTION();
+
+    std::atomic<size_t> next = 0;
+    std::atomic<bool> success = true;
+    WorkParallelForN(
+        std::min(count, s_maxConcurrentLayerSaves),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t task = begin; task < end; ++task)
+            {
+                for (size_t index = next++; index < count; index = next++)
+                {
+                    if (!saveAt(index))
+                    {
+                        success = false;
+                    }
+                }
+            }
+        },
+        /* grainSize */ 1
+    );
+    return success;
+}
+
+// Annotate and save the dirty layers of a stage, counting the layers saved by the instrumentation of the calling entry point
+bool saveDirtyLayers(
+    UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata,
+    std::optional<std::string_view> comment,
+    usdex::core::detail::ScopedInstrumentation& instrumentation
+)
+{
+    SdfLayerHandleVector dirtyLayers = UsdUtilsGetDirtyLayers(stage);
+    ::annotateDirtyLayers(dirtyLayers, authoringMetadata, comment);
+
+    if (comment.has_value())
+    {
+        TF_STATUS("Saving \"%s\" with comment \"%s\"", UsdDescribe(stage).c_str(), comment.value().data());
+    }
+    else
+    {
+        TF_STATUS("Saving \"%s\"", UsdDescribe(stage).c_str());
+    }
+
+    // Layers which can not be saved are reported on the calling thread, as in saveStageAsync
+    SdfLayerHandleVector layers = ::getLayersToSave(stage, dirtyLayers);
+    instrumentation.addElements(layers.size());
+    bool success = true;
+    auto withoutPermission = std::stable_partition(
+        layers.begin(),
+        layers.end(),
+        [](const SdfLayerHandle& layer)
+        {
+            return layer->PermissionToSave();
+        }
+    );
+    for (auto it = withoutPermission; it != layers.end(); ++it)
+    {
+        TF_WARN("Unable to save layer \"%s\" as permission to save has been disabled", (*it)->GetIdentifier().c_str());
+        success = false;
+    }
+    layers.erase(withoutPermission, layers.end());
+
+    // Each layer is serialized independently, so the layers can be saved concurrently
+    success &= ::saveLayersConcurrently(
+        layers.size(),
+        [&layers](size_t index)
+        {
+            if (!layers[index]->Save())
+            {
+                TF_WARN("Failed to save layer \"%s\"", layers[index]->GetIdentifier().c_str());
+                return false;
+            }
+            return true;
+        }
+    );
+    return success;
+}
+
+// An in-memory copy of a dirty layer, along with everything required to write it in place of the original layer
+struct LayerSnapshot
+{
+    SdfLayerRefPtr layer;
+    std::string identifier;
+    std::string resolvedPath;
+    SdfLayer::FileFormatArguments fileFormatArgs;
+};
+
+} // namespace
+
+UsdStageRefPtr usdex::core::createStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const std::string& authoringMetadata,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    TRACE_FUNCTION();
+
+    return createStage(identifier, defaultPrimName, upAxis, linearUnits, UsdPhysicsMassUnits::kilograms, authoringMetadata, fileFormatArgs);
+}
+
+UsdStageRefPtr usdex::core::createStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "createStage");
+
+    if (!::validateCreateStageArguments(identifier, defaultPrimName, upAxis, linearUnits, massUnits))
+    {
         return nullptr;
     }
 
@@ -215,6 +436,53 @@ UsdStageRefPtr usdex::core::createStage(
     return UsdStage::Open(identifier);
 }
 
+UsdStageRefPtr usdex::core::createInMemoryStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const std::string& authoringMetadata,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    TRACE_FUNCTION();
+
+    return createInMemoryStage(identifier, defaultPrimName, upAxis, linearUnits, UsdPhysicsMassUnits::kilograms, authoringMetadata, fileFormatArgs);
+}
+
+UsdStageRefPtr usdex::core::createInMemoryStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "createInMemoryStage");
+
+    if (!::validateCreateStageArguments(identifier, defaultPrimName, upAxis, linearUnits, massUnits))
+    {
+        return nullptr;
+    }
+
+    // The identifier is the tag of the anonymous layer, and the file format arguments are retained by the layer until it is exported
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous(identifier, fileFormatArgs);
+    if (!layer)
+    {
+        return nullptr;
+    }
+
+    UsdStageRefPtr stage = UsdStage::Open(layer);
+    if (!stage || !uncheckedConfigureStage(stage, defaultPrimName, upAxis, linearUnits, massUnits, authoringMetadata))
+    {
+        return nullptr;
+    }
+    return stage;
+}
+
 bool usdex::core::configureStage(
     UsdStagePtr stage,
     const std::string& defaultPrimName,
@@ -223,6 +491,8 @@ bool usdex::core::configureStage(
     std::optional<std::string_view> authoringMetadata
 )
 {
+    TRACE_FUNCTION();
+
     return configureStage(stage, defaultPrimName, upAxis, linearUnits, UsdPhysicsMassUnits::kilograms, authoringMetadata);
 }
 
@@ -235,6 +505,8 @@ bool usdex::core::configureStage(
     std::optional<std::string_view> authoringMetadata
 )
 {
+    TRACE_FUNCTION();
+
     // Validate the default prim name
     if (!SdfPath::IsValidIdentifier(defaultPrimName))
     {
@@ -262,39 +534,134 @@ bool usdex::core::configureStage(
 
 void usdex::core::saveStage(UsdStagePtr stage, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
 {
-    SdfLayerHandleVector dirtyLayers = UsdUtilsGetDirtyLayers(stage);
-    if (authoringMetadata.has_value())
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "saveStage");
+
+    ::saveDirtyLayers(stage, authoringMetadata, comment, instrumentation);
+}
+
+bool usdex::core::saveDirtyLayers(UsdStagePtr stage, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "saveDirtyLayers");
+
+    return ::saveDirtyLayers(stage, authoringMetadata, comment, instrumentation);
+}
+
+bool usdex::core::exportInMemoryStage(UsdStagePtr stage, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "exportInMemoryStage");
+
+    SdfLayerHandle layer = stage->GetRootLayer();
+    if (!layer->IsAnonymous())
     {
-        for (auto& layer : dirtyLayers)
-        {
-            if (!layer->IsAnonymous() && !hasLayerAuthoringMetadata(layer))
-            {
-                setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
-            }
-        }
+        TF_WARN("Unable to export UsdStage \"%s\" as the root layer is not an in-memory layer", UsdDescribe(stage).c_str());
+        return false;
+    }
+
+    // The tag of the anonymous layer is the identifier it was created for
+    const std::string identifier = layer->GetDisplayName();
+    if (identifier.empty() || !UsdStage::IsSupportedFile(identifier))
+    {
+        TF_WARN("Unable to export UsdStage to \"%s\" due to an invalid identifier", identifier.c_str());
+        return false;
     }
 
+    // The root layer is anonymous, so the metadata is applied directly rather than via the dirty layers of the stage
+    if (authoringMetadata.has_value() && !hasLayerAuthoringMetadata(layer))
+    {
+        setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
+    }
     if (comment.has_value())
     {
-        TF_STATUS("Saving \"%s\" with comment \"%s\"", UsdDescribe(stage).c_str(), comment.value().data());
-        for (auto& layer : dirtyLayers)
-        {
-            if (!layer->IsAnonymous())
-            {
-                layer->SetComment(comment.value().data());
-            }
-        }
-        stage->Save();
+        layer->SetComment(comment.value().data());
+    }
+    ::relativizeAssetPaths(layer, identifier);
+
+    if (comment.has_value())
+    {
+        TF_STATUS("Exporting \"%s\" with comment \"%s\"", identifier.c_str(), comment.value().data());
     }
     else
     {
-        TF_STATUS("Saving \"%s\"", UsdDescribe(stage).c_str());
-        stage->Save();
+        TF_STATUS("Exporting \"%s\"", identifier.c_str());
+    }
+    return layer->Export(identifier, "", layer->GetFileFormatArguments());
+}
+
+std::shared_future<bool> usdex::core::saveStageAsync(
+    UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata,
+    std::optional<std::string_view> comment
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "saveStageAsync");
+
+    SdfLayerHandleVector dirtyLayers = UsdUtilsGetDirtyLayers(stage);
+    ::annotateDirtyLayers(dirtyLayers, authoringMetadata, comment);
+
+    if (comment.has_value())
+    {
+        TF_STATUS("Saving \"%s\" asynchronously with comment \"%s\"", UsdDescribe(stage).c_str(), comment.value().data());
+    }
+    else
+    {
+        TF_STATUS("Saving \"%s\" asynchronously", UsdDescribe(stage).c_str());
     }
+
+    // Snapshot the content of each layer on the calling thread, so that the worker never reads a layer which may still be edited
+    const SdfLayerHandleVector layers = ::getLayersToSave(stage, dirtyLayers);
+    instrumentation.addElements(layers.size());
+    std::vector<LayerSnapshot> snapshots;
+    snapshots.reserve(layers.size());
+    bool success = true;
+    for (const SdfLayerHandle& layer : layers)
+    {
+        if (!layer->PermissionToSave())
+        {
+            TF_WARN("Unable to save layer \"%s\" as permission to save has been disabled", layer->GetIdentifier().c_str());
+            success = false;
+            continue;
+        }
+
+        SdfLayerRefPtr snapshot = SdfLayer::CreateAnonymous(layer->GetDisplayName(), layer->GetFileFormat(), layer->GetFileFormatArguments());
+        snapshot->TransferContent(layer);
+        snapshots.push_back({ snapshot, layer->GetIdentifier(), layer->GetResolvedPath().GetPathString(), layer->GetFileFormatArguments() });
+    }
+
+    // The worker is detached so that discarding the future does not block the caller until the layers are written
+    auto promise = std::make_shared<std::promise<bool>>();
+    std::shared_future<bool> result = promise->get_future().share();
+    WorkRunDetachedTask(
+        [promise, snapshots = std::move(snapshots), success]()
+        {
+            TRACE_SCOPE("Save layer snapshots");
+            const bool written = ::saveLayersConcurrently(
+                snapshots.size(),
+                [&snapshots](size_t index)
+                {
+                    // An empty comment retains the comment authored on the snapshot itself
+                    const LayerSnapshot& snapshot = snapshots[index];
+                    if (!snapshot.layer->Export(snapshot.resolvedPath, std::string(), snapshot.fileFormatArgs))
+                    {
+                        TF_WARN("Failed to save layer \"%s\"", snapshot.identifier.c_str());
+                        return false;
+                    }
+                    return true;
+                }
+            );
+            promise->set_value(success && written);
+        }
+    );
+    return result;
 }
 
 bool usdex::core::isEditablePrimLocation(const UsdStagePtr stage, const SdfPath& path, std::string* reason)
 {
+    TRACE_FUNCTION();
+
     // The stage must be valid
     if (!stage)
     {
@@ -315,6 +682,13 @@ bool usdex::core::isEditablePrimLocation(const UsdStagePtr stage, const SdfPath&
         return false;
     }
 
+    // Within an AuthoringSession, the prim is only looked up if the cached parent is an instance or instance proxy
+    const std::optional<bool> parentIsInstanced = usdex::core::detail::isSessionParentInstanced(stage, path.GetParentPath());
+    if (parentIsInstanced.has_value() && !parentIsInstanced.value())
+    {
+        return true;
+    }
+
     // Any existing prim must not be an instance proxy
     const UsdPrim prim = stage->GetPrimAtPath(path);
     if (prim && prim.IsInstanceProxy())
@@ -331,6 +705,8 @@ bool usdex::core::isEditablePrimLocation(const UsdStagePtr stage, const SdfPath&
 
 bool usdex::core::isEditablePrimLocation(const UsdPrim& prim, const std::string& name, std::string* reason)
 {
+    TRACE_FUNCTION();
+
     // The parent prim must be valid
     // We don't need to check that the UsdStage is valid as it must be if the UsdPrim is valid.
     if (!prim)
@@ -378,8 +754,139 @@ bool usdex::core::isEditablePrimLocation(const UsdPrim& prim, const std::string&
 
 bool usdex::core::isEditablePrimLocation(const UsdPrim& prim, std::string* reason)
 {
+    TRACE_FUNCTION();
+
     // Call the stage/path version
     UsdStageWeakPtr stage = prim.GetStage();
     const SdfPath& path = prim.GetPath();
     return isEditablePrimLocation(stage, path, reason);
 }
+
+std::vector<bool> usdex::core::areEditablePrimLocations(const UsdStagePtr stage, const SdfPathVector& paths, std::vector<std::string>* reasons)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "areEditablePrimLocations");
+    instrumentation.addElements(paths.size());
+
+    std::vector<bool> result(paths.size(), false);
+    if (reasons != nullptr)
+    {
+        reasons->assign(paths.size(), std::string());
+    }
+
+    // Record whether the prim at each parent path is an instance or instance proxy, in which case any existing child is an instance proxy
+    std::unordered_map<SdfPath, bool, SdfPath::Hash> parentIsInstanced;
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        const SdfPath& path = paths[i];
+        if (!stage)
+        {
+            if (reasons != nullptr)
+            {
+                (*reasons)[i] = "Invalid UsdStage.";
+            }
+            continue;
+        }
+
+        if (!path.IsAbsolutePath() || !path.IsPrimPath())
+        {
+            if (reasons != nullptr)
+            {
+                (*reasons)[i] = TfStringPrintf("\"%s\" is not a valid absolute prim path.", path.GetAsString().c_str());
+            }
+            continue;
+        }
+
+        const SdfPath parentPath = path.GetParentPath();
+        auto it = parentIsInstanced.find(parentPath);
+        if (it == parentIsInstanced.end())
+        {
+            // Within an AuthoringSession, the parents are also cached across calls
+            std::optional<bool> isInstanced = usdex::core::detail::isSessionParentInstanced(stage, parentPath);
+            if (!isInstanced.has_value())
+            {
+                const UsdPrim parent = stage->GetPrimAtPath(parentPath);
+                isInstanced = parent && (parent.IsInstance() || parent.IsInstanceProxy());
+            }
+            it = parentIsInstanced.emplace(parentPath, isInstanced.value()).first;
+        }
+
+        const UsdPrim prim = it->second ? stage->GetPrimAtPath(path) : UsdPrim();
+        if (prim && prim.IsInstanceProxy())
+        {
+            if (reasons != nullptr)
+            {
+                (*reasons)[i] = TfStringPrintf("\"%s\" is an instance proxy, authoring is not allowed.", path.GetAsString().c_str());
+            }
+            continue;
+        }
+
+        result[i] = true;
+    }
+
+    return result;
+}
+
+std::vector<bool> usdex::core::areEditablePrimLocations(const UsdPrim& prim, const std::vector<std::string>& names, std::vector<std::string>* reasons)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "areEditablePrimLocations");
+    instrumentation.addElements(names.size());
+
+    std::vector<bool> result(names.size(), false);
+    if (reasons != nullptr)
+    {
+        reasons->assign(names.size(), std::string());
+    }
+
+    // The parent prim is validated once for all names
+    std::string parentReason;
+    if (!prim)
+    {
+        parentReason = "Invalid UsdPrim";
+    }
+    else if (prim.IsInstanceProxy())
+    {
+        parentReason = TfStringPrintf("\"%s\" is an instance proxy, authoring is not allowed.", prim.GetPath().GetAsString().c_str());
+    }
+    if (!parentReason.empty())
+    {
+        if (reasons != nullptr)
+        {
+            reasons->assign(names.size(), parentReason);
+        }
+        return result;
+    }
+
+    // Only the children of an instance are instance proxies
+    const bool isInstance = prim.IsInstance();
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        const std::string& name = names[i];
+        if (!SdfPath::IsValidIdentifier(name))
+        {
+            if (reasons != nullptr)
+            {
+                (*reasons)[i] = TfStringPrintf("\"%s\" is not a valid prim name", name.c_str());
+            }
+            continue;
+        }
+
+        if (isInstance)
+        {
+            const UsdPrim child = prim.GetChild(TfToken(name));
+            if (child && child.IsInstanceProxy())
+            {
+                if (reasons != nullptr)
+                {
+                    (*reasons)[i] = TfStringPrintf("\"%s\" is an instance proxy, authoring is not allowed.", child.GetPath().GetAsString().c_str());
+                }
+                continue;
+            }
+        }
+
+        result[i] = true;
+    }
+
+    return result;
+}
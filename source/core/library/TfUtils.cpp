@@ -9,9 +9,64 @@
 #include "Debug.h"
 #include "Transcoding.h"
 
+#include <array>
+
 namespace
 {
 
+// Character classes used by the identifier validity scans
+enum CharClass : unsigned char
+{
+    Invalid = 0,
+    Continue = 1,
+    Start = 2,
+    Separator = 4,
+};
+
+constexpr std::array<unsigned char, 256> buildCharClasses()
+{
+    std::array<unsigned char, 256> result{};
+    for (int c = '0'; c <= '9'; ++c)
+    {
+        result[c] = Continue;
+    }
+    for (int c = 'A'; c <= 'Z'; ++c)
+    {
+        result[c] = Start | Continue;
+    }
+    for (int c = 'a'; c <= 'z'; ++c)
+    {
+        result[c] = Start | Continue;
+    }
+    result['_'] = Start | Continue;
+    result[':'] = Separator;
+    return result;
+}
+
+static constexpr std::array<unsigned char, 256> s_charClasses = buildCharClasses();
+
+// Scan [begin, end) and return the intersection of the classes of all characters.
+// There is no early exit and no data dependent branch, so the loop is simple enough for the compiler to vectorize.
+unsigned char intersectCharClasses(const char* begin, const char* end)
+{
+    unsigned char result = Continue;
+    for (const char* p = begin; p < end; ++p)
+    {
+        result &= s_charClasses[static_cast<unsigned char>(*p)];
+    }
+    return result;
+}
+
+// Return true if [begin, end) is a non-empty valid identifier
+bool isValidIdentifierRange(const char* begin, const char* end)
+{
+    if (begin == end || !(s_charClasses[static_cast<unsigned char>(*begin)] & Start))
+    {
+        return false;
+    }
+    return ::intersectCharClasses(begin + 1, end) & Continue;
+}
+
 // Alternate implementation of TfMakeValidIdentifier
 std::string makeValidIdentifierExtended(const std::string& in)
 {
@@ -64,8 +119,37 @@ std::string makeValidIdentifierExtended(const std::string& in)
 
 } // namespace
 
+bool usdex::core::detail::isValidIdentifier(const std::string& in)
+{
+    return ::isValidIdentifierRange(in.data(), in.data() + in.size());
+}
+
+bool usdex::core::detail::isValidNamespacedIdentifier(const std::string& in)
+{
+    const char* begin = in.data();
+    const char* end = in.data() + in.size();
+    for (const char* p = begin; p < end; ++p)
+    {
+        if (*p == ':')
+        {
+            if (!::isValidIdentifierRange(begin, p))
+            {
+                return false;
+            }
+            begin = p + 1;
+        }
+    }
+    return ::isValidIdentifierRange(begin, end);
+}
+
 std::string usdex::core::detail::makeValidIdentifier(const std::string& in)
 {
+    // Valid identifiers are unchanged by both character substitution and transcoding
+    if (usdex::core::detail::isValidIdentifier(in))
+    {
+        return in;
+    }
+
     static bool s_enableTranscoding = TfGetEnvSetting(USDEX_ENABLE_TRANSCODING);
     if (s_enableTranscoding)
     {
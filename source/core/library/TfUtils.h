@@ -9,11 +9,31 @@
 namespace usdex::core::detail
 {
 
+//! Determine whether `in` is already a valid identifier.
+//!
+//! A valid identifier is non-empty, starts with an ASCII letter or "_", and contains only ASCII alphanumerics or "_".
+//! Any such value is returned unchanged by `makeValidIdentifier`, regardless of whether transcoding is enabled, so callers may use this check
+//! to avoid building a new string.
+//!
+//! @param in The input value
+//! @returns True if the value is a valid identifier.
+bool isValidIdentifier(const std::string& in);
+
+//! Determine whether `in` is already a valid namespaced identifier.
+//!
+//! This is true if `in` is a sequence of one or more valid identifiers separated by ":".
+//!
+//! @param in The input value
+//! @returns True if each namespace of the value is a valid identifier.
+bool isValidNamespacedIdentifier(const std::string& in);
+
 //! Produce a valid identifier from `in` by replacing invalid characters with "_".
 //!
 //! This function differs from pxr::TfMakeValidIdentifier in how it handles numeric characters at the start of the value.
 //! Rather than replacing the character with an "_" this function will add an "_" prefix.
 //!
+//! Values which are already valid identifiers are returned unchanged without being transcoded.
+//!
 //! @param in The input value
 //! @returns A string that is considered valid for use as an identifier.
 std::string makeValidIdentifier(const std::string& in);
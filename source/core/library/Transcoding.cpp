@@ -6,15 +6,18 @@
 
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/unicodeUtils.h>
+#include <pxr/base/trace/trace.h>
 
 #include <algorithm>
 #include <array>
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <random>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -43,6 +46,9 @@ constexpr code_t MAX_CODE_POINT = 0x10FFFF;
 //! A bootstring prefix which is also a valid ASCII/XID start
 constexpr std::string_view BOOTSTRING_PREFIX = "tn__";
 
+//! Strings longer than this are not memoized, so that the memory used by each memo remains bounded
+constexpr size_t MEMO_MAX_KEY_LENGTH = 256;
+
 
 // Base62
 
@@ -92,8 +98,16 @@ struct BinaryIndexedTree
     std::vector<size_t> tree;
     size_t most_significant_bit;
 
-    BinaryIndexedTree(const size_t n) : tree(n + 1, 0), most_significant_bit(0)
+    BinaryIndexedTree(const size_t n)
+    {
+        reset(n);
+    }
+
+    //! Reset the tree to `n` zero values, reusing the existing allocation where possible
+    void reset(const size_t n)
     {
+        tree.assign(n + 1, 0);
+        most_significant_bit = 0;
         size_t v = n + 1;
         while (v >>= 1)
         {
@@ -169,6 +183,113 @@ struct BinaryIndexedTree
     }
 };
 
+//! A bounded memo of transcoding results which is safe to share between threads.
+//!
+//! Entries are distributed across shards which are locked independently. Once a shard reaches capacity it is cleared, bounding the memory used
+//! while allowing frequently repeated strings to be cached again on their next use.
+class TranscodingMemo
+{
+public:
+
+    bool find(const std::string& key, std::string& value)
+    {
+        if (key.size() > MEMO_MAX_KEY_LENGTH)
+        {
+            return false;
+        }
+        Shard& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.values.find(key);
+        if (it == shard.values.end())
+        {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    void insert(const std::string& key, const std::string& value)
+    {
+        if (key.size() > MEMO_MAX_KEY_LENGTH)
+        {
+            return;
+        }
+        Shard& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.values.size() >= s_maxEntriesPerShard)
+        {
+            shard.values.clear();
+        }
+        shard.values.emplace(key, value);
+    }
+
+private:
+
+    static constexpr size_t s_numShards = 16;
+    static constexpr size_t s_maxEntriesPerShard = 1024;
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::string> values;
+    };
+
+    Shard& getShard(const std::string& key)
+    {
+        return m_shards[std::hash<std::string>()(key) % s_numShards];
+    }
+
+    std::array<Shard, s_numShards> m_shards;
+};
+
+TranscodingMemo& getEncodeMemo(const usdex::core::detail::TranscodingFormat format)
+{
+    static TranscodingMemo s_asciiMemo;
+    static TranscodingMemo s_utf8Memo;
+    return (format == usdex::core::detail::TranscodingFormat::ASCII) ? s_asciiMemo : s_utf8Memo;
+}
+
+TranscodingMemo& getDecodeMemo()
+{
+    static TranscodingMemo s_memo;
+    return s_memo;
+}
+
+//! Buffers which are reused between encodings, rather than reallocated for each string
+struct EncodeScratch
+{
+    std::string output;
+    BinaryIndexedTree tree{ 0 };
+    std::vector<std::tuple<uint32_t, size_t>> extendedCodes;
+};
+
+//! Appends the UTF-8 encoding of `codePoint` to `out`.
+void appendCodePoint(std::string& out, const code_t codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
 // Format functions
 
 /// Equivalent to TfIsUtf8CodePointXidStart, but for ASCII characters.
@@ -212,17 +333,17 @@ bool IsContinue(const TfUtf8CodePoint value, const usdex::core::detail::Transcod
 // Bootstring
 
 //! Encodes variable length integers `number` and appends it to string `out`.
-void encodeVariableLength(std::ostringstream& oss, uint64_t number)
+void encodeVariableLength(std::string& out, uint64_t number)
 {
     base62_t threshold = BOOTSTRING_THRESHOLD;
     while (number >= threshold)
     {
         const base62_t digit = threshold + static_cast<base62_t>((number - threshold) % (BASE62 - threshold));
-        oss << encodeBase62(digit);
+        out.push_back(encodeBase62(digit));
         number = (number - threshold) / (BASE62 - threshold);
     }
     // number < threshold
-    oss << encodeBase62(static_cast<base62_t>(number));
+    out.push_back(encodeBase62(static_cast<base62_t>(number)));
 }
 
 //! Decodes variable length integers starting at index.
@@ -275,30 +396,35 @@ std::optional<uint64_t> decodeVariableLength(TfUtf8CodePointIterator& it)
     return number;
 }
 
-std::optional<std::string> encodeBootstring(const std::string& inputString, const usdex::core::detail::TranscodingFormat format)
+//! Encodes `inputString` into `scratch.output`.
+//! Returns false if the input string is not valid UTF-8 or the encoding overflows.
+bool encodeBootstring(const std::string& inputString, const usdex::core::detail::TranscodingFormat format, EncodeScratch& scratch)
 {
-    std::ostringstream oss;
+    std::string& output = scratch.output;
+    output.clear();
     size_t numberCodePoints = 0;
     for (const TfUtf8CodePoint value : TfUtf8CodePointView{ inputString })
     {
         if (value == TfUtf8InvalidCodePoint)
         {
-            return std::nullopt;
+            return false;
         }
         if (IsContinue(value, format))
         {
-            oss << TfUtf8CodePoint(value);
+            appendCodePoint(output, value.AsUInt32());
         }
         ++numberCodePoints;
     }
 
-    if (oss.tellp() > 0)
+    if (!output.empty())
     {
-        oss << BOOTSTRING_DELIMITER;
+        output.push_back(BOOTSTRING_DELIMITER);
     }
 
-    BinaryIndexedTree tree(numberCodePoints);
-    std::vector<std::tuple<uint32_t, size_t>> extendedCodes;
+    BinaryIndexedTree& tree = scratch.tree;
+    tree.reset(numberCodePoints);
+    std::vector<std::tuple<uint32_t, size_t>>& extendedCodes = scratch.extendedCodes;
+    extendedCodes.clear();
     size_t encodedPoints = 0;
     {
         size_t codePosition = 0;
@@ -328,17 +454,17 @@ std::optional<std::string> encodeBootstring(const std::string& inputString, cons
         if (codePoint - prevCodePoint > (std::numeric_limits<uint64_t>::max() - delta) / (encodedPoints + 1))
         {
             // Overflow
-            return std::nullopt;
+            return false;
         }
         delta += (codePoint - prevCodePoint) * (encodedPoints + 1);
-        encodeVariableLength(oss, delta);
+        encodeVariableLength(output, delta);
         prevCodePoint = codePoint;
 
         tree.increase(codePosition);
         ++encodedPoints;
     }
 
-    return oss.str();
+    return true;
 }
 
 std::optional<std::string> decodeBootstring(const std::string& inputString)
@@ -421,47 +547,92 @@ std::optional<std::string> decodeBootstring(const std::string& inputString)
     }
     return oss.str();
 }
-} // namespace
-
-std::string usdex::core::detail::encodeIdentifier(const std::string& inputString, const usdex::core::detail::TranscodingFormat format)
+//! Encodes an identifier using the given scratch buffers, without consulting the memo.
+std::string encodeIdentifierUncached(const std::string& inputString, const usdex::core::detail::TranscodingFormat format, EncodeScratch& scratch)
 {
-    std::optional<std::string> ret = encodeBootstring(inputString, format);
-    if (!ret)
+    if (!encodeBootstring(inputString, format, scratch))
     {
         // Invalid input string, returns empty.
         return "";
     }
-    const std::string& output = *ret;
-    std::string result;
-    result.append(BOOTSTRING_PREFIX);
-    result.append(output);
-    if (output == inputString + BOOTSTRING_DELIMITER) // i.e. unchanged.
+    const std::string& output = scratch.output;
+    if (output.size() == inputString.size() + 1 && output.back() == BOOTSTRING_DELIMITER && output.compare(0, inputString.size(), inputString) == 0)
     {
+        // i.e. unchanged.
         const auto it = TfUtf8CodePointView{ inputString }.begin();
         if (IsStart(*it, format))
         {
             return inputString;
         }
-        else
-        {
-            return result;
-        }
+    }
+    std::string result;
+    result.reserve(BOOTSTRING_PREFIX.size() + output.size());
+    result.append(BOOTSTRING_PREFIX);
+    result.append(output);
+    return result;
+}
+
+//! Encodes an identifier, consulting and populating the memo.
+std::string encodeIdentifierMemoized(const std::string& inputString, const usdex::core::detail::TranscodingFormat format, EncodeScratch& scratch)
+{
+    TranscodingMemo& memo = getEncodeMemo(format);
+    std::string result;
+    if (memo.find(inputString, result))
+    {
+        return result;
+    }
+    result = encodeIdentifierUncached(inputString, format, scratch);
+    memo.insert(inputString, result);
+    return result;
+}
+
+} // namespace
+
+std::string usdex::core::detail::encodeIdentifier(const std::string& inputString, const usdex::core::detail::TranscodingFormat format)
+{
+    TRACE_FUNCTION();
+
+    // Each thread reuses its own scratch buffers between calls
+    static thread_local EncodeScratch s_scratch;
+    return ::encodeIdentifierMemoized(inputString, format, s_scratch);
+}
+
+std::vector<std::string> usdex::core::detail::encodeIdentifiers(
+    const std::vector<std::string>& inputStrings,
+    const usdex::core::detail::TranscodingFormat format
+)
+{
+    TRACE_FUNCTION();
+
+    std::vector<std::string> result;
+    result.reserve(inputStrings.size());
+    EncodeScratch scratch;
+    for (const std::string& inputString : inputStrings)
+    {
+        result.push_back(::encodeIdentifierMemoized(inputString, format, scratch));
     }
     return result;
 }
 
 std::string usdex::core::detail::decodeIdentifier(const std::string& inputString)
 {
-    if (inputString.substr(0, 4) == BOOTSTRING_PREFIX)
+    TRACE_FUNCTION();
+
+    if (inputString.compare(0, BOOTSTRING_PREFIX.size(), BOOTSTRING_PREFIX) != 0)
     {
-        const std::string substr = inputString.substr(4, inputString.size() - 1);
-        const std::optional<std::string> ret = decodeBootstring(substr);
-        if (!ret)
-        {
-            // Invalid input string, returns same string.
-            return inputString;
-        }
-        return *ret;
+        return inputString;
     }
-    return inputString;
+
+    TranscodingMemo& memo = getDecodeMemo();
+    std::string result;
+    if (memo.find(inputString, result))
+    {
+        return result;
+    }
+
+    const std::optional<std::string> ret = decodeBootstring(inputString.substr(BOOTSTRING_PREFIX.size()));
+    // Invalid input strings are returned unchanged.
+    result = ret ? *ret : inputString;
+    memo.insert(inputString, result);
+    return result;
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 
 namespace usdex::core::detail
@@ -24,14 +25,27 @@ enum class TranscodingFormat
 //! For more information see [Encoding
 //! Procedure](https://github.com/PixarAnimationStudios/OpenUSD-proposals/tree/main/proposals/transcoding_invalid_identifiers#encoding-procedure)
 //!
+//! Results are memoized in a bounded cache which is shared between threads, so repeatedly encoding the same strings is inexpensive.
+//!
 //! @param inputString The input string
 //! @param format The format to apply in transcoding
 std::string encodeIdentifier(const std::string& inputString, const TranscodingFormat format);
 
+//! Encodes many identifiers using the Bootstring algorithm.
+//!
+//! The result is identical to calling `encodeIdentifier` for each string, but the intermediate buffers are reused between strings.
+//!
+//! @param inputStrings The input strings
+//! @param format The format to apply in transcoding
+//! @returns The encoded identifiers, in the same order as the input strings.
+std::vector<std::string> encodeIdentifiers(const std::vector<std::string>& inputStrings, const TranscodingFormat format);
+
 //! Decodes an identifier using the Bootstring algorithm.
 //! For more information see [Decoding
 //! Procedure](https://github.com/PixarAnimationStudios/OpenUSD-proposals/tree/main/proposals/transcoding_invalid_identifiers#decoding-procedure)
 //!
+//! Results are memoized in a bounded cache which is shared between threads.
+//!
 //! @param inputString The input string
 std::string decodeIdentifier(const std::string& inputString);
 
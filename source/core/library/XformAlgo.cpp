@@ -6,12 +6,29 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "InstrumentationUtils.h"
+#include "SdfUtils.h"
+
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/vec4f.h>
+#include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 #include <pxr/usd/usdGeom/xformOp.h>
 #include <pxr/usd/usdGeom/xformable.h>
 
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+
 using namespace pxr;
 
 namespace
@@ -42,6 +59,203 @@ bool setValueWithPrecision(UsdGeomXformOp& xformOp, const ValueType& value, cons
     return false;
 }
 
+// Convert a value to the precision of an xformOp, so that it can be authored directly as a time sample
+template <class HalfType, class FloatType, class DoubleType, class ValueType>
+VtValue getValueWithPrecision(UsdGeomXformOp::Precision precision, const ValueType& value)
+{
+    switch (precision)
+    {
+        case UsdGeomXformOp::PrecisionHalf:
+        {
+            return VtValue(HalfType(FloatType(value)));
+        }
+        case UsdGeomXformOp::PrecisionFloat:
+        {
+            return VtValue(FloatType(value));
+        }
+        case UsdGeomXformOp::PrecisionDouble:
+        {
+            return VtValue(DoubleType(value));
+        }
+    }
+    return VtValue();
+}
+
+// Returns the largest difference between the components of two samples
+template <class VecType>
+double sampleDistance(const VecType& lhs, const VecType& rhs)
+{
+    double result = 0.0;
+    for (size_t i = 0; i < VecType::dimension; ++i)
+    {
+        result = std::max(result, std::abs(static_cast<double>(lhs[i]) - static_cast<double>(rhs[i])));
+    }
+    return result;
+}
+
+double sampleDistance(const GfMatrix4d& lhs, const GfMatrix4d& rhs)
+{
+    double result = 0.0;
+    for (size_t row = 0; row < 4; ++row)
+    {
+        result = std::max(result, sampleDistance(lhs.GetRow(row), rhs.GetRow(row)));
+    }
+    return result;
+}
+
+// A quaternion and its negation describe the same rotation, so the closer of the two is compared
+double sampleDistance(const GfQuatf& lhs, const GfQuatf& rhs)
+{
+    const GfVec4f lhsComponents(lhs.GetImaginary()[0], lhs.GetImaginary()[1], lhs.GetImaginary()[2], lhs.GetReal());
+    const GfVec4f rhsComponents(rhs.GetImaginary()[0], rhs.GetImaginary()[1], rhs.GetImaginary()[2], rhs.GetReal());
+    return std::min(sampleDistance(lhsComponents, rhsComponents), sampleDistance(lhsComponents, -rhsComponents));
+}
+
+// Interpolate between two samples, exactly as a UsdStage with linear interpolation would
+template <class ValueType>
+ValueType interpolateSamples(const ValueType& lhs, const ValueType& rhs, double alpha)
+{
+    return lhs * (1.0 - alpha) + rhs * alpha;
+}
+
+GfVec3f interpolateSamples(const GfVec3f& lhs, const GfVec3f& rhs, double alpha)
+{
+    return lhs * static_cast<float>(1.0 - alpha) + rhs * static_cast<float>(alpha);
+}
+
+GfQuatf interpolateSamples(const GfQuatf& lhs, const GfQuatf& rhs, double alpha)
+{
+    return GfSlerp(alpha, lhs, rhs);
+}
+
+// Returns the indices of the samples which can not be reproduced within the tolerance by interpolating between the remaining samples.
+// The first, last and "keepIndex" samples are always retained.
+template <class ValueType>
+std::vector<size_t> reduceSamples(
+    const std::vector<UsdTimeCode>& times,
+    const std::vector<ValueType>& values,
+    size_t keepIndex,
+    double tolerance,
+    bool held
+)
+{
+    std::vector<size_t> indices;
+
+    // Samples can only be interpolated between ordered times, so unordered times are retained in full
+    bool ordered = true;
+    for (size_t i = 1; i < times.size() && ordered; ++i)
+    {
+        ordered = times[i - 1].GetValue() < times[i].GetValue();
+    }
+    if (!ordered || times.size() < 3)
+    {
+        indices.resize(times.size());
+        for (size_t i = 0; i < times.size(); ++i)
+        {
+            indices[i] = i;
+        }
+        return indices;
+    }
+
+    // Extend a segment from the last retained sample for as long as every sample within it is reproduced by the segment
+    size_t anchor = 0;
+    indices.push_back(anchor);
+    for (size_t end = 2; end < times.size(); ++end)
+    {
+        bool redundant = (end - 1 != keepIndex);
+        const double span = times[end].GetValue() - times[anchor].GetValue();
+        for (size_t i = anchor + 1; i < end && redundant; ++i)
+        {
+            const double alpha = (times[i].GetValue() - times[anchor].GetValue()) / span;
+            const ValueType expected = held ? values[anchor] : interpolateSamples(values[anchor], values[end], alpha);
+            redundant = sampleDistance(values[i], expected) <= tolerance;
+        }
+        if (!redundant)
+        {
+            anchor = end - 1;
+            indices.push_back(anchor);
+        }
+    }
+    indices.push_back(times.size() - 1);
+    return indices;
+}
+
+// Author one time sample per value on an xformOp, allowing getValueWithPrecision to handle any value type conversions.
+// If a reduction is supplied the redundant samples are not authored. The "keepIndex" sample is always authored, as it was already set while
+// resolving the xformOps.
+template <class HalfType, class FloatType, class DoubleType, class ValueType>
+bool setTimeSamplesWithPrecision(
+    const UsdGeomXformOp& xformOp,
+    const std::vector<UsdTimeCode>& times,
+    const std::vector<ValueType>& values,
+    size_t keepIndex,
+    usdex::core::KeyframeReduction* reduction
+)
+{
+    const UsdGeomXformOp::Precision precision = xformOp.GetPrecision();
+    if (!reduction)
+    {
+        return usdex::core::detail::setTimeSamples(
+            xformOp.GetAttr(),
+            times,
+            [precision, &values](size_t i)
+            {
+                return getValueWithPrecision<HalfType, FloatType, DoubleType, ValueType>(precision, values[i]);
+            }
+        );
+    }
+
+    const bool held = (xformOp.GetAttr().GetStage()->GetInterpolationType() == UsdInterpolationTypeHeld);
+    const std::vector<size_t> indices = reduceSamples(times, values, keepIndex, reduction->tolerance, held);
+    std::vector<UsdTimeCode> reducedTimes(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        reducedTimes[i] = times[indices[i]];
+    }
+    reduction->removedSamples += times.size() - indices.size();
+
+    return usdex::core::detail::setTimeSamples(
+        xformOp.GetAttr(),
+        reducedTimes,
+        [precision, &values, &indices](size_t i)
+        {
+            return getValueWithPrecision<HalfType, FloatType, DoubleType, ValueType>(precision, values[indices[i]]);
+        }
+    );
+}
+
+// Returns whether there is one value per time and no default time code, emitting a runtime error if not
+bool validateTimeSamples(const UsdPrim& prim, const std::vector<UsdTimeCode>& times, std::initializer_list<size_t> valueCounts)
+{
+    for (size_t valueCount : valueCounts)
+    {
+        if (valueCount != times.size())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to set local transform at \"%s\" due to invalid frames: Expected %zu values but found %zu",
+                prim.GetPath().GetAsString().c_str(),
+                times.size(),
+                valueCount
+            );
+            return false;
+        }
+    }
+
+    for (const UsdTimeCode& time : times)
+    {
+        if (time.IsDefault())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to set local transform at \"%s\" due to invalid frames: The default time code is not valid",
+                prim.GetPath().GetAsString().c_str()
+            );
+            return false;
+        }
+    }
+
+    return true;
+}
+
 UsdGeomXformCommonAPI::RotationOrder convertRotationOrder(const usdex::core::RotationOrder& rotationOrder)
 {
     switch (rotationOrder)
@@ -120,11 +334,26 @@ bool hasPivotPosition(const GfTransform& transform)
     return transform.GetPivotPosition() != g_identityTranslation;
 }
 
+// Compute the rotation values for any rotation order from a Rotation object via decomposition.
+// The result recomposes to the same rotation via computeRotation with the same rotation order.
+GfVec3d computeRotationsFromRotation(const GfRotation& rotate, const usdex::core::RotationOrder rotationOrder)
+{
+    static const GfVec3d xyzAxes[] = { GfVec3d::XAxis(), GfVec3d::YAxis(), GfVec3d::ZAxis() };
+    const GfVec3i indices = getAxisIndices(rotationOrder);
+
+    // The first axis of the rotation order is applied first, so it is the last axis of the decomposition
+    const GfVec3d angles = rotate.Decompose(xyzAxes[indices[2]], xyzAxes[indices[1]], xyzAxes[indices[0]]);
+    GfVec3d rotations;
+    rotations[indices[0]] = angles[2];
+    rotations[indices[1]] = angles[1];
+    rotations[indices[2]] = angles[0];
+    return rotations;
+}
+
 // Compute the XYZ rotation values from a Rotation object via decomposition.
 GfVec3d computeXyzRotationsFromRotation(const GfRotation& rotate)
 {
-    const GfVec3d angles = rotate.Decompose(GfVec3d::ZAxis(), GfVec3d::YAxis(), GfVec3d::XAxis());
-    return GfVec3d(angles[2], angles[1], angles[0]);
+    return computeRotationsFromRotation(rotate, usdex::core::RotationOrder::eXyz);
 }
 
 GfRotation computeRotation(const GfVec3f& rotations, const usdex::core::RotationOrder rotationOrder)
@@ -182,13 +411,13 @@ GfMatrix4d computeMatrixFromComponents(
     return transform.GetMatrix();
 }
 
-// Given a 4x4 matrix compute the values of common components
-void computeComponentsFromMatrix(
+// Given a 4x4 matrix compute the values of common components with rotation values in the given rotation order
+void decomposeMatrix(
     const GfMatrix4d& matrix,
+    const usdex::core::RotationOrder rotationOrder,
     GfVec3d& translation,
     GfVec3d& pivot,
     GfVec3f& rotation,
-    usdex::core::RotationOrder& rotationOrder,
     GfVec3f& scale
 )
 {
@@ -197,14 +426,28 @@ void computeComponentsFromMatrix(
     translation = transform.GetTranslation();
     pivot = transform.GetPivotPosition();
 
-    // Decompose rotation into a rotationOrder of XYZ and convert from double to float
-    rotation = GfVec3f(computeXyzRotationsFromRotation(transform.GetRotation()));
-    rotationOrder = usdex::core::RotationOrder::eXyz;
+    // Decompose rotation into the rotationOrder and convert from double to float
+    rotation = GfVec3f(computeRotationsFromRotation(transform.GetRotation(), rotationOrder));
 
     // Convert scale from double to float
     scale = GfVec3f(transform.GetScale());
 }
 
+// Given a 4x4 matrix compute the values of common components
+void computeComponentsFromMatrix(
+    const GfMatrix4d& matrix,
+    GfVec3d& translation,
+    GfVec3d& pivot,
+    GfVec3f& rotation,
+    usdex::core::RotationOrder& rotationOrder,
+    GfVec3f& scale
+)
+{
+    // Decompose rotation into a rotationOrder of XYZ
+    rotationOrder = usdex::core::RotationOrder::eXyz;
+    decomposeMatrix(matrix, rotationOrder, translation, pivot, rotation, scale);
+}
+
 // Given a 4x4 matrix compute the values of common components with orientation instead of rotation
 void computeComponentsFromMatrix(const GfMatrix4d& matrix, GfVec3d& translation, GfVec3d& pivot, GfQuatf& orientation, GfVec3f& scale)
 {
@@ -344,11 +587,115 @@ void removeUnusedXformOps(UsdGeomXformable& xformable)
     }
 }
 
+// Prims are planned in chunks of this many, smaller batches are planned serially
+static constexpr size_t s_xformGrainSize = 1024;
+
+// How the xformOps of a prim will be authored to achieve a new transform
+enum class XformOpPlan
+{
+    eInvalid, // The prim is not xformable
+    eSetMatrix, // The value will be set on the existing transform xformOp
+    eMakeMatrix, // The xformOpOrder will be replaced with a single transform xformOp
+    eCommonAPI, // The value requires the UsdGeomXformCommonAPI, which is authored via setLocalTransform
+};
+
+// Decide how a transform will be authored on a prim, without authoring any opinions
+// The "transformOp" argument will be populated with the existing xformOp if the plan is to reuse it
+XformOpPlan planXformOps(const UsdPrim& prim, bool needsXformCommonAPI, XformOpPlan fallback, UsdGeomXformOp* transformOp)
+{
+    UsdGeomXformable xformable(prim);
+    if (!xformable)
+    {
+        return XformOpPlan::eInvalid;
+    }
+
+    if (needsXformCommonAPI)
+    {
+        return XformOpPlan::eCommonAPI;
+    }
+
+    bool resetsXformStack;
+    std::vector<UsdGeomXformOp> xformOps = xformable.GetOrderedXformOps(&resetsXformStack);
+    if (!xformOps.empty() && getMatrixXformOp(xformOps, transformOp) && transformOp->IsDefined())
+    {
+        return XformOpPlan::eSetMatrix;
+    }
+
+    return fallback;
+}
+
+// Author the local transforms of many prims with a single round of change processing.
+// The plans and matrices of all prims are computed concurrently, as the stage is only read until every plan is known.
+template <typename PlanFn, typename MatrixFn, typename CommonAPIFn>
+bool setLocalTransformsImpl(const std::vector<UsdPrim>& prims, UsdTimeCode time, PlanFn&& planAt, MatrixFn&& matrixAt, CommonAPIFn&& setCommonAPIAt)
+{
+    TRACE_FUNCTION();
+
+    std::vector<XformOpPlan> plans(prims.size(), XformOpPlan::eInvalid);
+    std::vector<UsdGeomXformOp> transformOps(prims.size());
+    std::vector<GfMatrix4d> matrices(prims.size());
+    WorkParallelForN(
+        prims.size(),
+        [&](size_t begin, size_t end)
+        {
+            TRACE_SCOPE("Resolve xformOps");
+            for (size_t i = begin; i < end; ++i)
+            {
+                plans[i] = planAt(i, &transformOps[i]);
+                if (plans[i] == XformOpPlan::eSetMatrix || plans[i] == XformOpPlan::eMakeMatrix)
+                {
+                    matrices[i] = matrixAt(i);
+                }
+            }
+        },
+        s_xformGrainSize
+    );
+
+    TRACE_SCOPE("Author xformOps");
+    bool success = true;
+    SdfChangeBlock changeBlock;
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        switch (plans[i])
+        {
+            case XformOpPlan::eInvalid:
+            {
+                success = false;
+                break;
+            }
+            case XformOpPlan::eSetMatrix:
+            {
+                UsdGeomXformable xformable(prims[i]);
+                transformOps[i].Set(matrices[i], time);
+                ensureXformOpOrderExplicitlyAuthored(xformable);
+                break;
+            }
+            case XformOpPlan::eMakeMatrix:
+            {
+                UsdGeomXformable xformable(prims[i]);
+                xformable.MakeMatrixXform().Set(matrices[i], time);
+                ensureXformOpOrderExplicitlyAuthored(xformable);
+                break;
+            }
+            case XformOpPlan::eCommonAPI:
+            {
+                success &= setCommonAPIAt(i);
+                break;
+            }
+        }
+    }
+
+    return success;
+}
 
 } // namespace
 
 bool usdex::core::setLocalTransform(UsdPrim prim, const GfTransform& transform, UsdTimeCode time)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransform");
+    instrumentation.addElements(1);
+
     // Early out with a failure return if the prim is not xformable
     UsdGeomXformable xformable(prim);
     if (!xformable)
@@ -428,6 +775,10 @@ bool usdex::core::setLocalTransform(UsdPrim prim, const GfTransform& transform,
 
 bool usdex::core::setLocalTransform(UsdPrim prim, const GfMatrix4d& matrix, UsdTimeCode time)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransform");
+    instrumentation.addElements(1);
+
     // Early out with a failure return if the prim is not xformable
     UsdGeomXformable xformable(prim);
     if (!xformable)
@@ -472,6 +823,10 @@ bool usdex::core::setLocalTransform(
     UsdTimeCode time
 )
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransform");
+    instrumentation.addElements(1);
+
     // Early out with a failure return if the prim is not xformable
     UsdGeomXformable xformable(prim);
     if (!xformable)
@@ -537,6 +892,10 @@ bool usdex::core::setLocalTransform(
 
 bool usdex::core::setLocalTransform(UsdPrim prim, const GfVec3d& translation, const GfQuatf& orientation, const GfVec3f& scale, UsdTimeCode time)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransform");
+    instrumentation.addElements(1);
+
     UsdGeomXformable xformable(prim);
     if (!xformable)
     {
@@ -615,120 +974,754 @@ bool usdex::core::setLocalTransform(UsdPrim prim, const GfVec3d& translation, co
     return true;
 }
 
-GfTransform usdex::core::getLocalTransform(const UsdPrim& prim, UsdTimeCode time)
+bool usdex::core::setLocalTransform(
+    UsdPrim prim,
+    const std::vector<UsdTimeCode>& times,
+    const std::vector<GfMatrix4d>& matrices,
+    usdex::core::KeyframeReduction* reduction
+)
 {
-    // Initialize an identity transform as the fallback return
-    GfTransform transform = GfTransform();
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransform");
+    instrumentation.addElements(times.size());
 
-    // Early out if the prim is not xformable
+    // Early out with a failure return if the prim is not xformable
     UsdGeomXformable xformable(prim);
     if (!xformable)
     {
-        return transform;
+        return false;
     }
 
-    // Attempt to extract existing xformOp values
-    UsdGeomXformCommonAPI xformCommonAPI = UsdGeomXformCommonAPI(prim);
-    if (xformCommonAPI)
+    if (!::validateTimeSamples(prim, times, { matrices.size() }))
     {
-        // Extract transform components
-        GfVec3d translation;
-        GfVec3d pivot;
-        GfVec3f rotation;
-        usdex::core::RotationOrder rotOrder;
-        GfVec3f scale;
-        getXformVectorsByAccumulation(xformCommonAPI, &translation, &pivot, &rotation, &rotOrder, &scale, time);
-
-        // Construct and return a transform from the components
-        return computeTransformFromComponents(translation, pivot, rotation, rotOrder, scale);
+        return false;
     }
 
-    // Compute the local transform matrix and populate the result from that
-    GfMatrix4d matrix;
-    bool resetsXformStack;
-    if (xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    if (times.empty())
     {
-        transform.SetMatrix(matrix);
+        return true;
     }
 
-    return transform;
-}
-
-GfMatrix4d usdex::core::getLocalTransformMatrix(const UsdPrim& prim, UsdTimeCode time)
-{
-    // Initialize an identity matrix as the fallback return
-    GfMatrix4d matrix = GfMatrix4d(1.0);
-
-    // Early out if the prim is not xformable
-    UsdGeomXformable xformable(prim);
-    if (!xformable)
+    // Resolve the xformOps by setting the first sample, then author all of the samples directly to the layer
+    if (!usdex::core::setLocalTransform(prim, matrices[0], times[0]))
     {
-        return matrix;
+        return false;
     }
 
-    // Compute the local transform matrix and populate the result from that
     bool resetsXformStack;
-    if (!xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    const std::vector<UsdGeomXformOp> xformOps = xformable.GetOrderedXformOps(&resetsXformStack);
+    if (xformOps.size() != 1)
     {
-        matrix.SetIdentity();
+        return false;
     }
 
-    return matrix;
+    SdfChangeBlock changeBlock;
+    return setTimeSamplesWithPrecision<GfMatrix4d, GfMatrix4d, GfMatrix4d>(xformOps[0], times, matrices, 0, reduction);
 }
 
-void usdex::core::getLocalTransformComponents(
-    const UsdPrim& prim,
-    GfVec3d& translation,
-    GfVec3d& pivot,
-    GfVec3f& rotation,
-    usdex::core::RotationOrder& rotationOrder,
-    GfVec3f& scale,
-    UsdTimeCode time
+bool usdex::core::setLocalTransform(
+    UsdPrim prim,
+    const std::vector<UsdTimeCode>& times,
+    const std::vector<GfTransform>& transforms,
+    usdex::core::KeyframeReduction* reduction
 )
 {
-    // Initialize as identity
-    translation.Set(0.0, 0.0, 0.0);
-    pivot.Set(0.0, 0.0, 0.0);
-    rotation.Set(0.0, 0.0, 0.0);
-    rotationOrder = usdex::core::RotationOrder::eXyz;
-    scale.Set(1.0, 1.0, 1.0);
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransform");
+    instrumentation.addElements(times.size());
 
-    // Early out if the prim is not xformable
+    // Early out with a failure return if the prim is not xformable
     UsdGeomXformable xformable(prim);
     if (!xformable)
     {
-        return;
+        return false;
     }
 
-    // Attempt to extract existing xformOp values
-    UsdGeomXformCommonAPI xformCommonAPI = UsdGeomXformCommonAPI(prim);
-    if (xformCommonAPI)
+    if (!::validateTimeSamples(prim, times, { transforms.size() }))
     {
-        // Extract transform components
-        getXformVectorsByAccumulation(xformCommonAPI, &translation, &pivot, &rotation, &rotationOrder, &scale, time);
-        return;
+        return false;
     }
 
-    // Compute the local transform matrix and populate the result from that
-    GfMatrix4d matrix;
-    bool resetsXformStack;
-    if (xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    if (times.empty())
     {
-        computeComponentsFromMatrix(matrix, translation, pivot, rotation, rotationOrder, scale);
-        return;
+        return true;
     }
-}
 
-void usdex::core::getLocalTransformComponentsQuat(
-    const UsdPrim& prim,
-    GfVec3d& translation,
-    GfVec3d& pivot,
-    GfQuatf& orientation,
-    GfVec3f& scale,
-    UsdTimeCode time
-)
-{
-    // Initialize with identity values
+    // The xformOps are chosen once for all samples. If any sample needs the UsdGeomXformCommonAPI to retain its pivot position, then all samples
+    // use it, otherwise a single transform xformOp is used.
+    bool needsXformCommonAPI = false;
+    bool hasAnyPivotOrientation = false;
+    for (const GfTransform& transform : transforms)
+    {
+        needsXformCommonAPI |= hasPivotPosition(transform);
+        hasAnyPivotOrientation |= hasPivotOrientation(transform);
+    }
+    needsXformCommonAPI &= !hasAnyPivotOrientation;
+
+    if (!needsXformCommonAPI)
+    {
+        std::vector<GfMatrix4d> matrices(transforms.size());
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            matrices[i] = transforms[i].GetMatrix();
+        }
+        return usdex::core::setLocalTransform(prim, times, matrices, reduction);
+    }
+
+    // Resolve the xformOps by setting a sample that needs the UsdGeomXformCommonAPI, then author all of the samples directly to the layer
+    size_t first = 0;
+    while (!hasPivotPosition(transforms[first]))
+    {
+        ++first;
+    }
+    if (!usdex::core::setLocalTransform(prim, transforms[first], times[first]))
+    {
+        return false;
+    }
+
+    const UsdGeomXformCommonAPI::Ops commonXformOps = UsdGeomXformCommonAPI(prim).CreateXformOps(
+        UsdGeomXformCommonAPI::RotationOrderXYZ,
+        UsdGeomXformCommonAPI::OpTranslate,
+        UsdGeomXformCommonAPI::OpPivot,
+        UsdGeomXformCommonAPI::OpRotate,
+        UsdGeomXformCommonAPI::OpScale
+    );
+
+    std::vector<GfVec3d> translations(transforms.size());
+    std::vector<GfVec3d> pivots(transforms.size());
+    std::vector<GfVec3d> rotations(transforms.size());
+    std::vector<GfVec3d> scales(transforms.size());
+    for (size_t i = 0; i < transforms.size(); ++i)
+    {
+        translations[i] = transforms[i].GetTranslation();
+        pivots[i] = transforms[i].GetPivotPosition();
+        rotations[i] = computeXyzRotationsFromRotation(transforms[i].GetRotation());
+        scales[i] = transforms[i].GetScale();
+    }
+
+    SdfChangeBlock changeBlock;
+    bool success = setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(commonXformOps.translateOp, times, translations, first, reduction);
+    success &= setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(commonXformOps.pivotOp, times, pivots, first, reduction);
+    success &= setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(commonXformOps.rotateOp, times, rotations, first, reduction);
+    success &= setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(commonXformOps.scaleOp, times, scales, first, reduction);
+    return success;
+}
+
+bool usdex::core::setLocalTransform(
+    UsdPrim prim,
+    const std::vector<UsdTimeCode>& times,
+    const std::vector<GfVec3d>& translations,
+    const std::vector<GfVec3d>& pivots,
+    const std::vector<GfVec3f>& rotations,
+    const usdex::core::RotationOrder rotationOrder,
+    const std::vector<GfVec3f>& scales,
+    usdex::core::KeyframeReduction* reduction
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransform");
+    instrumentation.addElements(times.size());
+
+    // Early out with a failure return if the prim is not xformable
+    UsdGeomXformable xformable(prim);
+    if (!xformable)
+    {
+        return false;
+    }
+
+    if (!::validateTimeSamples(prim, times, { translations.size(), pivots.size(), rotations.size(), scales.size() }))
+    {
+        return false;
+    }
+
+    if (times.empty())
+    {
+        return true;
+    }
+
+    // Resolve the xformOps by setting a representative sample. If this reuses an existing transform xformOp and no sample has a pivot then all
+    // samples are authored as matrices, otherwise all samples are authored using the UsdGeomXformCommonAPI.
+    bool hasAnyPivot = false;
+    for (const GfVec3d& pivot : pivots)
+    {
+        hasAnyPivot |= (pivot != g_identityTranslation);
+    }
+
+    size_t first = 0;
+    while (hasAnyPivot && pivots[first] == g_identityTranslation)
+    {
+        ++first;
+    }
+    if (!usdex::core::setLocalTransform(prim, translations[first], pivots[first], rotations[first], rotationOrder, scales[first], times[first]))
+    {
+        return false;
+    }
+
+    bool resetsXformStack;
+    const std::vector<UsdGeomXformOp> xformOps = xformable.GetOrderedXformOps(&resetsXformStack);
+    UsdGeomXformOp transformXformOp;
+    if (!hasAnyPivot && !xformOps.empty() && getMatrixXformOp(xformOps, &transformXformOp) && transformXformOp.IsDefined())
+    {
+        std::vector<GfMatrix4d> matrices(times.size());
+        for (size_t i = 0; i < times.size(); ++i)
+        {
+            matrices[i] = computeMatrixFromComponents(translations[i], pivots[i], rotations[i], rotationOrder, scales[i]);
+        }
+
+        SdfChangeBlock changeBlock;
+        return setTimeSamplesWithPrecision<GfMatrix4d, GfMatrix4d, GfMatrix4d>(transformXformOp, times, matrices, first, reduction);
+    }
+
+    const UsdGeomXformCommonAPI::Ops commonXformOps = UsdGeomXformCommonAPI(prim).CreateXformOps(
+        convertRotationOrder(rotationOrder),
+        UsdGeomXformCommonAPI::OpTranslate,
+        UsdGeomXformCommonAPI::OpPivot,
+        UsdGeomXformCommonAPI::OpRotate,
+        UsdGeomXformCommonAPI::OpScale
+    );
+
+    SdfChangeBlock changeBlock;
+    bool success = setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(commonXformOps.translateOp, times, translations, first, reduction);
+    success &= setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(commonXformOps.pivotOp, times, pivots, first, reduction);
+    success &= setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(commonXformOps.rotateOp, times, rotations, first, reduction);
+    success &= setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(commonXformOps.scaleOp, times, scales, first, reduction);
+    return success;
+}
+
+bool usdex::core::setLocalTransform(
+    UsdPrim prim,
+    const std::vector<UsdTimeCode>& times,
+    const std::vector<GfVec3d>& translations,
+    const std::vector<GfQuatf>& orientations,
+    const std::vector<GfVec3f>& scales,
+    usdex::core::KeyframeReduction* reduction
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransform");
+    instrumentation.addElements(times.size());
+
+    // Early out with a failure return if the prim is not xformable
+    UsdGeomXformable xformable(prim);
+    if (!xformable)
+    {
+        return false;
+    }
+
+    if (!::validateTimeSamples(prim, times, { translations.size(), orientations.size(), scales.size() }))
+    {
+        return false;
+    }
+
+    if (times.empty())
+    {
+        return true;
+    }
+
+    // Resolve the translate, orient and scale xformOps by setting the first sample, then author all of the samples directly to the layer
+    if (!usdex::core::setLocalTransform(prim, translations[0], orientations[0], scales[0], times[0]))
+    {
+        return false;
+    }
+
+    bool resetsXformStack;
+    const std::vector<UsdGeomXformOp> xformOps = xformable.GetOrderedXformOps(&resetsXformStack);
+    if (xformOps.size() != 3)
+    {
+        return false;
+    }
+
+    SdfChangeBlock changeBlock;
+    bool success = setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(xformOps[0], times, translations, 0, reduction);
+    success &= setTimeSamplesWithPrecision<GfQuath, GfQuatf, GfQuatd>(xformOps[1], times, orientations, 0, reduction);
+    success &= setTimeSamplesWithPrecision<GfVec3h, GfVec3f, GfVec3d>(xformOps[2], times, scales, 0, reduction);
+    return success;
+}
+
+bool usdex::core::setLocalTransforms(const std::vector<UsdPrim>& prims, const std::vector<GfTransform>& transforms, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransforms");
+    instrumentation.addElements(prims.size());
+
+    if (prims.size() != transforms.size())
+    {
+        TF_RUNTIME_ERROR("Unable to set local transforms: %zu prims were provided with %zu transforms", prims.size(), transforms.size());
+        return false;
+    }
+
+    return ::setLocalTransformsImpl(
+        prims,
+        time,
+        [&](size_t i, UsdGeomXformOp* transformOp)
+        {
+            const bool needsXformCommonAPI = (hasPivotPosition(transforms[i]) && !hasPivotOrientation(transforms[i]));
+            return ::planXformOps(prims[i], needsXformCommonAPI, XformOpPlan::eMakeMatrix, transformOp);
+        },
+        [&](size_t i)
+        {
+            return transforms[i].GetMatrix();
+        },
+        [&](size_t i)
+        {
+            return usdex::core::setLocalTransform(prims[i], transforms[i], time);
+        }
+    );
+}
+
+bool usdex::core::setLocalTransforms(const std::vector<UsdPrim>& prims, const std::vector<GfMatrix4d>& matrices, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransforms");
+    instrumentation.addElements(prims.size());
+
+    if (prims.size() != matrices.size())
+    {
+        TF_RUNTIME_ERROR("Unable to set local transforms: %zu prims were provided with %zu matrices", prims.size(), matrices.size());
+        return false;
+    }
+
+    return ::setLocalTransformsImpl(
+        prims,
+        time,
+        [&](size_t i, UsdGeomXformOp* transformOp)
+        {
+            return ::planXformOps(prims[i], false, XformOpPlan::eMakeMatrix, transformOp);
+        },
+        [&](size_t i)
+        {
+            return matrices[i];
+        },
+        [&](size_t i)
+        {
+            return usdex::core::setLocalTransform(prims[i], matrices[i], time);
+        }
+    );
+}
+
+bool usdex::core::setLocalTransforms(
+    const std::vector<UsdPrim>& prims,
+    const std::vector<GfVec3d>& translations,
+    const std::vector<GfVec3d>& pivots,
+    const std::vector<GfVec3f>& rotations,
+    const usdex::core::RotationOrder rotationOrder,
+    const std::vector<GfVec3f>& scales,
+    UsdTimeCode time
+)
+{
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "setLocalTransforms");
+    instrumentation.addElements(prims.size());
+
+    const size_t size = prims.size();
+    if (translations.size() != size || pivots.size() != size || rotations.size() != size || scales.size() != size)
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to set local transforms: %zu prims were provided with %zu translations, %zu pivots, %zu rotations and %zu scales",
+            size,
+            translations.size(),
+            pivots.size(),
+            rotations.size(),
+            scales.size()
+        );
+        return false;
+    }
+
+    // Components which can not be set on an existing transform xformOp are always authored using the UsdGeomXformCommonAPI
+    return ::setLocalTransformsImpl(
+        prims,
+        time,
+        [&](size_t i, UsdGeomXformOp* transformOp)
+        {
+            const bool needsXformCommonAPI = (pivots[i] != g_identityTranslation);
+            return ::planXformOps(prims[i], needsXformCommonAPI, XformOpPlan::eCommonAPI, transformOp);
+        },
+        [&](size_t i)
+        {
+            return computeMatrixFromComponents(translations[i], pivots[i], rotations[i], rotationOrder, scales[i]);
+        },
+        [&](size_t i)
+        {
+            return usdex::core::setLocalTransform(prims[i], translations[i], pivots[i], rotations[i], rotationOrder, scales[i], time);
+        }
+    );
+}
+
+usdex::core::LocalTransformWriter::LocalTransformWriter(UsdPrim prim) : m_prim(std::move(prim)), m_layout(Layout::eUnresolved)
+{
+}
+
+const UsdPrim& usdex::core::LocalTransformWriter::getPrim() const
+{
+    return m_prim;
+}
+
+bool usdex::core::LocalTransformWriter::set(const GfMatrix4d& matrix, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    if (isResolved(Layout::eMatrix))
+    {
+        return m_xformOps[0].Set(matrix, time);
+    }
+
+    reset();
+    UsdGeomXformOp transformOp;
+    switch (::planXformOps(m_prim, false, XformOpPlan::eMakeMatrix, &transformOp))
+    {
+        case XformOpPlan::eSetMatrix:
+        {
+            break;
+        }
+        case XformOpPlan::eMakeMatrix:
+        {
+            transformOp = UsdGeomXformable(m_prim).MakeMatrixXform();
+            break;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+
+    transformOp.Set(matrix, time);
+    UsdGeomXformable xformable(m_prim);
+    ensureXformOpOrderExplicitlyAuthored(xformable);
+
+    m_xformOps[0] = std::move(transformOp);
+    m_editTarget = m_prim.GetStage()->GetEditTarget();
+    m_layout = Layout::eMatrix;
+    return true;
+}
+
+bool usdex::core::LocalTransformWriter::set(const GfVec3d& translation, const GfQuatf& orientation, const GfVec3f& scale, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    if (isResolved(Layout::eOrientation))
+    {
+        bool success = setValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, GfVec3d>(m_xformOps[0], translation, time);
+        success &= setValueWithPrecision<GfQuath, GfQuatf, GfQuatd, GfQuatf>(m_xformOps[1], orientation, time);
+        success &= setValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, GfVec3f>(m_xformOps[2], scale, time);
+        return success;
+    }
+
+    // The first value is set by the equivalent function, which always results in translate, orient and scale xformOps
+    reset();
+    if (!usdex::core::setLocalTransform(m_prim, translation, orientation, scale, time))
+    {
+        return false;
+    }
+
+    bool resetsXformStack;
+    std::vector<UsdGeomXformOp> xformOps = UsdGeomXformable(m_prim).GetOrderedXformOps(&resetsXformStack);
+    if (xformOps.size() == 3)
+    {
+        m_xformOps[0] = std::move(xformOps[0]);
+        m_xformOps[1] = std::move(xformOps[1]);
+        m_xformOps[2] = std::move(xformOps[2]);
+        m_editTarget = m_prim.GetStage()->GetEditTarget();
+        m_layout = Layout::eOrientation;
+    }
+    return true;
+}
+
+void usdex::core::LocalTransformWriter::reset()
+{
+    m_layout = Layout::eUnresolved;
+    m_editTarget = UsdEditTarget();
+    for (UsdGeomXformOp& xformOp : m_xformOps)
+    {
+        xformOp = UsdGeomXformOp();
+    }
+}
+
+bool usdex::core::LocalTransformWriter::isResolved(Layout layout) const
+{
+    return m_layout == layout && m_prim && m_prim.GetStage()->GetEditTarget() == m_editTarget;
+}
+
+GfTransform usdex::core::getLocalTransform(const UsdPrim& prim, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    // Initialize an identity transform as the fallback return
+    GfTransform transform = GfTransform();
+
+    // Early out if the prim is not xformable
+    UsdGeomXformable xformable(prim);
+    if (!xformable)
+    {
+        return transform;
+    }
+
+    // Attempt to extract existing xformOp values
+    UsdGeomXformCommonAPI xformCommonAPI = UsdGeomXformCommonAPI(prim);
+    if (xformCommonAPI)
+    {
+        // Extract transform components
+        GfVec3d translation;
+        GfVec3d pivot;
+        GfVec3f rotation;
+        usdex::core::RotationOrder rotOrder;
+        GfVec3f scale;
+        getXformVectorsByAccumulation(xformCommonAPI, &translation, &pivot, &rotation, &rotOrder, &scale, time);
+
+        // Construct and return a transform from the components
+        return computeTransformFromComponents(translation, pivot, rotation, rotOrder, scale);
+    }
+
+    // Compute the local transform matrix and populate the result from that
+    GfMatrix4d matrix;
+    bool resetsXformStack;
+    if (xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    {
+        transform.SetMatrix(matrix);
+    }
+
+    return transform;
+}
+
+GfMatrix4d usdex::core::getLocalTransformMatrix(const UsdPrim& prim, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    // Initialize an identity matrix as the fallback return
+    GfMatrix4d matrix = GfMatrix4d(1.0);
+
+    // Early out if the prim is not xformable
+    UsdGeomXformable xformable(prim);
+    if (!xformable)
+    {
+        return matrix;
+    }
+
+    // Compute the local transform matrix and populate the result from that
+    bool resetsXformStack;
+    if (!xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    {
+        matrix.SetIdentity();
+    }
+
+    return matrix;
+}
+
+void usdex::core::getLocalTransformComponents(
+    const UsdPrim& prim,
+    GfVec3d& translation,
+    GfVec3d& pivot,
+    GfVec3f& rotation,
+    usdex::core::RotationOrder& rotationOrder,
+    GfVec3f& scale,
+    UsdTimeCode time
+)
+{
+    TRACE_FUNCTION();
+
+    // Initialize as identity
+    translation.Set(0.0, 0.0, 0.0);
+    pivot.Set(0.0, 0.0, 0.0);
+    rotation.Set(0.0, 0.0, 0.0);
+    rotationOrder = usdex::core::RotationOrder::eXyz;
+    scale.Set(1.0, 1.0, 1.0);
+
+    // Early out if the prim is not xformable
+    UsdGeomXformable xformable(prim);
+    if (!xformable)
+    {
+        return;
+    }
+
+    // Attempt to extract existing xformOp values
+    UsdGeomXformCommonAPI xformCommonAPI = UsdGeomXformCommonAPI(prim);
+    if (xformCommonAPI)
+    {
+        // Extract transform components
+        getXformVectorsByAccumulation(xformCommonAPI, &translation, &pivot, &rotation, &rotationOrder, &scale, time);
+        return;
+    }
+
+    // Compute the local transform matrix and populate the result from that
+    GfMatrix4d matrix;
+    bool resetsXformStack;
+    if (xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    {
+        computeComponentsFromMatrix(matrix, translation, pivot, rotation, rotationOrder, scale);
+        return;
+    }
+}
+
+VtMatrix4dArray usdex::core::getLocalTransformMatrices(const std::vector<UsdPrim>& prims, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    VtMatrix4dArray result(prims.size());
+    const UsdPrim* primsData = prims.data();
+    GfMatrix4d* resultData = result.data();
+    WorkParallelForN(
+        prims.size(),
+        [primsData, resultData, time](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                resultData[i] = usdex::core::getLocalTransformMatrix(primsData[i], time);
+            }
+        },
+        s_xformGrainSize
+    );
+    return result;
+}
+
+VtMatrix4dArray usdex::core::getLocalTransformMatrices(const UsdPrimRange& range, UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    // Traversal is inherently serial, so gather the prims before evaluating them in parallel
+    const std::vector<UsdPrim> prims(range.begin(), range.end());
+    return usdex::core::getLocalTransformMatrices(prims, time);
+}
+
+void usdex::core::getLocalTransformComponents(
+    const std::vector<UsdPrim>& prims,
+    VtVec3dArray& translations,
+    VtVec3dArray& pivots,
+    VtVec3fArray& rotations,
+    std::vector<usdex::core::RotationOrder>& rotationOrders,
+    VtVec3fArray& scales,
+    UsdTimeCode time
+)
+{
+    TRACE_FUNCTION();
+
+    translations.resize(prims.size());
+    pivots.resize(prims.size());
+    rotations.resize(prims.size());
+    rotationOrders.resize(prims.size());
+    scales.resize(prims.size());
+
+    const UsdPrim* primsData = prims.data();
+    GfVec3d* translationsData = translations.data();
+    GfVec3d* pivotsData = pivots.data();
+    GfVec3f* rotationsData = rotations.data();
+    usdex::core::RotationOrder* rotationOrdersData = rotationOrders.data();
+    GfVec3f* scalesData = scales.data();
+    WorkParallelForN(
+        prims.size(),
+        [=](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                usdex::core::getLocalTransformComponents(
+                    primsData[i],
+                    translationsData[i],
+                    pivotsData[i],
+                    rotationsData[i],
+                    rotationOrdersData[i],
+                    scalesData[i],
+                    time
+                );
+            }
+        },
+        s_xformGrainSize
+    );
+}
+
+void usdex::core::getLocalTransformComponents(
+    const UsdPrimRange& range,
+    VtVec3dArray& translations,
+    VtVec3dArray& pivots,
+    VtVec3fArray& rotations,
+    std::vector<usdex::core::RotationOrder>& rotationOrders,
+    VtVec3fArray& scales,
+    UsdTimeCode time
+)
+{
+    TRACE_FUNCTION();
+
+    // Traversal is inherently serial, so gather the prims before evaluating them in parallel
+    const std::vector<UsdPrim> prims(range.begin(), range.end());
+    usdex::core::getLocalTransformComponents(prims, translations, pivots, rotations, rotationOrders, scales, time);
+}
+
+void usdex::core::computeTransformComponents(
+    const VtMatrix4dArray& matrices,
+    const usdex::core::RotationOrder rotationOrder,
+    VtVec3dArray& translations,
+    VtVec3dArray& pivots,
+    VtVec3fArray& rotations,
+    VtVec3fArray& scales
+)
+{
+    TRACE_FUNCTION();
+
+    translations.resize(matrices.size());
+    pivots.resize(matrices.size());
+    rotations.resize(matrices.size());
+    scales.resize(matrices.size());
+
+    const GfMatrix4d* matricesData = matrices.cdata();
+    GfVec3d* translationsData = translations.data();
+    GfVec3d* pivotsData = pivots.data();
+    GfVec3f* rotationsData = rotations.data();
+    GfVec3f* scalesData = scales.data();
+    WorkParallelForN(
+        matrices.size(),
+        [=](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                decomposeMatrix(matricesData[i], rotationOrder, translationsData[i], pivotsData[i], rotationsData[i], scalesData[i]);
+            }
+        },
+        s_xformGrainSize
+    );
+}
+
+void usdex::core::computeTransformComponentsQuat(
+    const VtMatrix4dArray& matrices,
+    VtVec3dArray& translations,
+    VtVec3dArray& pivots,
+    VtQuatfArray& orientations,
+    VtVec3fArray& scales
+)
+{
+    TRACE_FUNCTION();
+
+    translations.resize(matrices.size());
+    pivots.resize(matrices.size());
+    orientations.resize(matrices.size());
+    scales.resize(matrices.size());
+
+    const GfMatrix4d* matricesData = matrices.cdata();
+    GfVec3d* translationsData = translations.data();
+    GfVec3d* pivotsData = pivots.data();
+    GfQuatf* orientationsData = orientations.data();
+    GfVec3f* scalesData = scales.data();
+    WorkParallelForN(
+        matrices.size(),
+        [=](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                computeComponentsFromMatrix(matricesData[i], translationsData[i], pivotsData[i], orientationsData[i], scalesData[i]);
+            }
+        },
+        s_xformGrainSize
+    );
+}
+
+void usdex::core::getLocalTransformComponentsQuat(
+    const UsdPrim& prim,
+    GfVec3d& translation,
+    GfVec3d& pivot,
+    GfQuatf& orientation,
+    GfVec3f& scale,
+    UsdTimeCode time
+)
+{
+    TRACE_FUNCTION();
+
+    // Initialize with identity values
     translation.Set(0.0, 0.0, 0.0);
     pivot.Set(0.0, 0.0, 0.0);
     orientation = GfQuatf::GetIdentity();
@@ -830,8 +1823,244 @@ void usdex::core::getLocalTransformComponentsQuat(
     }
 }
 
+class usdex::core::WorldTransformCache::WorldTransformCacheImpl : public TfWeakBase
+{
+
+public:
+
+    WorldTransformCacheImpl(UsdStagePtr stage, UsdTimeCode time) : m_stage(std::move(stage)), m_time(time)
+    {
+        if (m_stage)
+        {
+            m_noticeKey = TfNotice::Register(TfCreateWeakPtr(this), &WorldTransformCacheImpl::onObjectsChanged, m_stage);
+        }
+    }
+
+    ~WorldTransformCacheImpl()
+    {
+        TfNotice::Revoke(m_noticeKey);
+    }
+
+    UsdTimeCode getTime() const
+    {
+        return m_time;
+    }
+
+    void setTime(UsdTimeCode time)
+    {
+        if (time != m_time)
+        {
+            m_time = time;
+            clear();
+        }
+    }
+
+    GfMatrix4d getWorldTransform(const UsdPrim& prim)
+    {
+        GfMatrix4d result(1.0);
+        if (!prim || prim.GetStage() != m_stage)
+        {
+            return result;
+        }
+
+        // Walk up to the nearest cached ancestor, gathering the prims whose world transforms are not yet known
+        std::vector<UsdPrim> uncached;
+        for (UsdPrim current = prim; current && !current.IsPseudoRoot(); current = current.GetParent())
+        {
+            if (find(current.GetPath(), result))
+            {
+                break;
+            }
+            uncached.push_back(current);
+        }
+
+        // Compute and cache the world transforms from the top down, so that each builds on the world transform of its parent
+        for (auto it = uncached.rbegin(); it != uncached.rend(); ++it)
+        {
+            GfMatrix4d localTransform(1.0);
+            bool resetsXformStack = false;
+            UsdGeomXformable xformable(*it);
+            if (xformable && !xformable.GetLocalTransformation(&localTransform, &resetsXformStack, m_time))
+            {
+                localTransform.SetIdentity();
+                resetsXformStack = false;
+            }
+            result = resetsXformStack ? localTransform : localTransform * result;
+            insert(it->GetPath(), result);
+        }
+
+        return result;
+    }
+
+    void clear()
+    {
+        for (Shard& shard : m_shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.transforms.clear();
+        }
+    }
+
+    size_t size() const
+    {
+        size_t result = 0;
+        for (const Shard& shard : m_shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            result += shard.transforms.size();
+        }
+        return result;
+    }
+
+private:
+
+    static constexpr size_t s_numShards = 16;
+
+    // The transforms are ordered by path, so that the transforms of a prim and all of its descendants are contiguous
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::map<SdfPath, GfMatrix4d> transforms;
+    };
+
+    Shard& getShard(const SdfPath& path)
+    {
+        return m_shards[SdfPath::Hash()(path) % s_numShards];
+    }
+
+    bool find(const SdfPath& path, GfMatrix4d& transform)
+    {
+        Shard& shard = getShard(path);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.transforms.find(path);
+        if (it == shard.transforms.end())
+        {
+            return false;
+        }
+        transform = it->second;
+        return true;
+    }
+
+    void insert(const SdfPath& path, const GfMatrix4d& transform)
+    {
+        Shard& shard = getShard(path);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.transforms.emplace(path, transform);
+    }
+
+    void onObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+    {
+        // Any resync may change the hierarchy or the xformable schema of a prim, but otherwise only changes to the xformOps invalidate a prim
+        SdfPathVector paths;
+        for (const SdfPath& path : notice.GetResyncedPaths())
+        {
+            paths.push_back(path.GetPrimPath());
+        }
+        for (const SdfPath& path : notice.GetChangedInfoOnlyPaths())
+        {
+            if (path.IsPropertyPath() && (path.GetNameToken() == UsdGeomTokens->xformOpOrder || UsdGeomXformOp::IsXformOp(path.GetNameToken())))
+            {
+                paths.push_back(path.GetPrimPath());
+            }
+        }
+        if (paths.empty())
+        {
+            return;
+        }
+
+        SdfPath::RemoveDescendentPaths(&paths);
+        if (paths.front() == SdfPath::AbsoluteRootPath())
+        {
+            clear();
+            return;
+        }
+
+        // Discard the transforms of each changed prim and all of its descendants
+        for (Shard& shard : m_shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const SdfPath& path : paths)
+            {
+                auto it = shard.transforms.lower_bound(path);
+                while (it != shard.transforms.end() && it->first.HasPrefix(path))
+                {
+                    it = shard.transforms.erase(it);
+                }
+            }
+        }
+    }
+
+    UsdStagePtr m_stage;
+    UsdTimeCode m_time;
+    TfNotice::Key m_noticeKey;
+    Shard m_shards[s_numShards];
+};
+
+usdex::core::WorldTransformCache::WorldTransformCache(UsdStagePtr stage, UsdTimeCode time)
+    : m_impl(new WorldTransformCacheImpl(std::move(stage), time))
+{
+}
+
+usdex::core::WorldTransformCache::~WorldTransformCache()
+{
+    delete m_impl;
+}
+
+UsdTimeCode usdex::core::WorldTransformCache::getTime() const
+{
+    return m_impl->getTime();
+}
+
+void usdex::core::WorldTransformCache::setTime(UsdTimeCode time)
+{
+    m_impl->setTime(time);
+}
+
+GfMatrix4d usdex::core::WorldTransformCache::getWorldTransform(const UsdPrim& prim) const
+{
+    TRACE_FUNCTION();
+
+    return m_impl->getWorldTransform(prim);
+}
+
+VtMatrix4dArray usdex::core::WorldTransformCache::getWorldTransforms(const std::vector<UsdPrim>& prims) const
+{
+    TRACE_FUNCTION();
+
+    VtMatrix4dArray result(prims.size());
+    const UsdPrim* primsData = prims.data();
+    GfMatrix4d* resultData = result.data();
+    WorldTransformCacheImpl* impl = m_impl;
+    WorkParallelForN(
+        prims.size(),
+        [primsData, resultData, impl](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                resultData[i] = impl->getWorldTransform(primsData[i]);
+            }
+        },
+        s_xformGrainSize
+    );
+    return result;
+}
+
+void usdex::core::WorldTransformCache::clear()
+{
+    m_impl->clear();
+}
+
+size_t usdex::core::WorldTransformCache::size() const
+{
+    return m_impl->size();
+}
+
 UsdGeomXform usdex::core::defineXform(UsdStagePtr stage, const SdfPath& path, std::optional<const pxr::GfTransform> transform)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "defineXform");
+    instrumentation.addElements(1);
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -841,22 +2070,20 @@ UsdGeomXform usdex::core::defineXform(UsdStagePtr stage, const SdfPath& path, st
     }
 
     // Define the Xform and check that this was successful
-    UsdGeomXform xform = UsdGeomXform::Define(stage, path);
+    UsdGeomXform xform = usdex::core::detail::definePrim<UsdGeomXform>(stage, path);
     if (!xform)
     {
         TF_RUNTIME_ERROR("Unable to define UsdGeomXform at \"%s\"", path.GetAsString().c_str());
         return UsdGeomXform();
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = xform.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
+    // Author the remaining opinions with a single round of change processing when using the Sdf authoring backend
+    usdex::core::detail::AuthoringChangeBlock authoringBlock;
 
     // Set the local transform if one was supplied
     if (transform.has_value())
     {
-        usdex::core::setLocalTransform(prim, transform.value(), UsdTimeCode::Default());
+        usdex::core::setLocalTransform(xform.GetPrim(), transform.value(), UsdTimeCode::Default());
     }
 
     return xform;
@@ -864,6 +2091,10 @@ UsdGeomXform usdex::core::defineXform(UsdStagePtr stage, const SdfPath& path, st
 
 UsdGeomXform usdex::core::defineXform(UsdPrim parent, const std::string& name, std::optional<const pxr::GfTransform> transform)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "defineXform");
+    instrumentation.addElements(1);
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -880,6 +2111,10 @@ UsdGeomXform usdex::core::defineXform(UsdPrim parent, const std::string& name, s
 
 UsdGeomXform usdex::core::defineXform(UsdPrim prim, std::optional<const pxr::GfTransform> transform)
 {
+    TRACE_FUNCTION();
+    USDEX_INSTRUMENT_SCOPE(instrumentation, "defineXform");
+    instrumentation.addElements(1);
+
     // Early out if the prim is invalid
     if (!prim)
     {
@@ -906,6 +2141,8 @@ UsdGeomXform usdex::core::defineXform(UsdPrim prim, std::optional<const pxr::GfT
 
 bool usdex::core::setLocalTransform(const UsdGeomXformable& xformable, const GfTransform& transform, UsdTimeCode time)
 {
+    TRACE_FUNCTION();
+
     if (!xformable)
     {
         TF_RUNTIME_ERROR("UsdGeomXformable <%s> is not valid.", xformable.GetPrim().GetPath().GetAsString().c_str());
@@ -917,6 +2154,8 @@ bool usdex::core::setLocalTransform(const UsdGeomXformable& xformable, const GfT
 
 bool usdex::core::setLocalTransform(const UsdGeomXformable& xformable, const GfMatrix4d& matrix, UsdTimeCode time)
 {
+    TRACE_FUNCTION();
+
     if (!xformable)
     {
         TF_RUNTIME_ERROR("UsdGeomXformable <%s> is not valid.", xformable.GetPrim().GetPath().GetAsString().c_str());
@@ -936,6 +2175,8 @@ bool usdex::core::setLocalTransform(
     UsdTimeCode time
 )
 {
+    TRACE_FUNCTION();
+
     if (!xformable)
     {
         TF_RUNTIME_ERROR("UsdGeomXformable <%s> is not valid.", xformable.GetPrim().GetPath().GetAsString().c_str());
@@ -953,6 +2194,8 @@ bool usdex::core::setLocalTransform(
     UsdTimeCode time
 )
 {
+    TRACE_FUNCTION();
+
     if (!xformable)
     {
         TF_RUNTIME_ERROR("UsdGeomXformable <%s> is not valid.", xformable.GetPrim().GetPath().GetAsString().c_str());
@@ -964,6 +2207,8 @@ bool usdex::core::setLocalTransform(
 
 GfTransform usdex::core::getLocalTransform(const UsdGeomXformable& xformable, UsdTimeCode time)
 {
+    TRACE_FUNCTION();
+
     if (!xformable)
     {
         TF_RUNTIME_ERROR("UsdGeomXformable <%s> is not valid.", xformable.GetPrim().GetPath().GetAsString().c_str());
@@ -975,6 +2220,8 @@ GfTransform usdex::core::getLocalTransform(const UsdGeomXformable& xformable, Us
 
 GfMatrix4d usdex::core::getLocalTransformMatrix(const UsdGeomXformable& xformable, UsdTimeCode time)
 {
+    TRACE_FUNCTION();
+
     if (!xformable)
     {
         TF_RUNTIME_ERROR("UsdGeomXformable <%s> is not valid.", xformable.GetPrim().GetPath().GetAsString().c_str());
@@ -994,6 +2241,8 @@ void usdex::core::getLocalTransformComponents(
     UsdTimeCode time
 )
 {
+    TRACE_FUNCTION();
+
     if (!xformable)
     {
         TF_RUNTIME_ERROR("UsdGeomXformable <%s> is not valid.", xformable.GetPrim().GetPath().GetAsString().c_str());
@@ -1018,6 +2267,8 @@ void usdex::core::getLocalTransformComponentsQuat(
     UsdTimeCode time
 )
 {
+    TRACE_FUNCTION();
+
     if (!xformable)
     {
         TF_RUNTIME_ERROR("UsdGeomXformable <%s> is not valid.", xformable.GetPrim().GetPath().GetAsString().c_str());
@@ -1,7 +1,7 @@
 # SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 #
-__all__ = ["createAssetPayload", "addAssetContent", "addAssetLibrary"]
+__all__ = ["createAssetPayload", "createAssetLodPayload", "addAssetContent", "addAssetLibrary"]
 
 from typing import Optional
 
@@ -34,7 +34,40 @@ def createAssetPayload(stage: Usd.Stage, format: str = "usda", fileFormatArgs: O
     # This function should mimic the behavior of the C++ function `usdex::core::createAssetPayload`.
     # It has been re-implemented here rather than bound to python using pybind11 due to issues with the transfer of ownership of the UsdStage object
     # from C++ to Python
+    return _createAssetPayloadStage(stage, f"./{getPayloadToken()}/{getContentsToken()}.{format}", fileFormatArgs)
 
+
+def createAssetLodPayload(stage: Usd.Stage, lod: str, format: str = "usda", fileFormatArgs: Optional[dict] = None) -> Optional[Usd.Stage]:
+    """
+    Create a relative layer within a ``getPayloadToken()/<lod>`` subdirectory to hold the content of one level of detail (LOD) of an asset.
+
+    This is equivalent to ``createAssetPayload``, but each LOD is held in its own subdirectory, so the Content Layers and Asset Libraries
+    which are subsequently added to it (via ``usdex.core.addAssetContent`` and ``usdex.core.addAssetLibrary``) are independent of those of
+    every other LOD.
+
+    Note:
+        This function does not create an actual Payload. The payload layers of all LODs should eventually be the targets of the
+        Payloads within the LOD variant set of the Asset Interface (via ``usdex.core.addAssetLodInterface``).
+
+    Args:
+        stage: The stage's edit target identifier will dictate where the relative payload layer will be created.
+        lod: The name of the LOD (e.g. "Proxy" or "Render"). This must be a valid identifier, as it names both a directory and a variant.
+        format: The file format extension (default: "usda").
+        fileFormatArgs: Additional file format-specific arguments to be supplied during stage creation.
+
+    Returns:
+        The newly created relative payload layer opened as a new stage. Returns an invalid stage on error.
+    """
+    # This function should mimic the behavior of the C++ function `usdex::core::createAssetLodPayload`.
+    if not Sdf.Path.IsValidIdentifier(lod):
+        Tf.Warn(f'Unable to create asset LOD payload stage due to an invalid LOD name "{lod}"')
+        return None
+
+    return _createAssetPayloadStage(stage, f"./{getPayloadToken()}/{lod}/{getContentsToken()}.{format}", fileFormatArgs)
+
+
+def _createAssetPayloadStage(stage: Usd.Stage, relativeIdentifier: str, fileFormatArgs: Optional[dict]) -> Optional[Usd.Stage]:
+    # Common implementation for createAssetPayload and createAssetLodPayload
     if not stage:
         Tf.Warn("Unable to create asset payload stage due to an invalid asset stage")
         return None
@@ -48,7 +81,7 @@ def createAssetPayload(stage: Usd.Stage, format: str = "usda", fileFormatArgs: O
     fileFormatArgs = fileFormatArgs or dict()
 
     payloadStage: Usd.Stage = createStage(
-        resolver.CreateIdentifier(f"./{getPayloadToken()}/{getContentsToken()}.{format}", resolver.Resolve(stage.GetRootLayer().identifier)),
+        resolver.CreateIdentifier(relativeIdentifier, resolver.Resolve(stage.GetRootLayer().identifier)),
         defaultPrimName=stage.GetDefaultPrim().GetName(),
         upAxis=UsdGeom.GetStageUpAxis(stage),
         linearUnits=UsdGeom.GetStageMetersPerUnit(stage),
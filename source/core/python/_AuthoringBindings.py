@@ -0,0 +1,165 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+__all__ = ["ScopedAuthoringBackend", "ScopedValidationPolicy", "authorLayersConcurrently"]
+
+import concurrent.futures
+from typing import Callable, List, Optional
+
+from pxr import Sdf, Tf, Usd
+
+from ._usdex_core import (
+    AuthoringBackend,
+    AuthoringSession,
+    ValidationPolicy,
+    getAuthoringBackend,
+    getValidationPolicy,
+    setAuthoringBackend,
+    setValidationPolicy,
+)
+
+
+class ScopedAuthoringBackend:
+    """
+    A context manager which selects an `AuthoringBackend` on the calling thread for the duration of the context.
+
+    The previous backend is restored on exit, so contexts can be nested.
+
+    Example:
+
+        with usdex.core.ScopedAuthoringBackend(usdex.core.AuthoringBackend.eSdf):
+            usdex.core.defineXform(stage, path)
+
+    Args:
+        value: The `AuthoringBackend` to select.
+    """
+
+    def __init__(self, value: AuthoringBackend):
+        self.__value = value
+        self.__previous = None
+
+    def __enter__(self):
+        self.__previous = getAuthoringBackend()
+        setAuthoringBackend(self.__value)
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        setAuthoringBackend(self.__previous)
+        return False
+
+
+class ScopedValidationPolicy:
+    """
+    A context manager which selects a `ValidationPolicy` on the calling thread for the duration of the context.
+
+    The previous policy is restored on exit, so contexts can be nested.
+
+    Example:
+
+        with usdex.core.ScopedValidationPolicy(usdex.core.ValidationPolicy.eTrusted):
+            usdex.core.definePolyMesh(parent, name, faceVertexCounts, faceVertexIndices, points)
+
+    Args:
+        value: The `ValidationPolicy` to select.
+    """
+
+    def __init__(self, value: ValidationPolicy):
+        self.__value = value
+        self.__previous = None
+
+    def __enter__(self):
+        self.__previous = getValidationPolicy()
+        setValidationPolicy(self.__value)
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        setValidationPolicy(self.__previous)
+        return False
+
+
+def authorLayersConcurrently(stage: Usd.Stage, workers: List[Callable[[AuthoringSession], bool]]) -> List[Optional[Sdf.Layer]]:
+    """
+    Author several independent layers concurrently, giving each worker its own layer, stage, ``NameCache``, and ``AuthoringSession``.
+
+    All of the layers are created before any worker begins. Each worker layer is anonymous, holds the layer metadata of the root layer of
+    ``stage`` (e.g. the ``defaultPrim`` and stage metrics), and temporarily has the root layer of ``stage`` as its only subLayer. This allows
+    each worker to read the existing prims of ``stage`` and to author opinions on them from its own stage, without modifying the layers of
+    ``stage``. Each worker is then invoked on its own thread with an ``AuthoringSession`` on its own stage, targeting its own layer, and with the
+    ``ValidationPolicy`` of the calling thread.
+
+    Once all of the workers have finished, their stages are closed and the temporary subLayer is removed, so each layer holds only the opinions
+    of its worker. The layers can then be combined with the opinions of ``stage`` using ``mergeLayers``, which reports any conflicting opinions,
+    or exported and added to the subLayers of the edit target.
+
+    Example:
+
+        .. code-block:: python
+
+            def authorMaterials(session):
+                parent = session.getStage().GetDefaultPrim()
+                return bool(usdex.core.defineScope(parent, "Materials"))
+
+            layers = usdex.core.authorLayersConcurrently(stage, [authorGeometry, authorMaterials])
+            success, conflicts = usdex.core.mergeLayers(stage.GetRootLayer(), layers)
+
+    Warning:
+        The workers run concurrently, so each worker must only author to (and compose) its own stage, and ``stage`` must not be edited until
+        this function returns. Python workers hold the GIL while they run, so only the portions of their work which release the GIL will overlap.
+
+    Args:
+        stage: The stage whose root layer is read by the workers.
+        workers: Callables accepting an ``AuthoringSession`` on the stage of the worker. Each must return True if its opinions were authored
+            successfully.
+
+    Returns:
+        The authored layers, in the order of the workers. The layer of each worker which failed is None.
+    """
+    # This function should mimic the behavior of the C++ function `usdex::core::authorLayersConcurrently`.
+    # It has been re-implemented here rather than bound to python using pybind11 due to issues with the transfer of ownership of the SdfLayer
+    # objects from C++ to Python
+    if not stage:
+        Tf.Warn("Unable to author layers concurrently due to an invalid stage")
+        return [None] * len(workers)
+
+    # Create all of the layers and stages up front, so that the workers never modify a layer which is shared with another worker
+    rootLayer = stage.GetRootLayer()
+    layers = []
+    stages = []
+    for i, worker in enumerate(workers):
+        if not worker:
+            layers.append(None)
+            stages.append(None)
+            continue
+
+        layer = Sdf.Layer.CreateAnonymous(f"worker_{i}")
+        for key in rootLayer.pseudoRoot.ListInfoKeys():
+            if key not in ("subLayers", "subLayerOffsets"):
+                layer.pseudoRoot.SetInfo(key, rootLayer.pseudoRoot.GetInfo(key))
+        layer.subLayerPaths = [rootLayer.identifier]
+        layers.append(layer)
+        stages.append(Usd.Stage.Open(layer))
+
+    # The ValidationPolicy of the calling thread applies to every worker
+    policy = getValidationPolicy()
+
+    def author(i: int) -> bool:
+        with ScopedValidationPolicy(policy), AuthoringSession(stages[i], Usd.EditTarget(layers[i])) as session:
+            return bool(workers[i](session))
+
+    # Author each layer on its own worker. Diagnostics are emitted by the workers, but the results are reported in order afterwards.
+    authored = [False] * len(workers)
+    with concurrent.futures.ThreadPoolExecutor() as executor:
+        futures = {executor.submit(author, i): i for i in range(len(workers)) if stages[i]}
+        for future in concurrent.futures.as_completed(futures):
+            authored[futures[future]] = future.result()
+
+    for i in range(len(workers)):
+        stages[i] = None
+        if layers[i]:
+            layers[i].subLayerPaths = []
+
+        if not authored[i]:
+            Tf.Warn(f"Unable to author layer {i} concurrently")
+            layers[i] = None
+
+    return layers
@@ -0,0 +1,35 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+__all__ = ["ScopedDiagnosticsLevel"]
+
+from ._usdex_core import DiagnosticsLevel, getThreadDiagnosticsLevel, setThreadDiagnosticsLevel
+
+
+class ScopedDiagnosticsLevel:
+    """
+    A context manager which overrides the `DiagnosticsLevel` on the calling thread for the duration of the context.
+
+    The previous override is restored on exit, so contexts can be nested.
+
+    Example:
+
+        with usdex.core.ScopedDiagnosticsLevel(usdex.core.DiagnosticsLevel.eError):
+            usdex.core.definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points)
+
+    Args:
+        value: The `DiagnosticsLevel` to apply.
+    """
+
+    def __init__(self, value: DiagnosticsLevel):
+        self.__value = value
+        self.__previous = None
+
+    def __enter__(self):
+        self.__previous = getThreadDiagnosticsLevel()
+        setThreadDiagnosticsLevel(self.__value)
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        setThreadDiagnosticsLevel(self.__previous)
+        return False
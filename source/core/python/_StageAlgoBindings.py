@@ -1,7 +1,7 @@
 # SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 #
-__all__ = ["createStage"]
+__all__ = ["createStage", "createInMemoryStage"]
 
 from typing import Optional
 
@@ -78,3 +78,59 @@ def createStage(
 
     # Return a stage wrapping the exported layer
     return Usd.Stage.Open(identifier)
+
+
+def createInMemoryStage(
+    identifier: str,
+    defaultPrimName: str,
+    upAxis: str,
+    linearUnits: float,
+    authoringMetadata: str,
+    fileFormatArgs: Optional[dict] = None,
+    massUnits: Optional[float] = None,
+) -> Optional[Usd.Stage]:
+    """
+    Create and configure an in-memory `Usd.Stage` which will later be exported to the identifier using `exportInMemoryStage`.
+
+    This validates the arguments as `createStage` does and authors the same metadata, but the root layer of the stage is an anonymous layer,
+    so nothing is written to the identifier until `exportInMemoryStage` is called. Authoring to an anonymous layer avoids any intermediate
+    writes to (potentially remote) storage during a long conversion.
+
+    The identifier and file format arguments are recorded on the anonymous root layer, as its tag and file format arguments respectively.
+
+    Args:
+        identifier: The identifier to which the root layer of this stage will be exported.
+        defaultPrimName: Name of the root prim root prim.
+        upAxis: The up axis for all the geometry contained in the stage.
+        linearUnits: The meters per unit for all linear measurements in the stage.
+        authoringMetadata: The provenance information from the host application. See `setLayerAuthoringMetadata` for details.
+        fileFormatArgs: Additional file format-specific arguments to be supplied when the stage is exported.
+        massUnits: The kilograms per unit for all mass measurements in the stage. If not provided, the default value will be used.
+
+    Returns:
+        The newly created stage or None
+    """
+    # This function should mimic the behavior of the C++ function `usdex::core::createInMemoryStage`.
+    # It has been re-implemented here for the same reasons as `createStage`
+
+    # Early out for an unsupported identifier
+    if not identifier or not Usd.Stage.IsSupportedFile(identifier):
+        Tf.Warn(f'Unable to create UsdStage at "{identifier}" due to an invalid identifier')
+        return None
+
+    # The identifier is the tag of the anonymous layer, and the file format arguments are retained by the layer until it is exported
+    layer = Sdf.Layer.CreateAnonymous(identifier, fileFormatArgs or dict())
+    if not layer:
+        return None
+    stage = Usd.Stage.Open(layer)
+
+    # Configure the stage and early out on failure
+    # Note that the warnings from this call will not exactly match the more contextual ones from the C++ logic
+    if massUnits is None:
+        if not configureStage(stage, defaultPrimName, upAxis, linearUnits, authoringMetadata):
+            return None
+    else:
+        if not configureStage(stage, defaultPrimName, upAxis, linearUnits, massUnits, authoringMetadata):
+            return None
+
+    return stage
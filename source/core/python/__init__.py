@@ -5,53 +5,119 @@
 `usdex.core <https://docs.omniverse.nvidia.com/usd/code-docs/usd-exchange-sdk/latest/docs/python-usdex-core.html>`_ provides higher-level convenience
 functions top of lower-level `OpenUSD <https://openusd.org/release/index.html>`_ concepts, so developers can quickly adopt OpenUSD best practices
 when mapping their native data sources to OpenUSD-legible data models.
+
+Functions which author or save significant amounts of data (e.g. ``definePolyMesh``, ``definePointCloud``, ``saveStage``, or ``exportLayer``)
+release the GIL once their arguments have been converted, so threaded Python pipelines can run them concurrently. Concurrent calls are safe
+when each thread authors a separate ``Usd.Stage`` or ``Sdf.Layer``, as OpenUSD does not support concurrent authoring of a single layer.
+Stateful helpers (e.g. ``NameCache``, ``MeshLibrary``, or ``TiledPointCloudWriter``) must not be shared between threads.
 """
 
 __all__ = [
     # core
     "version",
     "buildVersion",
+    "initialize",
+    "isInitialized",
     "deprecated",
     # settings
     "enableTranscodingSetting",
     # diagnostics
     "DiagnosticsLevel",
     "DiagnosticsOutputStream",
+    "DiagnosticsLimits",
+    "DiagnosticsSourceCount",
+    "DiagnosticRecord",
     "isDiagnosticsDelegateActive",
     "activateDiagnosticsDelegate",
     "deactivateDiagnosticsDelegate",
     "setDiagnosticsLevel",
     "getDiagnosticsLevel",
+    "getThreadDiagnosticsLevel",
+    "setThreadDiagnosticsLevel",
+    "ScopedDiagnosticsLevel",
     "getDiagnosticLevel",
     "setDiagnosticsOutputStream",
     "getDiagnosticsOutputStream",
+    "setDiagnosticsOutputAsync",
+    "isDiagnosticsOutputAsync",
+    "setDiagnosticsLimits",
+    "getDiagnosticsLimits",
+    "setDiagnosticsCallback",
+    "setDiagnosticsCountingEnabled",
+    "isDiagnosticsCountingEnabled",
+    "setDiagnosticsCaptureLimit",
+    "getDiagnosticsCaptureLimit",
+    "getDiagnosticsCounts",
+    "getDiagnosticsSourceCounts",
+    "resetDiagnosticsCounts",
+    "flushDiagnostics",
+    # instrumentation
+    "AuthoringMetrics",
+    "setInstrumentationEnabled",
+    "isInstrumentationEnabled",
+    "getAuthoringMetrics",
+    "resetAuthoringMetrics",
+    # authoring
+    "AuthoringBackend",
+    "getAuthoringBackend",
+    "setAuthoringBackend",
+    "ScopedAuthoringBackend",
+    "ValidationPolicy",
+    "getValidationPolicy",
+    "setValidationPolicy",
+    "ScopedValidationPolicy",
+    "AuthoringSession",
+    "authorLayersConcurrently",
+    "ValueClipOptions",
+    "ValueClipSession",
     # layers
     "hasLayerAuthoringMetadata",
     "setLayerAuthoringMetadata",
     "getLayerAuthoringMetadata",
     "saveLayer",
     "exportLayer",
+    "ExportLayerProgress",
+    "mergeLayers",
+    "LayerMergeConflict",
     # stage
     "createStage",
+    "createInMemoryStage",
     "configureStage",
     "saveStage",
+    "saveDirtyLayers",
+    "saveStageAsync",
+    "exportInMemoryStage",
+    "SaveStageFuture",
     "isEditablePrimLocation",
+    "areEditablePrimLocations",
     # asset structure
     "getAssetToken",
     "getContentsToken",
     "getGeometryToken",
     "getLibraryToken",
+    "getLodToken",
     "getMaterialsToken",
     "getPayloadToken",
     "getPhysicsToken",
     "getTexturesToken",
     "definePayload",
+    "definePayloads",
     "defineReference",
+    "defineReferences",
+    "InstancingReport",
+    "instanceRepeatedReferences",
     "defineScope",
     "createAssetPayload",
+    "createAssetLodPayload",
     "addAssetContent",
     "addAssetLibrary",
     "addAssetInterface",
+    "addAssetInterfaces",
+    "addAssetLodInterface",
+    "authorExtentsHints",
+    "updateExtentsHints",
+    "AssetContentStream",
+    "authorAssetContents",
     # names
     "getValidPrimName",
     "getValidPrimNames",
@@ -61,26 +127,52 @@ __all__ = [
     "ValidChildNameCache",
     "getValidPropertyName",
     "getValidPropertyNames",
+    "getDecodedNames",
     "getDisplayName",
     "setDisplayName",
     "clearDisplayName",
     "blockDisplayName",
     "computeEffectiveDisplayName",
+    "getDisplayNames",
+    "setDisplayNames",
+    "computeEffectiveDisplayNames",
     # xform
     "defineXform",
     "RotationOrder",
     "getLocalTransform",
     "getLocalTransformMatrix",
+    "getLocalTransformMatrices",
     "getLocalTransformComponents",
     "getLocalTransformComponentsQuat",
+    "computeTransformComponents",
+    "computeTransformComponentsQuat",
     "setLocalTransform",
+    "KeyframeReduction",
+    "setLocalTransforms",
+    "LocalTransformWriter",
+    "WorldTransformCache",
     # geometry
     "definePointCloud",
+    "TiledPointCloudWriter",
+    "defineTiledPointCloud",
+    "definePointInstancer",
+    "convertToPointInstancer",
     "definePolyMesh",
+    "PolyMeshDescription",
+    "definePolyMeshes",
+    "MeshLibrary",
+    "defineDeformingPolyMesh",
+    "updatePolyMesh",
+    "compactFaceVaryingPrimvar",
+    "simplifyPolyMesh",
+    "MeshLodStyle",
+    "definePolyMeshLods",
+    "defineMaterialSubsets",
     "defineLinearBasisCurves",
     "defineCubicBasisCurves",
     # camera
     "defineCamera",
+    "defineAnimatedCamera",
     # primvars
     "FloatPrimvarData",
     "IntPrimvarData",
@@ -89,15 +181,23 @@ __all__ = [
     "Vec2fPrimvarData",
     "StringPrimvarData",
     "TokenPrimvarData",
+    "PrimvarPrecision",
+    "getPrimvarPrecision",
+    "setPrimvarPrecision",
+    "ScopedPrimvarPrecision",
     # lights
     "isLight",
     "getLightAttr",
     "defineDomeLight",
     "defineRectLight",
+    "LightDescription",
+    "defineLights",
     # materials
     "createMaterial",
     "bindMaterial",
+    "bindMaterials",
     "computeEffectivePreviewSurfaceShader",
+    "SurfaceShaderCache",
     "definePreviewMaterial",
     "addDiffuseTextureToPreviewMaterial",
     "addNormalTextureToPreviewMaterial",
@@ -105,6 +205,8 @@ __all__ = [
     "addRoughnessTextureToPreviewMaterial",
     "addMetallicTextureToPreviewMaterial",
     "addOpacityTextureToPreviewMaterial",
+    "PreviewMaterialDescription",
+    "PreviewMaterialRegistry",
     "addPreviewMaterialInterface",
     "removeMaterialInterface",
     "ColorSpace",
@@ -118,10 +220,15 @@ __all__ = [
     "definePhysicsPrismaticJoint",
     "definePhysicsSphericalJoint",
     "alignPhysicsJoint",
+    "alignPhysicsJoints",
+    "PhysicsJointDescription",
+    "definePhysicsJoints",
     # physicsMaterial
     "definePhysicsMaterial",
     "addPhysicsToMaterial",
     "bindPhysicsMaterial",
+    "bindPhysicsMaterials",
+    "PhysicsMaterialRegistry",
 ]
 
 import os
@@ -148,6 +255,8 @@ else:
 
 # Import hand rolled python bindings
 from ._AssetStructureBindings import *  # noqa
+from ._AuthoringBindings import *  # noqa
+from ._DiagnosticsBindings import *  # noqa
 from ._StageAlgoBindings import *  # noqa
 
 
@@ -8,7 +8,9 @@
 
 #include "usdex/pybind/UsdBindings.h"
 
+#include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -82,7 +84,7 @@ void bindAssetStructure(module& m)
 
     m.def(
         "addAssetInterface",
-        &addAssetInterface,
+        overload_cast<UsdStagePtr, const UsdStagePtr>(&addAssetInterface),
         arg("stage"),
         arg("source"),
         R"(
@@ -100,6 +102,239 @@ void bindAssetStructure(module& m)
             Returns:
                 True if the Asset Interface was added successfully, false otherwise.
 
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "addAssetInterface",
+        overload_cast<SdfLayerHandle, const SdfLayerHandle>(&addAssetInterface),
+        arg("layer"),
+        arg("source"),
+        R"(
+            Add an Asset Interface to a layer, which payloads a source layer's contents, without composing either layer.
+
+            This is equivalent to the ``Usd.Stage`` overload, but the Asset Interface is authored from the layer metadata and the prim specs of
+            the source layer and its sublayers, which are opened but never composed. This avoids the cost of composing (and loading) the full
+            payload hierarchy, which usually dominates the cost of ``addAssetInterface`` for large assets.
+
+            As the payload is not composed, the annotations differ from the ``Usd.Stage`` overload in a few ways:
+
+                - The kinds of descendants are only adjusted for prim specs in the source layer stack. Kinds introduced by composition arcs
+                  within the payload are not considered.
+                - The extents hint is not computed. If the default prim of the source layer stack has an authored ``extentsHint`` it is copied
+                  to the Asset Interface, otherwise no extents hint is authored.
+
+            Note:
+                The layer is not saved, so that the Asset Interface can be further annotated before saving.
+
+            Args:
+                layer: The layer which will become the Asset Interface
+                source: The layer that the Asset Interface will target as a Payload
+
+            Returns:
+                True if the Asset Interface was added successfully, false otherwise.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "addAssetInterfaces",
+        &addAssetInterfaces,
+        arg("layers"),
+        arg("sources"),
+        call_guard<gil_scoped_release>(),
+        R"(
+            Add an Asset Interface to each of many layers, which payload their source layers' contents, authoring the Asset Interfaces concurrently.
+
+            This is equivalent to calling the ``Sdf.Layer`` overload of ``addAssetInterface`` for each pair of layers, but the Asset Interfaces
+            are authored by independent workers. A failure to author one Asset Interface does not prevent the others from being authored.
+
+            Warning:
+                Each layer must be distinct, and must not be a source layer (or a sublayer of a source layer) of another Asset Interface.
+
+            Args:
+                layers: The layers which will become the Asset Interfaces
+                sources: The layer that each Asset Interface will target as a Payload. This must be the same length as ``layers``.
+
+            Returns:
+                True if all of the Asset Interfaces were added successfully, false otherwise.
+
+        )"
+    );
+
+    m.def(
+        "addAssetLodInterface",
+        &addAssetLodInterface,
+        arg("stage"),
+        arg("lodSources"),
+        arg("defaultLod"),
+        R"(
+            Add an Asset Interface to a stage, which payloads one of several levels of detail (LODs) selected by a variant set.
+
+            This is equivalent to ``addAssetInterface``, but the default prim authors a ``getLodToken()`` variant set with one variant per LOD,
+            and each variant holds the Payload to the contents of that LOD. As only the selected variant is composed, opening the asset only
+            opens the layers of the selected LOD, so a light proxy LOD opens without touching the layers of any heavier LOD.
+
+            The variant of each LOD is authored directly on its variant spec, so no LOD other than the default is ever composed by this function.
+            The stage is (re)configured with the metadata of the default LOD, and the extents hint is computed from the default LOD.
+
+            Args:
+                stage: The stage's edit target will become the Asset Interface
+                lodSources: A list of (name, stage) tuples, in order, with the stage each LOD variant will target as a Payload
+                defaultLod: The name of the LOD which is selected by default. This must be one of the LODs.
+
+            Returns:
+                True if the Asset Interface was added successfully, false otherwise.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "authorExtentsHints",
+        &authorExtentsHints,
+        arg("root"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Author the ``extentsHint`` of a prim and of every model prim below it, aggregating the extents of the geometry bottom-up.
+
+            Viewers can read the bounds of a model from its ``extentsHint`` without traversing (or loading) its descendants. The extents hints are
+            equivalent to ``UsdGeom.ModelAPI.ComputeExtentsHint`` using a ``UsdGeom.BBoxCache`` which uses extents hints, but they are computed
+            without a bounding box cache and without loading any payloads:
+
+            - The authored ``extent`` of each boundable prim (e.g. the meshes, points, and curves defined by usdex) is its bound.
+            - The transforms, purposes, and extents of all prims are read concurrently.
+            - The extents hints are computed bottom-up, concurrently for the models at each depth.
+            - Prims which are not loaded (e.g. an unloaded payload of an asset) contribute their authored ``extentsHint``, if any.
+
+            The ``UsdGeom.ModelAPI`` is applied and the ``extentsHint`` is authored on ``root`` (regardless of its kind) and on each model prim
+            below it, except for those within instances. All opinions are authored on the current edit target within a single ``Sdf.ChangeBlock``.
+
+            Args:
+                root: The prim whose extents hint, and whose descendant models' extents hints, will be authored
+                time: The time at which to compute and author the extents hints
+
+            Returns:
+                True if all of the extents hints were authored, false otherwise.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "updateExtentsHints",
+        &updateExtentsHints,
+        arg("root"),
+        arg("editedPaths"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Update the ``extentsHint`` of a prim and of the model prims below it which are affected by edits, after ``authorExtentsHints``.
+
+            This is equivalent to ``authorExtentsHints``, but only the extents hints of models which are (or are ancestors of) an edited path are
+            recomputed. Every other model with an authored ``extentsHint`` contributes it as its bound, and its descendants are not traversed.
+            Models which do not yet have an authored ``extentsHint`` are always computed and authored.
+
+            Args:
+                root: The prim whose extents hint, and whose descendant models' extents hints, will be updated
+                editedPaths: The paths of the prims or properties which have been edited, added, or removed. Paths outside ``root`` are ignored.
+                time: The time at which to compute and author the extents hints
+
+            Returns:
+                True if all of the affected extents hints were authored (or none were affected), false otherwise.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<AssetContentStream>(
+        m,
+        "AssetContentStream",
+        "A domain of an asset (e.g. Geometry, Materials, Physics) to be authored by ``authorAssetContents``."
+    )
+
+        .def(
+            ::init(
+                [](const std::string& name,
+                   const AssetContentFn& author,
+                   bool addLibrary,
+                   const std::string& format,
+                   const std::string& libraryFormat,
+                   const SdfLayer::FileFormatArguments& fileFormatArgs)
+                {
+                    return AssetContentStream{ name, author, addLibrary, format, libraryFormat, fileFormatArgs };
+                }
+            ),
+            arg("name"),
+            arg("author"),
+            arg("addLibrary") = false,
+            arg("format") = "usda",
+            arg("libraryFormat") = "usdc",
+            arg("fileFormatArgs") = SdfLayer::FileFormatArguments(),
+            R"(
+                Describe a domain of an asset.
+
+                Args:
+                    name: The name of the Content Layer and of the Library Layer (e.g., "Geometry", "Materials", "Physics")
+                    author: A callable accepting the content stage, the library stage (or None), and a ``NameCache`` which is only used by this
+                        stream. It must return True if the content was authored successfully.
+                    addLibrary: Whether to create a Library Layer for the stream, as per ``addAssetLibrary``
+                    format: The file format extension of the Content Layer
+                    libraryFormat: The file format extension of the Library Layer
+                    fileFormatArgs: Additional file format-specific arguments to be supplied during stage creation
+            )"
+        )
+
+        .def_readwrite("name", &AssetContentStream::name, "The name of the Content Layer and of the Library Layer.")
+
+        .def_readwrite("author", &AssetContentStream::author, "Authors the data of the Content Layer and of the Library Layer.")
+
+        .def_readwrite("addLibrary", &AssetContentStream::addLibrary, "Whether to create a Library Layer for the stream.")
+
+        .def_readwrite("format", &AssetContentStream::format, "The file format extension of the Content Layer.")
+
+        .def_readwrite("libraryFormat", &AssetContentStream::libraryFormat, "The file format extension of the Library Layer.")
+
+        .def_readwrite(
+            "fileFormatArgs",
+            &AssetContentStream::fileFormatArgs,
+            "Additional file format-specific arguments to be supplied during stage creation."
+        );
+
+    m.def(
+        "authorAssetContents",
+        &authorAssetContents,
+        arg("stage"),
+        arg("streams"),
+        arg("payloadFormat") = "usda",
+        arg("fileFormatArgs") = SdfLayer::FileFormatArguments(),
+        call_guard<gil_scoped_release>(),
+        R"(
+            Create, author, and assemble all of the layers of an asset, authoring the data of each domain concurrently.
+
+            This is equivalent to calling ``createAssetPayload``, then ``addAssetLibrary`` and ``addAssetContent`` for each stream, authoring and
+            saving each stream in turn, and finally saving the payload stage and calling ``addAssetInterface``. However, the data of the streams is
+            authored by independent workers, so the total time is close to that of the slowest stream.
+
+            All of the layers are created up front, in the order of the streams. Each stream is then authored and saved by its own worker, using
+            its own content stage, library stage, and ``NameCache``. Each stream is prepended to the subLayers of the payload, as per
+            ``addAssetContent``, so later streams are stronger than earlier streams.
+
+            Warning:
+                The streams are authored concurrently, so each stream must only author (and compose) its own layers. Python authoring functions
+                hold the GIL while they run, so only the portions of their work which release the GIL will overlap.
+
+            Note:
+                The asset stage itself is not saved, so that the Asset Interface can be further annotated before saving.
+
+            Args:
+                stage: The stage's edit target identifier will dictate where the asset layers will be created and will become the Asset Interface
+                streams: The domains of the asset to author
+                payloadFormat: The file format extension of the payload layer (default: "usda")
+                fileFormatArgs: Additional file format-specific arguments to be supplied during creation of the payload stage.
+
+            Returns:
+                True if all of the streams were authored and saved, and the Asset Interface was added successfully, false otherwise.
+
         )"
     );
 
@@ -151,6 +386,18 @@ void bindAssetStructure(module& m)
         )"
     );
 
+    m.def(
+        "getLodToken",
+        &getLodToken,
+        R"(
+            Get the token for the LOD variant set.
+
+            Returns:
+                The token for the LOD variant set.
+
+        )"
+    );
+
     m.def(
         "getMaterialsToken",
         &getMaterialsToken,
@@ -225,7 +472,8 @@ void bindAssetStructure(module& m)
             Returns:
                 The newly created reference prim. Returns an invalid prim on error.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -247,7 +495,35 @@ void bindAssetStructure(module& m)
             Returns:
                 The newly created reference prim. Returns an invalid prim on error.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "defineReferences",
+        &defineReferences,
+        arg("stage"),
+        arg("paths"),
+        arg("sources"),
+        R"(
+            Define many references to prims with a single round of change processing
+
+            The result is identical to calling ``defineReference`` for each path. However, all layer identifiers are resolved within a single
+            ``Ar.ResolverScopedCache``, and the resolved identifiers, relative identifiers, and default prims are computed once per layer rather
+            than once per reference. All prims are then defined within a single ``Sdf.ChangeBlock``, and all references are added within another.
+
+            This is intended for authoring many references to the same library (e.g. instancing library parts into a layout).
+
+            Parameters:
+                - **stage** - The stage on which to define the references
+                - **paths** - The absolute prim paths at which to define the references
+                - **sources** - The prim to reference at each path. This must contain one prim per path.
+
+            Returns:
+                The newly created reference prim for each path, or an invalid prim on error. If the sizes do not match then no prims are defined.
+
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -276,7 +552,8 @@ void bindAssetStructure(module& m)
             Returns:
                 The newly created payload prim. Returns an invalid prim on error.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -298,7 +575,84 @@ void bindAssetStructure(module& m)
             Returns:
                 The newly created payload prim. Returns an invalid prim on error.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "definePayloads",
+        &definePayloads,
+        arg("stage"),
+        arg("paths"),
+        arg("sources"),
+        R"(
+            Define many payloads to prims with a single round of change processing
+
+            The result is identical to calling ``definePayload`` for each path. However, all layer identifiers are resolved within a single
+            ``Ar.ResolverScopedCache``, and the resolved identifiers, relative identifiers, and default prims are computed once per layer rather
+            than once per payload. All prims are then defined within a single ``Sdf.ChangeBlock``, and all payloads are added within another.
+
+            This is intended for authoring many payloads to the same library (e.g. instancing library parts into a layout).
+
+            Parameters:
+                - **stage** - The stage on which to define the payloads
+                - **paths** - The absolute prim paths at which to define the payloads
+                - **sources** - The prim to payload at each path. This must contain one prim per path.
+
+            Returns:
+                The newly created payload prim for each path, or an invalid prim on error. If the sizes do not match then no prims are defined.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<InstancingReport>(m, "InstancingReport", "The outcome of ``instanceRepeatedReferences``.")
+
+        .def_readonly(
+            "candidatePrims",
+            &InstancingReport::candidatePrims,
+            "The number of prims with references or payloads which could be instanced."
+        )
+
+        .def_readonly("instancedPrims", &InstancingReport::instancedPrims, "The number of prims which were marked instanceable.")
+
+        .def_readonly(
+            "prototypes",
+            &InstancingReport::prototypes,
+            "The number of distinct sources shared by the instanced prims, each of which becomes one USD prototype."
+        )
+
+        .def_readonly(
+            "instancingRatio",
+            &InstancingReport::instancingRatio,
+            "The average number of instanced prims per prototype, or zero if no prims were instanced."
+        );
+
+    m.def(
+        "instanceRepeatedReferences",
+        &instanceRepeatedReferences,
+        arg("stage"),
+        arg("minInstances") = 2,
+        R"(
+            Mark prims which reference or payload identical sources as instanceable, so they share USD native instancing prototypes
+
+            The stage is traversed for prims with references or payloads authored in the edit target layer. Prims are grouped by all of their
+            composition arcs in that layer (references, payloads, inherits, specializes, and variant selections, including asset paths, prim
+            paths, and layer offsets), and each group of at least ``minInstances`` prims is marked instanceable within a single ``Sdf.ChangeBlock``.
+
+            Opinions authored on the instanced prim itself (e.g. its transform) remain in effect. However, USD ignores opinions authored on the
+            descendants of an instance, so prims with descendant opinions in any layer of the local layer stack are not considered, nor are prims
+            which already have an authored ``instanceable`` value, or which are descendants of another candidate.
+
+            Parameters:
+                - **stage** - The stage to search for repeated references and payloads
+                - **minInstances** - The minimum number of prims which must share identical arcs before they are marked instanceable
+
+            Returns:
+                An ``InstancingReport`` describing the prims which were considered and instanced.
+
+        )",
+        call_guard<gil_scoped_release>()
     );
 }
 
@@ -0,0 +1,351 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/Authoring.h"
+
+#include "usdex/pybind/UsdBindings.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace usdex::core;
+using namespace pybind11;
+
+namespace usdex::core::bindings
+{
+
+void bindAuthoring(module& m)
+{
+    // The bindings for authorLayersConcurrently have been hand rolled in `python/bindings/_AuthoringBindings.py` due to issues with cleanly
+    // passing ownership of an SdfLayerRefPtr from C++ to Python using pybind11
+
+    pybind11::enum_<AuthoringBackend>(m, "AuthoringBackend", "Controls how the ``define`` functions author opinions on the stage.")
+        .value(
+            "eUsd",
+            AuthoringBackend::eUsd,
+            "Author all opinions via the ``Usd.Prim`` and ``Usd.Attribute`` API. Each edit is processed by the stage individually."
+        )
+        .value(
+            "eSdf",
+            AuthoringBackend::eSdf,
+            "Author prim specs directly on the edit target ``Sdf.Layer`` and batch the authoring of each prim within an ``Sdf.ChangeBlock``."
+        );
+
+    m.def(
+        "getAuthoringBackend",
+        &getAuthoringBackend,
+        R"(
+            Get the ``AuthoringBackend`` used by the ``define`` functions on the calling thread.
+
+            Returns:
+                The ``AuthoringBackend`` of the calling thread. Defaults to ``AuthoringBackend.eUsd``.
+        )"
+    );
+
+    m.def(
+        "setAuthoringBackend",
+        &setAuthoringBackend,
+        arg("value"),
+        R"(
+            Set the ``AuthoringBackend`` used by the ``define`` functions on the calling thread.
+
+            By default, the ``define`` functions (e.g. ``defineXform``, ``defineScope``, ``definePolyMesh``, ``definePreviewMaterial``) author all
+            opinions via the ``Usd.Prim`` and ``Usd.Attribute`` API. Each individual edit is processed by the ``Usd.Stage`` before the next edit can
+            be made.
+
+            Exporters which write large fresh layers from scratch can instead select the ``AuthoringBackend.eSdf`` backend. The prim specs are then
+            authored directly on the ``Sdf.Layer`` of the current ``Usd.EditTarget``, and the attributes of each prim are authored within an
+            ``Sdf.ChangeBlock``, so the stage processes a single round of changes per prim definition. The authored opinions and the validation of
+            all arguments are identical regardless of the backend.
+
+            Prefer ``ScopedAuthoringBackend`` to ensure the previous backend is restored.
+
+            Warning:
+                The ``define`` functions must not be called while an ``Sdf.ChangeBlock`` is open, regardless of the backend, as the stage can not
+                recompose the newly defined prims until the change block is closed.
+
+            Args:
+                value: The ``AuthoringBackend`` for subsequent calls on the calling thread.
+        )"
+    );
+
+    pybind11::enum_<ValidationPolicy>(m, "ValidationPolicy", "Controls how thoroughly the geometry ``define`` functions validate their arguments.")
+        .value("eFull", ValidationPolicy::eFull, "Validate the contents of every array.")
+        .value(
+            "eDebug",
+            ValidationPolicy::eDebug,
+            "Validate the contents of every array in debug builds of the library, and trust them in release builds."
+        )
+        .value("eTrusted", ValidationPolicy::eTrusted, "Trust the contents of the arrays, and only perform the cheap structural checks.");
+
+    m.def(
+        "getValidationPolicy",
+        &getValidationPolicy,
+        R"(
+            Get the ``ValidationPolicy`` used by the ``define`` functions on the calling thread.
+
+            Returns:
+                The ``ValidationPolicy`` of the calling thread. Defaults to ``ValidationPolicy.eFull``.
+        )"
+    );
+
+    m.def(
+        "setValidationPolicy",
+        &setValidationPolicy,
+        arg("value"),
+        R"(
+            Set the ``ValidationPolicy`` used by the ``define`` functions on the calling thread.
+
+            By default, the ``define`` functions of meshes, points, and curves validate the contents of every array before authoring any opinion
+            (e.g. that every face vertex index refers to a point, that every primvar index refers to a value, and that the curve vertex counts form
+            valid curves from the points). These checks are linear in the size of the arrays, and are a significant part of the cost of authoring
+            large geometry.
+
+            Pipelines which have already validated their data upstream can select ``ValidationPolicy.eTrusted`` to skip these checks. The cheap
+            structural checks, such as the array sizes required by the interpolation of each primvar, the locations of the prims, and the
+            compatibility of the curve type, basis and wrap, are always performed regardless of the policy.
+
+            Prefer ``ScopedValidationPolicy`` to ensure the previous policy is restored.
+
+            Warning:
+                Invalid data will be authored as provided when its contents are not validated, producing invalid geometry on the stage.
+
+            Args:
+                value: The ``ValidationPolicy`` for subsequent calls on the calling thread.
+        )"
+    );
+
+    ::class_<AuthoringSession>(
+        m,
+        "AuthoringSession",
+        R"(
+            State shared by many authoring calls on a single stage, for the lifetime of the session.
+
+            While the session is active, the edit target of the stage is set to the session edit target and the ``AuthoringBackend.eSdf``
+            backend is selected on the calling thread. The previous edit target and backend are restored when the session ends.
+
+            The session also holds state which would otherwise be re-derived by every call: a ``NameCache``, the stage metrics as authored by
+            ``configureStage``, and the editability of each existing parent prim. The prim location validation of the ``define`` functions on
+            the calling thread uses this cache, so that a prim is only looked up when its parent is an instance or instance proxy.
+
+            The session is most conveniently used as a context manager, which ends the session on exit.
+
+            Example:
+
+                .. code-block:: python
+
+                    with usdex.core.AuthoringSession(stage) as session:
+                        for name in names:
+                            childName, reason = session.getEditableChildName(parent, name)
+                            usdex.core.defineXform(parent, childName)
+
+            Warning:
+                The session does not defer change processing until it ends. Each ``define`` function call is still processed by the stage as a
+                single round of changes, as the stage must recompose the newly defined prim before it is returned. For the same reason, the
+                ``define`` functions must not be called while an ``Sdf.ChangeBlock`` is open.
+
+            Note:
+                The session must end on the thread on which it began, and sessions on the same thread must end in the reverse order that they
+                began. The cached values are not invalidated if the stage metrics or the instancing of the parent prims are changed while the
+                session is active.
+        )"
+    )
+
+        .def(::init<UsdStagePtr>(), arg("stage"))
+
+        .def(::init<UsdStagePtr, const UsdEditTarget&>(), arg("stage"), arg("editTarget"))
+
+        .def(
+            "__enter__",
+            [](AuthoringSession& self) -> AuthoringSession&
+            {
+                return self;
+            },
+            return_value_policy::reference
+        )
+
+        .def(
+            "__exit__",
+            [](AuthoringSession& self, const object&, const object&, const object&)
+            {
+                self.end();
+                return false;
+            }
+        )
+
+        .def("end", &AuthoringSession::end, "End the session, restoring the previous edit target and ``AuthoringBackend``.")
+
+        .def("isActive", &AuthoringSession::isActive, "Get whether the session is active.")
+
+        .def("getStage", &AuthoringSession::getStage, "Get the stage of the session.")
+
+        .def(
+            "getNameCache",
+            &AuthoringSession::getNameCache,
+            return_value_policy::reference_internal,
+            "Get the ``NameCache`` shared by all calls made within the session."
+        )
+
+        .def("getUpAxis", &AuthoringSession::getUpAxis, "Get the up axis of the stage when the session began.")
+
+        .def("getLinearUnits", &AuthoringSession::getLinearUnits, "Get the meters per unit of the stage when the session began.")
+
+        .def("getMassUnits", &AuthoringSession::getMassUnits, "Get the kilograms per unit of the stage when the session began.")
+
+        .def(
+            "isEditablePrimLocation",
+            [](AuthoringSession& self, const SdfPath& path)
+            {
+                std::string reason;
+                bool result = self.isEditablePrimLocation(path, &reason);
+                return pybind11::make_tuple(result, reason);
+            },
+            arg("path"),
+            R"(
+                Validate that prim opinions could be authored at this path on the stage of the session.
+
+                This calls ``usdex.core.isEditablePrimLocation``, which uses the cached editability of the parent of the path when called on the
+                thread of the active session.
+
+                Parameters:
+                    - **path** - The absolute path to consider.
+
+                Returns:
+                    Tuple[bool, str] with a bool indicating if the location is valid, and the string is a non-empty reason if the location is invalid.
+            )"
+        )
+
+        .def(
+            "getEditableChildName",
+            [](AuthoringSession& self, const UsdPrim& parent, const std::string& name)
+            {
+                std::string reason;
+                TfToken result = self.getEditableChildName(parent, name, &reason);
+                return pybind11::make_tuple(result, reason);
+            },
+            arg("parent"),
+            arg("name"),
+            R"(
+                Make a name valid and unique for use as the name of a child of the given prim, and validate that prim opinions could be authored
+                there.
+
+                Parameters:
+                    - **parent** - The UsdPrim which would be the parent of the proposed location.
+                    - **name** - Preferred name.
+
+                Returns:
+                    Tuple[str, str] with a valid and unique name, or an empty string if the location is invalid, and a non-empty reason if the
+                    location is invalid.
+            )"
+        );
+
+    ::class_<ValueClipOptions>(m, "ValueClipOptions", "The options controlling the clip layers authored by a ``ValueClipSession``.")
+
+        .def(
+            ::init(
+                [](double framesPerClip, const std::string& format, const std::string& clipSet)
+                {
+                    return ValueClipOptions{ framesPerClip, format, clipSet };
+                }
+            ),
+            arg("framesPerClip") = 100.0,
+            arg("format") = "usdc",
+            arg("clipSet") = "default",
+            R"(
+                Describe the clip layers of a ``ValueClipSession``.
+
+                Args:
+                    framesPerClip: The number of time codes held by each clip layer, in the time of the edit target layer. Must be positive.
+                    format: The file format extension of the clip layers and the manifest.
+                    clipSet: The name of the clip set to author on the clip prim.
+            )"
+        )
+
+        .def_readwrite("framesPerClip", &ValueClipOptions::framesPerClip, "The number of time codes held by each clip layer.")
+
+        .def_readwrite("format", &ValueClipOptions::format, "The file format extension of the clip layers and the manifest.")
+
+        .def_readwrite("clipSet", &ValueClipOptions::clipSet, "The name of the clip set to author on the clip prim.");
+
+    ::class_<ValueClipSession>(
+        m,
+        "ValueClipSession",
+        R"(
+            Author the time samples of a prim and its descendants to a sequence of value clip layers, for the lifetime of the session.
+
+            While the session is active, the time samples authored on the calling thread by ``defineDeformingPolyMesh``, the time-sampled
+            ``setLocalTransform`` overloads, and ``defineAnimatedCamera`` for any attribute of the clip prim or its descendants are written to clip
+            layers instead of the edit target layer. Each clip layer holds ``ValueClipOptions.framesPerClip`` time codes, and the clips touched by
+            each call are written concurrently.
+
+            When the session ends the clip layers are exported concurrently, a manifest of the clip attributes is exported, and the ``clips``
+            metadata is authored on the clip prim in the edit target layer. The clips are exported to a directory named after the clips, alongside
+            the edit target layer (e.g. ``./Simulation/Simulation.0000.usdc``), with the manifest at ``./Simulation/Simulation.manifest.usdc``.
+
+            The session is most conveniently used as a context manager, which ends the session on exit.
+
+            Example:
+
+                .. code-block:: python
+
+                    with usdex.core.ValueClipSession(stage.GetDefaultPrim(), "Simulation", usdex.core.ValueClipOptions(framesPerClip=24)):
+                        usdex.core.defineDeformingPolyMesh(stage, path, faceVertexCounts, faceVertexIndices, times, points)
+
+            Warning:
+                Any time samples of a clip attribute on the edit target layer are stronger than the clips, so they are removed when the samples
+                of the attribute are written to the clips.
+
+            Note:
+                The session must end on the thread on which it began. The clip layers are held in memory until the session ends.
+
+            Args:
+                prim: The prim on which to author the ``clips`` metadata. Its samples, and the samples of its descendants, are written to the clips.
+                name: The name of the clips, which is used for the directory and the file names of the clip layers. It must be a valid identifier.
+                options: The options controlling the clip layers.
+        )"
+    )
+
+        .def(::init<UsdPrim, const std::string&, const ValueClipOptions&>(), arg("prim"), arg("name"), arg("options") = ValueClipOptions())
+
+        .def(
+            "__enter__",
+            [](ValueClipSession& self) -> ValueClipSession&
+            {
+                return self;
+            },
+            return_value_policy::reference
+        )
+
+        .def(
+            "__exit__",
+            [](ValueClipSession& self, const object&, const object&, const object&)
+            {
+                self.end();
+                return false;
+            }
+        )
+
+        .def(
+            "end",
+            &ValueClipSession::end,
+            R"(
+                End the session, exporting the clip layers and the manifest, and authoring the ``clips`` metadata.
+
+                Returns:
+                    True if all of the clips were exported and the metadata was authored, or if the session had already ended.
+            )"
+        )
+
+        .def("isActive", &ValueClipSession::isActive, "Get whether the session is active.")
+
+        .def(
+            "getClipAssetPaths",
+            &ValueClipSession::getClipAssetPaths,
+            "Get the asset paths of the clip layers written so far, relative to the edit target layer, in the order of their time codes."
+        );
+}
+
+} // namespace usdex::core::bindings
@@ -9,6 +9,7 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -41,7 +42,8 @@ void bindCameraAlgo(module& m)
             Returns:
                 A ``UsdGeom.Camera`` schema wrapping the defined ``Usd.Prim``.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -63,7 +65,8 @@ void bindCameraAlgo(module& m)
             Returns:
                 A ``UsdGeom.Camera`` schema wrapping the defined ``Usd.Prim``.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -83,7 +86,45 @@ void bindCameraAlgo(module& m)
             Returns:
                 A ``UsdGeom.Camera`` schema wrapping the converted ``Usd.Prim``.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "defineAnimatedCamera",
+        &defineAnimatedCamera,
+        arg("stage"),
+        arg("path"),
+        arg("times"),
+        arg("cameras"),
+        R"(
+            Defines a 3d camera on the stage which is animated by a sequence of ``Gf.Camera`` values.
+
+            This is intended for virtual production and other animated cameras, where the transform, focal length, or focus distance change on
+            every frame. It is considerably faster than calling ``defineCamera`` and then ``UsdGeom.Camera.SetFromCamera`` for each frame:
+
+                - The location is validated once, rather than once per frame.
+                - The attribute values of every frame are derived from the ``Gf.Camera`` values concurrently, and the parent transform is only
+                  computed once unless an ancestor of the camera is itself animated.
+                - All of the time samples are authored within a single ``Sdf.ChangeBlock``, so change notification is only sent once.
+
+            Attributes whose value is the same on every frame (e.g. the apertures of a prime lens) are authored as a single default value rather
+            than as time samples. All other attributes are authored with one time sample per frame. The resulting camera is otherwise identical
+            to calling ``UsdGeom.Camera.SetFromCamera`` at each time.
+
+            An invalid UsdGeomCamera will be returned if the frames are not valid, or if the camera attributes could not be authored successfully.
+
+            Parameters:
+                - **stage** - The stage on which to define the camera
+                - **path** - The absolute prim path at which to define the camera
+                - **times** - The time code of each frame. Default time codes are not valid.
+                - **cameras** - The camera data of each frame, including the world space transform matrix. This must contain one value per time.
+
+            Returns:
+                A ``UsdGeom.Camera`` schema wrapping the defined ``Usd.Prim``.
+
+        )",
+        call_guard<gil_scoped_release>()
     );
 }
 
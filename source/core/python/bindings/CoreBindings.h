@@ -37,6 +37,38 @@ void bindCore(module& m)
                 A human-readable build version string for the usdex modules.
         )"
     );
+
+    m.def(
+        "initialize",
+        &initialize,
+        arg("wait") = true,
+        call_guard<gil_scoped_release>(),
+        R"(
+            Initialize the OpenUSD plugins, registries, and token tables used by ``usdex.core``.
+
+            OpenUSD discovers plugins, loads the schema registry, and populates static token tables lazily, so the first calls to ``usdex.core``
+            functions are considerably slower than subsequent ones. Short lived processes can call ``initialize`` as early as possible, optionally
+            in the background while they read their own inputs, so that this cost is not paid by the first authoring call.
+
+            The independent parts of the initialization run in parallel. It is not necessary to call this function, nor to wait for it to complete.
+            Any function may be called while the initialization is in progress. Calling ``initialize`` again is cheap, and waits for the existing
+            initialization if requested.
+
+            Args:
+                wait: Whether to block until the initialization is complete. If false, the initialization continues on a background thread.
+        )"
+    );
+
+    m.def(
+        "isInitialized",
+        &isInitialized,
+        R"(
+            Determine whether a call to ``initialize`` has completed.
+
+            Returns:
+                True if the initialization is complete, false if it is in progress or has not been started.
+        )"
+    );
 }
 
 } // namespace usdex::core::bindings
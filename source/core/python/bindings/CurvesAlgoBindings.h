@@ -81,7 +81,8 @@ void bindCurvesAlgo(module& m)
 
             Returns
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -124,7 +125,8 @@ void bindCurvesAlgo(module& m)
 
             Returns
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -165,7 +167,8 @@ void bindCurvesAlgo(module& m)
 
             Returns
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -235,7 +238,8 @@ void bindCurvesAlgo(module& m)
 
             Returns
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -282,7 +286,8 @@ void bindCurvesAlgo(module& m)
 
             Returns
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -327,7 +332,8 @@ void bindCurvesAlgo(module& m)
 
             Returns
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 }
 
@@ -9,6 +9,7 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -16,8 +17,54 @@ using namespace pybind11;
 namespace usdex::core::bindings
 {
 
+namespace
+{
+
+// A copy of a DiagnosticRecord, so that Python callbacks may retain it beyond the lifetime of the diagnostic
+struct PyDiagnosticRecord
+{
+    explicit PyDiagnosticRecord(const DiagnosticRecord& record)
+        : code(record.code),
+          diagnosticCode(record.diagnosticCode),
+          function(record.function),
+          file(record.file),
+          line(record.line),
+          commentary(record.commentary)
+    {
+    }
+
+    DiagnosticRecord view() const
+    {
+        DiagnosticRecord record;
+        record.code = code;
+        record.diagnosticCode = diagnosticCode;
+        record.function = function;
+        record.file = file;
+        record.line = line;
+        record.commentary = commentary;
+        return record;
+    }
+
+    pxr::TfDiagnosticType code;
+    pxr::TfEnum diagnosticCode;
+    std::string function;
+    std::string file;
+    size_t line;
+    std::string commentary;
+};
+
+} // namespace
+
 void bindDiagnostics(module& m)
 {
+    // Python callbacks must be released before the interpreter is finalized
+    module::import("atexit").attr("register")(cpp_function(
+        []()
+        {
+            setDiagnosticsCallback(DiagnosticsCallbackFn());
+        }
+    ));
+
     pybind11::enum_<DiagnosticsLevel>(m, "DiagnosticsLevel", "Controls the diagnostics that will be emitted when the ``Delegate`` is active.")
         .value("eFatal", DiagnosticsLevel::eFatal, "Only ``Tf.Fatal`` are emitted.")
         .value("eError", DiagnosticsLevel::eError, "Emit ``Tf.Error`` and ``Tf.Fatal``, but suppress ``Tf.Warn`` and ``Tf.Status`` diagnostics.")
@@ -29,6 +76,102 @@ void bindDiagnostics(module& m)
         .value("eStdout", DiagnosticsOutputStream::eStdout, "All diagnostics print to the ``stdout`` stream.")
         .value("eStderr", DiagnosticsOutputStream::eStderr, "All diagnostics print to the ``stderr`` stream.");
 
+    pybind11::class_<DiagnosticsLimits>(
+        m,
+        "DiagnosticsLimits",
+        R"(
+            Limits on the number of diagnostics which are written by the ``Delegate``.
+
+            A systematic data problem can cause the same diagnostic to be emitted many thousands of times, in which case formatting and writing
+            them can cost more than the work which raised them. Diagnostics which exceed these limits are counted but not written, and a summary
+            of the suppressed counts is written by ``flushDiagnostics()`` and ``deactivateDiagnosticsDelegate()``.
+
+            Fatal diagnostics are never suppressed.
+        )"
+    )
+        .def(
+            pybind11::init(
+                [](size_t repeatsPerSite, double ratePerSecond, size_t burst)
+                {
+                    DiagnosticsLimits limits;
+                    limits.repeatsPerSite = repeatsPerSite;
+                    limits.ratePerSecond = ratePerSecond;
+                    limits.burst = burst;
+                    return limits;
+                }
+            ),
+            arg("repeatsPerSite") = 0,
+            arg("ratePerSecond") = 0.0,
+            arg("burst") = 100
+        )
+        .def_readwrite(
+            "repeatsPerSite",
+            &DiagnosticsLimits::repeatsPerSite,
+            "The number of diagnostics written from each call site before further repeats from the site are suppressed. "
+            "The count restarts after each summary. Zero disables deduplication."
+        )
+        .def_readwrite(
+            "ratePerSecond",
+            &DiagnosticsLimits::ratePerSecond,
+            "The sustained number of diagnostics per second which may be written across all call sites. Zero disables rate limiting."
+        )
+        .def_readwrite(
+            "burst",
+            &DiagnosticsLimits::burst,
+            "The number of diagnostics which may be written in a burst before the rate limit applies."
+        );
+
+    pybind11::class_<DiagnosticsSourceCount>(
+        m,
+        "DiagnosticsSourceCount",
+        "The number of diagnostics of a single ``Tf.DiagnosticType`` which were reported by a single source function."
+    )
+        .def_readonly(
+            "function",
+            &DiagnosticsSourceCount::function,
+            "The function which reported the diagnostics, or an empty string if the call context was hidden."
+        )
+        .def_readonly("code", &DiagnosticsSourceCount::code, "The type of the diagnostics.")
+        .def_readonly("count", &DiagnosticsSourceCount::count, "The number of diagnostics reported.")
+        .def_readonly(
+            "messages",
+            &DiagnosticsSourceCount::messages,
+            "The commentary of the first diagnostics reported, up to the capture limit."
+        );
+
+    pybind11::class_<PyDiagnosticRecord>(m, "DiagnosticRecord", "The fields of a single diagnostic, as passed to a diagnostics callback.")
+        .def_readonly(
+            "code",
+            &PyDiagnosticRecord::code,
+            "The type of the diagnostic. Errors which were reported with an application specific error code are "
+            "``Tf.TF_DIAGNOSTIC_NONFATAL_ERROR_TYPE``."
+        )
+        .def_readonly(
+            "function",
+            &PyDiagnosticRecord::function,
+            "The function which reported the diagnostic, or an empty string if the call context was hidden."
+        )
+        .def_readonly(
+            "file",
+            &PyDiagnosticRecord::file,
+            "The source file which reported the diagnostic, or an empty string if the call context was hidden."
+        )
+        .def_readonly("line", &PyDiagnosticRecord::line, "The source line which reported the diagnostic, or zero if the call context was hidden.")
+        .def_readonly("commentary", &PyDiagnosticRecord::commentary, "The message of the diagnostic.")
+        .def(
+            "format",
+            [](const PyDiagnosticRecord& self)
+            {
+                return formatDiagnosticRecord(self.view());
+            },
+            R"(
+                Format the diagnostic as it would be written to the ``DiagnosticsOutputStream`` by the ``Delegate``.
+
+                Returns:
+                    The formatted message, without a trailing newline.
+            )"
+        );
+
     m.def(
         "isDiagnosticsDelegateActive",
         &isDiagnosticsDelegateActive,
@@ -103,6 +246,34 @@ void bindDiagnostics(module& m)
         )"
     );
 
+    m.def(
+        "getThreadDiagnosticsLevel",
+        &getThreadDiagnosticsLevel,
+        R"(
+            Get the ``DiagnosticsLevel`` override of the calling thread.
+
+            Returns:
+                The ``DiagnosticsLevel`` which applies to diagnostics emitted by the calling thread, or None if the thread uses the level set by
+                ``setDiagnosticsLevel()``.
+        )"
+    );
+
+    m.def(
+        "setThreadDiagnosticsLevel",
+        &setThreadDiagnosticsLevel,
+        arg("value"),
+        R"(
+            Override the ``DiagnosticsLevel`` for diagnostics emitted by the calling thread.
+
+            The override takes precedence over the level set by ``setDiagnosticsLevel()``, but does not affect any other thread.
+
+            Prefer a ``ScopedDiagnosticsLevel`` context to ensure the previous override is restored.
+
+            Args:
+                value: The ``DiagnosticsLevel`` for the calling thread, or None to remove the override.
+        )"
+    );
+
     m.def(
         "getDiagnosticLevel",
         &getDiagnosticLevel,
@@ -144,6 +315,217 @@ void bindDiagnostics(module& m)
                 The current ``DiagnosticsOutputStream`` for the ``Delegate``.
         )"
     );
+
+    m.def(
+        "setDiagnosticsOutputAsync",
+        &setDiagnosticsOutputAsync,
+        arg("value"),
+        R"(
+            Enable or disable asynchronous output of diagnostics by the ``Delegate``.
+
+            By default the ``Delegate`` writes each diagnostic to the ``DiagnosticsOutputStream`` on the thread which emitted it. When many threads
+            emit diagnostics concurrently (e.g. during parallel authoring), they all serialize on the lock of the output stream.
+
+            When asynchronous output is enabled, each diagnostic is formatted on the emitting thread and appended to a lock-free queue, which is
+            drained by a dedicated writer thread. Threads emitting diagnostics never wait on console I/O. The messages are written in the order in
+            which they were queued. The queue is flushed when the ``Delegate`` is deactivated, when asynchronous output is disabled, before a fatal
+            error terminates the process, and at exit.
+
+            This can be called at any time, but will only take affect after calling ``activateDiagnosticsDelegate()``.
+
+            Args:
+                value: Whether diagnostics should be written asynchronously.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "isDiagnosticsOutputAsync",
+        &isDiagnosticsOutputAsync,
+        R"(
+            Get whether the ``Delegate`` writes diagnostics asynchronously.
+
+            Returns:
+                Whether diagnostics are written asynchronously.
+        )"
+    );
+
+    m.def(
+        "setDiagnosticsLimits",
+        &setDiagnosticsLimits,
+        arg("value"),
+        R"(
+            Set the ``DiagnosticsLimits`` for the ``Delegate`` to suppress repeated diagnostics.
+
+            This can be called at any time, but will only take affect after calling ``activateDiagnosticsDelegate()``.
+
+            Args:
+                value: The limits on the diagnostics that should be emitted.
+        )"
+    );
+
+    m.def(
+        "getDiagnosticsLimits",
+        &getDiagnosticsLimits,
+        R"(
+            Get the current ``DiagnosticsLimits`` for the ``Delegate``.
+
+            Returns:
+                The current ``DiagnosticsLimits`` for the ``Delegate``.
+        )"
+    );
+
+    m.def(
+        "setDiagnosticsCallback",
+        [](const object& callback)
+        {
+            if (callback.is_none())
+            {
+                setDiagnosticsCallback(DiagnosticsCallbackFn());
+                return;
+            }
+
+            // The callable is released with the GIL held, as the last reference may be dropped by any thread emitting diagnostics
+            std::shared_ptr<object> holder(
+                new object(callback),
+                [](object* value)
+                {
+                    gil_scoped_acquire gil;
+                    delete value;
+                }
+            );
+            setDiagnosticsCallback(
+                [holder](const DiagnosticRecord& record)
+                {
+                    gil_scoped_acquire gil;
+                    try
+                    {
+                        (*holder)(PyDiagnosticRecord(record));
+                    }
+                    catch (error_already_set& e)
+                    {
+                        // Raising would propagate into the code which emitted the diagnostic
+                        e.discard_as_unraisable("usdex.core diagnostics callback");
+                    }
+                }
+            );
+        },
+        arg("callback"),
+        R"(
+            Set a callback to receive each diagnostic written by the ``Delegate`` as a structured ``DiagnosticRecord``.
+
+            The callback receives the diagnostics which pass the ``DiagnosticsLevel`` and the ``DiagnosticsLimits``, including fatal diagnostics,
+            before the process is terminated. It is independent of the ``DiagnosticsOutputStream``, so an output stream of
+            ``DiagnosticsOutputStream.eNone`` can be used to route diagnostics exclusively to the callback.
+
+            The callback is invoked on the thread which emitted the diagnostic, with the GIL held. Exceptions raised by the callback are reported
+            as unraisable and do not propagate. The callback must not emit diagnostics itself.
+
+            This can be called at any time, but will only take affect after calling ``activateDiagnosticsDelegate()``.
+
+            Args:
+                callback: A callable accepting a ``DiagnosticRecord``, or None to remove the current callback.
+        )"
+    );
+
+    m.def(
+        "setDiagnosticsCountingEnabled",
+        &setDiagnosticsCountingEnabled,
+        arg("value"),
+        R"(
+            Enable or disable counting of the diagnostics received by the ``Delegate``.
+
+            Diagnostics are counted regardless of the ``DiagnosticsLevel``, ``DiagnosticsOutputStream``, and ``DiagnosticsLimits``, so an output
+            stream of ``DiagnosticsOutputStream.eNone`` can be used to count diagnostics without writing them. Counting does not format any
+            messages, and the commentary is only copied for the first occurrences from each source function, up to the capture limit.
+
+            Fatal diagnostics are not counted, nor are errors which are captured and cleared by a ``Tf.ErrorMark``.
+
+            Counting is disabled by default. This can be called at any time, but will only take affect after calling
+            ``activateDiagnosticsDelegate()``. Disabling counting does not reset the counts accumulated so far.
+
+            Args:
+                value: Whether diagnostics should be counted.
+        )"
+    );
+
+    m.def(
+        "isDiagnosticsCountingEnabled",
+        &isDiagnosticsCountingEnabled,
+        R"(
+            Get whether the ``Delegate`` counts diagnostics.
+
+            Returns:
+                Whether diagnostics are counted.
+        )"
+    );
+
+    m.def(
+        "setDiagnosticsCaptureLimit",
+        &setDiagnosticsCaptureLimit,
+        arg("value"),
+        R"(
+            Set the maximum number of messages captured for each ``DiagnosticsSourceCount``.
+
+            Args:
+                value: The number of messages to capture from each source function and ``Tf.DiagnosticType``. Zero disables message capture.
+        )"
+    );
+
+    m.def(
+        "getDiagnosticsCaptureLimit",
+        &getDiagnosticsCaptureLimit,
+        R"(
+            Get the maximum number of messages captured for each ``DiagnosticsSourceCount``.
+
+            Returns:
+                The number of messages captured from each source function and ``Tf.DiagnosticType``. Defaults to one.
+        )"
+    );
+
+    m.def(
+        "getDiagnosticsCounts",
+        &getDiagnosticsCounts,
+        R"(
+            Get the number of diagnostics of each ``Tf.DiagnosticType`` counted since the last call to ``resetDiagnosticsCounts()``.
+
+            Errors which were reported with an application specific error code are counted as ``Tf.TF_DIAGNOSTIC_NONFATAL_ERROR_TYPE``.
+
+            Returns:
+                A dict of each ``Tf.DiagnosticType`` which has been counted to the number of diagnostics.
+        )"
+    );
+
+    m.def(
+        "getDiagnosticsSourceCounts",
+        &getDiagnosticsSourceCounts,
+        R"(
+            Get the number of diagnostics reported by each source function since the last call to ``resetDiagnosticsCounts()``.
+
+            Returns:
+                A list of ``DiagnosticsSourceCount`` for each source function and ``Tf.DiagnosticType``, sorted by function and then by type.
+        )"
+    );
+
+    m.def(
+        "resetDiagnosticsCounts",
+        &resetDiagnosticsCounts,
+        R"(
+            Reset all diagnostics counts to zero and discard the captured messages.
+        )"
+    );
+
+    m.def(
+        "flushDiagnostics",
+        &flushDiagnostics,
+        R"(
+            Write a summary of any diagnostics suppressed by the ``DiagnosticsLimits``, and block until all diagnostics which have been queued for
+            asynchronous output have been written.
+
+            This is useful prior to writing directly to ``stdout`` or ``stderr``, so that the output is not interleaved with pending diagnostics.
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 
 } // namespace usdex::core::bindings
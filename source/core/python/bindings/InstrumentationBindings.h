@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/Instrumentation.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace usdex::core;
+using namespace pybind11;
+
+namespace usdex::core::bindings
+{
+
+void bindInstrumentation(module& m)
+{
+    ::class_<AuthoringMetrics>(m, "AuthoringMetrics", "The accumulated cost of all instrumented calls to a single entry point.")
+
+        .def_readonly("calls", &AuthoringMetrics::calls, "The number of calls to the entry point.")
+
+        .def_readonly("seconds", &AuthoringMetrics::seconds, "The accumulated wall time of all calls, in seconds.")
+
+        .def_readonly(
+            "elements",
+            &AuthoringMetrics::elements,
+            "The number of elements processed by all calls (e.g. points, prims, names, or time samples)."
+        )
+
+        .def_readonly("bytes", &AuthoringMetrics::bytes, "The number of bytes of array data authored by all calls.");
+
+    m.def(
+        "setInstrumentationEnabled",
+        &setInstrumentationEnabled,
+        arg("value"),
+        R"(
+            Enable or disable the accumulation of ``AuthoringMetrics`` for subsequent calls on all threads.
+
+            Disabling instrumentation does not reset the metrics accumulated so far.
+
+            Args:
+                value: Whether to accumulate metrics.
+        )"
+    );
+
+    m.def(
+        "isInstrumentationEnabled",
+        &isInstrumentationEnabled,
+        R"(
+            Get whether ``AuthoringMetrics`` are being accumulated.
+
+            Returns:
+                True if instrumentation is enabled. Always False if ``usdex_core`` was built with ``USDEX_DISABLE_INSTRUMENTATION`` defined.
+        )"
+    );
+
+    m.def(
+        "getAuthoringMetrics",
+        &getAuthoringMetrics,
+        R"(
+            Get the metrics accumulated for each entry point since the last call to ``resetAuthoringMetrics``.
+
+            Only the outermost instrumented call on each thread is measured, so an entry point which calls other entry points is reported once,
+            including the cost of the nested calls.
+
+            Entry points which have not been called while instrumentation was enabled are omitted. All overloads of a function share one entry.
+
+            Returns:
+                A dict of entry point names to their accumulated ``AuthoringMetrics``.
+        )"
+    );
+
+    m.def(
+        "resetAuthoringMetrics",
+        &resetAuthoringMetrics,
+        R"(
+            Reset the accumulated metrics of all entry points to zero.
+
+            Calls which are in progress while the metrics are reset may be partially accumulated.
+        )"
+    );
+}
+
+} // namespace usdex::core::bindings
@@ -11,6 +11,8 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <vector>
+
 using namespace usdex::core;
 using namespace pybind11;
 
@@ -123,12 +125,18 @@ void bindLayerAlgo(module& m)
 
              Returns:
                 A bool indicating if the save was successful.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "exportLayer",
-        &exportLayer,
+        overload_cast<
+            SdfLayerHandle,
+            const std::string&,
+            const std::string&,
+            std::optional<std::string_view>,
+            const SdfLayer::FileFormatArguments&>(&exportLayer),
         arg("layer"),
         arg("identifier"),
         arg("authoringMetadata"),
@@ -152,6 +160,129 @@ void bindLayerAlgo(module& m)
 
             Returns:
                 A bool indicating if the export was successful.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<ExportLayerProgress>(m, "ExportLayerProgress", "The progress of an ``exportLayer`` call which reports progress.")
+
+        .def_readonly(
+            "primSpecsWritten",
+            &ExportLayerProgress::primSpecsWritten,
+            "The number of prim specs written so far. Prim specs nested in variants are written with their owner."
+        )
+
+        .def_readonly("totalPrimSpecs", &ExportLayerProgress::totalPrimSpecs, "The number of prim specs to be written.")
+
+        .def_readonly(
+            "bytesWritten",
+            &ExportLayerProgress::bytesWritten,
+            "The size of the exported file. This is zero until the file has been written."
+        );
+
+    m.def(
+        "exportLayer",
+        [](SdfLayerHandle layer,
+           const std::string& identifier,
+           const std::string& authoringMetadata,
+           const function& progressFn,
+           std::optional<std::string_view> comment,
+           const SdfLayer::FileFormatArguments& fileFormatArgs)
+        {
+            // Only an explicit False cancels the export, so that callbacks which return nothing are valid
+            ExportLayerProgressFn callback = [&progressFn](const ExportLayerProgress& progress)
+            {
+                gil_scoped_acquire gil;
+                const object result = progressFn(progress);
+                return result.is_none() || result.cast<bool>();
+            };
+
+            // The GIL is only held while the callback runs
+            gil_scoped_release release;
+            return exportLayer(layer, identifier, authoringMetadata, callback, comment, fileFormatArgs);
+        },
+        arg("layer"),
+        arg("identifier"),
+        arg("authoringMetadata"),
+        arg("progressFn"),
+        arg("comment") = nullptr,
+        arg("fileFormatArgs") = pxr::SdfLayer::FileFormatArguments(),
+        R"(
+            Export the given ``Sdf.Layer`` to an identifier with an optional comment, reporting progress and allowing cancellation.
+
+            Unlike the overload above, the source layer is never modified. The specs are copied one prim at a time into an in-memory output
+            layer, the authoring metadata and comment are authored on the output layer, and the output layer is then written to the identifier.
+
+            The callback is invoked after each prim spec is copied, and once more after the file has been written. If it returns False before
+            the file is written then the export is cancelled, nothing is written to the identifier, and False is returned.
+
+            Args:
+                layer: The layer to be exported.
+                identifier: The identifier to be used for the new layer.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+                progressFn: A callable accepting an ``ExportLayerProgress``. It may return False to cancel the export, any other value continues.
+                comment: The comment will be authored in the exported layer as the ``Sdf.Layer`` comment.
+                fileFormatArgs: Additional file format-specific arguments to be supplied during layer export.
+
+            Returns:
+                A bool indicating if the export was successful. This is False if the export was cancelled.
+        )"
+    );
+    ::class_<LayerMergeConflict>(
+        m,
+        "LayerMergeConflict",
+        "An opinion which could not be merged by ``mergeLayers``, as the target layer already held a different opinion."
+    )
+
+        .def_readonly("path", &LayerMergeConflict::path, "The path of the spec holding the conflicting opinion.")
+
+        .def_readonly("field", &LayerMergeConflict::field, "The field of the conflicting opinion.")
+
+        .def_readonly(
+            "sourceIdentifier",
+            &LayerMergeConflict::sourceIdentifier,
+            "The identifier of the source layer whose opinion was discarded."
+        );
+
+    m.def(
+        "mergeLayers",
+        [](SdfLayerHandle target, const std::vector<SdfLayerHandle>& sources)
+        {
+            std::vector<LayerMergeConflict> conflicts;
+            bool result;
+            {
+                gil_scoped_release release;
+                result = mergeLayers(target, sources, &conflicts);
+            }
+            return pybind11::make_tuple(result, conflicts);
+        },
+        arg("target"),
+        arg("sources"),
+        R"(
+            Merge the opinions of several ``Sdf.Layer`` objects into a target ``Sdf.Layer``.
+
+            This is intended to combine layers which were authored independently (e.g. concurrently by ``authorLayersConcurrently``) into a single
+            layer, as an alternative to exporting each layer and adding it to the subLayers of the target.
+
+            The sources are merged in order. Specs which do not exist in the target are copied in full, including all of their descendant specs.
+            The fields of specs which already exist in the target are merged individually: a field which is not yet authored in the target is
+            copied, while a field whose value differs from the target value is a conflict. The target value is always retained, so earlier sources
+            are stronger than later sources, matching the order of subLayers. An ``over`` specifier never conflicts with the specifier of the
+            target.
+
+            A warning is emitted for each source with conflicting opinions.
+
+            Note:
+                The layer metadata of the sources is not merged. The source layers are not modified.
+
+            Args:
+                target: The layer to merge the opinions into.
+                sources: The layers to merge, strongest first.
+
+            Returns:
+                Tuple[bool, list[LayerMergeConflict]] with a bool indicating if all sources were merged without conflicts, and the conflicts in the
+                order they were found.
         )"
     );
 }
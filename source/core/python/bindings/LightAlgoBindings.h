@@ -149,7 +149,8 @@ void bindLightAlgo(module& m)
 
             Returns:
                 The light if created successfully.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -230,8 +231,94 @@ void bindLightAlgo(module& m)
 
             Returns:
                 The light if created successfully.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    pybind11::class_<LightDescription> lightDescription(
+        m,
+        "LightDescription",
+        R"(
+            Describes a single light to be defined by ``defineLights``.
+
+            The members correspond to the arguments of the ``define*Light`` functions and are subject to the same validation. Members which do
+            not apply to the ``type`` of light are ignored.
         )"
     );
+
+    pybind11::enum_<LightDescription::Type>(lightDescription, "Type", "The types of light which can be defined")
+        .value("Dome", LightDescription::Type::Dome, "A ``UsdLux.DomeLight``, as defined by ``defineDomeLight``")
+        .value("Rect", LightDescription::Type::Rect, "A ``UsdLux.RectLight``, as defined by ``defineRectLight``")
+        .value("Sphere", LightDescription::Type::Sphere, "A ``UsdLux.SphereLight``, which emits light outward from a sphere")
+        .value("Distant", LightDescription::Type::Distant, "A ``UsdLux.DistantLight``, which emits light from a distant source along the -Z axis");
+
+    lightDescription.def(pybind11::init<>())
+        .def(
+            pybind11::init(
+                [](LightDescription::Type type,
+                   const SdfPath& path,
+                   float intensity,
+                   float width,
+                   float height,
+                   float radius,
+                   float angle,
+                   std::optional<std::string> texturePath,
+                   const TfToken& textureFormat)
+                {
+                    return LightDescription{ type, path, intensity, width, height, radius, angle, texturePath, textureFormat };
+                }
+            ),
+            arg("type"),
+            arg("path"),
+            arg("intensity") = 1.0f,
+            arg("width") = 1.0f,
+            arg("height") = 1.0f,
+            arg("radius") = 0.5f,
+            arg("angle") = 0.53f,
+            arg("texturePath") = nullptr,
+            arg("textureFormat") = pxr::UsdLuxTokens->automatic.GetString()
+        )
+        .def_readwrite("type", &LightDescription::type, "The type of light to define")
+        .def_readwrite("path", &LightDescription::path, "The absolute prim path at which to define the light")
+        .def_readwrite("intensity", &LightDescription::intensity, "The intensity value of the light")
+        .def_readwrite("width", &LightDescription::width, "The width of a rect light, in the local X axis")
+        .def_readwrite("height", &LightDescription::height, "The height of a rect light, in the local Y axis")
+        .def_readwrite("radius", &LightDescription::radius, "The radius of a sphere light")
+        .def_readwrite("angle", &LightDescription::angle, "The angular diameter of a distant light, in degrees")
+        .def_readwrite("texturePath", &LightDescription::texturePath, "The path to the texture file to use on a dome or rect light")
+        .def_readwrite("textureFormat", &LightDescription::textureFormat, "How the texture should be mapped on a dome light");
+
+    m.def(
+        "defineLights",
+        &defineLights,
+        arg("stage"),
+        arg("lights"),
+        R"(
+            Defines many lights on the stage in a single call.
+
+            This produces the same scene description as calling the corresponding ``define*Light`` function for each element of ``lights``, but
+            the per-light overhead is amortized across the batch:
+
+                - The arguments of all lights are validated concurrently, prior to authoring any opinions.
+                - The light schemas are only resolved once, rather than once per light.
+                - All of the prims are defined within a single ``Sdf.ChangeBlock``, so the stage only recomposes once.
+                - All of the attributes are authored within a single ``Sdf.ChangeBlock``, so change notification is only sent once.
+
+            Sphere and distant lights are authored with the same light API attributes as the other lights (i.e. intensity and exposure), along
+            with their radius or angle. The extent of each rect and sphere light is authored, as for ``defineRectLight``.
+
+            Success or failure is reported per light. Any invalid light is not defined, a runtime error is emitted describing the reason, and an
+            invalid ``UsdLux.LightAPI`` is returned at the corresponding index. All other lights are still defined.
+
+            Args:
+                stage: The stage on which to define the lights
+                lights: The descriptions of the lights to define
+
+            Returns:
+                A ``UsdLux.LightAPI`` for each element of ``lights``, in the same order. Any light which could not be defined will be invalid.
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 
 } // namespace usdex::core::bindings
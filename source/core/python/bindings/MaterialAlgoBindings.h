@@ -61,6 +61,42 @@ void bindMaterialAlgo(module& m)
         )"
     );
 
+    m.def(
+        "bindMaterials",
+        &bindMaterials,
+        arg("prims"),
+        arg("materials"),
+        arg("hoistBindings") = false,
+        R"(
+            Authors a direct binding to the corresponding material on each of many prims (or ``UsdGeom.Subsets``).
+
+            This produces the same bindings as calling ``bindMaterial`` for each prim, but the ``UsdShade.MaterialBindingAPI`` and the binding
+            relationships of all prims are authored directly on the edit target layer within a single ``Sdf.ChangeBlock``, so the stage only
+            processes one change.
+
+            Optionally, identical bindings can be hoisted onto a common ancestor. When every child of a prim is bound to the same material, and
+            none of those children already has an authored binding of its own, the binding is authored once on the parent rather than on each
+            child. This is repeated up the hierarchy, so fewer binding opinions need to be resolved when the stage is loaded. ``UsdGeom.Subsets``
+            are never hoisted, and bindings are never hoisted onto a root prim, an instance proxy, or a ``UsdGeom.Gprim`` which was not itself
+            bound to the same material.
+
+            Any invalid prim or material is skipped with a warning, and all other prims are still bound. If a prim appears more than once, the
+            last material is bound.
+
+            Note:
+                The bindings have the same "all purpose" and "fallback strength" as ``bindMaterial``.
+
+            Args:
+                prims: The prims that the materials will affect. All of the prims must belong to the same stage.
+                materials: The material to bind to each prim. This must be the same length as ``prims``.
+                hoistBindings: Whether identical bindings of sibling prims should be hoisted onto their parent.
+
+            Returns:
+                Whether every prim was bound, either directly or through a hoisted binding.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
     m.def(
         "computeEffectivePreviewSurfaceShader",
         &computeEffectivePreviewSurfaceShader,
@@ -68,6 +104,11 @@ void bindMaterialAlgo(module& m)
         R"(
             Get the effective surface Shader of a Material for the universal render context.
 
+            Note:
+
+                The connections are traversed on every call. Use a ``SurfaceShaderCache`` when querying many Materials, or the same Material
+                repeatedly.
+
             Args:
                 material: The Material to consider
 
@@ -76,6 +117,97 @@ void bindMaterialAlgo(module& m)
         )"
     );
 
+    ::class_<SurfaceShaderCache>(
+        m,
+        "SurfaceShaderCache",
+        R"(
+            A thread-safe cache of the effective surface Shaders of the Materials of a stage for a single render context.
+
+            The effective surface Shader of each Material is resolved exactly as ``UsdShade.Material.ComputeSurfaceSource`` would, so a cache for
+            the universal render context matches ``computeEffectivePreviewSurfaceShader``, and a cache for the "mdl" render context matches
+            ``usdex.rtx.computeEffectiveMdlSurfaceShader``. The connections are only traversed the first time a Material is queried.
+
+            The cache listens for changes to the stage and discards the cached Shader of a Material when its surface outputs, or the outputs of
+            any NodeGraph or surface Shader within it, are changed, or when the Material or its surface Shader are resynced. Authoring other
+            Shaders within the Material (e.g. adding textures) does not affect the cache.
+        )"
+    )
+
+        .def(
+            ::init<UsdStagePtr, const TfToken&>(),
+            arg("stage"),
+            arg("renderContext") = UsdShadeTokens->universalRenderContext,
+            R"(
+                Construct a cache for the Materials of a stage.
+
+                Parameters:
+                    - **stage** - The stage whose Materials will be queried. Materials of other stages produce an invalid shader object.
+                    - **renderContext** - The render context of the surface outputs to resolve. The universal render context is used as a fallback.
+            )"
+        )
+
+        .def(
+            "getRenderContext",
+            &SurfaceShaderCache::getRenderContext,
+            R"(
+                Get the render context of the surface outputs being resolved.
+
+                Returns:
+                    The render context supplied on construction.
+            )"
+        )
+
+        .def(
+            "getSurfaceShader",
+            &SurfaceShaderCache::getSurfaceShader,
+            arg("material"),
+            R"(
+                Get the effective surface Shader of a Material.
+
+                Parameters:
+                    - **material** - The Material to consider
+
+                Returns:
+                    The connected Shader. Returns an invalid shader object if the Material is invalid, belongs to another stage, or has no surface.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+
+        .def(
+            "getSurfaceShaders",
+            &SurfaceShaderCache::getSurfaceShaders,
+            arg("materials"),
+            R"(
+                Get the effective surface Shaders of many Materials. The Materials are evaluated concurrently.
+
+                Parameters:
+                    - **materials** - The Materials to consider
+
+                Returns:
+                    The connected Shader of each Material, matching the order of the input Materials.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+
+        .def(
+            "clear",
+            &SurfaceShaderCache::clear,
+            R"(
+                Discard all cached Shaders.
+            )"
+        )
+
+        .def(
+            "size",
+            &SurfaceShaderCache::size,
+            R"(
+                Return the number of Materials for which Shaders are currently cached.
+
+                Returns:
+                    The number of cached Shaders.
+            )"
+        );
+
     m.def(
         "definePreviewMaterial",
         overload_cast<UsdStagePtr, const SdfPath&, const GfVec3f&, const float, const float, const float>(&definePreviewMaterial),
@@ -102,7 +234,8 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 The newly defined ``UsdShade.Material``. Returns an Invalid prim on error
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -129,7 +262,8 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 The newly defined ``UsdShade.Material``. Returns an Invalid prim on error
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -176,7 +310,8 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 Whether or not the texture was added to the material
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -206,7 +341,8 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 Whether or not the texture was added to the material
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -230,7 +366,8 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 Whether or not the texture was added to the material
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -251,7 +388,8 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 Whether or not the texture was added to the material
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -272,7 +410,8 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 Whether or not the texture was added to the material
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -293,9 +432,133 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 Whether or not the texture was added to the material
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
+    ::class_<PreviewMaterialDescription>(
+        m,
+        "PreviewMaterialDescription",
+        R"(
+            The parameters and textures of a preview material, as authored by ``definePreviewMaterial()`` and its associated ``add*Texture``
+            functions.
+
+            An empty texture path means that the corresponding texture is not added to the material.
+        )"
+    )
+        .def(init<>())
+        .def(
+            init(
+                [](const GfVec3f& color,
+                   float opacity,
+                   float roughness,
+                   float metallic,
+                   const SdfAssetPath& diffuseTexture,
+                   const SdfAssetPath& normalTexture,
+                   const SdfAssetPath& ormTexture,
+                   const SdfAssetPath& roughnessTexture,
+                   const SdfAssetPath& metallicTexture,
+                   const SdfAssetPath& opacityTexture)
+                {
+                    return PreviewMaterialDescription{
+                        color,         opacity,    roughness,        metallic,        diffuseTexture,
+                        normalTexture, ormTexture, roughnessTexture, metallicTexture, opacityTexture,
+                    };
+                }
+            ),
+            arg("color"),
+            arg("opacity") = 1.0f,
+            arg("roughness") = 0.5f,
+            arg("metallic") = 0.0f,
+            arg("diffuseTexture") = SdfAssetPath(),
+            arg("normalTexture") = SdfAssetPath(),
+            arg("ormTexture") = SdfAssetPath(),
+            arg("roughnessTexture") = SdfAssetPath(),
+            arg("metallicTexture") = SdfAssetPath(),
+            arg("opacityTexture") = SdfAssetPath()
+        )
+        .def_readwrite("color", &PreviewMaterialDescription::color, "The diffuse color of the Material")
+        .def_readwrite("opacity", &PreviewMaterialDescription::opacity, "The Opacity Amount, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible")
+        .def_readwrite("roughness", &PreviewMaterialDescription::roughness, "The Roughness Amount, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy")
+        .def_readwrite(
+            "metallic",
+            &PreviewMaterialDescription::metallic,
+            "The Metallic Amount, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic"
+        )
+        .def_readwrite("diffuseTexture", &PreviewMaterialDescription::diffuseTexture, "The texture added by ``addDiffuseTextureToPreviewMaterial()``")
+        .def_readwrite("normalTexture", &PreviewMaterialDescription::normalTexture, "The texture added by ``addNormalTextureToPreviewMaterial()``")
+        .def_readwrite("ormTexture", &PreviewMaterialDescription::ormTexture, "The texture added by ``addOrmTextureToPreviewMaterial()``")
+        .def_readwrite(
+            "roughnessTexture",
+            &PreviewMaterialDescription::roughnessTexture,
+            "The texture added by ``addRoughnessTextureToPreviewMaterial()``"
+        )
+        .def_readwrite(
+            "metallicTexture",
+            &PreviewMaterialDescription::metallicTexture,
+            "The texture added by ``addMetallicTextureToPreviewMaterial()``"
+        )
+        .def_readwrite(
+            "opacityTexture",
+            &PreviewMaterialDescription::opacityTexture,
+            "The texture added by ``addOpacityTextureToPreviewMaterial()``"
+        );
+
+    ::class_<PreviewMaterialRegistry>(
+        m,
+        "PreviewMaterialRegistry",
+        R"(
+            Deduplicates equivalent preview materials, so each unique material is defined once and shared by every source material that matches it.
+
+            Each material is hashed from its ``PreviewMaterialDescription``. The first time a description is seen, a preview material is defined
+            below the parent prim using ``definePreviewMaterial()`` and the ``add*Texture`` functions. Every later request for an equivalent
+            description returns that same material, regardless of the requested name, rather than authoring another shader network.
+
+            Note:
+                The registry is not thread safe. Materials are only considered equivalent if all of their values are exactly equal.
+
+            Each texture asset path is only resolved once by the registry. If ``shareTextureReaders`` is enabled, each unique texture file and
+            color space is authored once as a ``UsdUVTexture`` shader below an abstract "TextureReaders" class prim, and the texture reader of
+            each material internally references it. Only the fallback and texture coordinates remain specific to each material.
+
+            Args:
+                parent: Prim below which to define the Materials (e.g. the "Materials" scope of an asset)
+                shareTextureReaders: Whether the texture readers of all materials should reference a single shared reader for each texture
+        )"
+    )
+        .def(init<UsdPrim, bool>(), arg("parent"), arg("shareTextureReaders") = false)
+        .def(
+            "definePreviewMaterial",
+            &PreviewMaterialRegistry::definePreviewMaterial,
+            arg("name"),
+            arg("material"),
+            R"(
+                Get the material for a description, defining it below the parent prim if no equivalent material has been defined yet.
+
+                The name is only used when the material is first defined. It is made valid and unique among the materials of the registry, so
+                it does not need to be a valid identifier. Any material which fails to author all of its textures is removed and is not
+                registered.
+
+                Args:
+                    name: Name of the Material, if it is defined
+                    material: The ``PreviewMaterialDescription`` of the Material
+
+                Returns:
+                    The material for the description. Returns an invalid object on error.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "getUniqueMaterialCount",
+            &PreviewMaterialRegistry::getUniqueMaterialCount,
+            "Get the number of unique materials which have been defined by the registry."
+        )
+        .def(
+            "getUseCount",
+            &PreviewMaterialRegistry::getUseCount,
+            "Get the number of materials which have been requested from the registry, including those which were shared."
+        );
+
     m.def(
         "addPreviewMaterialInterface",
         &addPreviewMaterialInterface,
@@ -325,7 +588,8 @@ void bindMaterialAlgo(module& m)
 
             Returns:
                 Whether or not the Material inputs were added successfully
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -383,7 +647,7 @@ void bindMaterialAlgo(module& m)
 
     m.def(
         "sRgbToLinear",
-        &sRgbToLinear,
+        overload_cast<const GfVec3f&>(&sRgbToLinear),
         arg("color"),
         R"(
             Translate an sRGB color value to linear color space
@@ -409,7 +673,7 @@ void bindMaterialAlgo(module& m)
 
     m.def(
         "linearToSrgb",
-        &linearToSrgb,
+        overload_cast<const GfVec3f&>(&linearToSrgb),
         arg("color"),
         R"(
             Translate a linear color value to sRGB color space
@@ -432,6 +696,50 @@ void bindMaterialAlgo(module& m)
                 The translated color in sRGB color space
         )"
     );
+
+    m.def(
+        "sRgbToLinear",
+        overload_cast<const VtVec3fArray&>(&sRgbToLinear),
+        arg("colors"),
+        call_guard<gil_scoped_release>(),
+        R"(
+            Translate an array of sRGB color values to linear color space
+
+            This is intended for bulk color data, such as ``displayColor`` primvar values (e.g. the values of a ``Vec3fPrimvarData`` prior to
+            calling ``definePolyMesh`` or ``definePointCloud``), and is considerably faster than translating each color individually.
+
+            Channel values within [0, 1] are approximated by interpolating a lookup table, which differs from the result of translating a single
+            color by less than 1e-7. Channel values outside of [0, 1] are translated exactly. Large arrays are translated in parallel.
+
+            Args:
+                colors: sRGB representations of the colors to be translated to linear color space
+
+            Returns:
+                The translated colors in linear color space, in the same order as the input colors
+        )"
+    );
+
+    m.def(
+        "linearToSrgb",
+        overload_cast<const VtVec3fArray&>(&linearToSrgb),
+        arg("colors"),
+        call_guard<gil_scoped_release>(),
+        R"(
+            Translate an array of linear color values to sRGB color space
+
+            This is intended for bulk color data, such as ``displayColor`` primvar values, and is considerably faster than translating each color
+            individually.
+
+            Channel values within [0, 1] are approximated by interpolating a lookup table, which differs from the result of translating a single
+            color by less than 1e-6. Channel values outside of [0, 1] are translated exactly. Large arrays are translated in parallel.
+
+            Args:
+                colors: linear representations of the colors to be translated to sRGB color space
+
+            Returns:
+                The translated colors in sRGB color space, in the same order as the input colors
+        )"
+    );
 }
 
 } // namespace usdex::core::bindings
@@ -9,6 +9,7 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -31,7 +32,8 @@ void bindMeshAlgo(module& m)
             std::optional<const Vec3fPrimvarData>,
             std::optional<const Vec2fPrimvarData>,
             std::optional<const Vec3fPrimvarData>,
-            std::optional<const FloatPrimvarData>>(&definePolyMesh),
+            std::optional<const FloatPrimvarData>,
+            std::optional<float>>(&definePolyMesh),
         arg("stage"),
         arg("path"),
         arg("faceVertexCounts"),
@@ -41,6 +43,7 @@ void bindMeshAlgo(module& m)
         arg("uvs") = nullptr,
         arg("displayColor") = nullptr,
         arg("displayOpacity") = nullptr,
+        arg("compactionEpsilon") = nullptr,
         R"(
             Defines a basic polygon mesh on the stage.
 
@@ -53,6 +56,9 @@ void bindMeshAlgo(module& m)
                 - Display Color
                 - Display Opacity
 
+            If a ``compactionEpsilon`` is provided, faceVarying normals and uvs are welded into indexed primvars, or demoted to vertex
+            interpolation, before they are authored. See ``compactFaceVaryingPrimvar`` for details.
+
             Parameters:
                 - **stage** - The stage on which to define the mesh
                 - **path** - The absolute prim path at which to define the mesh
@@ -63,11 +69,14 @@ void bindMeshAlgo(module& m)
                 - **uvs** - Values to be authored for the uv primvar
                 - **displayColor** - Value to be authored for the display color primvar
                 - **displayOpacity** - Value to be authored for the display opacity primvar
+                - **compactionEpsilon** - If provided, faceVarying normals and uvs are compacted using ``compactFaceVaryingPrimvar`` with this
+                  tolerance prior to authoring.
 
             Returns:
                 ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -81,7 +90,8 @@ void bindMeshAlgo(module& m)
             std::optional<const Vec3fPrimvarData>,
             std::optional<const Vec2fPrimvarData>,
             std::optional<const Vec3fPrimvarData>,
-            std::optional<const FloatPrimvarData>>(&definePolyMesh),
+            std::optional<const FloatPrimvarData>,
+            std::optional<float>>(&definePolyMesh),
         arg("parent"),
         arg("name"),
         arg("faceVertexCounts"),
@@ -91,6 +101,7 @@ void bindMeshAlgo(module& m)
         arg("uvs") = nullptr,
         arg("displayColor") = nullptr,
         arg("displayOpacity") = nullptr,
+        arg("compactionEpsilon") = nullptr,
         R"(
             Defines a basic polygon mesh on the stage.
 
@@ -108,11 +119,14 @@ void bindMeshAlgo(module& m)
                 - **uvs** - Values to be authored for the uv primvar
                 - **displayColor** - Value to be authored for the display color primvar
                 - **displayOpacity** - Value to be authored for the display opacity primvar
+                - **compactionEpsilon** - If provided, faceVarying normals and uvs are compacted using ``compactFaceVaryingPrimvar`` with this
+                  tolerance prior to authoring.
 
             Returns:
                 ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -125,7 +139,8 @@ void bindMeshAlgo(module& m)
             std::optional<const Vec3fPrimvarData>,
             std::optional<const Vec2fPrimvarData>,
             std::optional<const Vec3fPrimvarData>,
-            std::optional<const FloatPrimvarData>>(&definePolyMesh),
+            std::optional<const FloatPrimvarData>,
+            std::optional<float>>(&definePolyMesh),
         arg("prim"),
         arg("faceVertexCounts"),
         arg("faceVertexIndices"),
@@ -134,6 +149,7 @@ void bindMeshAlgo(module& m)
         arg("uvs") = nullptr,
         arg("displayColor") = nullptr,
         arg("displayOpacity") = nullptr,
+        arg("compactionEpsilon") = nullptr,
         R"(
             Defines a basic polygon mesh on the stage.
 
@@ -150,11 +166,415 @@ void bindMeshAlgo(module& m)
                 - **uvs** - Values to be authored for the uv primvar
                 - **displayColor** - Value to be authored for the display color primvar
                 - **displayOpacity** - Value to be authored for the display opacity primvar
+                - **compactionEpsilon** - If provided, faceVarying normals and uvs are compacted using ``compactFaceVaryingPrimvar`` with this
+                  tolerance prior to authoring.
 
             Returns:
                 ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``.
 
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    pybind11::class_<PolyMeshDescription>(
+        m,
+        "PolyMeshDescription",
+        R"(
+            Describes a single polygon mesh to be defined by ``definePolyMeshes``.
+
+            The members correspond to the arguments of ``definePolyMesh`` and are subject to the same validation.
+        )"
+    )
+        .def(pybind11::init<>())
+        .def(
+            pybind11::init(
+                [](const SdfPath& path,
+                   const VtIntArray& faceVertexCounts,
+                   const VtIntArray& faceVertexIndices,
+                   const VtVec3fArray& points,
+                   std::optional<Vec3fPrimvarData> normals,
+                   std::optional<Vec2fPrimvarData> uvs,
+                   std::optional<Vec3fPrimvarData> displayColor,
+                   std::optional<FloatPrimvarData> displayOpacity)
+                {
+                    return PolyMeshDescription{ path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity };
+                }
+            ),
+            arg("path"),
+            arg("faceVertexCounts"),
+            arg("faceVertexIndices"),
+            arg("points"),
+            arg("normals") = nullptr,
+            arg("uvs") = nullptr,
+            arg("displayColor") = nullptr,
+            arg("displayOpacity") = nullptr
+        )
+        .def_readwrite("path", &PolyMeshDescription::path, "The absolute prim path at which to define the mesh")
+        .def_readwrite("faceVertexCounts", &PolyMeshDescription::faceVertexCounts, "The number of vertices in each face of the mesh")
+        .def_readwrite(
+            "faceVertexIndices",
+            &PolyMeshDescription::faceVertexIndices,
+            "Indices of the positions from the ``points`` to use for each face vertex"
+        )
+        .def_readwrite("points", &PolyMeshDescription::points, "Vertex positions for the mesh described in local space")
+        .def_readwrite("normals", &PolyMeshDescription::normals, "Values to be authored for the normals primvar")
+        .def_readwrite("uvs", &PolyMeshDescription::uvs, "Values to be authored for the uv primvar")
+        .def_readwrite("displayColor", &PolyMeshDescription::displayColor, "Values to be authored for the display color primvar")
+        .def_readwrite("displayOpacity", &PolyMeshDescription::displayOpacity, "Values to be authored for the display opacity primvar");
+
+    m.def(
+        "definePolyMeshes",
+        &definePolyMeshes,
+        arg("stage"),
+        arg("meshes"),
+        R"(
+            Defines many basic polygon meshes on the stage in a single call.
+
+            This produces the same scene description as calling ``definePolyMesh`` for each element of ``meshes``, but it is considerably faster
+            when defining thousands of meshes, as the per-mesh overhead is amortized across the batch:
+
+                - The location, topology, and primvars of all meshes are validated concurrently, prior to authoring any opinions.
+                - All of the prims are defined within a single ``Sdf.ChangeBlock``, so the stage only recomposes once.
+                - All of the attributes are authored within a single ``Sdf.ChangeBlock``, so change notification is only sent once.
+
+            Success or failure is reported per mesh. Any invalid mesh is not defined, a runtime error is emitted describing the reason, and an
+            invalid ``UsdGeom.Mesh`` is returned at the corresponding index. All other meshes are still defined.
+
+            Note:
+                The caller is responsible for ensuring the paths are unique. If several meshes share a path, the last one in ``meshes`` will be
+                authored.
+
+            Parameters:
+                - **stage** - The stage on which to define the meshes
+                - **meshes** - The descriptions of the meshes to define
+
+            Returns:
+                A ``UsdGeom.Mesh`` for each element of ``meshes``, in the same order. Any mesh which could not be defined will be invalid.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "defineDeformingPolyMesh",
+        &defineDeformingPolyMesh,
+        arg("stage"),
+        arg("path"),
+        arg("faceVertexCounts"),
+        arg("faceVertexIndices"),
+        arg("times"),
+        arg("points"),
+        arg("normals") = list(),
+        arg("uvs") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        R"(
+            Defines a deforming ``UsdGeom.Mesh`` prim on the stage, with a single topology and time sampled points and normals.
+
+            This is intended for caches of simulated or animated geometry, where the topology is constant but the points change on every frame.
+            It is considerably faster than calling ``definePolyMesh`` and then authoring each time sample individually:
+
+                - The location, topology, and static primvars are validated once, rather than once per frame.
+                - The points and normals of each frame are validated, and the extent of each frame is computed, concurrently.
+                - All of the time samples are authored within a single ``Sdf.ChangeBlock``, so change notification is only sent once.
+
+            Attribute values will be validated and in the case of invalid data the Mesh will not be defined. An invalid ``UsdGeom.Mesh`` object
+            will be returned in this case.
+
+            The topology, UVs, display color, and display opacity are authored as default values. The points, normals and extent are only authored
+            as time samples. The interpolation, indexing, and element size of the normals must be the same on every frame, as these are not time
+            varying.
+
+            Parameters:
+                - **stage** - The stage on which to define the mesh
+                - **path** - The absolute prim path at which to define the mesh
+                - **faceVertexCounts** - The number of vertices in each face of the mesh
+                - **faceVertexIndices** - Indices of the positions from the ``points`` to use for each face vertex
+                - **times** - The time code of each frame. Default time codes are not valid.
+                - **points** - Vertex/CV positions for the mesh described in local space, one array per frame. Every array must be the same size.
+                - **normals** - Values for the normals primvar, one per frame, or an empty list to skip normals.
+                - **uvs** - Values to be authored for the uv primvar
+                - **displayColor** - Value to be authored for the display color primvar
+                - **displayOpacity** - Value to be authored for the display opacity primvar
+
+            Returns:
+                ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``. Returns an invalid schema on error.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "updatePolyMesh",
+        &updatePolyMesh,
+        arg("mesh"),
+        arg("faceVertexCounts"),
+        arg("faceVertexIndices"),
+        arg("points"),
+        arg("normals") = nullptr,
+        arg("uvs") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        R"(
+            Updates an existing ``UsdGeom.Mesh`` prim, only authoring the attributes whose values have changed.
+
+            This is intended for live or iterative workflows, where a mesh is re-exported many times but only a subset of its data changes between
+            exports (e.g. a deformation that modifies the points but not the topology). Each value is compared to the current value of the attribute
+            at the default time, and opinions are only authored on the current edit target for attributes which differ. Unchanged attributes do not
+            author any scene description and do not trigger change notification.
+
+            The extent is only recomputed when the points have changed, or when there is no extent authored.
+
+            Attribute values will be validated as in ``definePolyMesh``, and in the case of invalid data no attributes will be authored.
+
+            Parameters:
+                - **mesh** - The mesh to update
+                - **faceVertexCounts** - The number of vertices in each face of the mesh
+                - **faceVertexIndices** - Indices of the positions from the ``points`` to use for each face vertex
+                - **points** - Vertex/CV positions for the mesh described in local space
+                - **normals** - Values to be authored for the normals primvar. If not provided the existing normals are left unchanged.
+                - **uvs** - Values to be authored for the uv primvar. If not provided the existing uvs are left unchanged.
+                - **displayColor** - Value to be authored for the display color primvar. If not provided the existing value is left unchanged.
+                - **displayOpacity** - Value to be authored for the display opacity primvar. If not provided the existing value is left unchanged.
+
+            Returns:
+                Whether the mesh was successfully updated. Returns false if the mesh is invalid or the data fails validation.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+    m.def(
+        "compactFaceVaryingPrimvar",
+        overload_cast<Vec3fPrimvarData&, const VtIntArray&, size_t, float>(&compactFaceVaryingPrimvar),
+        arg("primvar"),
+        arg("faceVertexIndices"),
+        arg("numPoints"),
+        arg("epsilon") = 0.0f,
+        R"(
+            Compacts a faceVarying primvar into the smallest equivalent description for the given mesh topology.
+
+            Meshes imported from other formats commonly arrive with fully expanded faceVarying normals and uvs, where most face vertices which
+            share a point also share a value. These can be described far more compactly, which reduces file size and the memory required by
+            downstream renderers.
+
+                - If every face vertex of each point has the same value, the primvar is demoted to vertex interpolation.
+                - Values which are equal within the tolerance are welded together, and the primvar is indexed if that reduces the storage required.
+
+            Values are welded when all of their components fall within the same ``epsilon`` sized cell, and the first value found in each cell is
+            retained. Demotion to vertex interpolation compares each face vertex to the first face vertex of its point, component by component,
+            within ``epsilon``. An ``epsilon`` of zero only welds values which are exactly equal.
+
+            Updates will not be made in the following conditions:
+
+                - If the interpolation is not faceVarying.
+                - If the element size is greater than one.
+                - If the primvar is invalid or does not match the topology.
+                - If the compacted primvar would not be smaller than the existing one.
+
+            Parameters:
+                - **primvar** - The primvar data to compact in place
+                - **faceVertexIndices** - Indices of the points used for each face vertex of the mesh
+                - **numPoints** - The number of points in the mesh
+                - **epsilon** - The tolerance within which values are considered equal
+
+            Returns:
+                True if the primvar was modified.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "compactFaceVaryingPrimvar",
+        overload_cast<Vec2fPrimvarData&, const VtIntArray&, size_t, float>(&compactFaceVaryingPrimvar),
+        arg("primvar"),
+        arg("faceVertexIndices"),
+        arg("numPoints"),
+        arg("epsilon") = 0.0f,
+        R"(
+            Compacts a faceVarying primvar into the smallest equivalent description for the given mesh topology.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+
+            Parameters:
+                - **primvar** - The primvar data to compact in place
+                - **faceVertexIndices** - Indices of the points used for each face vertex of the mesh
+                - **numPoints** - The number of points in the mesh
+                - **epsilon** - The tolerance within which values are considered equal
+
+            Returns:
+                True if the primvar was modified.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    pybind11::class_<MeshLibrary>(
+        m,
+        "MeshLibrary",
+        R"(
+            Deduplicates identical meshes into an asset library, so each unique mesh is defined once and referenced from every place it is used.
+
+            Each mesh is content-hashed from its topology, points, and primvars. The first time a mesh is seen, it is defined within the library
+            stage as a ``UsdGeom.Mesh`` named "Mesh", beneath a ``UsdGeom.Xform`` which is a child of the default prim of the library stage
+            (e.g. the asset library stage returned by ``addAssetLibrary``). Every use of the mesh, including the first, is a prim which references
+            that ``UsdGeom.Xform``, and which is optionally marked instanceable so that all uses share a single USD prototype.
+
+            The prims which use a library mesh are ``UsdGeom.Xform`` prims, so their local transform can be set in the usual way (e.g. using
+            ``setLocalTransform``). Their points must be described in the local space of the mesh, so that identical parts share the same points.
+
+            Note:
+                The library is not thread safe. Meshes are only considered identical if all of their values are exactly equal.
         )"
+    )
+        .def(pybind11::init<UsdStagePtr, bool>(), arg("libraryStage"), arg("instanceable") = true)
+        .def(
+            "definePolyMesh",
+            &MeshLibrary::definePolyMesh,
+            arg("stage"),
+            arg("mesh"),
+            R"(
+                Define a prim which uses a library mesh, defining the mesh in the library if no identical mesh has been defined yet.
+
+                The mesh is validated exactly as by ``definePolyMesh`` when it is first defined in the library. The ``path`` of the mesh is the
+                location of the prim which references the library mesh, and the name of the path is used to name the library mesh when it is
+                first defined.
+
+                Parameters:
+                    - **stage** - The stage on which to define the prim which uses the library mesh. This may be the library stage itself.
+                    - **mesh** - The ``PolyMeshDescription`` of the mesh.
+
+                Returns:
+                    The prim which references the library mesh. Returns an invalid prim on error.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def("getUniqueMeshCount", &MeshLibrary::getUniqueMeshCount, "Get the number of unique meshes which have been defined in the library.")
+        .def("getUseCount", &MeshLibrary::getUseCount, "Get the number of prims which have been defined using a library mesh.");
+
+    m.def(
+        "simplifyPolyMesh",
+        &simplifyPolyMesh,
+        arg("mesh"),
+        arg("ratio"),
+        R"(
+            Computes a simplified level of detail (LOD) of a polygon mesh, by collapsing the edges whose removal least changes the shape of its
+            surface.
+
+            The mesh is triangulated, and edges are collapsed, in order of the least change to the surface, until the number of triangles is
+            reduced to ``ratio`` of the triangulated mesh. Each collapse removes a point from the mesh, so the simplified points are a subset of
+            the original points.
+
+            The normals, uvs, display color, and display opacity are preserved, retaining their interpolation, indexing, and element size:
+
+                - Vertex values of the remaining points are unchanged.
+                - Uniform values follow the face from which each triangle originated.
+                - FaceVarying values of the remaining face vertices are unchanged.
+                - Points on a seam (where uniform or faceVarying values differ between the faces of a point) are never removed, so seams are
+                  preserved.
+
+            Open boundaries of the mesh retain their shape, and collapses which would flip a triangle or produce non-manifold topology are never
+            made, so the simplified mesh may retain more triangles than requested. Faceted meshes with unwelded faceVarying primvars have seams
+            at every point, so consider ``compactFaceVaryingPrimvar`` prior to simplifying them. The result is deterministic.
+
+            The mesh is validated exactly as by ``definePolyMesh``, except that its location is not considered.
+
+            Parameters:
+                - **mesh** - The description of the mesh to simplify
+                - **ratio** - The fraction of the triangles of the mesh to retain. This must be greater than 0 and at most 1.
+
+            Returns:
+                The description of the simplified mesh, with the same path as ``mesh``. Returns ``None`` on error.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    pybind11::enum_<MeshLodStyle>(m, "MeshLodStyle", "Controls how ``definePolyMeshLods`` authors the levels of detail (LODs) of each mesh.")
+        .value(
+            "eVariantSet",
+            MeshLodStyle::eVariantSet,
+            "Author a ``getLodToken()`` variant set on each mesh, with a \"LOD0\" variant for the mesh and a \"LOD<N>\" variant per ratio."
+        )
+        .value(
+            "ePurpose",
+            MeshLodStyle::ePurpose,
+            "Author each mesh with \"render\" purpose, and a \"<name>_proxy\" sibling mesh with \"proxy\" purpose, targeted by its ``proxyPrim``."
+        );
+
+    m.def(
+        "definePolyMeshLods",
+        &definePolyMeshLods,
+        arg("stage"),
+        arg("meshes"),
+        arg("ratios"),
+        arg("style") = MeshLodStyle::eVariantSet,
+        R"(
+            Defines polygon meshes on the stage, along with simplified levels of detail (LODs) of each mesh, so that viewers can interactively
+            load large scenes (e.g. CAD assemblies) using the lighter LODs.
+
+            The LODs of all of the meshes are computed concurrently using ``simplifyPolyMesh``, with one LOD per element of ``ratios``, prior to
+            authoring any opinions. How the LODs are authored is controlled by ``style``:
+
+                - ``MeshLodStyle.eVariantSet`` defines each mesh with a ``getLodToken()`` variant set. The "LOD0" variant holds the mesh itself,
+                  and the "LOD1", "LOD2", etc variants hold the LOD of each ratio, in order. "LOD0" is selected. This matches the variant set
+                  authored by ``addAssetLodInterface``, which selects between payloads of an entire asset, whereas these variants select between
+                  individual meshes.
+                - ``MeshLodStyle.ePurpose`` defines each mesh with "render" purpose, and defines its LOD as a sibling mesh named "<name>_proxy"
+                  with "proxy" purpose. The ``proxyPrim`` relationship of each mesh targets its proxy. A single ratio must be provided, as there
+                  is only one proxy purpose.
+
+            Success or failure is reported per mesh, as by ``definePolyMeshes``. Any mesh which is invalid (or whose proxy location is invalid)
+            is not defined, a runtime error is emitted describing the reason, and an invalid ``UsdGeom.Mesh`` is returned at the corresponding
+            index.
+
+            Parameters:
+                - **stage** - The stage on which to define the meshes
+                - **meshes** - The descriptions of the meshes to define
+                - **ratios** - The fraction of the triangles of each mesh to retain in each LOD, in order. Each ratio must be greater than 0 and
+                  at most 1.
+                - **style** - How to author the LODs of each mesh
+
+            Returns:
+                The ``UsdGeom.Mesh`` of each element of ``meshes``, in the same order. Any mesh which could not be defined will be invalid.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "defineMaterialSubsets",
+        &defineMaterialSubsets,
+        arg("mesh"),
+        arg("faceMaterialIds"),
+        arg("materials"),
+        R"(
+            Defines a ``UsdGeom.Subset`` per material below an existing mesh, partitioning its faces by a material id per face, and binds the
+            materials.
+
+            Meshes imported from other formats commonly assign materials per face. The faces are partitioned in a single concurrent pass, and each
+            material which is assigned to at least one face has a subset defined containing the indices of its faces, in ascending order. The
+            subsets are named after their materials, made unique using ``getValidChildNames``, and are members of the "materialBind" family. The
+            family type is "partition" if every face is assigned a material, and is otherwise "nonOverlapping".
+
+            All of the subsets are defined with a single round of change processing, and the materials are bound to them using ``bindMaterials``.
+
+            Faces with a negative material id are not assigned to any subset. If any material id is not a valid index into ``materials``, if the
+            number of material ids does not match the number of faces of the mesh, or if any assigned material is invalid, no subsets are defined
+            and a runtime error is emitted describing the reason.
+
+            Parameters:
+                - **mesh** - The mesh whose faces are assigned materials
+                - **faceMaterialIds** - The index into ``materials`` of the material assigned to each face, or a negative value for faces without
+                  a material
+                - **materials** - The materials which may be assigned to the faces
+
+            Returns:
+                The subset of each material, in the same order as ``materials``, or an empty list on error. A material which is not assigned to any
+                face has no subset, and an invalid ``UsdGeom.Subset`` is returned at its index.
+
+        )",
+        call_guard<gil_scoped_release>()
     );
 }
 
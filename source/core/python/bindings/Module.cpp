@@ -8,10 +8,12 @@ ARCH_PRAGMA_PUSH
 ARCH_PRAGMA_MAYBE_UNINITIALIZED
 
 #include "AssetStructureBindings.h"
+#include "AuthoringBindings.h"
 #include "CameraAlgoBindings.h"
 #include "CoreBindings.h"
 #include "CurvesAlgoBindings.h"
 #include "DiagnosticsBindings.h"
+#include "InstrumentationBindings.h"
 #include "LayerAlgoBindings.h"
 #include "LightAlgoBindings.h"
 #include "MaterialAlgoBindings.h"
@@ -38,6 +40,8 @@ PYBIND11_MODULE(_usdex_core, m)
     bindCore(m);
     bindSettings(m);
     bindDiagnostics(m);
+    bindInstrumentation(m);
+    bindAuthoring(m);
     bindLayerAlgo(m);
     bindStageAlgo(m);
     bindAssetStructure(m);
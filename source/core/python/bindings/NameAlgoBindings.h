@@ -11,6 +11,7 @@
 #include "pxr/base/arch/pragmas.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -49,7 +50,8 @@ void bindNameAlgo(module& m)
 
             Returns:
                 A vector of valid and unique names.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -83,7 +85,8 @@ void bindNameAlgo(module& m)
 
             Returns:
                 A vector of valid and unique names.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -115,6 +118,44 @@ void bindNameAlgo(module& m)
 
             Returns:
                 A vector of valid and unique names.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "getDecodedNames",
+        overload_cast<const TfTokenVector&>(&getDecodedNames),
+        arg("names"),
+        R"(
+            Take a vector of names and return a matching vector of their decoded values.
+
+            Names that were produced by the Bootstring algorithm (i.e. those with the "tn__" prefix) are decoded to their original UTF-8 value.
+            All other names, including any that can not be decoded, are returned unchanged.
+
+            Large vectors of names are decoded in parallel.
+
+            Args:
+                names: A vector of prim or property names.
+
+            Returns:
+                A vector of decoded names, matching the order of the input names.
+        )"
+    );
+
+    m.def(
+        "getDecodedNames",
+        overload_cast<const UsdPrimRange&>(&getDecodedNames),
+        arg("range"),
+        R"(
+            Return the decoded names of all prims in a range.
+
+            This is equivalent to calling `getDecodedNames` with the names of each prim visited by the range.
+
+            Args:
+                range: The range of prims to decode the names of.
+
+            Returns:
+                A vector of decoded names, matching the traversal order of the range.
         )"
     );
 
@@ -552,6 +593,89 @@ void bindNameAlgo(module& m)
                 Args:
                     parent: The parent prim spec
             )"
+        )
+
+        .def(
+            "exportSnapshot",
+            &NameCache::exportSnapshot,
+            R"(
+                Export the reserved names and suffix indices of all cache entries.
+
+                The snapshot can be imported into another `NameCache` (e.g. in a later session) which will then produce the same names as this cache
+                would have, without needing to re-read the existing names from a stage or layer. The snapshot only holds USD value types, so it can
+                be stored in any dictionary valued metadata, such as the custom layer data of the layer being authored.
+
+                Returns:
+                    A dictionary describing the contents of the cache.
+            )"
+        )
+
+        .def(
+            "importSnapshot",
+            &NameCache::importSnapshot,
+            arg("snapshot"),
+            R"(
+                Import the reserved names and suffix indices from a snapshot produced by `exportSnapshot`.
+
+                The snapshot is merged with the existing contents of the cache. Names reserved in either are reserved after the import, and suffix
+                numbering continues from the larger index for each name. Cache entries created by the import will not be populated with the existing
+                names of a `Usd.Prim` or `Sdf.PrimSpec` parent when they are later used.
+
+                If the snapshot is malformed the cache is left unchanged and a runtime error is issued.
+
+                Args:
+                    snapshot: A dictionary produced by `exportSnapshot`.
+
+                Returns:
+                    True if the snapshot was imported, otherwise false.
+            )"
+        )
+
+        .def(
+            "setMaxEntries",
+            &NameCache::setMaxEntries,
+            arg("maxEntries"),
+            R"(
+                Limit the number of parents for which prim names and property names are cached.
+
+                Once the limit is reached, the entries of the least recently used parents are evicted. The limit is applied approximately, as it
+                is divided evenly between independently locked partitions of the cache. A limit of zero (the default) allows the cache to grow
+                without bound.
+
+                Warning:
+                    Evicting an entry discards all of its reserved names. If names are later requested for the same parent, a `Usd.Prim` or
+                    `Sdf.PrimSpec` parent will reserve its existing children again, so only names which were returned but never authored can be
+                    repeated. An `Sdf.Path` parent has no existing children, so any of its names can be repeated. Only set a limit if names for a
+                    parent are authored before many other parents are named, as is typical when converting a hierarchy depth first.
+
+                Args:
+                    maxEntries: The maximum number of parents to cache for each of prim and property names, or zero for no limit.
+            )"
+        )
+
+        .def(
+            "getMaxEntries",
+            &NameCache::getMaxEntries,
+            R"(
+                Return the maximum number of parents for which prim names and property names are cached.
+
+                Returns:
+                    The limit set by `setMaxEntries`, or zero if there is no limit.
+            )"
+        )
+
+        .def(
+            "memoryUsage",
+            &NameCache::memoryUsage,
+            R"(
+                Return the approximate number of bytes allocated by the cache.
+
+                The names themselves are tokens, so their strings are held by the token registry (and shared by any other tokens with the same
+                value) and are not included.
+
+                Returns:
+                    The approximate memory usage in bytes.
+            )"
         );
 
     // FUTURE: Remove when the deprecated ValidChildNameCache class is removed
@@ -592,7 +716,8 @@ void bindNameAlgo(module& m)
 
                 Returns:
                     A vector of valid and unique names.
-            )"
+            )",
+            call_guard<gil_scoped_release>()
         )
 
         .def(
@@ -726,6 +851,69 @@ void bindNameAlgo(module& m)
 
         )"
     );
+
+    m.def(
+        "getDisplayNames",
+        &getDisplayNames,
+        arg("prims"),
+        R"(
+            Return the display names (metadata) of many prims
+
+            Large lists of prims are read in parallel.
+
+            Args:
+                prims: The prims to get the display names from
+
+            Returns:
+                Authored values, matching the order of the prims. An empty string is returned for any prim which has no display name or is invalid.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setDisplayNames",
+        &setDisplayNames,
+        arg("prims"),
+        arg("names"),
+        arg("authorPrimSpecs") = false,
+        R"(
+            Set the display names (metadata) of many prims
+
+            All of the display names are authored with a single round of change processing.
+
+            By default the display names are authored using the same mechanism as ``setDisplayName``. Alternatively, the display names can be
+            authored directly on the prim specs of the edit target of each prim's stage. This avoids any per-prim overhead of the ``Usd.Stage``
+            authoring API, but does not validate that the edit target is able to author opinions for each prim (e.g. that the prim is not an
+            instance proxy).
+
+            Args:
+                prims: The prims to set the display names for
+                names: The values to set, one per prim
+                authorPrimSpecs: Author directly on the prim specs of the edit target rather than via the ``Usd.Stage``
+
+            Returns:
+                True if all of the display names were set, otherwise false. Nothing is authored if the number of prims and names differ.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "computeEffectiveDisplayNames",
+        &computeEffectiveDisplayNames,
+        arg("prims"),
+        R"(
+            Calculate the effective display names of many prims
+
+            This is equivalent to calling ``computeEffectiveDisplayName`` for each prim. Large lists of prims are read in parallel.
+
+            Args:
+                prims: The prims to compute the display names for
+
+            Returns:
+                The effective display names, matching the order of the prims. An empty string is returned for any invalid prim.
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 
 } // namespace usdex::core::bindings
@@ -45,12 +45,19 @@ void bindPhysicsJointAlgo(module& m)
 
     m.def(
         "definePhysicsFixedJoint",
-        overload_cast<UsdStagePtr, const SdfPath&, const UsdPrim&, const UsdPrim&, const JointFrame&>(&definePhysicsFixedJoint),
+        overload_cast<
+            UsdStagePtr,
+            const SdfPath&,
+            const UsdPrim&,
+            const UsdPrim&,
+            const JointFrame&,
+            const WorldTransformCache*>(&definePhysicsFixedJoint),
         arg("stage"),
         arg("path"),
         arg("body0"),
         arg("body1"),
         arg("frame"),
+        arg("xformCache") = nullptr,
         R"(
             Creates a fixed joint connecting two rigid bodies.
 
@@ -67,20 +74,30 @@ void bindPhysicsJointAlgo(module& m)
                 - **body0** - The first body of the joint
                 - **body1** - The second body of the joint
                 - **frame** - The position and rotation of the joint in the specified coordinate system.
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.FixedJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "definePhysicsFixedJoint",
-        overload_cast<UsdPrim, const std::string&, const UsdPrim&, const UsdPrim&, const JointFrame&>(&definePhysicsFixedJoint),
+        overload_cast<
+            UsdPrim,
+            const std::string&,
+            const UsdPrim&,
+            const UsdPrim&,
+            const JointFrame&,
+            const WorldTransformCache*>(&definePhysicsFixedJoint),
         arg("parent"),
         arg("name"),
         arg("body0"),
         arg("body1"),
         arg("frame"),
+        arg("xformCache") = nullptr,
         R"(
             Creates a fixed joint connecting two rigid bodies.
 
@@ -92,19 +109,23 @@ void bindPhysicsJointAlgo(module& m)
                 - **body0** - The first body of the joint
                 - **body1** - The second body of the joint
                 - **frame** - The position and rotation of the joint in the specified coordinate system.
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.FixedJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "definePhysicsFixedJoint",
-        overload_cast<UsdPrim, const UsdPrim&, const UsdPrim&, const JointFrame&>(&definePhysicsFixedJoint),
+        overload_cast<UsdPrim, const UsdPrim&, const UsdPrim&, const JointFrame&, const WorldTransformCache*>(&definePhysicsFixedJoint),
         arg("prim"),
         arg("body0"),
         arg("body1"),
         arg("frame"),
+        arg("xformCache") = nullptr,
         R"(
             Creates a fixed joint connecting two rigid bodies.
 
@@ -115,10 +136,13 @@ void bindPhysicsJointAlgo(module& m)
                 - **body0** - The first body of the joint
                 - **body1** - The second body of the joint
                 - **frame** - The position and rotation of the joint in the specified coordinate system.
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.FixedJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -131,7 +155,8 @@ void bindPhysicsJointAlgo(module& m)
             const JointFrame&,
             const GfVec3f&,
             std::optional<float>,
-            std::optional<float>>(&definePhysicsRevoluteJoint),
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsRevoluteJoint),
         arg("stage"),
         arg("path"),
         arg("body0"),
@@ -140,6 +165,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("lowerLimit") = nullptr,
         arg("upperLimit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a revolute joint, which acts as a hinge around a single axis, connecting two rigid bodies.
 
@@ -162,10 +188,13 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of rotation
                 - **lowerLimit** - The lower limit of the joint (degrees).
                 - **upperLimit** - The upper limit of the joint (degrees).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.RevoluteJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -178,7 +207,8 @@ void bindPhysicsJointAlgo(module& m)
             const JointFrame&,
             const GfVec3f&,
             std::optional<float>,
-            std::optional<float>>(&definePhysicsRevoluteJoint),
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsRevoluteJoint),
         arg("parent"),
         arg("name"),
         arg("body0"),
@@ -187,6 +217,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("lowerLimit") = nullptr,
         arg("upperLimit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a revolute joint, which acts as a hinge around a single axis, connecting two rigid bodies.
 
@@ -201,17 +232,26 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of rotation
                 - **lowerLimit** - The lower limit of the joint (degrees).
                 - **upperLimit** - The upper limit of the joint (degrees).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.RevoluteJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "definePhysicsRevoluteJoint",
-        overload_cast<UsdPrim, const UsdPrim&, const UsdPrim&, const JointFrame&, const GfVec3f&, std::optional<float>, std::optional<float>>(
-            &definePhysicsRevoluteJoint
-        ),
+        overload_cast<
+            UsdPrim,
+            const UsdPrim&,
+            const UsdPrim&,
+            const JointFrame&,
+            const GfVec3f&,
+            std::optional<float>,
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsRevoluteJoint),
         arg("prim"),
         arg("body0"),
         arg("body1"),
@@ -219,6 +259,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("lowerLimit") = nullptr,
         arg("upperLimit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a revolute joint, which acts as a hinge around a single axis, connecting two rigid bodies.
 
@@ -232,10 +273,13 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of rotation
                 - **lowerLimit** - The lower limit of the joint (degrees).
                 - **upperLimit** - The upper limit of the joint (degrees).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.RevoluteJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -248,7 +292,8 @@ void bindPhysicsJointAlgo(module& m)
             const JointFrame&,
             const GfVec3f&,
             std::optional<float>,
-            std::optional<float>>(&definePhysicsPrismaticJoint),
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsPrismaticJoint),
         arg("stage"),
         arg("path"),
         arg("body0"),
@@ -257,6 +302,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("lowerLimit") = nullptr,
         arg("upperLimit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a prismatic joint, which acts as a slider along a single axis, connecting two rigid bodies.
 
@@ -282,10 +328,13 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of the joint.
                 - **lowerLimit** - The lower limit of the joint (distance).
                 - **upperLimit** - The upper limit of the joint (distance).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.PrismaticJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -298,7 +347,8 @@ void bindPhysicsJointAlgo(module& m)
             const JointFrame&,
             const GfVec3f&,
             std::optional<float>,
-            std::optional<float>>(&definePhysicsPrismaticJoint),
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsPrismaticJoint),
         arg("parent"),
         arg("name"),
         arg("body0"),
@@ -307,6 +357,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("lowerLimit") = nullptr,
         arg("upperLimit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a prismatic joint, which acts as a slider along a single axis, connecting two rigid bodies.
 
@@ -321,17 +372,26 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of the joint.
                 - **lowerLimit** - The lower limit of the joint (distance).
                 - **upperLimit** - The upper limit of the joint (distance).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.PrismaticJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "definePhysicsPrismaticJoint",
-        overload_cast<UsdPrim, const UsdPrim&, const UsdPrim&, const JointFrame&, const GfVec3f&, std::optional<float>, std::optional<float>>(
-            &definePhysicsPrismaticJoint
-        ),
+        overload_cast<
+            UsdPrim,
+            const UsdPrim&,
+            const UsdPrim&,
+            const JointFrame&,
+            const GfVec3f&,
+            std::optional<float>,
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsPrismaticJoint),
         arg("prim"),
         arg("body0"),
         arg("body1"),
@@ -339,6 +399,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("lowerLimit") = nullptr,
         arg("upperLimit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a prismatic joint, which acts as a slider along a single axis, connecting two rigid bodies.
 
@@ -352,10 +413,13 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of the joint.
                 - **lowerLimit** - The lower limit of the joint (distance).
                 - **upperLimit** - The upper limit of the joint (distance).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.PrismaticJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -368,7 +432,8 @@ void bindPhysicsJointAlgo(module& m)
             const JointFrame&,
             const GfVec3f&,
             std::optional<float>,
-            std::optional<float>>(&definePhysicsSphericalJoint),
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsSphericalJoint),
         arg("stage"),
         arg("path"),
         arg("body0"),
@@ -377,6 +442,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("coneAngle0Limit") = nullptr,
         arg("coneAngle1Limit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a spherical joint, which acts as a ball and socket joint, connecting two rigid bodies.
 
@@ -402,10 +468,13 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of the joint.
                 - **coneAngle0Limit** - The lower limit of the cone angle (degrees).
                 - **coneAngle1Limit** - The upper limit of the cone angle (degrees).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.SphericalJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -418,7 +487,8 @@ void bindPhysicsJointAlgo(module& m)
             const JointFrame&,
             const GfVec3f&,
             std::optional<float>,
-            std::optional<float>>(&definePhysicsSphericalJoint),
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsSphericalJoint),
         arg("parent"),
         arg("name"),
         arg("body0"),
@@ -427,6 +497,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("coneAngle0Limit") = nullptr,
         arg("coneAngle1Limit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a spherical joint, which acts as a ball and socket joint, connecting two rigid bodies.
 
@@ -441,17 +512,26 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of the joint.
                 - **coneAngle0Limit** - The lower limit of the cone angle (degrees).
                 - **coneAngle1Limit** - The upper limit of the cone angle (degrees).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.SphericalJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "definePhysicsSphericalJoint",
-        overload_cast<UsdPrim, const UsdPrim&, const UsdPrim&, const JointFrame&, const GfVec3f&, std::optional<float>, std::optional<float>>(
-            &definePhysicsSphericalJoint
-        ),
+        overload_cast<
+            UsdPrim,
+            const UsdPrim&,
+            const UsdPrim&,
+            const JointFrame&,
+            const GfVec3f&,
+            std::optional<float>,
+            std::optional<float>,
+            const WorldTransformCache*>(&definePhysicsSphericalJoint),
         arg("prim"),
         arg("body0"),
         arg("body1"),
@@ -459,6 +539,7 @@ void bindPhysicsJointAlgo(module& m)
         arg("axis"),
         arg("coneAngle0Limit") = nullptr,
         arg("coneAngle1Limit") = nullptr,
+        arg("xformCache") = nullptr,
         R"(
             Creates a spherical joint, which acts as a ball and socket joint, connecting two rigid bodies.
 
@@ -472,18 +553,22 @@ void bindPhysicsJointAlgo(module& m)
                 - **axis** - The axis of the joint.
                 - **coneAngle0Limit** - The lower limit of the cone angle (degrees).
                 - **coneAngle1Limit** - The upper limit of the cone angle (degrees).
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
 
             Returns:
                 ``UsdPhysics.SphericalJoint`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "alignPhysicsJoint",
-        overload_cast<UsdPhysicsJoint, const JointFrame&, const GfVec3f&>(&alignPhysicsJoint),
+        overload_cast<UsdPhysicsJoint, const JointFrame&, const GfVec3f&, const WorldTransformCache*>(&alignPhysicsJoint),
         arg("joint"),
         arg("frame"),
         arg("axis"),
+        arg("xformCache") = nullptr,
         R"(
             Aligns an existing joint with the specified position, rotation, and axis.
 
@@ -501,7 +586,145 @@ void bindPhysicsJointAlgo(module& m)
                 - **joint** - The joint to align
                 - **frame** - Specifies the position and rotation of the joint in the specified coordinate system.
                 - **axis** - The axis of the joint.
+                - **xformCache** - An optional cache of world transforms, used to compute the local frames of the bodies. Sharing one cache
+                  between many joints avoids recomputing the world transforms of common bodies.
+        )"
+    );
+
+    m.def(
+        "alignPhysicsJoints",
+        &alignPhysicsJoints,
+        arg("joints"),
+        arg("frames"),
+        arg("axes"),
+        arg("xformCache") = nullptr,
+        R"(
+            Aligns many existing joints with the specified positions, rotations, and axes.
+
+            This produces the same opinions as calling ``alignPhysicsJoint`` for each joint, but the world transforms of all bodies are read from a
+            single ``WorldTransformCache`` and the local frames are computed concurrently. All of the frames are then authored within a single
+            ``Sdf.ChangeBlock``. This avoids recomputing the transforms of the ancestors shared by the bodies of an articulation for every joint.
+
+            Any joint which can not be aligned is skipped with a runtime error, and all other joints are still aligned.
+
+            Parameters:
+                - **joints** - The joints to align. All of the joints must belong to the same stage.
+                - **frames** - The position and rotation of each joint in the specified coordinate system. This must be the same size as ``joints``.
+                - **axes** - The axis of each joint. This must be the same size as ``joints``.
+                - **xformCache** - An optional cache of world transforms, which can be shared with other calls. It must be a cache of the stage of
+                  the joints. If it is not specified, a cache is created for this call alone.
+
+            Returns:
+                Whether every joint was aligned.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    pybind11::class_<PhysicsJointDescription> jointDescription(
+        m,
+        "PhysicsJointDescription",
+        R"(
+            Describes a single physics joint to be defined by ``definePhysicsJoints``.
+
+            The members correspond to the arguments of the ``definePhysics*Joint`` functions and are subject to the same validation. Members which
+            do not apply to the ``type`` of joint are ignored.
         )"
     );
+
+    pybind11::enum_<PhysicsJointDescription::Type>(jointDescription, "Type", "The types of joint which can be defined")
+        .value("Fixed", PhysicsJointDescription::Type::Fixed, "A ``UsdPhysics.FixedJoint``, as defined by ``definePhysicsFixedJoint``")
+        .value("Revolute", PhysicsJointDescription::Type::Revolute, "A ``UsdPhysics.RevoluteJoint``, as defined by ``definePhysicsRevoluteJoint``")
+        .value(
+            "Prismatic",
+            PhysicsJointDescription::Type::Prismatic,
+            "A ``UsdPhysics.PrismaticJoint``, as defined by ``definePhysicsPrismaticJoint``"
+        )
+        .value(
+            "Spherical",
+            PhysicsJointDescription::Type::Spherical,
+            "A ``UsdPhysics.SphericalJoint``, as defined by ``definePhysicsSphericalJoint``"
+        );
+
+    jointDescription.def(pybind11::init<>())
+        .def(
+            pybind11::init(
+                [](PhysicsJointDescription::Type type,
+                   const SdfPath& path,
+                   const UsdPrim& body0,
+                   const UsdPrim& body1,
+                   const JointFrame& frame,
+                   const GfVec3f& axis,
+                   std::optional<float> lowerLimit,
+                   std::optional<float> upperLimit,
+                   std::optional<float> coneAngle0Limit,
+                   std::optional<float> coneAngle1Limit)
+                {
+                    return PhysicsJointDescription{ type, path, body0, body1, frame, axis, lowerLimit, upperLimit, coneAngle0Limit, coneAngle1Limit };
+                }
+            ),
+            arg("type"),
+            arg("path"),
+            arg("body0"),
+            arg("body1"),
+            arg("frame"),
+            arg("axis") = GfVec3f(1.0f, 0.0f, 0.0f),
+            arg("lowerLimit") = nullptr,
+            arg("upperLimit") = nullptr,
+            arg("coneAngle0Limit") = nullptr,
+            arg("coneAngle1Limit") = nullptr
+        )
+        .def_readwrite("type", &PhysicsJointDescription::type, "The type of joint to define")
+        .def_readwrite("path", &PhysicsJointDescription::path, "The absolute prim path at which to define the joint")
+        .def_readwrite("body0", &PhysicsJointDescription::body0, "The first body of the joint")
+        .def_readwrite("body1", &PhysicsJointDescription::body1, "The second body of the joint")
+        .def_readwrite("frame", &PhysicsJointDescription::frame, "The position and rotation of the joint in the specified coordinate system")
+        .def_readwrite("axis", &PhysicsJointDescription::axis, "The axis of a revolute, prismatic, or spherical joint")
+        .def_readwrite("lowerLimit", &PhysicsJointDescription::lowerLimit, "The lower limit of a revolute (degrees) or prismatic (distance) joint")
+        .def_readwrite("upperLimit", &PhysicsJointDescription::upperLimit, "The upper limit of a revolute (degrees) or prismatic (distance) joint")
+        .def_readwrite(
+            "coneAngle0Limit",
+            &PhysicsJointDescription::coneAngle0Limit,
+            "The cone limit of a spherical joint from the primary joint axis (degrees)"
+        )
+        .def_readwrite(
+            "coneAngle1Limit",
+            &PhysicsJointDescription::coneAngle1Limit,
+            "The cone limit of a spherical joint from the secondary joint axis (degrees)"
+        );
+
+    m.def(
+        "definePhysicsJoints",
+        &definePhysicsJoints,
+        arg("stage"),
+        arg("joints"),
+        R"(
+            Defines many physics joints on the stage in a single call.
+
+            This produces the same scene description as calling the corresponding ``definePhysics*Joint`` function for each element of ``joints``,
+            but it is considerably faster when defining the thousands of joints of a large articulation (e.g. a robot or cable), as the per-joint
+            overhead is amortized across the batch:
+
+                - The arguments of all joints are validated concurrently, prior to authoring any opinions.
+                - The local frames of all joints are computed concurrently, from a single ``WorldTransformCache``, so the world transforms of
+                  shared ancestors of the bodies are only computed once.
+                - All of the prims are defined within a single ``Sdf.ChangeBlock``, so the stage only recomposes once.
+                - All of the attributes and relationships are authored within a single ``Sdf.ChangeBlock``, so change notification is only sent once.
+
+            Success or failure is reported per joint. Any invalid joint is not defined, a runtime error is emitted describing the reason, and an
+            invalid ``UsdPhysics.Joint`` is returned at the corresponding index. All other joints are still defined.
+
+            Note:
+                The world transforms of the bodies are read before any joint is defined, so a joint must not be defined at, or above, the path of a
+                body.
+
+            Parameters:
+                - **stage** - The stage on which to define the joints
+                - **joints** - The descriptions of the joints to define
+
+            Returns:
+                A ``UsdPhysics.Joint`` for each element of ``joints``, in the same order. Any joint which could not be defined will be invalid.
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 } // namespace usdex::core::bindings
@@ -49,7 +49,8 @@ void bindPhysicsMaterialAlgo(module& m)
 
             Returns:
                 ``UsdShade.Material`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -78,7 +79,8 @@ void bindPhysicsMaterialAlgo(module& m)
 
             Returns:
                 ``UsdShade.Material`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -104,7 +106,8 @@ void bindPhysicsMaterialAlgo(module& m)
 
             Returns:
                 ``UsdShade.Material`` schema wrapping the defined ``Usd.Prim``.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -161,6 +164,95 @@ void bindPhysicsMaterialAlgo(module& m)
                 ``True`` if the material was successfully bound to the target prim, ``False`` otherwise.
         )"
     );
+
+    m.def(
+        "bindPhysicsMaterials",
+        &bindPhysicsMaterials,
+        arg("prims"),
+        arg("materials"),
+        R"(
+            Binds the corresponding physics material to each of many rigid bodies or collision geometry.
+
+            This produces the same bindings as calling ``bindPhysicsMaterial`` for each prim, but the ``UsdShade.MaterialBindingAPI`` and the
+            "physics" purpose binding relationships of all prims are authored directly on the edit target layer within a single
+            ``Sdf.ChangeBlock``, so the stage only processes one change regardless of the number of colliders.
+
+            Any invalid prim or material is skipped with a runtime error, and all other prims are still bound. If a prim appears more than once,
+            the last material is bound.
+
+            Note:
+                The bindings have the same "physics" purpose and "fallback strength" as ``bindPhysicsMaterial``.
+
+            Parameters:
+                - **prims** - The prims that the materials will affect. All of the prims must belong to the same stage.
+                - **materials** - The material to bind to each prim. This must be the same length as ``prims``.
+
+            Returns:
+                Whether every prim was bound.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<PhysicsMaterialRegistry>(
+        m,
+        "PhysicsMaterialRegistry",
+        R"(
+            Deduplicates equivalent physics materials, so each unique combination of physical properties is defined once and shared by every
+            collider which uses it.
+
+            The properties of each requested material are quantized using the tolerance of the registry. The first time a quantized combination
+            is seen a physics material is defined below the parent prim using ``definePhysicsMaterial()``, with the properties of that first
+            request. Every later request which quantizes to the same combination returns that same material, regardless of the requested name.
+
+            Note:
+                The registry is not thread safe. Properties which are not specified are only considered equivalent to other unspecified
+                properties. Values which are close to the boundary between two quantization steps may be assigned to different materials.
+
+            Parameters:
+                - **parent** - Prim below which to define the Materials (e.g. the "PhysicsMaterials" scope of an asset)
+                - **tolerance** - The quantization step of all physical properties. A tolerance of zero only shares materials whose properties
+                  are exactly equal. Negative or non-finite tolerances are treated as zero.
+        )"
+    )
+        .def(init<UsdPrim, float>(), arg("parent"), arg("tolerance") = 1e-4f)
+        .def(
+            "definePhysicsMaterial",
+            &PhysicsMaterialRegistry::definePhysicsMaterial,
+            arg("name"),
+            arg("dynamicFriction"),
+            arg("staticFriction") = nullptr,
+            arg("restitution") = nullptr,
+            arg("density") = nullptr,
+            R"(
+                Get the physics material for a combination of properties, defining it below the parent prim if no equivalent material has been
+                defined yet.
+
+                The name is only used when the material is first defined. It is made valid and unique among the materials of the registry, so
+                it does not need to be a valid identifier.
+
+                Parameters:
+                    - **name** - Name of the Material, if it is defined
+                    - **dynamicFriction** - The dynamic friction of the material
+                    - **staticFriction** - The static friction of the material
+                    - **restitution** - The restitution of the material
+                    - **density** - The density of the material
+
+                Returns:
+                    The material for the properties. Returns an invalid object on error.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def("getTolerance", &PhysicsMaterialRegistry::getTolerance, "Get the quantization step of all physical properties.")
+        .def(
+            "getUniqueMaterialCount",
+            &PhysicsMaterialRegistry::getUniqueMaterialCount,
+            "Get the number of unique materials which have been defined by the registry."
+        )
+        .def(
+            "getUseCount",
+            &PhysicsMaterialRegistry::getUseCount,
+            "Get the number of materials which have been requested from the registry, including those which were shared."
+        );
 }
 
 } // namespace usdex::core::bindings
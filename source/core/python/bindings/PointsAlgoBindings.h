@@ -9,6 +9,7 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -76,7 +77,8 @@ void bindPointsAlgo(module& m)
 
             Returns
                 ``UsdGeom.Points`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -115,7 +117,8 @@ void bindPointsAlgo(module& m)
 
             Returns
                 ``UsdGeom.Points`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -148,7 +151,292 @@ void bindPointsAlgo(module& m)
 
             Returns:
                 ``UsdGeom.Points`` schema wrapping the defined ``Usd.Prim``
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<TiledPointCloudWriter>(
+        m,
+        "TiledPointCloudWriter",
+        R"(
+            The ``TiledPointCloudWriter`` class authors a very large point cloud as a regular grid of ``UsdGeom.Points`` tiles.
+
+            A single ``UsdGeom.Points`` prim with hundreds of millions of points is impractical for most renderers and viewers, as it cannot be culled or
+            loaded incrementally. The writer instead defines a ``UsdGeom.Xform`` at the requested path and partitions the points spatially into child
+            ``UsdGeom.Points`` prims, each with its own extent, so that consumers can cull and load by tile.
+
+            Points can be supplied in any number of chunks (e.g. while streaming from a scan file). Each point is assigned to the tile containing it
+            and the ids and primvars are partitioned consistently with the points. Tiles are authored as soon as they reach ``maxPointsPerTile``,
+            so that memory is bounded while authoring. If a tile receives more points after it has been authored, the following points are authored
+            into an additional ``UsdGeom.Points`` prim for the same tile. Any remaining points are authored when ``finish()`` is called.
+
+            Tiles are named ``Tile_<x>_<y>_<z>`` based on their integer grid coordinate, with negative coordinates prefixed by ``n`` (e.g. ``Tile_n1_0_2``).
+            Additional prims for a tile append a numeric suffix (e.g. ``Tile_0_0_0_1``).
+
+            Each chunk is validated in the same manner as ``definePointCloud`` and invalid chunks are rejected entirely. The presence of ids and of each
+            primvar must be consistent across all chunks. Vertex primvars are authored as non-indexed vertex primvars on each tile. Constant primvars
+            remain constant on a tile, unless chunks with differing constant values contributed to it.
+
+            Warning:
+
+                A separate instance of this class should be used per-thread, calling methods from multiple threads is not safe.
         )"
+    )
+
+        .def(
+            ::init<UsdStagePtr, const SdfPath&, float, size_t>(),
+            arg("stage"),
+            arg("path"),
+            arg("tileSize"),
+            arg("maxPointsPerTile") = 1000000,
+            R"(
+                Construct a writer and define the ``UsdGeom.Xform`` which will parent the tiles.
+
+                If the location is invalid or the tile size is not positive, the writer will be invalid and no points can be added.
+
+                Args:
+                    stage: The stage on which to define the point cloud.
+                    path: The absolute prim path at which to define the parent xform.
+                    tileSize: The size of each cubic tile in the local space of the points.
+                    maxPointsPerTile: The number of points that will be buffered for a tile before it is authored.
+            )"
+        )
+
+        .def(
+            "isValid",
+            &TiledPointCloudWriter::isValid,
+            R"(
+                Whether the writer is able to accept points.
+
+                Returns:
+                    False if the parent xform could not be defined or ``finish()`` has been called.
+            )"
+        )
+
+        .def(
+            "getXform",
+            &TiledPointCloudWriter::getXform,
+            R"(
+                Get the ``UsdGeom.Xform`` which parents the tiles.
+
+                Returns:
+                    The parent xform, which is invalid if it could not be defined.
+            )"
+        )
+
+        .def(
+            "addPoints",
+            &TiledPointCloudWriter::addPoints,
+            arg("points"),
+            arg("ids") = nullptr,
+            arg("widths") = nullptr,
+            arg("normals") = nullptr,
+            arg("displayColor") = nullptr,
+            arg("displayOpacity") = nullptr,
+            R"(
+                Add a chunk of points to the point cloud.
+
+                Args:
+                    points: Vertex positions for the points described in the local space of the parent xform.
+                    ids: Values for the id specification for the points.
+                    widths: Values for the width specification for the points.
+                    normals: Values for the normals primvar for the points. Only Vertex normals are considered valid.
+                    displayColor: Values to be authored for the display color primvar.
+                    displayOpacity: Values to be authored for the display opacity primvar.
+
+                Returns:
+                    True if the chunk was valid and its points were added.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+
+        .def(
+            "finish",
+            &TiledPointCloudWriter::finish,
+            R"(
+                Author all remaining points and stop accepting new ones.
+
+                Returns:
+                    The ``UsdGeom.Points`` tiles authored by this writer, in the order in which they were authored.
+            )",
+            call_guard<gil_scoped_release>()
+        );
+
+    m.def(
+        "defineTiledPointCloud",
+        &defineTiledPointCloud,
+        arg("stage"),
+        arg("path"),
+        arg("tileSize"),
+        arg("points"),
+        arg("ids") = nullptr,
+        arg("widths") = nullptr,
+        arg("normals") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        arg("maxPointsPerTile") = 1000000,
+        R"(
+            Defines a point cloud as a regular grid of ``UsdGeom.Points`` tiles below a ``UsdGeom.Xform``.
+
+            This is a convenience for using a ``TiledPointCloudWriter`` with a single chunk of points. See ``TiledPointCloudWriter`` for details.
+
+            Args:
+                stage: The stage on which to define the point cloud.
+                path: The absolute prim path at which to define the parent xform.
+                tileSize: The size of each cubic tile in the local space of the points.
+                points: Vertex positions for the points described in local space.
+                ids: Values for the id specification for the points.
+                widths: Values for the width specification for the points.
+                normals: Values for the normals primvar for the points. Only Vertex normals are considered valid.
+                displayColor: Values to be authored for the display color primvar.
+                displayOpacity: Values to be authored for the display opacity primvar.
+                maxPointsPerTile: The maximum number of points authored on a single ``UsdGeom.Points`` tile.
+
+            Returns:
+                ``UsdGeom.Xform`` schema wrapping the defined ``Usd.Prim``. Returns an invalid schema on error.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "definePointInstancer",
+        overload_cast<
+            UsdStagePtr,
+            const SdfPath&,
+            const std::vector<UsdPrim>&,
+            const VtIntArray&,
+            const VtVec3fArray&,
+            std::optional<const VtQuathArray>,
+            std::optional<const VtVec3fArray>,
+            std::optional<const VtInt64Array>,
+            std::optional<const VtInt64Array>>(&definePointInstancer),
+        arg("stage"),
+        arg("path"),
+        arg("prototypes"),
+        arg("protoIndices"),
+        arg("positions"),
+        arg("orientations") = nullptr,
+        arg("scales") = nullptr,
+        arg("ids") = nullptr,
+        arg("invisibleIds") = nullptr,
+        R"(
+            Defines a ``UsdGeom.PointInstancer`` prim on the stage.
+
+            Attribute values will be validated and in the case of invalid data the PointInstancer will not be defined. An invalid
+            ``UsdGeom.PointInstancer`` object will be returned in this case.
+
+            Values will be authored for all attributes required to completely describe the PointInstancer, even if weaker matching opinions
+            already exist. Any of the optional attributes which are not provided are blocked.
+
+                - Prototypes
+                - Proto Indices
+                - Positions
+                - Orientations
+                - Scales
+                - Ids
+                - Invisible Ids
+                - Extent
+
+            The "extent" of the PointInstancer will be computed and authored based on the bounds of the prototypes and the transform of each
+            instance. The instances are bound in parallel, so this is considerably faster than ``UsdGeom.PointInstancer.ComputeExtentAtTime``
+            for large instancers.
+
+            The prototypes must already be defined on the stage, as their bounds are required to compute the extent. It is recommended that the
+            prototypes are defined beneath the PointInstancer, so that they are not imaged in their own right.
+
+            Args:
+                stage: The stage on which to define the point instancer.
+                path: The absolute prim path at which to define the point instancer.
+                prototypes: The prototype prims which will be instanced. The order of these prims determines the meaning of the ``protoIndices``.
+                protoIndices: The index of the prototype for each instance.
+                positions: The position of each instance, described in the local space of the point instancer.
+                orientations: The orientation of each instance.
+                scales: The scale of each instance.
+                ids: Values for the id specification for the instances. These should be unique.
+                invisibleIds: The ids (or the indices, if no ids are provided) of instances which should not be imaged.
+
+            Returns:
+                ``UsdGeom.PointInstancer`` schema wrapping the defined ``Usd.Prim``
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "definePointInstancer",
+        overload_cast<
+            UsdPrim,
+            const std::string&,
+            const std::vector<UsdPrim>&,
+            const VtIntArray&,
+            const VtVec3fArray&,
+            std::optional<const VtQuathArray>,
+            std::optional<const VtVec3fArray>,
+            std::optional<const VtInt64Array>,
+            std::optional<const VtInt64Array>>(&definePointInstancer),
+        arg("parent"),
+        arg("name"),
+        arg("prototypes"),
+        arg("protoIndices"),
+        arg("positions"),
+        arg("orientations") = nullptr,
+        arg("scales") = nullptr,
+        arg("ids") = nullptr,
+        arg("invisibleIds") = nullptr,
+        R"(
+            Defines a ``UsdGeom.PointInstancer`` prim on the stage.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+
+            Args:
+                parent: Prim below which to define the point instancer.
+                name: Name of the point instancer.
+                prototypes: The prototype prims which will be instanced. The order of these prims determines the meaning of the ``protoIndices``.
+                protoIndices: The index of the prototype for each instance.
+                positions: The position of each instance, described in the local space of the point instancer.
+                orientations: The orientation of each instance.
+                scales: The scale of each instance.
+                ids: Values for the id specification for the instances. These should be unique.
+                invisibleIds: The ids (or the indices, if no ids are provided) of instances which should not be imaged.
+
+            Returns:
+                ``UsdGeom.PointInstancer`` schema wrapping the defined ``Usd.Prim``
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "convertToPointInstancer",
+        &convertToPointInstancer,
+        arg("stage"),
+        arg("path"),
+        arg("prims"),
+        R"(
+            Convert prims which reference the same assets into a single ``UsdGeom.PointInstancer``.
+
+            Exporters often author repeated geometry as one referencing prim per copy (e.g. one prim per tree or bolt). Such scenes compose and
+            image far more slowly than a ``UsdGeom.PointInstancer`` with one array element per copy.
+
+            The prims are grouped by the references authored on their strongest prim spec which has references. A prototype is defined for each
+            group in a ``Prototypes`` scope beneath the point instancer, named after the first prim of the group and carrying the same references.
+            The world space transform of each prim is preserved by its instance, in the same order as the prims. Transforms which include shear can
+            not be represented by an instance, in which case a warning is emitted and the shear is discarded.
+
+            The prims are deactivated, rather than removed, so that the conversion can be reverted by removing the point instancer and reactivating
+            them. Any opinions authored on the prims other than their references and transform are not carried over to the instances.
+
+            Note:
+                The references are copied verbatim, so any relative asset paths must be valid relative to the layer of the current edit target.
+
+            Args:
+                stage: The stage on which to define the point instancer.
+                path: The absolute prim path at which to define the point instancer.
+                prims: The referencing prims to convert. Each must have at least one reference authored.
+
+            Returns:
+                ``UsdGeom.PointInstancer`` schema wrapping the defined ``Usd.Prim``. Returns an invalid schema on error, in which case no prims
+                are deactivated.
+        )",
+        call_guard<gil_scoped_release>()
     );
 }
 
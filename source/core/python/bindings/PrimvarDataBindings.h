@@ -9,6 +9,7 @@
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 
+#include <optional>
 #include <sstream>
 
 using namespace usdex::core;
@@ -327,6 +328,14 @@ void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::stri
     );
 }
 
+// The lifetime of a `ScopedPrimvarPrecision` is bound to the python context manager protocol, rather than to the python object
+struct PyScopedPrimvarPrecision
+{
+    PrimvarPrecision value;
+    std::optional<ScopedPrimvarPrecision> scope;
+    double maxError = 0.0;
+};
+
 } // namespace
 
 namespace usdex::core::bindings
@@ -360,6 +369,122 @@ void bindPrimvarData(module& m)
         "Vec3fPrimvarData",
         "``PrimvarData`` that holds ``Vt.Vec3fArray`` values (e.g normals, colors, or other vectors)."
     );
+
+    pybind11::enum_<PrimvarPrecision>(
+        m,
+        "PrimvarPrecision",
+        "Controls the precision of the floating point primvars authored by the ``define`` functions."
+    )
+        .value("eFloat", PrimvarPrecision::eFloat, "Author single precision values (e.g. ``normal3f[]``, ``texCoord2f[]``, ``float[]``).")
+        .value(
+            "eHalf",
+            PrimvarPrecision::eHalf,
+            "Author half precision values (e.g. ``normal3h[]``, ``texCoord2h[]``, ``half[]``) for primvars which do not have a fixed schema type."
+        );
+
+    m.def(
+        "getPrimvarPrecision",
+        &getPrimvarPrecision,
+        R"(
+            Get the ``PrimvarPrecision`` used by the ``define`` functions on the calling thread.
+
+            Returns:
+                The ``PrimvarPrecision`` of the calling thread. Defaults to ``PrimvarPrecision.eFloat``.
+        )"
+    );
+
+    m.def(
+        "setPrimvarPrecision",
+        &setPrimvarPrecision,
+        arg("value"),
+        R"(
+            Set the ``PrimvarPrecision`` used by the ``define`` functions on the calling thread.
+
+            When ``PrimvarPrecision.eHalf`` is selected, ``definePolyMesh`` authors half precision normals and uvs, and ``definePointCloud`` authors
+            half precision widths and normals. Display color and display opacity are always authored at single precision, as their types are fixed
+            by the ``UsdGeom.Gprim`` schema.
+
+            Half precision (16 bit) values halve the storage of these primvars, at the cost of roughly 3 significant decimal digits of precision and
+            a maximum magnitude of 65504.
+
+            Prefer ``ScopedPrimvarPrecision`` to ensure the previous precision is restored, and to measure the error introduced by the conversion.
+
+            Args:
+                value: The ``PrimvarPrecision`` for subsequent calls on the calling thread.
+        )"
+    );
+
+    ::class_<PyScopedPrimvarPrecision>(
+        m,
+        "ScopedPrimvarPrecision",
+        R"(
+            A context manager which selects a ``PrimvarPrecision`` on the calling thread for the duration of the context, and measures the error
+            introduced by converting values.
+
+            The previous precision is restored on exit, so contexts can be nested. The error measured by a context includes the error of any nested
+            contexts.
+
+            Example:
+
+                .. code-block:: python
+
+                    with usdex.core.ScopedPrimvarPrecision(usdex.core.PrimvarPrecision.eHalf) as precision:
+                        usdex.core.definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs)
+                    print(precision.getMaxError())
+
+            Args:
+                value: The ``PrimvarPrecision`` to select.
+        )"
+    )
+
+        .def(init(
+                 [](PrimvarPrecision value)
+                 {
+                     return PyScopedPrimvarPrecision{ value, std::nullopt, 0.0 };
+                 }
+             ),
+             arg("value"))
+
+        .def(
+            "__enter__",
+            [](PyScopedPrimvarPrecision& self) -> PyScopedPrimvarPrecision&
+            {
+                self.scope.emplace(self.value);
+                return self;
+            },
+            return_value_policy::reference
+        )
+
+        .def(
+            "__exit__",
+            [](PyScopedPrimvarPrecision& self, const object&, const object&, const object&)
+            {
+                if (self.scope.has_value())
+                {
+                    self.maxError = self.scope->getMaxError();
+                    self.scope.reset();
+                }
+                return false;
+            }
+        )
+
+        .def(
+            "getMaxError",
+            [](const PyScopedPrimvarPrecision& self)
+            {
+                return self.scope.has_value() ? self.scope->getMaxError() : self.maxError;
+            },
+            R"(
+                Get the largest absolute difference between any component of a value and its converted value, over all of the values converted by
+                ``PrimvarData.setPrimvar`` on the calling thread within the context.
+
+                NaN values are preserved by the conversion and do not contribute to the error. Values beyond the range of the lower precision type
+                become infinite, and report an infinite error.
+
+                Returns:
+                    The maximum error, or zero if no values have been converted.
+            )"
+        );
 }
 
 } // namespace usdex::core::bindings
@@ -9,6 +9,9 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <chrono>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -102,12 +105,151 @@ void bindStageAlgo(module& m)
 
             The comment will be authored in all layers as the SdfLayer comment.
 
+            The layers are independent of one another, so they are saved concurrently using a bounded number of worker threads. The layers
+            saved are the same as ``Usd.Stage.Save``, which excludes anonymous layers and the layers of the session layer stack.
+
             Args:
                 stage: The stage to be saved.
                 authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
                     If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
                 comment: The comment will be authored in all dirty layers as the ``Sdf.Layer`` comment.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "saveDirtyLayers",
+        &saveDirtyLayers,
+        arg("stage"),
+        arg("authoringMetadata") = nullptr,
+        arg("comment") = nullptr,
+        R"(
+            Save the given ``Usd.Stage`` with metadata applied to all dirty layers, reporting whether every layer was saved.
+
+            The layers are annotated and saved exactly as in ``saveStage``.
+
+            Args:
+                stage: The stage to be saved.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored in all dirty layers as the ``Sdf.Layer`` comment.
+
+            Returns:
+                False if any layer failed to save. A warning is issued for each layer that failed.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "exportInMemoryStage",
+        &exportInMemoryStage,
+        arg("stage"),
+        arg("authoringMetadata") = nullptr,
+        arg("comment") = nullptr,
+        R"(
+            Export the anonymous root layer of an in-memory ``Usd.Stage`` to the identifier it was created for.
+
+            The identifier and file format arguments are those given to ``createInMemoryStage`` (or more generally, the tag and file format
+            arguments of the anonymous root layer). The root layer is written exactly once, with the authoring metadata and comment applied as
+            in ``saveStage``.
+
+            Asset paths which were authored as absolute filesystem paths within the directory of the identifier are made relative to the
+            identifier before it is written, so that the exported layer can be relocated along with its dependencies. This modifies the
+            in-memory root layer.
+
+            Note:
+
+                Only the root layer is exported. Any other anonymous layers that the stage depends on must be exported separately.
+
+            Args:
+                stage: The in-memory stage to be exported.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists on the root layer, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored on the root layer as the ``Sdf.Layer`` comment.
+
+            Returns:
+                A bool indicating if the export was successful.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<std::shared_future<bool>>(
+        m,
+        "SaveStageFuture",
+        R"(
+            The pending result of ``saveStageAsync``.
+
+            The save completes regardless of whether this object is kept alive.
         )"
+    )
+
+        .def(
+            "done",
+            [](const std::shared_future<bool>& self)
+            {
+                return self.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            },
+            R"(
+                Returns:
+                    True if all of the layers have been written.
+            )"
+        )
+
+        .def(
+            "wait",
+            [](const std::shared_future<bool>& self)
+            {
+                self.wait();
+            },
+            call_guard<gil_scoped_release>(),
+            "Block until all of the layers have been written."
+        )
+
+        .def(
+            "result",
+            [](const std::shared_future<bool>& self)
+            {
+                return self.get();
+            },
+            call_guard<gil_scoped_release>(),
+            R"(
+                Block until all of the layers have been written.
+
+                Returns:
+                    False if any layer failed to write.
+            )"
+        );
+
+    m.def(
+        "saveStageAsync",
+        &saveStageAsync,
+        arg("stage"),
+        arg("authoringMetadata") = nullptr,
+        arg("comment") = nullptr,
+        R"(
+            Save the given ``Usd.Stage`` with metadata applied to all dirty layers, serializing the layers on a background thread.
+
+            The authoring metadata and comment are applied to the dirty layers exactly as in ``saveStage``. The content of each dirty layer is
+            then copied into an in-memory snapshot, and the snapshots are written to disk on worker threads. The stage may be edited as soon
+            as this function returns, and those edits do not affect the layers being written.
+
+            Unlike ``saveStage``, the layers on the stage remain dirty once the snapshots are written, as they may have been edited in the
+            meantime. A subsequent save will write them again.
+
+            Note:
+
+                Only one save of a given stage should be in flight at a time. Wait on the returned future before saving the stage again.
+
+            Args:
+                stage: The stage to be saved.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored in all dirty layers as the ``Sdf.Layer`` comment.
+
+            Returns:
+                A ``SaveStageFuture`` which completes once all of the layers have been written.
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -189,6 +331,66 @@ void bindStageAlgo(module& m)
 
         )"
     );
+
+    m.def(
+        "areEditablePrimLocations",
+        [](const UsdStagePtr stage, const SdfPathVector& paths)
+        {
+            std::vector<std::string> reasons;
+            std::vector<bool> results;
+            {
+                gil_scoped_release release;
+                results = areEditablePrimLocations(stage, paths, &reasons);
+            }
+            return pybind11::make_tuple(results, reasons);
+        },
+        arg("stage"),
+        arg("paths"),
+        R"(
+            Validate that prim opinions could be authored at each of many paths on the stage
+
+            Each path is validated exactly as by ``isEditablePrimLocation``. However, the parent of each path is only inspected once, so
+            validating many siblings does not look up the same parent prim repeatedly.
+
+            Parameters:
+                - **stage** - The stage to consider.
+                - **paths** - The absolute paths to consider.
+
+            Returns:
+                Tuple[List[bool], List[str]] with a bool per path indicating if the location is valid, and a string per path which is a non-empty
+                reason if the location is invalid.
+        )"
+    );
+
+    m.def(
+        "areEditablePrimLocations",
+        [](const UsdPrim prim, const std::vector<std::string>& names)
+        {
+            std::vector<std::string> reasons;
+            std::vector<bool> results;
+            {
+                gil_scoped_release release;
+                results = areEditablePrimLocations(prim, names, &reasons);
+            }
+            return pybind11::make_tuple(results, reasons);
+        },
+        arg("prim"),
+        arg("names"),
+        R"(
+            Validate that prim opinions could be authored for many child prims with the given names
+
+            Each name is validated exactly as by ``isEditablePrimLocation``. However, the parent prim is only validated once, and existing
+            children are only looked up when the parent is an instance.
+
+            Parameters:
+                - **prim** - The UsdPrim which would be the parent of the proposed locations.
+                - **names** - The names which would be used for the UsdPrims at the proposed locations.
+
+            Returns:
+                Tuple[List[bool], List[str]] with a bool per name indicating if the location is valid, and a string per name which is a non-empty
+                reason if the location is invalid.
+        )"
+    );
 }
 
 } // namespace usdex::core::bindings
@@ -20,6 +20,28 @@ using namespace pxr;
 namespace usdex::core::bindings
 {
 
+namespace
+{
+
+// Resolve the prim at each path, so that batch functions can be driven by paths rather than by a list of bound prims
+std::vector<UsdPrim> getPrimsAtPaths(const UsdStagePtr& stage, const SdfPathVector& paths)
+{
+    std::vector<UsdPrim> prims(paths.size());
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to get prims at %zu paths: the stage is invalid", paths.size());
+        return prims;
+    }
+
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        prims[i] = stage->GetPrimAtPath(paths[i]);
+    }
+    return prims;
+}
+
+} // namespace
+
 void bindXformAlgo(module& m)
 {
     pybind11::enum_<RotationOrder>(m, "RotationOrder", "Enumerates the rotation order of the 3-angle Euler rotation.")
@@ -126,6 +148,522 @@ void bindXformAlgo(module& m)
         call_guard<gil_scoped_acquire>()
     );
 
+    ::class_<KeyframeReduction>(
+        m,
+        "KeyframeReduction",
+        R"(
+            Opt-in reduction of redundant time samples for the ``setLocalTransform`` functions that author many times at once.
+
+            A sample is not authored if the stage reproduces its value within the tolerance by interpolating between the samples that are
+            authored, using the interpolation type of the stage. This drops samples which are constant, or which change linearly, across a range
+            of times. The samples at the first and last times are always authored. Each xformOp is reduced independently.
+
+            The tolerance is the largest difference allowed between the components of a sample and its interpolated value, in the units of each
+            component (e.g. distance for translations and matrix elements, degrees for rotations).
+
+            Note:
+
+                The times must be in increasing order for any samples to be reduced.
+        )"
+    )
+
+        .def(::init<double>(), arg("tolerance") = 1e-6)
+
+        .def_readwrite("tolerance", &KeyframeReduction::tolerance, "The largest difference allowed between a sample and its interpolated value.")
+
+        .def_readwrite(
+            "removedSamples",
+            &KeyframeReduction::removedSamples,
+            "The number of samples that were not authored. This accumulates over every call that uses this reduction."
+        );
+
+    m.def(
+        "setLocalTransform",
+        overload_cast<UsdPrim, const std::vector<UsdTimeCode>&, const std::vector<GfMatrix4d>&, KeyframeReduction*>(&setLocalTransform),
+        arg("prim"),
+        arg("times"),
+        arg("matrices"),
+        arg("reduction") = nullptr,
+        R"(
+            Set the local transform of a prim at many times from 4x4 matrices.
+
+            The result is identical to calling ``setLocalTransform`` once per time. However, the existing ``UsdGeom.XformOps`` are only inspected
+            once and all of the time samples are then authored directly within a single ``Sdf.ChangeBlock``.
+
+            Parameters:
+                - **prim** - The prim to set local transform on.
+                - **times** - The times at which to write the values. These must not be ``Usd.TimeCode.Default()``.
+                - **matrices** - The matrix value to set at each time. This must contain one value per time.
+                - **reduction** - Optionally drop redundant samples. See ``KeyframeReduction`` for details.
+
+            Returns:
+                True if the transform was set successfully. If the sizes of the lists do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransform",
+        overload_cast<UsdPrim, const std::vector<UsdTimeCode>&, const std::vector<GfTransform>&, KeyframeReduction*>(&setLocalTransform),
+        arg("prim"),
+        arg("times"),
+        arg("transforms"),
+        arg("reduction") = nullptr,
+        R"(
+            Set the local transform of a prim at many times.
+
+            The ``UsdGeom.XformOps`` are chosen once for all of the values. If any value requires the ``UsdGeom.XformCommonAPI`` to retain its pivot
+            position then all values are authored using it, otherwise a single transform xformOp is used. All of the time samples are authored
+            directly within a single ``Sdf.ChangeBlock``.
+
+            Parameters:
+                - **prim** - The prim to set local transform on.
+                - **times** - The times at which to write the values. These must not be ``Usd.TimeCode.Default()``.
+                - **transforms** - The transform value to set at each time. This must contain one value per time.
+                - **reduction** - Optionally drop redundant samples. See ``KeyframeReduction`` for details.
+
+            Returns:
+                True if the transform was set successfully. If the sizes of the lists do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransform",
+        overload_cast<
+            UsdPrim,
+            const std::vector<UsdTimeCode>&,
+            const std::vector<GfVec3d>&,
+            const std::vector<GfVec3d>&,
+            const std::vector<GfVec3f>&,
+            const RotationOrder,
+            const std::vector<GfVec3f>&,
+            KeyframeReduction*>(&setLocalTransform),
+        arg("prim"),
+        arg("times"),
+        arg("translations"),
+        arg("pivots"),
+        arg("rotations"),
+        arg("rotationOrder"),
+        arg("scales"),
+        arg("reduction") = nullptr,
+        R"(
+            Set the local transform of a prim at many times from common transform components.
+
+            The ``UsdGeom.XformOps`` are chosen once for all of the values. If no value has a pivot and the prim already has a single transform
+            xformOp then all values are authored as matrices, otherwise all values are authored using the ``UsdGeom.XformCommonAPI``. All of the
+            time samples are authored directly within a single ``Sdf.ChangeBlock``.
+
+            Parameters:
+                - **prim** - The prim to set local transform on.
+                - **times** - The times at which to write the values. These must not be ``Usd.TimeCode.Default()``.
+                - **translations** - The translation value to set at each time. This must contain one value per time.
+                - **pivots** - The pivot position value to set at each time. This must contain one value per time.
+                - **rotations** - The rotation value to set at each time in degrees. This must contain one value per time.
+                - **rotationOrder** - The rotation order of all of the rotation values.
+                - **scales** - The scale value to set at each time. This must contain one value per time.
+                - **reduction** - Optionally drop redundant samples. See ``KeyframeReduction`` for details.
+
+            Returns:
+                True if the transform was set successfully. If the sizes of the lists do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransform",
+        overload_cast<
+            UsdPrim,
+            const std::vector<UsdTimeCode>&,
+            const std::vector<GfVec3d>&,
+            const std::vector<GfQuatf>&,
+            const std::vector<GfVec3f>&,
+            KeyframeReduction*>(&setLocalTransform),
+        arg("prim"),
+        arg("times"),
+        arg("translations"),
+        arg("orientations"),
+        arg("scales"),
+        arg("reduction") = nullptr,
+        R"(
+            Set the local transform of a prim at many times from common transform components using quaternions for orientation.
+
+            The result is identical to calling ``setLocalTransform`` once per time. However, the translate, orient and scale ``UsdGeom.XformOps``
+            are only resolved once and all of the time samples are then authored directly within a single ``Sdf.ChangeBlock``.
+
+            Parameters:
+                - **prim** - The prim to set local transform on.
+                - **times** - The times at which to write the values. These must not be ``Usd.TimeCode.Default()``.
+                - **translations** - The translation value to set at each time. This must contain one value per time.
+                - **orientations** - The orientation value to set at each time as a quaternion. This must contain one value per time.
+                - **scales** - The scale value to set at each time. This must contain one value per time.
+                - **reduction** - Optionally drop redundant samples. See ``KeyframeReduction`` for details.
+
+            Returns:
+                True if the transform was set successfully. If the sizes of the lists do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransforms",
+        overload_cast<const std::vector<UsdPrim>&, const std::vector<GfTransform>&, UsdTimeCode>(&setLocalTransforms),
+        arg("prims"),
+        arg("transforms"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Set the local transforms of many prims with a single round of change processing.
+
+            The result is identical to calling ``setLocalTransform`` for each prim. However, the existing ``UsdGeom.XformOps`` of all prims are
+            inspected and the values to author are computed concurrently, before any opinions are authored. All opinions are then authored within a
+            single ``Sdf.ChangeBlock``, so the stage only processes the changes once.
+
+            Parameters:
+                - **prims** - The prims to set local transforms on.
+                - **transforms** - The transform value to set on each prim. This must contain one value per prim.
+                - **time** - Time at which to write the values.
+
+            Returns:
+                True if all of the local transforms were set. If the sizes of the lists do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransforms",
+        overload_cast<const std::vector<UsdPrim>&, const std::vector<GfMatrix4d>&, UsdTimeCode>(&setLocalTransforms),
+        arg("prims"),
+        arg("matrices"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Set the local transforms of many prims from 4x4 matrices with a single round of change processing.
+
+            The result is identical to calling ``setLocalTransform`` for each prim. However, the existing ``UsdGeom.XformOps`` of all prims are
+            inspected concurrently, before any opinions are authored. All opinions are then authored within a single ``Sdf.ChangeBlock``, so the
+            stage only processes the changes once.
+
+            Parameters:
+                - **prims** - The prims to set local transforms on.
+                - **matrices** - The matrix value to set on each prim. This must contain one value per prim.
+                - **time** - Time at which to write the values.
+
+            Returns:
+                True if all of the local transforms were set. If the sizes of the lists do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransforms",
+        overload_cast<
+            const std::vector<UsdPrim>&,
+            const std::vector<GfVec3d>&,
+            const std::vector<GfVec3d>&,
+            const std::vector<GfVec3f>&,
+            const RotationOrder,
+            const std::vector<GfVec3f>&,
+            UsdTimeCode>(&setLocalTransforms),
+        arg("prims"),
+        arg("translations"),
+        arg("pivots"),
+        arg("rotations"),
+        arg("rotationOrder"),
+        arg("scales"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Set the local transforms of many prims from common transform components with a single round of change processing.
+
+            The result is identical to calling ``setLocalTransform`` for each prim. However, the existing ``UsdGeom.XformOps`` of all prims are
+            inspected and the values to author are computed concurrently, before any opinions are authored. All opinions are then authored within a
+            single ``Sdf.ChangeBlock``, so the stage only processes the changes once.
+
+            Parameters:
+                - **prims** - The prims to set local transforms on.
+                - **translations** - The translation value to set on each prim. This must contain one value per prim.
+                - **pivots** - The pivot position value to set on each prim. This must contain one value per prim.
+                - **rotations** - The rotation value to set on each prim in degrees. This must contain one value per prim.
+                - **rotationOrder** - The rotation order of all of the rotation values.
+                - **scales** - The scale value to set on each prim. This must contain one value per prim.
+                - **time** - Time at which to write the values.
+
+            Returns:
+                True if all of the local transforms were set. If the sizes of the lists do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransforms",
+        [](UsdStagePtr stage, const SdfPathVector& paths, const VtMatrix4dArray& matrices, UsdTimeCode time)
+        {
+            const std::vector<UsdPrim> prims = getPrimsAtPaths(stage, paths);
+            return setLocalTransforms(prims, std::vector<GfMatrix4d>(matrices.cbegin(), matrices.cend()), time);
+        },
+        arg("stage"),
+        arg("paths"),
+        arg("matrices"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Set the local transforms of the prims at many paths from 4x4 matrices with a single round of change processing.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+            The matrices may be a ``Vt.Matrix4dArray`` or any object supporting the buffer protocol with shape ``(N, 4, 4)`` (e.g. a NumPy array),
+            which avoids constructing a ``Gf.Matrix4d`` per prim.
+
+            Parameters:
+                - **stage** - The stage on which to set the local transforms.
+                - **paths** - The paths of the prims to set local transforms on.
+                - **matrices** - The matrix value to set on each prim. This must contain one value per path.
+                - **time** - Time at which to write the values.
+
+            Returns:
+                True if all of the local transforms were set. If the sizes of the arrays do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransforms",
+        [](UsdStagePtr stage,
+           const SdfPathVector& paths,
+           const VtVec3dArray& translations,
+           const VtVec3dArray& pivots,
+           const VtVec3fArray& rotations,
+           const RotationOrder rotationOrder,
+           const VtVec3fArray& scales,
+           UsdTimeCode time)
+        {
+            const std::vector<UsdPrim> prims = getPrimsAtPaths(stage, paths);
+            return setLocalTransforms(
+                prims,
+                std::vector<GfVec3d>(translations.cbegin(), translations.cend()),
+                std::vector<GfVec3d>(pivots.cbegin(), pivots.cend()),
+                std::vector<GfVec3f>(rotations.cbegin(), rotations.cend()),
+                rotationOrder,
+                std::vector<GfVec3f>(scales.cbegin(), scales.cend()),
+                time
+            );
+        },
+        arg("stage"),
+        arg("paths"),
+        arg("translations"),
+        arg("pivots"),
+        arg("rotations"),
+        arg("rotationOrder"),
+        arg("scales"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Set the local transforms of the prims at many paths from common transform components with a single round of change processing.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+            Each component may be a ``Vt`` array or any object supporting the buffer protocol with shape ``(N, 3)`` (e.g. a NumPy array), which
+            avoids constructing a ``Gf`` vector per prim.
+
+            Parameters:
+                - **stage** - The stage on which to set the local transforms.
+                - **paths** - The paths of the prims to set local transforms on.
+                - **translations** - The translation value to set on each prim. This must contain one value per path.
+                - **pivots** - The pivot position value to set on each prim. This must contain one value per path.
+                - **rotations** - The rotation value to set on each prim in degrees. This must contain one value per path.
+                - **rotationOrder** - The rotation order of all of the rotation values.
+                - **scales** - The scale value to set on each prim. This must contain one value per path.
+                - **time** - Time at which to write the values.
+
+            Returns:
+                True if all of the local transforms were set. If the sizes of the arrays do not match then no opinions are authored.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<LocalTransformWriter>(
+        m,
+        "LocalTransformWriter",
+        R"(
+            Sets the local transform of a prim at many times, resolving the ``UsdGeom.XformOps`` of the prim only once.
+
+            The first value that is set resolves (and if necessary authors) the xformOps of the prim, exactly as the equivalent ``setLocalTransform``
+            function would. Subsequent values of the same format are written directly to the resolved xformOps. This skips the inspection of the
+            existing xformOps and the authoring of the ``xformOpOrder``, neither of which change between times, making it ideal for authoring
+            animation one frame at a time.
+
+            The xformOps are resolved again if the format of the value changes or if the edit target of the stage changes.
+
+            Warning:
+
+                The xformOps are not re-inspected once they have been resolved. If the xformOps of the prim are modified by other means, call
+                ``reset()`` before setting further values.
+        )"
+    )
+
+        .def(::init<UsdPrim>(), arg("prim"))
+
+        .def(
+            "getPrim",
+            &LocalTransformWriter::getPrim,
+            R"(
+                Get the prim on which local transforms are set.
+
+                Returns:
+                    The prim supplied on construction.
+            )"
+        )
+
+        .def(
+            "set",
+            overload_cast<const GfMatrix4d&, UsdTimeCode>(&LocalTransformWriter::set),
+            arg("matrix"),
+            arg("time") = UsdTimeCode::Default().GetValue(),
+            R"(
+                Set the local transform of the prim from a 4x4 matrix.
+
+                The result is identical to ``setLocalTransform(prim, matrix, time)``.
+
+                Parameters:
+                    - **matrix** - The matrix value to set.
+                    - **time** - Time at which to write the value.
+
+                Returns:
+                    A bool indicating if the local transform was set.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+
+        .def(
+            "set",
+            overload_cast<const GfVec3d&, const GfQuatf&, const GfVec3f&, UsdTimeCode>(&LocalTransformWriter::set),
+            arg("translation"),
+            arg("orientation"),
+            arg("scale") = GfVec3f(1.0f),
+            arg("time") = UsdTimeCode::Default().GetValue(),
+            R"(
+                Set the local transform of the prim from common transform components using a quaternion for orientation.
+
+                The result is identical to ``setLocalTransform(prim, translation, orientation, scale, time)``.
+
+                Parameters:
+                    - **translation** - The translation value to set.
+                    - **orientation** - The orientation value to set as a quaternion.
+                    - **scale** - The scale value to set - defaults to (1.0, 1.0, 1.0).
+                    - **time** - Time at which to write the values.
+
+                Returns:
+                    A bool indicating if the local transform was set.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+
+        .def(
+            "reset",
+            &LocalTransformWriter::reset,
+            R"(
+                Discard the resolved xformOps, so that they are inspected again when the next value is set.
+            )"
+        );
+
+    ::class_<WorldTransformCache>(
+        m,
+        "WorldTransformCache",
+        R"(
+            A thread-safe cache of world-space transforms for the prims of a stage at a given time.
+
+            The world transform of each prim is computed from its local transform and the world transform of its parent, exactly as
+            ``UsdGeom.Xformable.ComputeLocalToWorldTransform`` would, but the world transforms of all ancestors are cached and shared. Unlike a
+            ``UsdGeom.XformCache``, a single instance can be queried from many threads at once, so shared ancestors are only computed once.
+
+            The cache listens for changes to the stage and incrementally discards the cached transforms of any changed prims and their descendants.
+            All other cached transforms remain valid.
+
+            Note:
+
+                Prims that are not xformable have an identity local transform, so their world transform is that of their parent.
+        )"
+    )
+
+        .def(::init<UsdStagePtr, UsdTimeCode>(), arg("stage"), arg("time") = UsdTimeCode::Default().GetValue())
+
+        .def(
+            "getTime",
+            &WorldTransformCache::getTime,
+            R"(
+                Get the time at which transforms are computed.
+
+                Returns:
+                    The time supplied on construction or to ``setTime``.
+            )"
+        )
+
+        .def(
+            "setTime",
+            &WorldTransformCache::setTime,
+            arg("time"),
+            R"(
+                Set the time at which transforms are computed. If the time differs from the current time all cached transforms are discarded.
+
+                Parameters:
+                    - **time** - Time at which to compute the transforms.
+            )"
+        )
+
+        .def(
+            "getWorldTransform",
+            &WorldTransformCache::getWorldTransform,
+            arg("prim"),
+            R"(
+                Get the world transform of a prim.
+
+                Parameters:
+                    - **prim** - The prim to get the world transform of.
+
+                Returns:
+                    The local to world transform of the prim, or an identity matrix if the prim is invalid or belongs to another stage.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+
+        .def(
+            "getWorldTransforms",
+            &WorldTransformCache::getWorldTransforms,
+            arg("prims"),
+            R"(
+                Get the world transforms of many prims. The prims are evaluated concurrently.
+
+                Parameters:
+                    - **prims** - The prims to get the world transforms of.
+
+                Returns:
+                    The local to world transform of each prim, matching the order of the input prims.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+
+        .def(
+            "clear",
+            &WorldTransformCache::clear,
+            R"(
+                Discard all cached transforms.
+            )"
+        )
+
+        .def(
+            "size",
+            &WorldTransformCache::size,
+            R"(
+                Return the number of prims for which transforms are currently cached.
+
+                Returns:
+                    The number of cached transforms.
+            )"
+        );
+
     m.def(
         "getLocalTransform",
         overload_cast<const UsdPrim&, UsdTimeCode>(&getLocalTransform),
@@ -189,6 +727,243 @@ void bindXformAlgo(module& m)
         )"
     );
 
+    m.def(
+        "getLocalTransformMatrices",
+        overload_cast<const std::vector<UsdPrim>&, UsdTimeCode>(&getLocalTransformMatrices),
+        arg("prims"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Get the local transforms of many prims at a given time in the form of 4x4 matrices.
+
+            The result is identical to calling ``getLocalTransformMatrix`` for each prim, but the prims are evaluated concurrently.
+
+            Args:
+                prims: The prims to get local transforms from.
+                time: Time at which to query the values.
+
+            Returns:
+                The local transform matrix of each prim, matching the order of the input prims. Prims that are not xformable produce an identity
+                matrix.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "getLocalTransformComponents",
+        [](const std::vector<UsdPrim>& prims, UsdTimeCode time)
+        {
+            VtVec3dArray translations;
+            VtVec3dArray pivots;
+            VtVec3fArray rotations;
+            std::vector<RotationOrder> rotationOrders;
+            VtVec3fArray scales;
+            {
+                gil_scoped_release release;
+                getLocalTransformComponents(prims, translations, pivots, rotations, rotationOrders, scales, time);
+            }
+            return make_tuple(translations, pivots, rotations, rotationOrders, scales);
+        },
+        arg("prims"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Get the local transforms of many prims at a given time in the form of common transform components.
+
+            The result is identical to calling ``getLocalTransformComponents`` for each prim, but the prims are evaluated concurrently.
+
+            Args:
+                prims: The prims to get local transforms from.
+                time: Time at which to query the values.
+
+            Returns:
+                A tuple of translations, pivots, rotations, rotation orders and scales. Each contains one value per prim, matching
+                the order of the input prims.
+
+        )"
+    );
+
+    m.def(
+        "getLocalTransformMatrices",
+        overload_cast<const UsdPrimRange&, UsdTimeCode>(&getLocalTransformMatrices),
+        arg("range"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Get the local transforms of all prims in a range at a given time in the form of 4x4 matrices.
+
+            The result is identical to calling ``getLocalTransformMatrix`` for each prim, but the prims are evaluated concurrently.
+
+            Args:
+                range: The range of prims to get local transforms from.
+                time: Time at which to query the values.
+
+            Returns:
+                The local transform matrix of each prim, matching the traversal order of the range. Prims that are not xformable produce an identity
+                matrix.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "getLocalTransformComponents",
+        [](const UsdPrimRange& range, UsdTimeCode time)
+        {
+            VtVec3dArray translations;
+            VtVec3dArray pivots;
+            VtVec3fArray rotations;
+            std::vector<RotationOrder> rotationOrders;
+            VtVec3fArray scales;
+            {
+                gil_scoped_release release;
+                getLocalTransformComponents(range, translations, pivots, rotations, rotationOrders, scales, time);
+            }
+            return make_tuple(translations, pivots, rotations, rotationOrders, scales);
+        },
+        arg("range"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Get the local transforms of all prims in a range at a given time in the form of common transform components.
+
+            The result is identical to calling ``getLocalTransformComponents`` for each prim, but the prims are evaluated concurrently.
+
+            Args:
+                range: The range of prims to get local transforms from.
+                time: Time at which to query the values.
+
+            Returns:
+                A tuple of translations, pivots, rotations, rotation orders and scales. Each contains one value per prim, matching
+                the traversal order of the range.
+
+        )"
+    );
+
+    m.def(
+        "getLocalTransformMatrices",
+        [](UsdStagePtr stage, const SdfPathVector& paths, UsdTimeCode time)
+        {
+            return getLocalTransformMatrices(getPrimsAtPaths(stage, paths), time);
+        },
+        arg("stage"),
+        arg("paths"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Get the local transforms of the prims at many paths at a given time in the form of 4x4 matrices.
+
+            The result is identical to calling ``getLocalTransformMatrix`` for each prim, but the prims are evaluated concurrently. The result
+            supports the buffer protocol, so ``numpy.asarray(result)`` provides an array of shape ``(N, 4, 4)`` without copying.
+
+            Args:
+                stage: The stage from which to get the local transforms.
+                paths: The paths of the prims to get local transforms from.
+                time: Time at which to query the values.
+
+            Returns:
+                The local transform matrix of each prim, matching the order of the input paths. Paths which are not xformable prims produce an
+                identity matrix.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "getLocalTransformComponents",
+        [](UsdStagePtr stage, const SdfPathVector& paths, UsdTimeCode time)
+        {
+            VtVec3dArray translations;
+            VtVec3dArray pivots;
+            VtVec3fArray rotations;
+            std::vector<RotationOrder> rotationOrders;
+            VtVec3fArray scales;
+            {
+                gil_scoped_release release;
+                getLocalTransformComponents(getPrimsAtPaths(stage, paths), translations, pivots, rotations, rotationOrders, scales, time);
+            }
+            return make_tuple(translations, pivots, rotations, rotationOrders, scales);
+        },
+        arg("stage"),
+        arg("paths"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Get the local transforms of the prims at many paths at a given time in the form of common transform components.
+
+            The result is identical to calling ``getLocalTransformComponents`` for each prim, but the prims are evaluated concurrently. The
+            translations, pivots, rotations and scales support the buffer protocol, so ``numpy.asarray`` provides arrays of shape ``(N, 3)``
+            without copying.
+
+            Args:
+                stage: The stage from which to get the local transforms.
+                paths: The paths of the prims to get local transforms from.
+                time: Time at which to query the values.
+
+            Returns:
+                A tuple of translations, pivots, rotations, rotation orders and scales. Each contains one value per path, matching
+                the order of the input paths.
+
+        )"
+    );
+
+    m.def(
+        "computeTransformComponents",
+        [](const VtMatrix4dArray& matrices, const RotationOrder rotationOrder)
+        {
+            VtVec3dArray translations;
+            VtVec3dArray pivots;
+            VtVec3fArray rotations;
+            VtVec3fArray scales;
+            {
+                gil_scoped_release release;
+                computeTransformComponents(matrices, rotationOrder, translations, pivots, rotations, scales);
+            }
+            return make_tuple(translations, pivots, rotations, scales);
+        },
+        arg("matrices"),
+        arg("rotationOrder") = RotationOrder::eXyz,
+        R"(
+            Decompose many 4x4 matrices into common transform components.
+
+            Each result is identical to the components that ``getLocalTransformComponents`` produces for a prim with a single transform xformOp,
+            except that the rotation values are given in the requested rotation order. The matrices are decomposed concurrently.
+
+            Args:
+                matrices: The matrices to decompose.
+                rotationOrder: The rotation order of the rotation results.
+
+            Returns:
+                A tuple of translations, pivots, rotations and scales. Each contains one value per matrix. The pivots are always zero.
+
+        )"
+    );
+
+    m.def(
+        "computeTransformComponentsQuat",
+        [](const VtMatrix4dArray& matrices)
+        {
+            VtVec3dArray translations;
+            VtVec3dArray pivots;
+            VtQuatfArray orientations;
+            VtVec3fArray scales;
+            {
+                gil_scoped_release release;
+                computeTransformComponentsQuat(matrices, translations, pivots, orientations, scales);
+            }
+            return make_tuple(translations, pivots, orientations, scales);
+        },
+        arg("matrices"),
+        R"(
+            Decompose many 4x4 matrices into common transform components with quaternion orientation.
+
+            Each result is identical to the components that ``getLocalTransformComponentsQuat`` produces for a prim with a single transform
+            xformOp. The matrices are decomposed concurrently.
+
+            Args:
+                matrices: The matrices to decompose.
+
+            Returns:
+                A tuple of translations, pivots, orientations and scales. Each contains one value per matrix. The pivots are always zero.
+
+        )"
+    );
+
     m.def(
         "getLocalTransformComponentsQuat",
         [](const UsdPrim& prim, UsdTimeCode time)
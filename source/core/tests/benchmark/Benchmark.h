@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file Benchmark.h
+//! @brief A minimal harness to measure the throughput of OpenUSD Exchange SDK entry points.
+//!
+//! Each benchmark is a function which prepares its inputs, then calls `State::measure` exactly once with the work to be timed. The runner
+//! calls the function once to warm up, then once per repetition, and reports the median and minimum of the measured times. Inputs must be
+//! generated deterministically so that results are comparable between runs and between releases.
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace usdex::benchmark
+{
+
+//! The inputs and measurements of a single call to a benchmark function.
+class State
+{
+public:
+
+    explicit State(size_t size) : m_size(size), m_items(size), m_seconds(0.0)
+    {
+    }
+
+    //! The problem size requested by the runner (e.g. the number of points, prims or names).
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    //! Override the number of items processed by the measured work, if it differs from `size()`.
+    void setItemsProcessed(size_t items)
+    {
+        m_items = items;
+    }
+
+    size_t itemsProcessed() const
+    {
+        return m_items;
+    }
+
+    //! Time a single call to `fn`. Any work outside of `fn` is not measured.
+    template <typename Fn>
+    void measure(Fn&& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto end = std::chrono::steady_clock::now();
+        m_seconds += std::chrono::duration<double>(end - start).count();
+    }
+
+    double seconds() const
+    {
+        return m_seconds;
+    }
+
+private:
+
+    size_t m_size;
+    size_t m_items;
+    double m_seconds;
+};
+
+using BenchmarkFn = std::function<void(State&)>;
+
+//! A named benchmark function and the problem sizes at which it is measured.
+struct Benchmark
+{
+    std::string name;
+    BenchmarkFn fn;
+    std::vector<size_t> sizes;
+};
+
+//! The summarized measurements of one benchmark at one problem size.
+struct Result
+{
+    std::string name;
+    size_t size = 0;
+    size_t repetitions = 0;
+    size_t items = 0;
+    double medianSeconds = 0.0; //!< The median wall time of the measured work, in seconds.
+    double minSeconds = 0.0; //!< The fastest wall time of the measured work, in seconds.
+    double itemsPerSecond = 0.0; //!< The throughput of the median repetition.
+};
+
+//! Get all benchmarks registered by `USDEX_BENCHMARK`, in registration order.
+std::vector<Benchmark>& registry();
+
+//! Registers a benchmark during static initialization. Use `USDEX_BENCHMARK` rather than constructing this directly.
+struct Registrar
+{
+    Registrar(const char* name, BenchmarkFn fn, std::vector<size_t> sizes)
+    {
+        registry().push_back(Benchmark{ name, std::move(fn), std::move(sizes) });
+    }
+};
+
+//! Run a benchmark at one problem size, once to warm up and then the requested number of repetitions.
+Result run(const Benchmark& benchmark, size_t size, size_t repetitions);
+
+} // namespace usdex::benchmark
+
+#define USDEX_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define USDEX_BENCHMARK_CONCAT(a, b) USDEX_BENCHMARK_CONCAT_IMPL(a, b)
+
+//! Register `fn` as a benchmark called `name`, measured at each of the problem sizes that follow.
+#define USDEX_BENCHMARK(name, fn, ...) \
+    static const usdex::benchmark::Registrar USDEX_BENCHMARK_CONCAT(s_benchmarkRegistrar, __LINE__)(name, fn, { __VA_ARGS__ })
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+
+#include <usdex/core/CurvesAlgo.h>
+#include <usdex/core/MaterialAlgo.h>
+#include <usdex/core/MeshAlgo.h>
+#include <usdex/core/PointsAlgo.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+// A square grid of quads with at least `numFaces` faces
+struct Grid
+{
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    VtVec3fArray points;
+};
+
+Grid createGrid(size_t numFaces)
+{
+    const int width = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(numFaces)))));
+
+    Grid grid;
+    grid.points.reserve(static_cast<size_t>((width + 1) * (width + 1)));
+    for (int y = 0; y <= width; ++y)
+    {
+        for (int x = 0; x <= width; ++x)
+        {
+            grid.points.push_back(GfVec3f(static_cast<float>(x), static_cast<float>(y), 0.0f));
+        }
+    }
+
+    grid.faceVertexCounts.assign(static_cast<size_t>(width * width), 4);
+    grid.faceVertexIndices.reserve(static_cast<size_t>(width * width * 4));
+    for (int y = 0; y < width; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const int corner = y * (width + 1) + x;
+            grid.faceVertexIndices.push_back(corner);
+            grid.faceVertexIndices.push_back(corner + 1);
+            grid.faceVertexIndices.push_back(corner + width + 2);
+            grid.faceVertexIndices.push_back(corner + width + 1);
+        }
+    }
+    return grid;
+}
+
+VtVec3fArray createPoints(size_t numPoints)
+{
+    VtVec3fArray points(numPoints);
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        const float value = static_cast<float>(i);
+        points[i] = GfVec3f(value, std::sin(value), std::cos(value));
+    }
+    return points;
+}
+
+void definePolyMesh(State& state)
+{
+    const Grid grid = createGrid(state.size());
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    state.setItemsProcessed(grid.faceVertexCounts.size());
+
+    state.measure([&]() { usdex::core::definePolyMesh(stage, SdfPath("/Mesh"), grid.faceVertexCounts, grid.faceVertexIndices, grid.points); });
+}
+
+void definePolyMeshes(State& state)
+{
+    // Many small meshes, to measure the per-mesh overhead rather than the array authoring
+    const Grid grid = createGrid(16);
+    std::vector<usdex::core::PolyMeshDescription> meshes(state.size());
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        meshes[i].path = SdfPath(TfStringPrintf("/Meshes/Mesh_%zu", i));
+        meshes[i].faceVertexCounts = grid.faceVertexCounts;
+        meshes[i].faceVertexIndices = grid.faceVertexIndices;
+        meshes[i].points = grid.points;
+    }
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/Meshes"));
+
+    state.measure([&]() { usdex::core::definePolyMeshes(stage, meshes); });
+}
+
+void defineMaterialSubsets(State& state)
+{
+    // A mesh with one material id per face, assigning 100 materials in bands of 64 faces
+    static constexpr size_t s_numMaterials = 100;
+    const Grid grid = createGrid(state.size());
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdGeomMesh mesh = usdex::core::definePolyMesh(stage, SdfPath("/Mesh"), grid.faceVertexCounts, grid.faceVertexIndices, grid.points);
+    UsdPrim scope = stage->DefinePrim(SdfPath("/Materials"));
+    std::vector<UsdShadeMaterial> materials;
+    for (size_t i = 0; i < s_numMaterials; ++i)
+    {
+        materials.push_back(usdex::core::createMaterial(scope, TfStringPrintf("Material_%zu", i)));
+    }
+    VtIntArray faceMaterialIds(grid.faceVertexCounts.size());
+    for (size_t i = 0; i < faceMaterialIds.size(); ++i)
+    {
+        faceMaterialIds[i] = static_cast<int>((i / 64) % s_numMaterials);
+    }
+    state.setItemsProcessed(faceMaterialIds.size());
+
+    state.measure([&]() { usdex::core::defineMaterialSubsets(mesh, faceMaterialIds, materials); });
+}
+
+void definePointCloud(State& state)
+{
+    const VtVec3fArray points = createPoints(state.size());
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+
+    state.measure([&]() { usdex::core::definePointCloud(stage, SdfPath("/Points"), points); });
+}
+
+void defineLinearBasisCurves(State& state)
+{
+    // Curves of 10 vertices each, with one vertex per item
+    const VtVec3fArray points = createPoints(state.size() - state.size() % 10);
+    const VtIntArray curveVertexCounts(points.size() / 10, 10);
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    state.setItemsProcessed(points.size());
+
+    state.measure([&]() { usdex::core::defineLinearBasisCurves(stage, SdfPath("/Curves"), curveVertexCounts, points); });
+}
+
+} // namespace
+
+USDEX_BENCHMARK("definePolyMesh (faces)", definePolyMesh, 1000, 100000, 1000000);
+USDEX_BENCHMARK("definePolyMeshes (meshes)", definePolyMeshes, 100, 10000);
+USDEX_BENCHMARK("defineMaterialSubsets (faces)", defineMaterialSubsets, 100000, 1000000, 10000000);
+USDEX_BENCHMARK("definePointCloud (points)", definePointCloud, 1000, 100000, 1000000);
+USDEX_BENCHMARK("defineLinearBasisCurves (vertices)", defineLinearBasisCurves, 1000, 100000, 1000000);
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+
+#include <usdex/core/NameAlgo.h>
+#include <usdex/core/PrimvarData.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xform.h>
+
+#include <string>
+#include <vector>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+// Preferred names which repeat every 100 siblings, so that most names require a unique suffix
+std::vector<std::string> siblingNames(size_t count)
+{
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        names.push_back(TfStringPrintf("Part_%zu", i % 100));
+    }
+    return names;
+}
+
+// Preferred names which are not valid identifiers, so that every name must be encoded
+std::vector<std::string> invalidNames(size_t count)
+{
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        names.push_back(TfStringPrintf("%zu Part #%zu (copy)", i % 10, i));
+    }
+    return names;
+}
+
+void getValidChildNames(State& state)
+{
+    const std::vector<std::string> names = siblingNames(state.size());
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim parent = UsdGeomXform::Define(stage, SdfPath("/World")).GetPrim();
+
+    state.measure([&]() { usdex::core::getValidChildNames(parent, names); });
+}
+
+void nameCacheGetPrimNames(State& state)
+{
+    const std::vector<std::string> names = siblingNames(state.size());
+    const SdfPath parent("/World");
+
+    usdex::core::NameCache cache;
+    state.measure([&]() { cache.getPrimNames(parent, names); });
+}
+
+void getValidPrimNames(State& state)
+{
+    const std::vector<std::string> names = invalidNames(state.size());
+
+    state.measure([&]() { usdex::core::getValidPrimNames(names); });
+}
+
+void getDecodedNames(State& state)
+{
+    const TfTokenVector names = usdex::core::getValidPrimNames(invalidNames(state.size()));
+
+    state.measure([&]() { usdex::core::getDecodedNames(names); });
+}
+
+void primvarDataIndex(State& state)
+{
+    // 1000 unique values, each repeated many times, as is typical of faceVarying normals
+    VtVec3fArray values(state.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        const float value = static_cast<float>(i % 1000);
+        values[i] = GfVec3f(value, value * 0.5f, value * 0.25f);
+    }
+    usdex::core::Vec3fPrimvarData primvar(UsdGeomTokens->faceVarying, values);
+
+    state.measure([&]() { primvar.index(); });
+}
+
+} // namespace
+
+USDEX_BENCHMARK("getValidChildNames", getValidChildNames, 1000, 100000);
+USDEX_BENCHMARK("NameCache::getPrimNames", nameCacheGetPrimNames, 1000, 100000);
+USDEX_BENCHMARK("getValidPrimNames (encode)", getValidPrimNames, 1000, 100000);
+USDEX_BENCHMARK("getDecodedNames (decode)", getDecodedNames, 1000, 100000);
+USDEX_BENCHMARK("Vec3fPrimvarData::index", primvarDataIndex, 10000, 1000000);
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+
+#include <usdex/test/FilesystemUtils.h>
+#include <usdex/test/SceneGenerator.h>
+
+#include <usdex/core/AssetStructure.h>
+#include <usdex/core/MaterialAlgo.h>
+#include <usdex/core/MeshAlgo.h>
+#include <usdex/core/StageAlgo.h>
+#include <usdex/core/XformAlgo.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/kind/registry.h>
+#include <pxr/usd/usd/modelAPI.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <algorithm>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+void setLocalTransforms(State& state)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    std::vector<UsdPrim> prims;
+    std::vector<GfMatrix4d> matrices;
+    prims.reserve(state.size());
+    matrices.reserve(state.size());
+    for (size_t i = 0; i < state.size(); ++i)
+    {
+        prims.push_back(usdex::core::defineXform(stage, SdfPath(TfStringPrintf("/Xform_%zu", i))).GetPrim());
+        matrices.push_back(GfMatrix4d(1.0).SetTranslateOnly(GfVec3d(static_cast<double>(i), 0.0, 0.0)));
+    }
+
+    state.measure([&]() { usdex::core::setLocalTransforms(prims, matrices); });
+}
+
+void definePreviewMaterial(State& state)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/Materials"));
+    std::vector<SdfPath> paths;
+    paths.reserve(state.size());
+    for (size_t i = 0; i < state.size(); ++i)
+    {
+        paths.push_back(SdfPath(TfStringPrintf("/Materials/Material_%zu", i)));
+    }
+
+    state.measure(
+        [&]()
+        {
+            for (size_t i = 0; i < paths.size(); ++i)
+            {
+                const float value = static_cast<float>(i % 100) / 100.0f;
+                usdex::core::definePreviewMaterial(stage, paths[i], GfVec3f(value, 0.5f, 1.0f - value));
+            }
+        }
+    );
+}
+
+void saveStage(State& state)
+{
+    // A stage of 1000 unique meshes, each with one face per item
+    static constexpr size_t s_numMeshes = 1000;
+    const size_t facesPerMesh = std::max<size_t>(state.size() / s_numMeshes, 1);
+    VtIntArray faceVertexCounts(facesPerMesh, 3);
+    VtIntArray faceVertexIndices(facesPerMesh * 3);
+    VtVec3fArray points(facesPerMesh * 3);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        faceVertexIndices[i] = static_cast<int>(i);
+        points[i] = GfVec3f(static_cast<float>(i), static_cast<float>(i % 3), 0.0f);
+    }
+
+    usdex::test::ScopedTmpDir tmpDir;
+    const std::string identifier = TfStringPrintf("%s/%s", tmpDir.getPath(), "benchmark.usdc");
+    UsdStageRefPtr stage = usdex::core::createStage(identifier, "World", UsdGeomTokens->z, 0.01, "benchmark_usdex_core");
+    for (size_t i = 0; i < s_numMeshes; ++i)
+    {
+        points[0][2] = static_cast<float>(i);
+        usdex::core::definePolyMesh(stage, SdfPath(TfStringPrintf("/World/Mesh_%zu", i)), faceVertexCounts, faceVertexIndices, points);
+    }
+    state.setItemsProcessed(facesPerMesh * s_numMeshes);
+
+    state.measure([&]() { usdex::core::saveStage(stage); });
+}
+
+void generateScene(State& state)
+{
+    // A production like mix of content, scaled by the number of meshes
+    usdex::test::SceneGeneratorOptions options;
+    options.seed = 1;
+    options.hierarchyDepth = 3;
+    options.hierarchyWidth = 8;
+    options.meshCount = state.size();
+    options.verticesPerMesh = 256;
+    options.groomCount = state.size() / 100;
+    options.pointCloudCount = state.size() / 100;
+    options.materialCount = std::max<size_t>(state.size() / 10, 1);
+    options.nameCollisionRate = 0.1;
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim root = usdex::core::defineXform(stage, SdfPath("/World")).GetPrim();
+
+    state.measure([&]() { usdex::test::generateScene(root, options); });
+}
+
+void authorExtentsHints(State& state)
+{
+    // The leaves of a generated hierarchy are components within a hierarchy of groups, so there is one model per leaf and per group
+    usdex::test::SceneGeneratorOptions options;
+    options.seed = 1;
+    options.hierarchyDepth = 3;
+    options.hierarchyWidth = 8;
+    options.meshCount = state.size();
+    options.verticesPerMesh = 64;
+    options.materialCount = 0;
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim root = usdex::core::defineXform(stage, SdfPath("/World")).GetPrim();
+    UsdModelAPI(root).SetKind(KindTokens->assembly);
+    for (const UsdPrim& prim : usdex::test::generateScene(root, options))
+    {
+        UsdModelAPI(prim.GetParent()).SetKind(KindTokens->component);
+        for (UsdPrim group = prim.GetParent().GetParent(); group != root; group = group.GetParent())
+        {
+            UsdModelAPI(group).SetKind(KindTokens->group);
+        }
+    }
+
+    state.measure([&]() { usdex::core::authorExtentsHints(root); });
+}
+
+} // namespace
+
+USDEX_BENCHMARK("setLocalTransforms (prims)", setLocalTransforms, 1000, 100000);
+USDEX_BENCHMARK("definePreviewMaterial (materials)", definePreviewMaterial, 100, 1000);
+USDEX_BENCHMARK("saveStage (faces)", saveStage, 100000, 1000000);
+USDEX_BENCHMARK("generateScene (meshes)", generateScene, 100, 1000);
+USDEX_BENCHMARK("authorExtentsHints (meshes)", authorExtentsHints, 1000, 10000);
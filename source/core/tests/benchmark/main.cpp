@@ -0,0 +1,267 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+
+#include <usdex/core/Core.h>
+#include <usdex/core/Diagnostics.h>
+
+#include <pxr/pxr.h>
+
+#include <cxxopts.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace usdex::benchmark
+{
+
+std::vector<Benchmark>& registry()
+{
+    static std::vector<Benchmark> s_registry;
+    return s_registry;
+}
+
+Result run(const Benchmark& benchmark, size_t size, size_t repetitions)
+{
+    // The first call populates caches (e.g. schema registries & plugin discovery) and is not reported
+    {
+        State warmup(size);
+        benchmark.fn(warmup);
+    }
+
+    Result result;
+    result.name = benchmark.name;
+    result.size = size;
+    result.repetitions = std::max<size_t>(repetitions, 1);
+
+    std::vector<double> seconds;
+    seconds.reserve(result.repetitions);
+    for (size_t i = 0; i < result.repetitions; ++i)
+    {
+        State state(size);
+        benchmark.fn(state);
+        seconds.push_back(state.seconds());
+        result.items = state.itemsProcessed();
+    }
+
+    std::sort(seconds.begin(), seconds.end());
+    result.medianSeconds = seconds[seconds.size() / 2];
+    result.minSeconds = seconds.front();
+    result.itemsPerSecond = result.medianSeconds > 0.0 ? static_cast<double>(result.items) / result.medianSeconds : 0.0;
+    return result;
+}
+
+} // namespace usdex::benchmark
+
+namespace
+{
+
+// The one-time startup cost of the library, which is reported as a benchmark of its own
+static constexpr const char* s_initializeName = "initialize (cold start)";
+
+usdex::benchmark::Result measureInitialize()
+{
+    // The cost can only be measured once per process, so it is a single repetition without a warmup
+    usdex::benchmark::State state(1);
+    state.measure([]() { usdex::core::initialize(); });
+
+    usdex::benchmark::Result result;
+    result.name = s_initializeName;
+    result.size = 1;
+    result.repetitions = 1;
+    result.items = state.itemsProcessed();
+    result.medianSeconds = state.seconds();
+    result.minSeconds = state.seconds();
+    result.itemsPerSecond = result.medianSeconds > 0.0 ? static_cast<double>(result.items) / result.medianSeconds : 0.0;
+    return result;
+}
+
+std::string jsonString(const std::string& value)
+{
+    std::string result = "\"";
+    for (const char c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
+void writeText(std::ostream& out, const std::vector<usdex::benchmark::Result>& results)
+{
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-40s %10s %14s %14s %16s\n", "benchmark", "size", "median (ms)", "min (ms)", "items/s");
+    out << line;
+    for (const usdex::benchmark::Result& result : results)
+    {
+        std::snprintf(
+            line,
+            sizeof(line),
+            "%-40s %10zu %14.3f %14.3f %16.0f\n",
+            result.name.c_str(),
+            result.size,
+            result.medianSeconds * 1000.0,
+            result.minSeconds * 1000.0,
+            result.itemsPerSecond
+        );
+        out << line;
+    }
+}
+
+void writeCsv(std::ostream& out, const std::vector<usdex::benchmark::Result>& results)
+{
+    out << "name,size,repetitions,items,median_seconds,min_seconds,items_per_second\n";
+    for (const usdex::benchmark::Result& result : results)
+    {
+        out << result.name << "," << result.size << "," << result.repetitions << "," << result.items << "," << result.medianSeconds << ","
+            << result.minSeconds << "," << result.itemsPerSecond << "\n";
+    }
+}
+
+void writeJson(std::ostream& out, const std::vector<usdex::benchmark::Result>& results)
+{
+    out << "{\n";
+    out << "  \"context\": {\n";
+    out << "    \"usdex_version\": " << jsonString(usdex::core::buildVersion()) << ",\n";
+    out << "    \"usd_version\": " << PXR_VERSION << "\n";
+    out << "  },\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const usdex::benchmark::Result& result = results[i];
+        out << (i ? ",\n" : "\n");
+        out << "    {\"name\": " << jsonString(result.name) << ", \"size\": " << result.size << ", \"repetitions\": " << result.repetitions
+            << ", \"items\": " << result.items << ", \"median_seconds\": " << result.medianSeconds << ", \"min_seconds\": " << result.minSeconds
+            << ", \"items_per_second\": " << result.itemsPerSecond << "}";
+    }
+    out << "\n  ]\n";
+    out << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    cxxopts::Options options("benchmark_usdex_core", "Measure the throughput of OpenUSD Exchange SDK authoring functions");
+    // clang-format off
+    options.add_options()
+        ("f,filter", "Only run the benchmarks whose name contains this string", cxxopts::value<std::string>()->default_value(""))
+        ("r,repetitions", "The number of measured repetitions at each size", cxxopts::value<size_t>()->default_value("5"))
+        ("format", "The output format: text, json, or csv", cxxopts::value<std::string>()->default_value("text"))
+        ("o,output", "Write the results to this file rather than stdout", cxxopts::value<std::string>()->default_value(""))
+        ("l,list", "List the benchmarks and their sizes without running them")
+        ("h,help", "Print usage");
+    // clang-format on
+
+    std::string filter;
+    std::string format;
+    std::string output;
+    size_t repetitions = 0;
+    bool list = false;
+    try
+    {
+        cxxopts::ParseResult args = options.parse(argc, argv);
+        if (args.count("help"))
+        {
+            std::cout << options.help() << std::endl;
+            return 0;
+        }
+        filter = args["filter"].as<std::string>();
+        format = args["format"].as<std::string>();
+        output = args["output"].as<std::string>();
+        repetitions = args["repetitions"].as<size_t>();
+        list = args.count("list") > 0;
+    }
+    catch (const cxxopts::OptionException& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    if (format != "text" && format != "json" && format != "csv")
+    {
+        std::cerr << "Unsupported format \"" << format << "\". Use one of text, json, or csv." << std::endl;
+        return 1;
+    }
+
+    // activate the delegate to affect OpenUSD diagnostic logs, only errors are of interest while measuring
+    usdex::core::activateDiagnosticsDelegate();
+    usdex::core::setDiagnosticsLevel(usdex::core::DiagnosticsLevel::eError);
+
+    std::vector<usdex::benchmark::Result> results;
+
+    // The startup cost is measured before any benchmark populates the registries
+    if (filter.empty() || std::string(s_initializeName).find(filter) != std::string::npos)
+    {
+        if (list)
+        {
+            std::cout << s_initializeName << " 1" << std::endl;
+        }
+        else
+        {
+            std::cerr << "Running " << s_initializeName << std::endl;
+            results.push_back(measureInitialize());
+        }
+    }
+
+    for (const usdex::benchmark::Benchmark& benchmark : usdex::benchmark::registry())
+    {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        for (size_t size : benchmark.sizes)
+        {
+            if (list)
+            {
+                std::cout << benchmark.name << " " << size << std::endl;
+                continue;
+            }
+
+            // report progress on stderr so that stdout only contains the results
+            std::cerr << "Running " << benchmark.name << " at size " << size << std::endl;
+            results.push_back(usdex::benchmark::run(benchmark, size, repetitions));
+        }
+    }
+
+    if (list)
+    {
+        return 0;
+    }
+
+    std::ofstream file;
+    if (!output.empty())
+    {
+        file.open(output);
+        if (!file)
+        {
+            std::cerr << "Unable to open \"" << output << "\" for writing" << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = output.empty() ? std::cout : file;
+
+    if (format == "json")
+    {
+        writeJson(out, results);
+    }
+    else if (format == "csv")
+    {
+        writeCsv(out, results);
+    }
+    else
+    {
+        writeText(out, results);
+    }
+
+    return 0;
+}
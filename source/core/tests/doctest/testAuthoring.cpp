@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/test/ScopedDiagnosticChecker.h>
+
+#include <usdex/core/Authoring.h>
+#include <usdex/core/LayerAlgo.h>
+#include <usdex/core/StageAlgo.h>
+#include <usdex/core/XformAlgo.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/metrics.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <doctest/doctest.h>
+
+#include <string>
+#include <vector>
+
+using namespace usdex::test;
+using namespace pxr;
+
+namespace
+{
+
+static constexpr size_t s_numWorkers = 8;
+static constexpr size_t s_numChildren = 100;
+
+UsdStageRefPtr createStage()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    usdex::core::configureStage(stage, "World", UsdGeomTokens->y, UsdGeomLinearUnits::centimeters, "usdex cpp tests");
+    usdex::core::defineXform(stage, SdfPath("/World"));
+    return stage;
+}
+
+} // namespace
+
+TEST_CASE("authorLayersConcurrently authors each layer on its own stage")
+{
+    UsdStageRefPtr stage = createStage();
+    const std::string expected = [&stage]()
+    {
+        std::string result;
+        stage->GetRootLayer()->ExportToString(&result);
+        return result;
+    }();
+
+    std::vector<usdex::core::LayerAuthoringFn> workers;
+    for (size_t i = 0; i < s_numWorkers; ++i)
+    {
+        workers.push_back(
+            [i](usdex::core::AuthoringSession& session)
+            {
+                if (!session.isActive() || session.getUpAxis() != UsdGeomTokens->y)
+                {
+                    return false;
+                }
+
+                // The existing prims of the stage are visible to the worker
+                UsdPrim world = session.getStage()->GetDefaultPrim();
+                if (!world)
+                {
+                    return false;
+                }
+                UsdPrim group = usdex::core::defineXform(world, TfStringPrintf("Group_%zu", i)).GetPrim();
+                for (size_t child = 0; child < s_numChildren; ++child)
+                {
+                    const TfToken name = session.getEditableChildName(group, "Child");
+                    if (!usdex::core::defineXform(group, name))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        );
+    }
+
+    std::vector<SdfLayerRefPtr> layers;
+    {
+        ScopedDiagnosticChecker check;
+        layers = usdex::core::authorLayersConcurrently(stage, workers);
+    }
+    REQUIRE(layers.size() == s_numWorkers);
+
+    // The stage is not modified
+    std::string actual;
+    stage->GetRootLayer()->ExportToString(&actual);
+    CHECK(actual == expected);
+
+    for (size_t i = 0; i < s_numWorkers; ++i)
+    {
+        REQUIRE(layers[i]);
+        CHECK(layers[i]->GetSubLayerPaths().empty());
+        CHECK(layers[i]->GetDefaultPrim() == TfToken("World"));
+        CHECK(layers[i]->GetPrimAtPath(SdfPath("/World"))->GetSpecifier() == SdfSpecifierOver);
+        const SdfPath groupPath = SdfPath("/World").AppendChild(TfToken(TfStringPrintf("Group_%zu", i)));
+        CHECK(layers[i]->GetPrimAtPath(groupPath));
+        CHECK(layers[i]->GetPrimAtPath(groupPath.AppendChild(TfToken(TfStringPrintf("Child_%zu", s_numChildren - 1)))));
+    }
+
+    // The layers can be merged into the stage without conflicts
+    const std::vector<SdfLayerHandle> sources(layers.begin(), layers.end());
+    std::vector<usdex::core::LayerMergeConflict> conflicts;
+    CHECK(usdex::core::mergeLayers(stage->GetRootLayer(), sources, &conflicts));
+    CHECK(conflicts.empty());
+    CHECK(stage->GetPrimAtPath(SdfPath("/World"))->GetSpecifier() == SdfSpecifierDef);
+    for (size_t i = 0; i < s_numWorkers; ++i)
+    {
+        UsdPrim group = stage->GetPrimAtPath(SdfPath(TfStringPrintf("/World/Group_%zu", i)));
+        REQUIRE(group);
+        CHECK(group.GetChildren().size() == s_numChildren);
+    }
+}
+
+TEST_CASE("authorLayersConcurrently reports failed workers in order")
+{
+    UsdStageRefPtr stage = createStage();
+    std::vector<usdex::core::LayerAuthoringFn> workers = {
+        [](usdex::core::AuthoringSession&)
+        {
+            return true;
+        },
+        [](usdex::core::AuthoringSession&)
+        {
+            return false;
+        },
+        nullptr,
+    };
+
+    std::vector<SdfLayerRefPtr> layers;
+    {
+        ScopedDiagnosticChecker check(
+            { { TF_DIAGNOSTIC_WARNING_TYPE, ".*Unable to author layer 1.*" }, { TF_DIAGNOSTIC_WARNING_TYPE, ".*Unable to author layer 2.*" } }
+        );
+        layers = usdex::core::authorLayersConcurrently(stage, workers);
+    }
+    REQUIRE(layers.size() == 3);
+    CHECK(layers[0]);
+    CHECK(!layers[1]);
+    CHECK(!layers[2]);
+}
+
+TEST_CASE("authorLayersConcurrently applies the ValidationPolicy of the calling thread")
+{
+    UsdStageRefPtr stage = createStage();
+    CHECK(usdex::core::getValidationPolicy() == usdex::core::ValidationPolicy::eFull);
+
+    std::vector<usdex::core::LayerAuthoringFn> workers(
+        s_numWorkers,
+        [](usdex::core::AuthoringSession&)
+        {
+            return usdex::core::getValidationPolicy() == usdex::core::ValidationPolicy::eTrusted;
+        }
+    );
+
+    std::vector<SdfLayerRefPtr> layers;
+    {
+        usdex::core::ScopedValidationPolicy policy(usdex::core::ValidationPolicy::eTrusted);
+        ScopedDiagnosticChecker check;
+        layers = usdex::core::authorLayersConcurrently(stage, workers);
+    }
+    REQUIRE(layers.size() == s_numWorkers);
+    for (const SdfLayerRefPtr& layer : layers)
+    {
+        CHECK(layer);
+    }
+
+    // The previous policy is restored
+    CHECK(usdex::core::getValidationPolicy() == usdex::core::ValidationPolicy::eFull);
+}
+
+TEST_CASE("mergeLayers reports conflicting opinions")
+{
+    SdfLayerRefPtr target = SdfLayer::CreateAnonymous();
+    SdfPrimSpecHandle prim = SdfCreatePrimInLayer(target, SdfPath("/World"));
+    prim->SetSpecifier(SdfSpecifierDef);
+    prim->SetTypeName("Xform");
+
+    SdfLayerRefPtr first = SdfLayer::CreateAnonymous();
+    SdfCreatePrimInLayer(first, SdfPath("/World/First"))->SetSpecifier(SdfSpecifierDef);
+    SdfCreatePrimInLayer(first, SdfPath("/World"))->SetKind(TfToken("component"));
+
+    SdfLayerRefPtr second = SdfLayer::CreateAnonymous();
+    SdfCreatePrimInLayer(second, SdfPath("/World/Second"))->SetSpecifier(SdfSpecifierDef);
+    SdfCreatePrimInLayer(second, SdfPath("/World"))->SetKind(TfToken("assembly"));
+
+    std::vector<usdex::core::LayerMergeConflict> conflicts;
+    {
+        ScopedDiagnosticChecker check({ { TF_DIAGNOSTIC_WARNING_TYPE, ".*Unable to merge 1 opinions.*" } });
+        CHECK(!usdex::core::mergeLayers(target, { first, second }, &conflicts));
+    }
+
+    // The earlier source is stronger, and every new spec is merged regardless of the conflict
+    CHECK(prim->GetKind() == TfToken("component"));
+    CHECK(prim->GetSpecifier() == SdfSpecifierDef);
+    CHECK(target->GetPrimAtPath(SdfPath("/World/First")));
+    CHECK(target->GetPrimAtPath(SdfPath("/World/Second")));
+    REQUIRE(conflicts.size() == 1);
+    CHECK(conflicts[0].path == SdfPath("/World"));
+    CHECK(conflicts[0].field == SdfFieldKeys->Kind);
+    CHECK(conflicts[0].sourceIdentifier == second->GetIdentifier());
+}
@@ -6,6 +6,9 @@
 #include <usdex/core/Feature.h>
 #include <usdex/core/Version.h>
 
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
 #include <doctest/doctest.h>
 
 #include <string>
@@ -16,3 +19,18 @@ TEST_CASE("Version and Features")
     CHECK(std::string(usdex::core::buildVersion()) == USDEX_BUILD_STRING);
     CHECK(usdex::core::withPython() == USDEX_WITH_PYTHON);
 }
+
+TEST_CASE("initialize")
+{
+    // Initialization may continue in the background, and waiting for it later completes it
+    usdex::core::initialize(/* wait */ false);
+    usdex::core::initialize();
+    CHECK(usdex::core::isInitialized());
+
+    // The schemas authored by usdex are registered
+    CHECK(pxr::UsdSchemaRegistry::GetInstance().FindConcretePrimDefinition(pxr::UsdSchemaRegistry::GetSchemaTypeName<pxr::UsdGeomMesh>()));
+
+    // Repeated calls are cheap and have no effect
+    usdex::core::initialize();
+    CHECK(usdex::core::isInitialized());
+}
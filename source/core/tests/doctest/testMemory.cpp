@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/test/MemoryTracker.h>
+
+#include <usdex/core/MeshAlgo.h>
+#include <usdex/core/PointsAlgo.h>
+
+#include <pxr/usd/usd/stage.h>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+using namespace usdex::test;
+using namespace pxr;
+
+// The tracking allocator observes every allocation of the test executable
+USDEX_TEST_DEFINE_TRACKING_ALLOCATOR();
+
+namespace
+{
+
+static constexpr size_t s_numPoints = 1000000;
+
+VtVec3fArray createPoints()
+{
+    VtVec3fArray points(s_numPoints);
+    for (size_t i = 0; i < s_numPoints; ++i)
+    {
+        points[i] = GfVec3f(static_cast<float>(i), 0.0f, 0.0f);
+    }
+    return points;
+}
+
+} // namespace
+
+TEST_CASE("ScopedMemoryTracker measures transient allocations")
+{
+    REQUIRE(ScopedMemoryTracker::isTrackingAllocatorInstalled());
+
+    ScopedMemoryTracker outer;
+    {
+        ScopedMemoryTracker inner;
+        {
+            std::vector<char> buffer(s_numPoints);
+        }
+        CHECK(inner.getPeakBytes() >= static_cast<int64_t>(s_numPoints));
+        CHECK(inner.getAllocations() >= 1);
+        CHECK(inner.getRetainedBytes() < static_cast<int64_t>(s_numPoints));
+    }
+
+    // The nested tracker does not reset the peak of the outer tracker
+    CHECK(outer.getPeakBytes() >= static_cast<int64_t>(s_numPoints));
+}
+
+TEST_CASE("definePointCloud does not copy the points")
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    const VtVec3fArray points = createPoints();
+    const int64_t pointsBytes = static_cast<int64_t>(points.size() * sizeof(GfVec3f));
+
+    ScopedMemoryTracker tracker;
+    CHECK(usdex::core::definePointCloud(stage, SdfPath("/Points"), points));
+
+    // The authored attribute shares the buffer of the points, so no transient or retained copy should be made
+    INFO("peak bytes: ", tracker.getPeakBytes(), " points bytes: ", pointsBytes);
+    CHECK(tracker.getPeakBytes() < pointsBytes);
+}
+
+TEST_CASE("definePolyMesh does not copy the vertex buffers")
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    const VtVec3fArray points = createPoints();
+    const int64_t pointsBytes = static_cast<int64_t>(points.size() * sizeof(GfVec3f));
+
+    // A triangle fan covering every point
+    VtIntArray faceVertexCounts(s_numPoints - 2, 3);
+    VtIntArray faceVertexIndices;
+    faceVertexIndices.reserve(faceVertexCounts.size() * 3);
+    for (int i = 1; i < static_cast<int>(s_numPoints) - 1; ++i)
+    {
+        faceVertexIndices.push_back(0);
+        faceVertexIndices.push_back(i);
+        faceVertexIndices.push_back(i + 1);
+    }
+
+    ScopedMemoryTracker tracker;
+    CHECK(usdex::core::definePolyMesh(stage, SdfPath("/Mesh"), faceVertexCounts, faceVertexIndices, points));
+
+    // The authored attributes share the buffers of the arrays, so no transient or retained copy of the points should be made
+    INFO("peak bytes: ", tracker.getPeakBytes(), " points bytes: ", pointsBytes);
+    CHECK(tracker.getPeakBytes() < pointsBytes);
+}
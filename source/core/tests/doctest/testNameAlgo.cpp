@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/core/NameAlgo.h>
+
+#include <pxr/base/tf/stringUtils.h>
+
+#include <doctest/doctest.h>
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace pxr;
+
+namespace
+{
+
+static constexpr size_t s_numThreads = 8;
+static constexpr size_t s_numNames = 1000;
+
+std::vector<std::string> preferredNames()
+{
+    // Include duplicates so that suffixes must be allocated
+    std::vector<std::string> names;
+    names.reserve(s_numNames);
+    for (size_t i = 0; i < s_numNames; ++i)
+    {
+        names.push_back(TfStringPrintf("part%zu", i % 10));
+    }
+    return names;
+}
+
+} // namespace
+
+TEST_CASE("NameCache generates names for different parents concurrently")
+{
+    const std::vector<std::string> names = preferredNames();
+
+    // The expected result for every parent is the same as a serial request from a fresh cache
+    usdex::core::NameCache serialCache;
+    const TfTokenVector expectedPrimNames = serialCache.getPrimNames(SdfPath("/Serial"), names);
+    const TfTokenVector expectedPropertyNames = serialCache.getPropertyNames(SdfPath("/Serial"), names);
+
+    usdex::core::NameCache cache;
+    std::vector<TfTokenVector> primNames(s_numThreads);
+    std::vector<TfTokenVector> propertyNames(s_numThreads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < s_numThreads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                const SdfPath parent(TfStringPrintf("/World/Parent%zu", t));
+                primNames[t] = cache.getPrimNames(parent, names);
+                propertyNames[t] = cache.getPropertyNames(parent, names);
+            }
+        );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < s_numThreads; ++t)
+    {
+        CHECK(primNames[t] == expectedPrimNames);
+        CHECK(propertyNames[t] == expectedPropertyNames);
+    }
+}
+
+TEST_CASE("NameCache generates unique names for the same parent concurrently")
+{
+    const std::vector<std::string> names = preferredNames();
+    const SdfPath parent("/World");
+
+    usdex::core::NameCache cache;
+    std::vector<TfTokenVector> results(s_numThreads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < s_numThreads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                // Mix bulk and individual requests, and clear an unrelated parent, to exercise the shared storage
+                results[t] = cache.getPrimNames(parent, names);
+                results[t].push_back(cache.getPrimName(parent, "part0"));
+                cache.clear(SdfPath(TfStringPrintf("/Other%zu", t)));
+            }
+        );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Requests for the same parent are serialized, so every name must be unique
+    std::set<TfToken> allNames;
+    size_t count = 0;
+    for (const TfTokenVector& result : results)
+    {
+        CHECK(result.size() == s_numNames + 1);
+        allNames.insert(result.begin(), result.end());
+        count += result.size();
+    }
+    CHECK(allNames.size() == count);
+}
+
+TEST_CASE("NameCache does not evict a parent while names are generated for it")
+{
+    static constexpr size_t s_numLargeNames = 100000;
+    static constexpr size_t s_numOtherParents = 1000;
+
+    std::vector<std::string> names;
+    names.reserve(s_numLargeNames);
+    for (size_t i = 0; i < s_numLargeNames; ++i)
+    {
+        names.push_back(TfStringPrintf("part%zu", i % 10));
+    }
+    const SdfPath parent("/World");
+
+    // The smallest limit allows a single entry in each partition, so every new parent evicts the entries it shares a partition with
+    usdex::core::NameCache cache;
+    cache.setMaxEntries(1);
+
+    TfTokenVector bulkNames;
+    std::thread bulkThread(
+        [&]()
+        {
+            bulkNames = cache.getPrimNames(parent, names);
+        }
+    );
+
+    // Other parents are named while the bulk request is in progress, after which a name is requested for the same parent
+    for (size_t i = 0; i < s_numOtherParents; ++i)
+    {
+        cache.getPrimName(SdfPath(TfStringPrintf("/Other%zu", i)), "name");
+    }
+    const TfToken name = cache.getPrimName(parent, "part0");
+    bulkThread.join();
+
+    // The entry in use by the bulk request was not evicted, so the requests were serialized and every name must be unique
+    std::set<TfToken> allNames(bulkNames.begin(), bulkNames.end());
+    CHECK(allNames.size() == s_numLargeNames);
+    CHECK(allNames.count(name) == 0);
+}
@@ -12,6 +12,7 @@
 
 #include <doctest/doctest.h>
 
+#include <cmath>
 #include <iostream>
 
 using namespace usdex::core;
@@ -158,3 +159,73 @@ TEST_CASE("definePointCloud does not detach arrays")
     primvar.GetIndices(&authoredIndices);
     CHECK(authoredIndices.IsIdentical(opacityIndices));
 }
+
+TEST_CASE("definePointCloud rvalue points transfer ownership")
+{
+    ScopedDiagnosticChecker check;
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    SdfPath path("/Points");
+    VtVec3fArray points = { { 0, 0, 0 }, { 1, 1, 1 } };
+    const VtVec3fArray expectedPoints = points;
+    VtFloatArray widths = { 5, 10 };
+    const VtFloatArray expectedWidths = widths;
+
+    UsdGeomPoints pointCloud = usdex::core::definePointCloud(
+        stage,
+        path,
+        std::move(points),
+        std::nullopt, // ids
+        FloatPrimvarData(UsdGeomTokens->vertex, std::move(widths))
+    );
+    CHECK(pointCloud);
+    CHECK(points.empty());
+    CHECK(widths.empty());
+
+    VtVec3fArray authoredPoints;
+    pointCloud.GetPointsAttr().Get(&authoredPoints);
+    CHECK(authoredPoints.IsIdentical(expectedPoints));
+
+    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(pointCloud).GetPrimvar(UsdGeomTokens->widths);
+    VtFloatArray authoredWidths;
+    primvar.Get(&authoredWidths);
+    CHECK(authoredWidths.IsIdentical(expectedWidths));
+}
+
+TEST_CASE("definePointCloud extent matches the schema for large arrays")
+{
+    ScopedDiagnosticChecker check;
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+
+    // Large enough to be reduced in parallel chunks, with the extremes placed away from the first chunk
+    const size_t numPoints = 300000;
+    VtVec3fArray points(numPoints);
+    VtFloatArray widths(numPoints);
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        const float t = static_cast<float>(i) / static_cast<float>(numPoints);
+        points[i] = GfVec3f(std::sin(t * 17.0f) * t, std::cos(t * 11.0f), t * t - 0.5f);
+        widths[i] = 0.01f + 0.1f * static_cast<float>(i % 7);
+    }
+
+    UsdGeomPoints pointCloud = usdex::core::definePointCloud(
+        stage,
+        SdfPath("/Wide"),
+        points,
+        std::nullopt, // ids
+        FloatPrimvarData(UsdGeomTokens->vertex, widths)
+    );
+    CHECK(pointCloud);
+    VtVec3fArray expected;
+    CHECK(UsdGeomPoints::ComputeExtent(points, widths, &expected));
+    VtVec3fArray extent;
+    pointCloud.GetExtentAttr().Get(&extent);
+    CHECK(extent == expected);
+
+    pointCloud = usdex::core::definePointCloud(stage, SdfPath("/Narrow"), points);
+    CHECK(pointCloud);
+    CHECK(UsdGeomPointBased::ComputeExtent(points, &expected));
+    pointCloud.GetExtentAttr().Get(&extent);
+    CHECK(extent == expected);
+}
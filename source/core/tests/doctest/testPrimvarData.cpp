@@ -13,6 +13,7 @@
 #include <doctest/doctest.h>
 
 #include <optional>
+#include <string>
 
 using namespace usdex::core;
 using namespace usdex::test;
@@ -336,6 +337,100 @@ TEST_CASE("PrimvarData Moves")
     CHECK(!c.has_value());
 }
 
+TEST_CASE("PrimvarData rvalue constructors take ownership")
+{
+    ScopedDiagnosticChecker check;
+
+    VtFloatArray values = { -1.0, 0.5, 1.5 };
+    VtIntArray indices = { 0, 1, 2 };
+    const VtFloatArray expectedValues = values;
+    const VtIntArray expectedIndices = indices;
+
+    FloatPrimvarData a(UsdGeomTokens->vertex, std::move(values), std::move(indices));
+    CHECK(a.values().IsIdentical(expectedValues));
+    CHECK(a.indices().IsIdentical(expectedIndices));
+    CHECK(values.empty());
+    CHECK(indices.empty());
+    CHECK(a.isValid());
+
+    VtFloatArray moreValues = { -1.0, 0.5, 1.5 };
+    const VtFloatArray expectedMoreValues = moreValues;
+    FloatPrimvarData b(UsdGeomTokens->vertex, std::move(moreValues));
+    CHECK(b.values().IsIdentical(expectedMoreValues));
+    CHECK(moreValues.empty());
+    CHECK(!b.hasIndices());
+    CHECK(b.isValid());
+}
+
+TEST_CASE("PrimvarData index does not detach the original arrays")
+{
+    ScopedDiagnosticChecker check;
+
+    VtFloatArray values = { 0.5, 0.5, 1.5, 1.5 };
+    const VtFloatArray original = values;
+    FloatPrimvarData data(UsdGeomTokens->vertex, values);
+    CHECK(data.index());
+    CHECK(data.values() == VtFloatArray({ 0.5, 1.5 }));
+    CHECK(data.indices() == VtIntArray({ 0, 0, 1, 1 }));
+
+    // the caller's array is untouched and still shares its buffer with the other handle
+    CHECK(values.IsIdentical(original));
+}
+
+TEST_CASE("PrimvarData index compares floating point values by bit pattern")
+{
+    ScopedDiagnosticChecker check;
+
+    // negative zero is merged with zero, as it is equal by value
+    VtVec3fArray values = { GfVec3f(0.0f, 1.0f, 0.0f), GfVec3f(-0.0f, 1.0f, -0.0f), GfVec3f(0.0f, -1.0f, 0.0f) };
+    Vec3fPrimvarData data(UsdGeomTokens->faceVarying, values);
+    CHECK(data.index());
+    CHECK(data.values() == VtVec3fArray({ GfVec3f(0.0f, 1.0f, 0.0f), GfVec3f(0.0f, -1.0f, 0.0f) }));
+    CHECK(data.indices() == VtIntArray({ 0, 0, 1 }));
+}
+
+TEST_CASE("PrimvarData index large arrays")
+{
+    ScopedDiagnosticChecker check;
+
+    // Large enough to exercise the partitioned indexing, with unique values interleaved so the first occurrence order is observable
+    const size_t numValues = 100000;
+    const int numUnique = 997;
+    VtVec2fArray values(numValues);
+    VtIntArray expectedIndices(numValues);
+    VtVec2fArray expectedValues(numUnique);
+    for (size_t i = 0; i < numValues; ++i)
+    {
+        const int unique = static_cast<int>((i * 31) % numUnique);
+        values[i] = GfVec2f(static_cast<float>(unique), static_cast<float>(-unique));
+        expectedIndices[i] = static_cast<int>(i % numUnique);
+        if (i < static_cast<size_t>(numUnique))
+        {
+            expectedValues[i] = values[i];
+        }
+    }
+
+    Vec2fPrimvarData data(UsdGeomTokens->faceVarying, values);
+    CHECK(data.index());
+    CHECK(data.values() == expectedValues);
+    CHECK(data.indices() == expectedIndices);
+
+    // indexing the result again is a no-op
+    CHECK(!data.index());
+
+    // the std types are compared by value as well
+    VtStringArray strings(numValues);
+    for (size_t i = 0; i < numValues; ++i)
+    {
+        strings[i] = std::to_string(i % 3);
+    }
+    StringPrimvarData stringData(UsdGeomTokens->vertex, strings);
+    CHECK(stringData.index());
+    CHECK(stringData.values() == VtStringArray({ "0", "1", "2" }));
+    CHECK(stringData.indices().size() == numValues);
+    CHECK(stringData.indices()[numValues - 1] == static_cast<int>((numValues - 1) % 3));
+}
+
 TEST_CASE("PrimvarData getPrimvarData")
 {
     ScopedDiagnosticChecker check;
@@ -556,3 +651,48 @@ TEST_CASE("PrimvarData Time Samples")
         CHECK(sample.elementSize() == -1);
     }
 }
+
+TEST_CASE("PrimvarData half precision large arrays")
+{
+    ScopedDiagnosticChecker check;
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdGeomScope scope = UsdGeomScope::Define(stage, SdfPath("/Prim"));
+    UsdGeomPrimvarsAPI primvarsApi(scope.GetPrim());
+    UsdGeomPrimvar primvar = primvarsApi.CreatePrimvar(TfToken("half"), SdfValueTypeNames->Normal3hArray, UsdGeomTokens->vertex);
+    REQUIRE(primvar);
+
+    // Large enough to convert in parallel
+    static constexpr size_t s_numValues = 1000000;
+    VtVec3fArray values(s_numValues);
+    for (size_t i = 0; i < s_numValues; ++i)
+    {
+        const float value = static_cast<float>(i % 1000) / 1000.0f;
+        values[i] = GfVec3f(value, 1.0f - value, 0.5f);
+    }
+    const Vec3fPrimvarData data(UsdGeomTokens->vertex, values);
+
+    double maxError = 0.0;
+    {
+        ScopedPrimvarPrecision precision(PrimvarPrecision::eHalf);
+        CHECK(getPrimvarPrecision() == PrimvarPrecision::eHalf);
+        CHECK(data.setPrimvar(primvar));
+        maxError = precision.getMaxError();
+    }
+    CHECK(getPrimvarPrecision() == PrimvarPrecision::eFloat);
+
+    // Values in [0, 1] are represented by half precision to within 2^-11 of their magnitude
+    CHECK(maxError > 0.0);
+    CHECK(maxError <= 1.0 / 2048.0);
+
+    VtVec3hArray authoredValues;
+    REQUIRE(primvar.Get(&authoredValues));
+    CHECK(authoredValues.size() == s_numValues);
+
+    const Vec3fPrimvarData result = Vec3fPrimvarData::getPrimvarData(primvar);
+    REQUIRE(result.values().size() == s_numValues);
+    for (size_t i = 0; i < s_numValues; i += 997)
+    {
+        CHECK(GfIsClose(result.values()[i], values[i], maxError));
+    }
+}
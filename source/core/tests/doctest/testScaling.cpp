@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/core/MeshAlgo.h>
+#include <usdex/core/NameAlgo.h>
+#include <usdex/core/PrimvarData.h>
+#include <usdex/core/XformAlgo.h>
+
+#include <pxr/base/tf/getenv.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace pxr;
+
+// These cases assert the algorithmic complexity of functions which are expected to be linear in the size of their inputs, by comparing the time
+// taken at two problem sizes. Absolute times are never compared, so the results are independent of the machine, but they are still sensitive to
+// a heavily loaded machine, so they only run when USDEX_TEST_SCALING is enabled, e.g. `USDEX_TEST_SCALING=1 test_usdex_core`.
+
+namespace
+{
+
+static constexpr const char* s_scalingEnvVar = "USDEX_TEST_SCALING";
+
+// Doubling the size of a linear problem should take twice as long, while a quadratic problem would take four times as long.
+// The threshold sits between the two, to allow for noise and for caches which favor the smaller problem.
+static constexpr double s_maxDoublingRatio = 3.0;
+
+// The fastest of several repetitions is compared, as it is least affected by other work on the machine
+static constexpr size_t s_repetitions = 5;
+
+bool scalingTestsEnabled()
+{
+    return TfGetenvBool(s_scalingEnvVar, false);
+}
+
+// Call `setup` and then measure `fn` at the given size, returning the fastest repetition in seconds
+double measure(size_t size, const std::function<std::function<void()>(size_t)>& setup)
+{
+    double best = 0.0;
+    for (size_t i = 0; i < s_repetitions; ++i)
+    {
+        const std::function<void()> fn = setup(size);
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = (i == 0) ? seconds : std::min(best, seconds);
+    }
+    return best;
+}
+
+// Assert that doubling the problem size does not more than double the time taken, within the noise threshold
+void checkLinearScaling(size_t size, const std::function<std::function<void()>(size_t)>& setup)
+{
+    // warm up any caches (e.g. schema registries) which are populated by the first call
+    measure(size / 10, setup);
+
+    const double small = measure(size, setup);
+    const double large = measure(size * 2, setup);
+    INFO("size ", size, " took ", small, "s and size ", size * 2, " took ", large, "s");
+    CHECK(large < small * s_maxDoublingRatio);
+}
+
+std::vector<std::string> siblingNames(size_t count)
+{
+    // Include duplicates so that unique suffixes must be allocated
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        names.push_back(TfStringPrintf("Part_%zu", i % 100));
+    }
+    return names;
+}
+
+} // namespace
+
+TEST_CASE("getValidChildNames scales linearly with the number of siblings" * doctest::skip(!scalingTestsEnabled()))
+{
+    checkLinearScaling(
+        20000,
+        [](size_t size) -> std::function<void()>
+        {
+            UsdStageRefPtr stage = UsdStage::CreateInMemory();
+            UsdPrim parent = stage->DefinePrim(SdfPath("/World"));
+            // half of the siblings already exist on the stage
+            const std::vector<std::string> names = siblingNames(size);
+            for (const TfToken& name : usdex::core::getValidChildNames(parent, std::vector<std::string>(names.begin(), names.begin() + size / 2)))
+            {
+                stage->DefinePrim(parent.GetPath().AppendChild(name));
+            }
+            return [stage, parent, names]() { usdex::core::getValidChildNames(parent, names); };
+        }
+    );
+}
+
+TEST_CASE("NameCache scales linearly with the number of siblings" * doctest::skip(!scalingTestsEnabled()))
+{
+    checkLinearScaling(
+        20000,
+        [](size_t size) -> std::function<void()>
+        {
+            const std::vector<std::string> names = siblingNames(size);
+            return [names]()
+            {
+                usdex::core::NameCache cache;
+                const SdfPath parent("/World");
+                cache.getPrimNames(parent, names);
+                cache.getPropertyNames(parent, names);
+            };
+        }
+    );
+}
+
+TEST_CASE("getValidPrimNames scales linearly with the number of reserved names" * doctest::skip(!scalingTestsEnabled()))
+{
+    checkLinearScaling(
+        20000,
+        [](size_t size) -> std::function<void()>
+        {
+            const std::vector<std::string> names = siblingNames(size);
+            const TfTokenVector reservedNames = usdex::core::getValidPrimNames(names);
+            return [names, reservedNames]() { usdex::core::getValidPrimNames(names, reservedNames); };
+        }
+    );
+}
+
+TEST_CASE("PrimvarData::index scales linearly with the number of values" * doctest::skip(!scalingTestsEnabled()))
+{
+    checkLinearScaling(
+        500000,
+        [](size_t size) -> std::function<void()>
+        {
+            VtVec3fArray values(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                const float value = static_cast<float>(i % 1000);
+                values[i] = GfVec3f(value, value, value);
+            }
+            return [values]()
+            {
+                usdex::core::Vec3fPrimvarData primvar(UsdGeomTokens->faceVarying, values);
+                primvar.index();
+            };
+        }
+    );
+}
+
+TEST_CASE("definePolyMesh scales linearly with the number of meshes" * doctest::skip(!scalingTestsEnabled()))
+{
+    checkLinearScaling(
+        1000,
+        [](size_t size) -> std::function<void()>
+        {
+            UsdStageRefPtr stage = UsdStage::CreateInMemory();
+            stage->DefinePrim(SdfPath("/World"));
+            return [stage, size]()
+            {
+                const VtIntArray faceVertexCounts = { 4 };
+                const VtIntArray faceVertexIndices = { 0, 1, 2, 3 };
+                const VtVec3fArray points = { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 } };
+                for (size_t i = 0; i < size; ++i)
+                {
+                    usdex::core::definePolyMesh(stage, SdfPath(TfStringPrintf("/World/Mesh_%zu", i)), faceVertexCounts, faceVertexIndices, points);
+                }
+            };
+        }
+    );
+}
+
+TEST_CASE("setLocalTransforms scales linearly with the number of prims" * doctest::skip(!scalingTestsEnabled()))
+{
+    checkLinearScaling(
+        10000,
+        [](size_t size) -> std::function<void()>
+        {
+            UsdStageRefPtr stage = UsdStage::CreateInMemory();
+            std::vector<UsdPrim> prims;
+            for (size_t i = 0; i < size; ++i)
+            {
+                prims.push_back(usdex::core::defineXform(stage, SdfPath(TfStringPrintf("/Xform_%zu", i))).GetPrim());
+            }
+            return [stage, prims]() { usdex::core::setLocalTransforms(prims, std::vector<GfMatrix4d>(prims.size(), GfMatrix4d(2.0))); };
+        }
+    );
+}
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/test/SceneGenerator.h>
+
+#include <usdex/core/StageAlgo.h>
+
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/basisCurves.h>
+#include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/metrics.h>
+#include <pxr/usd/usdGeom/points.h>
+
+#include <doctest/doctest.h>
+
+#include <set>
+#include <string>
+
+using namespace pxr;
+
+namespace
+{
+
+UsdStageRefPtr createStage()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    usdex::core::configureStage(stage, "Root", UsdGeomTokens->y, UsdGeomLinearUnits::centimeters, "usdex test");
+    usdex::core::defineXform(stage, SdfPath("/Root"));
+    return stage;
+}
+
+} // namespace
+
+TEST_CASE("generateScene defines the requested content")
+{
+    usdex::test::SceneGeneratorOptions options;
+    options.hierarchyDepth = 1;
+    options.hierarchyWidth = 3;
+    options.meshCount = 5;
+    options.verticesPerMesh = 16;
+    options.groomCount = 2;
+    options.curvesPerGroom = 10;
+    options.verticesPerCurve = 4;
+    options.pointCloudCount = 3;
+    options.pointsPerCloud = 100;
+    options.materialCount = 2;
+
+    UsdStageRefPtr stage = createStage();
+    const std::vector<UsdPrim> prims = usdex::test::generateScene(stage->GetDefaultPrim(), options);
+    REQUIRE(prims.size() == 10);
+    CHECK(prims[0].IsA<UsdGeomMesh>());
+    CHECK(prims[5].IsA<UsdGeomBasisCurves>());
+    CHECK(prims[7].IsA<UsdGeomPoints>());
+
+    VtVec3fArray points;
+    UsdGeomMesh(prims[0]).GetPointsAttr().Get(&points);
+    CHECK(points.size() == 16);
+    UsdGeomBasisCurves(prims[5]).GetPointsAttr().Get(&points);
+    CHECK(points.size() == 40);
+    UsdGeomPoints(prims[7]).GetPointsAttr().Get(&points);
+    CHECK(points.size() == 100);
+
+    CHECK(stage->GetPrimAtPath(SdfPath("/Root/Materials/Material_1")));
+    CHECK(stage->GetPrimAtPath(SdfPath("/Root/Geometry/Group_2")));
+}
+
+TEST_CASE("generateScene is deterministic")
+{
+    usdex::test::SceneGeneratorOptions options;
+    options.seed = 11;
+    options.meshCount = 4;
+    options.verticesPerMesh = 25;
+    options.groomCount = 1;
+    options.curvesPerGroom = 5;
+    options.pointCloudCount = 1;
+
+    std::string a, b, c;
+    UsdStageRefPtr stageA = createStage();
+    usdex::test::generateScene(stageA->GetDefaultPrim(), options);
+    stageA->GetRootLayer()->ExportToString(&a);
+
+    UsdStageRefPtr stageB = createStage();
+    usdex::test::generateScene(stageB->GetDefaultPrim(), options);
+    stageB->GetRootLayer()->ExportToString(&b);
+    CHECK(a == b);
+
+    options.seed = 12;
+    UsdStageRefPtr stageC = createStage();
+    usdex::test::generateScene(stageC->GetDefaultPrim(), options);
+    stageC->GetRootLayer()->ExportToString(&c);
+    CHECK(a != c);
+}
+
+TEST_CASE("generateScene resolves name collisions")
+{
+    usdex::test::SceneGeneratorOptions options;
+    options.hierarchyDepth = 0;
+    options.meshCount = 6;
+    options.verticesPerMesh = 4;
+    options.nameCollisionRate = 1.0;
+
+    UsdStageRefPtr stage = createStage();
+    const std::vector<UsdPrim> prims = usdex::test::generateScene(stage->GetDefaultPrim(), options);
+
+    std::set<std::string> names;
+    for (const UsdPrim& prim : prims)
+    {
+        names.insert(prim.GetName().GetString());
+    }
+    CHECK(prims[0].GetName() == TfToken("Mesh"));
+    CHECK(names.size() == 6);
+}
@@ -74,6 +74,10 @@ class GetAssetStructureTokensTestCase(usdex.test.TestCase):
         token = usdex.core.getLibraryToken()
         self.assertEqual(token, "Library")
 
+    def testGetLodToken(self):
+        token = usdex.core.getLodToken()
+        self.assertEqual(token, "LOD")
+
     def testGetMaterialsToken(self):
         token = usdex.core.getMaterialsToken()
         self.assertEqual(token, "Materials")
@@ -514,6 +518,61 @@ class AddAssetInterfaceTestCase(usdex.test.TestCase, AssetStructureTestBase):
 
         self.assertIsValidUsd(assetStage)
 
+    def testDescendantKinds(self):
+        assetStage = usdex.core.createStage(
+            self.tmpFile("testAsset", "usda"),
+            "testAsset",
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        payloadStage = usdex.core.createAssetPayload(assetStage)
+        contentStage = usdex.core.addAssetContent(payloadStage, usdex.core.getGeometryToken(), createScope=False)
+        root = contentStage.GetDefaultPrim()
+
+        # kinds authored directly in the content, including deep beneath prims without kinds
+        geo = usdex.core.defineXform(root, "Geo").GetPrim()
+        Usd.ModelAPI(geo).SetKind(Kind.Tokens.component)
+        Usd.ModelAPI(usdex.core.defineXform(geo, "Nested").GetPrim()).SetKind(Kind.Tokens.group)
+        deep = usdex.core.defineXform(usdex.core.defineXform(root, "Plain").GetPrim(), "Deep").GetPrim()
+        Usd.ModelAPI(usdex.core.defineXform(deep, "Part").GetPrim()).SetKind(Kind.Tokens.component)
+        noKinds = usdex.core.defineXform(usdex.core.defineXform(root, "NoKinds").GetPrim(), "A").GetPrim()
+        usdex.core.defineXform(noKinds, "B")
+
+        # a kind authored within a variant
+        variantPrim = usdex.core.defineXform(root, "Variant").GetPrim()
+        variantSet = variantPrim.GetVariantSets().AddVariantSet("lod")
+        variantSet.AddVariant("high")
+        variantSet.SetVariantSelection("high")
+        with variantSet.GetVariantEditContext():
+            Usd.ModelAPI(usdex.core.defineXform(variantPrim, "Part").GetPrim()).SetKind(Kind.Tokens.component)
+
+        # a kind introduced by a reference to another layer
+        libraryStage = usdex.core.createStage(
+            self.tmpFile("library", "usda"),
+            "Library",
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        Usd.ModelAPI(libraryStage.GetDefaultPrim()).SetKind(Kind.Tokens.component)
+        self.assertTrue(usdex.core.defineReference(root, libraryStage.GetDefaultPrim(), "Ref"))
+
+        self.assertTrue(usdex.core.addAssetInterface(assetStage, payloadStage))
+
+        def getKind(path):
+            return Usd.ModelAPI(assetStage.GetPrimAtPath(path)).GetKind()
+
+        self.assertEqual(getKind("/testAsset"), Kind.Tokens.component)
+        self.assertEqual(getKind("/testAsset/Geo"), Kind.Tokens.subcomponent)
+        self.assertEqual(getKind("/testAsset/Geo/Nested"), "")
+        self.assertEqual(getKind("/testAsset/Plain/Deep/Part"), Kind.Tokens.subcomponent)
+        self.assertEqual(getKind("/testAsset/Variant/Part"), Kind.Tokens.subcomponent)
+        self.assertEqual(getKind("/testAsset/Ref"), Kind.Tokens.subcomponent)
+
+        # prims without kinds are not overridden
+        self.assertFalse(assetStage.GetRootLayer().GetPrimAtPath("/testAsset/NoKinds"))
+
     def testExtentsWithGeometry(self):
         # Create asset stage with "testAsset" as the name
         assetStageIdentifier = self.tmpFile("testAsset", "usda")
@@ -698,6 +757,427 @@ class AddAssetInterfaceTestCase(usdex.test.TestCase, AssetStructureTestBase):
         self.assertIsValidUsd(payloadStage)
 
 
+class AddAssetLodInterfaceTestCase(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.validationEngine.enable_rule(omni.asset_validator.AnchoredAssetPathsChecker)
+        self.validationEngine.enable_rule(omni.asset_validator.SupportedFileTypesChecker)
+        self.assetStage = usdex.core.createStage(
+            self.tmpFile("testAsset", "usda"),
+            "testAsset",
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+
+    def createLod(self, lod: str, size: float) -> Usd.Stage:
+        payloadStage = usdex.core.createAssetLodPayload(self.assetStage, lod)
+        geometryStage = usdex.core.addAssetContent(payloadStage, usdex.core.getGeometryToken(), "usda")
+        geometryScope = geometryStage.GetDefaultPrim().GetPath().AppendChild(usdex.core.getGeometryToken())
+        cube = UsdGeom.Cube.Define(geometryStage, geometryScope.AppendChild("Cube"))
+        cube.CreateSizeAttr().Set(size)
+        geometryStage.Save()
+        payloadStage.Save()
+        return payloadStage
+
+    def testCreateAssetLodPayload(self):
+        proxyStage = usdex.core.createAssetLodPayload(self.assetStage, "Proxy", "usdc")
+        self.assertIsInstance(proxyStage, Usd.Stage)
+        expectedIdentifier = os.path.join(self.tmpDir(), usdex.core.getPayloadToken(), "Proxy", f"{usdex.core.getContentsToken()}.usdc")
+        self.assertEqual(os.path.normpath(proxyStage.GetRootLayer().identifier), os.path.normpath(expectedIdentifier))
+        self.assertEqual(proxyStage.GetDefaultPrim().GetName(), "testAsset")
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid LOD name")]):
+            self.assertIsNone(usdex.core.createAssetLodPayload(self.assetStage, "Not/ALod"))
+
+    def testAddAssetLodInterface(self):
+        proxyStage = self.createLod("Proxy", 1.0)
+        renderStage = self.createLod("Render", 2.0)
+
+        self.assertTrue(usdex.core.addAssetLodInterface(self.assetStage, [("Proxy", proxyStage), ("Render", renderStage)], "Proxy"))
+
+        defaultPrim = self.assetStage.GetDefaultPrim()
+        self.assertEqual(defaultPrim.GetName(), "testAsset")
+        self.assertEqual(Usd.ModelAPI(defaultPrim).GetKind(), Kind.Tokens.component)
+
+        # each LOD is a variant and the default LOD is selected
+        variantSet = defaultPrim.GetVariantSets().GetVariantSet(usdex.core.getLodToken())
+        self.assertTrue(variantSet)
+        self.assertEqual(variantSet.GetVariantNames(), ["Proxy", "Render"])
+        self.assertEqual(variantSet.GetVariantSelection(), "Proxy")
+
+        # each payload is authored within its variant, rather than on the default prim itself
+        rootLayer = self.assetStage.GetRootLayer()
+        self.assertFalse(rootLayer.GetPrimAtPath(defaultPrim.GetPath()).hasPayloads)
+        for lod, payloadStage in (("Proxy", proxyStage), ("Render", renderStage)):
+            variantSpec = rootLayer.GetPrimAtPath(defaultPrim.GetPath().AppendVariantSelection(usdex.core.getLodToken(), lod))
+            self.assertTrue(variantSpec)
+            payloads = variantSpec.payloadList.prependedItems
+            self.assertEqual(len(payloads), 1)
+            self.assertEqual(payloads[0].assetPath, f"./{usdex.core.getPayloadToken()}/{lod}/{usdex.core.getContentsToken()}.usda")
+
+        # only the selected LOD is composed and its contents are used for the extents hint
+        self.assertTrue(defaultPrim.GetChild("Geometry").GetChild("Cube"))
+        self.assertEqual(UsdGeom.Cube(defaultPrim.GetChild("Geometry").GetChild("Cube")).GetSizeAttr().Get(), 1.0)
+        extentsValue = UsdGeom.ModelAPI(defaultPrim).GetExtentsHintAttr().Get()
+        self.assertEqual(extentsValue[0], Gf.Vec3f(-0.5))
+        self.assertEqual(extentsValue[1], Gf.Vec3f(0.5))
+
+        # switching the selection composes the other LOD
+        variantSet.SetVariantSelection("Render")
+        self.assertEqual(UsdGeom.Cube(defaultPrim.GetChild("Geometry").GetChild("Cube")).GetSizeAttr().Get(), 2.0)
+        variantSet.SetVariantSelection("Proxy")
+
+        self.assertIsValidUsd(self.assetStage)
+
+    def testInvalidLods(self):
+        proxyStage = self.createLod("Proxy", 1.0)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid stage")]):
+            self.assertFalse(usdex.core.addAssetLodInterface(None, [("Proxy", proxyStage)], "Proxy"))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*default LOD")]):
+            self.assertFalse(usdex.core.addAssetLodInterface(self.assetStage, [("Proxy", proxyStage)], "Render"))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid LOD name")]):
+            self.assertFalse(usdex.core.addAssetLodInterface(self.assetStage, [("Not A Lod", proxyStage)], "Not A Lod"))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid source stage")]):
+            self.assertFalse(usdex.core.addAssetLodInterface(self.assetStage, [("Proxy", None)], "Proxy"))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*anonymous source stage")]):
+            self.assertFalse(usdex.core.addAssetLodInterface(self.assetStage, [("Proxy", Usd.Stage.CreateInMemory())], "Proxy"))
+
+        # nothing was authored by the failed calls
+        self.assertFalse(self.assetStage.GetDefaultPrim().GetVariantSets().HasVariantSet(usdex.core.getLodToken()))
+
+
+class AddAssetInterfaceLayerTestCase(usdex.test.TestCase, AssetStructureTestBase):
+
+    def setUp(self):
+        super().setUp()
+        self.validationEngine.enable_rule(omni.asset_validator.AnchoredAssetPathsChecker)
+        self.validationEngine.enable_rule(omni.asset_validator.SupportedFileTypesChecker)
+
+    def createAsset(self, name: str) -> tuple:
+        assetStage = usdex.core.createStage(
+            self.subDirTmpFile([name], name, "usda"),
+            name,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        payloadStage = usdex.core.createAssetPayload(assetStage)
+        geometryStage = usdex.core.addAssetContent(payloadStage, usdex.core.getGeometryToken(), "usda")
+        geometryScope = geometryStage.GetDefaultPrim().GetPath().AppendChild(usdex.core.getGeometryToken())
+        cube = UsdGeom.Cube.Define(geometryStage, geometryScope.AppendChild("Cube"))
+        Usd.ModelAPI(cube.GetPrim()).SetKind(Kind.Tokens.component)
+        UsdGeom.ModelAPI.Apply(geometryStage.GetDefaultPrim()).SetExtentsHint([Gf.Vec3f(-1), Gf.Vec3f(1)])
+        usdex.core.setDisplayName(payloadStage.GetDefaultPrim(), f"{name} display name")
+        usdex.core.saveStage(geometryStage)
+        usdex.core.saveStage(payloadStage)
+        return assetStage, payloadStage
+
+    def testAddAssetInterface(self):
+        assetStage, payloadStage = self.createAsset("testAsset")
+        assetLayer = assetStage.GetRootLayer()
+        payloadLayer = payloadStage.GetRootLayer()
+
+        self.assertTrue(usdex.core.addAssetInterface(assetLayer, payloadLayer))
+
+        # the layer is configured to match the source layer
+        self.assertEqual(assetLayer.defaultPrim, "testAsset")
+        self.assertEqual(UsdGeom.GetStageUpAxis(assetStage), self.defaultUpAxis)
+        self.assertEqual(UsdGeom.GetStageMetersPerUnit(assetStage), self.defaultLinearUnits)
+        self.assertEqual(usdex.core.getLayerAuthoringMetadata(assetLayer), self.defaultAuthoringMetadata)
+
+        # the default prim payloads the source layer
+        spec = assetLayer.GetPrimAtPath("/testAsset")
+        self.assertEqual(spec.specifier, Sdf.SpecifierDef)
+        payloads = spec.payloadList.prependedItems
+        self.assertEqual(len(payloads), 1)
+        self.assertEqual(payloads[0].assetPath, self.getRelativeIdentifier(payloadLayer.identifier, assetLayer.identifier))
+        self.assertEqual(payloads[0].primPath, Sdf.Path())
+
+        # the model metadata matches the stage overload
+        defaultPrim = assetStage.GetDefaultPrim()
+        self.assertEqual(Usd.ModelAPI(defaultPrim).GetKind(), Kind.Tokens.component)
+        self.assertEqual(Usd.ModelAPI(defaultPrim).GetAssetName(), "testAsset display name")
+        cube = assetStage.GetPrimAtPath("/testAsset/Geometry/Cube")
+        self.assertEqual(Usd.ModelAPI(cube).GetKind(), Kind.Tokens.subcomponent)
+        self.assertTrue(defaultPrim.HasAPI(UsdGeom.ModelAPI))
+        extentsHint = UsdGeom.ModelAPI(defaultPrim).GetExtentsHint()
+        self.assertEqual(list(extentsHint), [Gf.Vec3f(-1), Gf.Vec3f(1)])
+
+        # repeated calls do not duplicate the payload
+        self.assertTrue(usdex.core.addAssetInterface(assetLayer, payloadLayer))
+        self.assertEqual(len(assetLayer.GetPrimAtPath("/testAsset").payloadList.prependedItems), 1)
+
+        self.assertIsValidUsd(assetStage)
+
+    def testInvalidLayers(self):
+        assetStage, payloadStage = self.createAsset("testAsset")
+        assetLayer = assetStage.GetRootLayer()
+        payloadLayer = payloadStage.GetRootLayer()
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid layer")]):
+            self.assertFalse(usdex.core.addAssetInterface(None, payloadLayer))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid source layer")]):
+            self.assertFalse(usdex.core.addAssetInterface(assetLayer, None))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*anonymous layer")]):
+            self.assertFalse(usdex.core.addAssetInterface(Sdf.Layer.CreateAnonymous(), payloadLayer))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*anonymous source layer")]):
+            self.assertFalse(usdex.core.addAssetInterface(assetLayer, Sdf.Layer.CreateAnonymous()))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*the layer itself")]):
+            self.assertFalse(usdex.core.addAssetInterface(assetLayer, assetLayer))
+
+        noDefaultPrimLayer = Sdf.Layer.CreateNew(self.tmpFile("noDefaultPrim", "usda"))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*without a valid default prim")]):
+            self.assertFalse(usdex.core.addAssetInterface(assetLayer, noDefaultPrimLayer))
+
+        # nothing was authored by the failed calls
+        self.assertFalse(assetLayer.GetPrimAtPath("/testAsset").hasPayloads)
+
+    def testAddAssetInterfaces(self):
+        assets = [self.createAsset(f"testAsset{i}") for i in range(4)]
+        layers = [assetStage.GetRootLayer() for assetStage, _ in assets]
+        sources = [payloadStage.GetRootLayer() for _, payloadStage in assets]
+
+        self.assertTrue(usdex.core.addAssetInterfaces(layers, sources))
+        for i, (assetStage, payloadStage) in enumerate(assets):
+            defaultPrim = assetStage.GetDefaultPrim()
+            self.assertEqual(defaultPrim.GetName(), f"testAsset{i}")
+            self.assertEqual(Usd.ModelAPI(defaultPrim).GetKind(), Kind.Tokens.component)
+            payloads = assetStage.GetRootLayer().GetPrimAtPath(defaultPrim.GetPath()).payloadList.prependedItems
+            self.assertEqual(payloads[0].assetPath, self.getRelativeIdentifier(sources[i].identifier, layers[i].identifier))
+            self.assertIsValidUsd(assetStage)
+
+        # one failure does not prevent the others from being authored
+        otherStage, otherPayloadStage = self.createAsset("otherAsset")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid source layer")]):
+            self.assertFalse(usdex.core.addAssetInterfaces([layers[0], otherStage.GetRootLayer()], [None, otherPayloadStage.GetRootLayer()]))
+        self.assertTrue(otherStage.GetDefaultPrim().HasPayload())
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*mismatched sources")]):
+            self.assertFalse(usdex.core.addAssetInterfaces(layers, sources[:2]))
+
+
+class AuthorAssetContentsTestCase(usdex.test.TestCase):
+
+    def createAssetStage(self) -> Usd.Stage:
+        return usdex.core.createStage(
+            self.tmpFile("testAsset", "usda"),
+            "testAsset",
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+
+    def testAuthorAssetContents(self):
+        assetStage = self.createAssetStage()
+
+        def authorGeometry(contentStage, libraryStage, nameCache):
+            libraryScope = libraryStage.GetDefaultPrim()
+            cube = UsdGeom.Cube.Define(libraryStage, libraryScope.GetPath().AppendChild(nameCache.getPrimName(libraryScope, "Cube")))
+            cube.CreateSizeAttr().Set(2.0)
+            contentScope = contentStage.GetPrimAtPath(contentStage.GetDefaultPrim().GetPath().AppendChild("Geometry"))
+            return bool(usdex.core.defineReference(contentScope, cube.GetPrim()))
+
+        def authorMaterials(contentStage, libraryStage, nameCache):
+            self.assertIsNone(libraryStage)
+            contentScope = contentStage.GetPrimAtPath(contentStage.GetDefaultPrim().GetPath().AppendChild("Materials"))
+            return bool(usdex.core.createMaterial(contentScope, nameCache.getPrimName(contentScope, "Clay")))
+
+        streams = [
+            usdex.core.AssetContentStream(usdex.core.getGeometryToken(), authorGeometry, addLibrary=True),
+            usdex.core.AssetContentStream(usdex.core.getMaterialsToken(), authorMaterials),
+        ]
+        self.assertTrue(usdex.core.authorAssetContents(assetStage, streams))
+
+        # the asset interface payloads the saved payload layer, which sublayers each content layer with the later streams stronger
+        defaultPrim = assetStage.GetDefaultPrim()
+        self.assertTrue(defaultPrim.HasPayload())
+        self.assertEqual(Usd.ModelAPI(defaultPrim).GetKind(), Kind.Tokens.component)
+        assetDir = os.path.dirname(assetStage.GetRootLayer().identifier)
+        payloadIdentifier = os.path.join(assetDir, usdex.core.getPayloadToken(), f"{usdex.core.getContentsToken()}.usda")
+        payloadLayer = Sdf.Layer.FindOrOpen(payloadIdentifier)
+        self.assertTrue(payloadLayer)
+        self.assertFalse(payloadLayer.dirty)
+        self.assertEqual(list(payloadLayer.subLayerPaths), ["./Materials.usda", "./Geometry.usda"])
+
+        # each stream was saved by its worker
+        for name in ("GeometryLibrary.usdc", "Geometry.usda", "Materials.usda"):
+            layer = Sdf.Layer.FindOrOpen(os.path.join(os.path.dirname(payloadIdentifier), name))
+            self.assertTrue(layer, name)
+            self.assertFalse(layer.dirty, name)
+
+        # the composed asset contains the content of every stream
+        self.assertTrue(assetStage.GetPrimAtPath("/testAsset/Geometry/Cube"))
+        self.assertTrue(assetStage.GetPrimAtPath("/testAsset/Materials/Clay"))
+        self.assertIsValidUsd(assetStage)
+
+    def testFailedStream(self):
+        assetStage = self.createAssetStage()
+
+        streams = [
+            usdex.core.AssetContentStream(usdex.core.getGeometryToken(), lambda contentStage, libraryStage, nameCache: True),
+            usdex.core.AssetContentStream(usdex.core.getMaterialsToken(), lambda contentStage, libraryStage, nameCache: False),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*Unable to author asset content \"Materials\"")]):
+            self.assertFalse(usdex.core.authorAssetContents(assetStage, streams))
+
+        # the asset interface is not added
+        self.assertFalse(assetStage.GetDefaultPrim().HasPayload())
+
+    def testInvalidStage(self):
+        streams = [usdex.core.AssetContentStream(usdex.core.getGeometryToken(), lambda contentStage, libraryStage, nameCache: True)]
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*anonymous asset stage"),
+                (Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid asset payload stage"),
+            ],
+        ):
+            self.assertFalse(usdex.core.authorAssetContents(Usd.Stage.CreateInMemory(), streams))
+
+
+class AuthorExtentsHintsTestCase(usdex.test.TestCase):
+
+    def createStage(self) -> Usd.Stage:
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, "World", self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        world = usdex.core.defineXform(stage, "/World").GetPrim()
+        Usd.ModelAPI(world).SetKind(Kind.Tokens.assembly)
+        return stage
+
+    def defineQuad(self, parent: Usd.Prim, name: str, offset: Gf.Vec3f) -> UsdGeom.Mesh:
+        points = Vt.Vec3fArray([offset, offset + Gf.Vec3f(1, 0, 0), offset + Gf.Vec3f(1, 1, 0), offset + Gf.Vec3f(0, 1, 0)])
+        return usdex.core.definePolyMesh(parent, name, Vt.IntArray([4]), Vt.IntArray([0, 1, 2, 3]), points)
+
+    def defineComponent(self, parent: Usd.Prim, name: str, transform: Gf.Transform) -> Usd.Prim:
+        prim = usdex.core.defineXform(parent, name, transform).GetPrim()
+        Usd.ModelAPI(prim).SetKind(Kind.Tokens.component)
+        return prim
+
+    def computeExtentsHint(self, prim: Usd.Prim, useExtentsHint: bool) -> Vt.Vec3fArray:
+        bboxCache = UsdGeom.BBoxCache(Usd.TimeCode.Default(), UsdGeom.Imageable.GetOrderedPurposeTokens(), useExtentsHint=useExtentsHint)
+        return UsdGeom.ModelAPI(prim).ComputeExtentsHint(bboxCache)
+
+    def assertExtentsHintClose(self, prim: Usd.Prim, expected: Vt.Vec3fArray):
+        self.assertTrue(prim.HasAPI(UsdGeom.ModelAPI), prim.GetPath())
+        actual = UsdGeom.ModelAPI(prim).GetExtentsHintAttr().Get()
+        self.assertEqual(len(actual), len(expected))
+        for a, e in zip(actual, expected):
+            self.assertTrue(Gf.IsClose(a, e, 1e-5), f"{prim.GetPath()}: {a} != {e}")
+
+    def testAuthorExtentsHints(self):
+        stage = self.createStage()
+        world = stage.GetDefaultPrim()
+        groupTransform = Gf.Transform()
+        groupTransform.SetTranslation(Gf.Vec3d(10, 0, 0))
+        groupTransform.SetRotation(Gf.Rotation(Gf.Vec3d(0, 0, 1), 45))
+        group = usdex.core.defineXform(world, "Group", groupTransform).GetPrim()
+        Usd.ModelAPI(group).SetKind(Kind.Tokens.group)
+        partTransform = Gf.Transform()
+        partTransform.SetTranslation(Gf.Vec3d(0, 5, 0))
+        partA = self.defineComponent(group, "PartA", partTransform)
+        mesh = self.defineQuad(partA, "Mesh", Gf.Vec3f(0, 0, 0))
+        meshTransform = Gf.Transform()
+        meshTransform.SetRotation(Gf.Rotation(Gf.Vec3d(1, 0, 0), 30))
+        usdex.core.setLocalTransform(mesh.GetPrim(), meshTransform)
+        guide = self.defineQuad(partA, "Guide", Gf.Vec3f(-3, -3, -3))
+        guide.GetPurposeAttr().Set(UsdGeom.Tokens.guide)
+        partB = self.defineComponent(world, "PartB", Gf.Transform())
+        usdex.core.definePointCloud(partB, "Points", Vt.Vec3fArray([Gf.Vec3f(-1, -2, -3), Gf.Vec3f(4, 5, 6)]))
+        # a non-model prim only contributes to its ancestors
+        scope = usdex.core.defineScope(world, "Scope").GetPrim()
+        self.defineQuad(scope, "Mesh", Gf.Vec3f(20, 0, 0))
+
+        # the models are not rotated relative to their nested models, so the hints match the exact bounds
+        expected = {prim: self.computeExtentsHint(prim, useExtentsHint=False) for prim in (partA, partB, group)}
+        with usdex.test.ScopedDiagnosticChecker(self):
+            self.assertTrue(usdex.core.authorExtentsHints(group))
+        self.assertExtentsHintClose(partA, expected[partA])
+        self.assertExtentsHintClose(group, expected[group])
+        self.assertFalse(world.HasAPI(UsdGeom.ModelAPI))
+
+        # the bound of each nested model is its extents hint, as per a bbox cache which uses the extents hints
+        expected[world] = self.computeExtentsHint(world, useExtentsHint=True)
+        with usdex.test.ScopedDiagnosticChecker(self):
+            self.assertTrue(usdex.core.authorExtentsHints(world))
+        for prim, extentsHint in expected.items():
+            self.assertExtentsHintClose(prim, extentsHint)
+        self.assertFalse(scope.HasAPI(UsdGeom.ModelAPI))
+
+        # the guide purpose holds the bounds of the guide mesh
+        self.assertEqual(len(UsdGeom.ModelAPI(partA).GetExtentsHintAttr().Get()), 8)
+        self.assertEqual(len(UsdGeom.ModelAPI(partB).GetExtentsHintAttr().Get()), 2)
+        self.assertIsValidUsd(stage)
+
+    def testTimeSample(self):
+        stage = self.createStage()
+        world = stage.GetDefaultPrim()
+        part = self.defineComponent(world, "Part", Gf.Transform())
+        self.defineQuad(part, "Mesh", Gf.Vec3f(1, 2, 3))
+
+        self.assertTrue(usdex.core.authorExtentsHints(world, 10.0))
+        attr = UsdGeom.ModelAPI(world).GetExtentsHintAttr()
+        self.assertEqual(attr.GetTimeSamples(), [10.0])
+        self.assertEqual(attr.Get(10.0), Vt.Vec3fArray([Gf.Vec3f(1, 2, 3), Gf.Vec3f(2, 3, 3)]))
+
+    def testUnloadedPayload(self):
+        stage = self.createStage()
+        world = stage.GetDefaultPrim()
+
+        # an unloaded payload contributes its authored extents hint
+        assetStage = self.createStage()
+        self.defineQuad(assetStage.GetDefaultPrim(), "Mesh", Gf.Vec3f(0, 0, 0))
+        self.assertTrue(usdex.core.authorExtentsHints(assetStage.GetDefaultPrim()))
+        payload = usdex.core.defineXform(world, "Asset").GetPrim()
+        payload.GetPayloads().AddPayload(assetStage.GetRootLayer().identifier)
+        stage.Unload(payload.GetPath())
+        UsdGeom.ModelAPI.Apply(payload).CreateExtentsHintAttr(Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 1, 0)]))
+        self.assertFalse(payload.IsLoaded())
+
+        self.assertTrue(usdex.core.authorExtentsHints(world))
+        self.assertEqual(UsdGeom.ModelAPI(world).GetExtentsHintAttr().Get(), Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 1, 0)]))
+
+    def testUpdateExtentsHints(self):
+        stage = self.createStage()
+        world = stage.GetDefaultPrim()
+        partA = self.defineComponent(world, "PartA", Gf.Transform())
+        meshA = self.defineQuad(partA, "Mesh", Gf.Vec3f(0, 0, 0))
+        partB = self.defineComponent(world, "PartB", Gf.Transform())
+        self.defineQuad(partB, "Mesh", Gf.Vec3f(5, 0, 0))
+        self.assertTrue(usdex.core.authorExtentsHints(world))
+
+        # the unedited models contribute their authored extents hints, without traversing their descendants
+        UsdGeom.ModelAPI(partB).GetExtentsHintAttr().Set(Vt.Vec3fArray([Gf.Vec3f(5, 0, 0), Gf.Vec3f(8, 1, 0)]))
+        points = Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(2, 0, 0), Gf.Vec3f(2, 2, 0), Gf.Vec3f(0, 2, 0)])
+        self.assertTrue(usdex.core.updatePolyMesh(meshA, Vt.IntArray([4]), Vt.IntArray([0, 1, 2, 3]), points))
+        self.assertTrue(usdex.core.updateExtentsHints(world, [meshA.GetPrim().GetPath()]))
+        self.assertEqual(UsdGeom.ModelAPI(partA).GetExtentsHintAttr().Get(), Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(2, 2, 0)]))
+        self.assertEqual(UsdGeom.ModelAPI(partB).GetExtentsHintAttr().Get(), Vt.Vec3fArray([Gf.Vec3f(5, 0, 0), Gf.Vec3f(8, 1, 0)]))
+        self.assertEqual(UsdGeom.ModelAPI(world).GetExtentsHintAttr().Get(), Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(8, 2, 0)]))
+
+        # edits outside of the root are ignored
+        layer = stage.GetRootLayer()
+        before = layer.ExportToString()
+        self.assertTrue(usdex.core.updateExtentsHints(partB, [meshA.GetPrim().GetPath()]))
+        self.assertEqual(layer.ExportToString(), before)
+
+    def testInvalidRoot(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid root prim")]):
+            self.assertFalse(usdex.core.authorExtentsHints(Usd.Prim()))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid root prim")]):
+            self.assertFalse(usdex.core.updateExtentsHints(Usd.Prim(), [Sdf.Path("/World")]))
+
+
 class DefineReferencePayloadBase(AssetStructureTestBase):
     """Base class for defineReference and definePayload tests.
 
@@ -719,6 +1199,11 @@ class DefineReferencePayloadBase(AssetStructureTestBase):
     def getReferencePayloadList(self, prim):
         raise NotImplementedError()
 
+    @property
+    @abstractmethod
+    def defineReferencesPayloadsFunc(self):
+        raise NotImplementedError()
+
     # This function rearranges the arguments to the defineReferencePayloadFunc to match the expected argument
     # order for the DefineFunctionTestCase class.
     def defineReferenceWrapper(self, *args):
@@ -1150,9 +1635,75 @@ class DefineReferencePayloadBase(AssetStructureTestBase):
             )
 
 
+    def testDefineMany(self):
+        self.validationEngine.enable_rule(omni.asset_validator.AnchoredAssetPathsChecker)
+        self.validationEngine.enable_rule(omni.asset_validator.SupportedFileTypesChecker)
+
+        refStage = usdex.core.createStage(
+            self.tmpFile("layout", "usda"),
+            "Layout",
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        layoutPath = refStage.GetDefaultPrim().GetPath()
+        childXform = usdex.core.defineXform(self.sourceXform.GetPrim(), "Child")
+        internalXform = usdex.core.defineXform(refStage.GetDefaultPrim(), "Internal")
+
+        # many prims targeting the same source layer, along with a non-default prim and an internal source
+        sources = [self.sourceXform.GetPrim()] * 5 + [childXform.GetPrim(), internalXform.GetPrim()]
+        paths = [layoutPath.AppendChild(f"Part_{i}") for i in range(len(sources))]
+        results = self.defineReferencesPayloadsFunc(refStage, paths, sources)
+        self.assertEqual(len(results), len(paths))
+        for result, path, source in zip(results, paths, sources):
+            self.assertReferencePayload(result, path, source, path.name)
+
+        # the results are identical to defining each prim individually
+        for i, source in enumerate(sources):
+            prim = self.defineReferencePayloadFunc(refStage, layoutPath.AppendChild(f"Single_{i}"), source)
+            self.assertEqual(self.getReferencePayloadList(prim), self.getReferencePayloadList(results[i]))
+
+        self.assertIsValidUsd(refStage)
+
+    def testDefineManyInvalid(self):
+        refStage = usdex.core.createStage(
+            self.tmpFile("layout", "usda"),
+            "Layout",
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        layoutPath = refStage.GetDefaultPrim().GetPath()
+        source = self.sourceXform.GetPrim()
+
+        # invalid locations and sources do not prevent the other prims from being defined
+        paths = [layoutPath.AppendChild("Valid"), Sdf.Path("Relative"), layoutPath.AppendChild("InvalidSource")]
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid source prim"),
+            ],
+        ):
+            results = self.defineReferencesPayloadsFunc(refStage, paths, [source, source, Usd.Prim()])
+        self.assertEqual(len(results), 3)
+        self.assertReferencePayload(results[0], paths[0], source, "Valid")
+        self.assertFalse(results[1])
+        self.assertFalse(results[2])
+        self.assertFalse(refStage.GetPrimAtPath(paths[2]))
+
+        # mismatched sizes define no prims
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched sources")]):
+            results = self.defineReferencesPayloadsFunc(refStage, [layoutPath.AppendChild("A"), layoutPath.AppendChild("B")], [source])
+        self.assertEqual(len(results), 2)
+        self.assertFalse(any(results))
+        self.assertFalse(refStage.GetPrimAtPath(layoutPath.AppendChild("A")))
+
+
 class DefineReferenceTestCase(DefineReferencePayloadBase, usdex.test.DefineFunctionTestCase):
 
     defineReferencePayloadFunc = usdex.core.defineReference
+    defineReferencesPayloadsFunc = usdex.core.defineReferences
 
     def getReferencePayloadList(self, prim):
         primSpec = prim.GetStage().GetEditTarget().GetLayer().GetPrimAtPath(prim.GetPath())
@@ -1162,7 +1713,68 @@ class DefineReferenceTestCase(DefineReferencePayloadBase, usdex.test.DefineFunct
 class DefinePayloadTestCase(DefineReferencePayloadBase, usdex.test.DefineFunctionTestCase):
 
     defineReferencePayloadFunc = usdex.core.definePayload
+    defineReferencesPayloadsFunc = usdex.core.definePayloads
 
     def getReferencePayloadList(self, prim):
         primSpec = prim.GetStage().GetEditTarget().GetLayer().GetPrimAtPath(prim.GetPath())
         return primSpec.payloadList.prependedItems
+
+
+class InstanceRepeatedReferencesTestCase(usdex.test.TestCase):
+
+    def createStage(self, name: str) -> Usd.Stage:
+        return usdex.core.createStage(
+            self.tmpFile(name, "usda"),
+            name,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+
+    def testInstanceRepeatedReferences(self):
+        libraryStage = self.createStage("library")
+        library = libraryStage.GetDefaultPrim()
+        partA = usdex.core.defineXform(library, "PartA").GetPrim()
+        usdex.core.defineXform(partA, "Child")
+        partB = usdex.core.defineXform(library, "PartB").GetPrim()
+        partC = usdex.core.defineXform(library, "PartC").GetPrim()
+
+        layoutStage = self.createStage("layout")
+        layout = layoutStage.GetDefaultPrim().GetPath()
+        sources = [partA] * 4 + [partB] * 2 + [partC]
+        paths = [layout.AppendChild(f"Part_{i}") for i in range(len(sources))]
+        prims = usdex.core.defineReferences(layoutStage, paths, sources)
+        self.assertTrue(all(prims))
+
+        # opinions on the instance prim itself are allowed
+        self.assertTrue(usdex.core.setLocalTransform(prims[0], Gf.Transform(Gf.Vec3d(1, 2, 3))))
+        # explicit instanceable opinions are respected
+        prims[2].SetInstanceable(False)
+        # descendant opinions would be ignored by an instance, so the prim is not considered
+        layoutStage.OverridePrim(paths[3].AppendChild("Child")).SetActive(False)
+
+        report = usdex.core.instanceRepeatedReferences(layoutStage)
+        self.assertEqual(report.candidatePrims, 5)
+        self.assertEqual(report.instancedPrims, 4)
+        self.assertEqual(report.prototypes, 2)
+        self.assertEqual(report.instancingRatio, 2.0)
+
+        self.assertEqual([prim.IsInstance() for prim in prims], [True, True, False, False, True, True, False])
+        self.assertEqual(len(layoutStage.GetPrototypes()), 2)
+        self.assertEqual(prims[0].GetPrototype(), prims[1].GetPrototype())
+        self.assertEqual(usdex.core.getLocalTransform(prims[0]).GetTranslation(), Gf.Vec3d(1, 2, 3))
+
+        # a second pass only considers the prim which was not repeated, as the others now have an authored instanceable value
+        report = usdex.core.instanceRepeatedReferences(layoutStage, minInstances=1)
+        self.assertEqual(report.candidatePrims, 1)
+        self.assertEqual(report.instancedPrims, 1)
+        self.assertEqual(report.prototypes, 1)
+        self.assertTrue(prims[6].IsInstance())
+
+        self.assertIsValidUsd(layoutStage)
+
+    def testInvalidStage(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid stage")]):
+            report = usdex.core.instanceRepeatedReferences(None)
+        self.assertEqual(report.candidatePrims, 0)
+        self.assertEqual(report.instancingRatio, 0.0)
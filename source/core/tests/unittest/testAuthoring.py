@@ -0,0 +1,355 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import os
+import threading
+
+import usdex.core
+import usdex.test
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdPhysics, Vt
+
+
+class AuthoringBackendTest(usdex.test.TestCase):
+
+    def testDefaultBackend(self):
+        self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eUsd)
+
+    def testScopedBackend(self):
+        with usdex.core.ScopedAuthoringBackend(usdex.core.AuthoringBackend.eSdf):
+            self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eSdf)
+            # scopes can be nested
+            with usdex.core.ScopedAuthoringBackend(usdex.core.AuthoringBackend.eUsd):
+                self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eUsd)
+            self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eSdf)
+        self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eUsd)
+
+        # the previous backend is restored when an exception is raised
+        with self.assertRaises(RuntimeError):
+            with usdex.core.ScopedAuthoringBackend(usdex.core.AuthoringBackend.eSdf):
+                raise RuntimeError("expected")
+        self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eUsd)
+
+    def testBackendIsPerThread(self):
+        results = []
+
+        def target():
+            results.append(usdex.core.getAuthoringBackend())
+
+        with usdex.core.ScopedAuthoringBackend(usdex.core.AuthoringBackend.eSdf):
+            thread = threading.Thread(target=target)
+            thread.start()
+            thread.join()
+        self.assertEqual(results, [usdex.core.AuthoringBackend.eUsd])
+
+    def testSdfBackendAuthoringSession(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, "World", UsdGeom.Tokens.y, UsdGeom.LinearUnits.centimeters, self.defaultAuthoringMetadata)
+        world = usdex.core.defineXform(stage, "/World")
+
+        with usdex.core.ScopedAuthoringBackend(usdex.core.AuthoringBackend.eSdf):
+            for i in range(10):
+                xform = usdex.core.defineXform(world.GetPrim(), f"Xform_{i}")
+                self.assertTrue(xform)
+                scope = usdex.core.defineScope(xform.GetPrim(), "Scope")
+                self.assertTrue(scope)
+
+        layer = stage.GetRootLayer()
+        for i in range(10):
+            primSpec = layer.GetPrimAtPath(f"/World/Xform_{i}/Scope")
+            self.assertTrue(primSpec)
+            self.assertEqual(primSpec.specifier, Sdf.SpecifierDef)
+            self.assertEqual(primSpec.typeName, "Scope")
+        self.assertIsValidUsd(stage)
+
+
+class ValidationPolicyTest(usdex.test.TestCase):
+
+    def testDefaultPolicy(self):
+        self.assertEqual(usdex.core.getValidationPolicy(), usdex.core.ValidationPolicy.eFull)
+
+    def testScopedPolicy(self):
+        with usdex.core.ScopedValidationPolicy(usdex.core.ValidationPolicy.eTrusted):
+            self.assertEqual(usdex.core.getValidationPolicy(), usdex.core.ValidationPolicy.eTrusted)
+            # scopes can be nested
+            with usdex.core.ScopedValidationPolicy(usdex.core.ValidationPolicy.eDebug):
+                self.assertEqual(usdex.core.getValidationPolicy(), usdex.core.ValidationPolicy.eDebug)
+            self.assertEqual(usdex.core.getValidationPolicy(), usdex.core.ValidationPolicy.eTrusted)
+        self.assertEqual(usdex.core.getValidationPolicy(), usdex.core.ValidationPolicy.eFull)
+
+        # the previous policy is restored when an exception is raised
+        with self.assertRaises(RuntimeError):
+            with usdex.core.ScopedValidationPolicy(usdex.core.ValidationPolicy.eTrusted):
+                raise RuntimeError("expected")
+        self.assertEqual(usdex.core.getValidationPolicy(), usdex.core.ValidationPolicy.eFull)
+
+    def testPolicyIsPerThread(self):
+        results = []
+
+        def target():
+            results.append(usdex.core.getValidationPolicy())
+
+        with usdex.core.ScopedValidationPolicy(usdex.core.ValidationPolicy.eTrusted):
+            thread = threading.Thread(target=target)
+            thread.start()
+            thread.join()
+        self.assertEqual(results, [usdex.core.ValidationPolicy.eFull])
+
+
+class AuthoringSessionTest(usdex.test.TestCase):
+
+    def testSession(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, "World", UsdGeom.Tokens.y, UsdGeom.LinearUnits.centimeters, self.defaultAuthoringMetadata)
+        world = usdex.core.defineXform(stage, "/World")
+        sublayer = Sdf.Layer.CreateAnonymous()
+        stage.GetRootLayer().subLayerPaths.append(sublayer.identifier)
+
+        with usdex.core.AuthoringSession(stage, Usd.EditTarget(sublayer)) as session:
+            self.assertTrue(session.isActive())
+            self.assertEqual(session.getStage(), stage)
+            self.assertEqual(stage.GetEditTarget().GetLayer(), sublayer)
+            self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eSdf)
+
+            # The stage metrics are cached when the session begins
+            self.assertEqual(session.getUpAxis(), UsdGeom.Tokens.y)
+            self.assertEqual(session.getLinearUnits(), UsdGeom.LinearUnits.centimeters)
+            self.assertEqual(session.getMassUnits(), UsdPhysics.MassUnits.kilograms)
+
+            # The names are unique amongst the names produced by the session
+            names = []
+            for _ in range(3):
+                name, reason = session.getEditableChildName(world.GetPrim(), "Child")
+                self.assertEqual(reason, "")
+                self.assertTrue(usdex.core.defineXform(world.GetPrim(), name))
+                names.append(name)
+            self.assertEqual(names, ["Child", "Child_1", "Child_2"])
+            self.assertEqual(session.getNameCache().getPrimName(world.GetPrim(), "Child"), "Child_3")
+
+            self.assertEqual(session.isEditablePrimLocation("/World/Child"), usdex.core.isEditablePrimLocation(stage, "/World/Child"))
+            result, reason = session.isEditablePrimLocation("relative")
+            self.assertFalse(result)
+            self.assertRegex(reason, ".*is not a valid absolute prim path")
+
+            name, reason = session.getEditableChildName(Usd.Prim(), "Child")
+            self.assertEqual(name, "")
+            self.assertRegex(reason, ".*Invalid UsdPrim")
+
+        # The previous edit target and backend are restored
+        self.assertFalse(session.isActive())
+        self.assertEqual(stage.GetEditTarget().GetLayer(), stage.GetRootLayer())
+        self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eUsd)
+        for name in names:
+            self.assertTrue(sublayer.GetPrimAtPath(f"/World/{name}"))
+            self.assertFalse(stage.GetRootLayer().GetPrimAtPath(f"/World/{name}"))
+
+        # Ending a session twice has no effect
+        session.end()
+        self.assertFalse(session.isActive())
+
+    def testInstanceProxyLocations(self):
+        stage = Usd.Stage.CreateInMemory()
+        stage.CreateClassPrim("/Prototypes")
+        UsdGeom.Xform.Define(stage, "/Prototypes/Prototype")
+        UsdGeom.Xform.Define(stage, "/Prototypes/Prototype/InstanceProxyChild")
+        xformPrim = UsdGeom.Xform.Define(stage, "/World/Instance").GetPrim()
+        xformPrim.GetReferences().AddInternalReference(Sdf.Path("/Prototypes/Prototype"))
+        xformPrim.SetInstanceable(True)
+
+        with usdex.core.AuthoringSession(stage) as session:
+            result, reason = session.isEditablePrimLocation(f"{xformPrim.GetPath()}/InstanceProxyChild")
+            self.assertFalse(result)
+            self.assertRegex(reason, ".*is an instance proxy, authoring is not allowed")
+            self.assertEqual(session.isEditablePrimLocation(f"{xformPrim.GetPath()}/NewChild"), (True, ""))
+
+            instanceProxyChild = stage.GetPrimAtPath(f"{xformPrim.GetPath()}/InstanceProxyChild")
+            name, reason = session.getEditableChildName(instanceProxyChild, "grandchild")
+            self.assertEqual(name, "")
+            self.assertRegex(reason, ".*is an instance proxy, authoring is not allowed")
+
+            # The define functions validate their locations using the cache of the session
+            expected = ".*is an instance proxy, authoring is not allowed"
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, expected)]):
+                self.assertFalse(usdex.core.defineXform(stage, f"{xformPrim.GetPath()}/InstanceProxyChild"))
+            self.assertTrue(usdex.core.defineXform(stage, "/World/Child"))
+            self.assertTrue(usdex.core.defineXform(stage, "/World/Child/Grandchild"))
+            results, _ = usdex.core.areEditablePrimLocations(stage, [f"{xformPrim.GetPath()}/InstanceProxyChild", "/World/Child"])
+            self.assertEqual(results, [False, True])
+
+
+class AuthorLayersConcurrentlyTest(usdex.test.TestCase):
+
+    def createStage(self) -> Usd.Stage:
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, "World", UsdGeom.Tokens.y, UsdGeom.LinearUnits.centimeters, self.defaultAuthoringMetadata)
+        usdex.core.defineXform(stage, "/World")
+        return stage
+
+    def testAuthorLayers(self):
+        stage = self.createStage()
+        expected = stage.GetRootLayer().ExportToString()
+
+        def authorGeometry(session):
+            self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eSdf)
+            self.assertEqual(session.getUpAxis(), UsdGeom.Tokens.y)
+            scope = usdex.core.defineScope(session.getStage().GetDefaultPrim(), "Geometry").GetPrim()
+            return all(usdex.core.defineXform(scope, session.getEditableChildName(scope, "Part")[0]) for _ in range(3))
+
+        def authorMaterials(session):
+            return bool(usdex.core.defineScope(session.getStage().GetDefaultPrim(), "Materials"))
+
+        layers = usdex.core.authorLayersConcurrently(stage, [authorGeometry, authorMaterials])
+        self.assertEqual(len(layers), 2)
+
+        # Each layer holds only the opinions of its worker, and the stage is not modified
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected)
+        for layer in layers:
+            self.assertTrue(layer.anonymous)
+            self.assertEqual(list(layer.subLayerPaths), [])
+            self.assertEqual(layer.defaultPrim, "World")
+            self.assertEqual(layer.GetPrimAtPath("/World").specifier, Sdf.SpecifierOver)
+        self.assertEqual(layers[0].GetPrimAtPath("/World/Geometry").nameChildren.keys(), ["Part", "Part_1", "Part_2"])
+        self.assertFalse(layers[0].GetPrimAtPath("/World/Materials"))
+        self.assertTrue(layers[1].GetPrimAtPath("/World/Materials"))
+        self.assertFalse(layers[1].GetPrimAtPath("/World/Geometry"))
+
+        # The layers can be merged into the stage without conflicts
+        self.assertEqual(usdex.core.mergeLayers(stage.GetRootLayer(), layers), (True, []))
+        self.assertEqual(stage.GetPrimAtPath("/World").GetSpecifier(), Sdf.SpecifierDef)
+        self.assertEqual([child.GetName() for child in stage.GetDefaultPrim().GetChildren()], ["Geometry", "Materials"])
+        self.assertIsValidUsd(stage)
+
+    def testValidationPolicy(self):
+        stage = self.createStage()
+        policies = []
+
+        def worker(session):
+            policies.append(usdex.core.getValidationPolicy())
+            return True
+
+        # The policy of the calling thread applies to every worker
+        with usdex.core.ScopedValidationPolicy(usdex.core.ValidationPolicy.eTrusted):
+            layers = usdex.core.authorLayersConcurrently(stage, [worker, worker])
+        self.assertTrue(all(layers))
+        self.assertEqual(policies, [usdex.core.ValidationPolicy.eTrusted] * 2)
+
+    def testFailedWorker(self):
+        stage = self.createStage()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*Unable to author layer 1")]):
+            layers = usdex.core.authorLayersConcurrently(stage, [lambda session: True, lambda session: False])
+        self.assertTrue(layers[0])
+        self.assertIsNone(layers[1])
+
+    def testInvalidStage(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid stage")]):
+            self.assertEqual(usdex.core.authorLayersConcurrently(None, [lambda session: True]), [None])
+
+
+class ValueClipSessionTest(usdex.test.TestCase):
+
+    FACE_VERTEX_COUNTS = Vt.IntArray([4])
+    FACE_VERTEX_INDICES = Vt.IntArray([0, 1, 2, 3])
+
+    def createStage(self) -> Usd.Stage:
+        stage = Usd.Stage.Open(self.tmpLayer())
+        usdex.core.configureStage(stage, "World", UsdGeom.Tokens.y, UsdGeom.LinearUnits.centimeters, self.defaultAuthoringMetadata)
+        usdex.core.defineXform(stage, "/World")
+        return stage
+
+    def frames(self, count):
+        times = [Usd.TimeCode(float(i)) for i in range(count)]
+        points = [
+            Vt.Vec3fArray([Gf.Vec3f(0.0, y, 0.0), Gf.Vec3f(0.0, y, 1.0), Gf.Vec3f(1.0, y, 1.0), Gf.Vec3f(1.0, y, 0.0)])
+            for y in (float(i) for i in range(count))
+        ]
+        return times, points
+
+    def testClips(self):
+        stage = self.createStage()
+        times, points = self.frames(10)
+        matrices = [Gf.Matrix4d().SetTranslate(Gf.Vec3d(float(i), 0.0, 0.0)) for i in range(len(times))]
+
+        options = usdex.core.ValueClipOptions(framesPerClip=4, format="usda")
+        with usdex.core.ValueClipSession(stage.GetDefaultPrim(), "Cache", options) as session:
+            self.assertTrue(session.isActive())
+            mesh = usdex.core.defineDeformingPolyMesh(stage, "/World/Mesh", self.FACE_VERTEX_COUNTS, self.FACE_VERTEX_INDICES, times, points)
+            self.assertTrue(mesh)
+            xform = usdex.core.defineXform(stage, "/World/Xform")
+            self.assertTrue(usdex.core.setLocalTransform(xform.GetPrim(), times, matrices))
+        self.assertFalse(session.isActive())
+        expectedAssetPaths = ["./Cache/Cache.0000.usda", "./Cache/Cache.0001.usda", "./Cache/Cache.0002.usda"]
+        self.assertEqual(session.getClipAssetPaths(), expectedAssetPaths)
+
+        # The time samples are not authored on the edit target layer, but the attribute specs are
+        rootLayer = stage.GetRootLayer()
+        pointsSpec = rootLayer.GetAttributeAtPath("/World/Mesh.points")
+        self.assertTrue(pointsSpec)
+        self.assertFalse(pointsSpec.HasInfo("timeSamples"))
+        self.assertFalse(rootLayer.GetAttributeAtPath("/World/Xform.xformOp:transform").HasInfo("timeSamples"))
+
+        # The clips metadata activates each clip from the start of its frames
+        clipsAPI = Usd.ClipsAPI(stage.GetDefaultPrim())
+        self.assertEqual([path.path for path in clipsAPI.GetClipAssetPaths("default")], expectedAssetPaths)
+        self.assertEqual(clipsAPI.GetClipPrimPath("default"), "/World")
+        self.assertEqual(list(clipsAPI.GetClipActive("default")), [Gf.Vec2d(0, 0), Gf.Vec2d(4, 1), Gf.Vec2d(8, 2)])
+        self.assertEqual(list(clipsAPI.GetClipTimes("default")), [Gf.Vec2d(0, 0), Gf.Vec2d(9, 9)])
+        self.assertEqual(clipsAPI.GetClipManifestAssetPath("default").path, "./Cache/Cache.manifest.usda")
+
+        # Each clip holds its own frames and the first frame of the following clip
+        directory = os.path.join(os.path.dirname(rootLayer.realPath), "Cache")
+        clips = [Sdf.Layer.FindOrOpen(os.path.join(directory, f"Cache.000{i}.usda")) for i in range(3)]
+        self.assertTrue(all(clips))
+        self.assertEqual(clips[0].ListTimeSamplesForPath("/World/Mesh.points"), [0, 1, 2, 3, 4])
+        self.assertEqual(clips[1].ListTimeSamplesForPath("/World/Mesh.points"), [4, 5, 6, 7, 8])
+        self.assertEqual(clips[2].ListTimeSamplesForPath("/World/Xform.xformOp:transform"), [8, 9])
+        manifest = Sdf.Layer.FindOrOpen(os.path.join(directory, "Cache.manifest.usda"))
+        self.assertTrue(manifest.GetAttributeAtPath("/World/Mesh.points"))
+        self.assertTrue(manifest.GetAttributeAtPath("/World/Xform.xformOp:transform"))
+
+        # The stage resolves the values from the clips, including after it is reopened
+        stage.Save()
+        for resolvedStage in (stage, Usd.Stage.Open(rootLayer.identifier)):
+            mesh = UsdGeom.Mesh(resolvedStage.GetPrimAtPath("/World/Mesh"))
+            xformable = UsdGeom.Xformable(resolvedStage.GetPrimAtPath("/World/Xform"))
+            for time, framePoints, matrix in zip(times, points, matrices):
+                self.assertEqual(mesh.GetPointsAttr().Get(time), framePoints)
+                self.assertEqual(xformable.GetLocalTransformation(time), matrix)
+            # values are interpolated across the boundary between clips
+            self.assertAlmostEqual(mesh.GetPointsAttr().Get(3.5)[0][1], 3.5)
+
+    def testSamplesOutsideClipPrim(self):
+        stage = self.createStage()
+        times, points = self.frames(3)
+        usdex.core.defineXform(stage, "/World/Cache")
+
+        with usdex.core.ValueClipSession(stage.GetPrimAtPath("/World/Cache"), "Cache") as session:
+            mesh = usdex.core.defineDeformingPolyMesh(stage, "/World/Mesh", self.FACE_VERTEX_COUNTS, self.FACE_VERTEX_INDICES, times, points)
+            self.assertTrue(mesh)
+
+        # The samples of prims outside of the clip prim are authored on the edit target layer, and no clips are authored without samples
+        self.assertEqual(session.getClipAssetPaths(), [])
+        self.assertEqual(stage.GetRootLayer().ListTimeSamplesForPath("/World/Mesh.points"), [0, 1, 2])
+        self.assertFalse(Usd.ClipsAPI(stage.GetPrimAtPath("/World/Cache")).GetClipAssetPaths("default"))
+
+    def testInvalidSession(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, "World", UsdGeom.Tokens.y, UsdGeom.LinearUnits.centimeters, self.defaultAuthoringMetadata)
+        world = usdex.core.defineXform(stage, "/World").GetPrim()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*anonymous edit target layer")]):
+            session = usdex.core.ValueClipSession(world, "Cache")
+        self.assertFalse(session.isActive())
+
+        # Samples are authored on the edit target layer when the session is not active
+        times, points = self.frames(2)
+        usdex.core.defineDeformingPolyMesh(stage, "/World/Mesh", self.FACE_VERTEX_COUNTS, self.FACE_VERTEX_INDICES, times, points)
+        self.assertEqual(stage.GetRootLayer().ListTimeSamplesForPath("/World/Mesh.points"), [0, 1])
+        self.assertTrue(session.end())
+
+        stage = self.createStage()
+        world = stage.GetDefaultPrim()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*0.000000 frames per clip")]):
+            self.assertFalse(usdex.core.ValueClipSession(world, "Cache", usdex.core.ValueClipOptions(framesPerClip=0)).isActive())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid name")]):
+            self.assertFalse(usdex.core.ValueClipSession(world, "Not Valid").isActive())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*unsupported format")]):
+            self.assertFalse(usdex.core.ValueClipSession(world, "Cache", usdex.core.ValueClipOptions(format="txt")).isActive())
@@ -158,3 +158,118 @@ class DefineCameraTestCase(usdex.test.DefineFunctionTestCase):
             camera = usdex.core.defineCamera(xformPrim, cameraData)
         self.assertTrue(camera)
         self.assertEqual(camera.GetPrim().GetTypeName(), "Camera")
+
+
+class DefineAnimatedCameraTestCase(usdex.test.TestCase):
+
+    def createCameras(self, count: int):
+        times = [Usd.TimeCode(1001 + i) for i in range(count)]
+        cameras = []
+        for i in range(count):
+            transform = Gf.Transform()
+            transform.SetTranslation(Gf.Vec3d(10.0 * i, 20.0, 30.0))
+            transform.SetRotation(Gf.Rotation(Gf.Vec3d.YAxis(), 5.0 * i))
+            # the focal length and focus distance are animated, while the apertures and clipping are constant
+            cameras.append(
+                Gf.Camera(
+                    transform=transform.GetMatrix(),
+                    focalLength=35.0 + i,
+                    focusDistance=100.0 + 10.0 * i,
+                    clippingRange=Gf.Range1f(0.1, 10000.0),
+                )
+            )
+        return times, cameras
+
+    def assertMatchesSetFromCamera(self, camera: UsdGeom.Camera, times, cameras):
+        # author a sibling camera one frame at a time, which is the behavior being replicated
+        stage = camera.GetPrim().GetStage()
+        expected = UsdGeom.Camera.Define(stage, camera.GetPath().ReplaceName(camera.GetPrim().GetName() + "Expected"))
+        for time, cameraData in zip(times, cameras):
+            expected.SetFromCamera(cameraData, time)
+
+        for time in times:
+            actual = camera.GetCamera(time)
+            reference = expected.GetCamera(time)
+            self.assertTrue(Gf.IsClose(actual.transform, reference.transform, 1e-6))
+            self.assertEqual(actual.projection, reference.projection)
+            self.assertAlmostEqual(actual.horizontalAperture, reference.horizontalAperture, places=5)
+            self.assertAlmostEqual(actual.verticalAperture, reference.verticalAperture, places=5)
+            self.assertAlmostEqual(actual.focalLength, reference.focalLength, places=5)
+            self.assertAlmostEqual(actual.focusDistance, reference.focusDistance, places=5)
+            self.assertAlmostEqual(actual.fStop, reference.fStop, places=5)
+            self.assertEqual(actual.clippingRange, reference.clippingRange)
+            self.assertEqual(actual.clippingPlanes, reference.clippingPlanes)
+
+    def testDefineAnimatedCamera(self):
+        stage = Usd.Stage.CreateInMemory()
+        times, cameras = self.createCameras(24)
+        camera = usdex.core.defineAnimatedCamera(stage, Sdf.Path("/Camera"), times, cameras)
+        self.assertTrue(camera)
+        self.assertEqual(camera.GetPrim().GetTypeName(), "Camera")
+        self.assertIsValidUsd(stage)
+        self.assertMatchesSetFromCamera(camera, times, cameras)
+
+        # the animated attributes are authored as time samples
+        for attr in (camera.GetFocalLengthAttr(), camera.GetFocusDistanceAttr(), UsdGeom.Xformable(camera).GetOrderedXformOps()[0].GetAttr()):
+            self.assertEqual(attr.GetTimeSamples(), [time.GetValue() for time in times], attr.GetName())
+
+        # the constant attributes are authored as default values
+        for attr in (
+            camera.GetProjectionAttr(),
+            camera.GetHorizontalApertureAttr(),
+            camera.GetVerticalApertureAttr(),
+            camera.GetClippingRangeAttr(),
+            camera.GetClippingPlanesAttr(),
+            camera.GetFStopAttr(),
+        ):
+            self.assertTrue(attr.HasAuthoredValue(), attr.GetName())
+            self.assertEqual(attr.GetNumTimeSamples(), 0, attr.GetName())
+        self.assertEqual(camera.GetClippingRangeAttr().Get(), Gf.Vec2f(0.1, 10000.0))
+
+        # a single frame authors only default values
+        camera = usdex.core.defineAnimatedCamera(stage, Sdf.Path("/Still"), times[:1], cameras[:1])
+        self.assertTrue(camera)
+        self.assertEqual(camera.GetFocalLengthAttr().GetNumTimeSamples(), 0)
+        self.assertAlmostEqual(camera.GetFocalLengthAttr().Get(), 35.0)
+
+    def testAnimatedParent(self):
+        stage = Usd.Stage.CreateInMemory()
+        rig = usdex.core.defineXform(stage, "/Rig")
+        times, cameras = self.createCameras(5)
+        self.assertTrue(
+            usdex.core.setLocalTransform(rig.GetPrim(), times, [Gf.Matrix4d().SetTranslate(Gf.Vec3d(0, i, 0)) for i in range(len(times))])
+        )
+
+        # the world space transform of each frame is retained, even though the parent is animated
+        camera = usdex.core.defineAnimatedCamera(stage, Sdf.Path("/Rig/Camera"), times, cameras)
+        self.assertTrue(camera)
+        for time, cameraData in zip(times, cameras):
+            worldTransform = camera.ComputeLocalToWorldTransform(time)
+            self.assertTrue(Gf.IsClose(worldTransform, cameraData.transform, 1e-6))
+
+        # a static parent is also accounted for
+        static = usdex.core.defineXform(stage, "/Static")
+        self.assertTrue(usdex.core.setLocalTransform(static.GetPrim(), Gf.Matrix4d().SetTranslate(Gf.Vec3d(5, 0, 0))))
+        camera = usdex.core.defineAnimatedCamera(stage, Sdf.Path("/Static/Camera"), times, cameras)
+        self.assertTrue(camera)
+        for time, cameraData in zip(times, cameras):
+            self.assertTrue(Gf.IsClose(camera.ComputeLocalToWorldTransform(time), cameraData.transform, 1e-6))
+        self.assertIsValidUsd(stage)
+
+    def testInvalidFrames(self):
+        stage = Usd.Stage.CreateInMemory()
+        times, cameras = self.createCameras(3)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Expected 3 cameras but found 2")]):
+            self.assertFalse(usdex.core.defineAnimatedCamera(stage, Sdf.Path("/Camera"), times, cameras[:2]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*No frames were provided")]):
+            self.assertFalse(usdex.core.defineAnimatedCamera(stage, Sdf.Path("/Camera"), [], []))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*default time code is not valid")]):
+            self.assertFalse(usdex.core.defineAnimatedCamera(stage, Sdf.Path("/Camera"), [times[0], Usd.TimeCode.Default(), times[2]], cameras))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.core.defineAnimatedCamera(stage, Sdf.Path("Relative"), times, cameras))
+
+        self.assertFalse(stage.GetPrimAtPath("/Camera"))
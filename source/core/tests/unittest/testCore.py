@@ -26,11 +26,23 @@ class CoreTest(unittest.TestCase):
         version = get_changelog_version_string()
         self.assertEqual(usdex.core.buildVersion().split("+")[0], version)
 
+    def testInitialize(self):
+        # Initialization may continue in the background, and waiting for it later completes it
+        usdex.core.initialize(wait=False)
+        usdex.core.initialize()
+        self.assertTrue(usdex.core.isInitialized())
+
+        # Repeated calls are cheap and have no effect
+        usdex.core.initialize()
+        self.assertTrue(usdex.core.isInitialized())
+
     def testModuleSymbols(self):
         allowList = [
             "os",  # module necessary to locate bindings on windows
             "_usdex_core",  # our binding module
             "_AssetStructureBindings",  # hand rolled binding
+            "_AuthoringBindings",  # hand rolled binding
+            "_DiagnosticsBindings",  # hand rolled binding
             "_StageAlgoBindings",  # hand rolled binding
         ]
         allowList.extend([x for x in dir(usdex.core) if x.startswith("__")])  # private members
@@ -1694,3 +1694,50 @@ class CurvesAlgoPrimOverloadTest(usdex.test.TestCase):
             curves = usdex.core.defineCubicBasisCurves(xformPrim, CURVE_VERTEX_COUNTS, POINTS, UsdGeom.Tokens.bezier)
         self.assertTrue(curves)
         self.assertEqual(curves.GetPrim().GetTypeName(), "BasisCurves")
+
+
+class LargeBasisCurvesTestCase(usdex.test.TestCase):
+
+    # Enough curves to be validated in parallel chunks
+    numCurves = 200000
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        stage.SetDefaultPrim(UsdGeom.Xform.Define(stage, "/World").GetPrim())
+        return stage
+
+    def testValidTopology(self):
+        stage = self.createTestStage()
+        curveVertexCounts = Vt.IntArray([7] * self.numCurves)
+        points = Vt.Vec3fArray(7 * self.numCurves)
+        curves = usdex.core.defineCubicBasisCurves(stage, "/World/Groom", curveVertexCounts, points, UsdGeom.Tokens.bezier)
+        self.assertTrue(curves)
+        self.assertEqual(len(curves.GetCurveVertexCountsAttr().Get()), self.numCurves)
+
+    def testFirstInvalidCurveIsReported(self):
+        stage = self.createTestStage()
+        counts = [7] * self.numCurves
+        counts[150001] = 6
+        counts[190000] = 2
+        curveVertexCounts = Vt.IntArray(counts)
+        points = Vt.Vec3fArray(sum(counts))
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology.*6 vertices were provided for curve 150001")],
+        ):
+            curves = usdex.core.defineCubicBasisCurves(stage, "/World/Groom", curveVertexCounts, points, UsdGeom.Tokens.bezier)
+        self.assertFalse(curves)
+        self.assertFalse(stage.GetPrimAtPath("/World/Groom"))
+
+    def testTotalVertexCount(self):
+        stage = self.createTestStage()
+        curveVertexCounts = Vt.IntArray([2] * self.numCurves)
+        points = Vt.Vec3fArray(2 * self.numCurves - 1)
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, f".*invalid topology.*points \\({len(points)}\\) does not match.*\\({2 * self.numCurves}\\)")],
+        ):
+            curves = usdex.core.defineLinearBasisCurves(stage, "/World/Groom", curveVertexCounts, points)
+        self.assertFalse(curves)
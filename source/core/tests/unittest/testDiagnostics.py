@@ -28,7 +28,14 @@ class DiagnosticsTest(usdex.test.TestCase):
         usdex.core.setDiagnosticsLevel(usdex.core.DiagnosticsLevel.eWarning)
         usdex.core.setDiagnosticsOutputStream(usdex.core.DiagnosticsOutputStream.eStderr)
 
-    def assertOutputStreams(self, command, expectedStdout: List[str], expectedStderr: List[str], expectSuccess: bool = True):
+    def assertOutputStreams(
+        self,
+        command,
+        expectedStdout: List[str],
+        expectedStderr: List[str],
+        expectSuccess: bool = True,
+        orderedStderr: bool = True,
+    ):
 
         # PXR env vars that drive TfEnvSettings can cause extra stderr output
         # We aren't concerned with any non-default behavior in these tests, so
@@ -82,6 +89,9 @@ Stderr:
         if expectSuccess:
             error = result.stderr.strip("\n").split("\n") if result.stderr else []
             self.assertEqual(len(error), len(expectedStderr), msg=failureMessage)
+            if not orderedStderr:
+                error = sorted(error)
+                expectedStderr = sorted(expectedStderr)
             for i in range(0, len(expectedStderr)):
                 self.assertEqual(error[i], expectedStderr[i])
         else:
@@ -267,6 +277,355 @@ Stderr:
             expectedStderr=[],
         )
 
+    def testAsyncOutput(self):
+        self.assertFalse(usdex.core.isDiagnosticsOutputAsync())
+
+        command = inspect.cleandoc(
+            """
+            import sys
+            import usdex.core
+            from pxr import Tf
+
+            usdex.core.activateDiagnosticsDelegate()
+            usdex.core.setDiagnosticsOutputAsync(True)
+            assert usdex.core.isDiagnosticsOutputAsync()
+
+            def emitDiagnostics():
+                for i in range(3):
+                    Tf.Warn(f"This is warning {{i}}")
+
+            emitDiagnostics()
+            {body}
+            """
+        )
+
+        # queued diagnostics are written in order when flushed
+        self.assertOutputStreams(
+            command=command.format(
+                body=inspect.cleandoc(
+                    """
+                    usdex.core.flushDiagnostics()
+                    sys.stderr.write("Written after the flush\\n")
+                    """
+                )
+            ),
+            expectedStdout=[],
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is warning 0",
+                "[Warning] [__main__.emitDiagnostics] This is warning 1",
+                "[Warning] [__main__.emitDiagnostics] This is warning 2",
+                "Written after the flush",
+            ],
+        )
+
+        # deactivating the delegate flushes the queue, and subsequent diagnostics use the default formatting
+        self.assertOutputStreams(
+            command=command.format(
+                body=inspect.cleandoc(
+                    """
+                    usdex.core.deactivateDiagnosticsDelegate()
+                    sys.stderr.write("Written after deactivation\\n")
+                    """
+                )
+            ),
+            expectedStdout=[],
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is warning 0",
+                "[Warning] [__main__.emitDiagnostics] This is warning 1",
+                "[Warning] [__main__.emitDiagnostics] This is warning 2",
+                "Written after deactivation",
+            ],
+        )
+
+        # disabling async output writes any queued diagnostics and then writes synchronously
+        self.assertOutputStreams(
+            command=command.format(
+                body=inspect.cleandoc(
+                    """
+                    usdex.core.setDiagnosticsOutputAsync(False)
+                    assert not usdex.core.isDiagnosticsOutputAsync()
+                    sys.stderr.write("Written synchronously\\n")
+                    emitDiagnostics()
+                    """
+                )
+            ),
+            expectedStdout=[],
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is warning 0",
+                "[Warning] [__main__.emitDiagnostics] This is warning 1",
+                "[Warning] [__main__.emitDiagnostics] This is warning 2",
+                "Written synchronously",
+                "[Warning] [__main__.emitDiagnostics] This is warning 0",
+                "[Warning] [__main__.emitDiagnostics] This is warning 1",
+                "[Warning] [__main__.emitDiagnostics] This is warning 2",
+            ],
+        )
+
+        # disabling async output while another thread is emitting diagnostics does not lose any of them
+        # the emitting thread is never blocked by the writer stopping, so the diagnostics written directly may precede those still queued
+        numWarnings = 500
+        self.assertOutputStreams(
+            command=command.format(
+                body=inspect.cleandoc(
+                    f"""
+                    import threading
+
+                    def emitMany():
+                        for i in range({numWarnings}):
+                            Tf.Warn(f"This is concurrent warning {{i}}")
+
+                    thread = threading.Thread(target=emitMany)
+                    thread.start()
+                    usdex.core.setDiagnosticsOutputAsync(False)
+                    thread.join()
+                    """
+                )
+            ),
+            expectedStdout=[],
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is warning 0",
+                "[Warning] [__main__.emitDiagnostics] This is warning 1",
+                "[Warning] [__main__.emitDiagnostics] This is warning 2",
+            ]
+            + [f"[Warning] [__main__.emitMany] This is concurrent warning {i}" for i in range(numWarnings)],
+            orderedStderr=False,
+        )
+
+        # queued diagnostics are not lost at exit
+        self.assertOutputStreams(
+            command=command.format(body="pass"),
+            expectedStdout=[],
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is warning 0",
+                "[Warning] [__main__.emitDiagnostics] This is warning 1",
+                "[Warning] [__main__.emitDiagnostics] This is warning 2",
+            ],
+        )
+
+    def testLimits(self):
+        limits = usdex.core.getDiagnosticsLimits()
+        self.assertEqual(limits.repeatsPerSite, 0)
+        self.assertEqual(limits.ratePerSecond, 0.0)
+        self.assertEqual(limits.burst, 100)
+
+        command = inspect.cleandoc(
+            """
+            import usdex.core
+            from pxr import Tf
+
+            usdex.core.activateDiagnosticsDelegate()
+            usdex.core.setDiagnosticsLimits(usdex.core.DiagnosticsLimits({limits}))
+
+            def emitDiagnostics():
+                for i in range(5):
+                    Tf.Warn(f"This is warning {{i}}")
+                Tf.Warn("This is another site")
+
+            emitDiagnostics()
+            usdex.core.flushDiagnostics()
+            emitDiagnostics()
+            usdex.core.deactivateDiagnosticsDelegate()
+            """
+        )
+
+        # repeats from each call site are suppressed and summarized, after which the count restarts
+        expected = [
+            "[Warning] [__main__.emitDiagnostics] This is warning 0",
+            "[Warning] [__main__.emitDiagnostics] This is warning 1",
+            "[Warning] [__main__.emitDiagnostics] This is another site",
+            "[Warning] [__main__.emitDiagnostics] Suppressed 3 repeated diagnostics. The first suppressed was: This is warning 2",
+        ]
+        self.assertOutputStreams(
+            command=command.format(limits="repeatsPerSite=2"),
+            expectedStdout=[],
+            expectedStderr=expected + expected,
+        )
+
+        # the rate limit applies across all call sites once the burst is exhausted
+        self.assertOutputStreams(
+            command=command.format(limits="ratePerSecond=0.001, burst=2"),
+            expectedStdout=[],
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is warning 0",
+                "[Warning] [__main__.emitDiagnostics] This is warning 1",
+                "[Suppressed] 4 diagnostics exceeded the rate limit",
+                "[Suppressed] 6 diagnostics exceeded the rate limit",
+            ],
+        )
+
+    def testThreadLevel(self):
+        self.assertIsNone(usdex.core.getThreadDiagnosticsLevel())
+        with usdex.core.ScopedDiagnosticsLevel(usdex.core.DiagnosticsLevel.eError):
+            self.assertEqual(usdex.core.getThreadDiagnosticsLevel(), usdex.core.DiagnosticsLevel.eError)
+            with usdex.core.ScopedDiagnosticsLevel(usdex.core.DiagnosticsLevel.eStatus):
+                self.assertEqual(usdex.core.getThreadDiagnosticsLevel(), usdex.core.DiagnosticsLevel.eStatus)
+            self.assertEqual(usdex.core.getThreadDiagnosticsLevel(), usdex.core.DiagnosticsLevel.eError)
+        self.assertIsNone(usdex.core.getThreadDiagnosticsLevel())
+        # the thread level does not change the level of the delegate
+        self.assertEqual(usdex.core.getDiagnosticsLevel(), usdex.core.DiagnosticsLevel.eWarning)
+
+        command = inspect.cleandoc(
+            """
+            import threading
+            import usdex.core
+            from pxr import Tf
+
+            usdex.core.activateDiagnosticsDelegate()
+
+            def emitDiagnostics():
+                Tf.Warn("This is a warning")
+                Tf.Status("This is a status")
+
+            def emitQuietly():
+                with usdex.core.ScopedDiagnosticsLevel(usdex.core.DiagnosticsLevel.eError):
+                    emitDiagnostics()
+
+            emitDiagnostics()
+            emitQuietly()
+            usdex.core.setThreadDiagnosticsLevel(usdex.core.DiagnosticsLevel.eStatus)
+            emitDiagnostics()
+
+            # other threads use the level of the delegate
+            thread = threading.Thread(target=emitDiagnostics)
+            thread.start()
+            thread.join()
+
+            usdex.core.setThreadDiagnosticsLevel(None)
+            emitDiagnostics()
+            """
+        )
+        self.assertOutputStreams(
+            command=command,
+            expectedStdout=[],
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is a warning",
+                "[Warning] [__main__.emitDiagnostics] This is a warning",
+                "[Status] [__main__.emitDiagnostics] This is a status",
+                "[Warning] [__main__.emitDiagnostics] This is a warning",
+                "[Warning] [__main__.emitDiagnostics] This is a warning",
+            ],
+        )
+
+    def testCounters(self):
+        self.assertFalse(usdex.core.isDiagnosticsCountingEnabled())
+        self.assertEqual(usdex.core.getDiagnosticsCaptureLimit(), 1)
+
+        command = inspect.cleandoc(
+            """
+            import usdex.core
+            from pxr import Tf
+
+            usdex.core.activateDiagnosticsDelegate()
+            usdex.core.setDiagnosticsOutputStream(usdex.core.DiagnosticsOutputStream.eNone)
+            usdex.core.setDiagnosticsLevel(usdex.core.DiagnosticsLevel.eFatal)
+            usdex.core.setDiagnosticsCaptureLimit(2)
+
+            def emitDiagnostics():
+                for i in range(5):
+                    Tf.Warn(f"This is warning {i}")
+                Tf.Status("This is a status")
+
+            def emitMore():
+                Tf.Warn("This is another warning")
+
+            emitDiagnostics()
+            usdex.core.setDiagnosticsCountingEnabled(True)
+            emitDiagnostics()
+            emitMore()
+
+            counts = usdex.core.getDiagnosticsCounts()
+            print(counts[Tf.TF_DIAGNOSTIC_WARNING_TYPE], counts[Tf.TF_DIAGNOSTIC_STATUS_TYPE], len(counts))
+            for item in usdex.core.getDiagnosticsSourceCounts():
+                print(item.function, item.code == Tf.TF_DIAGNOSTIC_WARNING_TYPE, item.count, item.messages)
+
+            usdex.core.resetDiagnosticsCounts()
+            print(usdex.core.getDiagnosticsCounts(), usdex.core.getDiagnosticsSourceCounts())
+            """
+        )
+
+        # diagnostics are counted regardless of the level and output stream, and only the first messages are captured
+        self.assertOutputStreams(
+            command=command,
+            expectedStdout=[
+                "6 1 2",
+                "__main__.emitDiagnostics False 1 ['This is a status']",
+                "__main__.emitDiagnostics True 5 ['This is warning 0', 'This is warning 1']",
+                "__main__.emitMore True 1 ['This is another warning']",
+                "{} []",
+            ],
+            expectedStderr=[],
+        )
+
+    def testCallback(self):
+        command = inspect.cleandoc(
+            """
+            import usdex.core
+            from pxr import Tf
+
+            records = []
+            usdex.core.activateDiagnosticsDelegate()
+            usdex.core.setDiagnosticsOutputStream(usdex.core.DiagnosticsOutputStream.{stream})
+            usdex.core.setDiagnosticsCallback(records.append)
+
+            def emitDiagnostics():
+                Tf.Warn("This is a warning")
+                Tf.Status("This is a status")
+                Tf.Status("This is a succinct status", verbose=False)
+
+            emitDiagnostics()
+            usdex.core.setDiagnosticsCallback(None)
+            emitDiagnostics()
+            usdex.core.setDiagnosticsOutputStream(usdex.core.DiagnosticsOutputStream.eNone)
+
+            for record in records:
+                print(record.code == Tf.TF_DIAGNOSTIC_WARNING_TYPE, record.function, record.file, record.line > 0, record.commentary)
+                print(record.format())
+            """
+        )
+
+        # the callback receives the diagnostics which pass the level, independently of the output stream
+        expectedStdout = [
+            "True __main__.emitDiagnostics <string> True This is a warning",
+            "[Warning] [__main__.emitDiagnostics] This is a warning",
+        ]
+        self.assertOutputStreams(
+            command=command.format(stream="eNone"),
+            expectedStdout=expectedStdout,
+            expectedStderr=[],
+        )
+        self.assertOutputStreams(
+            command=command.format(stream="eStderr"),
+            expectedStdout=expectedStdout,
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is a warning",
+                "[Warning] [__main__.emitDiagnostics] This is a warning",
+            ],
+        )
+
+        # hidden call contexts have no function, file, or line
+        command = inspect.cleandoc(
+            """
+            import usdex.core
+            from pxr import Tf
+
+            records = []
+            usdex.core.activateDiagnosticsDelegate()
+            usdex.core.setDiagnosticsLevel(usdex.core.DiagnosticsLevel.eStatus)
+            usdex.core.setDiagnosticsOutputStream(usdex.core.DiagnosticsOutputStream.eNone)
+            usdex.core.setDiagnosticsCallback(records.append)
+            Tf.Status("This is a succinct status", verbose=False)
+            usdex.core.setDiagnosticsCallback(None)
+
+            for record in records:
+                print(repr(record.function), repr(record.file), record.line, record.format())
+            """
+        )
+        self.assertOutputStreams(
+            command=command,
+            expectedStdout=["'' '' 0 [Status] This is a succinct status"],
+            expectedStderr=[],
+        )
+
     def testUtf8Diagnostics(self):
         self.assertOutputStreams(
             command=inspect.cleandoc(
@@ -0,0 +1,130 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import usdex.core
+import usdex.test
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, Vt
+
+
+class InstrumentationTest(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        usdex.core.resetAuthoringMetrics()
+
+    def tearDown(self):
+        usdex.core.setInstrumentationEnabled(False)
+        usdex.core.resetAuthoringMetrics()
+        super().tearDown()
+
+    def definePlane(self, stage: Usd.Stage, path: str) -> UsdGeom.Mesh:
+        return usdex.core.definePolyMesh(
+            stage,
+            path,
+            faceVertexCounts=Vt.IntArray([4]),
+            faceVertexIndices=Vt.IntArray([0, 1, 2, 3]),
+            points=Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 0, 0), Gf.Vec3f(1, 1, 0), Gf.Vec3f(0, 1, 0)]),
+        )
+
+    def testDisabledByDefault(self):
+        self.assertFalse(usdex.core.isInstrumentationEnabled())
+
+        stage = Usd.Stage.CreateInMemory()
+        self.assertTrue(self.definePlane(stage, "/Plane"))
+        self.assertEqual(usdex.core.getAuthoringMetrics(), {})
+
+    def testMetrics(self):
+        usdex.core.setInstrumentationEnabled(True)
+        self.assertTrue(usdex.core.isInstrumentationEnabled())
+
+        stage = Usd.Stage.CreateInMemory()
+        self.assertTrue(self.definePlane(stage, "/Plane"))
+        self.assertTrue(self.definePlane(stage, "/Plane2"))
+        xform = usdex.core.defineXform(stage, "/Xform")
+        self.assertTrue(usdex.core.setLocalTransform(xform.GetPrim(), Gf.Matrix4d(1)))
+        names = usdex.core.getValidChildNames(stage.GetPseudoRoot(), ["A", "B", "C"])
+        self.assertEqual(len(names), 3)
+
+        metrics = usdex.core.getAuthoringMetrics()
+        self.assertIn("definePolyMesh", metrics)
+        mesh = metrics["definePolyMesh"]
+        self.assertEqual(mesh.calls, 2)
+        self.assertEqual(mesh.elements, 8)
+        # the counts and indices are 4 byte ints and the points are 12 byte vectors
+        self.assertEqual(mesh.bytes, 2 * (4 + 16 + 48))
+        self.assertGreater(mesh.seconds, 0)
+
+        self.assertEqual(metrics["defineXform"].calls, 1)
+        self.assertEqual(metrics["setLocalTransform"].calls, 1)
+        self.assertEqual(metrics["setLocalTransform"].elements, 1)
+        self.assertEqual(metrics["getValidChildNames"].calls, 1)
+        self.assertEqual(metrics["getValidChildNames"].elements, 3)
+
+        # entry points which were not called are omitted
+        self.assertNotIn("saveStage", metrics)
+
+    def testNestedCalls(self):
+        usdex.core.setInstrumentationEnabled(True)
+
+        stage = Usd.Stage.CreateInMemory()
+        prims = [usdex.core.defineXform(stage, f"/Xform{i}").GetPrim() for i in range(3)]
+        usdex.core.resetAuthoringMetrics()
+
+        self.assertTrue(usdex.core.setLocalTransforms(prims, [Gf.Matrix4d(1)] * 3))
+        self.assertTrue(usdex.core.setLocalTransform(prims[0], [Usd.TimeCode(0), Usd.TimeCode(1)], [Gf.Matrix4d(1), Gf.Matrix4d(2)]))
+
+        # the nested calls are included in the cost of the outermost call
+        metrics = usdex.core.getAuthoringMetrics()
+        self.assertEqual(metrics["setLocalTransforms"].calls, 1)
+        self.assertEqual(metrics["setLocalTransforms"].elements, 3)
+        self.assertEqual(metrics["setLocalTransform"].calls, 1)
+        self.assertEqual(metrics["setLocalTransform"].elements, 2)
+
+    def testReset(self):
+        usdex.core.setInstrumentationEnabled(True)
+
+        stage = Usd.Stage.CreateInMemory()
+        self.assertTrue(self.definePlane(stage, "/Plane"))
+        self.assertEqual(usdex.core.getAuthoringMetrics()["definePolyMesh"].calls, 1)
+
+        # disabling retains the metrics, but stops accumulation
+        usdex.core.setInstrumentationEnabled(False)
+        self.assertTrue(self.definePlane(stage, "/Plane2"))
+        self.assertEqual(usdex.core.getAuthoringMetrics()["definePolyMesh"].calls, 1)
+
+        usdex.core.resetAuthoringMetrics()
+        self.assertEqual(usdex.core.getAuthoringMetrics(), {})
+
+    def testFailedCalls(self):
+        usdex.core.setInstrumentationEnabled(True)
+
+        stage = Usd.Stage.CreateInMemory()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(self.definePlane(stage, Sdf.Path("Relative")))
+
+        # failed calls are still measured
+        self.assertEqual(usdex.core.getAuthoringMetrics()["definePolyMesh"].calls, 1)
+
+    def testSavedLayers(self):
+        usdex.core.setInstrumentationEnabled(True)
+
+        stage = Usd.Stage.Open(self.tmpLayer())
+        stage.GetRootLayer().subLayerPaths.append(self.tmpLayer("sublayer").identifier)
+        stage.SetEditTarget(Usd.EditTarget(stage.GetLayerStack()[-1]))
+        stage.DefinePrim("/Prim")
+
+        # both entry points count the dirty layers they save
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            usdex.core.saveStage(stage)
+        metrics = usdex.core.getAuthoringMetrics()
+        self.assertEqual(metrics["saveStage"].calls, 1)
+        self.assertEqual(metrics["saveStage"].elements, 2)
+        self.assertNotIn("saveDirtyLayers", metrics)
+
+        stage.DefinePrim("/Prim2")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            self.assertTrue(usdex.core.saveDirtyLayers(stage))
+        metrics = usdex.core.getAuthoringMetrics()
+        self.assertEqual(metrics["saveDirtyLayers"].calls, 1)
+        self.assertEqual(metrics["saveDirtyLayers"].elements, 1)
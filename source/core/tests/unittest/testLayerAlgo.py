@@ -2,6 +2,8 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import os
+
 import usdex.core
 import usdex.test
 from pxr import Sdf, Tf
@@ -295,3 +297,104 @@ class LayerAlgoTest(usdex.test.TestCase):
         exportedLayer = Sdf.Layer.FindOrOpen(identifier)
         self.assertUsdLayerEncoding(exportedLayer, "usdc")
         self.assertTrue(usdex.core.hasLayerAuthoringMetadata(exportedLayer))
+
+    def testExportLayerWithProgress(self):
+        layer = Sdf.Layer.CreateAnonymous()
+        layer.comment = "Existing Comment"
+        layer.defaultPrim = "Root"
+        Sdf.CreatePrimInLayer(layer, "/Root/Child/GrandChild")
+        Sdf.CreatePrimInLayer(layer, "/Root/Sibling")
+        attr = Sdf.AttributeSpec(layer.GetPrimAtPath("/Root/Child"), "value", Sdf.ValueTypeNames.Float)
+        attr.default = 1.0
+        variantSet = Sdf.VariantSetSpec(layer.GetPrimAtPath("/Root"), "shape")
+        variant = Sdf.VariantSpec(variantSet, "cube")
+        Sdf.PrimSpec(variant.primSpec, "Cube", Sdf.SpecifierDef, "Cube")
+        expected = layer.ExportToString()
+
+        reports = []
+
+        def progress(value):
+            reports.append((value.primSpecsWritten, value.totalPrimSpecs, value.bytesWritten))
+
+        # The source layer is not modified, and the output layer receives the metadata and comment
+        identifier = self.tmpFile("test", "usda")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, 'Exporting.*with comment "Export Comment"')]):
+            self.assertTrue(usdex.core.exportLayer(layer, identifier, LayerAlgoTest.defaultAuthoringMetadata, progress, comment="Export Comment"))
+        self.assertEqual(layer.ExportToString(), expected)
+        self.assertFalse(usdex.core.hasLayerAuthoringMetadata(layer))
+        exportedLayer = Sdf.Layer.FindOrOpen(identifier)
+        self.assertEqual(exportedLayer.comment, "Export Comment")
+        self.assertEqual(exportedLayer.customLayerData, self.__expectedAuthoringMetadata())
+        self.assertEqual(exportedLayer.defaultPrim, "Root")
+        self.assertEqual(exportedLayer.GetPrimAtPath("/Root").nameChildren.keys(), ["Child", "Sibling"])
+        self.assertTrue(exportedLayer.GetPrimAtPath("/Root/Child/GrandChild"))
+        self.assertEqual(exportedLayer.GetAttributeAtPath("/Root/Child.value").default, 1.0)
+        self.assertTrue(exportedLayer.GetPrimAtPath("/Root{shape=cube}Cube"))
+
+        # Progress is reported for each prim spec and once more with the size of the file
+        self.assertEqual(reports[:4], [(1, 4, 0), (2, 4, 0), (3, 4, 0), (4, 4, 0)])
+        self.assertEqual(len(reports), 5)
+        self.assertEqual(reports[-1][:2], (4, 4))
+        self.assertGreater(reports[-1][2], 0)
+
+        # Returning False cancels the export and nothing is written
+        identifier = self.tmpFile("test", "usdc")
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting"), (Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Cancelled export")],
+        ):
+            self.assertFalse(
+                usdex.core.exportLayer(layer, identifier, LayerAlgoTest.defaultAuthoringMetadata, lambda value: value.primSpecsWritten < 2)
+            )
+        self.assertEqual(os.path.getsize(identifier), 0)
+
+        # An invalid identifier is rejected before any progress is reported
+        reports.clear()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid identifier")]):
+            self.assertFalse(usdex.core.exportLayer(layer, "", LayerAlgoTest.defaultAuthoringMetadata, progress))
+        self.assertEqual(reports, [])
+
+    def testMergeLayers(self):
+        target = Sdf.Layer.CreateAnonymous()
+        target.defaultPrim = "Root"
+        Sdf.PrimSpec(target, "Root", Sdf.SpecifierDef, "Xform")
+
+        first = Sdf.Layer.CreateAnonymous()
+        first.defaultPrim = "Other"
+        Sdf.CreatePrimInLayer(first, "/Root").kind = "component"
+        child = Sdf.PrimSpec(first.GetPrimAtPath("/Root"), "Child", Sdf.SpecifierDef, "Xform")
+        Sdf.PrimSpec(child, "GrandChild", Sdf.SpecifierDef, "Scope")
+        attr = Sdf.AttributeSpec(child, "value", Sdf.ValueTypeNames.Float)
+        attr.default = 1.0
+
+        second = Sdf.Layer.CreateAnonymous()
+        Sdf.CreatePrimInLayer(second, "/Root").kind = "assembly"
+        Sdf.PrimSpec(second.GetPrimAtPath("/Root"), "Sibling", Sdf.SpecifierDef, "Scope")
+        attr = Sdf.AttributeSpec(Sdf.CreatePrimInLayer(second, "/Root/Child"), "value", Sdf.ValueTypeNames.Float)
+        attr.default = 2.0
+        firstContent = first.ExportToString()
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, f'.*Unable to merge 2 opinions from "{second.identifier}"')]):
+            result, conflicts = usdex.core.mergeLayers(target, [first, second])
+        self.assertFalse(result)
+
+        # The new specs of every source are merged, while the earlier sources are stronger for conflicting opinions
+        root = target.GetPrimAtPath("/Root")
+        self.assertEqual(root.specifier, Sdf.SpecifierDef)
+        self.assertEqual(root.typeName, "Xform")
+        self.assertEqual(root.kind, "component")
+        self.assertEqual(root.nameChildren.keys(), ["Child", "Sibling"])
+        self.assertTrue(target.GetPrimAtPath("/Root/Child/GrandChild"))
+        self.assertEqual(target.GetAttributeAtPath("/Root/Child.value").default, 1.0)
+
+        # The conflicts are reported in order, and neither the sources nor the layer metadata are modified
+        self.assertEqual(
+            [(conflict.path, conflict.field, conflict.sourceIdentifier) for conflict in conflicts],
+            [(Sdf.Path("/Root"), "kind", second.identifier), (Sdf.Path("/Root/Child.value"), "default", second.identifier)],
+        )
+        self.assertEqual(first.ExportToString(), firstContent)
+        self.assertEqual(target.defaultPrim, "Root")
+
+        # Merging identical opinions is not a conflict
+        self.assertEqual(usdex.core.mergeLayers(target, [first]), (True, []))
+
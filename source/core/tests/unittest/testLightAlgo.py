@@ -90,6 +90,95 @@ class LightAlgoTest(usdex.test.TestCase):
         self._checkRectLightAttrs(rect_light_textured, 19.93, 39.91, 0.88, relTextureFile)
         self.assertIsValidUsd(stage)
 
+    def testDefineLights(self):
+        batchStage = self._createTestStage()
+        singleStage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(singleStage, "/World")
+        textureFile = self.tmpFile(name="lights", ext="png")
+        relTextureFile = f"./{pathlib.Path(textureFile).name}"
+        lightType = usdex.core.LightDescription.Type
+
+        descriptions = [
+            usdex.core.LightDescription(
+                lightType.Dome, Sdf.Path("/World/dome"), 0.5, texturePath=relTextureFile, textureFormat=UsdLux.Tokens.latlong
+            ),
+            usdex.core.LightDescription(lightType.Dome, Sdf.Path("/World/domeNoTexture"), 0.6),
+            usdex.core.LightDescription(lightType.Rect, Sdf.Path("/World/rect"), 0.7, width=19.93, height=39.91, texturePath=relTextureFile),
+            usdex.core.LightDescription(lightType.Sphere, Sdf.Path("/World/sphere"), 0.8, radius=2.5),
+            usdex.core.LightDescription(lightType.Distant, Sdf.Path("/World/distant"), 0.9, angle=1.5),
+        ]
+        lights = usdex.core.defineLights(batchStage, descriptions)
+        self.assertEqual(len(lights), len(descriptions))
+        self.assertIsValidUsd(batchStage)
+
+        # the dome and rect lights match those of the individual functions
+        expected = {
+            "/World/dome": usdex.core.defineDomeLight(singleStage, "/World/dome", 0.5, relTextureFile, UsdLux.Tokens.latlong),
+            "/World/domeNoTexture": usdex.core.defineDomeLight(singleStage, "/World/domeNoTexture", 0.6),
+            "/World/rect": usdex.core.defineRectLight(singleStage, "/World/rect", 19.93, 39.91, 0.7, relTextureFile),
+        }
+        for light, description in zip(lights, descriptions):
+            self.assertTrue(light)
+            self.assertTrue(usdex.core.isLight(light.GetPrim()))
+            self.assertEqual(light.GetPath(), description.path)
+            self.assertEqual(light.GetPrim().GetSpecifier(), Sdf.SpecifierDef)
+            expectedLight = expected.get(str(description.path))
+            if expectedLight is None:
+                continue
+            expectedPrim = expectedLight.GetPrim()
+            self.assertEqual(light.GetPrim().GetTypeName(), expectedPrim.GetTypeName())
+            self.assertEqual(sorted(light.GetPrim().GetAuthoredPropertyNames()), sorted(expectedPrim.GetAuthoredPropertyNames()))
+            for attr in expectedPrim.GetAuthoredAttributes():
+                self.assertEqual(light.GetPrim().GetAttribute(attr.GetName()).Get(), attr.Get(), attr.GetName())
+
+        self._checkDomeLightAttrs(UsdLux.DomeLight(lights[0].GetPrim()), 0.5, relTextureFile, UsdLux.Tokens.latlong)
+        self._checkRectLightAttrs(UsdLux.RectLight(lights[2].GetPrim()), 19.93, 39.91, 0.7, relTextureFile)
+
+        # the sphere and distant lights author their own attributes, and the extents match those computed by the boundable plugins
+        sphereLight = UsdLux.SphereLight(lights[3].GetPrim())
+        self.assertTrue(sphereLight)
+        self.assertAlmostEqual(sphereLight.GetIntensityAttr().Get(), 0.8, 5)
+        self.assertAlmostEqual(sphereLight.GetRadiusAttr().Get(), 2.5, 5)
+        distantLight = UsdLux.DistantLight(lights[4].GetPrim())
+        self.assertTrue(distantLight)
+        self.assertAlmostEqual(distantLight.GetIntensityAttr().Get(), 0.9, 5)
+        self.assertAlmostEqual(distantLight.GetAngleAttr().Get(), 1.5, 5)
+        for light in (lights[2], lights[3]):
+            boundable = UsdGeom.Boundable(light.GetPrim())
+            self.assertEqual(boundable.GetExtentAttr().Get(), UsdGeom.Boundable.ComputeExtentFromPlugins(boundable, Usd.TimeCode.Default()))
+
+        self.assertEqual(usdex.core.defineLights(batchStage, []), [])
+
+    def testDefineLightsFailures(self):
+        stage = self._createTestStage()
+        lightType = usdex.core.LightDescription.Type
+
+        descriptions = [
+            usdex.core.LightDescription(lightType.Rect, Sdf.Path("/World/valid")),
+            # the path is not valid
+            usdex.core.LightDescription(lightType.Sphere, Sdf.Path("relative")),
+            # the texture format is not valid
+            usdex.core.LightDescription(lightType.Dome, Sdf.Path("/World/dome"), texturePath="./dome.png", textureFormat=UsdLux.Tokens.geometry),
+            # the texture format is only validated for dome lights with a texture
+            usdex.core.LightDescription(lightType.Dome, Sdf.Path("/World/domeNoTexture"), textureFormat=UsdLux.Tokens.geometry),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*UsdLuxSphereLight due to an invalid location"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*is not a valid texture format token"),
+            ],
+        ):
+            lights = usdex.core.defineLights(stage, descriptions)
+
+        self.assertEqual(len(lights), 4)
+        self.assertTrue(lights[0])
+        self.assertFalse(lights[1])
+        self.assertFalse(lights[2])
+        self.assertTrue(lights[3])
+        self.assertFalse(stage.GetPrimAtPath("/World/dome"))
+        self.assertIsValidUsd(stage)
+
     def testIsLight(self):
         stage = self._createTestStage()
         cylinderLight = UsdLux.CylinderLight.Define(stage, "/World/cylinderLight")
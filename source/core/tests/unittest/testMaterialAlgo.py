@@ -9,7 +9,7 @@ from typing import List, Tuple
 
 import usdex.core
 import usdex.test
-from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdShade, UsdUtils
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdShade, UsdUtils, Vt
 
 
 class MaterialAlgoTest(usdex.test.TestCase):
@@ -105,6 +105,107 @@ class MaterialAlgoTest(usdex.test.TestCase):
         self.assertFalse(instancedCube.HasAPI(UsdShade.MaterialBindingAPI))
         self.assertIsValidUsd(stage)
 
+    def definePlane(self, stage: Usd.Stage, path: Sdf.Path) -> UsdGeom.Mesh:
+        return usdex.core.definePolyMesh(
+            stage,
+            path,
+            faceVertexCounts=Vt.IntArray([4]),
+            faceVertexIndices=Vt.IntArray([0, 1, 2, 3]),
+            points=Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 0, 0), Gf.Vec3f(1, 1, 0), Gf.Vec3f(0, 1, 0)]),
+        )
+
+    def testBindMaterials(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materials = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName())).GetPrim()
+        geometry = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild("Geometry")).GetPrim()
+        red = usdex.core.createMaterial(materials, "Red")
+        blue = usdex.core.createMaterial(materials, "Blue")
+        cubes = [UsdGeom.Cube.Define(stage, geometry.GetPath().AppendChild(f"Cube{i}")).GetPrim() for i in range(4)]
+        plane = self.definePlane(stage, geometry.GetPath().AppendChild("Plane"))
+        subset = UsdShade.MaterialBindingAPI(plane).CreateMaterialBindSubset("Subset", Vt.IntArray([0])).GetPrim()
+
+        prims = cubes + [plane.GetPrim(), subset]
+        self.assertTrue(usdex.core.bindMaterials(prims, [red, blue, red, red, red, blue]))
+        for prim, material in zip(prims, [red, blue, red, red, red, blue]):
+            self.assertTrue(prim.HasAPI(UsdShade.MaterialBindingAPI))
+            self.assertEqual(UsdShade.MaterialBindingAPI(prim).GetDirectBinding().GetMaterialPath(), material.GetPath())
+        # hoisting is disabled by default
+        self.assertFalse(geometry.HasAPI(UsdShade.MaterialBindingAPI))
+
+        # the last binding of a repeated prim is used
+        self.assertTrue(usdex.core.bindMaterials([cubes[1], cubes[1]], [red, blue]))
+        self.assertEqual(UsdShade.MaterialBindingAPI(cubes[1]).GetDirectBinding().GetMaterialPath(), blue.GetPath())
+        self.assertEqual(cubes[1].GetAppliedSchemas().count("MaterialBindingAPI"), 1)
+        self.assertIsValidUsd(stage)
+
+        # invalid prims and materials are skipped, and all other prims are still bound
+        other = UsdGeom.Cube.Define(stage, geometry.GetPath().AppendChild("Other")).GetPrim()
+        invalidMaterial = UsdShade.Material(materials.GetChild("InvalidPath"))
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_WARNING_TYPE, "UsdPrim.*is not valid, cannot bind material"),
+                (Tf.TF_DIAGNOSTIC_WARNING_TYPE, "UsdShadeMaterial.*is not valid, cannot bind material"),
+            ],
+        ):
+            self.assertFalse(usdex.core.bindMaterials([Usd.Prim(), cubes[2], other], [red, invalidMaterial, blue]))
+        self.assertEqual(UsdShade.MaterialBindingAPI(other).GetDirectBinding().GetMaterialPath(), blue.GetPath())
+        self.assertEqual(UsdShade.MaterialBindingAPI(cubes[2]).GetDirectBinding().GetMaterialPath(), red.GetPath())
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*mismatched materials")]):
+            self.assertFalse(usdex.core.bindMaterials(cubes, [red]))
+
+        otherStage = Usd.Stage.CreateInMemory()
+        otherPrim = otherStage.DefinePrim("/World/Cube", "Cube")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*belongs to a different stage")]):
+            self.assertFalse(usdex.core.bindMaterials([other, otherPrim], [red, red]))
+        self.assertFalse(otherPrim.HasAPI(UsdShade.MaterialBindingAPI))
+
+    def testBindMaterialsHoisting(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materials = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName())).GetPrim()
+        geometry = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild("Geometry")).GetPrim()
+        red = usdex.core.createMaterial(materials, "Red")
+        blue = usdex.core.createMaterial(materials, "Blue")
+
+        # two groups of cubes which are entirely red, and a group which is mixed
+        groups = [UsdGeom.Xform.Define(stage, geometry.GetPath().AppendChild(f"Group{i}")).GetPrim() for i in range(3)]
+        cubes = [[UsdGeom.Cube.Define(stage, group.GetPath().AppendChild(f"Cube{j}")).GetPrim() for j in range(3)] for group in groups[:2]]
+        plane = self.definePlane(stage, groups[2].GetPath().AppendChild("Plane"))
+        subset = UsdShade.MaterialBindingAPI(plane).CreateMaterialBindSubset("Subset", Vt.IntArray([0])).GetPrim()
+        cubes.append([plane.GetPrim()] + [UsdGeom.Cube.Define(stage, groups[2].GetPath().AppendChild(f"Cube{j}")).GetPrim() for j in range(1, 3)])
+
+        prims = cubes[0] + cubes[1] + cubes[2] + [subset]
+        boundMaterials = [red] * 6 + [red, blue, red, red]
+        self.assertTrue(usdex.core.bindMaterials(prims, boundMaterials, hoistBindings=True))
+
+        # the uniform groups are bound once, but their parent is not, as one of its children is mixed
+        for group in groups[:2]:
+            self.assertEqual(UsdShade.MaterialBindingAPI(group).GetDirectBinding().GetMaterialPath(), red.GetPath())
+            for cube in cubes[groups.index(group)]:
+                self.assertFalse(cube.HasAPI(UsdShade.MaterialBindingAPI))
+                self.assertEqual(UsdShade.MaterialBindingAPI(cube).ComputeBoundMaterial()[0].GetPath(), red.GetPath())
+        self.assertFalse(groups[2].HasAPI(UsdShade.MaterialBindingAPI))
+        self.assertFalse(geometry.HasAPI(UsdShade.MaterialBindingAPI))
+
+        # the mixed group and the subset keep their own bindings
+        for cube, material in zip(cubes[2], [red, blue, red]):
+            self.assertEqual(UsdShade.MaterialBindingAPI(cube).GetDirectBinding().GetMaterialPath(), material.GetPath())
+        self.assertEqual(UsdShade.MaterialBindingAPI(subset).GetDirectBinding().GetMaterialPath(), red.GetPath())
+
+        # children with an existing binding are not hoisted, as their own binding would remain stronger
+        group = UsdGeom.Xform.Define(stage, geometry.GetPath().AppendChild("Prebound")).GetPrim()
+        prebound = [UsdGeom.Cube.Define(stage, group.GetPath().AppendChild(f"Cube{j}")).GetPrim() for j in range(2)]
+        self.assertTrue(usdex.core.bindMaterial(prebound[0], blue))
+        self.assertTrue(usdex.core.bindMaterials(prebound, [red, red], hoistBindings=True))
+        self.assertFalse(group.HasAPI(UsdShade.MaterialBindingAPI))
+        for cube in prebound:
+            self.assertEqual(UsdShade.MaterialBindingAPI(cube).GetDirectBinding().GetMaterialPath(), red.GetPath())
+
+        self.assertIsValidUsd(stage)
+
     def testComputeEffectiveSurfaceShader(self):
         stage = Usd.Stage.CreateInMemory()
         usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
@@ -146,6 +247,73 @@ class MaterialAlgoTest(usdex.test.TestCase):
         self.assertNotEqual(shader.GetPrim(), otherShader.GetPrim())
         self.assertEqual(shader.GetPrim(), previewShader.GetPrim())
 
+    def testSurfaceShaderCache(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materials = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName())).GetPrim()
+
+        cache = usdex.core.SurfaceShaderCache(stage)
+        self.assertEqual(cache.getRenderContext(), UsdShade.Tokens.universalRenderContext)
+        self.assertEqual(cache.size(), 0)
+
+        # invalid materials and materials of other stages are not cached
+        self.assertFalse(cache.getSurfaceShader(UsdShade.Material()))
+        otherStage = Usd.Stage.CreateInMemory()
+        self.assertFalse(cache.getSurfaceShader(usdex.core.definePreviewMaterial(otherStage, "/Other", Gf.Vec3f(1))))
+        self.assertEqual(cache.size(), 0)
+
+        # the cached shaders match the uncached shaders
+        red = usdex.core.definePreviewMaterial(materials, "Red", Gf.Vec3f(1, 0, 0))
+        green = usdex.core.definePreviewMaterial(materials, "Green", Gf.Vec3f(0, 1, 0))
+        empty = usdex.core.createMaterial(materials, "Empty")
+        shaders = cache.getSurfaceShaders([red, green, empty])
+        self.assertEqual(len(shaders), 3)
+        self.assertEqual(shaders[0].GetPrim(), usdex.core.computeEffectivePreviewSurfaceShader(red).GetPrim())
+        self.assertEqual(shaders[1].GetPrim(), usdex.core.computeEffectivePreviewSurfaceShader(green).GetPrim())
+        self.assertFalse(shaders[2])
+        self.assertEqual(cache.size(), 3)
+        self.assertEqual(cache.getSurfaceShader(red).GetPrim(), shaders[0].GetPrim())
+
+        # adding textures does not affect the cache
+        self.assertTrue(usdex.core.addDiffuseTextureToPreviewMaterial(red, Sdf.AssetPath(self.tmpFile(name="Diffuse", ext="png"))))
+        self.assertEqual(cache.size(), 3)
+        self.assertEqual(cache.getSurfaceShader(red).GetPrim(), usdex.core.computeEffectivePreviewSurfaceShader(red).GetPrim())
+
+        # connecting a surface discards the cached shader of that material only
+        surface = UsdShade.Shader.Define(stage, empty.GetPrim().GetPath().AppendChild("PreviewSurface"))
+        empty.CreateSurfaceOutput().ConnectToSource(surface.CreateOutput("surface", Sdf.ValueTypeNames.Token))
+        self.assertEqual(cache.size(), 2)
+        self.assertEqual(cache.getSurfaceShader(empty).GetPrim(), surface.GetPrim())
+
+        # removing a surface shader discards the cached shader of its material
+        stage.RemovePrim(surface.GetPrim().GetPath())
+        self.assertEqual(cache.size(), 2)
+        self.assertFalse(cache.getSurfaceShader(empty))
+
+        # removing an ancestor discards all of the cached shaders below it
+        stage.RemovePrim(materials.GetPath())
+        self.assertEqual(cache.size(), 0)
+
+        cache.getSurfaceShader(usdex.core.definePreviewMaterial(stage, "/Blue", Gf.Vec3f(0, 0, 1)))
+        self.assertEqual(cache.size(), 1)
+        cache.clear()
+        self.assertEqual(cache.size(), 0)
+
+    def testSurfaceShaderCacheRenderContext(self):
+        stage = Usd.Stage.CreateInMemory()
+        material = usdex.core.definePreviewMaterial(stage, "/Material", Gf.Vec3f(1))
+        previewSurface = usdex.core.computeEffectivePreviewSurfaceShader(material)
+
+        # the universal render context is used as a fallback
+        cache = usdex.core.SurfaceShaderCache(stage, "fancy")
+        self.assertEqual(cache.getRenderContext(), "fancy")
+        self.assertEqual(cache.getSurfaceShader(material).GetPrim(), previewSurface.GetPrim())
+
+        fancySurface = UsdShade.Shader.Define(stage, material.GetPrim().GetPath().AppendChild("Fancy"))
+        material.CreateSurfaceOutput("fancy").ConnectToSource(fancySurface.CreateOutput("out", Sdf.ValueTypeNames.Token))
+        self.assertEqual(cache.getSurfaceShader(material).GetPrim(), fancySurface.GetPrim())
+        self.assertEqual(usdex.core.computeEffectivePreviewSurfaceShader(material).GetPrim(), previewSurface.GetPrim())
+
     def testColorSpaceToken(self):
         self.assertEqual(usdex.core.getColorSpaceToken(usdex.core.ColorSpace.eAuto), "auto")
         self.assertEqual(usdex.core.getColorSpaceToken(usdex.core.ColorSpace.eRaw), "raw")
@@ -212,6 +380,43 @@ class MaterialAlgoTest(usdex.test.TestCase):
         self.assertVecAlmostEqual(roundTripPurpleSrgb, purpleSrgb, places=6)
         self.assertVecAlmostEqual(roundTripBlackSrgb, blackSrgb, places=6)
 
+    def testColorSpaceArrayConversions(self):
+        # cover the table, the linear segments, the boundaries, and values outside of [0, 1]
+        values = [i / 997.0 for i in range(998)] + [0.0001, 0.003, 0.04, 0.045, -0.5, 1.5, 4.0]
+        colors = Vt.Vec3fArray([Gf.Vec3f(x, 1.0 - x, x * x) for x in values])
+
+        linear = usdex.core.sRgbToLinear(colors)
+        self.assertIsInstance(linear, Vt.Vec3fArray)
+        self.assertEqual(len(linear), len(colors))
+        for color, converted in zip(colors, linear):
+            self.assertVecAlmostEqual(converted, usdex.core.sRgbToLinear(color), places=6)
+
+        srgb = usdex.core.linearToSrgb(colors)
+        self.assertIsInstance(srgb, Vt.Vec3fArray)
+        self.assertEqual(len(srgb), len(colors))
+        for color, converted in zip(colors, srgb):
+            self.assertVecAlmostEqual(converted, usdex.core.linearToSrgb(color), places=5)
+
+        # the round trip is stable within the error of the approximation
+        for color, converted in zip(colors, usdex.core.linearToSrgb(linear)):
+            self.assertVecAlmostEqual(converted, color, places=5)
+
+        # large arrays are converted in parallel with the same results
+        large = Vt.Vec3fArray(100000, Gf.Vec3f(0.5, 0.25, 0.75))
+        expected = usdex.core.sRgbToLinear(Gf.Vec3f(0.5, 0.25, 0.75))
+        converted = usdex.core.sRgbToLinear(large)
+        self.assertEqual(len(converted), len(large))
+        self.assertEqual(converted, Vt.Vec3fArray(len(large), converted[0]))
+        self.assertVecAlmostEqual(converted[0], expected, places=6)
+
+        self.assertEqual(len(usdex.core.sRgbToLinear(Vt.Vec3fArray())), 0)
+        self.assertEqual(len(usdex.core.linearToSrgb(Vt.Vec3fArray())), 0)
+
+        # the results are suitable for primvar data
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, usdex.core.sRgbToLinear(Vt.Vec3fArray([Gf.Vec3f(0.5)])))
+        self.assertTrue(primvar.isValid())
+        self.assertVecAlmostEqual(primvar.values()[0], Gf.Vec3f(0.21404114), places=6)
+
     def testAddPreviewMaterialInterface(self):
         stage = Usd.Stage.CreateInMemory()
         usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
@@ -1222,3 +1427,122 @@ class DefinePreviewMaterialTest(usdex.test.DefineFunctionTestCase):
         ):
             material = usdex.core.definePreviewMaterial(xformPrim, color)
         self.assertFalse(material)
+
+
+class PreviewMaterialRegistryTest(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(self.stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materialsPath = self.stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName())
+        self.materials = UsdGeom.Scope.Define(self.stage, materialsPath).GetPrim()
+
+    def testDeduplication(self):
+        registry = usdex.core.PreviewMaterialRegistry(self.materials)
+        texture = Sdf.AssetPath(self.tmpFile(name="BaseColor", ext="png"))
+        red = usdex.core.PreviewMaterialDescription(Gf.Vec3f(1, 0, 0), roughness=0.2, diffuseTexture=texture)
+        blue = usdex.core.PreviewMaterialDescription(Gf.Vec3f(0, 0, 1), roughness=0.2, diffuseTexture=texture)
+
+        first = registry.definePreviewMaterial("Red", red)
+        self.assertTrue(first)
+        self.assertEqual(first.GetPrim().GetName(), "Red")
+        self.assertEqual(first.GetPrim().GetParent(), self.materials)
+        shader = usdex.core.computeEffectivePreviewSurfaceShader(first)
+        self.assertEqual(shader.GetInput("roughness").Get(), 0.2)
+        self.assertTrue(shader.GetInput("diffuseColor").HasConnectedSource())
+
+        # an equivalent description returns the existing material, regardless of the name
+        second = registry.definePreviewMaterial("Red Copy", usdex.core.PreviewMaterialDescription(Gf.Vec3f(1, 0, 0), 1.0, 0.2, 0.0, texture))
+        self.assertEqual(second.GetPrim(), first.GetPrim())
+        self.assertFalse(self.materials.GetChild("Red_Copy"))
+
+        # any differing value defines a new material, with a unique name
+        third = registry.definePreviewMaterial("Red", blue)
+        self.assertTrue(third)
+        self.assertNotEqual(third.GetPrim(), first.GetPrim())
+        self.assertEqual(third.GetPrim().GetName(), "Red_1")
+
+        untextured = usdex.core.PreviewMaterialDescription(Gf.Vec3f(1, 0, 0), roughness=0.2)
+        fourth = registry.definePreviewMaterial("Untextured", untextured)
+        self.assertNotEqual(fourth.GetPrim(), first.GetPrim())
+
+        self.assertEqual(registry.getUniqueMaterialCount(), 3)
+        self.assertEqual(registry.getUseCount(), 4)
+        self.assertEqual(len(self.materials.GetChildren()), 3)
+
+        self.assertIsValidUsd(self.stage)
+
+    def testDefaultDescription(self):
+        registry = usdex.core.PreviewMaterialRegistry(self.materials)
+        description = usdex.core.PreviewMaterialDescription()
+        self.assertEqual(description.color, Gf.Vec3f(0.18))
+        self.assertEqual(description.opacity, 1.0)
+        self.assertEqual(description.roughness, 0.5)
+        self.assertEqual(description.metallic, 0.0)
+        self.assertEqual(description.diffuseTexture, Sdf.AssetPath())
+
+        material = registry.definePreviewMaterial("Default", description)
+        self.assertTrue(material)
+        description.metallic = 1.0
+        self.assertNotEqual(registry.definePreviewMaterial("Metal", description).GetPrim(), material.GetPrim())
+        self.assertEqual(registry.getUniqueMaterialCount(), 2)
+
+    def testInvalidParent(self):
+        registry = usdex.core.PreviewMaterialRegistry(Usd.Prim())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid parent prim")]):
+            self.assertFalse(registry.definePreviewMaterial("Test", usdex.core.PreviewMaterialDescription()))
+        self.assertEqual(registry.getUniqueMaterialCount(), 0)
+        self.assertEqual(registry.getUseCount(), 0)
+
+    def testSharedTextureReaders(self):
+        registry = usdex.core.PreviewMaterialRegistry(self.materials, shareTextureReaders=True)
+        atlas = Sdf.AssetPath(self.tmpFile(name="Atlas", ext="png"))
+        normals = Sdf.AssetPath(self.tmpFile(name="Normals", ext="png"))
+        red = usdex.core.PreviewMaterialDescription(Gf.Vec3f(1, 0, 0), diffuseTexture=atlas, normalTexture=normals)
+        blue = usdex.core.PreviewMaterialDescription(Gf.Vec3f(0, 0, 1), diffuseTexture=atlas, normalTexture=normals)
+
+        first = registry.definePreviewMaterial("Red", red)
+        second = registry.definePreviewMaterial("Blue", blue)
+        self.assertTrue(first)
+        self.assertTrue(second)
+        self.assertEqual(registry.getUniqueMaterialCount(), 2)
+
+        # each texture is authored once, on an abstract shader below the parent prim
+        library = self.materials.GetChild("TextureReaders")
+        self.assertTrue(library)
+        self.assertTrue(library.IsAbstract())
+        readers = library.GetChildren()
+        self.assertEqual(len(readers), 2)
+        self.assertTrue(readers[0].GetName().startswith("Atlas"))
+        self.assertEqual(UsdShade.Shader(readers[0]).GetInput("file").Get().path, atlas.path)
+
+        # each material reader references the shared reader, but retains its own fallback
+        for material, color in ((first, red.color), (second, blue.color)):
+            reader = UsdShade.Shader(material.GetPrim().GetChild("DiffuseTexture"))
+            self.assertTrue(reader.GetPrim().HasAuthoredReferences())
+            self.assertEqual(reader.GetShaderId(), "UsdUVTexture")
+            self.assertEqual(reader.GetInput("file").Get().path, atlas.path)
+            self.assertEqual(reader.GetInput("sourceColorSpace").Get(), usdex.core.getColorSpaceToken(usdex.core.ColorSpace.eAuto))
+            self.assertEqual(reader.GetInput("fallback").Get(), Gf.Vec4f(color[0], color[1], color[2], 1))
+            surface = usdex.core.computeEffectivePreviewSurfaceShader(material)
+            self.assertEqual(surface.GetInput("diffuseColor").GetConnectedSources()[0][0].source.GetPrim(), reader.GetPrim())
+
+            # the normals are still adjusted into tangent space for 8 bit formats
+            normalReader = UsdShade.Shader(material.GetPrim().GetChild("NormalTexture"))
+            self.assertEqual(normalReader.GetInput("scale").Get(), Gf.Vec4f(2, 2, 2, 1))
+            self.assertEqual(normalReader.GetInput("sourceColorSpace").Get(), usdex.core.getColorSpaceToken(usdex.core.ColorSpace.eRaw))
+
+        # the abstract shared readers are not traversed as materials
+        self.assertEqual(len([x for x in self.materials.GetChildren() if x.IsA(UsdShade.Material)]), 2)
+        self.assertIsValidUsd(self.stage)
+
+    def testUnsharedTextureReaders(self):
+        registry = usdex.core.PreviewMaterialRegistry(self.materials)
+        atlas = Sdf.AssetPath(self.tmpFile(name="Atlas", ext="png"))
+        material = registry.definePreviewMaterial("Red", usdex.core.PreviewMaterialDescription(Gf.Vec3f(1, 0, 0), diffuseTexture=atlas))
+        self.assertTrue(material)
+        self.assertFalse(self.materials.GetChild("TextureReaders"))
+        reader = material.GetPrim().GetChild("DiffuseTexture")
+        self.assertFalse(reader.HasAuthoredReferences())
+        self.assertEqual(UsdShade.Shader(reader).GetInput("file").Get().path, atlas.path)
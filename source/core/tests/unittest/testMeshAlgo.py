@@ -2,10 +2,13 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import array
+import concurrent.futures
+
 import omni.asset_validator
 import usdex.core
 import usdex.test
-from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdUtils, Vt
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdShade, UsdUtils, Vt
 from utils.DefinePointBasedTestCaseMixin import DefinePointBasedTestCaseMixin
 
 # Description of a simple mesh with two connected faces
@@ -272,6 +275,41 @@ class DefineMeshTestCase(DefinePointBasedTestCaseMixin, usdex.test.DefineFunctio
         self.assertFalse(stage.GetPrimAtPath(path))
         self.assertIsValidUsd(stage)
 
+    def testHalfPrecisionPrimvars(self):
+        stage = self.createTestStage()
+        path = Sdf.Path("/World/HalfPrecision")
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)] * len(POINTS)))
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec2fArray([Gf.Vec2f(point[0] / 3.0, point[2] / 3.0) for point in POINTS]))
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(0.1, 0.2, 0.3)]))
+        with usdex.core.ScopedPrimvarPrecision(usdex.core.PrimvarPrecision.eHalf) as precision:
+            mesh = usdex.core.definePolyMesh(
+                stage,
+                path,
+                FACE_VERTEX_COUNTS,
+                FACE_VERTEX_INDICES,
+                POINTS,
+                normals=normals,
+                uvs=uvs,
+                displayColor=displayColor,
+            )
+        self.assertTrue(mesh)
+        self.assertEqual(usdex.core.getPrimvarPrecision(), usdex.core.PrimvarPrecision.eFloat)
+
+        # Normals and uvs are authored at half precision, while the schema defines the type of the display color
+        primvarsApi = UsdGeom.PrimvarsAPI(mesh)
+        self.assertEqual(primvarsApi.GetPrimvar(UsdGeom.Tokens.normals).GetTypeName(), Sdf.ValueTypeNames.Normal3hArray)
+        self.assertEqual(primvarsApi.GetPrimvar(UsdUtils.GetPrimaryUVSetName()).GetTypeName(), Sdf.ValueTypeNames.TexCoord2hArray)
+        self.assertEqual(mesh.GetDisplayColorPrimvar().GetTypeName(), Sdf.ValueTypeNames.Color3fArray)
+        self.assertEqual(mesh.GetDisplayColorPrimvar().Get(), displayColor.values())
+
+        # The uvs of 1/3 can not be represented exactly
+        self.assertGreater(precision.getMaxError(), 0.0)
+        self.assertLess(precision.getMaxError(), 0.001)
+        result = usdex.core.Vec2fPrimvarData.getPrimvarData(primvarsApi.GetPrimvar(UsdUtils.GetPrimaryUVSetName()))
+        for actual, expected in zip(result.values(), uvs.values()):
+            self.assertTrue(Gf.IsClose(actual, expected, precision.getMaxError()))
+        self.assertIsValidUsd(stage)
+
     def testDefineMeshFromXform(self):
         stage = self.createTestStage()
         xform = UsdGeom.Xform.Define(stage, Sdf.Path("/World/ExistingXform"))
@@ -326,3 +364,789 @@ class DefineMeshTestCase(DefinePointBasedTestCaseMixin, usdex.test.DefineFunctio
             mesh = usdex.core.definePolyMesh(xformPrim, FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS)
         self.assertTrue(mesh)
         self.assertEqual(mesh.GetPrim().GetTypeName(), "Mesh")
+
+
+class DefinePolyMeshesTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        stage.SetDefaultPrim(UsdGeom.Xform.Define(stage, "/World").GetPrim())
+        return stage
+
+    def testBatchMatchesIndividualDefinition(self):
+        stage = self.createTestStage()
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0) for _ in range(len(POINTS))]))
+        descriptions = [
+            usdex.core.PolyMeshDescription(Sdf.Path(f"/World/Batch/Mesh_{i}"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, normals=normals)
+            for i in range(10)
+        ]
+        meshes = usdex.core.definePolyMeshes(stage, descriptions)
+        self.assertEqual(len(meshes), len(descriptions))
+
+        expected = usdex.core.definePolyMesh(stage, "/World/Expected", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, normals=normals)
+        for mesh, desc in zip(meshes, descriptions):
+            self.assertIsInstance(mesh, UsdGeom.Mesh)
+            self.assertTrue(mesh)
+            self.assertEqual(mesh.GetPath(), desc.path)
+            self.assertTrue(mesh.GetPrim().IsDefined())
+            self.assertEqual(mesh.GetPrim().GetTypeName(), "Mesh")
+            self.assertEqual(mesh.GetPointsAttr().Get(), expected.GetPointsAttr().Get())
+            self.assertEqual(mesh.GetFaceVertexCountsAttr().Get(), expected.GetFaceVertexCountsAttr().Get())
+            self.assertEqual(mesh.GetFaceVertexIndicesAttr().Get(), expected.GetFaceVertexIndicesAttr().Get())
+            self.assertEqual(mesh.GetExtentAttr().Get(), expected.GetExtentAttr().Get())
+            self.assertEqual(mesh.GetSubdivisionSchemeAttr().Get(), UsdGeom.Tokens.none)
+            self.assertEqual(mesh.GetOrientationAttr().Get(), UsdGeom.Tokens.rightHanded)
+            primvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+            self.assertTrue(primvar.HasAuthoredValue())
+            self.assertEqual(primvar.Get(), normals.values())
+            self.assertEqual(primvar.GetInterpolation(), normals.interpolation())
+
+        # Undefined ancestors are defined rather than left as overs
+        self.assertTrue(stage.GetPrimAtPath("/World/Batch").IsDefined())
+        self.assertIsValidUsd(stage)
+
+    def testPerElementFailure(self):
+        stage = self.createTestStage()
+        descriptions = [
+            usdex.core.PolyMeshDescription(Sdf.Path("/World/Valid"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+            usdex.core.PolyMeshDescription(Sdf.Path("/World/InvalidTopology"), Vt.IntArray([2]), FACE_VERTEX_INDICES, POINTS),
+            usdex.core.PolyMeshDescription(Sdf.Path("/World/EmptyPoints"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, Vt.Vec3fArray()),
+            usdex.core.PolyMeshDescription(Sdf.Path("Relative"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+            usdex.core.PolyMeshDescription(Sdf.Path("/World/AlsoValid"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location"),
+            ],
+        ):
+            meshes = usdex.core.definePolyMeshes(stage, descriptions)
+
+        self.assertEqual(len(meshes), len(descriptions))
+        self.assertTrue(meshes[0])
+        self.assertFalse(meshes[1])
+        self.assertFalse(meshes[2])
+        self.assertFalse(meshes[3])
+        self.assertTrue(meshes[4])
+        self.assertFalse(stage.GetPrimAtPath("/World/InvalidTopology"))
+        self.assertFalse(stage.GetPrimAtPath("/World/EmptyPoints"))
+        self.assertIsValidUsd(stage)
+
+    def testInstanceProxyLocations(self):
+        stage = self.createTestStage()
+        usdex.core.defineXform(stage, "/World/Prototype/Child")
+        instance = usdex.core.defineXform(stage, "/World/Instance").GetPrim()
+        instance.GetReferences().AddInternalReference("/World/Prototype")
+        instance.SetInstanceable(True)
+
+        # Siblings share a single lookup of their parent, and the location of every mesh is validated before its data
+        descriptions = [
+            usdex.core.PolyMeshDescription(Sdf.Path(f"/World/Batch/Mesh_{i}"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS) for i in range(3)
+        ]
+        descriptions.append(usdex.core.PolyMeshDescription(Sdf.Path("/World/Instance/Child"), Vt.IntArray([2]), FACE_VERTEX_INDICES, POINTS))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            meshes = usdex.core.definePolyMeshes(stage, descriptions)
+
+        self.assertTrue(all(meshes[:3]))
+        self.assertFalse(meshes[3])
+        self.assertFalse(stage.GetPrimAtPath("/World/Instance/Child").IsA(UsdGeom.Mesh))
+
+    def testTrustedValidationPolicy(self):
+        stage = self.createTestStage()
+        # The faceVertexIndices are out of range of the points, and the uvs have too few values for their interpolation
+        points = Vt.Vec3fArray(list(POINTS)[:4])
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec2fArray([Gf.Vec2f(0.0, 0.0)]))
+        descriptions = [
+            usdex.core.PolyMeshDescription(Sdf.Path("/World/Trusted"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, points),
+            usdex.core.PolyMeshDescription(Sdf.Path("/World/InvalidUvs"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, uvs=uvs),
+        ]
+
+        # The contents of the topology are trusted, but the array sizes are still validated
+        with usdex.core.ScopedValidationPolicy(usdex.core.ValidationPolicy.eTrusted):
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid uvs")]):
+                meshes = usdex.core.definePolyMeshes(stage, descriptions)
+        self.assertTrue(meshes[0])
+        self.assertEqual(meshes[0].GetFaceVertexIndicesAttr().Get(), FACE_VERTEX_INDICES)
+        self.assertFalse(meshes[1])
+
+        # The contents are validated by default
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            mesh = usdex.core.definePolyMesh(stage, "/World/Validated", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, points)
+        self.assertFalse(mesh)
+
+    def testEmptyBatch(self):
+        stage = self.createTestStage()
+        self.assertEqual(usdex.core.definePolyMeshes(stage, []), [])
+
+
+class DefineDeformingPolyMeshTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        stage.SetDefaultPrim(UsdGeom.Xform.Define(stage, "/World").GetPrim())
+        return stage
+
+    def frames(self, count):
+        times = [Usd.TimeCode(float(i)) for i in range(count)]
+        points = [Vt.Vec3fArray([x + Gf.Vec3f(0.0, float(i), 0.0) for x in POINTS]) for i in range(count)]
+        return times, points
+
+    def testTimeSamples(self):
+        stage = self.createTestStage()
+        times, points = self.frames(5)
+        normals = [
+            usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, float(i)).GetNormalized() for _ in POINTS]))
+            for i in range(len(times))
+        ]
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec2fArray([Gf.Vec2f(0.0, 0.0) for _ in POINTS]))
+
+        mesh = usdex.core.defineDeformingPolyMesh(
+            stage,
+            "/World/Cache",
+            FACE_VERTEX_COUNTS,
+            FACE_VERTEX_INDICES,
+            times,
+            points,
+            normals=normals,
+            uvs=uvs,
+        )
+        self.assertTrue(mesh)
+        self.assertEqual(mesh.GetFaceVertexCountsAttr().Get(), FACE_VERTEX_COUNTS)
+        self.assertEqual(mesh.GetFaceVertexIndicesAttr().Get(), FACE_VERTEX_INDICES)
+
+        # The points, normals and extent are only authored as time samples
+        self.assertEqual(mesh.GetPointsAttr().GetTimeSamples(), [t.GetValue() for t in times])
+        self.assertIsNone(mesh.GetPointsAttr().Get(Usd.TimeCode.Default()))
+        normalsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertEqual(normalsPrimvar.GetInterpolation(), UsdGeom.Tokens.vertex)
+        self.assertFalse(normalsPrimvar.IsIndexed())
+        for time, framePoints, frameNormals in zip(times, points, normals):
+            self.assertEqual(mesh.GetPointsAttr().Get(time), framePoints)
+            self.assertEqual(normalsPrimvar.Get(time), frameNormals.values())
+            self.assertEqual(mesh.GetExtentAttr().Get(time), UsdGeom.Boundable.ComputeExtentFromPlugins(mesh, time))
+
+        # The static primvars are authored as default values
+        uvsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdUtils.GetPrimaryUVSetName())
+        self.assertEqual(uvsPrimvar.Get(), uvs.values())
+        self.assertFalse(uvsPrimvar.GetAttr().GetTimeSamples())
+        self.assertIsValidUsd(stage)
+
+    def testIndexedNormals(self):
+        stage = self.createTestStage()
+        times, points = self.frames(3)
+        normals = [
+            usdex.core.Vec3fPrimvarData(
+                UsdGeom.Tokens.faceVarying,
+                Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0), Gf.Vec3f(float(i), 0.0, 1.0).GetNormalized()]),
+                Vt.IntArray([0, 0, 0, 0, 1, 1, 1, 1]),
+            )
+            for i in range(len(times))
+        ]
+        mesh = usdex.core.defineDeformingPolyMesh(stage, "/World/Cache", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, times, points, normals)
+        self.assertTrue(mesh)
+        primvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertTrue(primvar.IsIndexed())
+        for time, frameNormals in zip(times, normals):
+            self.assertEqual(primvar.Get(time), frameNormals.values())
+            self.assertEqual(primvar.GetIndices(time), frameNormals.indices())
+
+    def testInvalidFrames(self):
+        stage = self.createTestStage()
+        times, points = self.frames(3)
+
+        # There must be points for every time
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid frames")]):
+            mesh = usdex.core.defineDeformingPolyMesh(stage, "/World/Cache", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, times, points[:2])
+        self.assertFalse(mesh)
+
+        # The default time is not valid
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*default time code is not valid")]):
+            mesh = usdex.core.defineDeformingPolyMesh(
+                stage, "/World/Cache", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, [Usd.TimeCode.Default()], points[:1]
+            )
+        self.assertFalse(mesh)
+
+        # The topology is validated against the first frame
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            mesh = usdex.core.defineDeformingPolyMesh(stage, "/World/Cache", Vt.IntArray([2]), FACE_VERTEX_INDICES, times, points)
+        self.assertFalse(mesh)
+
+        # Every frame must have the same number of points
+        points[2] = Vt.Vec3fArray(POINTS[:4])
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid frame at time 2.*Expected 6 points but found 4")],
+        ):
+            mesh = usdex.core.defineDeformingPolyMesh(stage, "/World/Cache", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, times, points)
+        self.assertFalse(mesh)
+        self.assertFalse(stage.GetPrimAtPath("/World/Cache"))
+
+
+class UpdatePolyMeshTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        stage.SetDefaultPrim(UsdGeom.Xform.Define(stage, "/World").GetPrim())
+        return stage
+
+    def testUnchangedDataAuthorsNothing(self):
+        stage = self.createTestStage()
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1.0, 0.0, 0.0)]))
+        mesh = usdex.core.definePolyMesh(stage, "/World/Mesh", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, displayColor=displayColor)
+        self.assertTrue(mesh)
+
+        before = stage.GetRootLayer().ExportToString()
+        notices = []
+        listener = Tf.Notice.Register(Usd.Notice.ObjectsChanged, lambda notice, sender: notices.append(notice), stage)
+        self.assertTrue(usdex.core.updatePolyMesh(mesh, FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, displayColor=displayColor))
+        listener.Revoke()
+        self.assertEqual(stage.GetRootLayer().ExportToString(), before)
+        self.assertEqual(len(notices), 0)
+
+        # Primvars which are not provided are left untouched
+        self.assertTrue(usdex.core.updatePolyMesh(mesh, FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS))
+        self.assertEqual(stage.GetRootLayer().ExportToString(), before)
+        self.assertEqual(mesh.GetDisplayColorPrimvar().Get(), displayColor.values())
+
+    def testChangedPoints(self):
+        stage = self.createTestStage()
+        mesh = usdex.core.definePolyMesh(stage, "/World/Mesh", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS)
+        self.assertTrue(mesh)
+
+        points = Vt.Vec3fArray([x * 2.0 for x in POINTS])
+        self.assertTrue(usdex.core.updatePolyMesh(mesh, FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, points))
+        self.assertEqual(mesh.GetPointsAttr().Get(), points)
+        self.assertEqual(mesh.GetExtentAttr().Get(), UsdGeom.Boundable.ComputeExtentFromPlugins(mesh, Usd.TimeCode.Default()))
+        self.assertEqual(mesh.GetFaceVertexCountsAttr().Get(), FACE_VERTEX_COUNTS)
+        self.assertEqual(mesh.GetFaceVertexIndicesAttr().Get(), FACE_VERTEX_INDICES)
+        self.assertIsValidUsd(stage)
+
+    def testChangedPrimvars(self):
+        stage = self.createTestStage()
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0) for _ in POINTS]))
+        mesh = usdex.core.definePolyMesh(stage, "/World/Mesh", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, normals=normals)
+        self.assertTrue(mesh)
+
+        # Changing the interpolation and indexing of a primvar is an update, even if the flattened values are equivalent
+        indexedNormals = usdex.core.Vec3fPrimvarData(
+            UsdGeom.Tokens.faceVarying, Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)]), Vt.IntArray([0] * len(FACE_VERTEX_INDICES))
+        )
+        self.assertTrue(usdex.core.updatePolyMesh(mesh, FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, normals=indexedNormals))
+        primvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertEqual(primvar.GetInterpolation(), UsdGeom.Tokens.faceVarying)
+        self.assertTrue(primvar.IsIndexed())
+        self.assertEqual(primvar.GetIndices(), indexedNormals.indices())
+
+        # New primvars are authored
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec2fArray([Gf.Vec2f(0.0, 0.0) for _ in POINTS]))
+        self.assertTrue(usdex.core.updatePolyMesh(mesh, FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, uvs=uvs))
+        self.assertEqual(UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdUtils.GetPrimaryUVSetName()).Get(), uvs.values())
+        self.assertIsValidUsd(stage)
+
+    def testInvalid(self):
+        stage = self.createTestStage()
+        mesh = usdex.core.definePolyMesh(stage, "/World/Mesh", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS)
+        self.assertTrue(mesh)
+        before = stage.GetRootLayer().ExportToString()
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid mesh")]):
+            self.assertFalse(usdex.core.updatePolyMesh(UsdGeom.Mesh(), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            self.assertFalse(usdex.core.updatePolyMesh(mesh, Vt.IntArray([2]), FACE_VERTEX_INDICES, POINTS))
+        self.assertEqual(stage.GetRootLayer().ExportToString(), before)
+
+
+class CompactFaceVaryingPrimvarTestCase(usdex.test.TestCase):
+
+    def testDemoteToVertex(self):
+        # Every face vertex of each point has the same value, so the primvar is equivalent to a vertex primvar
+        values = Vt.Vec2fArray([Gf.Vec2f(POINTS[i][0], POINTS[i][2]) for i in FACE_VERTEX_INDICES])
+        primvar = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertTrue(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS)))
+        self.assertEqual(primvar.interpolation(), UsdGeom.Tokens.vertex)
+        self.assertFalse(primvar.hasIndices())
+        self.assertEqual(primvar.values(), Vt.Vec2fArray([Gf.Vec2f(p[0], p[2]) for p in POINTS]))
+
+        # Duplicate values are also indexed if that reduces the storage
+        values = Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)] * len(FACE_VERTEX_INDICES))
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertTrue(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS)))
+        self.assertEqual(primvar.interpolation(), UsdGeom.Tokens.vertex)
+        self.assertEqual(primvar.values(), Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)]))
+        self.assertEqual(primvar.indices(), Vt.IntArray([0] * len(POINTS)))
+        self.assertTrue(primvar.isValid())
+
+    def testWeldFaceVarying(self):
+        # The faces have a hard edge, so the primvar must remain faceVarying, but the values can be indexed
+        up = Gf.Vec3f(0.0, 1.0, 0.0)
+        side = Gf.Vec3f(1.0, 0.0, 0.0)
+        values = Vt.Vec3fArray([up, up, up, up, side, side, side, side])
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertTrue(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS)))
+        self.assertEqual(primvar.interpolation(), UsdGeom.Tokens.faceVarying)
+        self.assertEqual(primvar.values(), Vt.Vec3fArray([up, side]))
+        self.assertEqual(primvar.indices(), Vt.IntArray([0, 0, 0, 0, 1, 1, 1, 1]))
+
+        # Compacting again cannot reduce the storage any further
+        self.assertFalse(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS)))
+
+    def testEpsilon(self):
+        values = Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)] * len(FACE_VERTEX_INDICES))
+        values[7] = Gf.Vec3f(0.0, 1.0, 0.0001)
+
+        # The values are not exactly equal, so they can only be welded if a tolerance is provided
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertTrue(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS)))
+        self.assertEqual(primvar.interpolation(), UsdGeom.Tokens.faceVarying)
+        self.assertEqual(len(primvar.values()), 2)
+
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertTrue(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS), epsilon=0.01))
+        self.assertEqual(primvar.interpolation(), UsdGeom.Tokens.vertex)
+        self.assertEqual(primvar.values(), Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)]))
+
+    def testUnchanged(self):
+        # Only faceVarying primvars are compacted
+        values = Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)] * len(POINTS))
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, values)
+        self.assertFalse(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS)))
+        self.assertEqual(primvar.interpolation(), UsdGeom.Tokens.vertex)
+
+        # Primvars which do not match the topology are not modified
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertFalse(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS)))
+        self.assertEqual(primvar.values(), values)
+
+        # Unique values cannot be compacted
+        values = Vt.Vec2fArray([Gf.Vec2f(float(i), 0.0) for i in range(len(FACE_VERTEX_INDICES))])
+        primvar = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertFalse(usdex.core.compactFaceVaryingPrimvar(primvar, FACE_VERTEX_INDICES, len(POINTS)))
+        self.assertFalse(primvar.hasIndices())
+
+    def testDefinePolyMesh(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        stage.SetDefaultPrim(UsdGeom.Xform.Define(stage, "/World").GetPrim())
+
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)] * len(FACE_VERTEX_INDICES)))
+        uvs = usdex.core.Vec2fPrimvarData(
+            UsdGeom.Tokens.faceVarying,
+            Vt.Vec2fArray([Gf.Vec2f(POINTS[i][0], POINTS[i][2]) for i in FACE_VERTEX_INDICES]),
+        )
+
+        # Without a tolerance the primvars are authored as provided
+        mesh = usdex.core.definePolyMesh(stage, "/World/Expanded", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, normals=normals, uvs=uvs)
+        self.assertEqual(UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals).GetInterpolation(), UsdGeom.Tokens.faceVarying)
+
+        mesh = usdex.core.definePolyMesh(
+            stage,
+            "/World/Compacted",
+            FACE_VERTEX_COUNTS,
+            FACE_VERTEX_INDICES,
+            POINTS,
+            normals=normals,
+            uvs=uvs,
+            compactionEpsilon=0.0,
+        )
+        self.assertTrue(mesh)
+        normalsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertEqual(normalsPrimvar.GetInterpolation(), UsdGeom.Tokens.vertex)
+        self.assertTrue(normalsPrimvar.IsIndexed())
+        self.assertEqual(normalsPrimvar.ComputeFlattened(), Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)] * len(POINTS)))
+        uvsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdUtils.GetPrimaryUVSetName())
+        self.assertEqual(uvsPrimvar.GetInterpolation(), UsdGeom.Tokens.vertex)
+        self.assertIsValidUsd(stage)
+
+
+class BufferProtocolTestCase(usdex.test.TestCase):
+
+    def testDefinePolyMeshFromBuffers(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        stage.SetDefaultPrim(UsdGeom.Xform.Define(stage, "/World").GetPrim())
+
+        points = memoryview(array.array("f", [c for p in POINTS for c in p]).tobytes()).cast("f", [len(POINTS), 3])
+        normals = memoryview(array.array("d", [0.0, 1.0, 0.0] * len(POINTS)).tobytes()).cast("d", [len(POINTS), 3])
+        mesh = usdex.core.definePolyMesh(
+            stage,
+            "/World/Mesh",
+            array.array("i", FACE_VERTEX_COUNTS),
+            array.array("i", FACE_VERTEX_INDICES),
+            points,
+            normals=usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, normals),
+        )
+        self.assertTrue(mesh)
+        self.assertEqual(mesh.GetFaceVertexCountsAttr().Get(), FACE_VERTEX_COUNTS)
+        self.assertEqual(mesh.GetFaceVertexIndicesAttr().Get(), FACE_VERTEX_INDICES)
+        self.assertEqual(mesh.GetPointsAttr().Get(), POINTS)
+        self.assertEqual(UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals).Get(), Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)] * len(POINTS)))
+        self.assertEqual(mesh.GetExtentAttr().Get(), UsdGeom.Boundable.ComputeExtentFromPlugins(mesh, Usd.TimeCode.Default()))
+
+        # The authored data must remain valid once the buffers are released
+        del points
+        self.assertEqual(mesh.GetPointsAttr().Get(), POINTS)
+
+
+class MeshLibraryTestCase(usdex.test.TestCase):
+
+    def createStage(self, name: str) -> Usd.Stage:
+        return usdex.core.createStage(
+            self.tmpFile(name, "usda"),
+            name,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+
+    def testDeduplication(self):
+        libraryStage = self.createStage("library")
+        layoutStage = self.createStage("layout")
+        layout = layoutStage.GetDefaultPrim().GetPath()
+        library = usdex.core.MeshLibrary(libraryStage)
+
+        red = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]))
+        prims = []
+        for i in range(3):
+            mesh = usdex.core.PolyMeshDescription(layout.AppendChild(f"Bolt_{i}"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS)
+            prims.append(library.definePolyMesh(layoutStage, mesh))
+        # a different primvar is a different mesh
+        mesh = usdex.core.PolyMeshDescription(layout.AppendChild("RedBolt"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, displayColor=red)
+        prims.append(library.definePolyMesh(layoutStage, mesh))
+
+        self.assertTrue(all(prims))
+        self.assertEqual(library.getUniqueMeshCount(), 2)
+        self.assertEqual(library.getUseCount(), 4)
+
+        # each unique mesh is defined once in the library, named after its first use
+        libraryRoot = libraryStage.GetDefaultPrim()
+        self.assertEqual([child.GetName() for child in libraryRoot.GetChildren()], ["Bolt_0", "RedBolt"])
+        libraryMesh = UsdGeom.Mesh(libraryRoot.GetChild("Bolt_0").GetChild("Mesh"))
+        self.assertTrue(libraryMesh)
+        self.assertEqual(libraryMesh.GetPointsAttr().Get(), POINTS)
+
+        # every use references the library and shares a prototype
+        for prim in prims:
+            self.assertTrue(prim.IsA(UsdGeom.Xform))
+            self.assertTrue(prim.HasAuthoredReferences())
+            self.assertTrue(prim.IsInstance())
+        self.assertEqual(prims[0].GetPrototype(), prims[2].GetPrototype())
+        self.assertNotEqual(prims[0].GetPrototype(), prims[3].GetPrototype())
+        self.assertEqual(len(layoutStage.GetPrototypes()), 2)
+
+        # the uses can be transformed independently
+        self.assertTrue(usdex.core.setLocalTransform(prims[1], Gf.Transform(Gf.Vec3d(1, 0, 0))))
+        self.assertEqual(usdex.core.getLocalTransform(prims[0]).GetTranslation(), Gf.Vec3d(0))
+
+        self.assertIsValidUsd(libraryStage)
+        self.assertIsValidUsd(layoutStage)
+
+    def testNotInstanceable(self):
+        libraryStage = self.createStage("library")
+        library = usdex.core.MeshLibrary(libraryStage, instanceable=False)
+        prim = library.definePolyMesh(
+            libraryStage,
+            usdex.core.PolyMeshDescription(Sdf.Path("/library/Uses/Bolt"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+        )
+        self.assertTrue(prim)
+        self.assertFalse(prim.IsInstance())
+        self.assertTrue(UsdGeom.Mesh(prim.GetChild("Mesh")))
+
+    def testInvalid(self):
+        libraryStage = self.createStage("library")
+        layoutStage = self.createStage("layout")
+        library = usdex.core.MeshLibrary(libraryStage)
+
+        # invalid meshes and locations do not add to the library
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            prim = library.definePolyMesh(
+                layoutStage,
+                usdex.core.PolyMeshDescription(Sdf.Path("/layout/Invalid"), Vt.IntArray([2]), FACE_VERTEX_INDICES, POINTS),
+            )
+        self.assertFalse(prim)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            prim = library.definePolyMesh(
+                layoutStage,
+                usdex.core.PolyMeshDescription(Sdf.Path("Relative"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+            )
+        self.assertFalse(prim)
+        self.assertEqual(library.getUniqueMeshCount(), 0)
+        self.assertEqual(library.getUseCount(), 0)
+        self.assertFalse(libraryStage.GetDefaultPrim().GetChildren())
+
+        # a library stage without a default prim is invalid
+        library = usdex.core.MeshLibrary(Usd.Stage.CreateInMemory())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid library stage")]):
+            prim = library.definePolyMesh(
+                layoutStage,
+                usdex.core.PolyMeshDescription(Sdf.Path("/layout/Bolt"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+            )
+        self.assertFalse(prim)
+
+
+class MeshLodTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        stage.SetDefaultPrim(UsdGeom.Xform.Define(stage, "/World").GetPrim())
+        return stage
+
+    @staticmethod
+    def createGrid(path, width=10):
+        """A flat square grid of quads, with vertex normals and uvs, and a uniform display color which differs between its left and right halves"""
+        points = Vt.Vec3fArray([Gf.Vec3f(x / width, y / width, 0.0) for y in range(width + 1) for x in range(width + 1)])
+        stride = width + 1
+        faceVertexCounts = Vt.IntArray([4] * (width * width))
+        faceVertexIndices = Vt.IntArray(
+            [
+                index
+                for y in range(width)
+                for x in range(width)
+                for index in (y * stride + x, y * stride + x + 1, y * stride + x + stride + 1, y * stride + x + stride)
+            ]
+        )
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0.0, 0.0, 1.0)] * len(points)))
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec2fArray([Gf.Vec2f(point[0], point[1]) for point in points]))
+        colors = Vt.Vec3fArray([Gf.Vec3f(1.0, 0.0, 0.0), Gf.Vec3f(0.0, 0.0, 1.0)])
+        indices = Vt.IntArray([0 if x < width // 2 else 1 for y in range(width) for x in range(width)])
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.uniform, colors, indices)
+        return usdex.core.PolyMeshDescription(
+            Sdf.Path(path),
+            faceVertexCounts,
+            faceVertexIndices,
+            points,
+            normals=normals,
+            uvs=uvs,
+            displayColor=displayColor,
+        )
+
+    def testSimplifyPolyMesh(self):
+        grid = self.createGrid("/World/Grid")
+        result = usdex.core.simplifyPolyMesh(grid, 0.25)
+        self.assertIsNotNone(result)
+        self.assertEqual(result.path, grid.path)
+
+        # The mesh is triangulated and reduced to the requested ratio of its 200 triangles
+        self.assertTrue(all(count == 3 for count in result.faceVertexCounts))
+        self.assertLessEqual(len(result.faceVertexCounts), 50)
+        self.assertTrue(UsdGeom.Mesh.ValidateTopology(result.faceVertexIndices, result.faceVertexCounts, len(result.points))[0])
+
+        # The simplified points are a subset of the original points, and the vertex primvars follow them
+        originalPoints = list(grid.points)
+        self.assertLess(len(result.points), len(originalPoints))
+        for point, uv in zip(result.points, result.uvs.values()):
+            self.assertIn(point, originalPoints)
+            self.assertEqual(uv, Gf.Vec2f(point[0], point[1]))
+        self.assertEqual(result.normals.interpolation(), UsdGeom.Tokens.vertex)
+        self.assertEqual(len(result.normals.values()), len(result.points))
+
+        # The open boundary and the seam of the display color are preserved, so the halves of the grid keep their colors
+        self.assertEqual(result.displayColor.interpolation(), UsdGeom.Tokens.uniform)
+        self.assertEqual(result.displayColor.values(), grid.displayColor.values())
+        self.assertEqual(len(result.displayColor.indices()), len(result.faceVertexCounts))
+        for face, colorIndex in enumerate(result.displayColor.indices()):
+            centroid = sum((result.points[result.faceVertexIndices[face * 3 + i]] for i in range(3)), Gf.Vec3f()) / 3.0
+            self.assertEqual(colorIndex, 0 if centroid[0] < 0.5 else 1)
+        for corner in (Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 0, 0), Gf.Vec3f(0, 1, 0), Gf.Vec3f(1, 1, 0)):
+            self.assertIn(corner, list(result.points))
+
+        # The result is deterministic
+        again = usdex.core.simplifyPolyMesh(grid, 0.25)
+        self.assertEqual(again.faceVertexIndices, result.faceVertexIndices)
+        self.assertEqual(again.points, result.points)
+
+    def testSimplifyPolyMeshInvalid(self):
+        grid = self.createGrid("/World/Grid")
+        for ratio in (0.0, -1.0, 1.5, float("nan")):
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid ratio")]):
+                self.assertIsNone(usdex.core.simplifyPolyMesh(grid, ratio))
+
+        grid.faceVertexIndices = Vt.IntArray([0, 1, 2, 1000] * 100)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            self.assertIsNone(usdex.core.simplifyPolyMesh(grid, 0.5))
+
+    def testVariantSet(self):
+        stage = self.createTestStage()
+        grids = [self.createGrid(f"/World/Grid_{i}") for i in range(4)]
+        meshes = usdex.core.definePolyMeshLods(stage, grids, [0.5, 0.1])
+        self.assertEqual(len(meshes), len(grids))
+
+        for mesh, grid in zip(meshes, grids):
+            self.assertTrue(mesh)
+            self.assertEqual(mesh.GetPath(), grid.path)
+
+            # The full detail mesh is selected by default
+            variantSet = mesh.GetPrim().GetVariantSets().GetVariantSet(usdex.core.getLodToken())
+            self.assertEqual(variantSet.GetVariantNames(), ["LOD0", "LOD1", "LOD2"])
+            self.assertEqual(variantSet.GetVariantSelection(), "LOD0")
+            self.assertEqual(mesh.GetFaceVertexCountsAttr().Get(), grid.faceVertexCounts)
+            self.assertEqual(mesh.GetPointsAttr().Get(), grid.points)
+
+            # Each LOD matches the simplified mesh, including its extent and primvars
+            for variant, ratio in (("LOD1", 0.5), ("LOD2", 0.1)):
+                expected = usdex.core.simplifyPolyMesh(grid, ratio)
+                variantSet.SetVariantSelection(variant)
+                self.assertEqual(mesh.GetFaceVertexIndicesAttr().Get(), expected.faceVertexIndices)
+                self.assertEqual(mesh.GetPointsAttr().Get(), expected.points)
+                self.assertEqual(mesh.GetExtentAttr().Get(), UsdGeom.Boundable.ComputeExtentFromPlugins(mesh, Usd.TimeCode.Default()))
+                self.assertEqual(UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdUtils.GetPrimaryUVSetName()).Get(), expected.uvs.values())
+                self.assertEqual(mesh.GetDisplayColorPrimvar().GetIndices(), expected.displayColor.indices())
+            variantSet.SetVariantSelection("LOD0")
+
+        self.assertIsValidUsd(stage)
+
+    def testPurpose(self):
+        stage = self.createTestStage()
+        grid = self.createGrid("/World/Grid")
+        (mesh,) = usdex.core.definePolyMeshLods(stage, [grid], [0.2], usdex.core.MeshLodStyle.ePurpose)
+        self.assertTrue(mesh)
+        self.assertEqual(mesh.GetPurposeAttr().Get(), UsdGeom.Tokens.render)
+        self.assertEqual(mesh.GetPointsAttr().Get(), grid.points)
+
+        proxy = UsdGeom.Mesh(stage.GetPrimAtPath("/World/Grid_proxy"))
+        self.assertTrue(proxy)
+        self.assertEqual(proxy.GetPurposeAttr().Get(), UsdGeom.Tokens.proxy)
+        self.assertEqual(mesh.GetProxyPrimRel().GetTargets(), [proxy.GetPath()])
+        self.assertEqual(proxy.GetFaceVertexIndicesAttr().Get(), usdex.core.simplifyPolyMesh(grid, 0.2).faceVertexIndices)
+        self.assertIsValidUsd(stage)
+
+    def testInvalid(self):
+        stage = self.createTestStage()
+        grid = self.createGrid("/World/Grid")
+
+        # The ratios are validated before any mesh is defined
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid ratio")]):
+            (mesh,) = usdex.core.definePolyMeshLods(stage, [grid], [0.5, 2.0])
+        self.assertFalse(mesh)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*no ratios")]):
+            (mesh,) = usdex.core.definePolyMeshLods(stage, [grid], [])
+        self.assertFalse(mesh)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*only one proxy")]):
+            (mesh,) = usdex.core.definePolyMeshLods(stage, [grid], [0.5, 0.1], usdex.core.MeshLodStyle.ePurpose)
+        self.assertFalse(mesh)
+        self.assertFalse(stage.GetPrimAtPath(grid.path))
+
+        # Invalid meshes are reported individually
+        invalid = self.createGrid("/World/Invalid")
+        invalid.points = Vt.Vec3fArray()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points")]):
+            meshes = usdex.core.definePolyMeshLods(stage, [grid, invalid], [0.5])
+        self.assertTrue(meshes[0])
+        self.assertFalse(meshes[1])
+        self.assertFalse(stage.GetPrimAtPath(invalid.path))
+
+
+class MaterialSubsetsTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        world = UsdGeom.Xform.Define(stage, "/World").GetPrim()
+        stage.SetDefaultPrim(world)
+        materials = usdex.core.defineScope(world, "Materials").GetPrim()
+        self.red = usdex.core.definePreviewMaterial(materials, "Red", Gf.Vec3f(1.0, 0.0, 0.0))
+        self.green = usdex.core.definePreviewMaterial(materials, "Green", Gf.Vec3f(0.0, 1.0, 0.0))
+        self.blue = usdex.core.definePreviewMaterial(materials, "Blue", Gf.Vec3f(0.0, 0.0, 1.0))
+        return stage
+
+    def testPartition(self):
+        stage = self.createTestStage()
+        grid = MeshLodTestCase.createGrid("/World/Grid", width=4)
+        mesh = usdex.core.definePolyMesh(stage, grid.path, grid.faceVertexCounts, grid.faceVertexIndices, grid.points)
+        faceMaterialIds = Vt.IntArray([i % 2 for i in range(16)])
+        subsets = usdex.core.defineMaterialSubsets(mesh, faceMaterialIds, [self.red, self.green, self.blue])
+
+        # The unassigned material has no subset
+        self.assertEqual(len(subsets), 3)
+        self.assertTrue(subsets[0])
+        self.assertTrue(subsets[1])
+        self.assertFalse(subsets[2])
+        self.assertEqual(subsets[0].GetPrim().GetName(), "Red")
+        self.assertEqual(subsets[1].GetPrim().GetName(), "Green")
+        self.assertEqual(subsets[0].GetIndicesAttr().Get(), Vt.IntArray(list(range(0, 16, 2))))
+        self.assertEqual(subsets[1].GetIndicesAttr().Get(), Vt.IntArray(list(range(1, 16, 2))))
+
+        for subset, material in zip(subsets[:2], [self.red, self.green]):
+            self.assertEqual(subset.GetElementTypeAttr().Get(), UsdGeom.Tokens.face)
+            self.assertEqual(subset.GetFamilyNameAttr().Get(), UsdShade.Tokens.materialBind)
+            self.assertTrue(subset.GetPrim().HasAPI(UsdShade.MaterialBindingAPI))
+            bound, _ = UsdShade.MaterialBindingAPI(subset).ComputeBoundMaterial()
+            self.assertEqual(bound.GetPath(), material.GetPath())
+
+        # Every face is assigned, so the subsets partition the mesh
+        self.assertEqual(UsdGeom.Subset.GetFamilyType(mesh, UsdShade.Tokens.materialBind), UsdGeom.Tokens.partition)
+        valid, reason = UsdGeom.Subset.ValidateFamily(mesh, UsdGeom.Tokens.face, UsdShade.Tokens.materialBind)
+        self.assertTrue(valid, reason)
+        self.assertIsValidUsd(stage)
+
+    def testUnassignedFaces(self):
+        stage = self.createTestStage()
+        mesh = usdex.core.definePolyMesh(stage, "/World/Mesh", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS)
+        subsets = usdex.core.defineMaterialSubsets(mesh, Vt.IntArray([-1, 1]), [self.red, self.blue])
+        self.assertFalse(subsets[0])
+        self.assertEqual(subsets[1].GetIndicesAttr().Get(), Vt.IntArray([1]))
+        self.assertEqual(UsdGeom.Subset.GetFamilyType(mesh, UsdShade.Tokens.materialBind), UsdGeom.Tokens.nonOverlapping)
+
+        # Materials with the same name have unique subset names
+        other = usdex.core.definePolyMesh(stage, "/World/Other", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS)
+        subsets = usdex.core.defineMaterialSubsets(other, Vt.IntArray([0, 1]), [self.red, self.red])
+        self.assertEqual([subset.GetPrim().GetName() for subset in subsets], ["Red", "Red_1"])
+        self.assertIsValidUsd(stage)
+
+    def testManyFaces(self):
+        # Enough faces to be partitioned concurrently in several chunks
+        stage = self.createTestStage()
+        numFaces = 300000
+        mesh = UsdGeom.Mesh.Define(stage, "/World/Mesh")
+        mesh.CreateFaceVertexCountsAttr().Set(Vt.IntArray([3] * numFaces))
+        faceMaterialIds = Vt.IntArray([(i // 7) % 3 for i in range(numFaces)])
+        subsets = usdex.core.defineMaterialSubsets(mesh, faceMaterialIds, [self.red, self.green, self.blue])
+        for materialId, subset in enumerate(subsets):
+            expected = Vt.IntArray([i for i in range(numFaces) if (i // 7) % 3 == materialId])
+            self.assertEqual(subset.GetIndicesAttr().Get(), expected)
+
+    def testInvalid(self):
+        stage = self.createTestStage()
+        mesh = usdex.core.definePolyMesh(stage, "/World/Mesh", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched material ids")]):
+            self.assertEqual(usdex.core.defineMaterialSubsets(mesh, Vt.IntArray([0]), [self.red]), [])
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid material ids")]):
+            self.assertEqual(usdex.core.defineMaterialSubsets(mesh, Vt.IntArray([0, 2]), [self.red, self.blue]), [])
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdShadeMaterial")]):
+            self.assertEqual(usdex.core.defineMaterialSubsets(mesh, Vt.IntArray([0, 1]), [self.red, UsdShade.Material()]), [])
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdGeomMesh")]):
+            self.assertEqual(usdex.core.defineMaterialSubsets(UsdGeom.Mesh(), Vt.IntArray(), []), [])
+        self.assertEqual(mesh.GetPrim().GetChildren(), [])
+
+
+class ConcurrentDefinePolyMeshTestCase(usdex.test.TestCase):
+
+    def testPythonThreads(self):
+        # the GIL is released while each mesh is authored, so threads authoring separate stages run concurrently
+        def author(index):
+            stage = Usd.Stage.CreateInMemory()
+            meshes = [usdex.core.definePolyMesh(stage, f"/Mesh{i}", FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS) for i in range(20)]
+            return index, stage, meshes
+
+        with concurrent.futures.ThreadPoolExecutor(max_workers=4) as executor:
+            results = list(executor.map(author, range(8)))
+
+        self.assertEqual([index for index, _, _ in results], list(range(8)))
+        for _, stage, meshes in results:
+            self.assertTrue(all(meshes))
+            self.assertEqual(len(stage.GetPseudoRoot().GetChildren()), 20)
+            self.assertEqual(meshes[-1].GetPointsAttr().Get(), POINTS)
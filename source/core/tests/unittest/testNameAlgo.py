@@ -4,7 +4,7 @@
 
 import usdex.core
 import usdex.test
-from pxr import Sdf, Tf, Usd, UsdGeom
+from pxr import Sdf, Tf, Usd, UsdGeom, Vt
 
 
 class TranscodingTestCase(usdex.test.TestCase):
@@ -110,6 +110,53 @@ class TranscodingTestCase(usdex.test.TestCase):
             "tn__Vtd3",
         )
 
+    def testEncodeRepeated(self):
+        # Repeatedly encoding the same names produces the same results each time
+        expected = {
+            "カーテンウォール": "tn__sxB76l2Y5o0X16",
+            "straße 3": "tn__strae3_h6im0",
+            "😁": "tn__nqd3",
+        }
+        for _ in range(100):
+            for name, encoded in expected.items():
+                self.assertEqual(usdex.core.getValidPrimName(name), encoded)
+
+        # Encoding many distinct names does not affect subsequent results
+        for i in range(50000):
+            self.assertTrue(usdex.core.getValidPrimName(f"名前 {i}").startswith("tn__"))
+        for name, encoded in expected.items():
+            self.assertEqual(usdex.core.getValidPrimName(name), encoded)
+
+    def testDecodeNames(self):
+        # Transcoded names are decoded to their original values
+        originals = ["カーテンウォール", "straße 3", "😁", "123-456/555", ""]
+        encoded = [usdex.core.getValidPrimName(x) for x in originals]
+        self.assertEqual(usdex.core.getDecodedNames(encoded), originals)
+
+        # Names that were not transcoded, or can not be decoded, are returned unchanged
+        names = ["hello", "Mesh_01", "tn_", "TN__abc", "tn__$"]
+        self.assertEqual(usdex.core.getDecodedNames(names), names)
+
+        # Large vectors of names return results matching the input order
+        names = [usdex.core.getValidPrimName(f"名前 {i}") if i % 2 else f"name_{i}" for i in range(20000)]
+        decoded = usdex.core.getDecodedNames(names)
+        self.assertEqual(len(decoded), len(names))
+        for i in range(0, len(names), 997):
+            self.assertEqual(decoded[i], f"名前 {i}" if i % 2 else f"name_{i}")
+
+    def testDecodePrimRangeNames(self):
+        stage = Usd.Stage.CreateInMemory()
+        originals = ["カーテンウォール", "straße 3", "plain"]
+        paths = []
+        parent = Sdf.Path.absoluteRootPath
+        for original in originals:
+            parent = parent.AppendChild(usdex.core.getValidPrimName(original))
+            paths.append(parent)
+        stage.DefinePrim(paths[-1])
+
+        self.assertEqual(usdex.core.getDecodedNames(stage.Traverse()), originals)
+        self.assertEqual(usdex.core.getDecodedNames(Usd.PrimRange(stage.GetPrimAtPath(paths[1]))), originals[1:])
+
 
 class ValidPrimNamesTestCase(usdex.test.TestCase):
     def assertPropertyNameIsValid(self, name, msg=None):
@@ -139,6 +186,11 @@ class ValidPrimNamesTestCase(usdex.test.TestCase):
         self.assertEqual(usdex.core.getValidPrimName("_"), "_")
         self.assertEqual(usdex.core.getValidPrimName("_1"), "_1")
         self.assertEqual(usdex.core.getValidPrimName("mesh"), "mesh")
+        self.assertEqual(usdex.core.getValidPrimName("Mesh_01"), "Mesh_01")
+        self.assertEqual(usdex.core.getValidPrimName("mesh_" * 64), "mesh_" * 64)
+
+        # A single illegal character anywhere in an otherwise valid name requires encoding
+        self.assertTrue(usdex.core.getValidPrimName("mesh_" * 64 + ".").startswith("tn__"))
 
         # UTF-8 characters are correctly encoded and decoded.
         self.assertEqual(usdex.core.getValidPrimName("カーテンウォール"), "tn__sxB76l2Y5o0X16")
@@ -202,6 +254,13 @@ class ValidPrimNamesTestCase(usdex.test.TestCase):
             ["mesh__", "mesh___1", "mesh___2", "mesh___3"],
         )
 
+        # Reserved names may be any sequence of strings
+        names = ["cube", "sphere"]
+        self.assertEqual(usdex.core.getValidPrimNames(names, ("cube",)), ["cube_1", "sphere"])
+        self.assertEqual(usdex.core.getValidPrimNames(names, ["sphere", "cube"]), ["cube_1", "sphere_1"])
+        with self.assertRaises(TypeError):
+            usdex.core.getValidPrimNames(names, ["cube", 1])
+
     def testGetValidChildName(self):
         # Define a prim for which we will get a valid child name
         stage = Usd.Stage.CreateInMemory()
@@ -316,6 +375,7 @@ class ValidPrimNamesTestCase(usdex.test.TestCase):
             ("_1", "_1"),
             ("name", "name"),
             ("primvars:my:color", "primvars:my:color"),
+            ("primvars:" + "long_name" * 32, "primvars:" + "long_name" * 32),
             # UTF-8 characters are correctly encoded.
             ("カーテンウォール", "tn__sxB76l2Y5o0X16"),
             ("カーテンウォール:Bäcker", "tn__sxB76l2Y5o0X16:tn__Bcker_ah0"),
@@ -603,6 +663,22 @@ class NameCacheTestCase(usdex.test.TestCase):
         parent: Sdf.Path = Sdf.Path("/path")
         self.assertEqual(self.nameCache.getPrimNames(parent, ["foo", "foo", "foo_1"]), ["foo", "foo_2", "foo_1"])
 
+    def testGetPrimNamesManySiblings(self):
+        # Flat hierarchies with very many siblings must produce the same deterministic names as small ones
+        parent: Sdf.Path = Sdf.Path("/path")
+        count = 100000
+        names = ["part"] * count + ["part_1"]
+        result = self.nameCache.getPrimNames(parent, names)
+        self.assertEqual(len(result), len(names))
+        self.assertEqual(len(set(result)), len(names))
+        self.assertEqual(result[0], "part")
+        self.assertEqual(result[1], "part_2")
+        self.assertEqual(result[count - 1], f"part_{count}")
+        self.assertEqual(result[-1], "part_1")
+
+        # Subsequent requests continue from the cached suffix
+        self.assertEqual(self.nameCache.getPrimName(parent, "part"), f"part_{count + 1}")
+
     def testGetPrimNamesParentTypes(self):
         # An SdfPath can be passed as the parent and valid an unique names will be returned
         parent: Sdf.Path = Sdf.Path("/path")
@@ -1041,6 +1117,120 @@ class NameCacheTestCase(usdex.test.TestCase):
         self.assertInvalidPrimParentArg(func, args, result, message, True)
         self.assertInvalidPrimSpecParentArg(func, args, result, message, True)
 
+    def testSnapshot(self):
+        # Populate the cache with reserved names from both the stage and previous requests
+        parent = self.stage.DefinePrim("/parent")
+        self.stage.DefinePrim("/parent/existing")
+        parent.CreateAttribute("existing", Sdf.ValueTypeNames.Int)
+        self.assertEqual(self.nameCache.getPrimNames(parent, ["foo", "foo", "existing"]), ["foo", "foo_1", "existing_1"])
+        self.assertEqual(self.nameCache.getPropertyNames(parent, ["foo", "existing"]), ["foo", "existing_1"])
+        self.assertEqual(self.nameCache.getPrimNames(Sdf.Path("/path"), ["bar", "bar"]), ["bar", "bar_1"])
+
+        # An identical cache produces an identical snapshot
+        snapshot = self.nameCache.exportSnapshot()
+        self.assertEqual(snapshot, self.nameCache.exportSnapshot())
+
+        # The snapshot can be stored in layer metadata and read back again
+        layer = Sdf.Layer.CreateAnonymous()
+        layer.customLayerData = {"nameCache": snapshot}
+        layer.ImportFromString(layer.ExportToString())
+        snapshot = layer.customLayerData["nameCache"]
+
+        # An imported cache produces the same names as the original cache, without reading the existing children from the stage
+        resumed = usdex.core.NameCache()
+        self.assertTrue(resumed.importSnapshot(snapshot))
+        emptyStage = Usd.Stage.CreateInMemory()
+        emptyParent = emptyStage.DefinePrim("/parent")
+        for cache, prim in ((self.nameCache, parent), (resumed, emptyParent)):
+            self.assertEqual(cache.getPrimNames(prim, ["foo", "existing", "new"]), ["foo_2", "existing_2", "new"])
+            self.assertEqual(cache.getPropertyNames(prim, ["foo", "existing"]), ["foo_1", "existing_2"])
+            self.assertEqual(cache.getPrimNames(Sdf.Path("/path"), ["bar"]), ["bar_2"])
+
+        # An empty cache produces an empty snapshot which can be imported
+        empty = usdex.core.NameCache()
+        self.assertTrue(empty.importSnapshot(usdex.core.NameCache().exportSnapshot()))
+        self.assertEqual(empty.getPrimName(Sdf.Path("/path"), "bar"), "bar")
+
+    def testImportMalformedSnapshot(self):
+        self.assertEqual(self.nameCache.getPrimName(Sdf.Path("/path"), "bar"), "bar")
+        snapshot = self.nameCache.exportSnapshot()
+
+        malformed = [
+            {},
+            {"version": 0},
+            dict(snapshot, primNames=1),
+            dict(snapshot, primNames={"relative/path": snapshot["primNames"]["/path"]}),
+            dict(snapshot, propertyNames={"/": snapshot["primNames"]["/path"]}),
+            dict(snapshot, primNames={"/path": {"usedNames": Vt.TokenArray(["bar"])}}),
+            dict(
+                snapshot,
+                primNames={
+                    "/path": {
+                        "usedNames": Vt.TokenArray(["bar"]),
+                        "suffixNames": Vt.StringArray(["bar"]),
+                        "suffixIndices": Vt.Int64Array([1, 2]),
+                    }
+                },
+            ),
+        ]
+        for value in malformed:
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to import name cache snapshot")]):
+                self.assertFalse(self.nameCache.importSnapshot(value))
+
+        # A malformed snapshot does not modify the cache
+        self.assertEqual(self.nameCache.exportSnapshot(), snapshot)
+
+    def testMemoryUsage(self):
+        # The memory usage grows as names are reserved
+        initial = self.nameCache.memoryUsage()
+        self.assertGreater(initial, 0)
+        self.nameCache.getPrimNames(Sdf.Path("/parent"), [f"name_{i}" for i in range(1000)])
+        afterNames = self.nameCache.memoryUsage()
+        self.assertGreater(afterNames, initial)
+        for i in range(10):
+            self.nameCache.getPrimName(Sdf.Path(f"/parent_{i}"), "child")
+        self.assertGreater(self.nameCache.memoryUsage(), afterNames)
+
+        # Clearing the cache releases the entries
+        self.nameCache.clear(Sdf.Path("/parent"))
+        self.assertLess(self.nameCache.memoryUsage(), afterNames)
+
+    def testMaxEntries(self):
+        self.assertEqual(self.nameCache.getMaxEntries(), 0)
+
+        # Without a limit all parents remain cached
+        for i in range(1000):
+            self.nameCache.getPrimNames(Sdf.Path(f"/parent_{i}"), ["child"] * 10)
+        unbounded = self.nameCache.memoryUsage()
+        self.assertEqual(self.nameCache.getPrimName(Sdf.Path("/parent_0"), "child"), "child_10")
+
+        # Setting a limit evicts the least recently used parents
+        self.nameCache.setMaxEntries(64)
+        self.assertEqual(self.nameCache.getMaxEntries(), 64)
+        self.assertLess(self.nameCache.memoryUsage(), unbounded)
+        bounded = self.nameCache.memoryUsage()
+        for i in range(1000, 2000):
+            self.nameCache.getPrimNames(Sdf.Path(f"/parent_{i}"), ["child"] * 10)
+        self.assertLess(self.nameCache.memoryUsage(), bounded * 2)
+
+        # The most recently used parent remains cached
+        self.assertEqual(self.nameCache.getPrimName(Sdf.Path("/parent_1999"), "child"), "child_10")
+
+        # An evicted prim parent reserves its existing children again when it is next used
+        parent = self.stage.DefinePrim("/evicted")
+        self.stage.DefinePrim("/evicted/child")
+        self.assertEqual(self.nameCache.getPrimName(parent, "child"), "child_1")
+        for i in range(2000, 3000):
+            self.nameCache.getPrimName(Sdf.Path(f"/parent_{i}"), "child")
+        self.assertEqual(self.nameCache.getPrimName(parent, "child"), "child_1")
+
+        # Removing the limit stops further evictions
+        self.nameCache.setMaxEntries(0)
+        self.assertEqual(self.nameCache.getPrimName(parent, "child"), "child_2")
+        for i in range(3000, 4000):
+            self.nameCache.getPrimName(Sdf.Path(f"/parent_{i}"), "child")
+        self.assertEqual(self.nameCache.getPrimName(parent, "child"), "child_3")
+
 
 class DisplayNameTestCase(usdex.test.TestCase):
 
@@ -1128,3 +1318,40 @@ class DisplayNameTestCase(usdex.test.TestCase):
         self.assertEqual(result, rocket_emoji)
 
         self.assertIsValidUsd(stage)
+
+    def testDisplayNames(self):
+        stage = Usd.Stage.CreateInMemory()
+        prims = [stage.DefinePrim(f"/Root/prim_{i}") for i in range(2000)]
+        names = [f"Prim {i} 🚀" for i in range(len(prims))]
+
+        # All display names can be set at once using the stage
+        self.assertTrue(usdex.core.setDisplayNames(prims, names))
+        self.assertEqual(usdex.core.getDisplayNames(prims), names)
+        self.assertEqual(usdex.core.computeEffectiveDisplayNames(prims), names)
+        self.assertEqual(usdex.core.getDisplayName(prims[7]), names[7])
+
+        # Blocked display names compute to the prim name
+        self.assertTrue(usdex.core.setDisplayNames(prims[:2], ["", ""]))
+        self.assertEqual(usdex.core.getDisplayNames(prims[:3]), ["", "", names[2]])
+        self.assertEqual(usdex.core.computeEffectiveDisplayNames(prims[:3]), ["prim_0", "prim_1", names[2]])
+
+        # The display names can be authored directly on the prim specs of the edit target
+        strongerLayer = Sdf.Layer.CreateAnonymous()
+        stage.GetSessionLayer().subLayerPaths.append(strongerLayer.identifier)
+        stage.SetEditTarget(Usd.EditTarget(strongerLayer))
+        self.assertTrue(usdex.core.setDisplayNames(prims[:3], ["a", "b", "c"], authorPrimSpecs=True))
+        self.assertEqual(usdex.core.getDisplayNames(prims[:4]), ["a", "b", "c", names[3]])
+        self.assertEqual(strongerLayer.GetPrimAtPath("/Root/prim_0").GetInfo("displayName"), "a")
+        self.assertEqual(strongerLayer.GetPrimAtPath("/Root/prim_0").specifier, Sdf.SpecifierOver)
+        self.assertEqual(stage.GetRootLayer().GetPrimAtPath("/Root/prim_0").GetInfo("displayName"), "")
+
+        # Mismatched lengths author nothing
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to set display names")]):
+            self.assertFalse(usdex.core.setDisplayNames(prims[:2], ["x"]))
+        self.assertEqual(usdex.core.getDisplayNames(prims[:2]), ["a", "b"])
+
+        # Invalid prims are reported but do not prevent the valid prims from being authored
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to set display name .* invalid prim")]):
+            self.assertFalse(usdex.core.setDisplayNames([prims[0], Usd.Prim()], ["x", "y"]))
+        self.assertEqual(usdex.core.getDisplayNames([prims[0], Usd.Prim()]), ["x", ""])
+        self.assertEqual(usdex.core.computeEffectiveDisplayNames([Usd.Prim()]), [""])
@@ -7,7 +7,7 @@ from typing import List, Tuple
 import omni.asset_validator
 import usdex.core
 import usdex.test
-from pxr import Gf, Usd, UsdGeom, UsdPhysics
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdPhysics
 
 
 class PhysicsJointAlgoTest(usdex.test.TestCase):
@@ -1578,3 +1578,241 @@ class PhysicsJointAlgoTest_SphericalJoint(PhysicsJointAlgoTest, usdex.test.Defin
         localPos1 = Gf.Vec3f(0.000044151413, 0.0030490516, -5.500812)
         localRot1 = Gf.Quatf(1.0, Gf.Vec3f(0.000029394923, -0.000015000849, -0.0000019334022))
         self.assertIsPhysicsJoint(joint, localPos0, localRot0, localPos1, localRot1, UsdGeom.Tokens.z, None, None, coneAngle0Limit, coneAngle1Limit)
+
+
+class PhysicsJointAlgoTest_DefineJoints(PhysicsJointAlgoTest):
+
+    # Create a chain of bodies within a nested hierarchy, as found in articulations such as robots and cables.
+    def createChain(self, stage: Usd.Stage, count: int) -> List[Usd.Prim]:
+        bodies = []
+        parentPath = stage.GetDefaultPrim().GetPath()
+        for i in range(count):
+            parentPath = parentPath.AppendChild(f"link{i}")
+            self.createXform(stage, parentPath, Gf.Vec3d(2.0, 0.5, 0.0), Gf.Vec3f(0.0, 10.0 * i, 5.0), Gf.Vec3f(1.0, 1.0, 1.0))
+            body = self.createCube(stage, parentPath.AppendChild("body"), 1.0, Gf.Vec3f(1.0), Gf.Vec3d(0.5, 0, 0), Gf.Vec3f(0), Gf.Vec3f(1, 0.5, 0.5))
+            UsdPhysics.RigidBodyAPI.Apply(body)
+            bodies.append(body)
+        return bodies
+
+    def createStage(self) -> Usd.Stage:
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        return stage
+
+    def assertJointsMatch(self, joint: UsdPhysics.Joint, expectedJoint: UsdPhysics.Joint):
+        expectedPrim = expectedJoint.GetPrim()
+        self.assertEqual(sorted(joint.GetPrim().GetAuthoredPropertyNames()), sorted(expectedPrim.GetAuthoredPropertyNames()))
+        for attr in expectedPrim.GetAuthoredAttributes():
+            value = joint.GetPrim().GetAttribute(attr.GetName()).Get()
+            if isinstance(value, Gf.Quatf):
+                self.assertTrue(Gf.IsClose(value.GetImaginary(), attr.Get().GetImaginary(), 1e-6))
+                self.assertAlmostEqual(value.GetReal(), attr.Get().GetReal(), places=6)
+            elif isinstance(value, Gf.Vec3f):
+                self.assertTrue(Gf.IsClose(value, attr.Get(), 1e-5))
+            else:
+                self.assertEqual(value, attr.Get())
+
+    def testDefinePhysicsJoints(self):
+        types = [
+            usdex.core.PhysicsJointDescription.Type.Fixed,
+            usdex.core.PhysicsJointDescription.Type.Revolute,
+            usdex.core.PhysicsJointDescription.Type.Prismatic,
+            usdex.core.PhysicsJointDescription.Type.Spherical,
+        ]
+        spaces = [usdex.core.JointFrame.Space.Body0, usdex.core.JointFrame.Space.Body1, usdex.core.JointFrame.Space.World]
+        axes = [Gf.Vec3f(1, 0, 0), Gf.Vec3f(0, -1, 0), Gf.Vec3f(0, 0, 1), Gf.Vec3f(1, 1, 0)]
+
+        batchStage = self.createStage()
+        batchBodies = self.createChain(batchStage, 12)
+        singleStage = self.createStage()
+        singleBodies = self.createChain(singleStage, 12)
+        jointsPath = Sdf.Path(f"/{self.defaultPrimName}/joints")
+
+        descriptions = []
+        expected = []
+        for i in range(len(batchBodies) - 1):
+            jointType = types[i % len(types)]
+            frame = usdex.core.JointFrame(spaces[i % len(spaces)], Gf.Vec3d(0.5, 0.1 * i, 0), Gf.Quatd(1, 0, 0, 0))
+            axis = axes[i % len(axes)]
+            path = jointsPath.AppendChild(f"joint{i}")
+            description = usdex.core.PhysicsJointDescription(jointType, path, batchBodies[i], batchBodies[i + 1], frame, axis)
+            if jointType in (usdex.core.PhysicsJointDescription.Type.Revolute, usdex.core.PhysicsJointDescription.Type.Prismatic):
+                description.lowerLimit = -10.0 * i
+                description.upperLimit = 10.0 * i
+            elif jointType == usdex.core.PhysicsJointDescription.Type.Spherical:
+                description.coneAngle0Limit = 20.0
+                description.coneAngle1Limit = 30.0
+            descriptions.append(description)
+
+            # the equivalent joint defined individually
+            body0 = singleBodies[i]
+            body1 = singleBodies[i + 1]
+            if jointType == usdex.core.PhysicsJointDescription.Type.Fixed:
+                expected.append(usdex.core.definePhysicsFixedJoint(singleStage, path, body0, body1, frame))
+            elif jointType == usdex.core.PhysicsJointDescription.Type.Revolute:
+                expected.append(usdex.core.definePhysicsRevoluteJoint(singleStage, path, body0, body1, frame, axis, -10.0 * i, 10.0 * i))
+            elif jointType == usdex.core.PhysicsJointDescription.Type.Prismatic:
+                expected.append(usdex.core.definePhysicsPrismaticJoint(singleStage, path, body0, body1, frame, axis, -10.0 * i, 10.0 * i))
+            else:
+                expected.append(usdex.core.definePhysicsSphericalJoint(singleStage, path, body0, body1, frame, axis, 20.0, 30.0))
+
+        joints = usdex.core.definePhysicsJoints(batchStage, descriptions)
+        self.assertEqual(len(joints), len(descriptions))
+        for joint, description, expectedJoint in zip(joints, descriptions, expected):
+            self.assertTrue(joint)
+            self.assertEqual(joint.GetPath(), description.path)
+            self.assertEqual(joint.GetPrim().GetTypeName(), expectedJoint.GetPrim().GetTypeName())
+            self.assertEqual(joint.GetBody0Rel().GetTargets(), [description.body0.GetPath()])
+            self.assertEqual(joint.GetBody1Rel().GetTargets(), [description.body1.GetPath()])
+
+            # the authored properties match the individually defined joint
+            self.assertJointsMatch(joint, expectedJoint)
+
+    def testDefinePhysicsJointsFailures(self):
+        stage = self.createStage()
+        bodies = self.createChain(stage, 3)
+        jointsPath = Sdf.Path(f"/{self.defaultPrimName}/joints")
+        frame = usdex.core.JointFrame(usdex.core.JointFrame.Space.World, Gf.Vec3d(0), Gf.Quatd(1, 0, 0, 0))
+        jointType = usdex.core.PhysicsJointDescription.Type
+
+        descriptions = [
+            usdex.core.PhysicsJointDescription(jointType.Fixed, jointsPath.AppendChild("valid"), bodies[0], bodies[1], frame),
+            # neither body is specified
+            usdex.core.PhysicsJointDescription(jointType.Revolute, jointsPath.AppendChild("noBodies"), Usd.Prim(), Usd.Prim(), frame),
+            # the path is not valid
+            usdex.core.PhysicsJointDescription(jointType.Prismatic, Sdf.Path("relative"), bodies[1], bodies[2], frame),
+            # the frame is relative to a missing body
+            usdex.core.PhysicsJointDescription(
+                jointType.Spherical,
+                jointsPath.AppendChild("missingBody"),
+                Usd.Prim(),
+                bodies[2],
+                usdex.core.JointFrame(usdex.core.JointFrame.Space.Body0, Gf.Vec3d(0), Gf.Quatd(1, 0, 0, 0)),
+            ),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*PhysicsRevoluteJoint.*Body0 or Body1 are not specified"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*PhysicsPrismaticJoint.*invalid location"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*PhysicsSphericalJoint.*Body0 does not exist"),
+            ],
+        ):
+            joints = usdex.core.definePhysicsJoints(stage, descriptions)
+
+        self.assertEqual(len(joints), 4)
+        self.assertTrue(joints[0])
+        self.assertTrue(joints[0].GetPrim().IsA(UsdPhysics.FixedJoint))
+        self.assertFalse(joints[1])
+        self.assertFalse(joints[2])
+        self.assertFalse(joints[3])
+        self.assertFalse(stage.GetPrimAtPath(jointsPath.AppendChild("noBodies")))
+        self.assertFalse(stage.GetPrimAtPath(jointsPath.AppendChild("missingBody")))
+
+        self.assertEqual(usdex.core.definePhysicsJoints(stage, []), [])
+
+    def testSharedTransformCache(self):
+        cachedStage = self.createStage()
+        cachedBodies = self.createChain(cachedStage, 4)
+        uncachedStage = self.createStage()
+        uncachedBodies = self.createChain(uncachedStage, 4)
+        jointsPath = Sdf.Path(f"/{self.defaultPrimName}/joints")
+        frame = usdex.core.JointFrame(usdex.core.JointFrame.Space.Body0, Gf.Vec3d(0.5, 0, 0), Gf.Quatd(1, 0, 0, 0))
+        axis = Gf.Vec3f(0, 1, 0)
+
+        # a single cache can be shared by all of the joints of the articulation
+        cache = usdex.core.WorldTransformCache(cachedStage)
+        cachedJoints = [
+            usdex.core.definePhysicsFixedJoint(cachedStage, jointsPath.AppendChild("fixed"), cachedBodies[0], cachedBodies[1], frame, cache),
+            usdex.core.definePhysicsRevoluteJoint(
+                cachedStage, jointsPath.AppendChild("revolute"), cachedBodies[1], cachedBodies[2], frame, axis, -45, 45, cache
+            ),
+            usdex.core.definePhysicsSphericalJoint(
+                cachedStage.GetPrimAtPath(jointsPath), "spherical", cachedBodies[2], cachedBodies[3], frame, axis, 20, 30, xformCache=cache
+            ),
+        ]
+        uncachedJoints = [
+            usdex.core.definePhysicsFixedJoint(uncachedStage, jointsPath.AppendChild("fixed"), uncachedBodies[0], uncachedBodies[1], frame),
+            usdex.core.definePhysicsRevoluteJoint(
+                uncachedStage, jointsPath.AppendChild("revolute"), uncachedBodies[1], uncachedBodies[2], frame, axis, -45, 45
+            ),
+            usdex.core.definePhysicsSphericalJoint(
+                uncachedStage.GetPrimAtPath(jointsPath), "spherical", uncachedBodies[2], uncachedBodies[3], frame, axis, 20, 30
+            ),
+        ]
+        for joint, expectedJoint in zip(cachedJoints, uncachedJoints):
+            self.assertTrue(joint)
+            self.assertJointsMatch(joint, expectedJoint)
+
+        # realigning through the cache matches realigning without it
+        frame = usdex.core.JointFrame(usdex.core.JointFrame.Space.World, Gf.Vec3d(1, 2, 3), Gf.Quatd(1, 0, 0, 0))
+        usdex.core.alignPhysicsJoint(cachedJoints[0], frame, Gf.Vec3f(1, 0, 0), cache)
+        usdex.core.alignPhysicsJoint(uncachedJoints[0], frame, Gf.Vec3f(1, 0, 0))
+        self.assertJointsMatch(cachedJoints[0], uncachedJoints[0])
+
+    def testAlignPhysicsJoints(self):
+        batchStage = self.createStage()
+        batchBodies = self.createChain(batchStage, 8)
+        singleStage = self.createStage()
+        singleBodies = self.createChain(singleStage, 8)
+        jointsPath = Sdf.Path(f"/{self.defaultPrimName}/joints")
+        spaces = [usdex.core.JointFrame.Space.Body0, usdex.core.JointFrame.Space.Body1, usdex.core.JointFrame.Space.World]
+        identity = usdex.core.JointFrame(usdex.core.JointFrame.Space.Body0, Gf.Vec3d(0), Gf.Quatd(1, 0, 0, 0))
+
+        batchJoints = []
+        singleJoints = []
+        frames = []
+        axes = []
+        for i in range(len(batchBodies) - 1):
+            path = jointsPath.AppendChild(f"joint{i}")
+            batchJoints.append(usdex.core.definePhysicsFixedJoint(batchStage, path, batchBodies[i], batchBodies[i + 1], identity))
+            singleJoints.append(usdex.core.definePhysicsFixedJoint(singleStage, path, singleBodies[i], singleBodies[i + 1], identity))
+            frames.append(usdex.core.JointFrame(spaces[i % len(spaces)], Gf.Vec3d(0.5, 0.1 * i, 0), Gf.Quatd(1, 0, 0, 0)))
+            axes.append(Gf.Vec3f(0, 0, 1) if i % 2 else Gf.Vec3f(1, 1, 0))
+
+        self.assertTrue(usdex.core.alignPhysicsJoints(batchJoints, frames, axes))
+        for joint, frame, axis in zip(singleJoints, frames, axes):
+            usdex.core.alignPhysicsJoint(joint, frame, axis)
+        for joint, expectedJoint in zip(batchJoints, singleJoints):
+            self.assertJointsMatch(joint, expectedJoint)
+
+        # a shared cache produces the same result
+        cache = usdex.core.WorldTransformCache(batchStage)
+        self.assertTrue(usdex.core.alignPhysicsJoints(batchJoints, frames, axes, cache))
+        for joint, expectedJoint in zip(batchJoints, singleJoints):
+            self.assertJointsMatch(joint, expectedJoint)
+
+        self.assertTrue(usdex.core.alignPhysicsJoints([], [], []))
+
+    def testAlignPhysicsJointsFailures(self):
+        stage = self.createStage()
+        bodies = self.createChain(stage, 3)
+        jointsPath = Sdf.Path(f"/{self.defaultPrimName}/joints")
+        frame = usdex.core.JointFrame(usdex.core.JointFrame.Space.World, Gf.Vec3d(1, 0, 0), Gf.Quatd(1, 0, 0, 0))
+        joint = usdex.core.definePhysicsFixedJoint(stage, jointsPath.AppendChild("valid"), bodies[0], bodies[1], frame)
+        otherStage = self.createStage()
+        otherBodies = self.createChain(otherStage, 2)
+        otherJoint = usdex.core.definePhysicsFixedJoint(otherStage, jointsPath.AppendChild("other"), otherBodies[0], otherBodies[1], frame)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Expected 1 frames and axes but found 2 and 1")]):
+            self.assertFalse(usdex.core.alignPhysicsJoints([joint], [frame, frame], [Gf.Vec3f(1, 0, 0)]))
+
+        # invalid joints are skipped while the valid joints are still aligned
+        newFrame = usdex.core.JointFrame(usdex.core.JointFrame.Space.World, Gf.Vec3d(0, 2, 0), Gf.Quatd(1, 0, 0, 0))
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*not valid or belongs to a different stage"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*not valid or belongs to a different stage"),
+            ],
+        ):
+            self.assertFalse(
+                usdex.core.alignPhysicsJoints(
+                    [joint, UsdPhysics.Joint(), otherJoint],
+                    [newFrame] * 3,
+                    [Gf.Vec3f(1, 0, 0)] * 3,
+                )
+            )
+
+        expected = usdex.core.definePhysicsFixedJoint(stage, jointsPath.AppendChild("expected"), bodies[0], bodies[1], newFrame)
+        self.assertJointsMatch(joint, expected)
@@ -6,7 +6,7 @@ from typing import List, Tuple
 
 import usdex.core
 import usdex.test
-from pxr import Gf, Usd, UsdGeom, UsdPhysics, UsdShade
+from pxr import Gf, Tf, Usd, UsdGeom, UsdPhysics, UsdShade
 
 
 class PhysicsMaterialAlgoTest(usdex.test.DefineFunctionTestCase):
@@ -286,3 +286,113 @@ class PhysicsMaterialAlgoTest(usdex.test.DefineFunctionTestCase):
         self.assertEqual(pathList[0], visual_physics_material.GetPrim().GetPath())
 
         self.assertIsValidUsd(stage)
+
+    # Test the deduplication of physics materials.
+    def testPhysicsMaterialRegistry(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        scope = usdex.core.defineScope(stage.GetDefaultPrim(), "PhysicsMaterials")
+
+        registry = usdex.core.PhysicsMaterialRegistry(scope.GetPrim(), 1e-3)
+        self.assertAlmostEqual(registry.getTolerance(), 1e-3)
+
+        rubber = registry.definePhysicsMaterial("rubber", 0.8, 0.9, 0.5, 1.2)
+        self.assertTrue(rubber)
+        self.assertEqual(rubber.GetPath(), scope.GetPath().AppendChild("rubber"))
+        self.assertIsPhysicsMaterial(rubber, 0.8, 0.9, 0.5, 1.2)
+
+        # properties within the tolerance share the first material, regardless of the name
+        self.assertEqual(registry.definePhysicsMaterial("rubber_2", 0.8001, 0.9, 0.4999, 1.2), rubber)
+        self.assertIsPhysicsMaterial(rubber, 0.8, 0.9, 0.5, 1.2)
+
+        # properties outside of the tolerance define a new material
+        steel = registry.definePhysicsMaterial("steel", 0.4, 0.6, 0.5, 7.8)
+        self.assertTrue(steel)
+        self.assertNotEqual(steel, rubber)
+
+        # an unspecified property is not equivalent to a specified one
+        unspecified = registry.definePhysicsMaterial("rubber", 0.8, 0.9, 0.5)
+        self.assertTrue(unspecified)
+        self.assertNotEqual(unspecified, rubber)
+        self.assertEqual(unspecified.GetPath(), scope.GetPath().AppendChild("rubber_1"))
+        self.assertFalse(UsdPhysics.MaterialAPI(unspecified.GetPrim()).GetDensityAttr().HasAuthoredValue())
+        self.assertEqual(registry.definePhysicsMaterial("other", 0.8, 0.9, 0.5), unspecified)
+
+        # invalid names are made valid
+        ice = registry.definePhysicsMaterial("ice (slippery)", 0.02)
+        self.assertTrue(ice)
+        self.assertTrue(Tf.IsValidIdentifier(ice.GetPrim().GetName()))
+
+        self.assertEqual(registry.getUniqueMaterialCount(), 4)
+        self.assertEqual(registry.getUseCount(), 6)
+        self.assertEqual(len(scope.GetPrim().GetChildren()), 4)
+        self.assertIsValidUsd(stage)
+
+        # a zero tolerance only shares exactly equal properties
+        exact = usdex.core.PhysicsMaterialRegistry(scope.GetPrim(), 0)
+        self.assertEqual(exact.getTolerance(), 0)
+        first = exact.definePhysicsMaterial("exact", 0.5)
+        self.assertEqual(exact.definePhysicsMaterial("exact", 0.5), first)
+        self.assertNotEqual(exact.definePhysicsMaterial("exact", 0.5001), first)
+        self.assertEqual(exact.getUniqueMaterialCount(), 2)
+
+        # an invalid parent can not define any materials
+        invalid = usdex.core.PhysicsMaterialRegistry(Usd.Prim())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid parent prim")]):
+            self.assertFalse(invalid.definePhysicsMaterial("material", 0.5))
+        self.assertEqual(invalid.getUniqueMaterialCount(), 0)
+        self.assertEqual(invalid.getUseCount(), 0)
+
+    # Test the physics material bind of many prims.
+    def testPhysicsMaterialBindMany(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        defaultPrim = stage.GetDefaultPrim()
+
+        rubber = usdex.core.definePhysicsMaterial(defaultPrim, "rubber", 0.8)
+        steel = usdex.core.definePhysicsMaterial(defaultPrim, "steel", 0.4)
+        spheres = [self.createSphere(stage, f"{defaultPrim.GetPath()}/sphere{i}", 0.5, Gf.Vec3f(1, 0, 0), Gf.Vec3d(i, 0, 0)) for i in range(6)]
+        materials = [rubber if i % 2 else steel for i in range(len(spheres))]
+
+        # the visual binding is retained
+        visual = usdex.core.definePreviewMaterial(defaultPrim, "visual", Gf.Vec3f(0, 1, 0))
+        self.assertTrue(usdex.core.bindMaterial(spheres[0], visual))
+
+        self.assertTrue(usdex.core.bindPhysicsMaterials(spheres, materials))
+        self.assertIsValidUsd(stage)
+        for sphere, material in zip(spheres, materials):
+            self.assertTrue(sphere.HasAPI(UsdShade.MaterialBindingAPI))
+            self.assertEqual(UsdShade.MaterialBindingAPI(sphere).GetDirectBindingRel("physics").GetTargets(), [material.GetPath()])
+        self.assertEqual(UsdShade.MaterialBindingAPI(spheres[0]).GetDirectBindingRel().GetTargets(), [visual.GetPath()])
+
+        # the bindings match those of bindPhysicsMaterial
+        expected = self.createSphere(stage, f"{defaultPrim.GetPath()}/expected", 0.5, Gf.Vec3f(1, 0, 0), Gf.Vec3d(0, 0, 0))
+        self.assertTrue(usdex.core.bindPhysicsMaterial(expected, rubber))
+        self.assertEqual(
+            sorted(spheres[1].GetPrim().GetAuthoredPropertyNames()),
+            sorted(expected.GetPrim().GetAuthoredPropertyNames()),
+        )
+        self.assertEqual(spheres[1].GetAppliedSchemas(), expected.GetAppliedSchemas())
+
+        # rebinding replaces the previous binding, and the last binding of a prim wins
+        self.assertTrue(usdex.core.bindPhysicsMaterials([spheres[0], spheres[0]], [rubber, steel]))
+        self.assertEqual(UsdShade.MaterialBindingAPI(spheres[0]).GetDirectBindingRel("physics").GetTargets(), [steel.GetPath()])
+        self.assertTrue(usdex.core.bindPhysicsMaterials([spheres[0]], [rubber]))
+        self.assertEqual(UsdShade.MaterialBindingAPI(spheres[0]).GetDirectBindingRel("physics").GetTargets(), [rubber.GetPath()])
+
+        # invalid prims and materials are skipped, while all other prims are still bound
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid prim or material"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid prim or material"),
+            ],
+        ):
+            self.assertFalse(usdex.core.bindPhysicsMaterials([Usd.Prim(), spheres[2], spheres[3]], [rubber, UsdShade.Material(), rubber]))
+        self.assertEqual(UsdShade.MaterialBindingAPI(spheres[2]).GetDirectBindingRel("physics").GetTargets(), [steel.GetPath()])
+        self.assertEqual(UsdShade.MaterialBindingAPI(spheres[3]).GetDirectBindingRel("physics").GetTargets(), [rubber.GetPath()])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*2 prims and 1 materials")]):
+            self.assertFalse(usdex.core.bindPhysicsMaterials(spheres[:2], [rubber]))
+
+        self.assertTrue(usdex.core.bindPhysicsMaterials([], []))
@@ -518,3 +518,301 @@ class PointsAlgoPrimOverloadTest(usdex.test.TestCase):
             points = usdex.core.definePointCloud(xformPrim, POINTS)
         self.assertTrue(points)
         self.assertEqual(points.GetPrim().GetTypeName(), "Points")
+
+
+class TiledPointCloudTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        return stage
+
+    def assertTile(self, tile, points):
+        self.assertTrue(tile)
+        self.assertEqual(tile.GetPointsAttr().Get(), Vt.Vec3fArray(points))
+        extent = UsdGeom.Boundable.ComputeExtentFromPlugins(tile, Usd.TimeCode.Default())
+        self.assertEqual(tile.GetExtentAttr().Get(), extent)
+
+    def testTiles(self):
+        stage = self.createTestStage()
+        path = Sdf.Path("/World/Scan")
+        widths = Vt.FloatArray([0.1, 0.2, 0.3, 0.4, 0.5, 0.6])
+
+        xform = usdex.core.defineTiledPointCloud(
+            stage,
+            path,
+            1.5,
+            POINTS,
+            ids=IDS,
+            widths=usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, widths),
+            displayColor=usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)])),
+        )
+        self.assertTrue(xform)
+        self.assertEqual(xform.GetPath(), path)
+        self.assertEqual([x.GetName() for x in xform.GetPrim().GetChildren()], ["Tile_0_0_0", "Tile_1_0_0"])
+
+        # Points, ids and primvars are partitioned consistently
+        tile = UsdGeom.Points(stage.GetPrimAtPath(path.AppendChild("Tile_0_0_0")))
+        self.assertTile(tile, POINTS[:4])
+        self.assertEqual(tile.GetIdsAttr().Get(), Vt.Int64Array(IDS[:4]))
+        primvar = UsdGeom.PrimvarsAPI(tile).GetPrimvar(UsdGeom.Tokens.widths)
+        self.assertEqual(primvar.GetInterpolation(), UsdGeom.Tokens.vertex)
+        self.assertEqual(primvar.Get(), Vt.FloatArray(widths[:4]))
+
+        tile = UsdGeom.Points(stage.GetPrimAtPath(path.AppendChild("Tile_1_0_0")))
+        self.assertTile(tile, POINTS[4:])
+        self.assertEqual(tile.GetIdsAttr().Get(), Vt.Int64Array(IDS[4:]))
+        primvar = UsdGeom.PrimvarsAPI(tile).GetPrimvar(UsdGeom.Tokens.widths)
+        self.assertEqual(primvar.Get(), Vt.FloatArray(widths[4:]))
+
+        # Constant primvars remain constant
+        primvar = tile.GetDisplayColorPrimvar()
+        self.assertEqual(primvar.GetInterpolation(), UsdGeom.Tokens.constant)
+        self.assertEqual(primvar.Get(), Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]))
+
+        # Negative coordinates are prefixed
+        xform = usdex.core.defineTiledPointCloud(stage, Sdf.Path("/World/Negative"), 1.0, Vt.Vec3fArray([Gf.Vec3f(-0.5, 0.5, -2.5)]))
+        self.assertEqual([x.GetName() for x in xform.GetPrim().GetChildren()], ["Tile_n1_0_n3"])
+
+    def testStreaming(self):
+        stage = self.createTestStage()
+        path = Sdf.Path("/World/Scan")
+
+        writer = usdex.core.TiledPointCloudWriter(stage, path, 1.5, maxPointsPerTile=3)
+        self.assertTrue(writer.isValid())
+        self.assertTrue(writer.getXform())
+
+        # The first tile is authored as soon as it is full
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0]))
+        self.assertTrue(writer.addPoints(Vt.Vec3fArray(POINTS[:3]), widths=widths))
+        self.assertTrue(stage.GetPrimAtPath(path.AppendChild("Tile_0_0_0")))
+
+        # Additional points for a full tile are authored on another prim
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([2.0]))
+        self.assertTrue(writer.addPoints(Vt.Vec3fArray(POINTS[3:]), widths=widths))
+        self.assertFalse(stage.GetPrimAtPath(path.AppendChild("Tile_0_0_0_1")))
+        tiles = writer.finish()
+        self.assertFalse(writer.isValid())
+        self.assertEqual([x.GetPath().name for x in tiles], ["Tile_0_0_0", "Tile_0_0_0_1", "Tile_1_0_0"])
+        self.assertTile(tiles[0], POINTS[:3])
+        self.assertTile(tiles[1], POINTS[3:4])
+        self.assertTile(tiles[2], POINTS[4:])
+
+        # Differing constant values for a single tile are expanded to vertex values
+        writer = usdex.core.TiledPointCloudWriter(stage, Sdf.Path("/World/Expanded"), 1.5)
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0]))
+        self.assertTrue(writer.addPoints(Vt.Vec3fArray(POINTS[:3]), widths=widths))
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([2.0]))
+        self.assertTrue(writer.addPoints(Vt.Vec3fArray(POINTS[3:]), widths=widths))
+        tiles = writer.finish()
+        primvar = UsdGeom.PrimvarsAPI(tiles[0]).GetPrimvar(UsdGeom.Tokens.widths)
+        self.assertEqual(primvar.GetInterpolation(), UsdGeom.Tokens.vertex)
+        self.assertEqual(primvar.Get(), Vt.FloatArray([1.0, 1.0, 1.0, 2.0]))
+        primvar = UsdGeom.PrimvarsAPI(tiles[1]).GetPrimvar(UsdGeom.Tokens.widths)
+        self.assertEqual(primvar.GetInterpolation(), UsdGeom.Tokens.constant)
+        self.assertEqual(primvar.Get(), Vt.FloatArray([2.0]))
+
+    def testInvalid(self):
+        stage = self.createTestStage()
+
+        # The tile size must be positive
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid tile size")]):
+            writer = usdex.core.TiledPointCloudWriter(stage, Sdf.Path("/World/Zero"), 0.0)
+        self.assertFalse(writer.isValid())
+        self.assertFalse(stage.GetPrimAtPath("/World/Zero"))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid or finished TiledPointCloudWriter")]):
+            self.assertFalse(writer.addPoints(POINTS))
+
+        # Invalid data does not define any prims
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0, 2.0]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid widths")]):
+            xform = usdex.core.defineTiledPointCloud(stage, Sdf.Path("/World/Invalid"), 1.0, POINTS, widths=widths)
+        self.assertFalse(xform)
+        self.assertFalse(stage.GetPrimAtPath("/World/Invalid"))
+
+        # The ids and primvars must be consistent across chunks
+        writer = usdex.core.TiledPointCloudWriter(stage, Sdf.Path("/World/Inconsistent"), 1.0)
+        self.assertTrue(writer.addPoints(POINTS, ids=IDS))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*differ from previous chunks")]):
+            self.assertFalse(writer.addPoints(POINTS))
+        self.assertEqual(len(writer.finish()), 6)
+
+
+class DefinePointInstancerTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+        UsdGeom.SetStageMetersPerUnit(stage, UsdGeom.LinearUnits.centimeters)
+        return stage
+
+    def definePrototypes(self, stage: Usd.Stage, path: Sdf.Path):
+        cube = UsdGeom.Cube.Define(stage, path.AppendChild("Cube"))
+        cube.CreateExtentAttr(Vt.Vec3fArray([Gf.Vec3f(-1), Gf.Vec3f(1)]))
+        sphere = UsdGeom.Sphere.Define(stage, path.AppendChild("Sphere"))
+        sphere.CreateExtentAttr(Vt.Vec3fArray([Gf.Vec3f(-1), Gf.Vec3f(1)]))
+        # the prototype transform is applied prior to the instance transform
+        sphere.AddTranslateOp().Set(Gf.Vec3d(0, 1, 0))
+        return [cube.GetPrim(), sphere.GetPrim()]
+
+    def assertExtentsClose(self, actual, expected):
+        self.assertEqual(len(actual), 2)
+        for i in range(2):
+            self.assertTrue(Gf.IsClose(actual[i], expected[i], 1e-4), f"{actual[i]} != {expected[i]}")
+
+    def testDefinePointInstancer(self):
+        stage = self.createTestStage()
+        path = Sdf.Path("/World/Instancer")
+        prototypes = self.definePrototypes(stage, path.AppendChild("Prototypes"))
+        protoIndices = Vt.IntArray([0, 1, 0, 1])
+        positions = Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(10, 0, 0), Gf.Vec3f(0, 0, -5), Gf.Vec3f(-3, 2, 1)])
+        orientations = Vt.QuathArray(
+            [
+                Gf.Quath(1),
+                Gf.Quath(Gf.Rotation(Gf.Vec3d.ZAxis(), 90).GetQuat()),
+                Gf.Quath(Gf.Rotation(Gf.Vec3d.XAxis(), 45).GetQuat()),
+                Gf.Quath(1),
+            ]
+        )
+        scales = Vt.Vec3fArray([Gf.Vec3f(1), Gf.Vec3f(2, 1, 1), Gf.Vec3f(1), Gf.Vec3f(0.5)])
+        ids = Vt.Int64Array([10, 11, 12, 13])
+        invisibleIds = Vt.Int64Array([12])
+
+        instancer = usdex.core.definePointInstancer(
+            stage,
+            path,
+            prototypes,
+            protoIndices,
+            positions,
+            orientations=orientations,
+            scales=scales,
+            ids=ids,
+            invisibleIds=invisibleIds,
+        )
+        self.assertTrue(instancer)
+        self.assertEqual(instancer.GetPrim().GetTypeName(), "PointInstancer")
+        self.assertEqual(instancer.GetPrototypesRel().GetTargets(), [x.GetPath() for x in prototypes])
+        self.assertEqual(instancer.GetProtoIndicesAttr().Get(), protoIndices)
+        self.assertEqual(instancer.GetPositionsAttr().Get(), positions)
+        self.assertEqual(instancer.GetOrientationsAttr().Get(), orientations)
+        self.assertEqual(instancer.GetScalesAttr().Get(), scales)
+        self.assertEqual(instancer.GetIdsAttr().Get(), ids)
+        self.assertEqual(instancer.GetInvisibleIdsAttr().Get(), invisibleIds)
+
+        # the extent matches the schema computation
+        expected = instancer.ComputeExtentAtTime(Usd.TimeCode.Default(), Usd.TimeCode.Default())
+        self.assertExtentsClose(instancer.GetExtentAttr().Get(), expected)
+        self.assertIsValidUsd(stage)
+
+    def testOptionalAttributesAreBlocked(self):
+        stage = self.createTestStage()
+        parent = usdex.core.defineXform(stage, "/World").GetPrim()
+        prototypes = self.definePrototypes(stage, Sdf.Path("/World/Instancer/Prototypes"))
+        positions = Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(5, 0, 0)])
+
+        instancer = usdex.core.definePointInstancer(parent, "Instancer", prototypes, Vt.IntArray([1, 1]), positions)
+        self.assertTrue(instancer)
+        for attr in (instancer.GetOrientationsAttr(), instancer.GetScalesAttr(), instancer.GetIdsAttr(), instancer.GetInvisibleIdsAttr()):
+            self.assertTrue(attr.HasAuthoredValueOpinion(), attr.GetName())
+            self.assertIsNone(attr.Get(), attr.GetName())
+
+        # the sphere is raised by its own transform
+        self.assertExtentsClose(instancer.GetExtentAttr().Get(), [Gf.Vec3f(-1, 0, -1), Gf.Vec3f(6, 2, 1)])
+
+    def testInvalid(self):
+        stage = self.createTestStage()
+        path = Sdf.Path("/World/Instancer")
+        prototypes = self.definePrototypes(stage, path.AppendChild("Prototypes"))
+        positions = Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(5, 0, 0)])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.core.definePointInstancer(stage, Sdf.Path("Relative"), prototypes, Vt.IntArray([0, 1]), positions))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid prototypes: No prototypes")]):
+            self.assertFalse(usdex.core.definePointInstancer(stage, path, [], Vt.IntArray([0, 1]), positions))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*prototype at index 1 is not a valid prim")]):
+            self.assertFalse(usdex.core.definePointInstancer(stage, path, [prototypes[0], Usd.Prim()], Vt.IntArray([0, 1]), positions))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid proto indices: Empty array")]):
+            self.assertFalse(usdex.core.definePointInstancer(stage, path, prototypes, Vt.IntArray(), Vt.Vec3fArray()))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*value 2 at index 1 is out of range")]):
+            self.assertFalse(usdex.core.definePointInstancer(stage, path, prototypes, Vt.IntArray([0, 2]), positions))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid positions: Expected 3 values but found 2")]):
+            self.assertFalse(usdex.core.definePointInstancer(stage, path, prototypes, Vt.IntArray([0, 1, 0]), positions))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid scales: Expected 2 values but found 1")]):
+            self.assertFalse(
+                usdex.core.definePointInstancer(stage, path, prototypes, Vt.IntArray([0, 1]), positions, scales=Vt.Vec3fArray([Gf.Vec3f(1)]))
+            )
+
+        # the prototypes defined an untyped ancestor, but the instancer itself was never defined
+        self.assertEqual(stage.GetPrimAtPath(path).GetTypeName(), "")
+
+    def testConvertToPointInstancer(self):
+        stage = self.createTestStage()
+        prototypes = self.definePrototypes(stage, Sdf.Path("/Library"))
+        world = usdex.core.defineXform(stage, "/World").GetPrim()
+        self.assertTrue(usdex.core.setLocalTransform(world, Gf.Matrix4d().SetTranslate(Gf.Vec3d(0, 0, 100))))
+
+        # duplicate internal references to each of the library prims
+        prims = []
+        expectedTransforms = []
+        for i in range(6):
+            # the prims are typeless, so that they compose the type of the referenced prim
+            prim = stage.DefinePrim(world.GetPath().AppendChild(f"Copy_{i}"))
+            prim.GetReferences().AddInternalReference(prototypes[i % 2].GetPath())
+            transform = Gf.Transform()
+            transform.SetTranslation(Gf.Vec3d(i * 3.0, 0, 0))
+            transform.SetRotation(Gf.Rotation(Gf.Vec3d.YAxis(), 30.0 * i))
+            transform.SetScale(Gf.Vec3d(1.0 + i, 1.0, 1.0))
+            self.assertTrue(usdex.core.setLocalTransform(prim, transform))
+            prims.append(prim)
+            expectedTransforms.append(UsdGeom.Xformable(prim).ComputeLocalToWorldTransform(Usd.TimeCode.Default()))
+
+        instancer = usdex.core.convertToPointInstancer(stage, Sdf.Path("/World/Instancer"), prims)
+        self.assertTrue(instancer)
+
+        # one prototype per unique set of references, named after the first prim of each group
+        targets = instancer.GetPrototypesRel().GetTargets()
+        self.assertEqual(targets, [Sdf.Path("/World/Instancer/Prototypes/Copy_0"), Sdf.Path("/World/Instancer/Prototypes/Copy_1")])
+        self.assertEqual(stage.GetPrimAtPath(targets[0]).GetTypeName(), "Cube")
+        self.assertEqual(stage.GetPrimAtPath(targets[1]).GetTypeName(), "Sphere")
+        self.assertEqual(instancer.GetProtoIndicesAttr().Get(), Vt.IntArray([0, 1, 0, 1, 0, 1]))
+
+        # the world space transforms are preserved
+        instanceTransforms = instancer.ComputeInstanceTransformsAtTime(Usd.TimeCode.Default(), Usd.TimeCode.Default())
+        instancerTransform = instancer.ComputeLocalToWorldTransform(Usd.TimeCode.Default())
+        for i, expected in enumerate(expectedTransforms):
+            # the schema includes the transform of the prototype (e.g. the translate of the library sphere) in each instance transform
+            actual = instanceTransforms[i] * instancerTransform
+            self.assertTrue(Gf.IsClose(actual, expected, 1e-2), f"{i}: {actual} != {expected}")
+
+        # the original prims are deactivated
+        for prim in prims:
+            self.assertFalse(prim.IsActive())
+        self.assertIsValidUsd(stage)
+
+    def testConvertToPointInstancerInvalid(self):
+        stage = self.createTestStage()
+        prototypes = self.definePrototypes(stage, Sdf.Path("/Library"))
+        world = usdex.core.defineXform(stage, "/World").GetPrim()
+        referencing = usdex.core.defineXform(world, "Referencing").GetPrim()
+        referencing.GetReferences().AddInternalReference(prototypes[0].GetPath())
+        plain = usdex.core.defineXform(world, "Plain").GetPrim()
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*No prims were provided")]):
+            self.assertFalse(usdex.core.convertToPointInstancer(stage, Sdf.Path("/World/Instancer"), []))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*has no references")]):
+            self.assertFalse(usdex.core.convertToPointInstancer(stage, Sdf.Path("/World/Instancer"), [referencing, plain]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*is an ancestor of the point instancer")]):
+            self.assertFalse(usdex.core.convertToPointInstancer(stage, Sdf.Path("/World/Referencing/Instancer"), [referencing]))
+
+        # nothing was authored or deactivated
+        self.assertFalse(stage.GetPrimAtPath("/World/Instancer"))
+        self.assertTrue(referencing.IsActive())
@@ -2,6 +2,7 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import array
 from typing import Tuple
 
 import usdex.core
@@ -332,3 +333,80 @@ class PrimvarDataTestCase(usdex.test.TestCase):
         self.assertTrue(data.hasIndices())
         self.assertEqual(data.values(), Vt.FloatArray([0.0, 1.0]))
         self.assertEqual(data.indices(), Vt.IntArray([0, 0, 1, 1, 2, 2]))
+
+
+class BufferProtocolTestCase(usdex.test.TestCase):
+
+    def testReadOnlyBuffer(self):
+        # A read-only, contiguous buffer of the exact scalar type is wrapped without copying
+        values = memoryview(array.array("f", [c for p in POINTS for c in p]).tobytes()).cast("f", [len(POINTS), 3])
+        self.assertTrue(values.readonly)
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, values)
+        self.assertEqual(primvar.values(), POINTS)
+        # The data must remain valid after the python buffer is released
+        del values
+        self.assertEqual(primvar.values(), POINTS)
+
+    def testWritableBuffer(self):
+        # Writable buffers are copied so that later modifications do not affect the primvar
+        values = array.array("i", [0, 1, 2, 3])
+        primvar = usdex.core.IntPrimvarData(UsdGeom.Tokens.vertex, values)
+        values[0] = 10
+        self.assertEqual(primvar.values(), Vt.IntArray([0, 1, 2, 3]))
+
+        indices = array.array("i", [0, 0, 1])
+        primvar = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, array.array("f", [0.5, 1.5]), indices)
+        self.assertEqual(primvar.values(), Vt.FloatArray([0.5, 1.5]))
+        self.assertEqual(primvar.indices(), Vt.IntArray([0, 0, 1]))
+
+    def testConvertedBuffer(self):
+        # Buffers of other scalar types are converted
+        values = memoryview(array.array("d", [0.0, 1.0, 2.0, 3.0]).tobytes()).cast("d", [2, 2])
+        primvar = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, values)
+        self.assertEqual(primvar.values(), Vt.Vec2fArray([Gf.Vec2f(0.0, 1.0), Gf.Vec2f(2.0, 3.0)]))
+
+        primvar = usdex.core.Int64PrimvarData(UsdGeom.Tokens.vertex, array.array("i", [1, 2, 3]))
+        self.assertEqual(primvar.values(), Vt.Int64Array([1, 2, 3]))
+
+        # Strided views are converted
+        values = memoryview(array.array("f", [0.0, 1.0, 2.0, 3.0, 4.0, 5.0]))[::2]
+        primvar = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values)
+        self.assertEqual(primvar.values(), Vt.FloatArray([0.0, 2.0, 4.0]))
+
+    def testInvalidBuffer(self):
+        # The shape of the buffer must match the element type
+        values = array.array("f", [0.0, 1.0, 2.0])
+        with self.assertRaises(TypeError):
+            usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, values)
+
+    def testHalfPrecision(self):
+        stage = Usd.Stage.CreateInMemory()
+        prim = stage.DefinePrim("/Prim")
+        primvarsApi = UsdGeom.PrimvarsAPI(prim)
+        values = Vt.Vec3fArray([Gf.Vec3f(0.1, 0.2, 0.3), Gf.Vec3f(1.0, 2.0, 3.0)])
+        data = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, values)
+
+        # The precision of the primvar type is used, regardless of the active precision
+        self.assertEqual(usdex.core.getPrimvarPrecision(), usdex.core.PrimvarPrecision.eFloat)
+        primvar = primvarsApi.CreatePrimvar("half", Sdf.ValueTypeNames.Normal3hArray)
+        with usdex.core.ScopedPrimvarPrecision(usdex.core.PrimvarPrecision.eFloat) as precision:
+            self.assertTrue(data.setPrimvar(primvar))
+            self.assertEqual(usdex.core.getPrimvarPrecision(), usdex.core.PrimvarPrecision.eFloat)
+        self.assertIsInstance(primvar.Get(), Vt.Vec3hArray)
+        self.assertGreater(precision.getMaxError(), 0.0)
+        self.assertLess(precision.getMaxError(), 0.01)
+
+        # Half values are converted back to single precision
+        result = usdex.core.Vec3fPrimvarData.getPrimvarData(primvar)
+        self.assertIsInstance(result.values(), Vt.Vec3fArray)
+        for actual, expected in zip(result.values(), values):
+            self.assertTrue(Gf.IsClose(actual, expected, precision.getMaxError()))
+
+        # Single precision primvars are not converted
+        primvar = primvarsApi.CreatePrimvar("float", Sdf.ValueTypeNames.Normal3fArray)
+        with usdex.core.ScopedPrimvarPrecision(usdex.core.PrimvarPrecision.eHalf) as precision:
+            self.assertEqual(usdex.core.getPrimvarPrecision(), usdex.core.PrimvarPrecision.eHalf)
+            self.assertTrue(data.setPrimvar(primvar))
+        self.assertEqual(usdex.core.getPrimvarPrecision(), usdex.core.PrimvarPrecision.eFloat)
+        self.assertEqual(primvar.Get(), values)
+        self.assertEqual(precision.getMaxError(), 0.0)
@@ -0,0 +1,93 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import usdex.core
+import usdex.test
+from pxr import Usd, UsdGeom, UsdShade
+
+
+class SceneGeneratorTest(usdex.test.TestCase):
+
+    def createStage(self) -> Usd.Stage:
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        usdex.core.defineXform(stage, f"/{self.defaultPrimName}")
+        return stage
+
+    def testDefaults(self):
+        stage = self.createStage()
+        prims = usdex.test.generateScene(stage.GetDefaultPrim())
+
+        options = usdex.test.SceneGeneratorOptions()
+        self.assertEqual(len(prims), options.meshCount)
+        self.assertTrue(all(prim.IsA(UsdGeom.Mesh) for prim in prims))
+        materials = stage.GetDefaultPrim().GetChild("Materials")
+        self.assertEqual(len(materials.GetChildren()), options.materialCount)
+        self.assertIsValidUsd(stage)
+
+    def testContent(self):
+        stage = self.createStage()
+        options = usdex.test.SceneGeneratorOptions(
+            seed=3,
+            hierarchyDepth=1,
+            hierarchyWidth=3,
+            meshCount=5,
+            verticesPerMesh=16,
+            groomCount=2,
+            curvesPerGroom=10,
+            verticesPerCurve=4,
+            pointCloudCount=3,
+            pointsPerCloud=100,
+            materialCount=2,
+        )
+        prims = usdex.test.generateScene(stage.GetDefaultPrim(), options)
+
+        self.assertEqual(len(prims), 10)
+        self.assertTrue(all(prim.IsA(UsdGeom.Mesh) for prim in prims[:5]))
+        self.assertTrue(all(prim.IsA(UsdGeom.BasisCurves) for prim in prims[5:7]))
+        self.assertTrue(all(prim.IsA(UsdGeom.Points) for prim in prims[7:]))
+
+        # The geometry is distributed across the leaves of the hierarchy
+        geometry = stage.GetDefaultPrim().GetChild("Geometry")
+        self.assertEqual([child.GetName() for child in geometry.GetChildren()], ["Group_0", "Group_1", "Group_2"])
+        for prim in prims:
+            self.assertEqual(prim.GetParent().GetParent(), geometry)
+
+        # The vertex counts follow the options
+        self.assertEqual(len(UsdGeom.Mesh(prims[0]).GetPointsAttr().Get()), 16)
+        self.assertEqual(len(UsdGeom.BasisCurves(prims[5]).GetPointsAttr().Get()), 40)
+        self.assertEqual(len(UsdGeom.Points(prims[7]).GetPointsAttr().Get()), 100)
+
+        # The materials are bound in turn
+        for i, prim in enumerate(prims):
+            material, _ = UsdShade.MaterialBindingAPI(prim).ComputeBoundMaterial()
+            self.assertEqual(material.GetPrim().GetName(), f"Material_{i % 2}")
+
+        self.assertIsValidUsd(stage)
+
+    def testDeterministic(self):
+        options = usdex.test.SceneGeneratorOptions(seed=11, meshCount=4, verticesPerMesh=25, groomCount=1, curvesPerGroom=5, pointCloudCount=1)
+
+        stageA = self.createStage()
+        usdex.test.generateScene(stageA.GetDefaultPrim(), options)
+        stageB = self.createStage()
+        usdex.test.generateScene(stageB.GetDefaultPrim(), options)
+        self.assertEqual(stageA.GetRootLayer().ExportToString(), stageB.GetRootLayer().ExportToString())
+
+        # A different seed produces different values
+        options.seed = 12
+        stageC = self.createStage()
+        usdex.test.generateScene(stageC.GetDefaultPrim(), options)
+        self.assertNotEqual(stageA.GetRootLayer().ExportToString(), stageC.GetRootLayer().ExportToString())
+
+    def testNameCollisions(self):
+        stage = self.createStage()
+        options = usdex.test.SceneGeneratorOptions(hierarchyDepth=0, meshCount=6, verticesPerMesh=4, nameCollisionRate=1.0)
+        prims = usdex.test.generateScene(stage.GetDefaultPrim(), options)
+
+        # Every preferred name collides, so unique names are allocated
+        names = [prim.GetName() for prim in prims]
+        self.assertEqual(names[0], "Mesh")
+        self.assertEqual(len(set(names)), 6)
+        self.assertIsValidUsd(stage)
@@ -2,6 +2,8 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import os
+
 import omni.asset_validator
 import usdex.core
 import usdex.test
@@ -291,6 +293,86 @@ class CreateStageTestCase(usdex.test.TestCase):
         self.assertIsValidUsd(stage)
 
 
+class InMemoryStageTestCase(usdex.test.TestCase):
+
+    def testCreateAndExport(self):
+        identifier = self.tmpFile("test", "usda")
+        stage = usdex.core.createInMemoryStage(
+            identifier,
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+            massUnits=UsdPhysics.MassUnits.grams,
+        )
+        self.assertIsInstance(stage, Usd.Stage)
+
+        # The stage is configured but nothing is written until it is exported
+        rootLayer = stage.GetRootLayer()
+        self.assertTrue(rootLayer.anonymous)
+        self.assertEqual(os.path.getsize(identifier), 0)
+        self.assertEqual(stage.GetDefaultPrim().GetName(), self.defaultPrimName)
+        self.assertEqual(UsdGeom.GetStageUpAxis(stage), self.defaultUpAxis)
+        self.assertEqual(UsdGeom.GetStageMetersPerUnit(stage), self.defaultLinearUnits)
+        self.assertEqual(UsdPhysics.GetStageKilogramsPerUnit(stage), UsdPhysics.MassUnits.grams)
+
+        # Absolute asset paths within the directory of the identifier are made relative
+        directory = os.path.dirname(identifier)
+        prim = stage.DefinePrim(f"/{self.defaultPrimName}/Asset")
+        prim.GetReferences().AddReference(os.path.join(directory, "textures", "ref.usda"))
+        attr = prim.CreateAttribute("texture", Sdf.ValueTypeNames.Asset)
+        attr.Set(Sdf.AssetPath("/elsewhere/texture.png"))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, 'Exporting.*with comment "Exported"')]):
+            self.assertTrue(usdex.core.exportInMemoryStage(stage, authoringMetadata="ignored", comment="Exported"))
+
+        exportedLayer = Sdf.Layer.FindOrOpen(identifier)
+        self.assertUsdLayerEncoding(exportedLayer, "usda")
+        self.assertEqual(exportedLayer.customLayerData, {"creator": self.defaultAuthoringMetadata})
+        self.assertEqual(exportedLayer.comment, "Exported")
+        self.assertEqual(exportedLayer.defaultPrim, self.defaultPrimName)
+        primSpec = exportedLayer.GetPrimAtPath(f"/{self.defaultPrimName}/Asset")
+        self.assertEqual(primSpec.referenceList.prependedItems[0].assetPath, "./textures/ref.usda")
+        self.assertEqual(primSpec.attributes["texture"].default.path, "/elsewhere/texture.png")
+
+    def testFileFormatArgs(self):
+        identifier = self.tmpFile("test", "usd")
+        stage = usdex.core.createInMemoryStage(
+            identifier,
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+            fileFormatArgs={"format": "usda"},
+        )
+        self.assertIsInstance(stage, Usd.Stage)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+            self.assertTrue(usdex.core.exportInMemoryStage(stage))
+        self.assertUsdLayerEncoding(Sdf.Layer.FindOrOpen(identifier), "usda")
+
+    def testInvalidArguments(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid identifier")]):
+            stage = usdex.core.createInMemoryStage(
+                self.tmpFile("test", "foo"),
+                self.defaultPrimName,
+                self.defaultUpAxis,
+                self.defaultLinearUnits,
+                self.defaultAuthoringMetadata,
+            )
+        self.assertIsNone(stage)
+
+        # A stage with a file backed root layer can not be exported
+        identifier = self.tmpFile("test", "usda")
+        stage = usdex.core.createStage(identifier, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*root layer is not an in-memory layer")]):
+            self.assertFalse(usdex.core.exportInMemoryStage(stage))
+
+        # An anonymous root layer without a supported identifier can not be exported
+        stage = Usd.Stage.Open(Sdf.Layer.CreateAnonymous())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid identifier")]):
+            self.assertFalse(usdex.core.exportInMemoryStage(stage))
+
+
 class ConfigureStageTestCase(usdex.test.TestCase):
     def testDefaultPrimName(self):
         # The default prim name is required and must be a valid name otherwise the stage will not be configured
@@ -598,6 +680,7 @@ class SaveStageTestCase(usdex.test.TestCase):
             usdex.core.saveStage(stage, authoringMetadata=self.defaultAuthoringMetadata, comment=comment)
         for layer in stage.GetLayerStack():
             if not layer.anonymous:
+                self.assertFalse(layer.dirty, f"{layer.identifier} was not saved")
                 self.assertTrue(usdex.core.hasLayerAuthoringMetadata(layer))
                 self.assertEqual(layer.customLayerData, {"creator": self.defaultAuthoringMetadata}, f"{layer.identifier} did not match")
                 self.assertEqual(layer.comment, comment)
@@ -689,6 +772,96 @@ class SaveStageTestCase(usdex.test.TestCase):
             ],
         )
 
+    def testSaveDirtyLayers(self):
+        comment = "test save dirty layers comment"
+        stage = self.__composeStage()
+        rootLayer = stage.GetRootLayer()
+        baseLayer = stage.GetLayerStack()[-1]
+        root = stage.GetDefaultPrim()
+
+        stage.SetEditTarget(Usd.EditTarget(rootLayer))
+        stage.DefinePrim(f"{root.GetPath()}/another")
+        stage.SetEditTarget(Usd.EditTarget(baseLayer))
+        stage.DefinePrim(f"{root.GetPath()}/another1")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            self.assertTrue(usdex.core.saveDirtyLayers(stage, authoringMetadata=self.defaultAuthoringMetadata, comment=comment))
+        for layer in stage.GetLayerStack():
+            if not layer.anonymous:
+                self.assertFalse(layer.dirty, f"{layer.identifier} was not saved")
+                self.assertEqual(layer.customLayerData, {"creator": self.defaultAuthoringMetadata}, f"{layer.identifier} did not match")
+                self.assertEqual(layer.comment, comment)
+
+        # A layer which can not be saved fails the save, while the other dirty layers are still saved
+        stage.SetEditTarget(Usd.EditTarget(rootLayer))
+        stage.DefinePrim(f"{root.GetPath()}/another2")
+        stage.SetEditTarget(Usd.EditTarget(baseLayer))
+        stage.DefinePrim(f"{root.GetPath()}/another3")
+        baseLayer.SetPermissionToSave(False)
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*"),
+                (Tf.TF_DIAGNOSTIC_WARNING_TYPE, "Unable to save layer.*permission to save has been disabled"),
+            ],
+        ):
+            self.assertFalse(usdex.core.saveDirtyLayers(stage))
+        self.assertFalse(rootLayer.dirty)
+        self.assertTrue(baseLayer.dirty)
+
+        # Once permission is restored the remaining layer is saved
+        baseLayer.SetPermissionToSave(True)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            self.assertTrue(usdex.core.saveDirtyLayers(stage))
+        self.assertFalse(baseLayer.dirty)
+
+    def testSaveStageAsync(self):
+        comment = "test async save stage comment"
+        stage = self.__composeStage()
+        rootLayer = stage.GetRootLayer()
+        baseLayer = stage.GetLayerStack()[-1]
+        root = stage.GetDefaultPrim()
+
+        stage.SetEditTarget(Usd.EditTarget(rootLayer))
+        stage.DefinePrim(f"{root.GetPath()}/another")
+        stage.SetEditTarget(Usd.EditTarget(baseLayer))
+        stage.DefinePrim(f"{root.GetPath()}/another1")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*asynchronously.*")]):
+            future = usdex.core.saveStageAsync(stage, authoringMetadata=self.defaultAuthoringMetadata, comment=comment)
+
+        # The metadata and comment are authored on the live layers immediately
+        for layer in stage.GetLayerStack():
+            if not layer.anonymous:
+                self.assertEqual(layer.customLayerData, {"creator": self.defaultAuthoringMetadata}, f"{layer.identifier} did not match")
+                self.assertEqual(layer.comment, comment)
+
+        # Edits made while the save is in flight are not written
+        stage.SetEditTarget(Usd.EditTarget(rootLayer))
+        stage.DefinePrim(f"{root.GetPath()}/inFlight")
+
+        self.assertTrue(future.result())
+        self.assertTrue(future.done())
+        future.wait()
+
+        # The live layers remain dirty, and the files on disk contain the snapshot
+        self.assertTrue(rootLayer.dirty)
+        savedRoot = Sdf.Layer.OpenAsAnonymous(rootLayer.realPath)
+        self.assertTrue(savedRoot.GetPrimAtPath(f"{root.GetPath()}/another"))
+        self.assertFalse(savedRoot.GetPrimAtPath(f"{root.GetPath()}/inFlight"))
+        self.assertEqual(savedRoot.comment, comment)
+        self.assertEqual(savedRoot.customLayerData, {"creator": self.defaultAuthoringMetadata})
+        savedBase = Sdf.Layer.OpenAsAnonymous(baseLayer.realPath)
+        self.assertTrue(savedBase.GetPrimAtPath(f"{root.GetPath()}/another1"))
+
+        # A subsequent save writes the remaining edits
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            self.assertTrue(usdex.core.saveStageAsync(stage).result())
+        self.assertTrue(Sdf.Layer.OpenAsAnonymous(rootLayer.realPath).GetPrimAtPath(f"{root.GetPath()}/inFlight"))
+
+        # Saving a clean stage is a no-op
+        stage = Usd.Stage.CreateInMemory()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            self.assertTrue(usdex.core.saveStageAsync(stage).result())
+
 
 class LocationEditableTestCase(usdex.test.TestCase):
     def testIsEditableLocationFromStagePath(self):
@@ -774,3 +947,56 @@ class LocationEditableTestCase(usdex.test.TestCase):
         result, reason = usdex.core.isEditablePrimLocation(instanceProxyChild)
         self.assertFalse(result)
         self.assertRegex(reason, ".*is an instance proxy, authoring is not allowed")
+
+    def testAreEditableLocations(self):
+        stage = Usd.Stage.CreateInMemory()
+        stage.CreateClassPrim("/Prototypes")
+        UsdGeom.Xform.Define(stage, "/Prototypes/Prototype")
+        UsdGeom.Xform.Define(stage, "/Prototypes/Prototype/InstanceProxyChild")
+        xformPrim = UsdGeom.Xform.Define(stage, "/World/Instance").GetPrim()
+        xformPrim.GetReferences().AddInternalReference(Sdf.Path("/Prototypes/Prototype"))
+        xformPrim.SetInstanceable(True)
+
+        # Each path gives the same result as validating it individually
+        paths = [
+            "/World/A",
+            "/World/B",
+            "/NotYetDefined/Child",
+            "../relative",
+            "/absolute.property",
+            f"{xformPrim.GetPath()}/InstanceProxyChild",
+            f"{xformPrim.GetPath()}/NewChild",
+        ]
+        results, reasons = usdex.core.areEditablePrimLocations(stage, paths)
+        self.assertEqual(len(results), len(paths))
+        self.assertEqual(len(reasons), len(paths))
+        for path, result, reason in zip(paths, results, reasons):
+            self.assertEqual((result, reason), usdex.core.isEditablePrimLocation(stage, path), path)
+        self.assertEqual(results, [True, True, True, False, False, False, True])
+
+        # Each name gives the same result as validating it individually
+        names = ["child", "other", "1 2 3 !!!"]
+        worldPrim = stage.GetPrimAtPath("/World")
+        results, reasons = usdex.core.areEditablePrimLocations(worldPrim, names)
+        for name, result, reason in zip(names, results, reasons):
+            self.assertEqual((result, reason), usdex.core.isEditablePrimLocation(worldPrim, name), name)
+        self.assertEqual(results, [True, True, False])
+
+        names = ["InstanceProxyChild", "NewChild"]
+        results, reasons = usdex.core.areEditablePrimLocations(xformPrim, names)
+        self.assertEqual(results, [False, True])
+        self.assertRegex(reasons[0], ".*is an instance proxy, authoring is not allowed")
+        self.assertEqual(reasons[1], "")
+
+        # An invalid or instance proxy parent fails every name
+        results, reasons = usdex.core.areEditablePrimLocations(Usd.Prim(), names)
+        self.assertEqual(results, [False, False])
+        self.assertEqual(reasons, ["Invalid UsdPrim"] * 2)
+        instanceProxyChild = stage.GetPrimAtPath(f"{xformPrim.GetPath()}/InstanceProxyChild")
+        results, reasons = usdex.core.areEditablePrimLocations(instanceProxyChild, names)
+        self.assertEqual(results, [False, False])
+        for reason in reasons:
+            self.assertRegex(reason, ".*is an instance proxy, authoring is not allowed")
+
+        # Empty inputs are valid
+        self.assertEqual(usdex.core.areEditablePrimLocations(stage, []), ([], []))
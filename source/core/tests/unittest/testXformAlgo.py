@@ -2,6 +2,8 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import array
+
 import usdex.core
 import usdex.test
 from pxr import Gf, Sdf, Tf, Usd, UsdGeom, Vt
@@ -1169,6 +1171,447 @@ class SetLocalTransformWithOrientationTestCase(BaseSetLocalTransformTestCase):
         self.assertIsValidUsd(stage)
 
 
+class SetLocalTransformsTestCase(BaseSetLocalTransformTestCase):
+
+    def _createBatchStage(self, count):
+        """Create a stage with one group of xformable prims per xformOp state, returning the stage and the prims"""
+        stage = Usd.Stage.CreateInMemory()
+        prims = []
+        for i in range(count):
+            # no xformOps
+            prims.append(UsdGeom.Xform.Define(stage, f"/Root/NoOps_{i}").GetPrim())
+            # an existing transform xformOp which should be reused
+            xformable = UsdGeom.Xform.Define(stage, f"/Root/TransformOp_{i}")
+            xformable.AddTransformOp(opSuffix="custom")
+            prims.append(xformable.GetPrim())
+            # existing XformCommonAPI xformOps
+            xformable = UsdGeom.Xform.Define(stage, f"/Root/CommonOps_{i}")
+            UsdGeom.XformCommonAPI(xformable).SetTranslate(NON_IDENTITY_TRANSLATE)
+            prims.append(xformable.GetPrim())
+        return stage, prims
+
+    def assertBatchMatchesSingle(self, batchStage, singleStage):
+        batchLayer = batchStage.GetRootLayer().ExportToString()
+        singleLayer = singleStage.GetRootLayer().ExportToString()
+        self.assertEqual(batchLayer, singleLayer)
+
+    def testTransforms(self):
+        transforms = [IDENTITY_TRANSFORM, NON_IDENTITY_TRANSFORM, PIVOT_POSITION_AND_ORIENTATION_TRANSFORM]
+
+        singleStage, singlePrims = self._createBatchStage(10)
+        for i, prim in enumerate(singlePrims):
+            self.assertTrue(usdex.core.setLocalTransform(prim, transforms[i % len(transforms)]))
+
+        batchStage, batchPrims = self._createBatchStage(10)
+        batchTransforms = [transforms[i % len(transforms)] for i in range(len(batchPrims))]
+        self.assertTrue(usdex.core.setLocalTransforms(batchPrims, batchTransforms))
+
+        for prim in batchPrims:
+            self.assertSuccessfulSetLocalTransform(prim)
+        self.assertBatchMatchesSingle(batchStage, singleStage)
+        self.assertIsValidUsd(batchStage)
+
+    def testMatrices(self):
+        matrices = [IDENTITY_MATRIX, NON_IDENTITY_MATRIX]
+
+        singleStage, singlePrims = self._createBatchStage(10)
+        for i, prim in enumerate(singlePrims):
+            self.assertTrue(usdex.core.setLocalTransform(prim, matrices[i % len(matrices)], Usd.TimeCode(5)))
+
+        batchStage, batchPrims = self._createBatchStage(10)
+        batchMatrices = [matrices[i % len(matrices)] for i in range(len(batchPrims))]
+        self.assertTrue(usdex.core.setLocalTransforms(batchPrims, batchMatrices, Usd.TimeCode(5)))
+
+        for prim, matrix in zip(batchPrims, batchMatrices):
+            self.assertSuccessfulSetLocalTransform(prim)
+            self.assertValuesAuthoredForXformOpsAtTimes(UsdGeom.Xformable(prim), [Usd.TimeCode(5)])
+            self.assertMatricesAlmostEqual(UsdGeom.Xformable(prim).GetLocalTransformation(Usd.TimeCode(5)), matrix)
+        self.assertBatchMatchesSingle(batchStage, singleStage)
+        self.assertIsValidUsd(batchStage)
+
+    def testComponents(self):
+        components = [IDENTITY_COMPONENTS, NON_IDENTITY_COMPONENTS]
+
+        singleStage, singlePrims = self._createBatchStage(10)
+        for i, prim in enumerate(singlePrims):
+            self.assertTrue(usdex.core.setLocalTransform(prim, *components[i % len(components)]))
+
+        batchStage, batchPrims = self._createBatchStage(10)
+        batchComponents = [components[i % len(components)] for i in range(len(batchPrims))]
+        self.assertTrue(
+            usdex.core.setLocalTransforms(
+                batchPrims,
+                [x[0] for x in batchComponents],
+                [x[1] for x in batchComponents],
+                [x[2] for x in batchComponents],
+                usdex.core.RotationOrder.eXyz,
+                [x[4] for x in batchComponents],
+            )
+        )
+
+        for prim in batchPrims:
+            self.assertSuccessfulSetLocalTransform(prim)
+        self.assertBatchMatchesSingle(batchStage, singleStage)
+        self.assertIsValidUsd(batchStage)
+
+    def testPathsAndBuffers(self):
+        matrices = [IDENTITY_MATRIX, NON_IDENTITY_MATRIX]
+        components = [IDENTITY_COMPONENTS, NON_IDENTITY_COMPONENTS]
+
+        def buffer(typecode, values, shape):
+            return memoryview(array.array(typecode, values).tobytes()).cast(typecode, shape)
+
+        # Matrices may be provided as a buffer of shape (N, 4, 4) for the prims at many paths
+        singleStage, singlePrims = self._createBatchStage(10)
+        self.assertTrue(usdex.core.setLocalTransforms(singlePrims, [matrices[i % len(matrices)] for i in range(len(singlePrims))]))
+
+        batchStage, batchPrims = self._createBatchStage(10)
+        paths = [prim.GetPath() for prim in batchPrims]
+        values = [matrices[i % len(matrices)][r][c] for i in range(len(paths)) for r in range(4) for c in range(4)]
+        self.assertTrue(usdex.core.setLocalTransforms(batchStage, paths, buffer("d", values, [len(paths), 4, 4])))
+        self.assertBatchMatchesSingle(batchStage, singleStage)
+
+        # Components may be provided as buffers of shape (N, 3), and the paths may be strings
+        singleStage, singlePrims = self._createBatchStage(10)
+        for i, prim in enumerate(singlePrims):
+            self.assertTrue(usdex.core.setLocalTransform(prim, *components[i % len(components)]))
+
+        batchStage, batchPrims = self._createBatchStage(10)
+        paths = [str(prim.GetPath()) for prim in batchPrims]
+        batchComponents = [components[i % len(components)] for i in range(len(paths))]
+        self.assertTrue(
+            usdex.core.setLocalTransforms(
+                batchStage,
+                paths,
+                buffer("d", [v for x in batchComponents for v in x[0]], [len(paths), 3]),
+                buffer("d", [v for x in batchComponents for v in x[1]], [len(paths), 3]),
+                buffer("f", [v for x in batchComponents for v in x[2]], [len(paths), 3]),
+                usdex.core.RotationOrder.eXyz,
+                buffer("f", [v for x in batchComponents for v in x[4]], [len(paths), 3]),
+            )
+        )
+        self.assertBatchMatchesSingle(batchStage, singleStage)
+
+        # Paths which are not xformable prims produce a failure return, but all other prims are still authored
+        paths = ["/Root/Invalid", batchPrims[0].GetPath()]
+        self.assertFalse(usdex.core.setLocalTransforms(batchStage, paths, Vt.Matrix4dArray([NON_IDENTITY_MATRIX] * 2)))
+        self.assertMatricesAlmostEqual(UsdGeom.Xformable(batchPrims[0]).GetLocalTransformation(), NON_IDENTITY_MATRIX)
+
+    def testInvalidPrims(self):
+        stage = self._createTestStage()
+        valid = stage.GetPrimAtPath("/Root/Xform")
+        self._removeXformableProperties(valid)
+
+        # Invalid or non-xformable prims produce a failure return, but all other prims are still authored
+        prims = [stage.GetPrimAtPath("/Root/Invalid"), stage.GetPrimAtPath("/Root/Scope"), valid]
+        self.assertFalse(usdex.core.setLocalTransforms(prims, [NON_IDENTITY_MATRIX] * len(prims)))
+        self.assertSuccessfulSetLocalTransform(valid)
+        self.assertMatricesAlmostEqual(UsdGeom.Xformable(valid).GetLocalTransformation(), NON_IDENTITY_MATRIX)
+        self.assertIsValidUsd(stage)
+
+    def testMismatchedSizes(self):
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        self._removeXformableProperties(prim)
+
+        # Nothing is authored when the sizes do not match
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*1 prims were provided with 2 transforms")]):
+            self.assertFalse(usdex.core.setLocalTransforms([prim], [IDENTITY_TRANSFORM, IDENTITY_TRANSFORM]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*1 prims were provided with 2 matrices")]):
+            self.assertFalse(usdex.core.setLocalTransforms([prim], [IDENTITY_MATRIX, IDENTITY_MATRIX]))
+        expected = ".*1 prims were provided with 1 translations, 0 pivots"
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, expected)]):
+            self.assertFalse(
+                usdex.core.setLocalTransforms([prim], [IDENTITY_TRANSLATE], [], [IDENTITY_ROTATE], usdex.core.RotationOrder.eXyz, [IDENTITY_SCALE])
+            )
+        self.assertFalse(UsdGeom.Xformable(prim).GetXformOpOrderAttr().IsAuthored())
+
+        # Empty arrays are valid
+        self.assertTrue(usdex.core.setLocalTransforms([], []))
+
+
+class SetLocalTransformSamplesTestCase(BaseSetLocalTransformTestCase):
+
+    TIMES = [Usd.TimeCode(x) for x in range(10)]
+
+    def _createSampleStages(self):
+        """Create two identical stages, returning the stages and the xform prim on each"""
+        result = []
+        for _ in range(2):
+            stage = Usd.Stage.CreateInMemory()
+            result.append((stage, UsdGeom.Xform.Define(stage, "/Root/Xform").GetPrim()))
+        return result
+
+    def assertSamplesMatchFrames(self, samplesStage, framesStage):
+        self.assertEqual(samplesStage.GetRootLayer().ExportToString(), framesStage.GetRootLayer().ExportToString())
+
+    def testMatrices(self):
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        matrices = [Gf.Matrix4d().SetTranslate(Gf.Vec3d(time.GetValue(), 0.0, 0.0)) for time in self.TIMES]
+        for time, matrix in zip(self.TIMES, matrices):
+            self.assertTrue(usdex.core.setLocalTransform(framesPrim, matrix, time))
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, self.TIMES, matrices))
+
+        xformable = UsdGeom.Xformable(samplesPrim)
+        self.assertSuccessfulSetLocalTransform(samplesPrim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), MATRIX_XFORM_OP_ORDER)
+        self.assertValuesAuthoredForXformOpsAtTimes(xformable, self.TIMES)
+        self.assertSamplesMatchFrames(samplesStage, framesStage)
+        self.assertIsValidUsd(samplesStage)
+
+    def testTransforms(self):
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        transforms = []
+        for time in self.TIMES:
+            transform = Gf.Transform()
+            transform.SetTranslation(Gf.Vec3d(time.GetValue(), 0.0, 0.0))
+            transform.SetRotation(NON_IDENTITY_ROTATION)
+            transform.SetPivotPosition(NON_IDENTITY_TRANSLATE)
+            transforms.append(transform)
+        for time, transform in zip(self.TIMES, transforms):
+            self.assertTrue(usdex.core.setLocalTransform(framesPrim, transform, time))
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, self.TIMES, transforms))
+
+        xformable = UsdGeom.Xformable(samplesPrim)
+        self.assertSuccessfulSetLocalTransform(samplesPrim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), COMPONENT_XFORM_OP_ORDER)
+        self.assertValuesAuthoredForXformOpsAtTimes(xformable, self.TIMES)
+        self.assertSamplesMatchFrames(samplesStage, framesStage)
+        self.assertIsValidUsd(samplesStage)
+
+        # The xformOps are chosen once, so a single sample with a pivot position selects the XformCommonAPI for all samples
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        self._removeXformableProperties(prim)
+        self.assertTrue(usdex.core.setLocalTransform(prim, self.TIMES[:2], [IDENTITY_TRANSFORM, NON_IDENTITY_TRANSFORM]))
+        self.assertEqual(UsdGeom.Xformable(prim).GetXformOpOrderAttr().Get(), COMPONENT_XFORM_OP_ORDER)
+        self.assertEqual(usdex.core.getLocalTransform(prim, self.TIMES[0]), IDENTITY_TRANSFORM)
+
+        # A sample with a pivot orientation can only be expressed as a matrix
+        self.assertTrue(usdex.core.setLocalTransform(prim, self.TIMES[:2], [NON_IDENTITY_TRANSFORM, PIVOT_POSITION_AND_ORIENTATION_TRANSFORM]))
+        self.assertEqual(UsdGeom.Xformable(prim).GetXformOpOrderAttr().Get(), MATRIX_XFORM_OP_ORDER)
+        self.assertMatricesAlmostEqual(
+            UsdGeom.Xformable(prim).GetLocalTransformation(self.TIMES[1]),
+            PIVOT_POSITION_AND_ORIENTATION_TRANSFORM.GetMatrix(),
+        )
+
+    def testComponents(self):
+        translation, pivot, rotation, rotationOrder, scale = NON_IDENTITY_COMPONENTS
+        translations = [Gf.Vec3d(time.GetValue(), 0.0, 0.0) for time in self.TIMES]
+        pivots = [pivot] * len(self.TIMES)
+        rotations = [rotation] * len(self.TIMES)
+        scales = [scale] * len(self.TIMES)
+
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        for i, time in enumerate(self.TIMES):
+            self.assertTrue(usdex.core.setLocalTransform(framesPrim, translations[i], pivots[i], rotations[i], rotationOrder, scales[i], time))
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, self.TIMES, translations, pivots, rotations, rotationOrder, scales))
+
+        xformable = UsdGeom.Xformable(samplesPrim)
+        self.assertSuccessfulSetLocalTransform(samplesPrim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), COMPONENT_XFORM_OP_ORDER)
+        self.assertValuesAuthoredForXformOpsAtTimes(xformable, self.TIMES)
+        self.assertSamplesMatchFrames(samplesStage, framesStage)
+        self.assertIsValidUsd(samplesStage)
+
+        # An existing transform xformOp is reused when there are no pivots
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        UsdGeom.Xformable(samplesPrim).AddTransformOp()
+        UsdGeom.Xformable(framesPrim).AddTransformOp()
+        pivots = [IDENTITY_TRANSLATE] * len(self.TIMES)
+        for i, time in enumerate(self.TIMES):
+            self.assertTrue(usdex.core.setLocalTransform(framesPrim, translations[i], pivots[i], rotations[i], rotationOrder, scales[i], time))
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, self.TIMES, translations, pivots, rotations, rotationOrder, scales))
+        self.assertEqual(UsdGeom.Xformable(samplesPrim).GetXformOpOrderAttr().Get(), MATRIX_XFORM_OP_ORDER)
+        self.assertSamplesMatchFrames(samplesStage, framesStage)
+
+    def testOrientations(self):
+        translations = [Gf.Vec3d(time.GetValue(), 0.0, 0.0) for time in self.TIMES]
+        orientations = [NON_IDENTITY_ORIENTATION] * len(self.TIMES)
+        scales = [NON_IDENTITY_SCALE] * len(self.TIMES)
+
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        for i, time in enumerate(self.TIMES):
+            self.assertTrue(usdex.core.setLocalTransform(framesPrim, translations[i], orientations[i], scales[i], time))
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, self.TIMES, translations, orientations, scales))
+
+        xformable = UsdGeom.Xformable(samplesPrim)
+        self.assertSuccessfulSetLocalTransform(samplesPrim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), COMPONENT_WITH_ORIENTATION_XFORM_OP_ORDER)
+        self.assertValuesAuthoredForXformOpsAtTimes(xformable, self.TIMES)
+        self.assertSamplesMatchFrames(samplesStage, framesStage)
+        self.assertIsValidUsd(samplesStage)
+
+    def testInvalidPrims(self):
+        stage = self._createTestStage()
+        self.assertFalse(usdex.core.setLocalTransform(stage.GetPrimAtPath("/Root/Invalid"), self.TIMES[:1], [IDENTITY_MATRIX]))
+        self.assertFalse(usdex.core.setLocalTransform(stage.GetPrimAtPath("/Root/Scope"), self.TIMES[:1], [IDENTITY_TRANSFORM]))
+        self.assertIsValidUsd(stage)
+
+    def testInvalidFrames(self):
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        self._removeXformableProperties(prim)
+
+        # Nothing is authored when the sizes do not match or a default time code is provided
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid frames: Expected 2 values but found 1")]):
+            self.assertFalse(usdex.core.setLocalTransform(prim, self.TIMES[:2], [IDENTITY_MATRIX]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid frames: Expected 1 values but found 0")]):
+            self.assertFalse(usdex.core.setLocalTransform(prim, self.TIMES[:1], [IDENTITY_TRANSLATE], [IDENTITY_ORIENTATION], []))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid frames: The default time code")]):
+            self.assertFalse(usdex.core.setLocalTransform(prim, [Usd.TimeCode.Default()], [IDENTITY_TRANSFORM]))
+        self.assertFalse(UsdGeom.Xformable(prim).GetXformOpOrderAttr().IsAuthored())
+
+        # Empty arrays are valid
+        self.assertTrue(usdex.core.setLocalTransform(prim, [], []))
+
+    def testKeyframeReduction(self):
+        reduction = usdex.core.KeyframeReduction()
+        self.assertEqual(reduction.tolerance, 1e-6)
+        self.assertEqual(reduction.removedSamples, 0)
+
+        # Linear matrix samples only require the first and last samples
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        matrices = [Gf.Matrix4d().SetTranslate(Gf.Vec3d(time.GetValue(), 0.0, 0.0)) for time in self.TIMES]
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, self.TIMES, matrices, reduction))
+        self.assertTrue(usdex.core.setLocalTransform(framesPrim, self.TIMES, matrices))
+        self.assertEqual(reduction.removedSamples, len(self.TIMES) - 2)
+        xformable = UsdGeom.Xformable(samplesPrim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), MATRIX_XFORM_OP_ORDER)
+        self.assertEqual(xformable.GetOrderedXformOps()[0].GetTimeSamples(), [self.TIMES[0].GetValue(), self.TIMES[-1].GetValue()])
+        for time in self.TIMES:
+            self.assertMatricesAlmostEqual(xformable.GetLocalTransformation(time), UsdGeom.Xformable(framesPrim).GetLocalTransformation(time))
+        self.assertIsValidUsd(samplesStage)
+
+        # Each xformOp is reduced independently and the removed samples accumulate over calls
+        translation, pivot, rotation, rotationOrder, scale = NON_IDENTITY_COMPONENTS
+        translations = [Gf.Vec3d(time.GetValue(), time.GetValue() ** 2, 0.0) for time in self.TIMES]
+        pivots = [pivot] * len(self.TIMES)
+        rotations = [rotation] * len(self.TIMES)
+        scales = [scale] * len(self.TIMES)
+        reduction = usdex.core.KeyframeReduction(tolerance=1e-4)
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, self.TIMES, translations, pivots, rotations, rotationOrder, scales, reduction))
+        self.assertTrue(usdex.core.setLocalTransform(framesPrim, self.TIMES, translations, pivots, rotations, rotationOrder, scales))
+        self.assertEqual(reduction.removedSamples, 3 * (len(self.TIMES) - 2))
+        xformable = UsdGeom.Xformable(samplesPrim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), COMPONENT_XFORM_OP_ORDER)
+        self.assertEqual(xformable.GetOrderedXformOps()[0].GetNumTimeSamples(), len(self.TIMES))
+        for time in self.TIMES:
+            self.assertMatricesAlmostEqual(xformable.GetLocalTransformation(time), UsdGeom.Xformable(framesPrim).GetLocalTransformation(time))
+
+        # Constant orientations are reduced using spherical interpolation
+        reduction = usdex.core.KeyframeReduction()
+        translations = [Gf.Vec3d(time.GetValue(), 0.0, 0.0) for time in self.TIMES]
+        orientations = [NON_IDENTITY_ORIENTATION] * len(self.TIMES)
+        scales = [NON_IDENTITY_SCALE] * len(self.TIMES)
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, self.TIMES, translations, orientations, scales, reduction))
+        self.assertTrue(usdex.core.setLocalTransform(framesPrim, self.TIMES, translations, orientations, scales))
+        self.assertEqual(reduction.removedSamples, 3 * (len(self.TIMES) - 2))
+        xformable = UsdGeom.Xformable(samplesPrim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), COMPONENT_WITH_ORIENTATION_XFORM_OP_ORDER)
+        for time in self.TIMES:
+            self.assertMatricesAlmostEqual(xformable.GetLocalTransformation(time), UsdGeom.Xformable(framesPrim).GetLocalTransformation(time))
+
+        # Unordered times are authored in full
+        reduction = usdex.core.KeyframeReduction()
+        times = list(reversed(self.TIMES))
+        (samplesStage, samplesPrim), (framesStage, framesPrim) = self._createSampleStages()
+        self.assertTrue(usdex.core.setLocalTransform(samplesPrim, times, [IDENTITY_MATRIX] * len(times), reduction))
+        self.assertTrue(usdex.core.setLocalTransform(framesPrim, times, [IDENTITY_MATRIX] * len(times)))
+        self.assertEqual(reduction.removedSamples, 0)
+        self.assertSamplesMatchFrames(samplesStage, framesStage)
+
+
+class LocalTransformWriterTestCase(BaseSetLocalTransformTestCase):
+
+    def testInvalidPrims(self):
+        stage = self._createTestStage()
+        writer = usdex.core.LocalTransformWriter(stage.GetPrimAtPath("/Root/Invalid"))
+        self.assertFalse(writer.set(IDENTITY_MATRIX))
+        writer = usdex.core.LocalTransformWriter(stage.GetPrimAtPath("/Root/Scope"))
+        self.assertFalse(writer.set(IDENTITY_MATRIX))
+        self.assertFalse(writer.set(*IDENTITY_COMPONENTS_WITH_ORIENTATION))
+        self.assertIsValidUsd(stage)
+
+    def testMatrixFrames(self):
+        # Setting many frames with a writer is identical to setting each frame with setLocalTransform
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        self._removeXformableProperties(prim)
+        expectedPrim = stage.GetPrimAtPath("/Root/Animated_Matrix")
+        self._removeXformableProperties(expectedPrim)
+
+        writer = usdex.core.LocalTransformWriter(prim)
+        self.assertEqual(writer.getPrim(), prim)
+        times = [Usd.TimeCode(x) for x in range(10)]
+        for time in times:
+            matrix = Gf.Matrix4d().SetTranslate(Gf.Vec3d(time.GetValue(), 0.0, 0.0))
+            self.assertTrue(writer.set(matrix, time))
+            self.assertTrue(usdex.core.setLocalTransform(expectedPrim, matrix, time))
+
+        xformable = UsdGeom.Xformable(prim)
+        self.assertSuccessfulSetLocalTransform(prim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), MATRIX_XFORM_OP_ORDER)
+        self.assertValuesAuthoredForXformOpsAtTimes(xformable, times)
+        for time in times:
+            self.assertEqual(xformable.GetLocalTransformation(time), UsdGeom.Xformable(expectedPrim).GetLocalTransformation(time))
+        self.assertIsValidUsd(stage)
+
+    def testOrientationFrames(self):
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        self._removeXformableProperties(prim)
+
+        # Existing transform xformOps are replaced, exactly as setLocalTransform would
+        UsdGeom.Xformable(prim).AddTransformOp()
+        writer = usdex.core.LocalTransformWriter(prim)
+        times = [Usd.TimeCode(x) for x in range(10)]
+        for time in times:
+            self.assertTrue(writer.set(Gf.Vec3d(time.GetValue(), 0.0, 0.0), NON_IDENTITY_ORIENTATION, NON_IDENTITY_SCALE, time))
+
+        xformable = UsdGeom.Xformable(prim)
+        self.assertSuccessfulSetLocalTransform(prim)
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), COMPONENT_WITH_ORIENTATION_XFORM_OP_ORDER)
+        self.assertValuesAuthoredForXformOpsAtTimes(xformable, times)
+        for time in times:
+            translation, _, _, scale = usdex.core.getLocalTransformComponentsQuat(prim, time)
+            self.assertEqual(translation, Gf.Vec3d(time.GetValue(), 0.0, 0.0))
+            self.assertEqual(scale, NON_IDENTITY_SCALE)
+        self.assertIsValidUsd(stage)
+
+    def testLayoutChanges(self):
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        self._removeXformableProperties(prim)
+        xformable = UsdGeom.Xformable(prim)
+
+        # Changing the format of the value resolves the xformOps again
+        writer = usdex.core.LocalTransformWriter(prim)
+        self.assertTrue(writer.set(NON_IDENTITY_MATRIX, Usd.TimeCode(1)))
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), MATRIX_XFORM_OP_ORDER)
+        self.assertTrue(writer.set(*NON_IDENTITY_COMPONENTS_WITH_ORIENTATION, Usd.TimeCode(2)))
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), COMPONENT_WITH_ORIENTATION_XFORM_OP_ORDER)
+        self.assertTrue(writer.set(NON_IDENTITY_MATRIX, Usd.TimeCode(3)))
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), MATRIX_XFORM_OP_ORDER)
+
+        # Changing the edit target resolves the xformOps again, so the xformOpOrder is authored in the new edit target
+        layer = Sdf.Layer.CreateAnonymous()
+        stage.GetRootLayer().subLayerPaths.insert(0, layer.identifier)
+        stage.SetEditTarget(Usd.EditTarget(layer))
+        self.assertTrue(writer.set(IDENTITY_MATRIX, Usd.TimeCode(4)))
+        self.assertTrue(layer.GetAttributeAtPath(xformable.GetXformOpOrderAttr().GetPath()))
+
+        # Modifying the xformOps by other means requires a reset
+        xformable.ClearXformOpOrder()
+        xformable.AddTranslateOp()
+        writer.reset()
+        self.assertTrue(writer.set(IDENTITY_MATRIX, Usd.TimeCode(5)))
+        self.assertEqual(xformable.GetXformOpOrderAttr().Get(), MATRIX_XFORM_OP_ORDER)
+        self.assertEqual(xformable.GetLocalTransformation(Usd.TimeCode(5)), IDENTITY_MATRIX)
+
+
 class GetLocalTransformTest(BaseXformTestCase):
     def testInvalidPrims(self):
         # An invalid or non-xformable prim will produce an identity return
@@ -1683,6 +2126,177 @@ class GetLocalTransformWithOrientationTest(BaseXformTestCase):
         self.assertIsValidUsd(stage)
 
 
+class GetLocalTransformsTest(BaseXformTestCase):
+    def testMatrices(self):
+        # The bulk results are identical to reading each prim individually
+        stage = self._createTestStage()
+        prims = list(Usd.PrimRange(stage.GetPseudoRoot()))
+        for time in (Usd.TimeCode.Default(), Usd.TimeCode(5)):
+            matrices = usdex.core.getLocalTransformMatrices(prims, time)
+            self.assertIsInstance(matrices, Vt.Matrix4dArray)
+            self.assertEqual(len(matrices), len(prims))
+            for prim, matrix in zip(prims, matrices):
+                self.assertEqual(matrix, usdex.core.getLocalTransformMatrix(prim, time))
+
+            # A range produces one value per prim in traversal order
+            self.assertEqual(usdex.core.getLocalTransformMatrices(Usd.PrimRange(stage.GetPseudoRoot()), time), matrices)
+
+        # Invalid or non-xformable prims produce an identity matrix
+        matrices = usdex.core.getLocalTransformMatrices([stage.GetPrimAtPath("/Root/Invalid"), stage.GetPrimAtPath("/Root/Scope")])
+        self.assertEqual(list(matrices), [IDENTITY_MATRIX, IDENTITY_MATRIX])
+        self.assertEqual(len(usdex.core.getLocalTransformMatrices([])), 0)
+
+    def testComponents(self):
+        stage = self._createTestStage()
+        prims = list(Usd.PrimRange(stage.GetPseudoRoot()))
+        for time in (Usd.TimeCode.Default(), Usd.TimeCode(5)):
+            translations, pivots, rotations, rotationOrders, scales = usdex.core.getLocalTransformComponents(prims, time)
+            self.assertIsInstance(translations, Vt.Vec3dArray)
+            self.assertIsInstance(pivots, Vt.Vec3dArray)
+            self.assertIsInstance(rotations, Vt.Vec3fArray)
+            self.assertIsInstance(scales, Vt.Vec3fArray)
+            for i, prim in enumerate(prims):
+                expected = usdex.core.getLocalTransformComponents(prim, time)
+                self.assertEqual((translations[i], pivots[i], rotations[i], rotationOrders[i], scales[i]), expected)
+
+            # A range produces one value per prim in traversal order
+            result = usdex.core.getLocalTransformComponents(Usd.PrimRange(stage.GetPseudoRoot()), time)
+            self.assertEqual(result, (translations, pivots, rotations, rotationOrders, scales))
+
+        # Invalid or non-xformable prims produce identity components
+        result = usdex.core.getLocalTransformComponents([stage.GetPrimAtPath("/Root/Invalid"), stage.GetPrimAtPath("/Root/Scope")])
+        self.assertEqual(list(result[0]), [IDENTITY_TRANSLATE, IDENTITY_TRANSLATE])
+        self.assertEqual(list(result[4]), [IDENTITY_SCALE, IDENTITY_SCALE])
+
+    def testPaths(self):
+        # The results for the prims at many paths are identical to the results for the prims
+        stage = self._createTestStage()
+        prims = list(Usd.PrimRange(stage.GetPseudoRoot()))
+        paths = [prim.GetPath() for prim in prims]
+        for time in (Usd.TimeCode.Default(), Usd.TimeCode(5)):
+            self.assertEqual(usdex.core.getLocalTransformMatrices(stage, paths, time), usdex.core.getLocalTransformMatrices(prims, time))
+            self.assertEqual(usdex.core.getLocalTransformComponents(stage, paths, time), usdex.core.getLocalTransformComponents(prims, time))
+
+        # The matrices support the buffer protocol with shape (N, 4, 4)
+        view = memoryview(usdex.core.getLocalTransformMatrices(stage, paths))
+        self.assertEqual(view.shape, (len(paths), 4, 4))
+
+        # Paths which are not xformable prims produce an identity matrix
+        matrices = usdex.core.getLocalTransformMatrices(stage, ["/Root/Invalid", "/Root/Scope"])
+        self.assertEqual(list(matrices), [IDENTITY_MATRIX, IDENTITY_MATRIX])
+
+
+class ComputeTransformComponentsTest(BaseXformTestCase):
+    MATRICES = [
+        IDENTITY_MATRIX,
+        NON_IDENTITY_NO_PIVOT_MATRIX,
+        Gf.Matrix4d().SetRotate(Gf.Rotation(Gf.Vec3d(1.0, 2.0, 3.0), 60.0)) * Gf.Matrix4d().SetTranslate(NON_IDENTITY_TRANSLATE),
+    ]
+
+    def testMatchesLocalTransforms(self):
+        # The results are identical to reading the components of a prim with a single transform xformOp
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        translations, pivots, rotations, scales = usdex.core.computeTransformComponents(self.MATRICES)
+        orientationResults = usdex.core.computeTransformComponentsQuat(self.MATRICES)
+        for i, matrix in enumerate(self.MATRICES):
+            usdex.core.setLocalTransform(prim, matrix)
+            self.assertEqual(
+                (translations[i], pivots[i], rotations[i], usdex.core.RotationOrder.eXyz, scales[i]),
+                usdex.core.getLocalTransformComponents(prim),
+            )
+            self.assertEqual(tuple(x[i] for x in orientationResults), usdex.core.getLocalTransformComponentsQuat(prim))
+
+    def testRotationOrders(self):
+        # The rotation values recompose to the original matrix in every rotation order
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        for rotationOrder in usdex.core.RotationOrder.__members__.values():
+            translations, pivots, rotations, scales = usdex.core.computeTransformComponents(self.MATRICES, rotationOrder)
+            self.assertEqual(len(rotations), len(self.MATRICES))
+            for i, matrix in enumerate(self.MATRICES):
+                self._removeXformableProperties(prim)
+                usdex.core.setLocalTransform(prim, translations[i], pivots[i], rotations[i], rotationOrder, scales[i])
+                self.assertMatricesAlmostEqual(UsdGeom.Xformable(prim).GetLocalTransformation(), matrix, places=5)
+
+    def testEmpty(self):
+        result = usdex.core.computeTransformComponents([])
+        self.assertEqual([len(x) for x in result], [0, 0, 0, 0])
+
+
+class WorldTransformCacheTest(BaseXformTestCase):
+    def _createHierarchy(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.defineXform(stage, "/Root", Gf.Transform(Gf.Matrix4d().SetTranslate(Gf.Vec3d(1.0, 0.0, 0.0))))
+        usdex.core.defineXform(stage, "/Root/A", Gf.Transform(Gf.Matrix4d().SetRotate(NON_IDENTITY_ROTATION)))
+        UsdGeom.Scope.Define(stage, "/Root/A/Scope")
+        usdex.core.defineXform(stage, "/Root/A/Scope/Leaf", Gf.Transform(Gf.Matrix4d().SetTranslate(NON_IDENTITY_TRANSLATE)))
+        usdex.core.defineXform(stage, "/Root/B", NON_IDENTITY_TRANSFORM)
+        reset = usdex.core.defineXform(stage, "/Root/B/Reset", Gf.Transform(Gf.Matrix4d().SetScale(2.0)))
+        reset.SetResetXformStack(True)
+        usdex.core.defineXform(stage, "/Root/B/Reset/Leaf", Gf.Transform(Gf.Matrix4d().SetTranslate(NON_IDENTITY_TRANSLATE)))
+        return stage
+
+    def assertMatchesXformCache(self, cache, stage, time=Usd.TimeCode.Default()):
+        xformCache = UsdGeom.XformCache(time)
+        prims = list(stage.Traverse())
+        for prim in prims:
+            self.assertMatricesAlmostEqual(cache.getWorldTransform(prim), xformCache.GetLocalToWorldTransform(prim))
+        for prim, matrix in zip(prims, cache.getWorldTransforms(prims)):
+            self.assertMatricesAlmostEqual(matrix, xformCache.GetLocalToWorldTransform(prim))
+
+    def testWorldTransforms(self):
+        stage = self._createHierarchy()
+        cache = usdex.core.WorldTransformCache(stage)
+        self.assertEqual(cache.getTime(), Usd.TimeCode.Default())
+        self.assertEqual(cache.size(), 0)
+        self.assertMatchesXformCache(cache, stage)
+        self.assertEqual(cache.size(), len(list(stage.Traverse())))
+
+        # Invalid prims and prims of other stages produce an identity matrix
+        self.assertEqual(cache.getWorldTransform(stage.GetPrimAtPath("/Root/Invalid")), IDENTITY_MATRIX)
+        otherStage = self._createHierarchy()
+        self.assertEqual(cache.getWorldTransform(otherStage.GetPrimAtPath("/Root/A")), IDENTITY_MATRIX)
+        self.assertEqual(len(cache.getWorldTransforms([])), 0)
+
+    def testInvalidation(self):
+        stage = self._createHierarchy()
+        cache = usdex.core.WorldTransformCache(stage)
+        self.assertMatchesXformCache(cache, stage)
+        numPrims = cache.size()
+
+        # Changing a local transform discards only the cached transforms of the prim and its descendants
+        usdex.core.setLocalTransform(stage.GetPrimAtPath("/Root/A"), NON_IDENTITY_MATRIX)
+        self.assertEqual(cache.size(), numPrims - 3)
+        self.assertMatchesXformCache(cache, stage)
+
+        # Unrelated changes do not discard any cached transforms
+        usdex.core.setDisplayName(stage.GetPrimAtPath("/Root/A"), "Display Name")
+        self.assertEqual(cache.size(), numPrims)
+
+        # Changes to the hierarchy discard the affected prims
+        stage.RemovePrim("/Root/B/Reset")
+        self.assertEqual(cache.size(), numPrims - 2)
+        self.assertMatchesXformCache(cache, stage)
+
+    def testTime(self):
+        stage = self._createHierarchy()
+        prim = stage.GetPrimAtPath("/Root/A/Scope/Leaf")
+        usdex.core.setLocalTransform(prim, [Usd.TimeCode(0), Usd.TimeCode(10)], [IDENTITY_MATRIX, NON_IDENTITY_MATRIX])
+
+        cache = usdex.core.WorldTransformCache(stage, Usd.TimeCode(10))
+        self.assertMatchesXformCache(cache, stage, Usd.TimeCode(10))
+
+        # Changing the time discards all cached transforms
+        cache.setTime(Usd.TimeCode(0))
+        self.assertEqual(cache.getTime(), Usd.TimeCode(0))
+        self.assertEqual(cache.size(), 0)
+        self.assertMatchesXformCache(cache, stage, Usd.TimeCode(0))
+
+        cache.clear()
+        self.assertEqual(cache.size(), 0)
+
+
 class DefineXformTestCase(usdex.test.DefineFunctionTestCase, BaseXformTestCase):
 
     # Configure the DefineFunctionTestCase
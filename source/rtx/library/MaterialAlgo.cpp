@@ -6,10 +6,18 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usd/specializes.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 #include <pxr/usd/usdShade/tokens.h>
+#include <pxr/usd/usdShade/utils.h>
 #include <pxr/usd/usdUtils/pipeline.h>
 
 using namespace pxr;
@@ -17,6 +25,7 @@ using namespace pxr;
 namespace
 {
 static constexpr const char* g_omniPbrAssetPath("OmniPBR.mdl");
+static constexpr const char* g_mdlShaderName("MDLShader");
 
 // Warnings generated by USD 23.11
 #if defined(ARCH_OS_WINDOWS) && PXR_VERSION < 2405
@@ -57,6 +66,13 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((omniGlassColor, "glass_color"))
     ((omniGlassIor, "glass_ior"))
     ((usdPreviewSurface, "UsdPreviewSurface"))
+    ((usdUvTexture, "UsdUVTexture"))
+    ((usdUvTextureFallback, "fallback"))
+    ((infoMdlSourceAsset, "info:mdl:sourceAsset"))
+    ((infoMdlSourceAssetSubIdentifier, "info:mdl:sourceAsset:subIdentifier"))
+    ((mdlSurface, "mdl:surface"))
+    ((mdlDisplacement, "mdl:displacement"))
+    ((mdlVolume, "mdl:volume"))
     ((usdPreviewSurfaceColor, "diffuseColor"))
     ((usdPreviewSurfaceFile, "file"))
     ((usdPreviewSurfaceIor, "ior"))
@@ -137,6 +153,63 @@ bool removeProperty(UsdStageRefPtr stage, const SdfPath& primPath, const TfToken
     }
 }
 
+// Remove a material interface input authored by `definePbrMaterial` from the current edit target
+// Materials defined by `specializePbrMaterial` may only inherit the input from their prototype, in which case there is nothing to remove
+void removeMaterialInput(UsdShadeMaterial& material, const TfToken& inputsToken)
+{
+    UsdPrim prim = material.GetPrim();
+    UsdStageRefPtr stage = prim.GetStage();
+    SdfLayerHandle layer = stage->GetEditTarget().GetLayer();
+    if (layer && prim.HasAuthoredSpecializes() && !layer->GetPropertyAtPath(prim.GetPath().AppendProperty(inputsToken)))
+    {
+        return;
+    }
+
+    ::removeProperty(stage, prim.GetPath(), inputsToken);
+}
+
+// Check that a material is an abstract prototype defined by `definePbrMaterialPrototype`
+bool isPbrMaterialPrototype(const UsdShadeMaterial& prototype)
+{
+    if (!prototype || !prototype.GetPrim().IsAbstract())
+    {
+        return false;
+    }
+
+    UsdShadeShader mdlShader = usdex::rtx::computeEffectiveMdlSurfaceShader(prototype);
+    SdfAssetPath sourceAsset;
+    return mdlShader && mdlShader.GetSourceAsset(&sourceAsset, _tokens->mdl) && sourceAsset.GetAssetPath() == std::string(g_omniPbrAssetPath);
+}
+
+// Validate the values of a PBR material, using the same ranges which are enforced by `usdex::core::definePreviewMaterial`
+bool validatePbrMaterialValues(const SdfPath& path, const float opacity, const float roughness, const float metallic)
+{
+    std::string reason;
+    if (opacity < 0.0 || opacity > 1.0)
+    {
+        reason = TfStringPrintf("Opacity value %f is outside range [0.0 - 1.0].", opacity);
+    }
+    else if (roughness < 0.0 || roughness > 1.0)
+    {
+        reason = TfStringPrintf("Roughness value %f is outside range [0.0 - 1.0].", roughness);
+    }
+    else if (metallic < 0.0 || metallic > 1.0)
+    {
+        reason = TfStringPrintf("Metallic value %f is outside range [0.0 - 1.0].", metallic);
+    }
+
+    if (!reason.empty())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdShadeMaterial at \"%s\" due to an invalid shader parameter value: %s",
+            path.GetAsString().c_str(),
+            reason.c_str()
+        );
+        return false;
+    }
+    return true;
+}
+
 // This function will create an MDL prim asset input (materialInputName) and connect it to
 // the MDL shader prim asset input (shaderInputName)
 //
@@ -268,7 +341,7 @@ bool addSingleChannelTextureToPbrMaterial(
     {
         input.Get<float>(&channelValue);
         usdex::rtx::createMdlShaderInput(material, omniPbrFallbackValueToken, VtValue(channelValue), SdfValueTypeNames->Float);
-        ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), matValueInputsToken);
+        ::removeMaterialInput(material, matValueInputsToken);
     }
 
     // These need to be set for MDL to use this type texture file
@@ -294,6 +367,360 @@ bool addSingleChannelTextureToPbrMaterial(
     return true;
 }
 
+//! The MDL shader inputs which reproduce a USD Preview Surface shader, as read by `addPbrShadersToPreviewMaterials`
+struct PbrShaderDescription
+{
+    struct Input
+    {
+        TfToken name;
+        VtValue value;
+        SdfValueTypeName typeName;
+        TfToken colorSpace;
+    };
+
+    void add(const TfToken& name, const VtValue& value, const SdfValueTypeName& typeName, const TfToken& colorSpace = TfToken())
+    {
+        inputs.push_back({ name, value, typeName, colorSpace });
+    }
+
+    SdfPath materialPath;
+    std::vector<Input> inputs;
+    bool fractionalOpacity = false;
+};
+
+// Get the UsdUVTexture shader which drives a USD Preview Surface input. If the input is not driven by a texture, its value is returned instead.
+UsdShadeShader getTextureReader(const UsdShadeInput& input, VtValue* value)
+{
+    if (!input)
+    {
+        return UsdShadeShader();
+    }
+
+    UsdShadeAttributeVector valueAttrs = input.GetValueProducingAttributes();
+    if (valueAttrs.empty())
+    {
+        return UsdShadeShader();
+    }
+
+    if (UsdShadeUtils::GetType(valueAttrs[0].GetName()) == UsdShadeAttributeType::Output)
+    {
+        UsdShadeShader reader(valueAttrs[0].GetPrim());
+        TfToken shaderId;
+        if (reader && reader.GetShaderId(&shaderId) && shaderId == _tokens->usdUvTexture)
+        {
+            return reader;
+        }
+        return UsdShadeShader();
+    }
+
+    valueAttrs[0].Get(value);
+    return UsdShadeShader();
+}
+
+// Get the effective value of a UsdUVTexture input, accounting for any connection to the material interface
+template <typename T>
+T getTextureReaderValue(const UsdShadeShader& reader, const TfToken& name, const T& fallback)
+{
+    T result = fallback;
+    UsdShadeInput input = reader.GetInput(name);
+    if (input)
+    {
+        UsdShadeAttributeVector valueAttrs = input.GetValueProducingAttributes();
+        if (!valueAttrs.empty())
+        {
+            valueAttrs[0].Get(&result);
+        }
+    }
+    return result;
+}
+
+// Get the authored texture file of a UsdUVTexture, without its resolved path
+VtValue getTextureFile(const UsdShadeShader& reader)
+{
+    const SdfAssetPath file = getTextureReaderValue(reader, _tokens->usdPreviewSurfaceFile, SdfAssetPath());
+    return VtValue(SdfAssetPath(file.GetAssetPath()));
+}
+
+// Read the USD Preview Surface shader of a material as the equivalent OmniPBR shader inputs, matching the `add*TextureToPbrMaterial` functions.
+// Returns false if the material is not a preview material, or if it already has an MDL shader.
+bool readPreviewMaterial(const UsdShadeMaterial& material, PbrShaderDescription& result, std::string* reason)
+{
+    if (!material)
+    {
+        *reason = "it is not a valid material";
+        return false;
+    }
+
+    UsdShadeShader previewSurface = usdex::core::computeEffectivePreviewSurfaceShader(material);
+    TfToken shaderId;
+    if (!previewSurface || !previewSurface.GetShaderId(&shaderId) || shaderId != _tokens->usdPreviewSurface)
+    {
+        *reason = "it does not have a valid USD Preview Surface Shader";
+        return false;
+    }
+
+    UsdShadeShader mdlShader = usdex::rtx::computeEffectiveMdlSurfaceShader(material);
+    if (mdlShader && mdlShader.GetPrim() != previewSurface.GetPrim())
+    {
+        *reason = "it already has an MDL Shader";
+        return false;
+    }
+
+    if (!usdex::core::isEditablePrimLocation(material.GetPrim(), g_mdlShaderName, reason))
+    {
+        return false;
+    }
+
+    result.materialPath = material.GetPath();
+
+    VtValue value;
+    if (UsdShadeShader reader = ::getTextureReader(previewSurface.GetInput(_tokens->usdPreviewSurfaceColor), &value))
+    {
+        const GfVec4f fallback = ::getTextureReaderValue(reader, _tokens->usdUvTextureFallback, GfVec4f(0.0f, 0.0f, 0.0f, 1.0f));
+        result.add(_tokens->omniPbrAlbedoColor, VtValue(GfVec3f(fallback[0], fallback[1], fallback[2])), SdfValueTypeNames->Color3f);
+        result.add(_tokens->omniPbrDiffuseTexture, ::getTextureFile(reader), SdfValueTypeNames->Asset, _tokens->colorSpaceAuto);
+    }
+    else if (value.IsHolding<GfVec3f>())
+    {
+        result.add(_tokens->omniPbrAlbedoColor, value, SdfValueTypeNames->Color3f);
+    }
+
+    value = VtValue();
+    if (UsdShadeShader reader = ::getTextureReader(previewSurface.GetInput(_tokens->usdPreviewSurfaceNormal), &value))
+    {
+        result.add(_tokens->omniPbrNormalTexture, ::getTextureFile(reader), SdfValueTypeNames->Asset, _tokens->colorSpaceRaw);
+    }
+
+    // An ORM texture drives the occlusion, roughness and metallic inputs from a single reader
+    value = VtValue();
+    UsdShadeShader ormReader = ::getTextureReader(previewSurface.GetInput(_tokens->usdPreviewSurfaceOcclusion), &value);
+    if (ormReader)
+    {
+        const GfVec4f fallback = ::getTextureReaderValue(ormReader, _tokens->usdUvTextureFallback, GfVec4f(1.0f, 0.5f, 0.0f, 1.0f));
+        result.add(_tokens->omniPbrRoughness, VtValue(fallback[1]), SdfValueTypeNames->Float);
+        result.add(_tokens->omniPbrMetallic, VtValue(fallback[2]), SdfValueTypeNames->Float);
+        result.add(_tokens->omniPbrRoughnessTextureInfluence, VtValue(1.0f), SdfValueTypeNames->Float);
+        result.add(_tokens->omniPbrMetallicTextureInfluence, VtValue(1.0f), SdfValueTypeNames->Float);
+        result.add(_tokens->omniPbrOrmTextureEnabled, VtValue(true), SdfValueTypeNames->Bool);
+        result.add(_tokens->omniPbrOrmTexture, ::getTextureFile(ormReader), SdfValueTypeNames->Asset, _tokens->colorSpaceRaw);
+    }
+
+    // Single channel textures for roughness, metallic and opacity
+    const std::pair<TfToken, TfToken> singleChannels[] = {
+        { _tokens->usdPreviewSurfaceRoughness, _tokens->omniPbrRoughness },
+        { _tokens->usdPreviewSurfaceMetallic, _tokens->omniPbrMetallic },
+    };
+    for (const auto& [previewName, constantName] : singleChannels)
+    {
+        value = VtValue();
+        UsdShadeShader reader = ::getTextureReader(previewSurface.GetInput(previewName), &value);
+        if (ormReader && reader.GetPrim() == ormReader.GetPrim())
+        {
+            continue;
+        }
+
+        const bool isRoughness = previewName == _tokens->usdPreviewSurfaceRoughness;
+        if (reader)
+        {
+            const GfVec4f fallback = ::getTextureReaderValue(reader, _tokens->usdUvTextureFallback, GfVec4f(isRoughness ? 0.5f : 0.0f));
+            result.add(constantName, VtValue(fallback[0]), SdfValueTypeNames->Float);
+            result.add(
+                isRoughness ? _tokens->omniPbrRoughnessTextureInfluence : _tokens->omniPbrMetallicTextureInfluence,
+                VtValue(1.0f),
+                SdfValueTypeNames->Float
+            );
+            result.add(
+                isRoughness ? _tokens->omniPbrRoughnessTexture : _tokens->omniPbrMetallicTexture,
+                ::getTextureFile(reader),
+                SdfValueTypeNames->Asset,
+                _tokens->colorSpaceRaw
+            );
+        }
+        else if (value.IsHolding<float>())
+        {
+            result.add(constantName, value, SdfValueTypeNames->Float);
+        }
+    }
+
+    value = VtValue();
+    if (UsdShadeShader reader = ::getTextureReader(previewSurface.GetInput(_tokens->usdPreviewSurfaceOpacity), &value))
+    {
+        const GfVec4f fallback = ::getTextureReaderValue(reader, _tokens->usdUvTextureFallback, GfVec4f(1.0f));
+        result.add(_tokens->omniPbrOpacity, VtValue(fallback[0]), SdfValueTypeNames->Float);
+        result.add(_tokens->omniPbrOpacityEnabled, VtValue(true), SdfValueTypeNames->Bool);
+        result.add(_tokens->omniPbrOpacityTextureEnabled, VtValue(true), SdfValueTypeNames->Bool);
+        result.add(_tokens->omniPbrOpacityThreshold, VtValue(std::numeric_limits<float>::epsilon()), SdfValueTypeNames->Float);
+        result.add(_tokens->omniPbrOpacityTexture, ::getTextureFile(reader), SdfValueTypeNames->Asset, _tokens->colorSpaceRaw);
+    }
+    else if (value.IsHolding<float>())
+    {
+        result.add(_tokens->omniPbrOpacity, value, SdfValueTypeNames->Float);
+        if (value.UncheckedGet<float>() < 1.0f)
+        {
+            result.add(_tokens->omniPbrOpacityEnabled, VtValue(true), SdfValueTypeNames->Bool);
+            result.fractionalOpacity = true;
+        }
+    }
+
+    return true;
+}
+
+// Find or create an attribute spec and author its default value
+SdfAttributeSpecHandle setAttributeSpec(
+    const SdfPrimSpecHandle& prim,
+    const TfToken& name,
+    const SdfValueTypeName& typeName,
+    const VtValue& value,
+    SdfVariability variability = SdfVariabilityVarying
+)
+{
+    SdfAttributeSpecHandle attr = prim->GetLayer()->GetAttributeAtPath(prim->GetPath().AppendProperty(name));
+    if (!attr)
+    {
+        attr = SdfAttributeSpec::New(prim, name, typeName, variability);
+    }
+    if (attr && !value.IsEmpty())
+    {
+        attr->SetDefaultValue(value);
+    }
+    return attr;
+}
+
+// Author the MDL shader of a material directly on the layer, equivalent to the shader authored by `definePbrMaterial`
+bool writePbrShader(const SdfLayerHandle& layer, const UsdEditTarget& editTarget, const PbrShaderDescription& description)
+{
+    const SdfPath materialPath = editTarget.MapToSpecPath(description.materialPath);
+    SdfPrimSpecHandle materialSpec = SdfCreatePrimInLayer(layer, materialPath);
+    SdfPrimSpecHandle shaderSpec = SdfCreatePrimInLayer(layer, materialPath.AppendChild(TfToken(g_mdlShaderName)));
+    if (!materialSpec || !shaderSpec)
+    {
+        return false;
+    }
+
+    shaderSpec->SetSpecifier(SdfSpecifierDef);
+    shaderSpec->SetTypeName(UsdSchemaRegistry::GetSchemaTypeName<UsdShadeShader>().GetString());
+
+    ::setAttributeSpec(
+        shaderSpec,
+        UsdShadeTokens->infoImplementationSource,
+        SdfValueTypeNames->Token,
+        VtValue(UsdShadeTokens->sourceAsset),
+        SdfVariabilityUniform
+    );
+    ::setAttributeSpec(
+        shaderSpec,
+        _tokens->infoMdlSourceAsset,
+        SdfValueTypeNames->Asset,
+        VtValue(SdfAssetPath(g_omniPbrAssetPath)),
+        SdfVariabilityUniform
+    );
+    ::setAttributeSpec(
+        shaderSpec,
+        _tokens->infoMdlSourceAssetSubIdentifier,
+        SdfValueTypeNames->Token,
+        VtValue(_tokens->omniPbr),
+        SdfVariabilityUniform
+    );
+
+    for (const PbrShaderDescription::Input& input : description.inputs)
+    {
+        const TfToken name = UsdShadeUtils::GetFullName(input.name, UsdShadeAttributeType::Input);
+        SdfAttributeSpecHandle attr = ::setAttributeSpec(shaderSpec, name, input.typeName, input.value);
+        if (!attr)
+        {
+            return false;
+        }
+        if (!input.colorSpace.IsEmpty())
+        {
+            attr->SetColorSpace(input.colorSpace);
+        }
+    }
+
+    // Connect the surface, displacement and volume outputs of the "mdl" render context to the shader output
+    const TfToken shaderOutputName = UsdShadeUtils::GetFullName(_tokens->out, UsdShadeAttributeType::Output);
+    if (!::setAttributeSpec(shaderSpec, shaderOutputName, SdfValueTypeNames->Token, VtValue()))
+    {
+        return false;
+    }
+    const SdfPath shaderOutputPath = shaderSpec->GetPath().AppendProperty(shaderOutputName);
+    for (const TfToken& output : { _tokens->mdlSurface, _tokens->mdlDisplacement, _tokens->mdlVolume })
+    {
+        const TfToken name = UsdShadeUtils::GetFullName(output, UsdShadeAttributeType::Output);
+        SdfAttributeSpecHandle attr = ::setAttributeSpec(materialSpec, name, SdfValueTypeNames->Token, VtValue());
+        if (!attr)
+        {
+            return false;
+        }
+        SdfConnectionsProxy connections = attr->GetConnectionPathList();
+        connections.ClearEditsAndMakeExplicit();
+        connections.GetExplicitItems().push_back(shaderOutputPath);
+    }
+
+    return true;
+}
+
+// Add an MDL shader to each preview material. Diagnostics are only reported for invalid materials if requested.
+bool addPbrShaders(UsdStagePtr stage, const std::vector<UsdShadeMaterial>& materials, bool reportInvalid)
+{
+    // Read all of the preview materials concurrently, as the reads have no side effects on the stage
+    std::vector<PbrShaderDescription> descriptions(materials.size());
+    std::vector<std::string> reasons(materials.size());
+    std::vector<char> valid(materials.size(), 0);
+    WorkParallelForN(
+        materials.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                valid[i] = ::readPreviewMaterial(materials[i], descriptions[i], &reasons[i]);
+            }
+        }
+    );
+
+    bool success = true;
+    if (reportInvalid)
+    {
+        for (size_t i = 0; i < materials.size(); ++i)
+        {
+            if (!valid[i])
+            {
+                TF_WARN("Cannot add an MDL Shader to UsdShadeMaterial <%s>, %s", materials[i].GetPath().GetAsString().c_str(), reasons[i].c_str());
+                success = false;
+            }
+        }
+    }
+
+    // Author all of the shaders with a single round of change processing
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    SdfLayerHandle layer = editTarget.GetLayer();
+    bool fractionalOpacity = false;
+    {
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0; i < materials.size(); ++i)
+        {
+            if (!valid[i])
+            {
+                continue;
+            }
+
+            if (!::writePbrShader(layer, editTarget, descriptions[i]))
+            {
+                TF_WARN("Unable to add an MDL Shader to UsdShadeMaterial <%s>", descriptions[i].materialPath.GetAsString().c_str());
+                success = false;
+                continue;
+            }
+            fractionalOpacity |= descriptions[i].fractionalOpacity;
+        }
+    }
+
+    if (fractionalOpacity)
+    {
+        setFractionalOpacity(stage);
+    }
+
+    return success;
+}
+
 } // namespace
 
 UsdShadeShader usdex::rtx::createMdlShader(
@@ -304,6 +731,8 @@ UsdShadeShader usdex::rtx::createMdlShader(
     bool connectMaterialOutputs
 )
 {
+    TRACE_FUNCTION();
+
     UsdPrim materialPrim = material.GetPrim();
 
     // Early out if the proposed prim location is invalid
@@ -338,6 +767,8 @@ UsdShadeInput usdex::rtx::createMdlShaderInput(
     std::optional<const usdex::core::ColorSpace> colorSpace
 )
 {
+    TRACE_FUNCTION();
+
     if (!material)
     {
         TF_WARN("Invalid UsdShadeMaterial, cannot create MDL shader input <%s>", name.GetText());
@@ -395,6 +826,8 @@ UsdShadeInput usdex::rtx::createMdlShaderInput(
 
 UsdShadeShader usdex::rtx::computeEffectiveMdlSurfaceShader(const UsdShadeMaterial& material)
 {
+    TRACE_FUNCTION();
+
     if (!material)
     {
         return UsdShadeShader();
@@ -412,6 +845,8 @@ UsdShadeMaterial usdex::rtx::definePbrMaterial(
     const float metallic
 )
 {
+    TRACE_FUNCTION();
+
     // Define the Preview Material first, as it validates the same set of criteria
     UsdShadeMaterial material = usdex::core::definePreviewMaterial(stage, path, color, opacity, roughness, metallic);
     if (!material)
@@ -421,12 +856,11 @@ UsdShadeMaterial usdex::rtx::definePbrMaterial(
     }
 
     // Define the surface shader to be used in the "mdl" rendering context
-    static constexpr const char* s_mdlShaderName = "MDLShader";
     static const SdfAssetPath s_mdlAssetPath = SdfAssetPath(g_omniPbrAssetPath);
-    UsdShadeShader mdlShader = usdex::rtx::createMdlShader(material, s_mdlShaderName, s_mdlAssetPath, _tokens->omniPbr);
+    UsdShadeShader mdlShader = usdex::rtx::createMdlShader(material, g_mdlShaderName, s_mdlAssetPath, _tokens->omniPbr);
     if (!mdlShader)
     {
-        TF_RUNTIME_ERROR("Unable to define UsdShadeShader named \"%s\" as a child of \"%s\"", s_mdlShaderName, path.GetAsString().c_str());
+        TF_RUNTIME_ERROR("Unable to define UsdShadeShader named \"%s\" as a child of \"%s\"", g_mdlShaderName, path.GetAsString().c_str());
         return UsdShadeMaterial();
     }
 
@@ -495,6 +929,8 @@ UsdShadeMaterial usdex::rtx::definePbrMaterial(
     const float metallic
 )
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -511,6 +947,8 @@ UsdShadeMaterial usdex::rtx::definePbrMaterial(
 
 UsdShadeMaterial usdex::rtx::definePbrMaterial(UsdPrim prim, const GfVec3f& color, const float opacity, const float roughness, const float metallic)
 {
+    TRACE_FUNCTION();
+
     // Early out if the prim is not valid
     if (!prim)
     {
@@ -545,8 +983,159 @@ UsdShadeMaterial usdex::rtx::definePbrMaterial(UsdPrim prim, const GfVec3f& colo
     return usdex::rtx::definePbrMaterial(stage, path, color, opacity, roughness, metallic);
 }
 
+UsdShadeMaterial usdex::rtx::definePbrMaterialPrototype(UsdStagePtr stage, const SdfPath& path)
+{
+    TRACE_FUNCTION();
+
+    // The prototype holds the complete network, using the default values of the material interface
+    UsdShadeMaterial prototype = usdex::rtx::definePbrMaterial(stage, path, GfVec3f(0.2f, 0.2f, 0.2f));
+    if (!prototype)
+    {
+        // Do not report the reason as the function we called will have already logged the diagnostic for us.
+        return UsdShadeMaterial();
+    }
+
+    // The prototype is abstract, so that it is not rendered itself, but can still be specialized by each material
+    if (!prototype.GetPrim().SetSpecifier(SdfSpecifierClass))
+    {
+        TF_RUNTIME_ERROR("Unable to author the class specifier of the UsdShadeMaterial prototype at \"%s\"", path.GetAsString().c_str());
+        return UsdShadeMaterial();
+    }
+
+    return prototype;
+}
+
+UsdShadeMaterial usdex::rtx::definePbrMaterialPrototype(UsdPrim parent, const std::string& name)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        return UsdShadeMaterial();
+    }
+
+    // Call overloaded function
+    UsdStageWeakPtr stage = parent.GetStage();
+    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
+    return usdex::rtx::definePbrMaterialPrototype(stage, path);
+}
+
+UsdShadeMaterial usdex::rtx::specializePbrMaterial(
+    const UsdShadeMaterial& prototype,
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const GfVec3f& color,
+    const float opacity,
+    const float roughness,
+    const float metallic
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        return UsdShadeMaterial();
+    }
+
+    // The prototype must be composed on the same stage, or the specialization would not resolve
+    if (!::isPbrMaterialPrototype(prototype) || prototype.GetPrim().GetStage() != stage)
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdShadeMaterial at \"%s\" because <%s> is not a PBR material prototype on the same stage",
+            path.GetAsString().c_str(),
+            prototype.GetPath().GetAsString().c_str()
+        );
+        return UsdShadeMaterial();
+    }
+
+    if (!::validatePbrMaterialValues(path, opacity, roughness, metallic))
+    {
+        return UsdShadeMaterial();
+    }
+
+    UsdShadeMaterial material = UsdShadeMaterial::Define(stage, path);
+    if (!material)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial at \"%s\"", path.GetAsString().c_str());
+        return UsdShadeMaterial();
+    }
+
+    // Compose the shader networks and the material interface from the prototype
+    UsdPrim prim = material.GetPrim();
+    if (!prim.GetSpecializes().AddSpecialize(prototype.GetPath()))
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to specialize UsdShadeMaterial prototype <%s> at \"%s\"",
+            prototype.GetPath().GetAsString().c_str(),
+            path.GetAsString().c_str()
+        );
+        return UsdShadeMaterial();
+    }
+
+    // Only author the interface values which differ from the prototype
+    const std::pair<TfToken, VtValue> values[] = {
+        { _tokens->materialColor, VtValue(color) },
+        { _tokens->materialOpacity, VtValue(opacity) },
+        { _tokens->materialRoughness, VtValue(roughness) },
+        { _tokens->materialMetallic, VtValue(metallic) },
+    };
+    for (const auto& [name, value] : values)
+    {
+        UsdShadeInput input = material.GetInput(name);
+        VtValue current;
+        if (!input.Get(&current) || current != value)
+        {
+            input.Set(value);
+        }
+    }
+
+    // Enable opacity and set the required render settings if the material is not fully opaque
+    if (opacity < 1.0f)
+    {
+        UsdShadeShader mdlShader = usdex::rtx::computeEffectiveMdlSurfaceShader(material);
+        mdlShader.CreateInput(_tokens->omniPbrOpacityEnabled, SdfValueTypeNames->Bool).Set(true);
+        setFractionalOpacity(stage);
+    }
+
+    return material;
+}
+
+UsdShadeMaterial usdex::rtx::specializePbrMaterial(
+    const UsdShadeMaterial& prototype,
+    UsdPrim parent,
+    const std::string& name,
+    const GfVec3f& color,
+    const float opacity,
+    const float roughness,
+    const float metallic
+)
+{
+    TRACE_FUNCTION();
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        return UsdShadeMaterial();
+    }
+
+    // Call overloaded function
+    UsdStageWeakPtr stage = parent.GetStage();
+    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
+    return usdex::rtx::specializePbrMaterial(prototype, stage, path, color, opacity, roughness, metallic);
+}
+
 bool usdex::rtx::addDiffuseTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
 {
+    TRACE_FUNCTION();
+
     if (!verifyValidOmniPbrMaterial(material, texturePath))
     {
         return false;
@@ -566,7 +1155,7 @@ bool usdex::rtx::addDiffuseTextureToPbrMaterial(UsdShadeMaterial& material, cons
     {
         matColorInput.Get<GfVec3f>(&color);
         createMdlShaderInput(material, _tokens->omniPbrAlbedoColor, VtValue(color), SdfValueTypeNames->Color3f);
-        ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), _tokens->materialColorInputs);
+        ::removeMaterialInput(material, _tokens->materialColorInputs);
     }
     UsdShadeInput matTextureInput = ::createMaterialLinkedMdlFileInput(
         material,
@@ -587,6 +1176,8 @@ bool usdex::rtx::addDiffuseTextureToPbrMaterial(UsdShadeMaterial& material, cons
 
 bool usdex::rtx::addNormalTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
 {
+    TRACE_FUNCTION();
+
     if (!verifyValidOmniPbrMaterial(material, texturePath))
     {
         return false;
@@ -617,6 +1208,8 @@ bool usdex::rtx::addNormalTextureToPbrMaterial(UsdShadeMaterial& material, const
 
 bool usdex::rtx::addOpacityTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
 {
+    TRACE_FUNCTION();
+
     if (!verifyValidOmniPbrMaterial(material, texturePath))
     {
         return false;
@@ -649,6 +1242,8 @@ bool usdex::rtx::addOpacityTextureToPbrMaterial(UsdShadeMaterial& material, cons
 
 bool usdex::rtx::addRoughnessTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
 {
+    TRACE_FUNCTION();
+
     if (!verifyValidOmniPbrMaterial(material, texturePath))
     {
         return false;
@@ -677,6 +1272,8 @@ bool usdex::rtx::addRoughnessTextureToPbrMaterial(UsdShadeMaterial& material, co
 
 bool usdex::rtx::addMetallicTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
 {
+    TRACE_FUNCTION();
+
     if (!verifyValidOmniPbrMaterial(material, texturePath))
     {
         return false;
@@ -705,6 +1302,8 @@ bool usdex::rtx::addMetallicTextureToPbrMaterial(UsdShadeMaterial& material, con
 
 bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
 {
+    TRACE_FUNCTION();
+
     if (!verifyValidOmniPbrMaterial(material, texturePath))
     {
         return false;
@@ -724,7 +1323,7 @@ bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const Sd
     {
         input.Get<float>(&metallic);
         createMdlShaderInput(material, _tokens->omniPbrMetallic, VtValue(metallic), SdfValueTypeNames->Float);
-        ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), _tokens->materialMetallicInputs);
+        ::removeMaterialInput(material, _tokens->materialMetallicInputs);
     }
 
     float roughness = 0.5f;
@@ -733,7 +1332,7 @@ bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const Sd
     {
         input.Get<float>(&roughness);
         createMdlShaderInput(material, _tokens->omniPbrRoughness, VtValue(roughness), SdfValueTypeNames->Float);
-        ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), _tokens->materialRoughnessInputs);
+        ::removeMaterialInput(material, _tokens->materialRoughnessInputs);
     }
 
     // These need to be set for MDL to use an ORM map
@@ -757,8 +1356,58 @@ bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const Sd
     return true;
 }
 
+bool usdex::rtx::addPbrShadersToPreviewMaterials(const std::vector<UsdShadeMaterial>& materials)
+{
+    TRACE_FUNCTION();
+
+    if (materials.empty())
+    {
+        return true;
+    }
+
+    // All of the materials must be on the same stage, so that the shaders can be authored with a single round of change processing
+    UsdStagePtr stage = materials[0].GetPrim().GetStage();
+    for (const UsdShadeMaterial& material : materials)
+    {
+        if (!material || material.GetPrim().GetStage() != stage)
+        {
+            TF_WARN(
+                "UsdShadeMaterial <%s> is not valid or belongs to a different stage, cannot add MDL Shaders to the materials",
+                material.GetPath().GetAsString().c_str()
+            );
+            return false;
+        }
+    }
+
+    return ::addPbrShaders(stage, materials, /* reportInvalid */ true);
+}
+
+bool usdex::rtx::addPbrShadersToPreviewMaterials(UsdStagePtr stage)
+{
+    TRACE_FUNCTION();
+
+    if (!stage)
+    {
+        TF_WARN("Invalid UsdStage, cannot add MDL Shaders to the preview materials");
+        return false;
+    }
+
+    std::vector<UsdShadeMaterial> materials;
+    for (const UsdPrim& prim : stage->Traverse())
+    {
+        if (prim.IsA<UsdShadeMaterial>())
+        {
+            materials.push_back(UsdShadeMaterial(prim));
+        }
+    }
+
+    return ::addPbrShaders(stage, materials, /* reportInvalid */ false);
+}
+
 UsdShadeMaterial usdex::rtx::defineGlassMaterial(UsdStagePtr stage, const SdfPath& path, const GfVec3f& color, const float indexOfRefraction)
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
@@ -865,6 +1514,8 @@ UsdShadeMaterial usdex::rtx::defineGlassMaterial(UsdStagePtr stage, const SdfPat
 
 UsdShadeMaterial usdex::rtx::defineGlassMaterial(UsdPrim parent, const std::string& name, const GfVec3f& color, const float indexOfRefraction)
 {
+    TRACE_FUNCTION();
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
@@ -881,6 +1532,8 @@ UsdShadeMaterial usdex::rtx::defineGlassMaterial(UsdPrim parent, const std::stri
 
 UsdShadeMaterial usdex::rtx::defineGlassMaterial(UsdPrim prim, const GfVec3f& color, const float indexOfRefraction)
 {
+    TRACE_FUNCTION();
+
 
     // Early out if the prim is not valid
     if (!prim)
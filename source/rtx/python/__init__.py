@@ -16,12 +16,15 @@ __all__ = [
     # Need to be split up to handle UPS, Mtlx, Mdl
     "defineOmniPbrMaterial",
     "defineOmniGlassMaterial",
+    "definePbrMaterialPrototype",
+    "specializePbrMaterial",
     "addDiffuseTextureToPbrMaterial",
     "addNormalTextureToPbrMaterial",
     "addOrmTextureToPbrMaterial",
     "addRoughnessTextureToPbrMaterial",
     "addMetallicTextureToPbrMaterial",
     "addOpacityTextureToPbrMaterial",
+    "addPbrShadersToPreviewMaterials",
 ]
 
 import os
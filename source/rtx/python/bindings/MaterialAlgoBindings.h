@@ -104,6 +104,11 @@ void bindMaterialAlgo(module& m)
 
             If no valid Shader is connected to the MDL render context then the universal render context will be considered.
 
+            Note:
+
+                The connections are traversed on every call. Use a ``usdex.core.SurfaceShaderCache`` for the "mdl" render context when querying
+                many Materials, or the same Material repeatedly.
+
             Args:
                 material: The Material to consider
 
@@ -196,6 +201,113 @@ void bindMaterialAlgo(module& m)
                 The newly defined UsdShade.Material. Returns an Invalid prim on error
         )"
     );
+    m.def(
+        "definePbrMaterialPrototype",
+        overload_cast<UsdStagePtr, const SdfPath&>(&definePbrMaterialPrototype),
+        arg("stage"),
+        arg("path"),
+        R"(
+            Defines an abstract PBR ``UsdShade.Material`` prototype, from which many PBR materials can be specialized using ``specializePbrMaterial()``.
+
+            The prototype is a ``class`` prim holding the complete network of ``definePbrMaterial()``, including the MDL source asset and every shader
+            input, authored with the default values of the Material interface. It is intended to be defined once per stage (e.g. in the "Materials"
+            scope of an asset), so that each material specializing it only needs to author the interface inputs which differ from the prototype.
+
+            Note:
+                The prototype should be defined within the default prim of the stage, so that it remains available when the stage is referenced.
+
+            Parameters:
+                - **stage** - The stage on which to define the prototype
+                - **path** - The absolute prim path at which to define the prototype
+
+            Returns:
+                The newly defined UsdShade.Material prototype. Returns an Invalid prim on error
+        )"
+    );
+    m.def(
+        "definePbrMaterialPrototype",
+        overload_cast<UsdPrim, const std::string&>(&definePbrMaterialPrototype),
+        arg("parent"),
+        arg("name"),
+        R"(
+            Defines an abstract PBR ``UsdShade.Material`` prototype, from which many PBR materials can be specialized using ``specializePbrMaterial()``.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+
+            Parameters:
+                - **parent** - Prim below which to define the prototype
+                - **name** - Name of the prototype
+
+            Returns:
+                The newly defined UsdShade.Material prototype. Returns an Invalid prim on error
+        )"
+    );
+    m.def(
+        "specializePbrMaterial",
+        overload_cast<const UsdShadeMaterial&, UsdStagePtr, const SdfPath&, const GfVec3f&, const float, const float, const float>(
+            &specializePbrMaterial
+        ),
+        arg("prototype"),
+        arg("stage"),
+        arg("path"),
+        arg("color"),
+        arg("opacity") = 1.0f,
+        arg("roughness") = 0.5f,
+        arg("metallic") = 0.0f,
+        R"(
+            Defines a PBR ``UsdShade.Material`` which specializes a prototype defined by ``definePbrMaterialPrototype()``.
+
+            The resulting Material is equivalent to one defined by ``definePbrMaterial()``, but its shader networks are composed from the prototype.
+            Only the "Interface" ``UsdShade.Inputs`` whose values differ from the prototype are authored on the Material, along with the MDL shader
+            inputs required to enable opacity. The ``add*TextureToPbrMaterial`` functions can be used on the resulting Material.
+
+            Note:
+                Any interface input which is replaced by a texture remains on the Material, as the input is authored on the prototype, but it is
+                disconnected from both render contexts.
+
+            Parameters:
+                - **prototype** - The prototype to specialize. It must be on the same stage as the Material.
+                - **stage** - The stage on which to define the Material
+                - **path** - The absolute prim path at which to define the Material
+                - **color** - The diffuse color of the Material
+                - **opacity** - The Opacity Amount to set. When less than 1.0, Enable Opacity is set to true and Fractional Opacity is enabled in the RT renderer
+                - **roughness** - The Roughness Amount to set, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy
+                - **metallic** - The Metallic Amount to set, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic
+
+            Returns:
+                The newly defined UsdShade.Material. Returns an Invalid prim on error
+        )"
+    );
+    m.def(
+        "specializePbrMaterial",
+        overload_cast<const UsdShadeMaterial&, UsdPrim, const std::string&, const GfVec3f&, const float, const float, const float>(
+            &specializePbrMaterial
+        ),
+        arg("prototype"),
+        arg("parent"),
+        arg("name"),
+        arg("color"),
+        arg("opacity") = 1.0f,
+        arg("roughness") = 0.5f,
+        arg("metallic") = 0.0f,
+        R"(
+            Defines a PBR ``UsdShade.Material`` which specializes a prototype defined by ``definePbrMaterialPrototype()``.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+
+            Parameters:
+                - **prototype** - The prototype to specialize. It must be on the same stage as the Material.
+                - **parent** - Prim below which to define the Material
+                - **name** - Name of the Material
+                - **color** - The diffuse color of the Material
+                - **opacity** - The Opacity Amount to set. When less than 1.0, Enable Opacity is set to true and Fractional Opacity is enabled in the RT renderer
+                - **roughness** - The Roughness Amount to set, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy
+                - **metallic** - The Metallic Amount to set, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic
+
+            Returns:
+                The newly defined UsdShade.Material. Returns an Invalid prim on error
+        )"
+    );
     m.def(
         "addDiffuseTextureToPbrMaterial",
         &addDiffuseTextureToPbrMaterial,
@@ -330,6 +442,49 @@ void bindMaterialAlgo(module& m)
                 Whether or not the texture was added to the material
         )"
     );
+    m.def(
+        "addPbrShadersToPreviewMaterials",
+        overload_cast<const std::vector<UsdShadeMaterial>&>(&addPbrShadersToPreviewMaterials),
+        arg("materials"),
+        call_guard<gil_scoped_release>(),
+        R"(
+            Adds an OmniPBR MDL shader to each preview material, reproducing the values and textures of its USD Preview Surface shader.
+
+            This is intended for materials defined by ``usdex.core.definePreviewMaterial()`` and its associated ``add*Texture`` functions, so that
+            the materials drive an RTX render context as well as the universal render context. The USD Preview Surface network of each material is
+            left unchanged, and no Material interface is added, so the MDL shader inputs are set directly.
+
+            The textures and fallback values are mapped as by the ``add*TextureToPbrMaterial`` functions. All of the materials are read
+            concurrently, and then all of the MDL shaders are authored directly to the edit target layer with a single round of change processing.
+
+            Note:
+                Materials which do not have a USD Preview Surface shader, or which already have an MDL surface shader, are not modified.
+
+            Args:
+                materials: The preview materials to add MDL shaders to
+
+            Returns:
+                Whether an MDL shader was added to every material
+        )"
+    );
+    m.def(
+        "addPbrShadersToPreviewMaterials",
+        overload_cast<UsdStagePtr>(&addPbrShadersToPreviewMaterials),
+        arg("stage"),
+        call_guard<gil_scoped_release>(),
+        R"(
+            Adds an OmniPBR MDL shader to every preview material on the stage, reproducing the values and textures of its USD Preview Surface shader.
+
+            This behaves as the overload above for all of the ``UsdShade.Material`` prims on the stage. Materials which do not have a USD Preview
+            Surface shader, or which already have an MDL surface shader, are skipped without reporting a diagnostic.
+
+            Args:
+                stage: The stage containing the preview materials
+
+            Returns:
+                Whether an MDL shader was added to every preview material which did not already have one
+        )"
+    );
     m.def(
         "defineGlassMaterial",
         overload_cast<UsdStagePtr, const SdfPath&, const GfVec3f&, const float>(&defineGlassMaterial),
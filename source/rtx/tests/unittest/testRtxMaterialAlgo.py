@@ -1008,6 +1008,131 @@ class MaterialAlgoTest(usdex.test.TestCase):
             ["diffuseColor", "metallic", "opacity", "roughness"],
         )
 
+    def testPbrMaterialPrototype(self):
+        stage = self._createTestStage()
+        materialScope = stage.GetPrimAtPath(stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName()))
+
+        prototype = usdex.rtx.definePbrMaterialPrototype(materialScope, "PbrPrototype")
+        self.assertTrue(prototype)
+        self.assertEqual(prototype.GetPrim().GetSpecifier(), Sdf.SpecifierClass)
+        self.assertTrue(prototype.GetPrim().IsAbstract())
+        self._validateShader(usdex.rtx.computeEffectiveMdlSurfaceShader(prototype), "OmniPBR")
+
+        red = usdex.core.sRgbToLinear(Gf.Vec3f(0.8, 0.1, 0.1))
+        material = usdex.rtx.specializePbrMaterial(prototype, materialScope, "Red", red, roughness=0.2)
+        self.assertTrue(material)
+        self.assertEqual(material.GetPrim().GetSpecifier(), Sdf.SpecifierDef)
+        self.assertFalse(material.GetPrim().IsAbstract())
+        self.assertEqual(material.GetPrim().GetSpecializes().GetAllDirectSpecializes(), [prototype.GetPath()])
+
+        # the shader networks are composed from the prototype
+        mdlShader = usdex.rtx.computeEffectiveMdlSurfaceShader(material)
+        previewShader = usdex.core.computeEffectivePreviewSurfaceShader(material)
+        self.assertEqual(mdlShader.GetPath(), material.GetPath().AppendChild("MDLShader"))
+        self._validateShader(mdlShader, "OmniPBR")
+        self._validateShader(previewShader, "UsdPreviewSurface")
+        self._validateOmniPBRMaterial(stage, material, mdlShader, previewShader, red, 1.0, 0.2, 0.0)
+
+        # only the values which differ from the prototype are authored on the material
+        layer = stage.GetEditTarget().GetLayer()
+        spec = layer.GetPrimAtPath(material.GetPath())
+        self.assertEqual(sorted(spec.properties.keys()), ["inputs:diffuseColor", "inputs:roughness"])
+        self.assertEqual(len(spec.nameChildren), 0)
+
+        # opacity enables fractional opacity, which requires an MDL shader input
+        glass = usdex.rtx.specializePbrMaterial(prototype, stage, materialScope.GetPath().AppendChild("Translucent"), red, opacity=0.5)
+        self.assertTrue(glass)
+        self.assertTrue(usdex.rtx.computeEffectiveMdlSurfaceShader(glass).GetInput("enable_opacity").Get())
+        self.assertFractionalOpacityEnabled(stage)
+
+        # textures can be added to the specialized materials, without removing the inputs of the prototype
+        texture = self.tmpFile(name="BaseColor", ext="png")
+        self.assertTrue(usdex.rtx.addDiffuseTextureToPbrMaterial(material, texture))
+        self.assertEqual(mdlShader.GetInput("diffuse_texture").GetConnectedSources()[0][0].source.GetPrim(), material.GetPrim())
+        self.assertFalse(mdlShader.GetInput("diffuse_color_constant").HasConnectedSource())
+        self.assertTrue(prototype.GetInput("diffuseColor"))
+        self.assertFalse(usdex.rtx.computeEffectiveMdlSurfaceShader(prototype).GetInput("diffuse_texture"))
+
+        # the prototype must be a PBR material prototype
+        regular = usdex.rtx.definePbrMaterial(materialScope, "Regular", red)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*is not a PBR material prototype")]):
+            self.assertFalse(usdex.rtx.specializePbrMaterial(regular, materialScope, "Invalid", red))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*is not a PBR material prototype")]):
+            self.assertFalse(usdex.rtx.specializePbrMaterial(UsdShade.Material(), materialScope, "Invalid", red))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid shader parameter value")]):
+            self.assertFalse(usdex.rtx.specializePbrMaterial(prototype, materialScope, "Invalid", red, roughness=2.0))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.rtx.specializePbrMaterial(prototype, Usd.Prim(), "Invalid", red))
+        self.assertFalse(materialScope.GetChild("Invalid"))
+
+    def testAddPbrShadersToPreviewMaterials(self):
+        stage = self._createTestStage()
+        materialScope = stage.GetPrimAtPath(stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName()))
+        red = usdex.core.sRgbToLinear(Gf.Vec3f(0.8, 0.1, 0.1))
+        diffuseTexture = self.tmpFile(name="BaseColor", ext="png")
+        normalTexture = self.tmpFile(name="N", ext="png")
+        ormTexture = self.tmpFile(name="ORM", ext="png")
+        opacityTexture = self.tmpFile(name="Opacity", ext="png")
+
+        plain = usdex.core.definePreviewMaterial(materialScope, "Plain", red, opacity=0.5, roughness=0.2, metallic=0.7)
+        textured = usdex.core.definePreviewMaterial(materialScope, "Textured", red, roughness=0.3, metallic=0.4)
+        self.assertTrue(usdex.core.addDiffuseTextureToPreviewMaterial(textured, Sdf.AssetPath(diffuseTexture)))
+        self.assertTrue(usdex.core.addNormalTextureToPreviewMaterial(textured, Sdf.AssetPath(normalTexture)))
+        self.assertTrue(usdex.core.addOrmTextureToPreviewMaterial(textured, Sdf.AssetPath(ormTexture)))
+        self.assertTrue(usdex.core.addOpacityTextureToPreviewMaterial(textured, Sdf.AssetPath(opacityTexture)))
+        pbr = usdex.rtx.definePbrMaterial(materialScope, "Pbr", red)
+        pbrShader = usdex.rtx.computeEffectiveMdlSurfaceShader(pbr)
+
+        # materials which already have an MDL shader are skipped
+        self.assertTrue(usdex.rtx.addPbrShadersToPreviewMaterials(stage))
+        self.assertEqual(usdex.rtx.computeEffectiveMdlSurfaceShader(pbr).GetPrim(), pbrShader.GetPrim())
+
+        # the values of the preview surface are set directly on the MDL shader
+        mdlShader = usdex.rtx.computeEffectiveMdlSurfaceShader(plain)
+        self.assertEqual(mdlShader.GetPath(), plain.GetPath().AppendChild("MDLShader"))
+        self._validateShader(mdlShader, "OmniPBR")
+        self._validateMdlConnection(plain, mdlShader)
+        self.assertVecAlmostEqual(mdlShader.GetInput("diffuse_color_constant").Get(), red)
+        self.assertAlmostEqual(mdlShader.GetInput("opacity_constant").Get(), 0.5)
+        self.assertTrue(mdlShader.GetInput("enable_opacity").Get())
+        self.assertAlmostEqual(mdlShader.GetInput("reflection_roughness_constant").Get(), 0.2)
+        self.assertAlmostEqual(mdlShader.GetInput("metallic_constant").Get(), 0.7)
+        self.assertEqual(plain.GetInterfaceInputs(), [])
+        self.assertFractionalOpacityEnabled(stage)
+
+        # the textures are set directly on the MDL shader, with the fallback values as constants
+        mdlShader = usdex.rtx.computeEffectiveMdlSurfaceShader(textured)
+        self._validateShader(mdlShader, "OmniPBR")
+        self._validateMdlConnection(textured, mdlShader)
+        self.assertVecAlmostEqual(mdlShader.GetInput("diffuse_color_constant").Get(), red)
+        self.assertEqual(mdlShader.GetInput("diffuse_texture").Get().path, diffuseTexture)
+        self.assertEqual(mdlShader.GetInput("diffuse_texture").GetAttr().GetColorSpace(), "auto")
+        self.assertEqual(mdlShader.GetInput("normalmap_texture").Get().path, normalTexture)
+        self.assertEqual(mdlShader.GetInput("normalmap_texture").GetAttr().GetColorSpace(), "raw")
+        self.assertEqual(mdlShader.GetInput("ORM_texture").Get().path, ormTexture)
+        self.assertTrue(mdlShader.GetInput("enable_ORM_texture").Get())
+        self.assertAlmostEqual(mdlShader.GetInput("reflection_roughness_constant").Get(), 0.3)
+        self.assertAlmostEqual(mdlShader.GetInput("metallic_constant").Get(), 0.4)
+        self.assertEqual(mdlShader.GetInput("reflection_roughness_texture_influence").Get(), 1.0)
+        self.assertFalse(mdlShader.GetInput("reflectionroughness_texture"))
+        self.assertEqual(mdlShader.GetInput("opacity_texture").Get().path, opacityTexture)
+        self.assertTrue(mdlShader.GetInput("enable_opacity_texture").Get())
+
+        # the preview surface networks are unchanged
+        previewShader = usdex.core.computeEffectivePreviewSurfaceShader(textured)
+        self.assertEqual(previewShader.GetPath(), textured.GetPath().AppendChild("PreviewSurface"))
+        self.assertTrue(previewShader.GetInput("diffuseColor").HasConnectedSource())
+
+        # explicitly requested materials report why they were not modified
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*already has an MDL Shader")]):
+            self.assertFalse(usdex.rtx.addPbrShadersToPreviewMaterials([pbr]))
+        empty = UsdShade.Material.Define(stage, materialScope.GetPath().AppendChild("Empty"))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*does not have a valid USD Preview Surface Shader")]):
+            self.assertFalse(usdex.rtx.addPbrShadersToPreviewMaterials([empty]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*is not valid or belongs to a different stage")]):
+            self.assertFalse(usdex.rtx.addPbrShadersToPreviewMaterials([UsdShade.Material()]))
+        self.assertTrue(usdex.rtx.addPbrShadersToPreviewMaterials([]))
+
 
 class definePbrMaterialTestCase(usdex.test.DefineFunctionTestCase):
 
@@ -9,6 +9,7 @@ __all__ = [
 import unittest
 from abc import abstractmethod
 
+import usdex.core
 from pxr import Sdf, Tf, Usd, UsdGeom
 
 from .ScopedDiagnosticChecker import ScopedDiagnosticChecker
@@ -133,6 +134,30 @@ class DefineFunctionTestCase(TestCase):
         self.assertDefineFunctionSuccess(result)
         self.assertIsValidUsd(stage)
 
+    def testSdfAuthoringBackend(self):
+        # The Sdf authoring backend must author the same opinions as the default Usd authoring backend
+        path = Sdf.Path("/World/NewPrim")
+        specs = {}
+        for backend in (usdex.core.AuthoringBackend.eUsd, usdex.core.AuthoringBackend.eSdf):
+            stage = self.createTestStage()
+            stage.SetEditTarget(Usd.EditTarget(self.rootLayer))
+            with usdex.core.ScopedAuthoringBackend(backend):
+                result = self.defineFunc(stage, path, *self.requiredArgs)
+            self.assertDefineFunctionSuccess(result)
+            self.assertIsValidUsd(stage)
+            specs[backend] = self.__summarizePrimSpec(self.rootLayer.GetPrimAtPath(path))
+
+        self.assertEqual(usdex.core.getAuthoringBackend(), usdex.core.AuthoringBackend.eUsd)
+        self.assertEqual(specs[usdex.core.AuthoringBackend.eSdf], specs[usdex.core.AuthoringBackend.eUsd])
+
+    @classmethod
+    def __summarizePrimSpec(cls, primSpec: Sdf.PrimSpec) -> dict:
+        """Gather the fields of a prim spec, its properties, and its descendants so that they can be compared"""
+        summary = {key: primSpec.GetInfo(key) for key in primSpec.ListInfoKeys()}
+        summary["properties"] = {prop.name: {key: prop.GetInfo(key) for key in prop.ListInfoKeys()} for prop in primSpec.properties}
+        summary["children"] = {child.name: cls.__summarizePrimSpec(child) for child in primSpec.nameChildren}
+        return summary
+
     def testWeakerStronger(self):
         # A prim can be defined in a weaker sub layer and then re-defined in a stronger one.
         stage = self.createTestStage()
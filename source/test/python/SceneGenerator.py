@@ -0,0 +1,205 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+__all__ = [
+    "SceneGeneratorOptions",
+    "generateScene",
+]
+
+import dataclasses
+import math
+from typing import List, Optional
+
+import usdex.core
+from pxr import Gf, Usd, UsdGeom, Vt
+
+_MASK = 0xFFFFFFFFFFFFFFFF
+
+
+@dataclasses.dataclass
+class SceneGeneratorOptions:
+    """The options controlling the content of a scene produced by `generateScene`
+
+    Args:
+
+        seed: The seed of the random values. The same seed and options always produce the same scene.
+        hierarchyDepth: The number of levels of `UsdGeom.Xform` prims between the root and the geometry.
+        hierarchyWidth: The number of child `UsdGeom.Xform` prims of each non-leaf `UsdGeom.Xform`.
+        meshCount: The number of `UsdGeom.Mesh` prims.
+        verticesPerMesh: The approximate number of vertices of each mesh, which are arranged in a square grid of quads.
+        groomCount: The number of `UsdGeom.BasisCurves` prims.
+        curvesPerGroom: The number of curves in each groom.
+        verticesPerCurve: The number of vertices in each curve. At least 2 vertices are authored.
+        pointCloudCount: The number of `UsdGeom.Points` prims.
+        pointsPerCloud: The number of points in each point cloud.
+        materialCount: The number of preview materials, which are bound to the geometry in turn.
+        nameCollisionRate: The probability (0-1) that the preferred name of a geometry prim collides with its siblings.
+    """
+
+    seed: int = 0
+    hierarchyDepth: int = 2
+    hierarchyWidth: int = 4
+    meshCount: int = 16
+    verticesPerMesh: int = 1024
+    groomCount: int = 0
+    curvesPerGroom: int = 1000
+    verticesPerCurve: int = 8
+    pointCloudCount: int = 0
+    pointsPerCloud: int = 10000
+    materialCount: int = 4
+    nameCollisionRate: float = 0.0
+
+
+class _SceneRandom:
+    """A small and fast random number generator (SplitMix64), which produces identical sequences to the C++ `usdex::test::generateScene`"""
+
+    def __init__(self, seed: int) -> None:
+        self.state = seed & _MASK
+
+    def next(self) -> int:
+        self.state = (self.state + 0x9E3779B97F4A7C15) & _MASK
+        z = self.state
+        z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & _MASK
+        z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & _MASK
+        return z ^ (z >> 31)
+
+    def uniform(self) -> float:
+        """A uniformly distributed value in [0, 1)"""
+        return (self.next() >> 11) * (1.0 / 9007199254740992.0)
+
+
+def generateScene(parent: Usd.Prim, options: Optional[SceneGeneratorOptions] = None) -> List[Usd.Prim]:
+    """Generate a synthetic scene below `parent` using the `usdex.core` define functions, so that production scale inputs can be authored for
+    benchmarks and stress tests.
+
+    The scene consists of a "Materials" scope containing the preview materials, and a "Geometry" hierarchy of `UsdGeom.Xform` prims with the
+    meshes, grooms, and point clouds distributed evenly across the leaves of the hierarchy. The preferred names of colliding geometry prims are
+    made unique using `usdex.core.getValidChildNames`.
+
+    The same seed and options always produce the same scene, on all platforms, and the C++ `usdex::test::generateScene` produces an identical
+    scene to this function.
+
+    Args:
+
+        parent: The prim below which to generate the scene.
+        options: The options controlling the content of the scene.
+
+    Returns:
+
+        The geometry prims in the order they were defined (meshes, then grooms, then point clouds).
+
+    Example:
+
+        .. code-block:: python
+
+            import usdex.test
+
+            options = usdex.test.SceneGeneratorOptions(seed=7, meshCount=1000, nameCollisionRate=0.1)
+            prims = usdex.test.generateScene(stage.GetDefaultPrim(), options)
+    """
+    if options is None:
+        options = SceneGeneratorOptions()
+    random = _SceneRandom(options.seed)
+    result = []
+
+    # Materials
+    materials = []
+    if options.materialCount:
+        scope = usdex.core.defineScope(parent, "Materials").GetPrim()
+        for i in range(options.materialCount):
+            r = random.uniform()
+            g = random.uniform()
+            b = random.uniform()
+            materials.append(usdex.core.definePreviewMaterial(scope, f"Material_{i}", Gf.Vec3f(r, g, b)))
+
+    # Hierarchy, defined breadth first
+    leaves = [usdex.core.defineXform(parent, "Geometry").GetPrim()]
+    for _ in range(options.hierarchyDepth):
+        children = []
+        for prim in leaves:
+            for i in range(options.hierarchyWidth):
+                x = random.uniform() * 100.0
+                y = random.uniform() * 100.0
+                transform = Gf.Transform()
+                transform.SetTranslation(Gf.Vec3d(x, y, 0.0))
+                children.append(usdex.core.defineXform(prim, f"Group_{i}", transform).GetPrim())
+        if not children:
+            break
+        leaves = children
+
+    # Preferred names, with collisions resolved against the other geometry of the same leaf
+    baseNames = ("Mesh", "Groom", "Points")
+    counts = (options.meshCount, options.groomCount, options.pointCloudCount)
+    items = []
+    preferredNames = [[] for _ in leaves]
+    for kind in range(3):
+        for i in range(counts[kind]):
+            leaf = len(items) % len(leaves)
+            collides = random.uniform() < options.nameCollisionRate
+            names = preferredNames[leaf]
+            items.append((kind, leaf, len(names)))
+            names.append(baseNames[kind] if collides else f"{baseNames[kind]}_{i}")
+    validNames = [usdex.core.getValidChildNames(leaves[leaf], preferredNames[leaf]) for leaf in range(len(leaves))]
+
+    # Geometry
+    meshWidth = max(int(math.sqrt(options.verticesPerMesh)), 2) - 1
+    verticesPerCurve = max(options.verticesPerCurve, 2)
+    for itemIndex, (kind, leaf, nameIndex) in enumerate(items):
+        name = str(validNames[leaf][nameIndex])
+
+        if kind == 0:
+            offsetX = random.uniform() * 10.0
+            offsetY = random.uniform() * 10.0
+            points = Vt.Vec3fArray(
+                [
+                    Gf.Vec3f(offsetX + x / meshWidth, offsetY + y / meshWidth, random.uniform() * 0.1)
+                    for y in range(meshWidth + 1)
+                    for x in range(meshWidth + 1)
+                ]
+            )
+            stride = meshWidth + 1
+            faceVertexCounts = Vt.IntArray([4] * (meshWidth * meshWidth))
+            faceVertexIndices = Vt.IntArray(
+                [
+                    index
+                    for y in range(meshWidth)
+                    for x in range(meshWidth)
+                    for index in (y * stride + x, y * stride + x + 1, y * stride + x + stride + 1, y * stride + x + stride)
+                ]
+            )
+            prim = usdex.core.definePolyMesh(leaves[leaf], name, faceVertexCounts, faceVertexIndices, points).GetPrim()
+        elif kind == 1:
+            curveVertexCounts = Vt.IntArray([verticesPerCurve] * options.curvesPerGroom)
+            points = []
+            for _ in range(options.curvesPerGroom):
+                rootX = random.uniform()
+                rootY = random.uniform()
+                leanX = (random.uniform() - 0.5) * 0.2
+                leanY = (random.uniform() - 0.5) * 0.2
+                for v in range(verticesPerCurve):
+                    t = v / (verticesPerCurve - 1)
+                    points.append(Gf.Vec3f(rootX + leanX * t, rootY + leanY * t, t))
+            widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([0.01]))
+            prim = usdex.core.defineLinearBasisCurves(
+                leaves[leaf],
+                name,
+                curveVertexCounts,
+                Vt.Vec3fArray(points),
+                UsdGeom.Tokens.nonperiodic,
+                widths,
+            ).GetPrim()
+        else:
+            points = []
+            for _ in range(options.pointsPerCloud):
+                x = random.uniform()
+                y = random.uniform()
+                z = random.uniform()
+                points.append(Gf.Vec3f(x, y, z))
+            prim = usdex.core.definePointCloud(leaves[leaf], name, Vt.Vec3fArray(points)).GetPrim()
+
+        if prim and materials:
+            usdex.core.bindMaterial(prim, materials[itemIndex % len(materials)])
+        result.append(prim)
+
+    return result
@@ -10,8 +10,11 @@ __all__ = [
     "TestCase",
     "ScopedDiagnosticChecker",
     "DefineFunctionTestCase",
+    "SceneGeneratorOptions",
+    "generateScene",
 ]
 
 from .DefineFunctionTestCase import DefineFunctionTestCase
+from .SceneGenerator import SceneGeneratorOptions, generateScene
 from .ScopedDiagnosticChecker import ScopedDiagnosticChecker
 from .TestCase import TestCase